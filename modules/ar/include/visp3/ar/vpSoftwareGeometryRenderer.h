@@ -0,0 +1,248 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+#ifndef VP_SOFTWARE_GEOMETRY_RENDERER_H
+#define VP_SOFTWARE_GEOMETRY_RENDERER_H
+
+#include <visp3/core/vpConfig.h>
+
+#include <string>
+#include <vector>
+
+#include <visp3/core/vpCameraParameters.h>
+#include <visp3/core/vpHomogeneousMatrix.h>
+#include <visp3/core/vpImage.h>
+#include <visp3/core/vpMatrix.h>
+#include <visp3/core/vpRGBf.h>
+#include <visp3/core/vpRect.h>
+#include <visp3/core/vpTranslationVector.h>
+
+BEGIN_VISP_NAMESPACE
+/**
+ * \ingroup group_ar_renderer_software
+ *
+ * \brief CPU renderer that outputs the geometric information of a triangle mesh.
+ *
+ * This renderer does not need a GPU nor a windowing system. For a given pose of the object in the camera frame, it
+ * rasterizes the mesh and produces the same maps as the combination of vpPanda3DGeometryRenderer and of the depth
+ * based Canny filter used by the render-based tracker:
+ *
+ * - the depth (Z coordinate in the camera frame, in meters, 0 where the object is not visible);
+ * - the surface normals, in the object frame or in the camera frame;
+ * - optionally, the orientation of the depth discontinuities and the mask of the silhouette pixels.
+ *
+ * Rendering is restricted to the bounding box of the object in the image, that is available with
+ * getBoundingBox(). This box is split into square tiles; the triangles are first binned into the tiles they
+ * overlap and the tiles are then rasterized in parallel when OpenMP is available.
+ *
+ * The mesh is either given with setMesh() or loaded from a Wavefront .obj file with loadObj(). Triangles are assumed to
+ * be counter-clockwise when seen from outside of the object. Faces that are seen from the back are culled, which can
+ * be disabled with setBackFaceCulling().
+ *
+ * \code
+ * vpSoftwareGeometryRenderer renderer(vpSoftwareGeometryRenderer::OBJECT_NORMALS);
+ * renderer.setCameraParameters(cam, 480, 640);
+ * renderer.setClippingDistance(0.01, 2.0);
+ * renderer.loadObj("model.obj");
+ * renderer.setSilhouetteExtraction(true);
+ * renderer.setEdgeThreshold(0.01f);
+ *
+ * renderer.render(cMo);
+ * vpImage<vpRGBf> normals;
+ * vpImage<float> depth, orientation;
+ * vpImage<unsigned char> isSilhouette;
+ * renderer.getRender(normals, depth);
+ * renderer.getSilhouetteRender(orientation, isSilhouette);
+ * \endcode
+ */
+class VISP_EXPORT vpSoftwareGeometryRenderer
+{
+public:
+  enum vpRenderType
+  {
+    OBJECT_NORMALS, //! Surface normals in the object frame.
+    CAMERA_NORMALS, //! Surface normals in the frame of the camera. As with Panda3D, Z points towards the camera and y is up.
+  };
+
+  VP_EXPLICIT vpSoftwareGeometryRenderer(vpRenderType renderType = OBJECT_NORMALS);
+
+  /**
+   * \brief Set the camera intrinsics and the resolution of the rendered images.
+   * The camera model should not have distortion.
+   */
+  void setCameraParameters(const vpCameraParameters &cam, unsigned int height, unsigned int width);
+  vpCameraParameters getCameraParameters() const { return m_cam; }
+  unsigned int getImageHeight() const { return m_height; }
+  unsigned int getImageWidth() const { return m_width; }
+
+  /**
+   * \brief Set the near and far clipping distances, in meters.
+   * Surfaces that are closer than \e nearV or further than \e farV are not rendered.
+   */
+  void setClippingDistance(double nearV, double farV);
+  double getNearClippingDistance() const { return m_near; }
+  double getFarClippingDistance() const { return m_far; }
+
+  vpRenderType getRenderType() const { return m_renderType; }
+  void setRenderType(vpRenderType renderType) { m_renderType = renderType; }
+
+  /**
+   * \brief Set the mesh to render.
+   *
+   * \param vertices Matrix of size N x 3 containing the vertices, expressed in the object frame.
+   * \param indices Indices of the vertices of each triangle, 3 per triangle.
+   * \param normals Optional N x 3 matrix of per-vertex normals, expressed in the object frame. If empty,
+   * each triangle is rendered with its face normal.
+   */
+  void setMesh(const vpMatrix &vertices, const std::vector<unsigned int> &indices, const vpMatrix &normals = vpMatrix());
+
+  /**
+   * \brief Load a mesh from a Wavefront .obj file.
+   * Only the vertices, the vertex normals and the faces are read. Polygonal faces are split into triangles.
+   *
+   * \param filename Path to the .obj file.
+   * \param oTf Transformation from the frame of the file to the object frame, applied to the vertices and normals.
+   */
+  void loadObj(const std::string &filename, const vpHomogeneousMatrix &oTf = vpHomogeneousMatrix());
+
+  unsigned int getNbVertices() const { return static_cast<unsigned int>(m_vertices.size() / 3); }
+  unsigned int getNbTriangles() const { return static_cast<unsigned int>(m_vertexIndices.size() / 3); }
+
+  /**
+   * \brief Get the axis aligned 3D bounding box of the mesh, in the object frame.
+   */
+  void get3DExtents(vpTranslationVector &minValues, vpTranslationVector &maxValues) const;
+
+  /**
+   * \brief Compute the smallest and largest depths of the corners of the 3D bounding box of the mesh, for a given pose.
+   * These values can be used as clipping distances.
+   */
+  void computeClipping(const vpHomogeneousMatrix &cMo, float &nearV, float &farV) const;
+
+  /**
+   * \brief Enable or disable the extraction of the silhouette from the depth map after each render.
+   */
+  void setSilhouetteExtraction(bool enable) { m_extractSilhouette = enable; }
+  bool getSilhouetteExtraction() const { return m_extractSilhouette; }
+
+  /**
+   * \brief Set the threshold, in meters, on the Laplacian of the depth map above which a pixel is considered
+   * as part of the silhouette.
+   */
+  void setEdgeThreshold(float edgeThreshold) { m_edgeThreshold = edgeThreshold; }
+  float getEdgeThreshold() const { return m_edgeThreshold; }
+
+  void setBackFaceCulling(bool enable) { m_backFaceCulling = enable; }
+  bool getBackFaceCulling() const { return m_backFaceCulling; }
+
+  /**
+   * \brief Set the size of the square tiles, in pixels, in which the bounding box of the object is split.
+   */
+  void setTileSize(unsigned int tileSize);
+  unsigned int getTileSize() const { return m_tileSize; }
+
+  /**
+   * \brief Set the number of threads used for rendering.
+   *
+   * \param nbThread Number of threads, -1 to use all the available threads. Without OpenMP, rendering is sequential.
+   */
+  void setNbThread(int nbThread) { m_nbThread = nbThread; }
+  int getNbThread() const { return m_nbThread; }
+
+  /**
+   * \brief Render the mesh for a given pose of the object in the camera frame.
+   */
+  void render(const vpHomogeneousMatrix &cMo);
+
+  /**
+   * \brief Bounding box of the object in the image for the last render, enlarged by a few pixels.
+   * The renders are only computed inside this box.
+   */
+  vpRect getBoundingBox() const { return m_bb; }
+
+  /**
+   * \brief Get the normal and depth maps of the last render.
+   * The images have the full resolution and are zero outside of the bounding box.
+   */
+  void getRender(vpImage<vpRGBf> &normals, vpImage<float> &depth) const;
+
+  /**
+   * \brief Get the depth map of the last render.
+   */
+  void getRender(vpImage<float> &depth) const;
+
+  /**
+   * \brief Get the silhouette maps of the last render. Silhouette extraction should be enabled.
+   *
+   * \param orientation Orientation of the depth discontinuity, in radians, for the silhouette pixels.
+   * \param isSilhouette 255 for the silhouette pixels, 0 elsewhere.
+   */
+  void getSilhouetteRender(vpImage<float> &orientation, vpImage<unsigned char> &isSilhouette) const;
+
+private:
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+  struct vpScreenTriangle;
+#endif
+
+  void updateExtents();
+  void setupTriangles(const vpHomogeneousMatrix &cMo, std::vector<vpScreenTriangle> &triangles) const;
+  void rasterizeTile(const std::vector<vpScreenTriangle> &triangles, const std::vector<unsigned int> &bin,
+                     int top, int left, int bottom, int right);
+  void extractSilhouette();
+  int getNbThreadToUse() const;
+  template <typename T>
+  void placeRenderInto(const vpImage<T> &render, vpImage<T> &target, const T &clearValue) const;
+
+  vpRenderType m_renderType;
+  vpCameraParameters m_cam;
+  unsigned int m_height, m_width;
+  double m_near, m_far;
+
+  std::vector<float> m_vertices; //! Mesh vertices, 3 floats per vertex
+  std::vector<float> m_normals; //! Mesh normals, 3 floats per normal
+  std::vector<unsigned int> m_vertexIndices; //! Vertex indices, 3 per triangle
+  std::vector<int> m_normalIndices; //! Normal indices, 3 per triangle, -1 when the face normal should be used
+  vpTranslationVector m_minExtent, m_maxExtent;
+
+  bool m_extractSilhouette;
+  float m_edgeThreshold;
+  bool m_backFaceCulling;
+  unsigned int m_tileSize;
+  int m_nbThread;
+
+  vpRect m_bb; //! Region of the image that was rendered
+  vpImage<float> m_depth; //! Depth render, cropped to the bounding box
+  vpImage<vpRGBf> m_normalsRender; //! Normals render, cropped to the bounding box
+  vpImage<float> m_orientation; //! Silhouette orientation, cropped to the bounding box
+  vpImage<unsigned char> m_isSilhouette; //! Silhouette mask, cropped to the bounding box
+};
+END_VISP_NAMESPACE
+
+#endif
@@ -982,6 +982,13 @@ void vpSimulator::getSizeInternalView(int &width, int &height)
 
 void vpSimulator::getInternalImage(vpImage<vpRGBa> &I)
 {
+  if (!I.isContiguous()) {
+    // The view is converted as a whole: fill views and padded images from a contiguous copy
+    vpImage<vpRGBa> I_contiguous;
+    getInternalImage(I_contiguous);
+    I = I_contiguous;
+    return;
+  }
   // while (get==0) {;}
   get = 2;
   I.resize(internal_height, internal_width);
@@ -995,6 +1002,12 @@ void vpSimulator::getInternalImage(vpImage<vpRGBa> &I)
  */
 void vpSimulator::getInternalImage(vpImage<unsigned char> &I)
 {
+  if (!I.isContiguous()) {
+    vpImage<unsigned char> I_contiguous;
+    getInternalImage(I_contiguous);
+    I = I_contiguous;
+    return;
+  }
   // while (get==0) {;}
   get = 2;
   I.resize(internal_height, internal_width);
@@ -1208,7 +1208,9 @@ void vpAROgre::updateBackgroundTexture(const vpImage<unsigned char> &I)
   // Buffer data
   Ogre::uint8 *pDest = static_cast<Ogre::uint8 *>(pixelBox.data);
   // Fill in the data in the grey level texture
-  memcpy(pDest, I.bitmap, mBackgroundHeight * mBackgroundWidth);
+  for (unsigned int i = 0; i < mBackgroundHeight; ++i) {
+    memcpy(pDest + i * mBackgroundWidth, I[i], mBackgroundWidth);
+  }
 
   // Unlock the pixel buffer
   mPixelBuffer->unlock();
@@ -1244,7 +1246,9 @@ void vpAROgre::updateBackgroundTexture(const vpImage<vpRGBa> &I)
     }
   }
 #else // if texture in RGBa format which is the format of the input image
-  memcpy(pDest, I.bitmap, mBackgroundHeight * mBackgroundWidth * sizeof(vpRGBa));
+  for (unsigned int i = 0; i < mBackgroundHeight; ++i) {
+    memcpy(pDest + i * mBackgroundWidth * sizeof(vpRGBa), I[i], mBackgroundWidth * sizeof(vpRGBa));
+  }
 #endif
 
   // Unlock the pixel buffer
@@ -1310,7 +1314,9 @@ void vpAROgre::getRenderingOutput(vpImage<vpRGBa> &I, const vpHomogeneousMatrix
     }
   }
 #else // if texture in RGBa format which is the format of the input image
-  memcpy(I.bitmap, pDest, I.getHeight() * I.getWidth() * sizeof(vpRGBa));
+  for (unsigned int i = 0; i < I.getHeight(); ++i) {
+    memcpy(I[i], pDest + i * I.getWidth() * sizeof(vpRGBa), I.getWidth() * sizeof(vpRGBa));
+  }
 #endif
 
   // Unlock the pixel buffer
@@ -0,0 +1,645 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+#include <visp3/ar/vpSoftwareGeometryRenderer.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#include <visp3/core/vpException.h>
+
+#ifdef VISP_HAVE_OPENMP
+#include <omp.h>
+#endif
+
+BEGIN_VISP_NAMESPACE
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+/*!
+ * Triangle projected in the image. Barycentric coordinates are affine functions of the pixel coordinates, while the
+ * inverse of the depth and the attributes divided by the depth are linear in the barycentric coordinates, which gives
+ * perspective correct interpolation.
+ */
+struct vpSoftwareGeometryRenderer::vpScreenTriangle
+{
+  double A[3], B[3], C[3]; //! Barycentric coordinate k of pixel (u, v) is A[k] * u + B[k] * v + C[k]
+  float invZ[3]; //! Inverse of the depth of the vertices
+  float nOverZ[3][3]; //! Normal of each vertex divided by its depth
+  int top, left, bottom, right; //! Pixels covered by the triangle, bounds included
+};
+#endif
+
+namespace
+{
+const int BOUNDING_BOX_MARGIN = 3; //! Margin around the object, in pixels, so that the silhouette filter sees background
+const float BACKGROUND_DEPTH = 1000.f; //! Depth of the background for the silhouette filter
+
+inline void normalize(float *v)
+{
+  const float norm = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+  if (norm > 0.f) {
+    v[0] /= norm;
+    v[1] /= norm;
+    v[2] /= norm;
+  }
+}
+
+inline void cross(const float *a, const float *b, float *c)
+{
+  c[0] = a[1] * b[2] - a[2] * b[1];
+  c[1] = a[2] * b[0] - a[0] * b[2];
+  c[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+// Vertex of a triangle clipped by the near plane
+struct vpClipVertex
+{
+  float p[3]; // Position in the camera frame
+  float n[3]; // Normal in the output frame
+};
+
+vpClipVertex interpolate(const vpClipVertex &a, const vpClipVertex &b, float t)
+{
+  vpClipVertex v;
+  for (unsigned int k = 0; k < 3; ++k) {
+    v.p[k] = a.p[k] + t * (b.p[k] - a.p[k]);
+    v.n[k] = a.n[k] + t * (b.n[k] - a.n[k]);
+  }
+  return v;
+}
+
+// Sutherland-Hodgman clipping of a triangle against the plane Z = nearV. Returns the number of output vertices.
+unsigned int clipNear(const vpClipVertex *in, float nearV, vpClipVertex *out)
+{
+  unsigned int nbOut = 0;
+  for (unsigned int i = 0; i < 3; ++i) {
+    const vpClipVertex &a = in[i];
+    const vpClipVertex &b = in[(i + 1) % 3];
+    const bool aIn = a.p[2] >= nearV, bIn = b.p[2] >= nearV;
+    if (aIn) {
+      out[nbOut++] = a;
+    }
+    if (aIn != bIn) {
+      out[nbOut++] = interpolate(a, b, (nearV - a.p[2]) / (b.p[2] - a.p[2]));
+    }
+  }
+  return nbOut;
+}
+
+// Parse a face element of a Wavefront file ("v", "v/vt", "v//vn" or "v/vt/vn"), indices are converted to 0-based
+bool parseObjFaceElement(const std::string &element, size_t nbVertices, size_t nbNormals, int &vertexIndex,
+                         int &normalIndex)
+{
+  normalIndex = -1;
+  const size_t firstSlash = element.find('/');
+  const long v = std::strtol(element.c_str(), nullptr, 10);
+  vertexIndex = static_cast<int>(v > 0 ? v - 1 : static_cast<long>(nbVertices) + v);
+  if ((v == 0) || (vertexIndex < 0) || (vertexIndex >= static_cast<int>(nbVertices))) {
+    return false;
+  }
+  if (firstSlash != std::string::npos) {
+    const size_t secondSlash = element.find('/', firstSlash + 1);
+    if ((secondSlash != std::string::npos) && (secondSlash + 1 < element.size())) {
+      const long n = std::strtol(element.c_str() + secondSlash + 1, nullptr, 10);
+      normalIndex = static_cast<int>(n > 0 ? n - 1 : static_cast<long>(nbNormals) + n);
+      if ((n == 0) || (normalIndex < 0) || (normalIndex >= static_cast<int>(nbNormals))) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}
+
+vpSoftwareGeometryRenderer::vpSoftwareGeometryRenderer(vpRenderType renderType)
+  : m_renderType(renderType), m_cam(), m_height(0), m_width(0), m_near(0.001), m_far(10.0), m_vertices(), m_normals(),
+  m_vertexIndices(), m_normalIndices(), m_minExtent(), m_maxExtent(), m_extractSilhouette(false), m_edgeThreshold(0.f),
+  m_backFaceCulling(true), m_tileSize(32), m_nbThread(-1), m_bb(), m_depth(), m_normalsRender(), m_orientation(),
+  m_isSilhouette()
+{ }
+
+void vpSoftwareGeometryRenderer::setCameraParameters(const vpCameraParameters &cam, unsigned int height,
+                                                     unsigned int width)
+{
+  if (cam.get_projModel() != vpCameraParameters::perspectiveProjWithoutDistortion) {
+    throw vpException(vpException::badValue, "The software renderer does not support camera models with distortion");
+  }
+  m_cam = cam;
+  m_height = height;
+  m_width = width;
+}
+
+void vpSoftwareGeometryRenderer::setClippingDistance(double nearV, double farV)
+{
+  if ((nearV <= 0.0) || (farV <= nearV)) {
+    throw vpException(vpException::badValue, "Clipping distances should verify 0 < near < far, got near = %f, far = %f",
+                      nearV, farV);
+  }
+  m_near = nearV;
+  m_far = farV;
+}
+
+void vpSoftwareGeometryRenderer::setTileSize(unsigned int tileSize)
+{
+  if (tileSize == 0) {
+    throw vpException(vpException::badValue, "Tile size should be greater than 0");
+  }
+  m_tileSize = tileSize;
+}
+
+void vpSoftwareGeometryRenderer::setMesh(const vpMatrix &vertices, const std::vector<unsigned int> &indices,
+                                         const vpMatrix &normals)
+{
+  if ((vertices.getRows() > 0) && (vertices.getCols() != 3)) {
+    throw vpException(vpException::dimensionError, "Expected a N x 3 matrix of vertices, got %d x %d",
+                      vertices.getRows(), vertices.getCols());
+  }
+  if ((normals.getRows() > 0) && ((normals.getRows() != vertices.getRows()) || (normals.getCols() != 3))) {
+    throw vpException(vpException::dimensionError, "Expected a %d x 3 matrix of normals, got %d x %d",
+                      vertices.getRows(), normals.getRows(), normals.getCols());
+  }
+  if ((indices.size() % 3) != 0) {
+    throw vpException(vpException::dimensionError, "The number of vertex indices should be a multiple of 3");
+  }
+  for (size_t i = 0; i < indices.size(); ++i) {
+    if (indices[i] >= vertices.getRows()) {
+      throw vpException(vpException::badValue, "Vertex index %u is out of range", indices[i]);
+    }
+  }
+
+  m_vertices.resize(vertices.size());
+  for (unsigned int i = 0; i < vertices.size(); ++i) {
+    m_vertices[i] = static_cast<float>(vertices.data[i]);
+  }
+  m_normals.resize(normals.size());
+  for (unsigned int i = 0; i < normals.size(); ++i) {
+    m_normals[i] = static_cast<float>(normals.data[i]);
+  }
+  for (size_t i = 0; i < m_normals.size(); i += 3) {
+    normalize(&m_normals[i]);
+  }
+  m_vertexIndices = indices;
+  m_normalIndices.resize(indices.size());
+  for (size_t i = 0; i < indices.size(); ++i) {
+    m_normalIndices[i] = normals.getRows() > 0 ? static_cast<int>(indices[i]) : -1;
+  }
+  updateExtents();
+}
+
+void vpSoftwareGeometryRenderer::loadObj(const std::string &filename, const vpHomogeneousMatrix &oTf)
+{
+  std::ifstream file(filename.c_str());
+  if (!file.good()) {
+    throw vpException(vpException::ioError, "Could not open 3D model file %s", filename.c_str());
+  }
+
+  std::vector<float> vertices, normals;
+  std::vector<unsigned int> vertexIndices;
+  std::vector<int> normalIndices;
+  std::vector<int> faceVertices, faceNormals;
+  std::string line, keyword, element;
+  unsigned int lineNumber = 0;
+  while (std::getline(file, line)) {
+    ++lineNumber;
+    std::istringstream iss(line);
+    if (!(iss >> keyword)) {
+      continue;
+    }
+    if ((keyword == "v") || (keyword == "vn")) {
+      double x = 0.0, y = 0.0, z = 0.0;
+      if (!(iss >> x >> y >> z)) {
+        throw vpException(vpException::ioError, "%s:%u: could not parse %s", filename.c_str(), lineNumber,
+                          keyword.c_str());
+      }
+      const bool isVertex = keyword == "v";
+      const vpColVector p = isVertex ? (oTf * vpColVector({ x, y, z, 1.0 })) : vpColVector(oTf.getRotationMatrix() * vpColVector({ x, y, z }));
+      std::vector<float> &target = isVertex ? vertices : normals;
+      for (unsigned int k = 0; k < 3; ++k) {
+        target.push_back(static_cast<float>(p[k]));
+      }
+    }
+    else if (keyword == "f") {
+      faceVertices.clear();
+      faceNormals.clear();
+      bool hasNormals = true;
+      while (iss >> element) {
+        int v, n;
+        if (!parseObjFaceElement(element, vertices.size() / 3, normals.size() / 3, v, n)) {
+          throw vpException(vpException::ioError, "%s:%u: invalid face element %s", filename.c_str(), lineNumber,
+                            element.c_str());
+        }
+        faceVertices.push_back(v);
+        faceNormals.push_back(n);
+        hasNormals = hasNormals && (n >= 0);
+      }
+      // Polygons are split into a fan of triangles
+      for (size_t i = 2; i < faceVertices.size(); ++i) {
+        const size_t corners[3] = { 0, i - 1, i };
+        for (unsigned int k = 0; k < 3; ++k) {
+          vertexIndices.push_back(static_cast<unsigned int>(faceVertices[corners[k]]));
+          normalIndices.push_back(hasNormals ? faceNormals[corners[k]] : -1);
+        }
+      }
+    }
+  }
+
+  for (size_t i = 0; i < normals.size(); i += 3) {
+    normalize(&normals[i]);
+  }
+  m_vertices = vertices;
+  m_normals = normals;
+  m_vertexIndices = vertexIndices;
+  m_normalIndices = normalIndices;
+  updateExtents();
+}
+
+void vpSoftwareGeometryRenderer::updateExtents()
+{
+  for (unsigned int k = 0; k < 3; ++k) {
+    m_minExtent[k] = m_vertices.empty() ? 0.0 : std::numeric_limits<double>::max();
+    m_maxExtent[k] = m_vertices.empty() ? 0.0 : -std::numeric_limits<double>::max();
+  }
+  for (size_t i = 0; i < m_vertices.size(); i += 3) {
+    for (unsigned int k = 0; k < 3; ++k) {
+      m_minExtent[k] = std::min<double>(m_minExtent[k], m_vertices[i + k]);
+      m_maxExtent[k] = std::max<double>(m_maxExtent[k], m_vertices[i + k]);
+    }
+  }
+}
+
+void vpSoftwareGeometryRenderer::get3DExtents(vpTranslationVector &minValues, vpTranslationVector &maxValues) const
+{
+  minValues = m_minExtent;
+  maxValues = m_maxExtent;
+}
+
+void vpSoftwareGeometryRenderer::computeClipping(const vpHomogeneousMatrix &cMo, float &nearV, float &farV) const
+{
+  float minZ = std::numeric_limits<float>::max(), maxZ = 0.f;
+  for (unsigned int i = 0; i < 8; ++i) {
+    const vpColVector oP({ (i & 1) ? m_maxExtent[0] : m_minExtent[0], (i & 2) ? m_maxExtent[1] : m_minExtent[1],
+                           (i & 4) ? m_maxExtent[2] : m_minExtent[2], 1.0 });
+    const float Z = static_cast<float>((cMo * oP)[2]);
+    minZ = std::min(minZ, Z);
+    maxZ = std::max(maxZ, Z);
+  }
+  nearV = minZ;
+  farV = maxZ;
+}
+
+int vpSoftwareGeometryRenderer::getNbThreadToUse() const
+{
+#ifdef VISP_HAVE_OPENMP
+  return m_nbThread < 0 ? omp_get_max_threads() : std::max(m_nbThread, 1);
+#else
+  return 1;
+#endif
+}
+
+void vpSoftwareGeometryRenderer::setupTriangles(const vpHomogeneousMatrix &cMo,
+                                                std::vector<vpScreenTriangle> &triangles) const
+{
+  float R[3][3], t[3];
+  for (unsigned int i = 0; i < 3; ++i) {
+    for (unsigned int j = 0; j < 3; ++j) {
+      R[i][j] = static_cast<float>(cMo[i][j]);
+    }
+    t[i] = static_cast<float>(cMo[i][3]);
+  }
+  const float nearV = static_cast<float>(m_near), farV = static_cast<float>(m_far);
+  const double px = m_cam.get_px(), py = m_cam.get_py(), u0 = m_cam.get_u0(), v0 = m_cam.get_v0();
+  const int nbTriangles = static_cast<int>(m_vertexIndices.size() / 3);
+  const int nbThread = std::min(getNbThreadToUse(), std::max(nbTriangles / 1024, 1));
+
+  // Each thread processes a contiguous range of triangles so that their order does not depend on the number of threads
+  std::vector<std::vector<vpScreenTriangle> > threadTriangles(static_cast<size_t>(nbThread));
+#ifdef VISP_HAVE_OPENMP
+#pragma omp parallel num_threads(nbThread)
+#endif
+  {
+#ifdef VISP_HAVE_OPENMP
+    std::vector<vpScreenTriangle> &output = threadTriangles[static_cast<size_t>(omp_get_thread_num())];
+#pragma omp for schedule(static)
+#else
+    std::vector<vpScreenTriangle> &output = threadTriangles[0];
+#endif
+    for (int f = 0; f < nbTriangles; ++f) {
+      const float *oP[3];
+      vpClipVertex corners[3];
+      for (unsigned int k = 0; k < 3; ++k) {
+        oP[k] = &m_vertices[3 * m_vertexIndices[3 * f + k]];
+        for (unsigned int i = 0; i < 3; ++i) {
+          corners[k].p[i] = R[i][0] * oP[k][0] + R[i][1] * oP[k][1] + R[i][2] * oP[k][2] + t[i];
+        }
+      }
+      if ((corners[0].p[2] < nearV) && (corners[1].p[2] < nearV) && (corners[2].p[2] < nearV)) {
+        continue;
+      }
+      if ((corners[0].p[2] > farV) && (corners[1].p[2] > farV) && (corners[2].p[2] > farV)) {
+        continue;
+      }
+
+      const float e1[3] = { oP[1][0] - oP[0][0], oP[1][1] - oP[0][1], oP[1][2] - oP[0][2] };
+      const float e2[3] = { oP[2][0] - oP[0][0], oP[2][1] - oP[0][1], oP[2][2] - oP[0][2] };
+      float faceNormal[3];
+      cross(e1, e2, faceNormal);
+      if (m_backFaceCulling) {
+        // The camera is at the origin, a front face has its normal pointing towards it
+        float cN[3];
+        for (unsigned int i = 0; i < 3; ++i) {
+          cN[i] = R[i][0] * faceNormal[0] + R[i][1] * faceNormal[1] + R[i][2] * faceNormal[2];
+        }
+        if ((cN[0] * corners[0].p[0] + cN[1] * corners[0].p[1] + cN[2] * corners[0].p[2]) >= 0.f) {
+          continue;
+        }
+      }
+      normalize(faceNormal);
+
+      for (unsigned int k = 0; k < 3; ++k) {
+        const int normalIndex = m_normalIndices[3 * f + k];
+        const float *oN = normalIndex >= 0 ? &m_normals[3 * normalIndex] : faceNormal;
+        if (m_renderType == OBJECT_NORMALS) {
+          std::copy(oN, oN + 3, corners[k].n);
+        }
+        else {
+          // Panda3D convention for the camera frame: Y is up and Z points towards the camera
+          for (unsigned int i = 0; i < 3; ++i) {
+            const float cN = R[i][0] * oN[0] + R[i][1] * oN[1] + R[i][2] * oN[2];
+            corners[k].n[i] = i == 0 ? cN : -cN;
+          }
+        }
+      }
+
+      vpClipVertex clipped[4];
+      const unsigned int nbClipped = clipNear(corners, nearV, clipped);
+      for (unsigned int fan = 2; fan < nbClipped; ++fan) {
+        const vpClipVertex *tri[3] = { &clipped[0], &clipped[fan - 1], &clipped[fan] };
+        double u[3], v[3];
+        vpScreenTriangle st;
+        for (unsigned int k = 0; k < 3; ++k) {
+          u[k] = px * tri[k]->p[0] / tri[k]->p[2] + u0;
+          v[k] = py * tri[k]->p[1] / tri[k]->p[2] + v0;
+          st.invZ[k] = 1.f / tri[k]->p[2];
+          for (unsigned int i = 0; i < 3; ++i) {
+            st.nOverZ[k][i] = tri[k]->n[i] * st.invZ[k];
+          }
+        }
+        const double area = (u[1] - u[0]) * (v[2] - v[0]) - (v[1] - v[0]) * (u[2] - u[0]);
+        if (std::fabs(area) < 1e-12) {
+          continue;
+        }
+        st.left = std::max(static_cast<int>(std::ceil(std::min(u[0], std::min(u[1], u[2])))), 0);
+        st.right = std::min(static_cast<int>(std::floor(std::max(u[0], std::max(u[1], u[2])))), static_cast<int>(m_width) - 1);
+        st.top = std::max(static_cast<int>(std::ceil(std::min(v[0], std::min(v[1], v[2])))), 0);
+        st.bottom = std::min(static_cast<int>(std::floor(std::max(v[0], std::max(v[1], v[2])))), static_cast<int>(m_height) - 1);
+        if ((st.left > st.right) || (st.top > st.bottom)) {
+          continue;
+        }
+        // Barycentric coordinate of vertex k is the normalized edge function of the opposite edge
+        for (unsigned int k = 0; k < 3; ++k) {
+          const unsigned int a = (k + 1) % 3, b = (k + 2) % 3;
+          st.A[k] = -(v[b] - v[a]) / area;
+          st.B[k] = (u[b] - u[a]) / area;
+          st.C[k] = ((v[b] - v[a]) * u[a] - (u[b] - u[a]) * v[a]) / area;
+        }
+        output.push_back(st);
+      }
+    }
+  }
+
+  triangles.clear();
+  for (size_t i = 0; i < threadTriangles.size(); ++i) {
+    triangles.insert(triangles.end(), threadTriangles[i].begin(), threadTriangles[i].end());
+  }
+}
+
+void vpSoftwareGeometryRenderer::rasterizeTile(const std::vector<vpScreenTriangle> &triangles,
+                                               const std::vector<unsigned int> &bin, int top, int left, int bottom,
+                                               int right)
+{
+  const float nearV = static_cast<float>(m_near), farV = static_cast<float>(m_far);
+  const int bbTop = static_cast<int>(m_bb.getTop()), bbLeft = static_cast<int>(m_bb.getLeft());
+  for (size_t t = 0; t < bin.size(); ++t) {
+    const vpScreenTriangle &st = triangles[bin[t]];
+    const int i0 = std::max(top, st.top), i1 = std::min(bottom, st.bottom);
+    for (int i = i0; i <= i1; ++i) {
+      // Span of the row inside the triangle: each barycentric coordinate is positive on one side of a line
+      double jMin = std::max(left, st.left), jMax = std::min(right, st.right);
+      for (unsigned int k = 0; k < 3; ++k) {
+        const double c = st.B[k] * i + st.C[k];
+        if (st.A[k] > 0.0) {
+          jMin = std::max(jMin, std::ceil(-c / st.A[k]));
+        }
+        else if (st.A[k] < 0.0) {
+          jMax = std::min(jMax, std::floor(-c / st.A[k]));
+        }
+        else if (c < 0.0) {
+          jMax = jMin - 1.0;
+        }
+      }
+      float *depthRow = m_depth[i - bbTop] - bbLeft;
+      vpRGBf *normalRow = m_normalsRender[i - bbTop] - bbLeft;
+      for (int j = static_cast<int>(jMin); j <= static_cast<int>(jMax); ++j) {
+        float l[3];
+        for (unsigned int k = 0; k < 3; ++k) {
+          l[k] = static_cast<float>(st.A[k] * j + st.B[k] * i + st.C[k]);
+        }
+        const float invZ = l[0] * st.invZ[0] + l[1] * st.invZ[1] + l[2] * st.invZ[2];
+        if (invZ <= 0.f) {
+          continue;
+        }
+        const float Z = 1.f / invZ;
+        if ((Z < nearV) || (Z > farV) || ((depthRow[j] > 0.f) && (Z >= depthRow[j]))) {
+          continue;
+        }
+        float n[3];
+        for (unsigned int k = 0; k < 3; ++k) {
+          n[k] = l[0] * st.nOverZ[0][k] + l[1] * st.nOverZ[1][k] + l[2] * st.nOverZ[2][k];
+        }
+        normalize(n);
+        depthRow[j] = Z;
+        normalRow[j] = vpRGBf(n[0], n[1], n[2]);
+      }
+    }
+  }
+}
+
+void vpSoftwareGeometryRenderer::render(const vpHomogeneousMatrix &cMo)
+{
+  if ((m_height == 0) || (m_width == 0)) {
+    throw vpException(vpException::notInitialized, "Camera parameters should be set before rendering");
+  }
+  std::vector<vpScreenTriangle> triangles;
+  setupTriangles(cMo, triangles);
+
+  // Bounding box of the object, with a margin so that the silhouette can be extracted on its border
+  int top = static_cast<int>(m_height), left = static_cast<int>(m_width), bottom = -1, right = -1;
+  for (size_t i = 0; i < triangles.size(); ++i) {
+    top = std::min(top, triangles[i].top);
+    left = std::min(left, triangles[i].left);
+    bottom = std::max(bottom, triangles[i].bottom);
+    right = std::max(right, triangles[i].right);
+  }
+  if (triangles.empty()) {
+    m_bb = vpRect(0.0, 0.0, 0.0, 0.0);
+  }
+  else {
+    top = std::max(top - BOUNDING_BOX_MARGIN, 0);
+    left = std::max(left - BOUNDING_BOX_MARGIN, 0);
+    bottom = std::min(bottom + BOUNDING_BOX_MARGIN, static_cast<int>(m_height) - 1);
+    right = std::min(right + BOUNDING_BOX_MARGIN, static_cast<int>(m_width) - 1);
+    m_bb = vpRect(left, top, static_cast<unsigned int>(right - left + 1), static_cast<unsigned int>(bottom - top + 1));
+  }
+  const unsigned int bbHeight = static_cast<unsigned int>(m_bb.getHeight());
+  const unsigned int bbWidth = static_cast<unsigned int>(m_bb.getWidth());
+  m_depth.resize(bbHeight, bbWidth, 0.f);
+  m_normalsRender.resize(bbHeight, bbWidth, vpRGBf(0.f));
+
+  if (!triangles.empty()) {
+    // Bin the triangles into the tiles they overlap
+    const int tileSize = static_cast<int>(m_tileSize);
+    const int nbTilesX = (static_cast<int>(bbWidth) + tileSize - 1) / tileSize;
+    const int nbTilesY = (static_cast<int>(bbHeight) + tileSize - 1) / tileSize;
+    std::vector<std::vector<unsigned int> > bins(static_cast<size_t>(nbTilesX * nbTilesY));
+    for (size_t t = 0; t < triangles.size(); ++t) {
+      const int tx0 = (triangles[t].left - left) / tileSize, tx1 = (triangles[t].right - left) / tileSize;
+      const int ty0 = (triangles[t].top - top) / tileSize, ty1 = (triangles[t].bottom - top) / tileSize;
+      for (int ty = ty0; ty <= ty1; ++ty) {
+        for (int tx = tx0; tx <= tx1; ++tx) {
+          bins[static_cast<size_t>(ty * nbTilesX + tx)].push_back(static_cast<unsigned int>(t));
+        }
+      }
+    }
+
+    // Tiles do not overlap, they can be rasterized concurrently
+    const int nbTiles = nbTilesX * nbTilesY;
+    const int nbThread = std::min(getNbThreadToUse(), nbTiles);
+#ifdef VISP_HAVE_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(nbThread)
+#else
+    (void)nbThread;
+#endif
+    for (int tile = 0; tile < nbTiles; ++tile) {
+      const std::vector<unsigned int> &bin = bins[static_cast<size_t>(tile)];
+      if (bin.empty()) {
+        continue;
+      }
+      const int tileTop = top + (tile / nbTilesX) * tileSize, tileLeft = left + (tile % nbTilesX) * tileSize;
+      rasterizeTile(triangles, bin, tileTop, tileLeft, std::min(tileTop + tileSize - 1, bottom),
+                    std::min(tileLeft + tileSize - 1, right));
+    }
+  }
+
+  if (m_extractSilhouette) {
+    extractSilhouette();
+  }
+}
+
+void vpSoftwareGeometryRenderer::extractSilhouette()
+{
+  const int h = static_cast<int>(m_depth.getHeight()), w = static_cast<int>(m_depth.getWidth());
+  m_orientation.resize(m_depth.getHeight(), m_depth.getWidth(), 0.f);
+  m_isSilhouette.resize(m_depth.getHeight(), m_depth.getWidth(), 0);
+  const int nbThread = std::max(std::min(getNbThreadToUse(), h / 16), 1);
+#ifdef VISP_HAVE_OPENMP
+#pragma omp parallel for num_threads(nbThread)
+#else
+  (void)nbThread;
+#endif
+  for (int i = 0; i < h; ++i) {
+    for (int j = 0; j < w; ++j) {
+      if (m_depth[i][j] == 0.f) {
+        continue;
+      }
+      // 3x3 neighborhood, the background and the pixels outside of the render are far away
+      float d[3][3];
+      for (int di = -1; di <= 1; ++di) {
+        for (int dj = -1; dj <= 1; ++dj) {
+          const int r = i + di, c = j + dj;
+          const float value = ((r >= 0) && (r < h) && (c >= 0) && (c < w)) ? m_depth[r][c] : 0.f;
+          d[di + 1][dj + 1] = value < 1e-5f ? BACKGROUND_DEPTH : value;
+        }
+      }
+      const float laplacian = d[0][1] + d[1][0] + d[1][2] + d[2][1] - 4.f * d[1][1];
+      if (std::fabs(laplacian) <= m_edgeThreshold) {
+        continue;
+      }
+      const float gx = (d[0][2] + 2.f * d[1][2] + d[2][2]) - (d[0][0] + 2.f * d[1][0] + d[2][0]);
+      const float gy = (d[2][0] + 2.f * d[2][1] + d[2][2]) - (d[0][0] + 2.f * d[0][1] + d[0][2]);
+      if (gx != 0.f) {
+        // Same convention as the Panda3D depth Canny filter
+        m_orientation[i][j] = std::atan2(-gy, -gx);
+        m_isSilhouette[i][j] = 255;
+      }
+    }
+  }
+}
+
+template <typename T>
+void vpSoftwareGeometryRenderer::placeRenderInto(const vpImage<T> &render, vpImage<T> &target, const T &clearValue) const
+{
+  if ((render.getHeight() != static_cast<unsigned int>(m_bb.getHeight())) ||
+      (render.getWidth() != static_cast<unsigned int>(m_bb.getWidth()))) {
+    throw vpException(vpException::notInitialized, "render() should be called before retrieving the renders");
+  }
+  target.resize(m_height, m_width, clearValue);
+  const unsigned int top = static_cast<unsigned int>(m_bb.getTop());
+  const unsigned int left = static_cast<unsigned int>(m_bb.getLeft());
+  for (unsigned int i = 0; i < render.getHeight(); ++i) {
+    memcpy(target[top + i] + left, render[i], render.getWidth() * sizeof(T));
+  }
+}
+
+void vpSoftwareGeometryRenderer::getRender(vpImage<vpRGBf> &normals, vpImage<float> &depth) const
+{
+  placeRenderInto(m_normalsRender, normals, vpRGBf(0.f));
+  placeRenderInto(m_depth, depth, 0.f);
+}
+
+void vpSoftwareGeometryRenderer::getRender(vpImage<float> &depth) const
+{
+  placeRenderInto(m_depth, depth, 0.f);
+}
+
+void vpSoftwareGeometryRenderer::getSilhouetteRender(vpImage<float> &orientation,
+                                                     vpImage<unsigned char> &isSilhouette) const
+{
+  if (!m_extractSilhouette) {
+    throw vpException(vpException::notInitialized, "Silhouette extraction is not enabled");
+  }
+  placeRenderInto(m_orientation, orientation, 0.f);
+  placeRenderInto(m_isSilhouette, isSilhouette, static_cast<unsigned char>(0));
+}
+
+END_VISP_NAMESPACE
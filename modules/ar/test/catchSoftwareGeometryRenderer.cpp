@@ -0,0 +1,381 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Test the software geometry renderer.
+ */
+
+/*!
+  \example catchSoftwareGeometryRenderer.cpp
+
+  Test the CPU renderer of depth, normals and silhouette maps against ray casting of a cube.
+*/
+
+#include <visp3/core/vpConfig.h>
+
+#if defined(VISP_HAVE_CATCH2)
+#include <fstream>
+#include <limits>
+
+#include <visp3/ar/vpSoftwareGeometryRenderer.h>
+#include <visp3/core/vpIoTools.h>
+
+#if defined(VISP_BUILD_CATCH2)
+#include <catch_amalgamated.hpp>
+#else // Since v3.1.1
+#include <catch2/catch_all.hpp>
+#endif
+
+#ifdef ENABLE_VISP_NAMESPACE
+using namespace VISP_NAMESPACE_NAME;
+#endif
+
+namespace
+{
+const std::string objCube =
+"o Cube\n"
+"v -0.050000 -0.050000  0.050000\n"
+"v -0.050000  0.050000  0.050000\n"
+"v -0.050000 -0.050000 -0.050000\n"
+"v -0.050000  0.050000 -0.050000\n"
+"v  0.050000 -0.050000  0.050000\n"
+"v  0.050000  0.050000  0.050000\n"
+"v  0.050000 -0.050000 -0.050000\n"
+"v  0.050000  0.050000 -0.050000\n"
+"vn -1.0000  0.0000  0.0000\n"  // face -X
+"vn  0.0000  0.0000 -1.0000\n"  // face -Z
+"vn  1.0000  0.0000  0.0000\n"  // face +X
+"vn  0.0000  0.0000  1.0000\n"  // face +Z
+"vn  0.0000 -1.0000  0.0000\n"  // face -Y
+"vn  0.0000  1.0000  0.0000\n"  // face +Y
+"f 2//1 3//1 1//1\n"
+"f 4//2 7//2 3//2\n"
+"f 8//3 5//3 7//3\n"
+"f 6//4 1//4 5//4\n"
+"f 7//5 1//5 3//5\n"
+"f 4//6 6//6 8//6\n"
+"f 2//1 4//1 3//1\n"
+"f 4//2 8//2 7//2\n"
+"f 8//3 6//3 5//3\n"
+"f 6//4 2//4 1//4\n"
+"f 7//5 5//5 1//5\n"
+"f 4//6 2//6 6//6\n";
+
+const double halfSize = 0.05;
+
+// Depth and object normal of the cube surface seen through pixel (i, j), by intersecting the ray with the cube
+bool rayCastCube(const vpCameraParameters &cam, const vpHomogeneousMatrix &oMc, unsigned int i, unsigned int j,
+                 double &Z, vpColVector &normal)
+{
+  const vpColVector cDir({ (j - cam.get_u0()) / cam.get_px(), (i - cam.get_v0()) / cam.get_py(), 1.0 });
+  const vpColVector dir = oMc.getRotationMatrix() * cDir;
+  const vpTranslationVector origin = oMc.getTranslationVector();
+  double tNear = -std::numeric_limits<double>::max(), tFar = std::numeric_limits<double>::max();
+  unsigned int axis = 0;
+  for (unsigned int k = 0; k < 3; ++k) {
+    if (std::fabs(dir[k]) < 1e-12) {
+      if (std::fabs(origin[k]) > halfSize) {
+        return false;
+      }
+      continue;
+    }
+    double t1 = (-halfSize - origin[k]) / dir[k], t2 = (halfSize - origin[k]) / dir[k];
+    if (t1 > t2) {
+      std::swap(t1, t2);
+    }
+    if (t1 > tNear) {
+      tNear = t1;
+      axis = k;
+    }
+    tFar = std::min(tFar, t2);
+  }
+  if ((tNear > tFar) || (tNear <= 0.0)) {
+    return false;
+  }
+  // The Z component of the ray direction in the camera frame is 1
+  Z = tNear;
+  normal.resize(3, true);
+  normal[axis] = dir[axis] > 0.0 ? -1.0 : 1.0;
+  return true;
+}
+
+vpCameraParameters defaultCamera() { return vpCameraParameters(600, 600, 160, 120); }
+
+std::string createObjFile(const std::string &tempDir)
+{
+  const std::string objFile = vpIoTools::createFilePath(tempDir, "cube.obj");
+  std::ofstream f(objFile.c_str());
+  f << objCube;
+  f.close();
+  return objFile;
+}
+}
+
+TEST_CASE("Software geometry renderer", "[vpSoftwareGeometryRenderer]")
+{
+  const std::string tempDir = vpIoTools::makeTempDirectory(vpIoTools::getTempPath() + "/visp_test_software_renderer");
+  const std::string objFile = createObjFile(tempDir);
+  const vpCameraParameters cam = defaultCamera();
+  const unsigned int h = 240, w = 320;
+
+  vpSoftwareGeometryRenderer renderer(vpSoftwareGeometryRenderer::OBJECT_NORMALS);
+  renderer.setCameraParameters(cam, h, w);
+  renderer.setClippingDistance(0.01, 2.0);
+  renderer.loadObj(objFile);
+  CHECK(renderer.getNbVertices() == 8);
+  CHECK(renderer.getNbTriangles() == 12);
+
+  SECTION("Cube facing the camera")
+  {
+    renderer.render(vpHomogeneousMatrix(0.0, 0.0, 0.5, 0.0, 0.0, 0.0));
+    vpImage<vpRGBf> normals;
+    vpImage<float> depth;
+    renderer.getRender(normals, depth);
+    REQUIRE(depth.getHeight() == h);
+    REQUIRE(depth.getWidth() == w);
+
+    CHECK(depth[120][160] == Catch::Approx(0.45).margin(1e-5));
+    CHECK(normals[120][160].B == Catch::Approx(-1.0).margin(1e-5));
+    CHECK(depth[120][80] == 0.f);
+
+    // The front face spans 0.05 / 0.45 * 600 = 66.7 pixels around the principal point, plus the margin
+    const vpRect bb = renderer.getBoundingBox();
+    CHECK(bb.getLeft() == 91);
+    CHECK(bb.getRight() == 229);
+    CHECK(bb.getTop() == 51);
+    CHECK(bb.getBottom() == 189);
+
+    vpSoftwareGeometryRenderer cameraRenderer(vpSoftwareGeometryRenderer::CAMERA_NORMALS);
+    cameraRenderer.setCameraParameters(cam, h, w);
+    cameraRenderer.loadObj(objFile);
+    cameraRenderer.render(vpHomogeneousMatrix(0.0, 0.0, 0.5, 0.0, 0.0, 0.0));
+    cameraRenderer.getRender(normals, depth);
+    // Panda3D convention: Z points towards the camera
+    CHECK(normals[120][160].B == Catch::Approx(1.0).margin(1e-5));
+  }
+
+  SECTION("Comparison with ray casting")
+  {
+    const std::vector<vpHomogeneousMatrix> poses = {
+      vpHomogeneousMatrix(0.0, 0.0, 0.5, vpMath::rad(20), vpMath::rad(30), 0.0),
+      vpHomogeneousMatrix(0.02, -0.01, 0.4, 0.3, -0.4, 0.2),
+      vpHomogeneousMatrix(-0.05, 0.03, 0.6, vpMath::rad(45), vpMath::rad(45), vpMath::rad(45)),
+    };
+    for (const vpHomogeneousMatrix &cMo : poses) {
+      renderer.render(cMo);
+      vpImage<vpRGBf> normals;
+      vpImage<float> depth;
+      renderer.getRender(normals, depth);
+      const vpHomogeneousMatrix oMc = cMo.inverse();
+
+      unsigned int nbObject = 0, nbCoverageErrors = 0, nbNormalErrors = 0;
+      double maxDepthError = 0.0;
+      for (unsigned int i = 0; i < h; ++i) {
+        for (unsigned int j = 0; j < w; ++j) {
+          double Z;
+          vpColVector n;
+          const bool hit = rayCastCube(cam, oMc, i, j, Z, n);
+          nbObject += hit ? 1 : 0;
+          if (hit != (depth[i][j] > 0.f)) {
+            ++nbCoverageErrors;
+            continue;
+          }
+          if (hit) {
+            maxDepthError = std::max(maxDepthError, std::fabs(Z - depth[i][j]));
+            const vpRGBf &rn = normals[i][j];
+            if ((std::fabs(rn.R - n[0]) > 1e-3) || (std::fabs(rn.G - n[1]) > 1e-3) || (std::fabs(rn.B - n[2]) > 1e-3)) {
+              ++nbNormalErrors;
+            }
+          }
+        }
+      }
+      REQUIRE(nbObject > 1000);
+      // Only pixels lying exactly on the outline or on an edge of the cube may differ
+      CHECK(nbCoverageErrors < nbObject / 100);
+      CHECK(nbNormalErrors < nbObject / 50);
+      CHECK(maxDepthError < 1e-3);
+    }
+  }
+
+  SECTION("Renders do not depend on the tiling and on the number of threads")
+  {
+    const vpHomogeneousMatrix cMo(0.02, -0.01, 0.4, 0.3, -0.4, 0.2);
+    renderer.setSilhouetteExtraction(true);
+    renderer.setEdgeThreshold(0.01f);
+    renderer.setNbThread(1);
+    renderer.setTileSize(256);
+    renderer.render(cMo);
+    vpImage<vpRGBf> normalsRef, normals;
+    vpImage<float> depthRef, depth, orientationRef, orientation;
+    vpImage<unsigned char> silhouetteRef, silhouette;
+    renderer.getRender(normalsRef, depthRef);
+    renderer.getSilhouetteRender(orientationRef, silhouetteRef);
+
+    const unsigned int tileSizes[] = { 8, 13, 32 };
+    for (auto tileSize : tileSizes) {
+      renderer.setNbThread(4);
+      renderer.setTileSize(tileSize);
+      renderer.render(cMo);
+      renderer.getRender(normals, depth);
+      renderer.getSilhouetteRender(orientation, silhouette);
+      CHECK(depth == depthRef);
+      CHECK(normals == normalsRef);
+      CHECK(orientation == orientationRef);
+      CHECK(silhouette == silhouetteRef);
+    }
+    CHECK_THROWS_AS(renderer.setTileSize(0), vpException);
+  }
+
+  SECTION("Silhouette extraction")
+  {
+    renderer.setSilhouetteExtraction(true);
+    renderer.setEdgeThreshold(0.01f);
+    renderer.render(vpHomogeneousMatrix(0.0, 0.0, 0.5, 0.0, 0.0, 0.0));
+    vpImage<float> depth, orientation;
+    vpImage<unsigned char> silhouette;
+    renderer.getRender(depth);
+    renderer.getSilhouetteRender(orientation, silhouette);
+
+    unsigned int nbSilhouette = 0;
+    for (unsigned int i = 1; i < h - 1; ++i) {
+      for (unsigned int j = 1; j < w - 1; ++j) {
+        if (silhouette[i][j] != 0) {
+          ++nbSilhouette;
+          // Silhouette pixels belong to the object and are next to the background
+          CHECK(depth[i][j] > 0.f);
+          CHECK((depth[i - 1][j] == 0.f || depth[i + 1][j] == 0.f || depth[i][j - 1] == 0.f || depth[i][j + 1] == 0.f
+                || depth[i - 1][j - 1] == 0.f || depth[i - 1][j + 1] == 0.f || depth[i + 1][j - 1] == 0.f
+                || depth[i + 1][j + 1] == 0.f));
+        }
+      }
+    }
+    // The vertical sides of the front face, where the horizontal depth gradient is not null
+    CHECK(nbSilhouette >= 2 * 132);
+    CHECK(silhouette[120][160] == 0);
+
+    // Orientation of the depth edge on the left and right sides of the cube
+    unsigned int left = 0, right = w - 1;
+    while (depth[120][left] == 0.f) {
+      ++left;
+    }
+    while (depth[120][right] == 0.f) {
+      --right;
+    }
+    REQUIRE(silhouette[120][left] != 0);
+    REQUIRE(silhouette[120][right] != 0);
+    CHECK(std::fabs(orientation[120][left]) < 1e-3);
+    CHECK(std::fabs(orientation[120][right]) > M_PI - 1e-3);
+
+    renderer.setSilhouetteExtraction(false);
+    CHECK_THROWS_AS(renderer.getSilhouetteRender(orientation, silhouette), vpException);
+  }
+
+  SECTION("Clipping")
+  {
+    // The front of the cube is closer than the near plane
+    renderer.setClippingDistance(0.5, 2.0);
+    renderer.render(vpHomogeneousMatrix(0.0, 0.0, 0.5, vpMath::rad(10), vpMath::rad(10), 0.0));
+    vpImage<float> depth;
+    renderer.getRender(depth);
+    unsigned int nbObject = 0;
+    for (unsigned int i = 0; i < depth.getSize(); ++i) {
+      if (depth.bitmap[i] > 0.f) {
+        ++nbObject;
+        CHECK(depth.bitmap[i] >= 0.5f);
+      }
+    }
+    CHECK(nbObject > 0);
+
+    float nearV, farV;
+    renderer.computeClipping(vpHomogeneousMatrix(0.0, 0.0, 0.5, 0.0, 0.0, 0.0), nearV, farV);
+    CHECK(nearV == Catch::Approx(0.45));
+    CHECK(farV == Catch::Approx(0.55));
+
+    // Object behind the camera
+    renderer.setClippingDistance(0.01, 2.0);
+    renderer.render(vpHomogeneousMatrix(0.0, 0.0, -0.5, 0.0, 0.0, 0.0));
+    renderer.getRender(depth);
+    CHECK(depth.getSum() == 0.0);
+    CHECK(renderer.getBoundingBox().getArea() == 0.0);
+  }
+
+  SECTION("Mesh given as matrices")
+  {
+    vpMatrix vertices(3, 3);
+    vertices[0][0] = -0.1; vertices[0][1] = -0.1;
+    vertices[1][0] = -0.1; vertices[1][1] = 0.1;
+    vertices[2][0] = 0.1; vertices[2][1] = -0.1;
+    // Facing the camera
+    renderer.setMesh(vertices, { 0, 1, 2 });
+    renderer.render(vpHomogeneousMatrix(0.0, 0.0, 1.0, 0.0, 0.0, 0.0));
+    vpImage<vpRGBf> normals;
+    vpImage<float> depth;
+    renderer.getRender(normals, depth);
+    CHECK(depth[110][150] == Catch::Approx(1.0));
+    CHECK(normals[110][150].B == Catch::Approx(-1.0));
+
+    // Seen from the back
+    renderer.setMesh(vertices, { 0, 2, 1 });
+    renderer.render(vpHomogeneousMatrix(0.0, 0.0, 1.0, 0.0, 0.0, 0.0));
+    renderer.getRender(depth);
+    CHECK(depth.getSum() == 0.0);
+    renderer.setBackFaceCulling(false);
+    renderer.render(vpHomogeneousMatrix(0.0, 0.0, 1.0, 0.0, 0.0, 0.0));
+    renderer.getRender(depth);
+    CHECK(depth[110][150] == Catch::Approx(1.0));
+
+    CHECK_THROWS_AS(renderer.setMesh(vertices, { 0, 1, 3 }), vpException);
+    CHECK_THROWS_AS(renderer.setMesh(vertices, { 0, 1 }), vpException);
+  }
+
+  SECTION("Invalid files")
+  {
+    CHECK_THROWS_AS(renderer.loadObj(vpIoTools::createFilePath(tempDir, "missing.obj")), vpException);
+    const std::string badFile = vpIoTools::createFilePath(tempDir, "bad.obj");
+    std::ofstream f(badFile.c_str());
+    f << "v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 4\n";
+    f.close();
+    CHECK_THROWS_AS(renderer.loadObj(badFile), vpException);
+  }
+
+  vpIoTools::remove(tempDir);
+}
+
+int main(int argc, char *argv[])
+{
+  Catch::Session session;
+  session.applyCommandLine(argc, argv);
+  int numFailed = session.run();
+  return numFailed;
+}
+#else
+#include <iostream>
+
+int main() { return EXIT_SUCCESS; }
+#endif
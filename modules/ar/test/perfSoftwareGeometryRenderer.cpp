@@ -0,0 +1,193 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Benchmark the software geometry renderer.
+ */
+
+/*!
+  \example perfSoftwareGeometryRenderer.cpp
+
+  Benchmark the CPU renderer of depth, normals and silhouette maps. When ViSP is built with Panda3D, the Panda3D
+  geometry renderer is benchmarked on the same mesh.
+ */
+
+#include <visp3/core/vpConfig.h>
+
+#if defined(VISP_HAVE_CATCH2)
+
+#if defined(VISP_BUILD_CATCH2)
+#include <catch_amalgamated.hpp>
+#else // Since v3.1.1
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#include <visp3/ar/vpSoftwareGeometryRenderer.h>
+#include <visp3/core/vpIoTools.h>
+
+#if defined(VISP_HAVE_PANDA3D)
+#include <visp3/ar/vpPanda3DFrameworkManager.h>
+#include <visp3/ar/vpPanda3DGeometryRenderer.h>
+#endif
+
+#ifdef ENABLE_VISP_NAMESPACE
+using namespace VISP_NAMESPACE_NAME;
+#endif
+
+namespace
+{
+bool g_runBenchmark = false;
+int g_nbThread = -1;
+
+// UV sphere centered on the object frame origin, written as a Wavefront file
+std::string createSphereObjFile(const std::string &directory, double radius, unsigned int nbRings,
+                                unsigned int nbSectors)
+{
+  const std::string objFile = vpIoTools::createFilePath(directory, "sphere.obj");
+  std::ofstream f(objFile.c_str());
+  for (unsigned int r = 0; r <= nbRings; ++r) {
+    const double theta = M_PI * r / nbRings;
+    for (unsigned int s = 0; s < nbSectors; ++s) {
+      const double phi = 2.0 * M_PI * s / nbSectors;
+      const double x = std::sin(theta) * std::cos(phi), y = std::sin(theta) * std::sin(phi), z = std::cos(theta);
+      f << "v " << radius * x << " " << radius * y << " " << radius * z << "\n";
+      f << "vn " << x << " " << y << " " << z << "\n";
+    }
+  }
+  for (unsigned int r = 0; r < nbRings; ++r) {
+    for (unsigned int s = 0; s < nbSectors; ++s) {
+      const unsigned int a = r * nbSectors + s + 1, b = r * nbSectors + ((s + 1) % nbSectors) + 1;
+      const unsigned int c = a + nbSectors, d = b + nbSectors;
+      f << "f " << a << "//" << a << " " << c << "//" << c << " " << d << "//" << d << "\n";
+      f << "f " << a << "//" << a << " " << d << "//" << d << " " << b << "//" << b << "\n";
+    }
+  }
+  f.close();
+  return objFile;
+}
+} // namespace
+
+TEST_CASE("Benchmark vpSoftwareGeometryRenderer", "[benchmark]")
+{
+  const std::string tempDir = vpIoTools::makeTempDirectory(vpIoTools::getTempPath() + "/visp_perf_software_renderer");
+  const std::string objFile = createSphereObjFile(tempDir, 0.1, 128, 256);
+  const unsigned int h = 480, w = 640;
+  const vpCameraParameters cam(600, 600, w / 2.0, h / 2.0);
+  const double Z = 0.4;
+  const vpHomogeneousMatrix cMo(0.0, 0.0, Z, 0.1, 0.2, 0.3);
+
+  vpSoftwareGeometryRenderer renderer(vpSoftwareGeometryRenderer::OBJECT_NORMALS);
+  renderer.setCameraParameters(cam, h, w);
+  renderer.setClippingDistance(0.01, 1.0);
+  renderer.loadObj(objFile);
+  renderer.setNbThread(g_nbThread);
+  renderer.setEdgeThreshold(0.01f);
+
+  vpImage<vpRGBf> normals;
+  vpImage<float> depth, orientation;
+  vpImage<unsigned char> isSilhouette;
+
+  if (g_runBenchmark) {
+    std::ostringstream oss;
+    oss << renderer.getNbTriangles() << " triangles - render() + getRender(), nbThread=" << g_nbThread;
+    BENCHMARK(oss.str().c_str())
+    {
+      renderer.render(cMo);
+      renderer.getRender(normals, depth);
+      return depth;
+    };
+
+    renderer.setSilhouetteExtraction(true);
+    oss.str("");
+    oss << renderer.getNbTriangles() << " triangles - render() + getRender() with silhouette, nbThread=" << g_nbThread;
+    BENCHMARK(oss.str().c_str())
+    {
+      renderer.render(cMo);
+      renderer.getRender(normals, depth);
+      renderer.getSilhouetteRender(orientation, isSilhouette);
+      return depth;
+    };
+
+#if defined(VISP_HAVE_PANDA3D)
+    {
+      vpPanda3DGeometryRenderer pandaRenderer(vpPanda3DGeometryRenderer::OBJECT_NORMALS, true);
+      pandaRenderer.setRenderParameters(vpPanda3DRenderParameters(cam, h, w, 0.01, 1.0));
+      pandaRenderer.initFramework();
+      pandaRenderer.addNodeToScene(pandaRenderer.loadObject("sphere", objFile));
+      pandaRenderer.setCameraPose(cMo.inverse());
+
+      oss.str("");
+      oss << renderer.getNbTriangles() << " triangles - Panda3D renderFrame() + getRender()";
+      BENCHMARK(oss.str().c_str())
+      {
+        pandaRenderer.renderFrame();
+        pandaRenderer.getRender(normals, depth);
+        return depth;
+      };
+    }
+    vpPanda3DFrameworkManager::getInstance().exit();
+#endif
+  }
+  else {
+    renderer.setSilhouetteExtraction(true);
+    renderer.render(cMo);
+    renderer.getRender(normals, depth);
+    renderer.getSilhouetteRender(orientation, isSilhouette);
+    // The sphere is tessellated, its depth is close to the one of the true sphere
+    CHECK(depth[h / 2][w / 2] == Catch::Approx(Z - 0.1).margin(1e-3));
+    CHECK(isSilhouette.getSum() > 0.0);
+  }
+
+  vpIoTools::remove(tempDir);
+}
+
+int main(int argc, char *argv[])
+{
+  Catch::Session session;
+  auto cli = session.cli()
+    | Catch::Clara::Opt(g_runBenchmark)["--benchmark"]("run benchmark?")
+    | Catch::Clara::Opt(g_nbThread, "nbThread")["--nbThread"]("Number of threads, -1 to use all the available threads");
+
+  session.cli(cli);
+  session.applyCommandLine(argc, argv);
+
+  int numFailed = session.run();
+
+  return numFailed;
+}
+#else
+#include <iostream>
+
+int main() { return EXIT_SUCCESS; }
+#endif
@@ -59,9 +59,9 @@ BEGIN_VISP_NAMESPACE
  * It is possible to use a boolean mask to ignore some pixels of
  * the input gray-scale image.
  *
- * \warning If the stack size is not sufficient, a SEGFAULT can occur on some images which
- * are really over-exposed.
- * \note The maximum stack on MacOS seems to be 65532000 bytes, see https://stackoverflow.com/a/13261334
+ * The edge tracking step is iterative, so the stack usage does not depend on the content of the image.
+ * The intermediate buffers are kept between two calls to detect() to avoid re-allocations when
+ * processing a video stream.
 */
 class VISP_EXPORT vpCannyEdgeDetection
 {
@@ -157,8 +157,6 @@ public:
   /**
    * \brief Detect the edges in an image.
    * Convert the color image into a ViSP gray-scale image.
-   * \warning If the stack size is not sufficient, a SEGFAULT can occur on some images which
-   * are really over-exposed.
    *
    * \param[in] cv_I A color image, in OpenCV format.
    * \return vpImage<unsigned char> 255 means an edge, 0 means not an edge.
@@ -169,8 +167,6 @@ public:
   /**
    * \brief Detect the edges in an image.
    * Convert the color image into a gray-scale image.
-   * \warning If the stack size is not sufficient, a SEGFAULT can occur on some images which
-   * are really over-exposed.
    *
    * \param[in] I_color : An RGB image, in ViSP format.
    * \return vpImage<unsigned char> 255 means an edge, 0 means not an edge.
@@ -211,8 +207,6 @@ public:
 
   /**
    * \brief Detect the edges in a gray-scale image.
-   * \warning If the stack size is not sufficient, a SEGFAULT can occur on some images which
-   * are really over-exposed.
    *
    * \param[in] I : A gray-scale image, in ViSP format.
    * \return vpImage<unsigned char> 255 means an edge, 0 means not an edge.
@@ -315,35 +309,31 @@ public:
    *
    * \param p_mask If different of \b nullptr , a mask of booleans where \b true
    * indicates that a pixel must be considered and \b false that the pixel should
-   * be ignored.
+   * be ignored. The mask must be contiguous, see vpImage::isContiguous().
    */
   inline void setMask(const vpImage<bool> *p_mask)
   {
+    if ((p_mask != nullptr) && (!p_mask->isContiguous())) {
+      throw(vpException(vpException::badValue, "The mask of the Canny edge detector cannot be a view"));
+    }
     mp_mask = p_mask;
   }
 
   /**
-   * \brief Set the minimum stack size, expressed in bytes, due to the recursive algorithm.
-   * If not called, the stack size is left at its default value when running the
-   * Canny edge detection algorithm.
+   * \brief Set the minimum stack size, expressed in bytes.
    *
-   * \note The stack size is changed back to its original value after
-   * before leaving the detect() function.
-   * \note On Windows, the minimum stack size is defined at compilation time
-   * and cannot be changed during runtime.
-   * \note The maximum stack on MacOS seems to be 65532000 bytes, see https://stackoverflow.com/a/13261334
-   * \warning If the stack size is not sufficient, a SEGFAULT can occur on some images which
-   * are really over-exposed.
+   * \deprecated The edge tracking step is not recursive anymore, the stack size is thus never
+   * modified by the detect() functions. The value is only kept for backward compatibility.
    *
    * \param[in] requiredStackSize The required stack size, in bytes.
    */
 #if !defined(_WIN32) && (defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))) // UNIX
-  inline void setMinimumStackSize(const rlim_t &requiredStackSize)
+  VP_DEPRECATED inline void setMinimumStackSize(const rlim_t &requiredStackSize)
   {
     m_minStackSize = requiredStackSize;
   }
 #else
-  inline void setMinimumStackSize(const unsigned int &requiredStackSize)
+  VP_DEPRECATED inline void setMinimumStackSize(const unsigned int &requiredStackSize)
   {
     (void)requiredStackSize;
     static bool hasNotBeenDisplayed = true;
@@ -396,20 +386,22 @@ public:
   }
 
   /**
-   * \brief Get the minimum stack size used by the algorithm.
+   * \brief Get the minimum stack size set by setMinimumStackSize().
    *
+   * \deprecated The edge tracking step is not recursive anymore, the stack size is thus never
+   * modified by the detect() functions.
    * \note On Windows, the minimum stack size is defined at compilation time
    * and cannot be changed during runtime.
    *
    * \return rlim_t The minimum stack size.
    */
 #if !defined(_WIN32) && (defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))) // UNIX
-  inline rlim_t getMinimumStackSize() const
+  VP_DEPRECATED inline rlim_t getMinimumStackSize() const
   {
     return m_minStackSize;
   }
 #else
-  inline unsigned int getMinimumStackSize() const
+  VP_DEPRECATED inline unsigned int getMinimumStackSize() const
   {
     const unsigned int limit = 65532000;
     return limit;
@@ -477,6 +469,8 @@ private:
 
   // // Edge thining attributes
   std::vector<std::pair<unsigned int, float> > m_edgeCandidateAndGradient; /*!< Map that contains point image coordinates and corresponding gradient value.*/
+  std::vector<std::vector<std::pair<unsigned int, float> > > m_threadEdgeCandidateAndGradient; /*!< Edge candidates found by each thread.*/
+  std::vector<std::vector<unsigned int> > m_threadActiveEdgeCandidates; /*!< Active edge candidates found by each thread.*/
 
   // // Hysteresis thresholding attributes
   float m_lowerThreshold; /*!< Lower threshold for the hysteresis step. If negative, it will be deduced
@@ -489,10 +483,13 @@ private:
 
   // // Edge tracking attributes
 #if !defined(_WIN32) && (defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))) // UNIX
-  rlim_t m_minStackSize; /*!< Minimum stack size, due to the recursivity used in this step of the algorithm.*/
+  rlim_t m_minStackSize; /*!< Minimum stack size, only kept for backward compatibility.*/
 #endif
   bool m_storeListEdgePoints; /*!< If true, the vector \b m_edgePointsList will contain the list of the edge points resulting from the whole algorithm.*/
   std::vector<unsigned int> m_activeEdgeCandidates; /*!< Vector that contains only the IDs of the edge candidates.*/
+  std::vector<std::pair<unsigned int, unsigned int> > m_edgeTrackingStack; /*!< Stack of the edge tracking step, that contains the
+                                                                                coordinates of the weak edge points being checked
+                                                                                and the index of the next neighbor to check.*/
   vpImage<EdgeType> m_edgePointsCandidates; /*!< Map that contains the strong edge points, i.e. the points for which we know for sure they are edge points,
                                                 and the weak edge points, i.e. the points for which we still must determine if they are actual edge points.*/
   vpImage<unsigned char> m_edgeMap; /*!< Final edge map that results from the whole Canny algorithm.*/
@@ -564,17 +561,19 @@ private:
   void performHysteresisThresholding(const float &lowerThreshold, const float &upperThreshold);
 
   /**
-   * \brief Search recursively for a strong edge in the neighborhood of a weak edge.
+   * \brief Search for a strong edge connected to a weak edge.
+   * \details The 8-connected weak edges are explored depth-first, using \b m_edgeTrackingStack
+   * instead of the call stack. The weak edges that are connected to a strong edge become strong edges.
    *
    * \param[in] coordinates : The coordinates we are checking.
-   * \return true We found a strong edge point in its 8-connected neighborhood.
-   * \return false We did not found a strong edge point in its 8-connected neighborhood.
+   * \return true We found a strong edge point connected to the weak edge.
+   * \return false We did not found a strong edge point connected to the weak edge.
    */
-  bool recursiveSearchForStrongEdge(const unsigned int &coordinates);
+  bool searchForStrongEdge(const unsigned int &coordinates);
 
   /**
    * \brief Perform edge tracking.
-   * \details For each weak edge, we will recursively check if they are 8-connected to a strong edge point.
+   * \details For each weak edge, we check if they are 8-connected to a strong edge point.
    * If so, the weak edge will be saved in \b m_strongEdgePoints and will be kept in the final edge map.
    * Otherwise, the edge point will be discarded.
    */
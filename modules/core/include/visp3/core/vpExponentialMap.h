@@ -42,6 +42,7 @@
 #include <visp3/core/vpConfig.h>
 #include <visp3/core/vpColVector.h>
 #include <visp3/core/vpHomogeneousMatrix.h>
+#include <visp3/core/vpMatrixFixed.h>
 
 BEGIN_VISP_NAMESPACE
 /*!
@@ -91,6 +92,7 @@ class VISP_EXPORT vpExponentialMap
 public:
   static vpHomogeneousMatrix direct(const vpColVector &v);
   static vpHomogeneousMatrix direct(const vpColVector &v, const double &delta_t);
+  static vpMatrixFixed<4, 4> direct(const vpMatrixFixed<6, 1> &v, const double &delta_t = 1.0);
   static vpColVector inverse(const vpHomogeneousMatrix &M);
   static vpColVector inverse(const vpHomogeneousMatrix &M, const double &delta_t);
 };
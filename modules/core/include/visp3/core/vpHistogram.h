@@ -257,6 +257,10 @@ public:
   template <typename ArithmeticType>
   typename std::enable_if<std::is_floating_point<ArithmeticType>::value, void>::type calculate(const vpImage<ArithmeticType> &I, const ArithmeticType &minVal, const ArithmeticType &maxVal, ArithmeticType &widthBin, unsigned int nbins = 256, unsigned int nbThreads = 1)
   {
+    if ((!I.isContiguous()) || ((mp_mask != nullptr) && (!mp_mask->isContiguous()))) {
+      throw(vpException(vpException::badValue, "vpHistogram::calculate() does not support non contiguous images such "
+                        "as views, see vpImage::isContiguous()"));
+    }
     widthBin = (maxVal - minVal)/static_cast<ArithmeticType>(nbins);
     if (m_size < nbins) {
       init(nbins);
@@ -44,6 +44,7 @@
 #include <visp3/core/vpException.h>
 #include <visp3/core/vpImageException.h>
 #include <visp3/core/vpImagePoint.h>
+#include <visp3/core/vpRect.h>
 #include <visp3/core/vpRGBa.h>
 #include <visp3/core/vpRGBf.h>
 
@@ -90,17 +91,29 @@ std::ostream &operator<<(std::ostream &s, const vpImage<double> &I);
 
   <h3> Data structure </h3>
 
-  Each image is build using two structure (an array bitmap which size
-  is [width*height]) and an array of pointer row (which size is [nrow])
-  the ith element in the row array row[i] is pointer toward the ith
-  "line" of the image (ie, bitmap +i*width )
+  Each image is build using an array bitmap where the rows are stored one after
+  the other. The ith "line" of the image starts at bitmap + i*stride, where the
+  stride is the number of elements between the beginning of two consecutive
+  rows.
 
   \image html image-data-structure.gif
   \image latex image-data-structure.ps  width=10cm
 
   Such a structure allows a fast access to each element of the image.
   if i is the ith rows and j the jth columns the value of this pixel
-  is given by I[i][j] (that is equivalent to row[i][j]).
+  is given by I[i][j].
+
+  By default the stride is equal to the image width, so that the bitmap is a
+  continuous array of [width*height] elements. The stride may be larger when:
+  - the rows are padded so that each of them starts on an aligned address, see
+    initAligned(),
+  - the image wraps an external buffer with padded rows, like the ones given by
+    some camera drivers, see init(Type *const, unsigned int, unsigned int, unsigned int, bool),
+  - the image is a view of a region of interest of another image, see view().
+
+  In that case isContiguous() returns false and the bitmap can no more be accessed
+  as a continuous array of [width*height] elements: the pixels have to be accessed
+  row by row using I[i].
 
   <h3>Example</h3>
   The following example available in tutorial-image-manipulation.cpp shows how
@@ -149,6 +162,8 @@ public:
   vpImage(unsigned int height, unsigned int width, Type value);
   //! constructor from an image stored as a continuous array in memory
   vpImage(Type *const array, unsigned int height, unsigned int width, bool copyData = false);
+  //! constructor from an image stored in memory with padded rows
+  vpImage(Type *const array, unsigned int height, unsigned int width, unsigned int stride, bool copyData);
   //! destructor
   virtual ~vpImage();
 
@@ -225,6 +240,15 @@ public:
 
   double getSum(const vpImage<bool> *p_mask = nullptr, unsigned int *nbValidPoints = nullptr) const;
 
+  /*!
+    Get the number of elements between the beginning of two consecutive rows.
+
+    \return The image stride, equal to the image width when the image is contiguous.
+
+    \sa isContiguous()
+  */
+  inline unsigned int getStride() const { return stride; }
+
   // Gets the value of a pixel at a location.
   Type getValue(unsigned int i, unsigned int j) const;
   // Gets the value of a pixel at a location with bilinear interpolation.
@@ -250,18 +274,30 @@ public:
   void init(unsigned int height, unsigned int width, Type value);
   //! Initialization from an image stored as a continuous array in memory
   void init(Type *const array, unsigned int height, unsigned int width, bool copyData = false);
+  //! Initialization from an image stored in memory with padded rows
+  void init(Type *const array, unsigned int height, unsigned int width, unsigned int stride, bool copyData);
+  //! Set the size of the image with rows starting on aligned addresses
+  void initAligned(unsigned int height, unsigned int width, unsigned int rowAlignment = 32);
   void insert(const vpImage<Type> &src, const vpImagePoint &topLeft);
 
+  /*!
+    Check if the rows of the image are stored one right after the other, that is if
+    the bitmap is a continuous array of [width*height] elements.
+
+    \sa getStride()
+  */
+  inline bool isContiguous() const { return (stride == width) || (height <= 1); }
+
   //------------------------------------------------------------------
   // Access to the image
 
   //! operator[] allows operation like I[i] = x.
-  inline Type *operator[](unsigned int i) { return row[i]; }
-  inline Type *operator[](int i) { return row[i]; }
+  inline Type *operator[](unsigned int i) { return bitmap + (static_cast<size_t>(i) * stride); }
+  inline Type *operator[](int i) { return bitmap + (static_cast<ptrdiff_t>(i) * stride); }
 
   //! operator[] allows operation like x = I[i]
-  inline const Type *operator[](unsigned int i) const { return row[i]; }
-  inline const Type *operator[](int i) const { return row[i]; }
+  inline const Type *operator[](unsigned int i) const { return bitmap + (static_cast<size_t>(i) * stride); }
+  inline const Type *operator[](int i) const { return bitmap + (static_cast<ptrdiff_t>(i) * stride); }
 
   /*!
     Get the value of an image point with coordinates (i, j), with i the row
@@ -269,13 +305,13 @@ public:
 
     \return Value of the image point (i, j).
   */
-  inline Type operator()(unsigned int i, unsigned int j) const { return bitmap[(i * width) + j]; }
+  inline Type operator()(unsigned int i, unsigned int j) const { return bitmap[(i * stride) + j]; }
 
   /*!
     Set the value \e v of an image point with coordinates (i, j), with i the
     row position and j the column position.
   */
-  inline void operator()(unsigned int i, unsigned int j, const Type &v) { bitmap[(i * width) + j] = v; }
+  inline void operator()(unsigned int i, unsigned int j, const Type &v) { bitmap[(i * stride) + j] = v; }
 
   /*!
     Get the value of an image point.
@@ -292,7 +328,7 @@ public:
     unsigned int i = static_cast<unsigned int>(ip.get_i());
     unsigned int j = static_cast<unsigned int>(ip.get_j());
 
-    return bitmap[(i * width) + j];
+    return bitmap[(i * stride) + j];
   }
 
   /*!
@@ -308,7 +344,7 @@ public:
     unsigned int i = static_cast<unsigned int>(ip.get_i());
     unsigned int j = static_cast<unsigned int>(ip.get_j());
 
-    bitmap[(i * width) + j] = v;
+    bitmap[(i * stride) + j] = v;
   }
 
   vpImage<Type> operator-(const vpImage<Type> &B) const;
@@ -346,6 +382,10 @@ public:
   void sub(const vpImage<Type> &A, const vpImage<Type> &B, vpImage<Type> &C) const;
   void subsample(unsigned int v_scale, unsigned int h_scale, vpImage<Type> &sampled) const;
 
+  static void view(vpImage<Type> &v, const vpImage<Type> &I, unsigned int top, unsigned int left, unsigned int height,
+                   unsigned int width);
+  static void view(vpImage<Type> &v, const vpImage<Type> &I, const vpRect &roi);
+
   // See https://stackoverflow.com/questions/11562/how-to-overload-stdswap to understand why swap is in visp namespace
   friend void swap(vpImage<Type> &first, vpImage<Type> &second)
   {
@@ -355,7 +395,9 @@ public:
     swap(first.npixels, second.npixels);
     swap(first.width, second.width);
     swap(first.height, second.height);
-    swap(first.row, second.row);
+    swap(first.stride, second.stride);
+    swap(first.allocatedBitmap, second.allocatedBitmap);
+    swap(first.hasOwnership, second.hasOwnership);
   }
 
   //@}
@@ -364,7 +406,8 @@ private:
   unsigned int npixels; ///! number of pixel in the image
   unsigned int width;   ///! number of columns
   unsigned int height;  ///! number of rows
-  Type **row;           ///! points the row pointer array
+  unsigned int stride;  ///! number of elements between the beginning of two consecutive rows
+  Type *allocatedBitmap; ///! memory allocated by this instance, bitmap may point inside it to align the rows
   bool hasOwnership;    ///! true if this instance owns the bitmap, false otherwise (e.g. copyData=false)
 };
 
@@ -378,7 +421,7 @@ private:
 template <class Type> void vpImage<Type>::init(unsigned int h, unsigned int w, Type value)
 {
   init(h, w);
-  std::fill(bitmap, bitmap + npixels, value);
+  *this = value;
 }
 
 /*!
@@ -386,20 +429,9 @@ template <class Type> void vpImage<Type>::init(unsigned int h, unsigned int w, T
 */
 template <class Type> void vpImage<Type>::init(unsigned int h, unsigned int w)
 {
-  if (h != this->height) {
-    if (row != nullptr) {
-      delete[] row;
-      row = nullptr;
-    }
-  }
-
+  // Memory is kept, owned or not, as long as the size is unchanged
   if ((h != this->height) || (w != this->width)) {
-    if (bitmap != nullptr) {
-      if (hasOwnership) {
-        delete[] bitmap;
-      }
-      bitmap = nullptr;
-    }
+    destroy();
   }
 
   this->width = w;
@@ -408,22 +440,14 @@ template <class Type> void vpImage<Type>::init(unsigned int h, unsigned int w)
   npixels = width * height;
 
   if (bitmap == nullptr) {
-    bitmap = new Type[npixels];
+    allocatedBitmap = new Type[npixels];
+    bitmap = allocatedBitmap;
+    stride = width;
     hasOwnership = true;
   }
   if (bitmap == nullptr) {
     throw(vpException(vpException::memoryAllocationError, "cannot allocate bitmap "));
   }
-  if (row == nullptr) {
-    row = new Type *[height];
-  }
-  if (row == nullptr) {
-    throw(vpException(vpException::memoryAllocationError, "cannot allocate row "));
-  }
-
-  for (unsigned int i = 0; i < height; ++i) {
-    row[i] = bitmap + (i * width);
-  }
 }
 
 /*!
@@ -431,56 +455,169 @@ template <class Type> void vpImage<Type>::init(unsigned int h, unsigned int w)
 */
 template <class Type> void vpImage<Type>::init(Type *const array, unsigned int h, unsigned int w, bool copyData)
 {
-  if (h != this->height) {
-    if (row != nullptr) {
-      delete[] row;
-      row = nullptr;
-    }
-  }
+  init(array, h, w, w, copyData);
+}
 
-  // Delete bitmap if copyData==false, otherwise only if the dimension differs
-  if ((copyData && ((h != this->height) || (w != this->width))) || (!copyData)) {
-    if (bitmap != nullptr) {
-      if (hasOwnership) {
-        delete[] bitmap;
-      }
-      bitmap = nullptr;
-    }
-  }
+/*!
+  \relates vpImage
 
-  hasOwnership = copyData;
-  this->width = w;
-  this->height = h;
+  Initialization from an image stored in memory with rows that may be padded, like the buffers given by some camera
+  drivers.
 
-  npixels = width * height;
+  \param array : Pointer to the first pixel of the image.
+  \param h : Image height.
+  \param w : Image width.
+  \param s : Number of elements between the beginning of two consecutive rows in \e array. It has to be greater or
+  equal to the image width.
+  \param copyData : When true, the pixels are copied in a contiguous bitmap owned by the image. Otherwise, the image
+  wraps \e array without copy and keeps its stride. In that case \e array must remain valid as long as the image is
+  used.
+
+  \exception vpException::dimensionError When the stride is lower than the image width.
+*/
+template <class Type>
+void vpImage<Type>::init(Type *const array, unsigned int h, unsigned int w, unsigned int s, bool copyData)
+{
+  if (s < w) {
+    throw(vpException(vpException::dimensionError, "Image stride %d cannot be lower than the image width %d", s, w));
+  }
 
   if (copyData) {
-    if (bitmap == nullptr) {
-      bitmap = new Type[npixels];
+    // Never copy in a memory that is not owned
+    if (!hasOwnership) {
+      destroy();
     }
+    init(h, w);
 
-    if (bitmap == nullptr) {
-      throw(vpException(vpException::memoryAllocationError, "cannot allocate bitmap "));
+    if ((s == w) && isContiguous()) {
+      memcpy(static_cast<void *>(bitmap), static_cast<void *>(array), static_cast<size_t>(npixels) * sizeof(Type));
+    }
+    else {
+      for (unsigned int i = 0; i < height; ++i) {
+        memcpy(static_cast<void *>((*this)[i]), static_cast<void *>(array + (static_cast<size_t>(i) * s)),
+               static_cast<size_t>(width) * sizeof(Type));
+      }
     }
-
-    // Copy the image data
-    memcpy(static_cast<void *>(bitmap), static_cast<void *>(array), static_cast<size_t>(npixels * sizeof(Type)));
   }
   else {
+    destroy();
+
     // Copy the address of the array in the bitmap
     bitmap = array;
+    hasOwnership = false;
+    this->width = w;
+    this->height = h;
+    stride = s;
+    npixels = width * height;
   }
+}
 
-  if (row == nullptr) {
-    row = new Type *[height];
+/*!
+  \relates vpImage
+
+  Allocate memory for an [height x width] image where each row starts on an address that is a multiple of
+  \e rowAlignment bytes, which eases the use of SIMD instructions. The rows are padded if needed, so that the image
+  may not be contiguous anymore.
+
+  \warning The image is not initialized.
+
+  \param h : Image height.
+  \param w : Image width.
+  \param rowAlignment : Alignment of the rows in bytes. It has to be a power of two.
+
+  \exception vpException::badValue When the alignment is not a power of two.
+  \exception vpException::memoryAllocationError Memory allocation error.
+
+  \sa isContiguous(), getStride()
+*/
+template <class Type> void vpImage<Type>::initAligned(unsigned int h, unsigned int w, unsigned int rowAlignment)
+{
+  if ((rowAlignment == 0) || ((rowAlignment & (rowAlignment - 1)) != 0)) {
+    throw(vpException(vpException::badValue, "Row alignment %d is not a power of two", rowAlignment));
   }
-  if (row == nullptr) {
-    throw(vpException(vpException::memoryAllocationError, "cannot allocate row "));
+
+  // Smallest stride for which all the rows keep the alignment of the first one
+  unsigned int s = w;
+  while (((static_cast<size_t>(s) * sizeof(Type)) % rowAlignment) != 0) {
+    ++s;
   }
 
-  for (unsigned int i = 0; i < height; ++i) {
-    row[i] = bitmap + (i * width);
+  destroy();
+
+  // Over-allocate to be able to shift the first row on an aligned address
+  allocatedBitmap = new Type[(static_cast<size_t>(h) * s) + rowAlignment];
+  bitmap = nullptr;
+  for (unsigned int k = 0; (k < rowAlignment) && (bitmap == nullptr); ++k) {
+    if ((reinterpret_cast<size_t>(allocatedBitmap + k) % rowAlignment) == 0) {
+      bitmap = allocatedBitmap + k;
+    }
+  }
+  hasOwnership = true;
+  if (bitmap == nullptr) {
+    throw(vpException(vpException::memoryAllocationError, "cannot align bitmap on %d bytes", rowAlignment));
   }
+
+  this->width = w;
+  this->height = h;
+  stride = s;
+  npixels = width * height;
+}
+
+/*!
+  \relates vpImage
+
+  Create a view of a region of interest of an image. The view shares the memory of the image, so that modifying the
+  view modifies the image. No pixel is copied nor memory allocated.
+
+  When you use this method, it is your responsibility to ensure that the lifespan of the view does not exceed the
+  lifespan of the image. The view cannot be resized without losing the link with the image.
+
+  \param v : The resulting view.
+  \param I : Image to view.
+  \param top : Row of the upper/left corner of the region of interest in \e I.
+  \param left : Column of the upper/left corner of the region of interest in \e I.
+  \param h : Height of the region of interest.
+  \param w : Width of the region of interest.
+
+  \exception vpException::dimensionError When the region of interest is not inside the image.
+*/
+template <class Type>
+void vpImage<Type>::view(vpImage<Type> &v, const vpImage<Type> &I, unsigned int top, unsigned int left,
+                         unsigned int h, unsigned int w)
+{
+  if (((top + h) > I.height) || ((left + w) > I.width)) {
+    throw(vpException(vpException::dimensionError,
+                      "Region of interest %dx%d at (%d, %d) is outside the %dx%d image", h, w, top, left, I.height,
+                      I.width));
+  }
+  if (&v == &I) {
+    throw(vpException(vpException::badValue, "An image cannot be a view of itself"));
+  }
+  v.init(const_cast<Type *>(I[top] + left), h, w, I.stride, false);
+}
+
+/*!
+  \relates vpImage
+
+  Create a view of a region of interest of an image. The region of interest is clipped to the image and covers the
+  same pixels as vpImageTools::crop(const vpImage<Type> &, const vpRect &, vpImage<Type> &, unsigned int, unsigned int).
+
+  \param v : The resulting view.
+  \param I : Image to view.
+  \param roi : Region of interest in \e I.
+
+  \sa view(vpImage<Type> &, const vpImage<Type> &, unsigned int, unsigned int, unsigned int, unsigned int)
+*/
+template <class Type> void vpImage<Type>::view(vpImage<Type> &v, const vpImage<Type> &I, const vpRect &roi)
+{
+  int i_min = std::max<int>(static_cast<int>(ceil(roi.getTop())), 0);
+  int j_min = std::max<int>(static_cast<int>(ceil(roi.getLeft())), 0);
+  int i_max = std::min<int>(static_cast<int>(ceil(roi.getTop() + roi.getHeight())), static_cast<int>(I.getHeight()));
+  int j_max = std::min<int>(static_cast<int>(ceil(roi.getLeft() + roi.getWidth())), static_cast<int>(I.getWidth()));
+
+  unsigned int h = (i_max > i_min) ? static_cast<unsigned int>(i_max - i_min) : 0;
+  unsigned int w = (j_max > j_min) ? static_cast<unsigned int>(j_max - j_min) : 0;
+  view(v, I, (h > 0) ? static_cast<unsigned int>(i_min) : 0, (w > 0) ? static_cast<unsigned int>(j_min) : 0, h, w);
 }
 
 /*!
@@ -488,7 +625,8 @@ template <class Type> void vpImage<Type>::init(Type *const array, unsigned int h
 */
 template <class Type>
 vpImage<Type>::vpImage(unsigned int h, unsigned int w)
-  : bitmap(nullptr), display(nullptr), npixels(0), width(0), height(0), row(nullptr), hasOwnership(true)
+  : bitmap(nullptr), display(nullptr), npixels(0), width(0), height(0), stride(0), allocatedBitmap(nullptr),
+  hasOwnership(true)
 {
   Type val(0);
   init(h, w, val);
@@ -499,7 +637,8 @@ vpImage<Type>::vpImage(unsigned int h, unsigned int w)
 */
 template <class Type>
 vpImage<Type>::vpImage(unsigned int h, unsigned int w, Type value)
-  : bitmap(nullptr), display(nullptr), npixels(0), width(0), height(0), row(nullptr), hasOwnership(true)
+  : bitmap(nullptr), display(nullptr), npixels(0), width(0), height(0), stride(0), allocatedBitmap(nullptr),
+  hasOwnership(true)
 {
   init(h, w, value);
 }
@@ -509,16 +648,31 @@ vpImage<Type>::vpImage(unsigned int h, unsigned int w, Type value)
 */
 template <class Type>
 vpImage<Type>::vpImage(Type *const array, unsigned int h, unsigned int w, bool copyData)
-  : bitmap(nullptr), display(nullptr), npixels(0), width(0), height(0), row(nullptr), hasOwnership(true)
+  : bitmap(nullptr), display(nullptr), npixels(0), width(0), height(0), stride(0), allocatedBitmap(nullptr),
+  hasOwnership(true)
 {
   init(array, h, w, copyData);
 }
 
 /*!
   \relates vpImage
+
+  \sa init(Type *const, unsigned int, unsigned int, unsigned int, bool)
 */
 template <class Type>
-vpImage<Type>::vpImage() : bitmap(nullptr), display(nullptr), npixels(0), width(0), height(0), row(nullptr), hasOwnership(true)
+vpImage<Type>::vpImage(Type *const array, unsigned int h, unsigned int w, unsigned int s, bool copyData)
+  : bitmap(nullptr), display(nullptr), npixels(0), width(0), height(0), stride(0), allocatedBitmap(nullptr),
+  hasOwnership(true)
+{
+  init(array, h, w, s, copyData);
+}
+
+/*!
+  \relates vpImage
+*/
+template <class Type>
+vpImage<Type>::vpImage() : bitmap(nullptr), display(nullptr), npixels(0), width(0), height(0), stride(0), allocatedBitmap(nullptr),
+  hasOwnership(true)
 { }
 
 /*!
@@ -572,17 +726,13 @@ template <class Type> void vpImage<Type>::resize(unsigned int h, unsigned int w,
 */
 template <class Type> void vpImage<Type>::destroy()
 {
-  if (bitmap != nullptr) {
+  if (allocatedBitmap != nullptr) {
     if (hasOwnership) {
-      delete[] bitmap;
+      delete[] allocatedBitmap;
     }
-    bitmap = nullptr;
-  }
-
-  if (row != nullptr) {
-    delete[] row;
-    row = nullptr;
+    allocatedBitmap = nullptr;
   }
+  bitmap = nullptr;
 }
 
 /*!
@@ -598,11 +748,19 @@ template <class Type> vpImage<Type>::~vpImage() { destroy(); }
 */
 template <class Type>
 vpImage<Type>::vpImage(const vpImage<Type> &I)
-  : bitmap(nullptr), display(nullptr), npixels(0), width(0), height(0), row(nullptr), hasOwnership(true)
+  : bitmap(nullptr), display(nullptr), npixels(0), width(0), height(0), stride(0), allocatedBitmap(nullptr),
+  hasOwnership(true)
 {
   resize(I.getHeight(), I.getWidth());
   if (bitmap) {
-    memcpy(static_cast<void *>(bitmap), static_cast<void *>(I.bitmap), I.npixels * sizeof(Type));
+    if (I.isContiguous()) {
+      memcpy(static_cast<void *>(bitmap), static_cast<void *>(I.bitmap), I.npixels * sizeof(Type));
+    }
+    else {
+      for (unsigned int i = 0; i < height; ++i) {
+        memcpy(static_cast<void *>((*this)[i]), static_cast<const void *>(I[i]), width * sizeof(Type));
+      }
+    }
   }
 }
 
@@ -612,15 +770,16 @@ vpImage<Type>::vpImage(const vpImage<Type> &I)
 */
 template <class Type>
 vpImage<Type>::vpImage(vpImage<Type> &&I)
-  : bitmap(I.bitmap), display(I.display), npixels(I.npixels), width(I.width), height(I.height), row(I.row),
-  hasOwnership(I.hasOwnership)
+  : bitmap(I.bitmap), display(I.display), npixels(I.npixels), width(I.width), height(I.height), stride(I.stride),
+  allocatedBitmap(I.allocatedBitmap), hasOwnership(I.hasOwnership)
 {
   I.bitmap = nullptr;
   I.display = nullptr;
   I.npixels = 0;
   I.width = 0;
   I.height = 0;
-  I.row = nullptr;
+  I.stride = 0;
+  I.allocatedBitmap = nullptr;
   I.hasOwnership = false;
 }
 #endif
@@ -685,10 +844,10 @@ template <class Type> void vpImage<Type>::insert(const vpImage<Type> &src, const
   }
 
   for (int i = 0; i < hsize; ++i) {
-    Type *srcBitmap = src.bitmap + (((src_ibegin + i) * src_w) + src_jbegin);
-    Type *destBitmap = this->bitmap + (((dest_ibegin + i) * dest_w) + dest_jbegin);
+    const Type *srcBitmap = src[src_ibegin + i] + src_jbegin;
+    Type *destBitmap = (*this)[dest_ibegin + i] + dest_jbegin;
 
-    memcpy(static_cast<void *>(destBitmap), static_cast<void *>(srcBitmap), static_cast<size_t>(wsize) * sizeof(Type));
+    memcpy(static_cast<void *>(destBitmap), static_cast<const void *>(srcBitmap), static_cast<size_t>(wsize) * sizeof(Type));
   }
 }
 
@@ -931,8 +1090,12 @@ template <class Type> void vpImage<Type>::sub(const vpImage<Type> &B, vpImage<Ty
 
   unsigned int this_width = this->getWidth();
   unsigned int this_height = this->getHeight();
-  for (unsigned int i = 0; i < (this_width * this_height); ++i) {
-    *(C.bitmap + i) = *(bitmap + i) - *(B.bitmap + i);
+  for (unsigned int i = 0; i < this_height; ++i) {
+    const Type *a = (*this)[i], *b = B[i];
+    Type *c = C[i];
+    for (unsigned int j = 0; j < this_width; ++j) {
+      c[j] = a[j] - b[j];
+    }
   }
 }
 
@@ -966,8 +1129,12 @@ template <class Type> void vpImage<Type>::sub(const vpImage<Type> &A, const vpIm
 
   unsigned int a_width = A.getWidth();
   unsigned int a_height = A.getHeight();
-  for (unsigned int i = 0; i < (a_width * a_height); ++i) {
-    *(C.bitmap + i) = *(A.bitmap + i) - *(B.bitmap + i);
+  for (unsigned int i = 0; i < a_height; ++i) {
+    const Type *a = A[i], *b = B[i];
+    Type *c = C[i];
+    for (unsigned int j = 0; j < a_width; ++j) {
+      c[j] = a[j] - b[j];
+    }
   }
 }
 
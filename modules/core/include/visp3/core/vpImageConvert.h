@@ -105,6 +105,10 @@ BEGIN_VISP_NAMESPACE
 
   Convert image types.
 
+  Except when stated otherwise, the conversions between vpImage walk the bitmap linearly and
+  throw a vpException::badValue when the source or the destination image is not contiguous,
+  see vpImage::isContiguous().
+
   The following example available in tutorial-image-converter.cpp shows how to
   convert an OpenCV cv::Mat image into a vpImage:
 
@@ -167,16 +171,18 @@ public:
     const unsigned int height = src.getHeight();
     const unsigned int width = src.getWidth();
 
-    const std::size_t size = static_cast<std::size_t>(height) * static_cast<std::size_t>(width);
-
     dest.resize(height, width);
 
 #ifdef VISP_HAVE_OPENMP
 #pragma omp parallel for
 #endif
-    // 3. La variable d'itération i doit rester 'int' pour OpenMP
-    for (int i = 0; i < static_cast<int>(size); ++i) {
-      dest.bitmap[i].buildFrom(src.bitmap[i]);
+    // Row by row, the images may not be contiguous
+    for (int i = 0; i < static_cast<int>(height); ++i) {
+      const vpHSV<T, useFullScale1> *src_row = src[i];
+      vpHSV<U, useFullScale2> *dest_row = dest[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        dest_row[j].buildFrom(src_row[j]);
+      }
     }
   }
 #endif
@@ -246,14 +252,14 @@ public:
 #pragma omp parallel for
 #endif
       for (int p = 0; p < size; ++p) {
-        if (depth_mask->bitmap[p]) {
-          if (static_cast<int>(depth_raw.bitmap[p])) {
-            float Z = static_cast<float>(depth_raw.bitmap[p]) * depth_scale;
+        const int j = p % int_width;
+        const int i = p / int_width;
+        if ((*depth_mask)[i][j]) {
+          if (static_cast<int>(depth_raw[i][j])) {
+            float Z = static_cast<float>(depth_raw[i][j]) * depth_scale;
             if (Z < Z_max) {
               double x = 0;
               double y = 0;
-              int j = p % int_width;
-              int i = (p - j) / int_width;
               vpPixelMeterConversion::convertPoint(cam_depth, j, i, x, y);
               vpColVector point_3D({ x * Z, y * Z, Z });
               if (point_3D[index_2] > Z_min) {
@@ -281,13 +287,13 @@ public:
 #pragma omp parallel for
 #endif
       for (int p = 0; p < size; ++p) {
-        if (static_cast<int>(depth_raw.bitmap[p])) {
-          float Z = static_cast<float>(depth_raw.bitmap[p]) * depth_scale;
+        const int j = p % int_width;
+        const int i = p / int_width;
+        if (static_cast<int>(depth_raw[i][j])) {
+          float Z = static_cast<float>(depth_raw[i][j]) * depth_scale;
           if (Z < Z_max) {
             double x = 0;
             double y = 0;
-            int j = p % int_width;
-            int i = (p - j) / int_width;
             vpPixelMeterConversion::convertPoint(cam_depth, j, i, x, y);
             vpColVector point_3D({ x * Z, y * Z, Z, 1 });
             if (point_3D[index_2] >= 0.1) {
@@ -361,14 +367,14 @@ public:
 #pragma omp parallel for
 #endif
       for (int p = 0; p < size; ++p) {
-        if (depth_mask->bitmap[p]) {
-          if (static_cast<int>(depth_raw.bitmap[p])) {
-            float Z = static_cast<float>(depth_raw.bitmap[p]) * depth_scale;
+        const int j = p % int_width;
+        const int i = p / int_width;
+        if ((*depth_mask)[i][j]) {
+          if (static_cast<int>(depth_raw[i][j])) {
+            float Z = static_cast<float>(depth_raw[i][j]) * depth_scale;
             if (Z < Z_max) {
               double x = 0;
               double y = 0;
-              int j = p % int_width;
-              int i = (p - j) / int_width;
               vpPixelMeterConversion::convertPoint(cam_depth, j, i, x, y);
               vpColVector point_3D({ x * Z, y * Z, Z });
               if (point_3D[index_2] > Z_min) {
@@ -377,9 +383,9 @@ public:
 #endif
 #if (VISP_HAVE_PCL_VERSION >= 0x010E01) // 1.14.1
                 pointcloud->push_back(pcl::PointXYZRGB(point_3D[index_0], point_3D[index_1], point_3D[index_2],
-                                                       color.bitmap[p].R, color.bitmap[p].G, color.bitmap[p].B));
+                                                       color[i][j].R, color[i][j].G, color[i][j].B));
 #else
-                pcl::PointXYZRGB pt(color.bitmap[p].R, color.bitmap[p].G, color.bitmap[p].B);
+                pcl::PointXYZRGB pt(color[i][j].R, color[i][j].G, color[i][j].B);
                 pt.x = point_3D[index_0];
                 pt.y = point_3D[index_1];
                 pt.z = point_3D[index_2];
@@ -405,13 +411,13 @@ public:
 #pragma omp parallel for
 #endif
       for (int p = 0; p < size; ++p) {
-        if (static_cast<int>(depth_raw.bitmap[p])) {
-          float Z = static_cast<float>(depth_raw.bitmap[p]) * depth_scale;
+        const int j = p % int_width;
+        const int i = p / int_width;
+        if (static_cast<int>(depth_raw[i][j])) {
+          float Z = static_cast<float>(depth_raw[i][j]) * depth_scale;
           if (Z < Z_max) {
             double x = 0;
             double y = 0;
-            int j = p % int_width;
-            int i = (p - j) / int_width;
             vpPixelMeterConversion::convertPoint(cam_depth, j, i, x, y);
             vpColVector point_3D({ x * Z, y * Z, Z, 1 });
             if (point_3D[index_2] >= 0.1) {
@@ -420,9 +426,9 @@ public:
 #endif
 #if (VISP_HAVE_PCL_VERSION >= 0x010E01) // 1.14.1
               pointcloud->push_back(pcl::PointXYZRGB(point_3D[index_0], point_3D[index_1], point_3D[index_2],
-                                                     color.bitmap[p].R, color.bitmap[p].G, color.bitmap[p].B));
+                                                     color[i][j].R, color[i][j].G, color[i][j].B));
 #else
-              pcl::PointXYZRGB pt(color.bitmap[p].R, color.bitmap[p].G, color.bitmap[p].B);
+              pcl::PointXYZRGB pt(color[i][j].R, color[i][j].G, color[i][j].B);
               pt.x = point_3D[index_0];
               pt.y = point_3D[index_1];
               pt.z = point_3D[index_2];
@@ -628,21 +634,21 @@ private:
 template <typename T, bool useFullScale>
 void vpImageConvert::convert(const vpImage<vpRGBa> &src, vpImage<vpHSV<T, useFullScale>> &dest)
 {
-  // 1. Déclarer en unsigned int pour correspondre à src.getHeight()/getWidth() et dest.resize()
   const unsigned int height = src.getHeight();
   const unsigned int width = src.getWidth();
 
-  // 2. Calculer la taille totale en size_t (standard pour les index)
-  const std::size_t size = static_cast<std::size_t>(height) * static_cast<std::size_t>(width);
-
-  dest.resize(height, width); // Plus de warning ici
+  dest.resize(height, width);
 
 #ifdef VISP_HAVE_OPENMP
 #pragma omp parallel for
 #endif
-  // 3. Transtypage explicite pour OpenMP
-  for (int i = 0; i < static_cast<int>(size); ++i) {
-    dest.bitmap[i].buildFrom(src.bitmap[i]);
+  // Row by row, the images may not be contiguous
+  for (int i = 0; i < static_cast<int>(height); ++i) {
+    const vpRGBa *src_row = src[i];
+    vpHSV<T, useFullScale> *dest_row = dest[i];
+    for (unsigned int j = 0; j < width; ++j) {
+      dest_row[j].buildFrom(src_row[j]);
+    }
   }
 }
 
@@ -660,15 +666,18 @@ void vpImageConvert::convert(const vpImage<vpHSV<T, useFullScale>> &src, vpImage
   const unsigned int height = src.getHeight();
   const unsigned int width = src.getWidth();
 
-  const std::size_t size = static_cast<std::size_t>(height) * static_cast<std::size_t>(width);
-
   dest.resize(height, width);
 
 #ifdef VISP_HAVE_OPENMP
 #pragma omp parallel for
 #endif
-  for (int i = 0; i < static_cast<int>(size); ++i) {
-    dest.bitmap[i].buildFrom(src.bitmap[i]);
+  // Row by row, the images may not be contiguous
+  for (int i = 0; i < static_cast<int>(height); ++i) {
+    const vpHSV<T, useFullScale> *src_row = src[i];
+    vpRGBa *dest_row = dest[i];
+    for (unsigned int j = 0; j < width; ++j) {
+      dest_row[j].buildFrom(src_row[j]);
+    }
   }
 }
 #endif
@@ -44,6 +44,7 @@
 #include <iostream>
 #include <math.h>
 #include <string.h>
+#include <vector>
 
 #include <visp3/core/vpConfig.h>
 #include <visp3/core/vpColorGetter.h>
@@ -52,6 +53,7 @@
 #include <visp3/core/vpImage.h>
 #include <visp3/core/vpImageConvert.h>
 #include <visp3/core/vpImageException.h>
+#include <visp3/core/vpImagePool.h>
 #include <visp3/core/vpMath.h>
 #include <visp3/core/vpMatrix.h>
 #include <visp3/core/vpRGBa.h>
@@ -199,7 +201,8 @@ public:
         dIy.resize(I.getHeight(), I.getWidth());
 
         // Computing the Gaussian blur + gradients of the image
-        vpImage<FilterType> Iblur;
+        vpImagePool::vpScratch<FilterType> scratchBlur(I.getHeight(), I.getWidth());
+        vpImage<FilterType> &Iblur = scratchBlur.get();
         vpImageFilter::gaussianBlur(I, Iblur, gaussianKernelSize, gaussianStdev, true, p_mask);
 
         vpArray2D<FilterType> gradientFilterX(apertureGradient, apertureGradient); // Gradient filter along the X-axis
@@ -356,7 +359,8 @@ public:
   {
     const unsigned int w = I.getWidth();
     const unsigned int h = I.getHeight();
-    const int size = static_cast<int>(I.getSize());
+    // The histogram walks the mask linearly
+    checkContiguous(p_mask, "vpImageFilter::computeCannyThreshold");
 
     if ((lowerThresholdRatio <= 0.f) || (lowerThresholdRatio >= 1.f)) {
       std::stringstream errMsg;
@@ -376,32 +380,43 @@ public:
       throw(vpException(vpException::fatalError, errMsg.str()));
     }
 
-    vpImage<unsigned char> dI(h, w);
-    vpImage<OutType> dIx(h, w), dIy(h, w);
-    if ((p_dIx != nullptr) && (p_dIy != nullptr)) {
-      dIx = *p_dIx;
-      dIy = *p_dIy;
+    vpImagePool::vpScratch<unsigned char> scratchdI(h, w);
+    vpImage<unsigned char> &dI = scratchdI.get();
+    if (p_mask != nullptr) {
+      dI = 0;
     }
-    else {
-      computePartialDerivatives(I, dIx, dIy, true, true, true, gaussianKernelSize, gaussianStdev,
+    const bool computeGradient = (p_dIx == nullptr) || (p_dIy == nullptr);
+    vpImagePool::vpScratch<OutType> scratchdIx(computeGradient ? h : 0, computeGradient ? w : 0);
+    vpImagePool::vpScratch<OutType> scratchdIy(computeGradient ? h : 0, computeGradient ? w : 0);
+    if (computeGradient) {
+      computePartialDerivatives(I, scratchdIx.get(), scratchdIy.get(), true, true, true, gaussianKernelSize, gaussianStdev,
                                 apertureGradient, filteringType, vpImageFilter::CANNY_VISP_BACKEND, p_mask);
     }
+    // Use the gradients given by the user without copying them
+    const vpImage<OutType> &dIx = computeGradient ? scratchdIx.get() : *p_dIx;
+    const vpImage<OutType> &dIy = computeGradient ? scratchdIy.get() : *p_dIy;
 
-    // Computing the absolute gradient of the image G = |dIx| + |dIy|
+    // Computing the absolute gradient of the image G = |dIx| + |dIy|. The gradients are accessed row by row, since
+    // the ones given by the user may be views
 #ifdef VISP_HAVE_OPENMP
 #pragma omp parallel for
 #endif
-    for (int iter = 0; iter < size; ++iter) {
+    for (int i = 0; i < static_cast<int>(h); ++i) {
+      const OutType *dIxRow = dIx[i];
+      const OutType *dIyRow = dIy[i];
+      unsigned char *dIRow = dI[i];
+      for (unsigned int j = 0; j < w; ++j) {
         // We have to compute the value for each pixel if we don't have a mask or for
         // pixels for which the mask is true otherwise
-      bool computeVal = checkBooleanMask(p_mask, iter);
+        bool computeVal = checkBooleanMask(p_mask, static_cast<unsigned int>(i), j);
 
-      if (computeVal) {
-        float dx = static_cast<float>(dIx.bitmap[iter]);
-        float dy = static_cast<float>(dIy.bitmap[iter]);
-        float gradient = std::abs(dx) + std::abs(dy);
-        float gradientClamped = std::min<float>(gradient, static_cast<float>(std::numeric_limits<unsigned char>::max()));
-        dI.bitmap[iter] = static_cast<unsigned char>(gradientClamped);
+        if (computeVal) {
+          float dx = static_cast<float>(dIxRow[j]);
+          float dy = static_cast<float>(dIyRow[j]);
+          float gradient = std::abs(dx) + std::abs(dy);
+          float gradientClamped = std::min<float>(gradient, static_cast<float>(std::numeric_limits<unsigned char>::max()));
+          dIRow[j] = static_cast<unsigned char>(gradientClamped);
+        }
       }
     }
 
@@ -474,6 +489,10 @@ public:
     const unsigned int w = I.getWidth();
     const unsigned int h = I.getHeight();
     const int size = static_cast<int>(I.getSize());
+    checkContiguous(&I, "vpImageFilter::computeCannyThreshold");
+    checkContiguous(p_dIx, "vpImageFilter::computeCannyThreshold");
+    checkContiguous(p_dIy, "vpImageFilter::computeCannyThreshold");
+    checkContiguous(p_mask, "vpImageFilter::computeCannyThreshold");
 
     if ((lowerThresholdRatio <= 0.f) || (lowerThresholdRatio >= 1.f)) {
       std::stringstream errMsg;
@@ -498,17 +517,22 @@ public:
     nbThread = omp_get_max_threads();
 #endif
 
-    vpImage<OutType> dI(h, w);
-    vpImage<OutType> dIx(h, w), dIy(h, w);
-    if ((p_dIx != nullptr) && (p_dIy != nullptr)) {
-      dIx = *p_dIx;
-      dIy = *p_dIy;
+    vpImagePool::vpScratch<OutType> scratchdI(h, w);
+    vpImage<OutType> &dI = scratchdI.get();
+    if (p_mask != nullptr) {
+      dI = 0;
     }
-    else {
-      vpImage<vpHSV<ArithmeticType, useFullScale>> Iblur;
-      gaussianBlur(I, Iblur, gaussianKernelSize, gaussianStdev, true, p_mask);
-      gradientFilter(Iblur, dIx, dIy, nbThread, p_mask, filteringType);
+    const bool computeGradient = (p_dIx == nullptr) || (p_dIy == nullptr);
+    vpImagePool::vpScratch<OutType> scratchdIx(computeGradient ? h : 0, computeGradient ? w : 0);
+    vpImagePool::vpScratch<OutType> scratchdIy(computeGradient ? h : 0, computeGradient ? w : 0);
+    if (computeGradient) {
+      vpImagePool::vpScratch<vpHSV<ArithmeticType, useFullScale> > scratchBlur(h, w);
+      gaussianBlur(I, scratchBlur.get(), gaussianKernelSize, gaussianStdev, true, p_mask);
+      gradientFilter(scratchBlur.get(), scratchdIx.get(), scratchdIy.get(), nbThread, p_mask, filteringType);
     }
+    // Use the gradients given by the user without copying them
+    const vpImage<OutType> &dIx = computeGradient ? scratchdIx.get() : *p_dIx;
+    const vpImage<OutType> &dIy = computeGradient ? scratchdIy.get() : *p_dIy;
 
     // Computing the absolute gradient of the image G = |dIx| + |dIy|
     float dIMax = -1.; // dI is the absolute gradient => positive
@@ -690,6 +714,8 @@ public:
     \param M : Filter kernel.
     \param convolve : If true, perform a convolution otherwise a correlation.
     \param p_mask : If different from nullptr, mask indicating which points to consider (true) or to ignore(false).
+    \param nbThread : Number of threads used to filter the image rows when OpenMP is available. -1 to let the program
+    choose. By default the filter is sequential.
 
     \note By default it performs a correlation:
     \f[
@@ -713,18 +739,27 @@ public:
   */
   template <typename ImageType, typename FilterType>
   static void filter(const vpImage<ImageType> &I, vpImage<FilterType> &If, const vpArray2D<FilterType> &M, bool convolve = false,
-                     const vpImage<bool> *p_mask = nullptr)
+                     const vpImage<bool> *p_mask = nullptr, const int &nbThread = 1)
   {
     const unsigned int size_y = M.getRows(), size_x = M.getCols();
     const unsigned int half_size_y = size_y / 2, half_size_x = size_x / 2;
 
     const unsigned int inputHeight = I.getHeight(), inputWidth = I.getWidth();
     If.resize(inputHeight, inputWidth, 0.0);
+#ifdef VISP_HAVE_OPENMP
+    const int nbThreadUsed = getNbThread(nbThread);
+#else
+    (void)nbThread;
+#endif
 
     if (convolve) {
-      const unsigned int stopHeight = inputHeight - half_size_y;
+      const int stopHeight = static_cast<int>(inputHeight - half_size_y);
       const unsigned int stopWidth = inputWidth - half_size_x;
-      for (unsigned int i = half_size_y; i < stopHeight; ++i) {
+#ifdef VISP_HAVE_OPENMP
+#pragma omp parallel for num_threads(nbThreadUsed) if(nbThreadUsed > 1)
+#endif
+      for (int r = static_cast<int>(half_size_y); r < stopHeight; ++r) {
+        const unsigned int i = static_cast<unsigned int>(r);
         for (unsigned int j = half_size_x; j < stopWidth; ++j) {
           // We have to compute the value for each pixel if we don't have a mask or for
           // pixels for which the mask is true otherwise
@@ -744,9 +779,13 @@ public:
       }
     }
     else {
-      const unsigned int stopHeight = inputHeight - half_size_y;
+      const int stopHeight = static_cast<int>(inputHeight - half_size_y);
       const unsigned int stopWidth = inputWidth - half_size_x;
-      for (unsigned int i = half_size_y; i < stopHeight; ++i) {
+#ifdef VISP_HAVE_OPENMP
+#pragma omp parallel for num_threads(nbThreadUsed) if(nbThreadUsed > 1)
+#endif
+      for (int r = static_cast<int>(half_size_y); r < stopHeight; ++r) {
+        const unsigned int i = static_cast<unsigned int>(r);
         for (unsigned int j = half_size_x; j < stopWidth; ++j) {
           // We have to compute the value for each pixel if we don't have a mask or for
           // pixels for which the mask is true otherwise
@@ -903,10 +942,9 @@ public:
   template <typename ImageType, typename FilterType>
   static void filter(const vpImage<ImageType> &I, vpImage<FilterType> &GI, const FilterType *filter, unsigned int size, const vpImage<bool> *p_mask = nullptr)
   {
-    vpImage<FilterType> GIx;
-    filterX<ImageType, FilterType>(I, GIx, filter, size, p_mask);
-    filterY<FilterType, FilterType>(GIx, GI, filter, size, p_mask);
-    GIx.destroy();
+    vpImagePool::vpScratch<FilterType> scratch(I.getHeight(), I.getWidth());
+    filterX<ImageType, FilterType>(I, scratch.get(), filter, size, p_mask);
+    filterY<FilterType, FilterType>(scratch.get(), GI, filter, size, p_mask);
   }
 
   static inline unsigned char filterGaussXPyramidal(const vpImage<unsigned char> &I, unsigned int i, unsigned int j)
@@ -923,8 +961,9 @@ public:
 #if (VISP_CXX_STANDARD < VISP_CXX_STANDARD_11)
   template <typename ImageType, typename FilterType>
   static void filterX(const vpImage<ImageType> &I, vpImage<FilterType> &dIx, const FilterType *filter, unsigned int size,
-                      const vpImage<bool> *p_mask = nullptr)
+                      const vpImage<bool> *p_mask = nullptr, const int &nbThread = -1)
   {
+    (void)nbThread;
     const unsigned int height = I.getHeight();
     const unsigned int width = I.getWidth();
     const unsigned int stop1J = (size - 1) / 2;
@@ -1097,22 +1136,27 @@ public:
    * \param[in] size The size of the filter.
    * \param[in] p_mask A boolean mask that permits to select the pixels that must be filtered if different from nullptr,
    * unused otherwise.
+   * \param[in] nbThread Number of threads to use when OpenMP is available. -1 to let the program choose.
    */
   template<typename ImageType, typename OutputType, typename FilterType>
   static void filterX(const vpImage<ImageType> &I, vpImage<OutputType> &dIx, const FilterType *filter, unsigned int size,
-                      const vpImage<bool> *p_mask = nullptr)
+                      const vpImage<bool> *p_mask = nullptr, const int &nbThread = -1)
   {
     const unsigned int height = I.getHeight();
     const unsigned int width = I.getWidth();
     const int stop1J = static_cast<int>((size - 1) / 2);
     const int stop2J = static_cast<int>(width - ((size - 1) / 2));
     resizeAndInitializeIfNeeded(p_mask, height, width, dIx);
+    if ((p_mask == nullptr) && separableFilterX(I, dIx, filter, size, false, nbThread)) {
+      return;
+    }
 
     int istart = 0;
     int istop = static_cast<int>(height);
 #ifdef VISP_HAVE_OPENMP
     int iam, nt, ipoints, npoints(static_cast<int>(height));
-#pragma omp parallel default(shared) private(iam, nt, ipoints, istart, istop)
+    const int nbThreadUsed = getNbThread(nbThread);
+#pragma omp parallel default(shared) private(iam, nt, ipoints, istart, istop) num_threads(nbThreadUsed)
     {
       iam = omp_get_thread_num();
       nt = omp_get_num_threads();
@@ -1373,8 +1417,9 @@ public:
 
   template<typename ImageType, typename FilterType>
   static void filterY(const vpImage<ImageType> &I, vpImage<FilterType> &dIy, const FilterType *filter, unsigned int size,
-                      const vpImage<bool> *p_mask = nullptr)
+                      const vpImage<bool> *p_mask = nullptr, const int &nbThread = -1)
   {
+    (void)nbThread;
     const unsigned int height = I.getHeight(), width = I.getWidth();
     const unsigned int stop1I = (size - 1) / 2;
     const unsigned int stop2I = height - ((size - 1) / 2);
@@ -1490,21 +1535,26 @@ public:
    * \param[in] size The size of the filter.
    * \param[in] p_mask A boolean mask that permits to select the pixels that must be filtered if different from nullptr,
    * unused otherwise.
+   * \param[in] nbThread Number of threads to use when OpenMP is available. -1 to let the program choose.
    */
   template<typename ImageType, typename OutputType, typename FilterType>
   static void filterY(const vpImage<ImageType> &I, vpImage<OutputType> &dIy, const FilterType *filter, unsigned int size,
-                      const vpImage<bool> *p_mask = nullptr)
+                      const vpImage<bool> *p_mask = nullptr, const int &nbThread = -1)
   {
     const unsigned int height = I.getHeight(), width = I.getWidth();
     const unsigned int stop1I = (size - 1) / 2;
     const unsigned int stop2I = height - ((size - 1) / 2);
     resizeAndInitializeIfNeeded(p_mask, height, width, dIy);
+    if ((p_mask == nullptr) && separableFilterY(I, dIy, filter, size, false, nbThread)) {
+      return;
+    }
 
     unsigned int jstart = 0;
     unsigned int jstop = width;
 #ifdef VISP_HAVE_OPENMP
     unsigned int iam, nt, jpoints, npoints(width);
-#pragma omp parallel default(shared) private(iam, nt, jpoints, jstart, jstop)
+    const int nbThreadUsed = getNbThread(nbThread);
+#pragma omp parallel default(shared) private(iam, nt, jpoints, jstart, jstop) num_threads(nbThreadUsed)
     {
       iam = static_cast<unsigned int>(omp_get_thread_num());
       nt = static_cast<unsigned int>(omp_get_num_threads());
@@ -1787,10 +1837,11 @@ public:
 
     FilterType *fg = new FilterType[(size + 1) / 2];
     vpImageFilter::getGaussianKernel<FilterType>(fg, size, sigma, normalize);
-    vpImage<OutputType> GIx;
-    vpImageFilter::filterX<ImageType, OutputType>(I, GIx, fg, size, p_mask);
-    vpImageFilter::filterY<OutputType, OutputType>(GIx, GI, fg, size, p_mask);
-    GIx.destroy();
+    {
+      vpImagePool::vpScratch<OutputType> scratch(I.getHeight(), I.getWidth());
+      vpImageFilter::filterX<ImageType, OutputType>(I, scratch.get(), fg, size, p_mask);
+      vpImageFilter::filterY<OutputType, OutputType>(scratch.get(), GI, fg, size, p_mask);
+    }
     delete[] fg;
   }
 #else
@@ -1816,10 +1867,11 @@ public:
 
     FilterType *fg = new FilterType[(size + 1) / 2];
     vpImageFilter::getGaussianKernel<FilterType>(fg, size, sigma, normalize);
-    vpImage<OutputType> GIx;
-    vpImageFilter::filterX<ImageType, OutputType>(I, GIx, fg, size, p_mask);
-    vpImageFilter::filterY<OutputType, OutputType>(GIx, GI, fg, size, p_mask);
-    GIx.destroy();
+    {
+      vpImagePool::vpScratch<OutputType> scratch(I.getHeight(), I.getWidth());
+      vpImageFilter::filterX<ImageType, OutputType>(I, scratch.get(), fg, size, p_mask);
+      vpImageFilter::filterY<OutputType, OutputType>(scratch.get(), GI, fg, size, p_mask);
+    }
     delete[] fg;
   }
 #endif
@@ -1829,6 +1881,11 @@ public:
                       const vpImage<bool> *p_mask = nullptr);
 #endif
 
+#if (VISP_CXX_STANDARD >= VISP_CXX_STANDARD_11)
+  static void gaussianBlurFixedPoint(const vpImage<unsigned char> &I, vpImage<unsigned char> &GI, unsigned int size = 7,
+                                     float sigma = 0.f);
+#endif
+
   /*!
   * Apply a 5x5 Gaussian filter to an image pixel.
   *
@@ -2000,6 +2057,11 @@ public:
     const unsigned int stop1J = (size - 1) / 2;
     const unsigned int stop2J = width - ((size - 1) / 2);
     resizeAndInitializeIfNeeded(p_mask, height, width, dIx);
+#if (VISP_CXX_STANDARD >= VISP_CXX_STANDARD_11)
+    if ((p_mask == nullptr) && separableFilterX(I, dIx, filter, size, true, -1)) {
+      return;
+    }
+#endif
 
     for (unsigned int i = 0; i < height; ++i) {
       for (unsigned int j = 0; j < stop1J; ++j) {
@@ -2042,9 +2104,9 @@ public:
   static void getGradXGauss2D(const vpImage<ImageType> &I, vpImage<FilterType> &dIx, const FilterType *gaussianKernel,
                               const FilterType *gaussianDerivativeKernel, unsigned int size, const vpImage<bool> *p_mask = nullptr)
   {
-    vpImage<FilterType> GIy;
-    vpImageFilter::filterY<ImageType, FilterType>(I, GIy, gaussianKernel, size, p_mask);
-    vpImageFilter::getGradX<FilterType, FilterType>(GIy, dIx, gaussianDerivativeKernel, size, p_mask);
+    vpImagePool::vpScratch<FilterType> scratch(I.getHeight(), I.getWidth());
+    vpImageFilter::filterY<ImageType, FilterType>(I, scratch.get(), gaussianKernel, size, p_mask);
+    vpImageFilter::getGradX<FilterType, FilterType>(scratch.get(), dIx, gaussianDerivativeKernel, size, p_mask);
   }
 
 #if (VISP_CXX_STANDARD >= VISP_CXX_STANDARD_11)
@@ -2063,6 +2125,9 @@ public:
   template <typename ArithmeticType, typename FilterType, bool useFullScale>
   static void gradientFilterX(const vpImage<vpHSV<ArithmeticType, useFullScale>> &I, vpImage<FilterType> &GIx, const int &nbThread, const vpImage<bool> *p_mask, const vpImageFilter::vpCannyFilteringAndGradientType &type)
   {
+    checkContiguous(&I, "vpImageFilter::gradientFilterX");
+    checkContiguous(&GIx, "vpImageFilter::gradientFilterX");
+    checkContiguous(p_mask, "vpImageFilter::gradientFilterX");
     const unsigned int nbRows = I.getRows(), nbCols = I.getCols();
     GIx.resize(nbRows, nbCols, 0.);
     std::vector<FilterType> filter(3);
@@ -2145,6 +2210,11 @@ public:
     const unsigned int stop1I = (size - 1) / 2;
     const unsigned int stop2I = height - ((size - 1) / 2);
     resizeAndInitializeIfNeeded(p_mask, height, width, dIy);
+#if (VISP_CXX_STANDARD >= VISP_CXX_STANDARD_11)
+    if ((p_mask == nullptr) && separableFilterY(I, dIy, filter, size, true, -1)) {
+      return;
+    }
+#endif
 
     for (unsigned int i = 0; i < stop1I; ++i) {
       for (unsigned int j = 0; j < width; ++j) {
@@ -2193,9 +2263,9 @@ public:
   static void getGradYGauss2D(const vpImage<ImageType> &I, vpImage<FilterType> &dIy, const FilterType *gaussianKernel,
                               const FilterType *gaussianDerivativeKernel, unsigned int size, const vpImage<bool> *p_mask = nullptr)
   {
-    vpImage<FilterType> GIx;
-    vpImageFilter::filterX<ImageType, FilterType>(I, GIx, gaussianKernel, size, p_mask);
-    vpImageFilter::getGradY<FilterType, FilterType>(GIx, dIy, gaussianDerivativeKernel, size, p_mask);
+    vpImagePool::vpScratch<FilterType> scratch(I.getHeight(), I.getWidth());
+    vpImageFilter::filterX<ImageType, FilterType>(I, scratch.get(), gaussianKernel, size, p_mask);
+    vpImageFilter::getGradY<FilterType, FilterType>(scratch.get(), dIy, gaussianDerivativeKernel, size, p_mask);
   }
 
 #if (VISP_CXX_STANDARD >= VISP_CXX_STANDARD_11)
@@ -2214,6 +2284,9 @@ public:
   template <typename ArithmeticType, typename FilterType, bool useFullScale>
   static void gradientFilterY(const vpImage<vpHSV<ArithmeticType, useFullScale>> &I, vpImage<FilterType> &GIy, const int &nbThread, const vpImage<bool> *p_mask, const vpImageFilter::vpCannyFilteringAndGradientType &type)
   {
+    checkContiguous(&I, "vpImageFilter::gradientFilterY");
+    checkContiguous(&GIy, "vpImageFilter::gradientFilterY");
+    checkContiguous(p_mask, "vpImageFilter::gradientFilterY");
     const unsigned int nbRows = I.getRows(), nbCols = I.getCols();
     GIy.resize(nbRows, nbCols);
     std::vector<FilterType> filter(3);
@@ -2434,6 +2507,35 @@ public:
 #endif
 
 private:
+  /**
+   * \brief Number of threads to use for the given \b nbThread parameter: -1 to let the program choose, at least 1
+   * otherwise. It is always 1 when OpenMP is not available.
+   */
+  static inline int getNbThread(const int &nbThread)
+  {
+#ifdef VISP_HAVE_OPENMP
+    return (nbThread < 0) ? omp_get_max_threads() : std::max<int>(nbThread, 1);
+#else
+    (void)nbThread;
+    return 1;
+#endif
+  }
+
+  /**
+   * \brief Throw an exception if the image is not contiguous, for the methods that walk its bitmap linearly.
+   *
+   * \param[in] p_I Pointer towards the image, or nullptr if not used.
+   * \param[in] func Name of the calling method, used in the exception message.
+   */
+  template <typename Type>
+  static void checkContiguous(const vpImage<Type> *p_I, const char *func)
+  {
+    if ((p_I != nullptr) && (!p_I->isContiguous())) {
+      throw(vpException(vpException::badValue, "%s() does not support non contiguous images such as views, "
+                        "see vpImage::isContiguous()", func));
+    }
+  }
+
   /**
    * \brief Resize the image \b I to the desired size and, if \b p_mask is different from nullptr, initialize
    * \b I with 0s.
@@ -2520,6 +2622,363 @@ private:
 #endif
 
 #if (VISP_CXX_STANDARD >= VISP_CXX_STANDARD_11)
+  /**
+   * \brief Filter a row with a symmetric or an anti-symmetric kernel, one tap at a time.
+   *
+   * \param[in] taps Pointers towards the rows of the neighborhood: taps[half] is the row to filter, taps[half + k]
+   * and taps[half - k] are the ones multiplied by filter[k].
+   * \param[out] acc The filtered row.
+   * \param[in] width The number of pixels to filter.
+   * \param[in] filter The coefficients of the filter.
+   * \param[in] half The half size of the filter.
+   * \param[in] derivative If true, the kernel is anti-symmetric and the central tap is ignored.
+   */
+  template<typename ImageType, typename FilterType>
+  static inline void separableFilterRow(const ImageType *const *taps, FilterType *acc, unsigned int width,
+                                        const FilterType *filter, unsigned int half, bool derivative)
+  {
+    // The taps are accumulated in the same order than in the per pixel filterX() and filterY()
+    if (derivative) {
+      std::fill(acc, acc + width, static_cast<FilterType>(0));
+    }
+    else {
+      const ImageType *center = taps[half];
+      const FilterType f0 = filter[0];
+      for (unsigned int j = 0; j < width; ++j) {
+        acc[j] = f0 * static_cast<FilterType>(center[j]);
+      }
+    }
+    for (unsigned int k = 1; k <= half; ++k) {
+      const ImageType *after = taps[half + k];
+      const ImageType *before = taps[half - k];
+      const FilterType fk = filter[k];
+      if (derivative) {
+        for (unsigned int j = 0; j < width; ++j) {
+          acc[j] += fk * static_cast<FilterType>(after[j] - before[j]);
+        }
+      }
+      else {
+        for (unsigned int j = 0; j < width; ++j) {
+          acc[j] += fk * static_cast<FilterType>(after[j] + before[j]);
+        }
+      }
+    }
+  }
+
+  /**
+   * \brief Filter a vpRGBa row with a symmetric kernel, one tap at a time. The channels are accumulated in
+   * double as in filterChannel().
+   */
+  template<typename FilterType>
+  static inline void separableFilterRow(const vpRGBa *const *taps, double *acc, unsigned int width,
+                                        const FilterType *filter, unsigned int half)
+  {
+    const vpRGBa *center = taps[half];
+    const FilterType f0 = filter[0];
+    for (unsigned int j = 0; j < width; ++j) {
+      acc[3 * j] = f0 * static_cast<FilterType>(center[j].R);
+      acc[(3 * j) + 1] = f0 * static_cast<FilterType>(center[j].G);
+      acc[(3 * j) + 2] = f0 * static_cast<FilterType>(center[j].B);
+    }
+    for (unsigned int k = 1; k <= half; ++k) {
+      const vpRGBa *after = taps[half + k];
+      const vpRGBa *before = taps[half - k];
+      const FilterType fk = filter[k];
+      for (unsigned int j = 0; j < width; ++j) {
+        acc[3 * j] += fk * static_cast<FilterType>(after[j].R + before[j].R);
+        acc[(3 * j) + 1] += fk * static_cast<FilterType>(after[j].G + before[j].G);
+        acc[(3 * j) + 2] += fk * static_cast<FilterType>(after[j].B + before[j].B);
+      }
+    }
+  }
+
+  /**
+   * \brief Copy the row \b src in \b dst, padded on each side with \b half mirrored pixels, using the same border
+   * conventions as filterXLeftBorder() and filterXRightBorder().
+   */
+  template<typename ImageType>
+  static inline void mirrorRow(const ImageType *src, ImageType *dst, unsigned int width, unsigned int half)
+  {
+    std::copy(src, src + width, dst + half);
+    for (unsigned int k = 1; k <= half; ++k) {
+      dst[half - k] = src[k];
+      dst[((half + width) - 1) + k] = src[width - k];
+    }
+  }
+
+  /**
+   * \brief Index of the row read by filterYTopBorder() and filterYBottomBorder() at the given offset.
+   */
+  static inline unsigned int mirrorIndex(int r, int height)
+  {
+    if (r < 0) {
+      return static_cast<unsigned int>(-r);
+    }
+    if (r >= height) {
+      return static_cast<unsigned int>(((2 * height) - r) - 1);
+    }
+    return static_cast<unsigned int>(r);
+  }
+
+  /**
+   * \brief Row-buffered separable convolution along the horizontal direction, used by filterX() and getGradX()
+   * when no mask is given.
+   *
+   * Each row is copied once in a buffer padded with the mirrored border pixels, so that the border tests are hoisted
+   * out of the convolution which runs tap by tap over contiguous memory that the compiler can vectorize. The results
+   * are identical to the per pixel implementation. The rows are distributed by bands over \b nbThread OpenMP threads.
+   * The row buffers of the threads are drawn from the vpImagePool attached to the calling thread, if any.
+   *
+   * \return false if the image is too narrow for the filter, in which case the per pixel implementation is used.
+   */
+  template<typename ImageType, typename OutputType, typename FilterType>
+  static typename std::enable_if<std::is_arithmetic<ImageType>::value &&std::is_arithmetic<OutputType>::value, bool>::type
+    separableFilterX(const vpImage<ImageType> &I, vpImage<OutputType> &dIx, const FilterType *filter, unsigned int size,
+                     bool derivative, const int &nbThread)
+  {
+    const int height = static_cast<int>(I.getHeight());
+    const unsigned int width = I.getWidth();
+    const unsigned int half = (size - 1) / 2;
+    if (width <= (2 * half)) {
+      return false;
+    }
+    // The derivative is only computed where the filter fits in the image
+    const unsigned int start = derivative ? half : 0;
+    const unsigned int nbCols = derivative ? (width - (2 * half)) : width;
+    // One row of each scratch image per thread, so that no memory is allocated from one frame to the next one
+    const int nbThreadUsed = getNbThread(nbThread);
+    vpImagePool::vpScratch<ImageType> scratchBuffer(derivative ? 0 : static_cast<unsigned int>(nbThreadUsed),
+                                                    width + (2 * half));
+    vpImagePool::vpScratch<FilterType> scratchAcc(static_cast<unsigned int>(nbThreadUsed), nbCols);
+    vpImage<ImageType> &buffers = scratchBuffer.get();
+    vpImage<FilterType> &accs = scratchAcc.get();
+
+#ifdef VISP_HAVE_OPENMP
+#pragma omp parallel num_threads(nbThreadUsed)
+#endif
+    {
+#ifdef VISP_HAVE_OPENMP
+      const unsigned int iam = static_cast<unsigned int>(omp_get_thread_num());
+#else
+      const unsigned int iam = 0;
+#endif
+      ImageType *buffer = derivative ? nullptr : buffers[iam];
+      FilterType *acc = accs[iam];
+      std::vector<const ImageType *> taps((2 * half) + 1);
+#ifdef VISP_HAVE_OPENMP
+#pragma omp for schedule(static)
+#endif
+      for (int i = 0; i < height; ++i) {
+        const ImageType *src = I[i];
+        if (!derivative) {
+          mirrorRow(src, buffer, width, half);
+          src = buffer + half;
+        }
+        else {
+          src += start;
+        }
+        for (unsigned int k = 0; k < taps.size(); ++k) {
+          taps[k] = src + (static_cast<int>(k) - static_cast<int>(half));
+        }
+        separableFilterRow(taps.data(), acc, nbCols, filter, half, derivative);
+
+        OutputType *dst = dIx[i];
+        std::fill(dst, dst + start, static_cast<OutputType>(0));
+        for (unsigned int j = 0; j < nbCols; ++j) {
+          dst[start + j] = static_cast<OutputType>(acc[j]);
+        }
+        std::fill(dst + start + nbCols, dst + width, static_cast<OutputType>(0));
+      }
+    }
+    return true;
+  }
+
+  /**
+   * \brief Row-buffered separable convolution along the horizontal direction of a vpRGBa image.
+   *
+   * \sa separableFilterX()
+   */
+  template<typename ImageType, typename OutputType, typename FilterType>
+  static typename std::enable_if<std::is_same<ImageType, vpRGBa>::value &&std::is_same<OutputType, vpRGBa>::value, bool>::type
+    separableFilterX(const vpImage<ImageType> &I, vpImage<OutputType> &dIx, const FilterType *filter, unsigned int size,
+                     bool derivative, const int &nbThread)
+  {
+    const int height = static_cast<int>(I.getHeight());
+    const unsigned int width = I.getWidth();
+    const unsigned int half = (size - 1) / 2;
+    if (derivative || (width <= (2 * half))) {
+      return false;
+    }
+    const int nbThreadUsed = getNbThread(nbThread);
+    vpImagePool::vpScratch<vpRGBa> scratchBuffer(static_cast<unsigned int>(nbThreadUsed), width + (2 * half));
+    vpImagePool::vpScratch<double> scratchAcc(static_cast<unsigned int>(nbThreadUsed), 3 * width);
+    vpImage<vpRGBa> &buffers = scratchBuffer.get();
+    vpImage<double> &accs = scratchAcc.get();
+
+#ifdef VISP_HAVE_OPENMP
+#pragma omp parallel num_threads(nbThreadUsed)
+#endif
+    {
+#ifdef VISP_HAVE_OPENMP
+      const unsigned int iam = static_cast<unsigned int>(omp_get_thread_num());
+#else
+      const unsigned int iam = 0;
+#endif
+      vpRGBa *buffer = buffers[iam];
+      double *acc = accs[iam];
+      std::vector<const vpRGBa *> taps((2 * half) + 1);
+#ifdef VISP_HAVE_OPENMP
+#pragma omp for schedule(static)
+#endif
+      for (int i = 0; i < height; ++i) {
+        mirrorRow(I[i], buffer, width, half);
+        for (unsigned int k = 0; k < taps.size(); ++k) {
+          taps[k] = buffer + k;
+        }
+        separableFilterRow(taps.data(), acc, width, filter, half);
+
+        vpRGBa *dst = dIx[i];
+        for (unsigned int j = 0; j < width; ++j) {
+          dst[j] = vpRGBa(static_cast<unsigned char>(acc[3 * j]), static_cast<unsigned char>(acc[(3 * j) + 1]),
+                          static_cast<unsigned char>(acc[(3 * j) + 2]), vpRGBa::alpha_default);
+        }
+      }
+    }
+    return true;
+  }
+
+  /**
+   * \brief Fallback for the pixel types that are not handled by the row-buffered engine.
+   */
+  template<typename ImageType, typename OutputType, typename FilterType>
+  static typename std::enable_if<!(std::is_arithmetic<ImageType>::value &&std::is_arithmetic<OutputType>::value)
+    && !(std::is_same<ImageType, vpRGBa>::value &&std::is_same<OutputType, vpRGBa>::value), bool>::type
+    separableFilterX(const vpImage<ImageType> &, vpImage<OutputType> &, const FilterType *, unsigned int, bool,
+                     const int &)
+  {
+    return false;
+  }
+
+  /**
+   * \brief Row-buffered separable convolution along the vertical direction, used by filterY() and getGradY()
+   * when no mask is given.
+   *
+   * Each output row is computed from the rows of its neighborhood, whose indices are mirrored once per row at the
+   * borders, the convolution running tap by tap over contiguous memory. The results are identical to the per pixel
+   * implementation. The rows are distributed by bands over \b nbThread OpenMP threads. The row buffers of the threads
+   * are drawn from the vpImagePool attached to the calling thread, if any.
+   *
+   * \return false if the image is too small for the filter, in which case the per pixel implementation is used.
+   */
+  template<typename ImageType, typename OutputType, typename FilterType>
+  static typename std::enable_if<std::is_arithmetic<ImageType>::value &&std::is_arithmetic<OutputType>::value, bool>::type
+    separableFilterY(const vpImage<ImageType> &I, vpImage<OutputType> &dIy, const FilterType *filter, unsigned int size,
+                     bool derivative, const int &nbThread)
+  {
+    const int height = static_cast<int>(I.getHeight());
+    const unsigned int width = I.getWidth();
+    const int half = static_cast<int>((size - 1) / 2);
+    if (height <= (2 * half)) {
+      return false;
+    }
+    const int nbThreadUsed = getNbThread(nbThread);
+    vpImagePool::vpScratch<FilterType> scratchAcc(static_cast<unsigned int>(nbThreadUsed), width);
+    vpImage<FilterType> &accs = scratchAcc.get();
+
+#ifdef VISP_HAVE_OPENMP
+#pragma omp parallel num_threads(nbThreadUsed)
+#endif
+    {
+#ifdef VISP_HAVE_OPENMP
+      const unsigned int iam = static_cast<unsigned int>(omp_get_thread_num());
+#else
+      const unsigned int iam = 0;
+#endif
+      FilterType *acc = accs[iam];
+      std::vector<const ImageType *> taps(static_cast<size_t>((2 * half) + 1));
+#ifdef VISP_HAVE_OPENMP
+#pragma omp for schedule(static)
+#endif
+      for (int i = 0; i < height; ++i) {
+        OutputType *dst = dIy[i];
+        if (derivative && ((i < half) || (i >= (height - half)))) {
+          std::fill(dst, dst + width, static_cast<OutputType>(0));
+          continue;
+        }
+        for (int k = -half; k <= half; ++k) {
+          taps[static_cast<size_t>(k + half)] = I[mirrorIndex(i + k, height)];
+        }
+        separableFilterRow(taps.data(), acc, width, filter, static_cast<unsigned int>(half), derivative);
+        for (unsigned int j = 0; j < width; ++j) {
+          dst[j] = static_cast<OutputType>(acc[j]);
+        }
+      }
+    }
+    return true;
+  }
+
+  /**
+   * \brief Row-buffered separable convolution along the vertical direction of a vpRGBa image.
+   *
+   * \sa separableFilterY()
+   */
+  template<typename ImageType, typename OutputType, typename FilterType>
+  static typename std::enable_if<std::is_same<ImageType, vpRGBa>::value &&std::is_same<OutputType, vpRGBa>::value, bool>::type
+    separableFilterY(const vpImage<ImageType> &I, vpImage<OutputType> &dIy, const FilterType *filter, unsigned int size,
+                     bool derivative, const int &nbThread)
+  {
+    const int height = static_cast<int>(I.getHeight());
+    const unsigned int width = I.getWidth();
+    const int half = static_cast<int>((size - 1) / 2);
+    if (derivative || (height <= (2 * half))) {
+      return false;
+    }
+    const int nbThreadUsed = getNbThread(nbThread);
+    vpImagePool::vpScratch<double> scratchAcc(static_cast<unsigned int>(nbThreadUsed), 3 * width);
+    vpImage<double> &accs = scratchAcc.get();
+
+#ifdef VISP_HAVE_OPENMP
+#pragma omp parallel num_threads(nbThreadUsed)
+#endif
+    {
+#ifdef VISP_HAVE_OPENMP
+      const unsigned int iam = static_cast<unsigned int>(omp_get_thread_num());
+#else
+      const unsigned int iam = 0;
+#endif
+      double *acc = accs[iam];
+      std::vector<const vpRGBa *> taps(static_cast<size_t>((2 * half) + 1));
+#ifdef VISP_HAVE_OPENMP
+#pragma omp for schedule(static)
+#endif
+      for (int i = 0; i < height; ++i) {
+        for (int k = -half; k <= half; ++k) {
+          taps[static_cast<size_t>(k + half)] = I[mirrorIndex(i + k, height)];
+        }
+        separableFilterRow(taps.data(), acc, width, filter, static_cast<unsigned int>(half));
+
+        vpRGBa *dst = dIy[i];
+        for (unsigned int j = 0; j < width; ++j) {
+          dst[j] = vpRGBa(static_cast<unsigned char>(acc[3 * j]), static_cast<unsigned char>(acc[(3 * j) + 1]),
+                          static_cast<unsigned char>(acc[(3 * j) + 2]), vpRGBa::alpha_default);
+        }
+      }
+    }
+    return true;
+  }
+
+  /**
+   * \brief Fallback for the pixel types that are not handled by the row-buffered engine.
+   */
+  template<typename ImageType, typename OutputType, typename FilterType>
+  static typename std::enable_if<!(std::is_arithmetic<ImageType>::value &&std::is_arithmetic<OutputType>::value)
+    && !(std::is_same<ImageType, vpRGBa>::value &&std::is_same<OutputType, vpRGBa>::value), bool>::type
+    separableFilterY(const vpImage<ImageType> &, vpImage<OutputType> &, const FilterType *, unsigned int, bool,
+                     const int &)
+  {
+    return false;
+  }
+
   /**
    * \brief Return true if the distance must be computed because at least one point in its neighborhood
    * needs to compute a gradient.
@@ -0,0 +1,275 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Pool of reusable images for temporary results.
+ */
+
+/*!
+ * \file vpImagePool.h
+ * \brief Pool of reusable images for temporary results.
+ */
+
+#ifndef VP_IMAGE_POOL_H
+#define VP_IMAGE_POOL_H
+
+#include <typeinfo>
+#include <vector>
+
+#include <visp3/core/vpConfig.h>
+#include <visp3/core/vpException.h>
+#include <visp3/core/vpImage.h>
+
+BEGIN_VISP_NAMESPACE
+/*!
+  \class vpImagePool
+
+  \ingroup group_core_image
+
+  \brief Pool of images that can be reused from one frame to the next one to store temporary results.
+
+  Image processing functions like vpImageFilter::gaussianBlur(), vpImageFilter::getGradXGauss2D() or
+  vpCannyEdgeDetection::detect() need intermediate images. By default these images are allocated and released on each
+  call. When a pool is attached to the calling thread with setThreadPool(), these functions draw their temporary
+  images from the pool instead. Since the images are kept by the pool, processing images of the same size frame after
+  frame does not allocate memory anymore once the first frame has been processed.
+
+  The number of images kept by the pool is bounded, see setMaxNbImages(). When the bound is reached, the free image
+  that was used the least recently is released to make room for a new one.
+
+  \code
+  #include <visp3/core/vpCannyEdgeDetection.h>
+  #include <visp3/core/vpImagePool.h>
+
+  #ifdef ENABLE_VISP_NAMESPACE
+  using namespace VISP_NAMESPACE_NAME;
+  #endif
+
+  int main()
+  {
+    vpImage<unsigned char> I(480, 640, 0), I_edges;
+    vpCannyEdgeDetection canny;
+    vpImagePool pool;
+    vpImagePool::setThreadPool(&pool);
+
+    for (unsigned int frame = 0; frame < 100; ++frame) {
+      // Acquire I
+      I_edges = canny.detect(I);
+      // After the first frame, pool.getNbAllocations() does not increase anymore
+    }
+    vpImagePool::setThreadPool(nullptr);
+  }
+  \endcode
+
+  The easiest way to get a temporary image from the pool attached to the current thread is to use
+  vpImagePool::vpScratch that falls back on a local image when no pool is attached:
+  \code
+  vpImagePool::vpScratch<float> scratch(I.getHeight(), I.getWidth());
+  vpImage<float> &I_tmp = scratch.get();
+  \endcode
+
+  \warning A pool is not thread safe. Each thread has to use its own pool.
+*/
+class VISP_EXPORT vpImagePool
+{
+public:
+  /*!
+    Temporary image drawn from the pool attached to the current thread, if any, and given back to the pool on
+    destruction. When no pool is attached to the current thread, the temporary image is a local image.
+  */
+  template <class Type> class vpScratch
+  {
+  public:
+    /*!
+      Get a temporary image.
+
+      \param height : Image height. The image is resized only if both the height and the width are not null.
+      \param width : Image width.
+    */
+    explicit vpScratch(unsigned int height = 0, unsigned int width = 0)
+      : m_pool(vpImagePool::getThreadPool()), m_local(), m_image(&m_local)
+    {
+      if (m_pool != nullptr) {
+        m_image = &(m_pool->acquire<Type>(height, width));
+      }
+      else if ((height != 0) && (width != 0)) {
+        m_local.resize(height, width);
+      }
+    }
+
+    /*!
+      Give the temporary image back to the pool it comes from.
+    */
+    ~vpScratch()
+    {
+      if (m_pool != nullptr) {
+        m_pool->release(*m_image);
+      }
+    }
+
+    //! Get the temporary image.
+    inline vpImage<Type> &get() { return *m_image; }
+
+  private:
+    vpScratch(const vpScratch &);
+    vpScratch &operator=(const vpScratch &);
+
+    vpImagePool *m_pool;
+    vpImage<Type> m_local;
+    vpImage<Type> *m_image;
+  };
+
+  vpImagePool();
+  virtual ~vpImagePool();
+
+  /*!
+    Get an image that is not used anymore from the pool, or add a new one. Only images that already have the requested
+    size are reused, so that no memory is allocated. Images of other sizes are not resized: temporary images of
+    different sizes used in turn would otherwise keep reallocating each other. Before adding a new image to a pool
+    that holds getMaxNbImages() images, the least recently used free image is released. Call clear() to free all the
+    images at once, e.g. when the size of the processed images changes.
+
+    \param height : Image height. The image is resized only if both the height and the width are not null.
+    \param width : Image width.
+    \return An image that belongs to the pool and that has to be given back with release(). Its content is undefined.
+  */
+  template <class Type> vpImage<Type> &acquire(unsigned int height, unsigned int width)
+  {
+    ++m_nbAcquisitions;
+    const bool resize = (height != 0) && (width != 0);
+    size_t nbEntries = m_entries.size();
+    for (size_t i = 0; i < nbEntries; ++i) {
+      vpEntryBase *entry = m_entries[i];
+      if ((!entry->m_inUse) && (*(entry->m_type) == typeid(Type))) {
+        vpEntry<Type> *typed = static_cast<vpEntry<Type> *>(entry);
+        if ((!resize) || ((typed->m_image.getHeight() == height) && (typed->m_image.getWidth() == width))) {
+          typed->m_inUse = true;
+          typed->m_lastUse = ++m_clock;
+          return typed->m_image;
+        }
+      }
+    }
+
+    if (m_maxNbImages > 0) {
+      evict(m_maxNbImages - 1);
+    }
+    vpEntry<Type> *candidate = new vpEntry<Type>();
+    m_entries.push_back(candidate);
+    if (resize) {
+      ++m_nbAllocations;
+      candidate->m_image.resize(height, width);
+    }
+    candidate->m_inUse = true;
+    candidate->m_lastUse = ++m_clock;
+    return candidate->m_image;
+  }
+
+  /*!
+    Give back to the pool an image obtained with acquire(), so that it can be reused.
+
+    \param I : Image to give back.
+    \exception vpException::badValue When the image does not belong to the pool.
+  */
+  template <class Type> void release(const vpImage<Type> &I)
+  {
+    size_t nbEntries = m_entries.size();
+    for (size_t i = 0; i < nbEntries; ++i) {
+      vpEntryBase *entry = m_entries[i];
+      if ((*(entry->m_type) == typeid(Type)) && (&(static_cast<vpEntry<Type> *>(entry)->m_image) == &I)) {
+        entry->m_inUse = false;
+        return;
+      }
+    }
+    throw(vpException(vpException::badValue, "The image to release does not belong to the pool"));
+  }
+
+  void clear();
+
+  /*!
+    Number of images given by acquire() since the creation of the pool or the last call to resetCounters().
+  */
+  inline unsigned int getNbAcquisitions() const { return m_nbAcquisitions; }
+
+  /*!
+    Number of times the pool had to allocate memory for an image since the creation of the pool or the last call to
+    resetCounters(). It stays constant when the same processing is applied on images of the same size.
+  */
+  inline unsigned int getNbAllocations() const { return m_nbAllocations; }
+
+  /*!
+    Maximum number of images kept by the pool, 0 when the pool is not bounded.
+
+    \sa setMaxNbImages()
+  */
+  inline unsigned int getMaxNbImages() const { return m_maxNbImages; }
+
+  /*!
+    Number of images owned by the pool.
+  */
+  inline unsigned int getNbImages() const { return static_cast<unsigned int>(m_entries.size()); }
+
+  unsigned int getNbImagesInUse() const;
+
+  void resetCounters();
+  void setMaxNbImages(unsigned int maxNbImages);
+
+  static vpImagePool *getThreadPool();
+  static void setThreadPool(vpImagePool *pool);
+
+private:
+  vpImagePool(const vpImagePool &);
+  vpImagePool &operator=(const vpImagePool &);
+
+  struct vpEntryBase
+  {
+    explicit vpEntryBase(const std::type_info &type) : m_type(&type), m_inUse(false), m_lastUse(0) { }
+    virtual ~vpEntryBase() { }
+
+    const std::type_info *m_type;
+    bool m_inUse;
+    unsigned long m_lastUse; //!< Value of the pool clock when the image was last acquired
+  };
+
+  template <class Type> struct vpEntry : public vpEntryBase
+  {
+    vpEntry() : vpEntryBase(typeid(Type)), m_image() { }
+
+    vpImage<Type> m_image;
+  };
+
+  void evict(unsigned int nbImages);
+
+  std::vector<vpEntryBase *> m_entries; //!< Images owned by the pool
+  unsigned int m_nbAcquisitions; //!< Number of calls to acquire()
+  unsigned int m_nbAllocations; //!< Number of images allocated by acquire()
+  unsigned int m_maxNbImages; //!< Maximum number of images kept by the pool, 0 for no limit
+  unsigned long m_clock; //!< Incremented on each acquisition to order the images by last use
+};
+END_VISP_NAMESPACE
+#endif
@@ -105,6 +105,9 @@ public:
   template <class Type>
   static void crop(const unsigned char *bitmap, unsigned int width, unsigned int height, const vpRect &roi,
                    vpImage<Type> &crop, unsigned int v_scale = 1, unsigned int h_scale = 1);
+  template <class Type>
+  static void crop(const unsigned char *bitmap, unsigned int width, unsigned int height, unsigned int stride,
+                   const vpRect &roi, vpImage<Type> &crop, unsigned int v_scale = 1, unsigned int h_scale = 1);
 
   static void extract(const vpImage<unsigned char> &src, vpImage<unsigned char> &dst, const vpRectOriented &r);
   static void extract(const vpImage<unsigned char> &src, vpImage<double> &dst, const vpRectOriented &r);
@@ -514,26 +517,31 @@ private:
     ArithmeticType s_high = static_cast<ArithmeticType>(hsv_range[index_3]);
     ArithmeticType v_low = static_cast<ArithmeticType>(hsv_range[index_4]);
     ArithmeticType v_high = static_cast<ArithmeticType>(hsv_range[index_5]);
-    int size_ = static_cast<int>(Iin.getSize());
+    const int height = static_cast<int>(Iin.getHeight());
+    const unsigned int width = Iin.getWidth();
     mask.resize(Iin.getRows(), Iin.getCols());
     int cpt_in_range = 0;
 
 #if defined(VISP_HAVE_OPENMP)
 #pragma omp parallel for reduction(+:cpt_in_range)
 #endif
-    for (int i = 0; i < size_; ++i) {
-      bool check_h_low_high_hue = (
-      ((h_low <= h_high) && ((h_low <= Iin.bitmap[i].H) && (Iin.bitmap[i].H <= h_high))) ||
-      ((h_low > h_high) && ((h_low <= Iin.bitmap[i].H) || (Iin.bitmap[i].H <= h_high)))
-    );
-      bool check_s_low_high_saturation = (s_low <= Iin.bitmap[i].S) && (Iin.bitmap[i].S <= s_high);
-      bool check_v_low_high_value = (v_low <= Iin.bitmap[i].V) && (Iin.bitmap[i].V <= v_high);
-      if (check_h_low_high_hue && check_s_low_high_saturation && check_v_low_high_value) {
-        mask.bitmap[i] = valueInRange;
-        ++cpt_in_range;
-      }
-      else {
-        mask.bitmap[i] = valueOutRange;
+    for (int i = 0; i < height; ++i) {
+      const vpHSV<ArithmeticType, useFullScale> *hsv = Iin[i];
+      OutType *m = mask[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        bool check_h_low_high_hue = (
+        ((h_low <= h_high) && ((h_low <= hsv[j].H) && (hsv[j].H <= h_high))) ||
+        ((h_low > h_high) && ((h_low <= hsv[j].H) || (hsv[j].H <= h_high)))
+      );
+        bool check_s_low_high_saturation = (s_low <= hsv[j].S) && (hsv[j].S <= s_high);
+        bool check_v_low_high_value = (v_low <= hsv[j].V) && (hsv[j].V <= v_high);
+        if (check_h_low_high_hue && check_s_low_high_saturation && check_v_low_high_value) {
+          m[j] = valueInRange;
+          ++cpt_in_range;
+        }
+        else {
+          m[j] = valueOutRange;
+        }
       }
     }
     return cpt_in_range;
@@ -552,17 +560,23 @@ private:
 
     I_mask.resize(I.getHeight(), I.getWidth());
     int cpt_in_mask = 0;
-    int size_ = static_cast<int>(I.getSize());
+    const int height = static_cast<int>(I.getHeight());
+    const unsigned int width = I.getWidth();
 #if defined(_OPENMP)
 #pragma omp parallel for reduction(+:cpt_in_mask)
 #endif
-    for (int i = 0; i < size_; ++i) {
-      if (mask.bitmap[i] == inRangeCheck) {
-        I_mask.bitmap[i] = I.bitmap[i];
-        ++cpt_in_mask;
-      }
-      else {
-        I_mask.bitmap[i] = outRangeValue;
+    for (int i = 0; i < height; ++i) {
+      const ImageType *src = I[i];
+      const MaskType *m = mask[i];
+      ImageType *dst = I_mask[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        if (m[j] == inRangeCheck) {
+          dst[j] = src[j];
+          ++cpt_in_mask;
+        }
+        else {
+          dst[j] = outRangeValue;
+        }
       }
     }
     return cpt_in_mask;
@@ -687,6 +701,10 @@ void vpImageTools::crop(const vpImage<Type> &I, const vpRect &roi, vpImage<Type>
   Setting \e v_scale and \e h_scale to values different from 1 allows also to
   subsample the cropped image.
 
+  The rows of the input image are expected to be contiguous. Use
+  crop(const unsigned char *, unsigned int, unsigned int, unsigned int, const vpRect &, vpImage<Type> &, unsigned int, unsigned int)
+  when they are padded, for instance with the bitmap of an image view.
+
   \param[in] bitmap : Pointer to the input image from which a sub image will be extracted.
   \param[in] width : Width of the input image.
   \param[in] height : Height of the input image.
@@ -701,6 +719,38 @@ template <class Type>
 void vpImageTools::crop(const unsigned char *bitmap, unsigned int width, unsigned int height, const vpRect &roi,
                         vpImage<Type> &crop, unsigned int v_scale, unsigned int h_scale)
 {
+  vpImageTools::crop(bitmap, width, height, width, roi, crop, v_scale, h_scale);
+}
+
+/*!
+  Crop a region of interest (ROI) in an image whose rows may be padded. The ROI
+  coordinates and dimension are defined in the original image.
+
+  Setting \e v_scale and \e h_scale to values different from 1 allows also to
+  subsample the cropped image.
+
+  \param[in] bitmap : Pointer to the input image from which a sub image will be extracted.
+  \param[in] width : Width of the input image.
+  \param[in] height : Height of the input image.
+  \param[in] stride : Number of elements of type \e Type between the beginning of two
+  consecutive rows of the input image, see vpImage::getStride().
+
+  \param[in] roi : Region of interest corresponding to the cropped part of the image.
+
+  \param[out] crop : Cropped image.
+  \param[in] v_scale [in] : Vertical subsampling factor applied to the ROI.
+  \param[in] h_scale [in] : Horizontal subsampling factor applied to the ROI.
+
+  \exception vpException::dimensionError When the stride is lower than the image width.
+*/
+template <class Type>
+void vpImageTools::crop(const unsigned char *bitmap, unsigned int width, unsigned int height, unsigned int stride,
+                        const vpRect &roi, vpImage<Type> &crop, unsigned int v_scale, unsigned int h_scale)
+{
+  if (stride < width) {
+    throw(vpException(vpException::dimensionError, "Image stride %d cannot be lower than the image width %d", stride,
+                      width));
+  }
   int i_min = std::max<int>(static_cast<int>(ceil(roi.getTop() / v_scale)), 0);
   int j_min = std::max<int>(static_cast<int>(ceil(roi.getLeft() / h_scale)), 0);
   int i_max = std::min<int>(static_cast<int>(ceil((roi.getTop() + roi.getHeight()) / v_scale)), static_cast<int>(height / v_scale));
@@ -716,21 +766,21 @@ void vpImageTools::crop(const unsigned char *bitmap, unsigned int width, unsigne
 
   if (v_scale == 1 && h_scale == 1) {
     for (unsigned int i = 0; i < r_height; ++i) {
-      void *src = (void *)(bitmap + ((((i + i_min_u) * width) + j_min_u) * sizeof(Type)));
+      void *src = (void *)(bitmap + ((((static_cast<size_t>(i + i_min_u) * stride) + j_min_u) * sizeof(Type))));
       void *dst = (void *)(crop[i]);
       memcpy(dst, src, r_width * sizeof(Type));
     }
   }
   else if (h_scale == 1) {
     for (unsigned int i = 0; i < r_height; ++i) {
-      void *src = (void *)(bitmap + (((((i + i_min_u) * width) * v_scale) + j_min_u) * sizeof(Type)));
+      void *src = (void *)(bitmap + ((((static_cast<size_t>(i + i_min_u) * stride) * v_scale) + j_min_u) * sizeof(Type)));
       void *dst = (void *)(crop[i]);
       memcpy(dst, src, r_width * sizeof(Type));
     }
   }
   else {
     for (unsigned int i = 0; i < r_height; ++i) {
-      unsigned int i_src = (((i + i_min_u) * width) * v_scale) + (j_min_u * h_scale);
+      size_t i_src = ((static_cast<size_t>(i + i_min_u) * stride) * v_scale) + (j_min_u * h_scale);
       for (unsigned int j = 0; j < r_width; ++j) {
         void *src = (void *)(bitmap + ((i_src + (j * h_scale)) * sizeof(Type)));
         void *dst = (void *)(&crop[i][j]);
@@ -758,17 +808,20 @@ inline void vpImageTools::binarise(vpImage<Type> &I, Type threshold1, Type thres
     std::cerr << "LUT not available for this type ! Will use the iteration method." << std::endl;
   }
 
-  const size_t size = I.getWidth() * I.getHeight();
-  for (size_t i = 0; i < size; ++i) {
-    Type v = I.bitmap[i];
-    if (v < threshold1) {
-      I.bitmap[i] = value1;
-    }
-    else if (v > threshold2) {
-      I.bitmap[i] = value3;
-    }
-    else {
-      I.bitmap[i] = value2;
+  const unsigned int height = I.getHeight(), width = I.getWidth();
+  for (unsigned int i = 0; i < height; ++i) {
+    Type *row = I[i];
+    for (unsigned int j = 0; j < width; ++j) {
+      Type v = row[j];
+      if (v < threshold1) {
+        row[j] = value1;
+      }
+      else if (v > threshold2) {
+        row[j] = value3;
+      }
+      else {
+        row[j] = value2;
+      }
     }
   }
 }
@@ -798,18 +851,21 @@ inline void vpImageTools::binarise(vpImage<unsigned char> &I, unsigned char thre
     I.performLut(lut);
   }
   else {
-    unsigned char *p = I.bitmap;
-    unsigned char *pend = I.bitmap + (I.getWidth() * I.getHeight());
-    for (; p < pend; ++p) {
-      unsigned char v = *p;
-      if (v < threshold1) {
-        *p = value1;
-      }
-      else if (v > threshold2) {
-        *p = value3;
-      }
-      else {
-        *p = value2;
+    const unsigned int height = I.getHeight();
+    for (unsigned int i = 0; i < height; ++i) {
+      unsigned char *p = I[i];
+      unsigned char *pend = p + I.getWidth();
+      for (; p < pend; ++p) {
+        unsigned char v = *p;
+        if (v < threshold1) {
+          *p = value1;
+        }
+        else if (v > threshold2) {
+          *p = value3;
+        }
+        else {
+          *p = value2;
+        }
       }
     }
   }
@@ -825,12 +881,16 @@ public:
   Type *dst;
   unsigned int width;
   unsigned int height;
+  unsigned int srcStride;
+  unsigned int dstStride;
   vpCameraParameters cam;
   unsigned int nthreads;
   unsigned int threadid;
 
 public:
-  vpUndistortInternalType() : src(nullptr), dst(nullptr), width(0), height(0), cam(), nthreads(0), threadid(0) {}
+  vpUndistortInternalType()
+    : src(nullptr), dst(nullptr), width(0), height(0), srcStride(0), dstStride(0), cam(), nthreads(0), threadid(0)
+  { }
 
   vpUndistortInternalType(const vpUndistortInternalType<Type> &u) { *this = u; }
   vpUndistortInternalType &operator=(const vpUndistortInternalType<Type> &u)
@@ -839,6 +899,8 @@ public:
     dst = u.dst;
     width = u.width;
     height = u.height;
+    srcStride = u.srcStride;
+    dstStride = u.dstStride;
     cam = u.cam;
     nthreads = u.nthreads;
     threadid = u.threadid;
@@ -855,6 +917,8 @@ template <class Type> void vpUndistortInternalType<Type>::vpUndistort_threaded(v
   int width = static_cast<int>(undistortSharedData.width);
   int height = static_cast<int>(undistortSharedData.height);
   int nthreads = static_cast<int>(undistortSharedData.nthreads);
+  const size_t srcStride = undistortSharedData.srcStride;
+  const size_t dstStride = undistortSharedData.dstStride;
 
   double u0 = undistortSharedData.cam.get_u0();
   double v0 = undistortSharedData.cam.get_v0();
@@ -868,10 +932,11 @@ template <class Type> void vpUndistortInternalType<Type>::vpUndistort_threaded(v
   double kud_px2 = kud * invpx * invpx;
   double kud_py2 = kud * invpy * invpy;
 
-  Type *dst = undistortSharedData.dst + (height / nthreads * offset) * width;
   Type *src = undistortSharedData.src;
 
-  for (double v = height / nthreads * offset; v < height / nthreads * (offset + 1); ++v) {
+  for (int v_ = height / nthreads * offset; v_ < height / nthreads * (offset + 1); ++v_) {
+    Type *dst = undistortSharedData.dst + (static_cast<size_t>(v_) * dstStride);
+    double v = static_cast<double>(v_);
     double deltav = v - v0;
     // double fr1 = 1.0 + kd * (vpMath::sqr(deltav * invpy));
     double fr1 = 1.0 + kud_py2 * deltav * deltav;
@@ -902,9 +967,9 @@ template <class Type> void vpUndistortInternalType<Type>::vpUndistort_threaded(v
       Type v23;
       if ((0 <= u_round) && (0 <= v_round) && (u_round < (width-1)) && (v_round < (height-1))) {
         // process interpolation
-        const Type *_mp = &src[v_round * width + u_round];
+        const Type *_mp = &src[(static_cast<size_t>(v_round) * srcStride) + static_cast<size_t>(u_round)];
         v01 = (Type)(_mp[0] + ((_mp[1] - _mp[0]) * du_double));
-        _mp += width;
+        _mp += srcStride;
         v23 = (Type)(_mp[0] + ((_mp[1] - _mp[0]) * du_double));
         *dst = (Type)(v01 + ((v23 - v01) * dv_double));
       }
@@ -974,6 +1039,8 @@ void vpImageTools::undistort(const vpImage<Type> &I, const vpCameraParameters &c
     undistortSharedData[i].dst = undistI.bitmap;
     undistortSharedData[i].width = I.getWidth();
     undistortSharedData[i].height = I.getHeight();
+    undistortSharedData[i].srcStride = I.getStride();
+    undistortSharedData[i].dstStride = undistI.getStride();
     undistortSharedData[i].cam = cam;
     undistortSharedData[i].nthreads = nthreads;
     undistortSharedData[i].threadid = i;
@@ -1022,8 +1089,9 @@ void vpImageTools::undistort(const vpImage<Type> &I, const vpCameraParameters &c
   double kud_px2 = kud * invpx * invpx;
   double kud_py2 = kud * invpy * invpy;
 
-  Type *dst = undistI.bitmap;
-  for (double v = 0; v < height; ++v) {
+  for (unsigned int v_ = 0; v_ < height; ++v_) {
+    Type *dst = undistI[v_];
+    double v = static_cast<double>(v_);
     double deltav = v - v0;
     /*
     // double fr1 = 1.0 + kd * (vpMath::sqr(deltav * invpy));
@@ -1064,7 +1132,7 @@ void vpImageTools::undistort(const vpImage<Type> &I, const vpCameraParameters &c
         // process interpolation
         const Type *v_mp = &I[static_cast<unsigned int>(v_round)][static_cast<unsigned int>(u_round)];
         v01 = static_cast<Type>(v_mp[0] + ((v_mp[1] - v_mp[0]) * du_double));
-        v_mp += width;
+        v_mp += I.getStride();
         v23 = static_cast<Type>(v_mp[0] + ((v_mp[1] - v_mp[0]) * du_double));
         *dst = static_cast<Type>(v01 + ((v23 - v01) * dv_double));
         /*
@@ -1113,7 +1181,7 @@ template <class Type> void vpImageTools::flip(const vpImage<Type> &I, vpImage<Ty
   newI.resize(height, width);
 
   for (unsigned int i = 0; i < height; ++i) {
-    memcpy(newI.bitmap + (i * width), I.bitmap + ((height - 1 - i) * width), width * sizeof(Type));
+    memcpy(newI[i], I[height - 1 - i], width * sizeof(Type));
   }
 }
 
@@ -1160,10 +1228,10 @@ template <class Type> void vpImageTools::flip(vpImage<Type> &I)
 
   const unsigned int halfHeight = height / 2;
   for (unsigned int i = 0; i < halfHeight; ++i) {
-    memcpy(Ibuf.bitmap, I.bitmap + (i * width), width * sizeof(Type));
+    memcpy(Ibuf.bitmap, I[i], width * sizeof(Type));
 
-    memcpy(I.bitmap + (i * width), I.bitmap + ((height - 1 - i) * width), width * sizeof(Type));
-    memcpy(I.bitmap + ((height - 1 - i) * width), Ibuf.bitmap, width * sizeof(Type));
+    memcpy(I[i], I[height - 1 - i], width * sizeof(Type));
+    memcpy(I[height - 1 - i], Ibuf.bitmap, width * sizeof(Type));
   }
 }
 
@@ -54,7 +54,7 @@ template <class Type> inline Type vpImage<Type>::getValue(unsigned int i, unsign
     throw(vpException(vpImageException::notInTheImage, "Pixel outside the image"));
   }
 
-  return row[i][j];
+  return (*this)[i][j];
 }
 
 /*!
@@ -95,8 +95,8 @@ template <class Type> Type vpImage<Type>::getValue(double i, double j) const
   unsigned int jround_1 = std::min<unsigned int>(width - 1, jround + 1);
 
   double value =
-    (((static_cast<double>(row[iround][jround]) * rfrac) + (static_cast<double>(row[iround_1][jround]) * rratio)) * cfrac) +
-    (((static_cast<double>(row[iround][jround_1]) * rfrac) + (static_cast<double>(row[iround_1][jround_1]) * rratio)) *
+    (((static_cast<double>((*this)[iround][jround]) * rfrac) + (static_cast<double>((*this)[iround_1][jround]) * rratio)) * cfrac) +
+    (((static_cast<double>((*this)[iround][jround_1]) * rfrac) + (static_cast<double>((*this)[iround_1][jround_1]) * rratio)) *
     cratio);
 
   return static_cast<Type>(vpMath::round(value));
@@ -126,8 +126,8 @@ template <> inline double vpImage<double>::getValue(double i, double j) const
   unsigned int iround_1 = std::min<unsigned int>(height - 1, iround + 1);
   unsigned int jround_1 = std::min<unsigned int>(width - 1, jround + 1);
 
-  return (((row[iround][jround] * rfrac) + (row[iround_1][jround] * rratio)) * cfrac) +
-    (((row[iround][jround_1] * rfrac) + (row[iround_1][jround_1] * rratio)) * cratio);
+  return ((((*this)[iround][jround] * rfrac) + ((*this)[iround_1][jround] * rratio)) * cfrac) +
+    ((((*this)[iround][jround_1] * rfrac) + ((*this)[iround_1][jround_1] * rratio)) * cratio);
 }
 
 /*!
@@ -166,21 +166,21 @@ template <> inline unsigned char vpImage<unsigned char>::getValue(double i, doub
   uint64_t y_ = y >> magic_16;
 
   if (((y_ + 1) < height) && ((x_ + 1) < width)) {
-    uint16_t up = vpEndian::reinterpret_cast_uchar_to_uint16_LE(bitmap + (y_ * width) + x_);
-    uint16_t down = vpEndian::reinterpret_cast_uchar_to_uint16_LE(bitmap + ((y_ + 1) * width) + x_);
+    uint16_t up = vpEndian::reinterpret_cast_uchar_to_uint16_LE(bitmap + (y_ * stride) + x_);
+    uint16_t down = vpEndian::reinterpret_cast_uchar_to_uint16_LE(bitmap + ((y_ + 1) * stride) + x_);
 
     return static_cast<unsigned char>((((((up & magic_0x00FF) * rfrac) + ((down & magic_0x00FF) * rratio)) * cfrac)
                                        + (((up >> magic_8) * rfrac) + ((down >> magic_8) * rratio)) * cratio) >> magic_32);
   }
   else if ((y_ + 1) < height) {
-    return static_cast<unsigned char>(((row[y_][x_] * rfrac) + (row[y_ + 1][x_] * rratio)) >> magic_16);
+    return static_cast<unsigned char>((((*this)[static_cast<unsigned int>(y_)][x_] * rfrac) + ((*this)[static_cast<unsigned int>(y_ + 1)][x_] * rratio)) >> magic_16);
   }
   else if ((x_ + 1) < width) {
-    uint16_t up = vpEndian::reinterpret_cast_uchar_to_uint16_LE(bitmap + (y_ * width) + x_);
+    uint16_t up = vpEndian::reinterpret_cast_uchar_to_uint16_LE(bitmap + (y_ * stride) + x_);
     return static_cast<unsigned char>((((up & magic_0x00FF) * cfrac) + ((up >> magic_8) * cratio)) >> magic_16);
   }
   else {
-    return row[y_][x_];
+    return (*this)[static_cast<unsigned int>(y_)][x_];
   }
 #else
   unsigned int iround = static_cast<unsigned int>(floor(i));
@@ -200,8 +200,8 @@ template <> inline unsigned char vpImage<unsigned char>::getValue(double i, doub
   unsigned int jround_1 = std::min<unsigned int>(width - 1, jround + 1);
 
   double value =
-    (static_cast<double>(row[iround][jround]) * rfrac + static_cast<double>(row[iround_1][jround]) * rratio) * cfrac +
-    (static_cast<double>(row[iround][jround_1]) * rfrac + static_cast<double>(row[iround_1][jround_1]) * rratio) *
+    (static_cast<double>((*this)[iround][jround]) * rfrac + static_cast<double>((*this)[iround_1][jround]) * rratio) * cfrac +
+    (static_cast<double>((*this)[iround][jround_1]) * rfrac + static_cast<double>((*this)[iround_1][jround_1]) * rratio) *
     cratio;
   return static_cast<unsigned char>(vpMath::round(value));
 #endif
@@ -232,19 +232,19 @@ template <> inline vpRGBa vpImage<vpRGBa>::getValue(double i, double j) const
   unsigned int jround_1 = std::min<unsigned int>(width - 1, jround + 1);
 
   double valueR =
-    (((static_cast<double>(row[iround][jround].R) * rfrac) + (static_cast<double>(row[iround_1][jround].R) * rratio)) *
+    (((static_cast<double>((*this)[iround][jround].R) * rfrac) + (static_cast<double>((*this)[iround_1][jround].R) * rratio)) *
     cfrac) +
-    (((static_cast<double>(row[iround][jround_1].R) * rfrac) + (static_cast<double>(row[iround_1][jround_1].R) * rratio)) *
+    (((static_cast<double>((*this)[iround][jround_1].R) * rfrac) + (static_cast<double>((*this)[iround_1][jround_1].R) * rratio)) *
     cratio);
   double valueG =
-    (((static_cast<double>(row[iround][jround].G) * rfrac) + (static_cast<double>(row[iround_1][jround].G) * rratio)) *
+    (((static_cast<double>((*this)[iround][jround].G) * rfrac) + (static_cast<double>((*this)[iround_1][jround].G) * rratio)) *
     cfrac) +
-    (((static_cast<double>(row[iround][jround_1].G) * rfrac) + (static_cast<double>(row[iround_1][jround_1].G) * rratio)) *
+    (((static_cast<double>((*this)[iround][jround_1].G) * rfrac) + (static_cast<double>((*this)[iround_1][jround_1].G) * rratio)) *
     cratio);
   double valueB =
-    (((static_cast<double>(row[iround][jround].B) * rfrac) + (static_cast<double>(row[iround_1][jround].B) * rratio)) *
+    (((static_cast<double>((*this)[iround][jround].B) * rfrac) + (static_cast<double>((*this)[iround_1][jround].B) * rratio)) *
     cfrac) +
-    (((static_cast<double>(row[iround][jround_1].B) * rfrac) + (static_cast<double>(row[iround_1][jround_1].B) * rratio)) *
+    (((static_cast<double>((*this)[iround][jround_1].B) * rfrac) + (static_cast<double>((*this)[iround_1][jround_1].B) * rratio)) *
     cratio);
 
   return vpRGBa(static_cast<unsigned char>(vpMath::round(valueR)), static_cast<unsigned char>(vpMath::round(valueG)),
@@ -276,19 +276,19 @@ template <> inline vpRGBf vpImage<vpRGBf>::getValue(double i, double j) const
   unsigned int jround_1 = std::min<unsigned int>(width - 1, jround + 1);
 
   double valueR =
-    (((static_cast<double>(row[iround][jround].R) * rfrac) + (static_cast<double>(row[iround_1][jround].R) * rratio)) *
+    (((static_cast<double>((*this)[iround][jround].R) * rfrac) + (static_cast<double>((*this)[iround_1][jround].R) * rratio)) *
     cfrac) +
-    (((static_cast<double>(row[iround][jround_1].R) * rfrac) + (static_cast<double>(row[iround_1][jround_1].R) * rratio)) *
+    (((static_cast<double>((*this)[iround][jround_1].R) * rfrac) + (static_cast<double>((*this)[iround_1][jround_1].R) * rratio)) *
     cratio);
   double valueG =
-    (((static_cast<double>(row[iround][jround].G) * rfrac) + (static_cast<double>(row[iround_1][jround].G) * rratio)) *
+    (((static_cast<double>((*this)[iround][jround].G) * rfrac) + (static_cast<double>((*this)[iround_1][jround].G) * rratio)) *
     cfrac) +
-    (((static_cast<double>(row[iround][jround_1].G) * rfrac) + (static_cast<double>(row[iround_1][jround_1].G) * rratio)) *
+    (((static_cast<double>((*this)[iround][jround_1].G) * rfrac) + (static_cast<double>((*this)[iround_1][jround_1].G) * rratio)) *
     cratio);
   double valueB =
-    (((static_cast<double>(row[iround][jround].B) * rfrac) + (static_cast<double>(row[iround_1][jround].B) * rratio)) *
+    (((static_cast<double>((*this)[iround][jround].B) * rfrac) + (static_cast<double>((*this)[iround_1][jround].B) * rratio)) *
     cfrac) +
-    (((static_cast<double>(row[iround][jround_1].B) * rfrac) + (static_cast<double>(row[iround_1][jround_1].B) * rratio)) *
+    (((static_cast<double>((*this)[iround][jround_1].B) * rfrac) + (static_cast<double>((*this)[iround_1][jround_1].B) * rratio)) *
     cratio);
 
   return vpRGBf(static_cast<float>(valueR), static_cast<float>(valueG), static_cast<float>(valueB));
@@ -352,9 +352,12 @@ template <class Type> Type vpImage<Type>::getMaxValue(bool onlyFiniteVal) const
     throw(vpException(vpException::fatalError, "Cannot compute maximum value of an empty image"));
   }
   Type m = bitmap[0];
-  for (unsigned int i = 0; i < npixels; ++i) {
-    if (bitmap[i] > m) {
-      m = bitmap[i];
+  for (unsigned int i = 0; i < height; ++i) {
+    const Type *row = (*this)[i];
+    for (unsigned int j = 0; j < width; ++j) {
+      if (row[j] > m) {
+        m = row[j];
+      }
     }
   }
   (void)onlyFiniteVal;
@@ -376,16 +379,22 @@ template <> inline double vpImage<double>::getMaxValue(bool onlyFiniteVal) const
   }
   double m = bitmap[0];
   if (onlyFiniteVal) {
-    for (unsigned int i = 0; i < npixels; ++i) {
-      if ((bitmap[i] > m) && (vpMath::isFinite(bitmap[i]))) {
-        m = bitmap[i];
+    for (unsigned int i = 0; i < height; ++i) {
+      const double *row = (*this)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        if ((row[j] > m) && (vpMath::isFinite(row[j]))) {
+          m = row[j];
+        }
       }
     }
   }
   else {
-    for (unsigned int i = 0; i < npixels; ++i) {
-      if (bitmap[i] > m) {
-        m = bitmap[i];
+    for (unsigned int i = 0; i < height; ++i) {
+      const double *row = (*this)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        if (row[j] > m) {
+          m = row[j];
+        }
       }
     }
   }
@@ -407,16 +416,22 @@ template <> inline float vpImage<float>::getMaxValue(bool onlyFiniteVal) const
   }
   float m = bitmap[0];
   if (onlyFiniteVal) {
-    for (unsigned int i = 0; i < npixels; ++i) {
-      if ((bitmap[i] > m) && (vpMath::isFinite(bitmap[i]))) {
-        m = bitmap[i];
+    for (unsigned int i = 0; i < height; ++i) {
+      const float *row = (*this)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        if ((row[j] > m) && (vpMath::isFinite(row[j]))) {
+          m = row[j];
+        }
       }
     }
   }
   else {
-    for (unsigned int i = 0; i < npixels; ++i) {
-      if (bitmap[i] > m) {
-        m = bitmap[i];
+    for (unsigned int i = 0; i < height; ++i) {
+      const float *row = (*this)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        if (row[j] > m) {
+          m = row[j];
+        }
       }
     }
   }
@@ -436,9 +451,12 @@ template <class Type> Type vpImage<Type>::getMinValue(bool onlyFiniteVal) const
     throw(vpException(vpException::fatalError, "Cannot compute minimum value of an empty image"));
   }
   Type m = bitmap[0];
-  for (unsigned int i = 0; i < npixels; ++i) {
-    if (bitmap[i] < m) {
-      m = bitmap[i];
+  for (unsigned int i = 0; i < height; ++i) {
+    const Type *row = (*this)[i];
+    for (unsigned int j = 0; j < width; ++j) {
+      if (row[j] < m) {
+        m = row[j];
+      }
     }
   }
   (void)onlyFiniteVal;
@@ -460,16 +478,22 @@ template <> inline double vpImage<double>::getMinValue(bool onlyFiniteVal) const
   }
   double m = bitmap[0];
   if (onlyFiniteVal) {
-    for (unsigned int i = 0; i < npixels; ++i) {
-      if ((bitmap[i] < m) && (vpMath::isFinite(bitmap[i]))) {
-        m = bitmap[i];
+    for (unsigned int i = 0; i < height; ++i) {
+      const double *row = (*this)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        if ((row[j] < m) && (vpMath::isFinite(row[j]))) {
+          m = row[j];
+        }
       }
     }
   }
   else {
-    for (unsigned int i = 0; i < npixels; ++i) {
-      if (bitmap[i] < m) {
-        m = bitmap[i];
+    for (unsigned int i = 0; i < height; ++i) {
+      const double *row = (*this)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        if (row[j] < m) {
+          m = row[j];
+        }
       }
     }
   }
@@ -491,16 +515,22 @@ template <> inline float vpImage<float>::getMinValue(bool onlyFiniteVal) const
   }
   float m = bitmap[0];
   if (onlyFiniteVal) {
-    for (unsigned int i = 0; i < npixels; ++i) {
-      if ((bitmap[i] < m) && (vpMath::isFinite(bitmap[i]))) {
-        m = bitmap[i];
+    for (unsigned int i = 0; i < height; ++i) {
+      const float *row = (*this)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        if ((row[j] < m) && (vpMath::isFinite(row[j]))) {
+          m = row[j];
+        }
       }
     }
   }
   else {
-    for (unsigned int i = 0; i < npixels; ++i) {
-      if (bitmap[i] < m) {
-        m = bitmap[i];
+    for (unsigned int i = 0; i < height; ++i) {
+      const float *row = (*this)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        if (row[j] < m) {
+          m = row[j];
+        }
       }
     }
   }
@@ -525,12 +555,15 @@ template <class Type> void vpImage<Type>::getMinMaxValue(Type &min, Type &max, b
 
   min = bitmap[0];
   max = bitmap[0];
-  for (unsigned int i = 0; i < npixels; ++i) {
-    if (bitmap[i] < min) {
-      min = bitmap[i];
-    }
-    if (bitmap[i] > max) {
-      max = bitmap[i];
+  for (unsigned int i = 0; i < height; ++i) {
+    const Type *row = (*this)[i];
+    for (unsigned int j = 0; j < width; ++j) {
+      if (row[j] < min) {
+        min = row[j];
+      }
+      if (row[j] > max) {
+        max = row[j];
+      }
     }
   }
   (void)onlyFiniteVal;
@@ -556,24 +589,30 @@ template <> inline void vpImage<double>::getMinMaxValue(double &min, double &max
   min = bitmap[0];
   max = bitmap[0];
   if (onlyFiniteVal) {
-    for (unsigned int i = 0; i < npixels; ++i) {
-      if (vpMath::isFinite(bitmap[i])) {
-        if (bitmap[i] < min) {
-          min = bitmap[i];
-        }
-        if (bitmap[i] > max) {
-          max = bitmap[i];
+    for (unsigned int i = 0; i < height; ++i) {
+      const double *row = (*this)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        if (vpMath::isFinite(row[j])) {
+          if (row[j] < min) {
+            min = row[j];
+          }
+          if (row[j] > max) {
+            max = row[j];
+          }
         }
       }
     }
   }
   else {
-    for (unsigned int i = 0; i < npixels; ++i) {
-      if (bitmap[i] < min) {
-        min = bitmap[i];
-      }
-      if (bitmap[i] > max) {
-        max = bitmap[i];
+    for (unsigned int i = 0; i < height; ++i) {
+      const double *row = (*this)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        if (row[j] < min) {
+          min = row[j];
+        }
+        if (row[j] > max) {
+          max = row[j];
+        }
       }
     }
   }
@@ -599,24 +638,30 @@ template <> inline void vpImage<float>::getMinMaxValue(float &min, float &max, b
   min = bitmap[0];
   max = bitmap[0];
   if (onlyFiniteVal) {
-    for (unsigned int i = 0; i < npixels; ++i) {
-      if (vpMath::isFinite(bitmap[i])) {
-        if (bitmap[i] < min) {
-          min = bitmap[i];
-        }
-        if (bitmap[i] > max) {
-          max = bitmap[i];
+    for (unsigned int i = 0; i < height; ++i) {
+      const float *row = (*this)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        if (vpMath::isFinite(row[j])) {
+          if (row[j] < min) {
+            min = row[j];
+          }
+          if (row[j] > max) {
+            max = row[j];
+          }
         }
       }
     }
   }
   else {
-    for (unsigned int i = 0; i < npixels; ++i) {
-      if (bitmap[i] < min) {
-        min = bitmap[i];
-      }
-      if (bitmap[i] > max) {
-        max = bitmap[i];
+    for (unsigned int i = 0; i < height; ++i) {
+      const float *row = (*this)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        if (row[j] < min) {
+          min = row[j];
+        }
+        if (row[j] > max) {
+          max = row[j];
+        }
       }
     }
   }
@@ -642,54 +687,60 @@ template <> inline void vpImage<vpRGBf>::getMinMaxValue(vpRGBf &min, vpRGBf &max
   min = bitmap[0];
   max = bitmap[0];
   if (onlyFiniteVal) {
-    for (unsigned int i = 0; i < npixels; ++i) {
-      if (vpMath::isFinite(bitmap[i].R)) {
-        if (bitmap[i].R < min.R) {
-          min.R = bitmap[i].R;
+    for (unsigned int i = 0; i < height; ++i) {
+      const vpRGBf *row = (*this)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        if (vpMath::isFinite(row[j].R)) {
+          if (row[j].R < min.R) {
+            min.R = row[j].R;
+          }
+          if (row[j].R > max.R) {
+            max.R = row[j].R;
+          }
         }
-        if (bitmap[i].R > max.R) {
-          max.R = bitmap[i].R;
+        if (vpMath::isFinite(row[j].G)) {
+          if (row[j].G < min.G) {
+            min.G = row[j].G;
+          }
+          if (row[j].G > max.G) {
+            max.G = row[j].G;
+          }
         }
-      }
-      if (vpMath::isFinite(bitmap[i].G)) {
-        if (bitmap[i].G < min.G) {
-          min.G = bitmap[i].G;
-        }
-        if (bitmap[i].G > max.G) {
-          max.G = bitmap[i].G;
-        }
-      }
-      if (vpMath::isFinite(bitmap[i].B)) {
-        if (bitmap[i].B < min.B) {
-          min.B = bitmap[i].B;
-        }
-        if (bitmap[i].B > max.B) {
-          max.B = bitmap[i].B;
+        if (vpMath::isFinite(row[j].B)) {
+          if (row[j].B < min.B) {
+            min.B = row[j].B;
+          }
+          if (row[j].B > max.B) {
+            max.B = row[j].B;
+          }
         }
       }
     }
   }
   else {
-    for (unsigned int i = 0; i < npixels; ++i) {
-      if (bitmap[i].R < min.R) {
-        min.R = bitmap[i].R;
-      }
-      if (bitmap[i].R > max.R) {
-        max.R = bitmap[i].R;
-      }
+    for (unsigned int i = 0; i < height; ++i) {
+      const vpRGBf *row = (*this)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        if (row[j].R < min.R) {
+          min.R = row[j].R;
+        }
+        if (row[j].R > max.R) {
+          max.R = row[j].R;
+        }
 
-      if (bitmap[i].G < min.G) {
-        min.G = bitmap[i].G;
-      }
-      if (bitmap[i].G > max.G) {
-        max.G = bitmap[i].G;
-      }
+        if (row[j].G < min.G) {
+          min.G = row[j].G;
+        }
+        if (row[j].G > max.G) {
+          max.G = row[j].G;
+        }
 
-      if (bitmap[i].B < min.B) {
-        min.B = bitmap[i].B;
-      }
-      if (bitmap[i].B > max.B) {
-        max.B = bitmap[i].B;
+        if (row[j].B < min.B) {
+          min.B = row[j].B;
+        }
+        if (row[j].B > max.B) {
+          max.B = row[j].B;
+        }
       }
     }
   }
@@ -728,13 +779,13 @@ void vpImage<Type>::getMinMaxLoc(vpImagePoint *minLoc, vpImagePoint *maxLoc, Typ
   vpImagePoint minLoc_, maxLoc_;
   for (unsigned int i = 0; i < height; ++i) {
     for (unsigned int j = 0; j < width; ++j) {
-      if (row[i][j] < min) {
-        min = row[i][j];
+      if ((*this)[i][j] < min) {
+        min = (*this)[i][j];
         minLoc_.set_ij(i, j);
       }
 
-      if (row[i][j] > max) {
-        max = row[i][j];
+      if ((*this)[i][j] > max) {
+        max = (*this)[i][j];
         maxLoc_.set_ij(i, j);
       }
     }
@@ -879,16 +930,23 @@ template <class Type> double vpImage<Type>::getStdev(const double &mean, const v
     if ((p_mask->getWidth() != width) || (p_mask->getHeight() != height)) {
       throw(vpException(vpException::fatalError, "Cannot compute standard deviation: image and mask size differ"));
     }
-    for (unsigned int i = 0; i < size; ++i) {
-      if (p_mask->bitmap[i]) {
-        sum += (bitmap[i] - mean) * (bitmap[i] - mean);
-        ++nbPointsInMask;
+    for (unsigned int i = 0; i < height; ++i) {
+      const Type *row = (*this)[i];
+      const bool *maskRow = (*p_mask)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        if (maskRow[j]) {
+          sum += (row[j] - mean) * (row[j] - mean);
+          ++nbPointsInMask;
+        }
       }
     }
   }
   else {
-    for (unsigned int i = 0; i < size; ++i) {
-      sum += (bitmap[i] - mean) * (bitmap[i] - mean);
+    for (unsigned int i = 0; i < height; ++i) {
+      const Type *row = (*this)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        sum += (row[j] - mean) * (row[j] - mean);
+      }
     }
     nbPointsInMask = size;
   }
@@ -931,18 +989,25 @@ template <> inline double vpImage<vpRGBa>::getStdev(const double &mean, const vp
     if ((p_mask->getWidth() != width) || (p_mask->getHeight() != height)) {
       throw(vpException(vpException::fatalError, "Cannot compute standard deviation: image and mask size differ"));
     }
-    for (unsigned int i = 0; i < size; ++i) {
-      if (p_mask->bitmap[i]) {
-        double val = static_cast<double>(bitmap[i].R) + static_cast<double>(bitmap[i].G) + static_cast<double>(bitmap[i].B);
-        sum += (val - mean) * (val - mean);
-        ++nbPointsInMask;
+    for (unsigned int i = 0; i < height; ++i) {
+      const vpRGBa *row = (*this)[i];
+      const bool *maskRow = (*p_mask)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        if (maskRow[j]) {
+          double val = static_cast<double>(row[j].R) + static_cast<double>(row[j].G) + static_cast<double>(row[j].B);
+          sum += (val - mean) * (val - mean);
+          ++nbPointsInMask;
+        }
       }
     }
   }
   else {
-    for (unsigned int i = 0; i < size; ++i) {
-      double val = static_cast<double>(bitmap[i].R) + static_cast<double>(bitmap[i].G) + static_cast<double>(bitmap[i].B);
-      sum += (val - mean) * (val - mean);
+    for (unsigned int i = 0; i < height; ++i) {
+      const vpRGBa *row = (*this)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        double val = static_cast<double>(row[j].R) + static_cast<double>(row[j].G) + static_cast<double>(row[j].B);
+        sum += (val - mean) * (val - mean);
+      }
     }
     nbPointsInMask = size;
   }
@@ -984,18 +1049,25 @@ template <> inline double vpImage<vpRGBf>::getStdev(const double &mean, const vp
     if ((p_mask->getWidth() != width) || (p_mask->getHeight() != height)) {
       throw(vpException(vpException::fatalError, "Cannot compute standard deviation: image and mask size differ"));
     }
-    for (unsigned int i = 0; i < size; ++i) {
-      if (p_mask->bitmap[i]) {
-        double val = static_cast<double>(bitmap[i].R) + static_cast<double>(bitmap[i].G) + static_cast<double>(bitmap[i].B);
-        sum += (val - mean) * (val - mean);
-        ++nbPointsInMask;
+    for (unsigned int i = 0; i < height; ++i) {
+      const vpRGBf *row = (*this)[i];
+      const bool *maskRow = (*p_mask)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        if (maskRow[j]) {
+          double val = static_cast<double>(row[j].R) + static_cast<double>(row[j].G) + static_cast<double>(row[j].B);
+          sum += (val - mean) * (val - mean);
+          ++nbPointsInMask;
+        }
       }
     }
   }
   else {
-    for (unsigned int i = 0; i < size; ++i) {
-      double val = static_cast<double>(bitmap[i].R) + static_cast<double>(bitmap[i].G) + static_cast<double>(bitmap[i].B);
-      sum += (val - mean) * (val - mean);
+    for (unsigned int i = 0; i < height; ++i) {
+      const vpRGBf *row = (*this)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        double val = static_cast<double>(row[j].R) + static_cast<double>(row[j].G) + static_cast<double>(row[j].B);
+        sum += (val - mean) * (val - mean);
+      }
     }
     nbPointsInMask = size;
   }
@@ -1035,16 +1107,23 @@ template <class Type> inline double vpImage<Type>::getSum(const vpImage<bool> *p
   unsigned int nbPointsInMask = 0;
   unsigned int size = height * width;
   if (p_mask) {
-    for (unsigned int i = 0; i < size; ++i) {
-      if (p_mask->bitmap[i]) {
-        res += static_cast<double>(bitmap[i]);
-        ++nbPointsInMask;
+    for (unsigned int i = 0; i < height; ++i) {
+      const Type *row = (*this)[i];
+      const bool *maskRow = (*p_mask)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        if (maskRow[j]) {
+          res += static_cast<double>(row[j]);
+          ++nbPointsInMask;
+        }
       }
     }
   }
   else {
-    for (unsigned int i = 0; i < size; ++i) {
-      res += static_cast<double>(bitmap[i]);
+    for (unsigned int i = 0; i < height; ++i) {
+      const Type *row = (*this)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        res += static_cast<double>(row[j]);
+      }
     }
     nbPointsInMask = size;
   }
@@ -1080,16 +1159,23 @@ template <> inline double vpImage<vpRGBa>::getSum(const vpImage<bool> *p_mask, u
     if ((p_mask->getWidth() != width) || (p_mask->getHeight() != height)) {
       throw(vpException(vpException::fatalError, "Cannot compute sum: image and mask size differ"));
     }
-    for (unsigned int i = 0; i < size; ++i) {
-      if (p_mask->bitmap[i]) {
-        res += static_cast<double>(bitmap[i].R) + static_cast<double>(bitmap[i].G) + static_cast<double>(bitmap[i].B);
-        ++nbPointsInMask;
+    for (unsigned int i = 0; i < height; ++i) {
+      const vpRGBa *row = (*this)[i];
+      const bool *maskRow = (*p_mask)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        if (maskRow[j]) {
+          res += static_cast<double>(row[j].R) + static_cast<double>(row[j].G) + static_cast<double>(row[j].B);
+          ++nbPointsInMask;
+        }
       }
     }
   }
   else {
-    for (unsigned int i = 0; i < (height * width); ++i) {
-      res += static_cast<double>(bitmap[i].R) + static_cast<double>(bitmap[i].G) + static_cast<double>(bitmap[i].B);
+    for (unsigned int i = 0; i < height; ++i) {
+      const vpRGBa *row = (*this)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        res += static_cast<double>(row[j].R) + static_cast<double>(row[j].G) + static_cast<double>(row[j].B);
+      }
     }
     nbPointsInMask = size;
   }
@@ -1123,16 +1209,23 @@ template <> inline double vpImage<vpRGBf>::getSum(const vpImage<bool> *p_mask, u
     if ((p_mask->getWidth() != width) || (p_mask->getHeight() != height)) {
       throw(vpException(vpException::fatalError, "Cannot compute sum: image and mask size differ"));
     }
-    for (unsigned int i = 0; i < size; ++i) {
-      if (p_mask->bitmap[i]) {
-        res += static_cast<double>(bitmap[i].R) + static_cast<double>(bitmap[i].G) + static_cast<double>(bitmap[i].B);
-        ++nbPointsInMask;
+    for (unsigned int i = 0; i < height; ++i) {
+      const vpRGBf *row = (*this)[i];
+      const bool *maskRow = (*p_mask)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        if (maskRow[j]) {
+          res += static_cast<double>(row[j].R) + static_cast<double>(row[j].G) + static_cast<double>(row[j].B);
+          ++nbPointsInMask;
+        }
       }
     }
   }
   else {
-    for (unsigned int i = 0; i < (height * width); ++i) {
-      res += static_cast<double>(bitmap[i].R) + static_cast<double>(bitmap[i].G) + static_cast<double>(bitmap[i].B);
+    for (unsigned int i = 0; i < height; ++i) {
+      const vpRGBf *row = (*this)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        res += static_cast<double>(row[j].R) + static_cast<double>(row[j].G) + static_cast<double>(row[j].B);
+      }
     }
     nbPointsInMask = size;
   }
@@ -186,6 +186,17 @@ template <class Type> void vpImage<Type>::performLut(const Type(&)[256], unsigne
 */
 template <> inline void vpImage<unsigned char>::performLut(const unsigned char(&lut)[256], unsigned int nbThreads)
 {
+  if (!isContiguous()) {
+    // Padded rows or view: single thread, row by row
+    for (unsigned int i = 0; i < height; ++i) {
+      unsigned char *ptrRow = (*this)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        ptrRow[j] = lut[ptrRow[j]];
+      }
+    }
+    return;
+  }
+
   unsigned int size = getWidth() * getHeight();
   unsigned char *ptrStart = static_cast<unsigned char *>(bitmap);
   unsigned char *ptrEnd = ptrStart + size;
@@ -265,6 +276,20 @@ template <> inline void vpImage<unsigned char>::performLut(const unsigned char(&
   */
 template <> inline void vpImage<vpRGBa>::performLut(const vpRGBa(&lut)[256], unsigned int nbThreads)
 {
+  if (!isContiguous()) {
+    // Padded rows or view: single thread, row by row
+    for (unsigned int i = 0; i < height; ++i) {
+      vpRGBa *ptrRow = (*this)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        ptrRow[j].R = lut[ptrRow[j].R].R;
+        ptrRow[j].G = lut[ptrRow[j].G].G;
+        ptrRow[j].B = lut[ptrRow[j].B].B;
+        ptrRow[j].A = lut[ptrRow[j].A].A;
+      }
+    }
+    return;
+  }
+
   unsigned int size = getWidth() * getHeight();
   unsigned char *ptrStart = reinterpret_cast<unsigned char *>(bitmap);
   unsigned char *ptrEnd = ptrStart + (size * 4);
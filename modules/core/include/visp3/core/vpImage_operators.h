@@ -249,7 +249,14 @@ template <class Type> vpImage<Type> &vpImage<Type>::operator=(const vpImage<Type
     }
   }
   resize(other.height, other.width);
-  memcpy(static_cast<void *>(bitmap), static_cast<void *>(other.bitmap), other.npixels * sizeof(Type));
+  if (isContiguous() && other.isContiguous()) {
+    memcpy(static_cast<void *>(bitmap), static_cast<void *>(other.bitmap), other.npixels * sizeof(Type));
+  }
+  else {
+    for (unsigned int i = 0; i < height; ++i) {
+      memcpy(static_cast<void *>((*this)[i]), static_cast<const void *>(other[i]), width * sizeof(Type));
+    }
+  }
 
   return *this;
 }
@@ -265,13 +272,10 @@ template <class Type> vpImage<Type> &vpImage<Type>::operator=(const vpImage<Type
  */
 template <class Type> vpImage<Type> &vpImage<Type>::operator=(vpImage<Type> &&other)
 {
-  if (row != nullptr) {
-    delete[] row;
-  }
-  row = other.row;
-  if (bitmap != nullptr && hasOwnership) {
-    delete[] bitmap;
+  if (allocatedBitmap != nullptr && hasOwnership) {
+    delete[] allocatedBitmap;
   }
+  allocatedBitmap = other.allocatedBitmap;
   bitmap = other.bitmap;
 
   if (display != nullptr) {
@@ -287,6 +291,7 @@ template <class Type> vpImage<Type> &vpImage<Type>::operator=(vpImage<Type> &&ot
   height = other.height;
   width = other.width;
   npixels = other.npixels;
+  stride = other.stride;
   hasOwnership = other.hasOwnership;
 
   other.bitmap = nullptr;
@@ -294,7 +299,8 @@ template <class Type> vpImage<Type> &vpImage<Type>::operator=(vpImage<Type> &&ot
   other.npixels = 0;
   other.width = 0;
   other.height = 0;
-  other.row = nullptr;
+  other.stride = 0;
+  other.allocatedBitmap = nullptr;
   other.hasOwnership = false;
 
   return *this;
@@ -309,8 +315,18 @@ template <class Type> vpImage<Type> &vpImage<Type>::operator=(vpImage<Type> &&ot
 */
 template <class Type> vpImage<Type> &vpImage<Type>::operator=(const Type &v)
 {
-  for (unsigned int i = 0; i < npixels; ++i) {
-    bitmap[i] = v;
+  if (isContiguous()) {
+    for (unsigned int i = 0; i < npixels; ++i) {
+      bitmap[i] = v;
+    }
+  }
+  else {
+    for (unsigned int i = 0; i < height; ++i) {
+      Type *p = (*this)[i];
+      for (unsigned int j = 0; j < width; ++j) {
+        p[j] = v;
+      }
+    }
   }
 
   return *this;
@@ -334,13 +350,15 @@ template <class Type> bool vpImage<Type>::operator==(const vpImage<Type> &I) con
   //  printf("wxh: %dx%d bitmap: %p I.bitmap %p\n", width, height, bitmap,
   //  I.bitmap);
   */
-  for (unsigned int i = 0; i < npixels; ++i) {
-    if (vp_internal::is_not_equal(bitmap[i], I.bitmap[i])) {
-      /*
-      //      std::cout << "differ for pixel " << i << " (" << i%this->height
-      //      << ", " << i - i%this->height << ")" << std::endl;
-      */
-      return false;
+  for (unsigned int i = 0; i < height; ++i) {
+    const Type *p = (*this)[i], *q = I[i];
+    for (unsigned int j = 0; j < width; ++j) {
+      if (vp_internal::is_not_equal(p[j], q[j])) {
+        /*
+        //      std::cout << "differ for pixel (" << i << ", " << j << ")" << std::endl;
+        */
+        return false;
+      }
     }
   }
   return true;
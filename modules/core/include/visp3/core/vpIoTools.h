@@ -47,17 +47,27 @@
 #include <stdlib.h>
 #include <string>
 #include <vector>
+#include <functional>
 #include <numeric>
 #include <visp3/core/vpColor.h>
 #include <visp3/core/vpEndian.h>
+#include <visp3/core/vpException.h>
 
 #include <memory>
 #include <map>
+#include <set>
 #include <cassert>
 #include <complex>
+#include <type_traits>
+#include <typeinfo>
 
 #if VISP_CXX_STANDARD > VISP_CXX_STANDARD_98
 
+BEGIN_VISP_NAMESPACE
+template <class Type> class vpImage;
+class vpMatrix;
+END_VISP_NAMESPACE
+
 namespace visp
 {
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -116,18 +126,36 @@ struct NpyArray
         new std::vector<char>(num_vals * word_size));
   }
 
+  NpyArray(const std::vector<size_t> &_shape, size_t _word_size, bool _fortran_order, char _data_type,
+           const std::shared_ptr<char> &_mapped_data) :
+    mapped_data(_mapped_data), shape(_shape), word_size(_word_size), fortran_order(_fortran_order),
+    data_type(_data_type)
+  {
+    num_vals = 1;
+    for (size_t i = 0; i < shape.size(); ++i) num_vals *= shape[i];
+  }
+
   NpyArray() : shape(0), word_size(0), fortran_order(0), num_vals(0), data_type(0) {}
 
   template<typename T>
   T *data()
   {
-    return reinterpret_cast<T *>(&(*data_holder)[0]);
+    return reinterpret_cast<T *>(mapped_data ? mapped_data.get() : &(*data_holder)[0]);
   }
 
   template<typename T>
   const T *data() const
   {
-    return reinterpret_cast<T *>(&(*data_holder)[0]);
+    return reinterpret_cast<T *>(mapped_data ? mapped_data.get() : &(*data_holder)[0]);
+  }
+
+  /*!
+    Return true when the data are not owned by the array but point into a memory-mapped file,
+    see npy_mmap() and npz_mmap().
+   */
+  bool is_mapped() const
+  {
+    return mapped_data != nullptr;
   }
 
   template<typename T>
@@ -158,11 +186,11 @@ struct NpyArray
       std::string str;
 
       for (size_t idx = i*word_size; idx < (i+1)*word_size; idx += 4) {
-        if ((*data_holder)[idx] == 0) {
+        if (data<char>()[idx] == 0) {
           // \0 char
           break;
         }
-        str += (*data_holder)[idx];
+        str += data<char>()[idx];
       }
 
       vec_string.push_back(str);
@@ -173,10 +201,12 @@ struct NpyArray
 
   size_t num_bytes() const
   {
-    return data_holder->size();
+    return mapped_data ? num_vals * word_size : data_holder->size();
   }
 
   std::shared_ptr<std::vector<char> > data_holder;
+  //! Data of a memory-mapped array, which also keeps the mapping alive. Null when data_holder owns the data.
+  std::shared_ptr<char> mapped_data;
   std::vector<size_t> shape;
   size_t word_size;
   bool fortran_order;
@@ -201,6 +231,10 @@ VISP_EXPORT void parse_zip_footer(FILE *fp, uint16_t &nrecs, size_t &global_head
 VISP_EXPORT npz_t npz_load(const std::string &fname);
 VISP_EXPORT NpyArray npz_load(const std::string &fname, const std::string &varname);
 VISP_EXPORT NpyArray npy_load(const std::string &fname);
+VISP_EXPORT npz_t npz_mmap(const std::string &fname);
+VISP_EXPORT NpyArray npz_mmap(const std::string &fname, const std::string &varname);
+VISP_EXPORT NpyArray npy_mmap(const std::string &fname);
+VISP_EXPORT void npy_view(NpyArray &arr, vpMatrix &M);
 // Dedicated functions for saving std::string data
 VISP_EXPORT void npz_save_str(const std::string &zipname, std::string fname, const std::vector<std::string> &data_vec,
   const std::vector<size_t> &shape, const std::string &mode = "w", bool compress_data = false);
@@ -375,6 +409,27 @@ template<typename T> void npz_save(const std::string &zipname, std::string fname
     compression_method = 0; // store
   }
 
+  // Pad the extra field of stored arrays so that their data are aligned in the file, and thus in memory when the
+  // file is mapped with npz_mmap(). The padding follows the zipalign extra field layout (id 0xD935).
+  std::vector<char> extra_field;
+  if (compression_method == 0) {
+    const size_t alignment = 64;
+    const size_t data_offset = global_header_offset + 30 + fname.size() + npy_header.size();
+    if ((data_offset % alignment) != 0) {
+      const size_t padding = (alignment - ((data_offset + 6) % alignment)) % alignment;
+#ifdef VISP_BIG_ENDIAN
+      extra_field += vpEndian::swap16bits(static_cast<uint16_t>(0xD935)); //zipalign extra field id
+      extra_field += vpEndian::swap16bits(static_cast<uint16_t>(2 + padding)); //extra field data size
+      extra_field += vpEndian::swap16bits(static_cast<uint16_t>(alignment)); //alignment
+#else
+      extra_field += static_cast<uint16_t>(0xD935); //zipalign extra field id
+      extra_field += static_cast<uint16_t>(2 + padding); //extra field data size
+      extra_field += static_cast<uint16_t>(alignment); //alignment
+#endif
+      extra_field.insert(extra_field.end(), padding, 0);
+    }
+  }
+
   //build the local header
   std::vector<char> local_header;
   local_header += "PK"; //first part of sig
@@ -389,7 +444,7 @@ template<typename T> void npz_save(const std::string &zipname, std::string fname
   local_header += vpEndian::swap32bits(static_cast<uint32_t>(nbytes_on_disk)); //compressed size
   local_header += vpEndian::swap32bits(static_cast<uint32_t>(nbytes_uncompressed)); //uncompressed size
   local_header += vpEndian::swap16bits(static_cast<uint16_t>(fname.size())); //fname length
-  local_header += vpEndian::swap16bits(static_cast<uint16_t>(0)); //extra field length
+  local_header += vpEndian::swap16bits(static_cast<uint16_t>(extra_field.size())); //extra field length
 #else
   local_header += static_cast<uint16_t>(0x0403); //second part of sig
   local_header += static_cast<uint16_t>(20); //min version to extract
@@ -401,16 +456,18 @@ template<typename T> void npz_save(const std::string &zipname, std::string fname
   local_header += static_cast<uint32_t>(nbytes_on_disk); //compressed size
   local_header += static_cast<uint32_t>(nbytes_uncompressed); //uncompressed size
   local_header += static_cast<uint16_t>(fname.size()); //fname length
-  local_header += static_cast<uint16_t>(0); //extra field length
+  local_header += static_cast<uint16_t>(extra_field.size()); //extra field length
 #endif
   local_header += fname;
+  local_header.insert(local_header.end(), extra_field.begin(), extra_field.end());
 
   //build global header
   global_header += "PK"; //first part of sig
 #ifdef VISP_BIG_ENDIAN
   global_header += vpEndian::swap16bits(static_cast<uint16_t>(0x0201)); //second part of sig
   global_header += vpEndian::swap16bits(static_cast<uint16_t>(20)); //version made by
-  global_header.insert(global_header.end(), local_header.begin()+4, local_header.begin()+30);
+  global_header.insert(global_header.end(), local_header.begin()+4, local_header.begin()+28);
+  global_header += static_cast<uint16_t>(0); //extra field length, the padding is only in the local header
   global_header += static_cast<uint16_t>(0); //file comment length
   global_header += static_cast<uint16_t>(0); //disk number where file starts
   global_header += static_cast<uint16_t>(0); //internal file attributes
@@ -419,7 +476,8 @@ template<typename T> void npz_save(const std::string &zipname, std::string fname
 #else
   global_header += static_cast<uint16_t>(0x0201); //second part of sig
   global_header += static_cast<uint16_t>(20); //version made by
-  global_header.insert(global_header.end(), local_header.begin()+4, local_header.begin()+30);
+  global_header.insert(global_header.end(), local_header.begin()+4, local_header.begin()+28);
+  global_header += static_cast<uint16_t>(0); //extra field length, the padding is only in the local header
   global_header += static_cast<uint16_t>(0); //file comment length
   global_header += static_cast<uint16_t>(0); //disk number where file starts
   global_header += static_cast<uint16_t>(0); //internal file attributes
@@ -503,6 +561,115 @@ template<typename T> void npz_save(const std::string &zipname, const std::string
   npz_save(zipname, fname, &data[0], shape, mode, compress_data);
 }
 
+/*!
+  \brief Writer that appends arrays to a npz file that is kept open, e.g. to record one array per frame at camera
+  rate.
+
+  Contrary to npz_save() in append mode, that reads and rewrites the central directory of the zip archive at each
+  call, the writer only writes the arrays as they are added and writes the central directory once in close(). Adding
+  an array thus does not depend on the number of arrays already in the archive. Arrays larger than 4 GB and archives
+  with more than 65535 arrays are written with the ZIP64 extensions.
+
+  When asynchronous writing is enabled, add() only copies the array in a queue and the arrays are compressed and
+  written by a background thread. Errors that occur in the background are reported by the next call to add(),
+  flush() or close().
+
+  \code
+  visp::cnpy::NpzWriter writer("recording.npz", true, true); // compressed, asynchronous
+  for (unsigned int frame = 0; frame < nbFrames; ++frame) {
+    writer.add("depth_" + std::to_string(frame), I_depth.bitmap, { I_depth.getHeight(), I_depth.getWidth() });
+    writer.add("cMo_" + std::to_string(frame), cMo.data, { 4, 4 });
+  }
+  writer.close();
+  \endcode
+
+  \note Files written without compression can be mapped with npz_mmap(), the data of the arrays being aligned.
+ */
+class VISP_EXPORT NpzWriter
+{
+public:
+  NpzWriter();
+  VP_EXPLICIT NpzWriter(const std::string &zipname, bool compress_data = false, bool asynchronous = false,
+                        const std::string &mode = "w");
+  ~NpzWriter();
+
+  void open(const std::string &zipname, bool compress_data = false, bool asynchronous = false,
+            const std::string &mode = "w");
+  void close();
+  void flush();
+
+  /*!
+    Add the array of data \p data to the archive, under the name \p fname.
+    \param[in] fname : Identifier of the array, that must not already be in the archive.
+    \param[in] data : Pointer to an array of basic datatype (int, float, double, std::complex<double>, ...).
+    \param[in] shape : Shape of the array, e.g. Nz x Ny x Nx.
+    \exception vpException::notInitialized : If the writer is not opened.
+    \exception vpException::badValue : If an array with the same name was already added.
+    \exception vpException::ioError : If the array, or a previous one, could not be written.
+   */
+  template<typename T> void add(const std::string &fname, const T *data, const std::vector<size_t> &shape)
+  {
+    const size_t nels = std::accumulate(shape.begin(), shape.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+    add_npy(fname, create_npy_header<T>(shape), reinterpret_cast<const char *>(data), nels * sizeof(T));
+  }
+
+  /*!
+    Add the 1-D array of data \p data to the archive, under the name \p fname.
+    \sa add(const std::string &, const T *, const std::vector<size_t> &)
+   */
+  template<typename T> void add(const std::string &fname, const std::vector<T> &data)
+  {
+    add(fname, data.empty() ? nullptr : &data[0], std::vector<size_t>(1, data.size()));
+  }
+
+  //! Return true if the archive is opened.
+  bool is_open() const { return m_fp != nullptr; }
+  size_t num_arrays() const;
+  size_t num_pending() const;
+  void set_max_pending(size_t max_pending);
+
+private:
+  NpzWriter(const NpzWriter &) = delete;
+  NpzWriter &operator=(const NpzWriter &) = delete;
+
+  struct Member;
+  class Worker;
+
+  void add_npy(const std::string &fname, const std::vector<char> &npy_header, const char *data, size_t nbytes);
+  void write_member(const Member &member);
+
+  FILE *m_fp;
+  bool m_compress;
+  uint64_t m_offset;                     //!< Offset of the next local header in the archive
+  std::vector<char> m_central_directory; //!< Central directory entries of the arrays written so far
+  uint64_t m_num_entries;                //!< Number of entries in the central directory
+  std::set<std::string> m_names;
+  std::shared_ptr<Worker> m_worker;
+  size_t m_max_pending;
+  std::string m_error; //!< First write error, the archive cannot be completed once an array could not be written
+};
+
+/*!
+  Make \p I a view of the 2-D (or 3-D when the last dimension holds the channels of a pixel, e.g. Height x Width x 4
+  for vpRGBa) array \p arr, without copying the data. Used with an array returned by npy_mmap() or npz_mmap(), the
+  image directly points into the memory-mapped file.
+  \param[in] arr : Array of data stored in C order, that must outlive the view.
+  \param[out] I : Image that does not own its bitmap.
+  \exception vpException::dimensionError : If the shape or the data type of the array do not match the pixel type.
+ */
+template<typename T> void npy_view(NpyArray &arr, vpImage<T> &I)
+{
+  size_t pixel_size = arr.word_size;
+  for (size_t i = 2; i < arr.shape.size(); ++i) {
+    pixel_size *= arr.shape[i];
+  }
+  if ((arr.shape.size() < 2) || arr.fortran_order || (pixel_size != sizeof(T)) ||
+      (std::is_arithmetic<T>::value && (map_type(typeid(T)) != arr.data_type))) {
+    throw vpException(vpException::dimensionError, "npy_view: the array cannot be viewed as an image of this type");
+  }
+  I.init(arr.data<T>(), static_cast<unsigned int>(arr.shape[0]), static_cast<unsigned int>(arr.shape[1]), false);
+}
+
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 template<typename T> std::vector<char> create_npy_header(const std::vector<size_t> &shape)
 {
@@ -288,6 +288,42 @@ public:
    * \sa getLapackMatrixMinSize()
    */
   static void setLapackMatrixMinSize(unsigned int min_size) { m_lapack_min_size = min_size; }
+
+  /*!
+   * Return true when the built-in cache-blocked Blas kernels are used for matrix-matrix and matrix-vector products
+   * instead of the Blas/Lapack third party. Always true when ViSP is built without Blas/Lapack third party.
+   *
+   * \sa setUseNativeBlas()
+   */
+  static bool getUseNativeBlas() { return m_native_blas; }
+
+  /*!
+   * Select the implementation used for matrix-matrix and matrix-vector products of matrices larger than
+   * getLapackMatrixMinSize().
+   *
+   * \param useNativeBlas : When true, use the built-in cache-blocked Blas kernels. When false, use the Blas/Lapack
+   * third party (MKL, OpenBLAS, Netlib, Atlas, GSL...). When ViSP is built without Blas/Lapack third party, the
+   * built-in kernels are always used and this parameter is ignored.
+   *
+   * \sa setNativeBlasNbThread()
+   */
+  static void setUseNativeBlas(bool useNativeBlas)
+  {
+#if defined(VISP_HAVE_LAPACK)
+    m_native_blas = useNativeBlas;
+#else
+    (void)useNativeBlas;
+#endif
+  }
+
+  /*!
+   * Return the number of threads used by the built-in Blas kernels.
+   *
+   * \sa setNativeBlasNbThread()
+   */
+  static int getNativeBlasNbThread() { return m_native_blas_nb_thread; }
+
+  static void setNativeBlasNbThread(int nbThread);
   //@}
 
   //-------------------------------------------------
@@ -1276,13 +1312,22 @@ public:
 private:
   static unsigned int m_lapack_min_size;
   static const unsigned int m_lapack_min_size_default;
+  static bool m_native_blas;
+  static int m_native_blas_nb_thread;
 
-#if defined(VISP_HAVE_LAPACK)
+  // Without Blas/Lapack third party, blas_dgemm() and blas_dgemv() call the built-in kernels
   static void blas_dgemm(char trans_a, char trans_b, unsigned int M_, unsigned int N_, unsigned int K_, double alpha,
                          double *a_data, unsigned int lda_, double *b_data, unsigned int ldb_, double beta,
                          double *c_data, unsigned int ldc_);
   static void blas_dgemv(char trans, unsigned int M_, unsigned int N_, double alpha, double *a_data, unsigned int lda_,
                          double *x_data, int incx_, double beta, double *y_data, int incy_);
+  static void native_dgemm(char trans_a, char trans_b, unsigned int M, unsigned int N, unsigned int K, double alpha,
+                           const double *a_data, unsigned int lda, const double *b_data, unsigned int ldb, double beta,
+                           double *c_data, unsigned int ldc);
+  static void native_dgemv(char trans, unsigned int M, unsigned int N, double alpha, const double *a_data,
+                           unsigned int lda, const double *x_data, int incx, double beta, double *y_data, int incy);
+
+#if defined(VISP_HAVE_LAPACK)
   static void blas_dsyev(char jobz, char uplo, unsigned int n_, double *a_data, unsigned int lda_, double *w_data,
                          double *work_data, int lwork_, int &info_);
 
@@ -1303,6 +1348,12 @@ private:
 #if defined(VISP_USE_MSVC) && defined(visp_EXPORTS)
 const __declspec(selectany) unsigned int vpMatrix::m_lapack_min_size_default = 0;
 __declspec(selectany) unsigned int vpMatrix::m_lapack_min_size = vpMatrix::m_lapack_min_size_default;
+#if defined(VISP_HAVE_LAPACK)
+__declspec(selectany) bool vpMatrix::m_native_blas = false;
+#else
+__declspec(selectany) bool vpMatrix::m_native_blas = true;
+#endif
+__declspec(selectany) int vpMatrix::m_native_blas_nb_thread = 1;
 #endif
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
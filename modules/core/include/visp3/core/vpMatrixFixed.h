@@ -0,0 +1,399 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Small matrices with dimensions known at compile time.
+ */
+
+/*!
+ * \file vpMatrixFixed.h
+ * \brief Small matrices with dimensions known at compile time.
+ */
+
+#ifndef VP_MATRIX_FIXED_H
+#define VP_MATRIX_FIXED_H
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <ostream>
+#include <utility>
+
+#include <visp3/core/vpConfig.h>
+#include <visp3/core/vpArray2D.h>
+#include <visp3/core/vpException.h>
+#include <visp3/core/vpMatrix.h>
+
+BEGIN_VISP_NAMESPACE
+/*!
+  \class vpMatrixFixed
+
+  \ingroup group_core_matrices
+
+  \brief Small matrix of doubles whose dimensions are known at compile time.
+
+  Contrary to vpMatrix or vpArray2D<double>, the coefficients are stored in the object itself, without any heap
+  allocation, and the dimensions are template parameters. All the loops have a fixed number of iterations and are
+  fully unrolled by the compiler. This class is intended for the 3-by-3, 4-by-4 and 6-by-6 products that are done at
+  each iteration of a pose estimation or a visual servoing loop.
+
+  The coefficients are stored row by row. A vpMatrixFixed can be built from any vpArray2D<double> of the same size,
+  like a vpMatrix, a vpRotationMatrix, a vpHomogeneousMatrix or a vpVelocityTwistMatrix, and copied back with
+  copyTo().
+
+  \code
+  #include <visp3/core/vpHomogeneousMatrix.h>
+  #include <visp3/core/vpMatrixFixed.h>
+
+  #ifdef ENABLE_VISP_NAMESPACE
+  using namespace VISP_NAMESPACE_NAME;
+  #endif
+
+  int main()
+  {
+    vpHomogeneousMatrix aMb(0.1, 0.2, 0.3, 0.1, 0.2, 0.3), bMc(0.3, 0.2, 0.1, 0.3, 0.2, 0.1);
+    vpMatrixFixed<4, 4> aMc = vpMatrixFixed<4, 4>(aMb) * vpMatrixFixed<4, 4>(bMc);
+
+    vpHomogeneousMatrix cMa;
+    aMc.inverse().copyTo(cMa);
+  }
+  \endcode
+
+  \sa vpExponentialMap::direct(const vpMatrixFixed<6, 1> &, const double &)
+*/
+template <unsigned int R, unsigned int C> class vpMatrixFixed
+{
+public:
+  //! Create a matrix with all its coefficients set to zero.
+  vpMatrixFixed()
+  {
+    for (unsigned int i = 0; i < R * C; ++i) {
+      m_data[i] = 0.;
+    }
+  }
+
+  /*!
+    Create a matrix from an array of R * C coefficients stored row by row.
+  */
+  explicit vpMatrixFixed(const double *values)
+  {
+    for (unsigned int i = 0; i < R * C; ++i) {
+      m_data[i] = values[i];
+    }
+  }
+
+  /*!
+    Create a matrix from a vpArray2D<double>, like a vpMatrix, a vpRotationMatrix or a vpHomogeneousMatrix.
+
+    \exception vpException::dimensionError When the dimensions of \e M are not R by C.
+  */
+  explicit vpMatrixFixed(const vpArray2D<double> &M)
+  {
+    if ((M.getRows() != R) || (M.getCols() != C)) {
+      throw(vpException(vpException::dimensionError, "Cannot build a (%dx%d) fixed size matrix from a (%dx%d) matrix",
+                        R, C, M.getRows(), M.getCols()));
+    }
+    const double *values = M.data;
+    for (unsigned int i = 0; i < R * C; ++i) {
+      m_data[i] = values[i];
+    }
+  }
+
+  //! Number of rows.
+  static constexpr unsigned int getRows() { return R; }
+  //! Number of columns.
+  static constexpr unsigned int getCols() { return C; }
+  //! Number of coefficients.
+  static constexpr unsigned int size() { return R * C; }
+
+  //! Pointer to the coefficients, stored row by row.
+  inline double *data() { return m_data; }
+  //! Pointer to the coefficients, stored row by row.
+  inline const double *data() const { return m_data; }
+
+  //! Pointer to the first coefficient of row \e i.
+  inline double *operator[](unsigned int i) { return m_data + (i * C); }
+  //! Pointer to the first coefficient of row \e i.
+  inline const double *operator[](unsigned int i) const { return m_data + (i * C); }
+
+  /*!
+    Copy the coefficients in a vpArray2D<double>, like a vpMatrix or a vpHomogeneousMatrix. The destination is resized
+    to R by C if needed.
+  */
+  void copyTo(vpArray2D<double> &M) const
+  {
+    if ((M.getRows() != R) || (M.getCols() != C)) {
+      M.resize(R, C, false, false);
+    }
+    double *values = M.data;
+    for (unsigned int i = 0; i < R * C; ++i) {
+      values[i] = m_data[i];
+    }
+  }
+
+  /*!
+    Return the coefficients as a vpMatrix.
+  */
+  vpMatrix toMatrix() const
+  {
+    vpMatrix M(R, C);
+    copyTo(M);
+    return M;
+  }
+
+  /*!
+    Return the identity matrix. The matrix has to be square.
+  */
+  static vpMatrixFixed eye()
+  {
+    vpMatrixFixed M;
+    for (unsigned int i = 0; (i < R) && (i < C); ++i) {
+      M.m_data[(i * C) + i] = 1.;
+    }
+    return M;
+  }
+
+  //! Product with a matrix whose number of rows is C.
+  template <unsigned int K> vpMatrixFixed<R, K> operator*(const vpMatrixFixed<C, K> &B) const
+  {
+    vpMatrixFixed<R, K> P;
+    for (unsigned int i = 0; i < R; ++i) {
+      const double *a = m_data + (i * C);
+      double *p = P[i];
+      for (unsigned int k = 0; k < C; ++k) {
+        const double aik = a[k];
+        const double *b = B[k];
+        for (unsigned int j = 0; j < K; ++j) {
+          p[j] += aik * b[j];
+        }
+      }
+    }
+    return P;
+  }
+
+  //! Sum of two matrices.
+  vpMatrixFixed operator+(const vpMatrixFixed &B) const
+  {
+    vpMatrixFixed S;
+    for (unsigned int i = 0; i < R * C; ++i) {
+      S.m_data[i] = m_data[i] + B.m_data[i];
+    }
+    return S;
+  }
+
+  //! Difference of two matrices.
+  vpMatrixFixed operator-(const vpMatrixFixed &B) const
+  {
+    vpMatrixFixed S;
+    for (unsigned int i = 0; i < R * C; ++i) {
+      S.m_data[i] = m_data[i] - B.m_data[i];
+    }
+    return S;
+  }
+
+  //! Product of all the coefficients by a scalar.
+  vpMatrixFixed operator*(double x) const
+  {
+    vpMatrixFixed S;
+    for (unsigned int i = 0; i < R * C; ++i) {
+      S.m_data[i] = m_data[i] * x;
+    }
+    return S;
+  }
+
+  //! Add a matrix to this one.
+  vpMatrixFixed &operator+=(const vpMatrixFixed &B)
+  {
+    for (unsigned int i = 0; i < R * C; ++i) {
+      m_data[i] += B.m_data[i];
+    }
+    return *this;
+  }
+
+  //! Test if all the coefficients are equal.
+  bool operator==(const vpMatrixFixed &B) const
+  {
+    for (unsigned int i = 0; i < R * C; ++i) {
+      if (m_data[i] != B.m_data[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  //! Test if at least one coefficient differs.
+  bool operator!=(const vpMatrixFixed &B) const { return !(*this == B); }
+
+  //! Transpose of the matrix.
+  vpMatrixFixed<C, R> t() const
+  {
+    vpMatrixFixed<C, R> At;
+    for (unsigned int i = 0; i < R; ++i) {
+      for (unsigned int j = 0; j < C; ++j) {
+        At[j][i] = m_data[(i * C) + j];
+      }
+    }
+    return At;
+  }
+
+  /*!
+    Inverse of a square matrix, computed by a Gauss-Jordan elimination with partial pivoting.
+
+    A pivot is considered as null when it is lower than the largest absolute coefficient of the matrix times
+    C times the machine epsilon, so that the test does not depend on the scale of the matrix.
+
+    \exception vpException::fatalError When the matrix is singular.
+  */
+  vpMatrixFixed inverse() const
+  {
+    static_assert(R == C, "Only square matrices can be inverted");
+    double scale = 0.;
+    for (unsigned int i = 0; i < (R * C); ++i) {
+      scale = std::max<double>(scale, std::fabs(m_data[i]));
+    }
+    const double threshold = scale * C * std::numeric_limits<double>::epsilon();
+    vpMatrixFixed A(*this);
+    vpMatrixFixed Ai = eye();
+    for (unsigned int c = 0; c < C; ++c) {
+      unsigned int pivot = c;
+      double pivotAbs = std::fabs(A[c][c]);
+      for (unsigned int i = c + 1; i < R; ++i) {
+        if (std::fabs(A[i][c]) > pivotAbs) {
+          pivotAbs = std::fabs(A[i][c]);
+          pivot = i;
+        }
+      }
+      if (pivotAbs <= threshold) {
+        throw(vpException(vpException::fatalError, "Cannot inverse a singular (%dx%d) fixed size matrix", R, C));
+      }
+      if (pivot != c) {
+        for (unsigned int j = 0; j < C; ++j) {
+          std::swap(A[pivot][j], A[c][j]);
+          std::swap(Ai[pivot][j], Ai[c][j]);
+        }
+      }
+      const double invPivot = 1. / A[c][c];
+      for (unsigned int j = 0; j < C; ++j) {
+        A[c][j] *= invPivot;
+        Ai[c][j] *= invPivot;
+      }
+      for (unsigned int i = 0; i < R; ++i) {
+        if (i != c) {
+          const double f = A[i][c];
+          for (unsigned int j = 0; j < C; ++j) {
+            A[i][j] -= f * A[c][j];
+            Ai[i][j] -= f * Ai[c][j];
+          }
+        }
+      }
+    }
+    return Ai;
+  }
+
+  /*!
+    Inverse of a rigid transformation stored in a 4-by-4 matrix:
+    \f[\left[\begin{array}{cc}
+    {\bf R} & {\bf t} \\
+    {\bf 0}_{1\times 3} & 1
+    \end{array}
+    \right]^{-1} = \left[\begin{array}{cc}
+    {\bf R}^T & -{\bf R}^T {\bf t} \\
+    {\bf 0}_{1\times 3} & 1
+    \end{array}
+    \right]\f]
+    The last row is not read.
+  */
+  vpMatrixFixed inverseRigid() const
+  {
+    static_assert((R == 4) && (C == 4), "A rigid transformation is a 4-by-4 matrix");
+    vpMatrixFixed Mi;
+    for (unsigned int i = 0; i < 3; ++i) {
+      for (unsigned int j = 0; j < 3; ++j) {
+        Mi.m_data[(i * 4) + j] = m_data[(j * 4) + i];
+      }
+      Mi.m_data[(i * 4) + 3] =
+        -((m_data[i] * m_data[3]) + (m_data[4 + i] * m_data[7]) + (m_data[8 + i] * m_data[11]));
+    }
+    Mi.m_data[15] = 1.;
+    return Mi;
+  }
+
+  /*!
+    Product of two rigid transformations stored in 4-by-4 matrices. The last row of both matrices is assumed to be
+    [0 0 0 1] and is not read.
+  */
+  vpMatrixFixed composeRigid(const vpMatrixFixed &M) const
+  {
+    static_assert((R == 4) && (C == 4), "A rigid transformation is a 4-by-4 matrix");
+    vpMatrixFixed P;
+    const double *b = M.m_data;
+    for (unsigned int i = 0; i < 3; ++i) {
+      const double *a = m_data + (i * 4);
+      double *p = P.m_data + (i * 4);
+      for (unsigned int j = 0; j < 4; ++j) {
+        p[j] = (a[0] * b[j]) + (a[1] * b[4 + j]) + (a[2] * b[8 + j]);
+      }
+      p[3] += a[3];
+    }
+    P.m_data[15] = 1.;
+    return P;
+  }
+
+  /*!
+    Print the coefficients, row by row.
+  */
+  friend std::ostream &operator<<(std::ostream &os, const vpMatrixFixed &M)
+  {
+    for (unsigned int i = 0; i < R; ++i) {
+      for (unsigned int j = 0; j < C; ++j) {
+        os << M[i][j];
+        if (j < (C - 1)) {
+          os << "  ";
+        }
+      }
+      if (i < (R - 1)) {
+        os << std::endl;
+      }
+    }
+    return os;
+  }
+
+private:
+  double m_data[R * C];
+};
+
+/*!
+  Product of all the coefficients of a fixed size matrix by a scalar.
+*/
+template <unsigned int R, unsigned int C> vpMatrixFixed<R, C> operator*(double x, const vpMatrixFixed<R, C> &M)
+{
+  return M * x;
+}
+END_VISP_NAMESPACE
+#endif
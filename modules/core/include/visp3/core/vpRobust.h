@@ -38,6 +38,8 @@
 #ifndef VP_ROBUST_H
 #define VP_ROBUST_H
 
+#include <vector>
+
 #include <visp3/core/vpConfig.h>
 #include <visp3/core/vpColVector.h>
 #include <visp3/core/vpMath.h>
@@ -79,6 +81,10 @@ BEGIN_VISP_NAMESPACE
 
   Given the influence function and the residual vector, the weights are updated in MEstimator().
 
+  The median and the MAD are computed exactly with a linear time selection algorithm. For very large residual
+  vectors, such as the ones produced by dense depth features, an approximation of both values computed from
+  histograms of the residues can be enabled with setMedianApproximationThreshold().
+
 */
 class VISP_EXPORT vpRobust
 {
@@ -117,6 +123,14 @@ public:
    */
   double getMinMedianAbsoluteDeviation() { return m_mad_min; }
 
+  /*!
+   * Return the minimal number of residues from which the median and the MAD are approximated.
+   * A value of 0 means that they are always computed exactly.
+   *
+   * \sa setMedianApproximationThreshold()
+   */
+  unsigned int getMedianApproximationThreshold() const { return m_approx_median_threshold; }
+
   void MEstimator(const vpRobustEstimatorType method, const vpColVector &residues, vpColVector &weights);
 
   vpRobust &operator=(const vpRobust &other);
@@ -135,6 +149,8 @@ public:
    */
   inline void setMinMedianAbsoluteDeviation(double mad_min) { m_mad_min = mad_min; }
 
+  void setMedianApproximationThreshold(unsigned int nbResidues);
+
 #if defined(VISP_BUILD_DEPRECATED_FUNCTIONS)
   /*!
     @name Deprecated functions
@@ -181,6 +197,10 @@ private:
   unsigned int m_size;
   //! Residual vector Median Absolute Deviation
   double m_mad;
+  //! Number of residues from which the median is approximated, 0 to disable the approximation
+  unsigned int m_approx_median_threshold;
+  //! Histogram used by the approximated median
+  std::vector<unsigned int> m_histogram;
 
 private:
   //! Resize containers for sort methods
@@ -239,10 +259,10 @@ private:
 
   /** @name Sort function  */
   //@{
-  //! Sort function using partition method
-  int partition(vpColVector &a, int l, int r);
-  //! Sort the vector and select a value in the sorted vector
+  //! Partially sort the vector and select a value in the sorted vector
   double select(vpColVector &a, int l, int r, int k);
+  //! Approximate the k-th smallest value of an array from its histogram
+  double selectApprox(const double *a, unsigned int n, unsigned int k);
   //@}
 };
 END_VISP_NAMESPACE
@@ -292,7 +292,14 @@ vpImagePoint vpColorDepthConversion::projectColorToDepth(
   const vpCameraParameters &depth_intrinsics, const vpCameraParameters &color_intrinsics,
   const vpHomogeneousMatrix &color_M_depth, const vpHomogeneousMatrix &depth_M_color, const vpImagePoint &from_pixel)
 {
-  return projectColorToDepth(I_depth.bitmap, depth_scale, depth_min, depth_max, I_depth.getWidth(), I_depth.getHeight(),
+  // The raw data are walked linearly, copy views and padded images into contiguous memory
+  const vpImage<uint16_t> *p_depth = &I_depth;
+  vpImage<uint16_t> I_depth_contiguous;
+  if (!I_depth.isContiguous()) {
+    I_depth_contiguous = I_depth;
+    p_depth = &I_depth_contiguous;
+  }
+  return projectColorToDepth(p_depth->bitmap, depth_scale, depth_min, depth_max, I_depth.getWidth(), I_depth.getHeight(),
                              depth_intrinsics, color_intrinsics, color_M_depth, depth_M_color, from_pixel);
 }
 
@@ -346,7 +353,14 @@ vpImagePoint vpColorDepthConversion::projectColorToDepth(
   const vpCameraParameters &depth_intrinsics, const vpCameraParameters &color_intrinsics,
   const vpHomogeneousMatrix &color_M_depth, const vpHomogeneousMatrix &depth_M_color, const vpImagePoint &from_pixel)
 {
-  return projectColorToDepth(I_depth.bitmap, depth_min, depth_max, I_depth.getWidth(), I_depth.getHeight(),
+  // The raw data are walked linearly, copy views and padded images into contiguous memory
+  const vpImage<float> *p_depth = &I_depth;
+  vpImage<float> I_depth_contiguous;
+  if (!I_depth.isContiguous()) {
+    I_depth_contiguous = I_depth;
+    p_depth = &I_depth_contiguous;
+  }
+  return projectColorToDepth(p_depth->bitmap, depth_min, depth_max, I_depth.getWidth(), I_depth.getHeight(),
                              depth_intrinsics, color_intrinsics, color_M_depth, depth_M_color, from_pixel);
 }
 
@@ -36,10 +36,6 @@
 #include <omp.h>
 #endif
 
-#ifdef VISP_USE_MSVC
-#pragma comment(linker, "/STACK:65532000") // Increase max recursion depth
-#endif
-
 #if (VISP_CXX_STANDARD == VISP_CXX_STANDARD_98) // Check if cxx98
 namespace
 {
@@ -62,6 +58,35 @@ static void scaleFilter(
 }
 #endif
 
+#ifdef VISP_HAVE_OPENMP
+namespace
+{
+// Append the results of each thread, in the thread order
+template <typename Type>
+void concatenateThreadBuffers(const std::vector<std::vector<Type> > &threadBuffers, std::vector<Type> &buffer)
+{
+  size_t size = buffer.size();
+  for (size_t t = 0; t < threadBuffers.size(); ++t) {
+    size += threadBuffers[t].size();
+  }
+  buffer.reserve(size);
+  for (size_t t = 0; t < threadBuffers.size(); ++t) {
+    buffer.insert(buffer.end(), threadBuffers[t].begin(), threadBuffers[t].end());
+  }
+}
+
+// Get a cleared buffer for each of the threads
+template <typename Type>
+void initThreadBuffers(const int &nbThread, std::vector<std::vector<Type> > &threadBuffers)
+{
+  threadBuffers.resize(static_cast<size_t>(std::max<int>(nbThread, 1)));
+  for (size_t t = 0; t < threadBuffers.size(); ++t) {
+    threadBuffers[t].clear();
+  }
+}
+}
+#endif
+
 BEGIN_VISP_NAMESPACE
 // // Initialization methods
 
@@ -277,29 +302,6 @@ vpCannyEdgeDetection::detect(const vpImage<unsigned char> &I)
 void
 vpCannyEdgeDetection::step3to5(const unsigned int &height, const unsigned int &width, const float &lowerThreshold, const float &upperThreshold)
 {
-#if !defined(_WIN32) && (defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))) // UNIX
-  rlim_t initialStackSize = 0;
-  struct rlimit rl;
-  int result;
-  if (m_minStackSize > 0) {
-    // Check the current stack size
-    result = getrlimit(RLIMIT_STACK, &rl);
-    if (result == 0) {
-      initialStackSize = rl.rlim_cur;
-      if (rl.rlim_cur < m_minStackSize) {
-        // Increase stack size due to the recursive algorithm
-        rl.rlim_cur = m_minStackSize;
-        result = setrlimit(RLIMIT_STACK, &rl);
-        if (result != 0) {
-          throw(vpException(vpException::fatalError, "setrlimit returned result = %d\n", result));
-        }
-      }
-    }
-    else {
-      throw(vpException(vpException::fatalError, "getrlimit returned result = %d\n", result));
-    }
-  }
-#endif
   // // Clearing the previous results
   m_edgeMap.resize(height, width, 0);
   m_edgeCandidateAndGradient.clear();
@@ -317,20 +319,6 @@ vpCannyEdgeDetection::step3to5(const unsigned int &height, const unsigned int &w
 
   // // Step 5: edge tracking
   performEdgeTracking();
-
-#if !defined(_WIN32) && (defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))) // UNIX
-  if (m_minStackSize > 0) {
-    if (rl.rlim_cur > initialStackSize) {
-      // Reset stack size to its original value
-      rl.rlim_cur = initialStackSize;
-      result = setrlimit(RLIMIT_STACK, &rl);
-      if (result != 0) {
-        throw(vpException(vpException::fatalError, "setrlimit returned result = %d\n", result));
-
-      }
-    }
-  }
-#endif
 }
 
 void
@@ -338,15 +326,18 @@ vpCannyEdgeDetection::computeFilteringAndGradient(const vpImage<unsigned char> &
 {
   if ((m_filteringAndGradientType == vpImageFilter::CANNY_GBLUR_SOBEL_FILTERING)
       || (m_filteringAndGradientType == vpImageFilter::CANNY_GBLUR_SCHARR_FILTERING)) {
-    // Computing the Gaussian blur
-    vpImage<float> Iblur;
-    vpImage<float> GIx;
-    vpImageFilter::filterX<unsigned char, float>(I, GIx, m_fg.data, static_cast<unsigned int>(m_gaussianKernelSize), mp_mask);
-    vpImageFilter::filterY<float, float>(GIx, Iblur, m_fg.data, static_cast<unsigned int>(m_gaussianKernelSize), mp_mask);
+    // Computing the Gaussian blur, with temporary images drawn from the pool of the thread if any
+    vpImagePool::vpScratch<float> scratchBlur(I.getHeight(), I.getWidth());
+    vpImage<float> &Iblur = scratchBlur.get();
+    {
+      vpImagePool::vpScratch<float> scratchGIx(I.getHeight(), I.getWidth());
+      vpImageFilter::filterX<unsigned char, float>(I, scratchGIx.get(), m_fg.data, static_cast<unsigned int>(m_gaussianKernelSize), mp_mask, m_nbThread);
+      vpImageFilter::filterY<float, float>(scratchGIx.get(), Iblur, m_fg.data, static_cast<unsigned int>(m_gaussianKernelSize), mp_mask, m_nbThread);
+    }
 
     // Computing the gradients
-    vpImageFilter::filter(Iblur, m_dIx, m_gradientFilterX, true, mp_mask);
-    vpImageFilter::filter(Iblur, m_dIy, m_gradientFilterY, true, mp_mask);
+    vpImageFilter::filter(Iblur, m_dIx, m_gradientFilterX, true, mp_mask, m_nbThread);
+    vpImageFilter::filter(Iblur, m_dIy, m_gradientFilterY, true, mp_mask, m_nbThread);
   }
   else {
     std::string errmsg("Currently, the filtering operation \"");
@@ -464,25 +455,25 @@ vpCannyEdgeDetection::getGradientOrientation(const vpImage<float> &dIx, const vp
 void
 vpCannyEdgeDetection::performEdgeThinning(const float &lowerThreshold)
 {
+  const int nbRows = static_cast<int>(m_dIx.getRows());
   const int nbCols = static_cast<int>(m_dIx.getCols());
-  const int size = static_cast<int>(m_dIx.getSize());
 
-  int istart = 0, istop = size;
+  int istart = 0, istop = nbRows * nbCols;
 #ifdef VISP_HAVE_OPENMP
-  int iam, nt, ipoints, npoints(size);
-#pragma omp parallel default(shared) private(iam, nt, ipoints, istart, istop) num_threads(m_nbThread)
+  initThreadBuffers(m_nbThread, m_threadEdgeCandidateAndGradient);
+  const int nbBuffers = static_cast<int>(m_threadEdgeCandidateAndGradient.size());
+  int iam, nt;
+#pragma omp parallel default(shared) private(iam, nt, istart, istop) num_threads(nbBuffers)
   {
     iam = omp_get_thread_num();
     nt = omp_get_num_threads();
-    ipoints = npoints / nt;
-    // size of partition
-    istart = iam * ipoints; // starting array index
-    if (iam == nt-1) {
-      // last thread may do more
-      ipoints = npoints - istart;
-    }
-    istop = istart + ipoints;
-    std::vector<std::pair<unsigned int, float> > localMemoryEdgeCandidates;
+    // Each thread processes a band of rows, so that the candidates remain sorted
+    // once the results of the threads are concatenated
+    istart = ((iam * nbRows) / nt) * nbCols;
+    istop = (((iam + 1) * nbRows) / nt) * nbCols;
+    std::vector<std::pair<unsigned int, float> > &edgeCandidates = m_threadEdgeCandidateAndGradient[static_cast<size_t>(iam)];
+#else
+  std::vector<std::pair<unsigned int, float> > &edgeCandidates = m_edgeCandidateAndGradient;
 #endif
     bool ignore_current_pixel = false;
     bool grad_lower_threshold = false;
@@ -529,35 +520,14 @@ vpCannyEdgeDetection::performEdgeThinning(const float &lowerThreshold)
 
           if ((grad >= gradPlus) && (grad >= gradMinus)) {
             // Keeping the edge point that has the highest gradient
-#ifdef VISP_HAVE_OPENMP
-            localMemoryEdgeCandidates.push_back(std::pair<unsigned int, float>(static_cast<unsigned int>(iter), grad));
-#else
-            m_edgeCandidateAndGradient.push_back(std::pair<unsigned int, float>(static_cast<unsigned int>(iter), grad));
-#endif
+            edgeCandidates.push_back(std::pair<unsigned int, float>(static_cast<unsigned int>(iter), grad));
           }
         }
       }
     }
-#ifdef VISP_HAVE_OPENMP
-#pragma omp critical
-    {
-#if (VISP_CXX_STANDARD >= VISP_CXX_STANDARD_11)
-      m_edgeCandidateAndGradient.insert(
-        m_edgeCandidateAndGradient.end(),
-        std::make_move_iterator(localMemoryEdgeCandidates.begin()),
-        std::make_move_iterator(localMemoryEdgeCandidates.end())
-      );
-#else
-      m_edgeCandidateAndGradient.insert(
-        m_edgeCandidateAndGradient.end(),
-        localMemoryEdgeCandidates.begin(),
-        localMemoryEdgeCandidates.end()
-      );
-#endif
-    }
-#endif
 #ifdef VISP_HAVE_OPENMP
   }
+  concatenateThreadBuffers(m_threadEdgeCandidateAndGradient, m_edgeCandidateAndGradient);
 #endif
 }
 
@@ -569,59 +539,33 @@ vpCannyEdgeDetection::performHysteresisThresholding(const float &lowerThreshold,
   int istop = size;
 
 #ifdef VISP_HAVE_OPENMP
-  int iam, nt, ipoints, npoints(size);
-#pragma omp parallel default(shared) private(iam, nt, ipoints, istart, istop) num_threads(m_nbThread)
+  initThreadBuffers(m_nbThread, m_threadActiveEdgeCandidates);
+  const int nbBuffers = static_cast<int>(m_threadActiveEdgeCandidates.size());
+  int iam, nt;
+#pragma omp parallel default(shared) private(iam, nt, istart, istop) num_threads(nbBuffers)
   {
     iam = omp_get_thread_num();
     nt = omp_get_num_threads();
-    ipoints = npoints / nt;
-    // size of partition
-    istart = iam * ipoints; // starting array index
-    if (iam == nt-1) {
-      // last thread may do more
-      ipoints = npoints - istart;
-    }
-    istop = istart + ipoints;
-    std::vector<unsigned int> localMemoryEdgeCandidates;
+    istart = (iam * size) / nt;
+    istop = ((iam + 1) * size) / nt;
+    std::vector<unsigned int> &activeEdgeCandidates = m_threadActiveEdgeCandidates[static_cast<size_t>(iam)];
+#else
+  std::vector<unsigned int> &activeEdgeCandidates = m_activeEdgeCandidates;
 #endif
     for (int id = istart; id < istop; ++id) {
       const std::pair<unsigned int, float> &candidate = m_edgeCandidateAndGradient[static_cast<std::size_t>(id)];
       if (candidate.second >= upperThreshold) {
-#ifdef VISP_HAVE_OPENMP
-        localMemoryEdgeCandidates.push_back(candidate.first);
-#else
-        m_activeEdgeCandidates.push_back(candidate.first);
-#endif
+        activeEdgeCandidates.push_back(candidate.first);
         m_edgePointsCandidates.bitmap[candidate.first] = STRONG_EDGE;
       }
       else if ((candidate.second >= lowerThreshold) && (candidate.second < upperThreshold)) {
-#ifdef VISP_HAVE_OPENMP
-        localMemoryEdgeCandidates.push_back(candidate.first);
-#else
-        m_activeEdgeCandidates.push_back(candidate.first);
-#endif
+        activeEdgeCandidates.push_back(candidate.first);
         m_edgePointsCandidates.bitmap[candidate.first] = WEAK_EDGE;
       }
     }
-
 #ifdef VISP_HAVE_OPENMP
-#pragma omp critical
-    {
-#if (VISP_CXX_STANDARD >= VISP_CXX_STANDARD_11)
-      m_activeEdgeCandidates.insert(
-        m_activeEdgeCandidates.end(),
-        std::make_move_iterator(localMemoryEdgeCandidates.begin()),
-        std::make_move_iterator(localMemoryEdgeCandidates.end())
-      );
-#else
-      m_activeEdgeCandidates.insert(
-        m_activeEdgeCandidates.end(),
-        localMemoryEdgeCandidates.begin(),
-        localMemoryEdgeCandidates.end()
-      );
-#endif
-    }
   }
+  concatenateThreadBuffers(m_threadActiveEdgeCandidates, m_activeEdgeCandidates);
 #endif
 }
 
@@ -646,74 +590,66 @@ vpCannyEdgeDetection::performEdgeTracking()
       m_edgeMap.bitmap[*it] = var_uc_255;
     }
     else if (m_edgePointsCandidates.bitmap[*it] == WEAK_EDGE) {
-      recursiveSearchForStrongEdge(*it);
+      searchForStrongEdge(*it);
     }
   }
 }
 
 bool
-vpCannyEdgeDetection::recursiveSearchForStrongEdge(const unsigned int &coordinates)
+vpCannyEdgeDetection::searchForStrongEdge(const unsigned int &coordinates)
 {
   const int nbCols = static_cast<int>(m_dIx.getCols());
   const int size = static_cast<int>(m_dIx.getSize());
-  const int coordAsInt = static_cast<int>(coordinates);
+  const unsigned int nbNeighbors = 9;
+  const unsigned char var_uc_255 = 255;
   bool hasFoundStrongEdge = false;
+
+  // Depth-first search, the neighbors being visited in the same order as a recursive search would do
+  m_edgeTrackingStack.clear();
   m_edgePointsCandidates.bitmap[coordinates] = ON_CHECK;
-  bool test_row = false;
-  bool test_col = false;
-  bool test_drdc = false;
-  bool edge_in_image_limit = false;
-  int dr = -1;
-  while ((dr <= 1) && (!hasFoundStrongEdge)) {
-    int dc = -1;
-    while ((dc <= 1) && (!hasFoundStrongEdge)) {
-      // reset the check for the edge on image limit
-      edge_in_image_limit = false;
-
-      int iterTest = coordAsInt + dr * nbCols + dc;
+  m_edgeTrackingStack.push_back(std::pair<unsigned int, unsigned int>(coordinates, 0));
+  while (!m_edgeTrackingStack.empty()) {
+    std::pair<unsigned int, unsigned int> &current = m_edgeTrackingStack.back();
+    if ((!hasFoundStrongEdge) && (current.second < nbNeighbors)) {
+      const int dr = (static_cast<int>(current.second) / 3) - 1;
+      const int dc = (static_cast<int>(current.second) % 3) - 1;
+      ++current.second;
+      int iterTest = static_cast<int>(current.first) + (dr * nbCols) + dc;
 
       // Checking if we are still looking for an edge in the limit of the image
-      test_row = (iterTest < 0) || (iterTest >= size);
-      test_col = ((iterTest - dc) / nbCols) != (iterTest / nbCols);
-      test_drdc = (dr == 0) && (dc == 0);
-      if (test_row || test_col || test_drdc) {
-        edge_in_image_limit = true;
-        // the continue is replaced by the test
-      }
-      if (edge_in_image_limit == false) {
-
-        try {
-          // Checking if the 8-neighbor point is in the list of edge candidates
-          EdgeType type_candidate = m_edgePointsCandidates.bitmap[iterTest];
-          if (type_candidate == STRONG_EDGE) {
-            // The 8-neighbor point is a strong edge => the weak edge becomes a strong edge
-            hasFoundStrongEdge = true;
-          }
-          else if (type_candidate == WEAK_EDGE) {
-            // Checking if the WEAK_EDGE neighbor has a STRONG_EDGE neighbor
-            hasFoundStrongEdge = recursiveSearchForStrongEdge(static_cast<unsigned int>(iterTest));
-          }
+      bool test_row = (iterTest < 0) || (iterTest >= size);
+      bool test_col = ((iterTest - dc) / nbCols) != (iterTest / nbCols);
+      bool test_drdc = (dr == 0) && (dc == 0);
+      if (!(test_row || test_col || test_drdc)) {
+        // Checking if the 8-neighbor point is in the list of edge candidates
+        EdgeType type_candidate = m_edgePointsCandidates.bitmap[iterTest];
+        if (type_candidate == STRONG_EDGE) {
+          // The 8-neighbor point is a strong edge => the weak edge becomes a strong edge
+          hasFoundStrongEdge = true;
         }
-        catch (...) {
-          // continue - nothing to do
+        else if (type_candidate == WEAK_EDGE) {
+          // Checking if the WEAK_EDGE neighbor is connected to a STRONG_EDGE
+          m_edgePointsCandidates.bitmap[iterTest] = ON_CHECK;
+          m_edgeTrackingStack.push_back(std::pair<unsigned int, unsigned int>(static_cast<unsigned int>(iterTest), 0));
         }
       }
-      ++dc;
     }
-    ++dr;
-  }
-  const unsigned char var_uc_255 = 255;
-  if (hasFoundStrongEdge) {
-    if (m_storeListEdgePoints) {
-      if (m_edgeMap.bitmap[coordinates] != var_uc_255) {
-        // Edge point not added yet to the edge list
-        unsigned int row = static_cast<unsigned int>(coordinates) / static_cast<unsigned int>(nbCols);
-        unsigned int col = static_cast<unsigned int>(coordinates) % static_cast<unsigned int>(nbCols);
-        m_edgePointsList.push_back(vpImagePoint(row, col));
+    else {
+      // The point has been checked, the result is given back to the point that led to it
+      if (hasFoundStrongEdge) {
+        if (m_storeListEdgePoints) {
+          if (m_edgeMap.bitmap[current.first] != var_uc_255) {
+            // Edge point not added yet to the edge list
+            unsigned int row = current.first / static_cast<unsigned int>(nbCols);
+            unsigned int col = current.first % static_cast<unsigned int>(nbCols);
+            m_edgePointsList.push_back(vpImagePoint(row, col));
+          }
+        }
+        m_edgePointsCandidates.bitmap[current.first] = STRONG_EDGE;
+        m_edgeMap.bitmap[current.first] = var_uc_255;
       }
+      m_edgeTrackingStack.pop_back();
     }
-    m_edgePointsCandidates.bitmap[coordinates] = STRONG_EDGE;
-    m_edgeMap.bitmap[coordinates] = var_uc_255;
   }
   return hasFoundStrongEdge;
 }
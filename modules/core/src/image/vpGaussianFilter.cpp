@@ -79,7 +79,7 @@ public:
   void apply(const vpImage<unsigned char> &I, vpImage<unsigned char> &I_blur)
   {
     I_blur.resize(I.getHeight(), I.getWidth());
-    SimdGaussianBlurRun(m_funcPtrGray, I.bitmap, I.getWidth(), I_blur.bitmap, I_blur.getWidth());
+    SimdGaussianBlurRun(m_funcPtrGray, I.bitmap, I.getStride(), I_blur.bitmap, I_blur.getStride());
   }
 
   void apply(const vpImage<vpRGBa> &I, vpImage<vpRGBa> &I_blur)
@@ -87,8 +87,8 @@ public:
     I_blur.resize(I.getHeight(), I.getWidth());
     if (!m_deinterleave) {
       const unsigned int rgba_size = 4;
-      SimdGaussianBlurRun(m_funcPtrRGBa, reinterpret_cast<unsigned char *>(I.bitmap), I.getWidth() * rgba_size,
-                          reinterpret_cast<unsigned char *>(I_blur.bitmap), I_blur.getWidth() * rgba_size);
+      SimdGaussianBlurRun(m_funcPtrRGBa, reinterpret_cast<unsigned char *>(I.bitmap), I.getStride() * rgba_size,
+                          reinterpret_cast<unsigned char *>(I_blur.bitmap), I_blur.getStride() * rgba_size);
     }
     else {
       vpImageConvert::split(I, &m_red, &m_green, &m_blue);
@@ -56,6 +56,19 @@
 #include <visp3/core/vpImageConvert.h>
 
 BEGIN_VISP_NAMESPACE
+
+namespace
+{
+// The conversions below walk the bitmap linearly, which is only valid when the rows are contiguous
+template <typename Type> void checkContiguous(const vpImage<Type> &I, const char *func)
+{
+  if (!I.isContiguous()) {
+    throw(vpException(vpException::badValue, "%s() does not support non contiguous images such as views, "
+                      "see vpImage::isContiguous()", func));
+  }
+}
+}
+
 bool vpImageConvert::YCbCrLUTcomputed = false;
 int vpImageConvert::vpCrr[256];
 int vpImageConvert::vpCgb[256];
@@ -72,6 +85,8 @@ int vpImageConvert::vpCbb[256];
 */
 void vpImageConvert::convert(const vpImage<unsigned char> &src, vpImage<vpRGBa> &dest)
 {
+  checkContiguous(src, "vpImageConvert::convert");
+  checkContiguous(dest, "vpImageConvert::convert");
   dest.resize(src.getHeight(), src.getWidth());
 
   GreyToRGBa(src.bitmap, reinterpret_cast<unsigned char *>(dest.bitmap), src.getWidth(), src.getHeight());
@@ -88,6 +103,8 @@ void vpImageConvert::convert(const vpImage<unsigned char> &src, vpImage<vpRGBa>
 */
 void vpImageConvert::convert(const vpImage<vpRGBa> &src, vpImage<unsigned char> &dest, unsigned int nThreads)
 {
+  checkContiguous(src, "vpImageConvert::convert");
+  checkContiguous(dest, "vpImageConvert::convert");
   dest.resize(src.getHeight(), src.getWidth());
 
   RGBaToGrey(reinterpret_cast<unsigned char *>(src.bitmap), dest.bitmap, src.getWidth(), src.getHeight(), nThreads);
@@ -101,6 +118,8 @@ void vpImageConvert::convert(const vpImage<vpRGBa> &src, vpImage<unsigned char>
 */
 void vpImageConvert::convert(const vpImage<float> &src, vpImage<unsigned char> &dest)
 {
+  checkContiguous(src, "vpImageConvert::convert");
+  checkContiguous(dest, "vpImageConvert::convert");
   dest.resize(src.getHeight(), src.getWidth());
   unsigned int max_xy = src.getWidth() * src.getHeight();
   float min, max;
@@ -163,6 +182,8 @@ void vpImageConvert::convert(const vpImage<vpRGBf> &src, vpImage<vpRGBa> &dest)
 */
 void vpImageConvert::convert(const vpImage<unsigned char> &src, vpImage<float> &dest)
 {
+  checkContiguous(src, "vpImageConvert::convert");
+  checkContiguous(dest, "vpImageConvert::convert");
   const unsigned int srcHeight = src.getHeight(), srcWidth = src.getWidth();
   const unsigned int srcSize = srcHeight * srcWidth;
   dest.resize(srcHeight, srcWidth);
@@ -179,6 +200,8 @@ void vpImageConvert::convert(const vpImage<unsigned char> &src, vpImage<float> &
 */
 void vpImageConvert::convert(const vpImage<double> &src, vpImage<unsigned char> &dest)
 {
+  checkContiguous(src, "vpImageConvert::convert");
+  checkContiguous(dest, "vpImageConvert::convert");
   dest.resize(src.getHeight(), src.getWidth());
   unsigned int max_xy = src.getWidth() * src.getHeight();
   double min, max;
@@ -208,6 +231,8 @@ void vpImageConvert::convert(const vpImage<double> &src, vpImage<unsigned char>
 */
 void vpImageConvert::convert(const vpImage<uint16_t> &src, vpImage<unsigned char> &dest, unsigned char bitshift)
 {
+  checkContiguous(src, "vpImageConvert::convert");
+  checkContiguous(dest, "vpImageConvert::convert");
   const unsigned int srcSize = src.getSize();
   dest.resize(src.getHeight(), src.getWidth());
 
@@ -224,6 +249,8 @@ void vpImageConvert::convert(const vpImage<uint16_t> &src, vpImage<unsigned char
 */
 void vpImageConvert::convert(const vpImage<unsigned char> &src, vpImage<uint16_t> &dest, unsigned char bitshift)
 {
+  checkContiguous(src, "vpImageConvert::convert");
+  checkContiguous(dest, "vpImageConvert::convert");
   const unsigned int srcSize = src.getSize();
   dest.resize(src.getHeight(), src.getWidth());
 
@@ -239,6 +266,8 @@ void vpImageConvert::convert(const vpImage<unsigned char> &src, vpImage<uint16_t
 */
 void vpImageConvert::convert(const vpImage<unsigned char> &src, vpImage<double> &dest)
 {
+  checkContiguous(src, "vpImageConvert::convert");
+  checkContiguous(dest, "vpImageConvert::convert");
   const unsigned int srcHeight = src.getHeight(), srcWidth = src.getWidth();
   const unsigned int srcSize = srcHeight * srcWidth;
   dest.resize(srcHeight, srcWidth);
@@ -256,6 +285,8 @@ void vpImageConvert::convert(const vpImage<unsigned char> &src, vpImage<double>
 */
 void vpImageConvert::createDepthHistogram(const vpImage<uint16_t> &src_depth, vpImage<vpRGBa> &dest_rgba)
 {
+  checkContiguous(src_depth, "vpImageConvert::createDepthHistogram");
+  checkContiguous(dest_rgba, "vpImageConvert::createDepthHistogram");
   vp_createDepthHistogram(src_depth, dest_rgba);
 }
 
@@ -267,6 +298,8 @@ void vpImageConvert::createDepthHistogram(const vpImage<uint16_t> &src_depth, vp
 */
 void vpImageConvert::createDepthHistogram(const vpImage<uint16_t> &src_depth, vpImage<unsigned char> &dest_depth)
 {
+  checkContiguous(src_depth, "vpImageConvert::createDepthHistogram");
+  checkContiguous(dest_depth, "vpImageConvert::createDepthHistogram");
   vp_createDepthHistogram(src_depth, dest_depth);
 }
 
@@ -279,6 +312,8 @@ void vpImageConvert::createDepthHistogram(const vpImage<uint16_t> &src_depth, vp
 */
 void vpImageConvert::createDepthHistogram(const vpImage<float> &src_depth, vpImage<vpRGBa> &dest_rgba)
 {
+  checkContiguous(src_depth, "vpImageConvert::createDepthHistogram");
+  checkContiguous(dest_rgba, "vpImageConvert::createDepthHistogram");
   vp_createDepthHistogram(src_depth, dest_rgba);
 }
 
@@ -290,6 +325,8 @@ void vpImageConvert::createDepthHistogram(const vpImage<float> &src_depth, vpIma
  */
 void vpImageConvert::createDepthHistogram(const vpImage<float> &src_depth, vpImage<unsigned char> &dest_depth)
 {
+  checkContiguous(src_depth, "vpImageConvert::createDepthHistogram");
+  checkContiguous(dest_depth, "vpImageConvert::createDepthHistogram");
   vp_createDepthHistogram(src_depth, dest_depth);
 }
 
@@ -1184,6 +1221,14 @@ void vpImageConvert::YCrCbToRGBa(unsigned char *ycrcb, unsigned char *rgba, unsi
 void vpImageConvert::split(const vpImage<vpRGBa> &src, vpImage<unsigned char> *pR, vpImage<unsigned char> *pG,
                            vpImage<unsigned char> *pB, vpImage<unsigned char> *pa)
 {
+  checkContiguous(src, "vpImageConvert::split");
+  vpImage<unsigned char> *channels[] = { pR, pG, pB, pa };
+  for (unsigned int c = 0; c < 4; ++c) {
+    if (channels[c] != nullptr) {
+      checkContiguous(*channels[c], "vpImageConvert::split");
+    }
+  }
+
 #if defined(VISP_HAVE_SIMDLIB)
   if (src.getSize() > 0) {
     if (pR) {
@@ -1294,6 +1339,14 @@ void vpImageConvert::split(const vpImage<vpRGBa> &src, vpImage<unsigned char> *p
 void vpImageConvert::merge(const vpImage<unsigned char> *R, const vpImage<unsigned char> *G,
                            const vpImage<unsigned char> *B, const vpImage<unsigned char> *a, vpImage<vpRGBa> &RGBa)
 {
+  const vpImage<unsigned char> *channels[] = { R, G, B, a };
+  for (unsigned int c = 0; c < 4; ++c) {
+    if (channels[c] != nullptr) {
+      checkContiguous(*channels[c], "vpImageConvert::merge");
+    }
+  }
+  checkContiguous(RGBa, "vpImageConvert::merge");
+
   // Check if the input channels have all the same dimensions
   std::map<unsigned int, unsigned int> mapOfWidths, mapOfHeights;
   if (R != nullptr) {
@@ -125,7 +125,7 @@ void vpImageConvert::convert(const cv::Mat &src, vpImage<vpRGBa> &dest, bool fli
                     static_cast<std::size_t>(src.rows),
                     static_cast<std::size_t>(src.step[0]),
                     reinterpret_cast<uint8_t *>(dest.bitmap),
-                    dest.getWidth() * sizeof(vpRGBa),
+                    dest.getStride() * sizeof(vpRGBa),
                     vpRGBa::alpha_default);
     }
     else {
@@ -158,7 +158,7 @@ void vpImageConvert::convert(const cv::Mat &src, vpImage<vpRGBa> &dest, bool fli
                      static_cast<std::size_t>(src.rows),
                      static_cast<std::size_t>(src.step[0]),
                      reinterpret_cast<uint8_t *>(dest.bitmap),
-                     dest.getWidth() * sizeof(vpRGBa), vpRGBa::alpha_default);
+                     dest.getStride() * sizeof(vpRGBa), vpRGBa::alpha_default);
     }
     else {
 #endif
@@ -228,18 +228,18 @@ void vpImageConvert::convert(const cv::Mat &src, vpImage<unsigned char> &dest, b
     dest.resize(static_cast<unsigned int>(src.rows), static_cast<unsigned int>(src.cols));
     unsigned int destRows = dest.getRows();
     unsigned int destCols = dest.getCols();
-    if (src.isContinuous() && (!flip)) {
+    if (src.isContinuous() && dest.isContiguous() && (!flip)) {
       memcpy(dest.bitmap, src.data, static_cast<size_t>(src.rows * src.cols));
     }
     else {
       if (flip) {
         for (unsigned int i = 0; i < destRows; ++i) {
-          memcpy(dest.bitmap + (i * destCols), src.data + ((destRows - i - 1) * src.step1()), static_cast<size_t>(destCols * sizeof(unsigned char)));
+          memcpy(dest[i], src.data + ((destRows - i - 1) * src.step1()), static_cast<size_t>(destCols * sizeof(unsigned char)));
         }
       }
       else {
         for (unsigned int i = 0; i < destRows; ++i) {
-          memcpy(dest.bitmap + (i * destCols), src.data + (i * src.step1()), static_cast<size_t>(destCols * sizeof(unsigned char)));
+          memcpy(dest[i], src.data + (i * src.step1()), static_cast<size_t>(destCols * sizeof(unsigned char)));
         }
       }
     }
@@ -248,7 +248,7 @@ void vpImageConvert::convert(const cv::Mat &src, vpImage<unsigned char> &dest, b
     dest.resize(static_cast<unsigned int>(src.rows), static_cast<unsigned int>(src.cols));
     unsigned int destRows = dest.getRows();
     unsigned int destCols = dest.getCols();
-    if (src.isContinuous()) {
+    if (src.isContinuous() && dest.isContiguous()) {
       BGRToGrey((unsigned char *)src.data, (unsigned char *)dest.bitmap, static_cast<unsigned int>(src.cols), static_cast<unsigned int>(src.rows),
                 flip, nThreads);
     }
@@ -256,13 +256,13 @@ void vpImageConvert::convert(const cv::Mat &src, vpImage<unsigned char> &dest, b
       if (flip) {
         for (unsigned int i = 0; i < destRows; ++i) {
           BGRToGrey((unsigned char *)src.data + (i * src.step1()),
-                    (unsigned char *)dest.bitmap + ((destRows - i - 1) * destCols),
+                    dest[destRows - i - 1],
                     static_cast<unsigned int>(destCols), 1, false);
         }
       }
       else {
         for (unsigned int i = 0; i < destRows; ++i) {
-          BGRToGrey((unsigned char *)src.data + (i * src.step1()), (unsigned char *)dest.bitmap + (i * destCols),
+          BGRToGrey((unsigned char *)src.data + (i * src.step1()), dest[i],
                     static_cast<unsigned int>(destCols), 1, false);
         }
       }
@@ -272,7 +272,7 @@ void vpImageConvert::convert(const cv::Mat &src, vpImage<unsigned char> &dest, b
     dest.resize(static_cast<unsigned int>(src.rows), static_cast<unsigned int>(src.cols));
     unsigned int destRows = dest.getRows();
     unsigned int destCols = dest.getCols();
-    if (src.isContinuous()) {
+    if (src.isContinuous() && dest.isContiguous()) {
       BGRaToGrey((unsigned char *)src.data, (unsigned char *)dest.bitmap, static_cast<unsigned int>(src.cols),
                  static_cast<unsigned int>(src.rows), flip, nThreads);
     }
@@ -280,13 +280,13 @@ void vpImageConvert::convert(const cv::Mat &src, vpImage<unsigned char> &dest, b
       if (flip) {
         for (unsigned int i = 0; i < destRows; ++i) {
           BGRaToGrey((unsigned char *)src.data + (i * src.step1()),
-                     (unsigned char *)dest.bitmap + ((destRows - i - 1) * destCols),
+                     dest[destRows - i - 1],
                      static_cast<unsigned int>(destCols), 1, false);
         }
       }
       else {
         for (unsigned int i = 0; i < destRows; ++i) {
-          BGRaToGrey((unsigned char *)src.data + (i * src.step1()), (unsigned char *)dest.bitmap + (i * destCols),
+          BGRaToGrey((unsigned char *)src.data + (i * src.step1()), dest[i],
                      static_cast<unsigned int>(destCols), 1, false);
         }
       }
@@ -374,18 +374,18 @@ void vpImageConvert::convert(const cv::Mat &src, vpImage<uint16_t> &dest, bool f
   unsigned int destCols = dest.getCols();
 
   if (src.type() == CV_16UC1) {
-    if (src.isContinuous()) {
+    if (src.isContinuous() && dest.isContiguous()) {
       memcpy(dest.bitmap, src.data, static_cast<size_t>(src.rows * src.cols) * sizeof(uint16_t));
     }
     else {
       if (flip) {
         for (unsigned int i = 0; i < destRows; ++i) {
-          memcpy(dest.bitmap + (i * destCols), src.data + ((destRows - i - 1) * src.step1() * sizeof(uint16_t)), static_cast<size_t>(destCols * sizeof(uint16_t)));
+          memcpy(dest[i], src.data + ((destRows - i - 1) * src.step1() * sizeof(uint16_t)), static_cast<size_t>(destCols * sizeof(uint16_t)));
         }
       }
       else {
         for (unsigned int i = 0; i < destRows; ++i) {
-          memcpy(dest.bitmap + (i * destCols), src.data + (i * src.step1() * sizeof(uint16_t)), static_cast<size_t>(destCols * sizeof(uint16_t)));
+          memcpy(dest[i], src.data + (i * src.step1() * sizeof(uint16_t)), static_cast<size_t>(destCols * sizeof(uint16_t)));
         }
       }
     }
@@ -476,7 +476,8 @@ void vpImageConvert::convert(const cv::Mat &src, vpImage<vpRGBf> &dest, bool fli
 */
 void vpImageConvert::convert(const vpImage<vpRGBa> &src, cv::Mat &dest)
 {
-  cv::Mat vpToMat(static_cast<int>(src.getRows()), static_cast<int>(src.getCols()), CV_8UC4, (void *)src.bitmap);
+  cv::Mat vpToMat(static_cast<int>(src.getRows()), static_cast<int>(src.getCols()), CV_8UC4, (void *)src.bitmap,
+                  src.getStride() * sizeof(vpRGBa));
   cv::cvtColor(vpToMat, dest, cv::COLOR_RGBA2BGR);
 }
 
@@ -527,11 +528,13 @@ void vpImageConvert::convert(const vpImage<vpRGBa> &src, cv::Mat &dest)
 void vpImageConvert::convert(const vpImage<unsigned char> &src, cv::Mat &dest, bool copyData)
 {
   if (copyData) {
-    cv::Mat tmpMap(static_cast<int>(src.getRows()), static_cast<int>(src.getCols()), CV_8UC1, (void *)src.bitmap);
+    cv::Mat tmpMap(static_cast<int>(src.getRows()), static_cast<int>(src.getCols()), CV_8UC1, (void *)src.bitmap,
+                   src.getStride() * sizeof(unsigned char));
     dest = tmpMap.clone();
   }
   else {
-    dest = cv::Mat(static_cast<int>(src.getRows()), static_cast<int>(src.getCols()), CV_8UC1, (void *)src.bitmap);
+    dest = cv::Mat(static_cast<int>(src.getRows()), static_cast<int>(src.getCols()), CV_8UC1, (void *)src.bitmap,
+                   src.getStride() * sizeof(unsigned char));
   }
 }
 
@@ -547,11 +550,13 @@ void vpImageConvert::convert(const vpImage<unsigned char> &src, cv::Mat &dest, b
 void vpImageConvert::convert(const vpImage<float> &src, cv::Mat &dest, bool copyData)
 {
   if (copyData) {
-    cv::Mat tmpMap(static_cast<int>(src.getRows()), static_cast<int>(src.getCols()), CV_32FC1, (void *)src.bitmap);
+    cv::Mat tmpMap(static_cast<int>(src.getRows()), static_cast<int>(src.getCols()), CV_32FC1, (void *)src.bitmap,
+                   src.getStride() * sizeof(float));
     dest = tmpMap.clone();
   }
   else {
-    dest = cv::Mat(static_cast<int>(src.getRows()), static_cast<int>(src.getCols()), CV_32FC1, (void *)src.bitmap);
+    dest = cv::Mat(static_cast<int>(src.getRows()), static_cast<int>(src.getCols()), CV_32FC1, (void *)src.bitmap,
+                   src.getStride() * sizeof(float));
   }
 }
 
@@ -586,7 +591,8 @@ void vpImageConvert::convert(const vpImage<double> &src, cv::Mat &dest, bool cop
  */
 void vpImageConvert::convert(const vpImage<vpRGBf> &src, cv::Mat &dest)
 {
-  cv::Mat vpToMat(static_cast<int>(src.getRows()), static_cast<int>(src.getCols()), CV_32FC3, (void *)src.bitmap);
+  cv::Mat vpToMat(static_cast<int>(src.getRows()), static_cast<int>(src.getCols()), CV_32FC3, (void *)src.bitmap,
+                  src.getStride() * sizeof(vpRGBf));
   cv::cvtColor(vpToMat, dest, cv::COLOR_RGB2BGR);
 }
 
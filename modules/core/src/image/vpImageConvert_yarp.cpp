@@ -42,6 +42,19 @@
 #include <visp3/core/vpImageConvert.h>
 
 BEGIN_VISP_NAMESPACE
+
+namespace
+{
+// Sharing the bitmap with a YARP image is only valid when the rows are contiguous
+template <typename Type> void checkContiguous(const vpImage<Type> &I, const char *func)
+{
+  if (!I.isContiguous()) {
+    throw(vpException(vpException::badValue, "%s() does not support non contiguous images such as views "
+                      "without copying the data, see vpImage::isContiguous()", func));
+  }
+}
+}
+
 /*!
   Convert a vpImage\<unsigned char\> to a yarp::sig::ImageOf\<yarp::sig::PixelMono\>
 
@@ -91,6 +104,7 @@ void vpImageConvert::convert(const vpImage<unsigned char> &src, yarp::sig::Image
     }
   }
   else {
+    checkContiguous(src, "vpImageConvert::convert");
     dest->setExternal(src.bitmap, static_cast<int>(src.getCols()), static_cast<int>(src.getRows()));
   }
 }
@@ -191,9 +205,12 @@ void vpImageConvert::convert(const vpImage<vpRGBa> &src, yarp::sig::ImageOf<yarp
 {
   if (copyData) {
     dest->resize(src.getWidth(), src.getHeight());
-    memcpy(dest->getRawImage(), src.bitmap, src.getHeight() * src.getWidth() * sizeof(vpRGBa));
+    for (unsigned int i = 0; i < src.getHeight(); ++i) {
+      memcpy(dest->getRow(i), src[i], src.getWidth() * sizeof(vpRGBa));
+    }
   }
   else {
+    checkContiguous(src, "vpImageConvert::convert");
     dest->setExternal(src.bitmap, static_cast<int>(src.getCols()), static_cast<int>(src.getRows()));
   }
 }
@@ -42,11 +42,13 @@ BEGIN_VISP_NAMESPACE
 */
 template
 void vpImageFilter::filter<unsigned char, float>(const vpImage<unsigned char> &I, vpImage<float> &If,
-                                                 const vpArray2D<float> &M, bool convolve, const vpImage<bool> *p_mask);
+                                                 const vpArray2D<float> &M, bool convolve, const vpImage<bool> *p_mask,
+                                                 const int &nbThread);
 
 template
 void vpImageFilter::filter<unsigned char, double>(const vpImage<unsigned char> &I, vpImage<double> &If,
-                                                  const vpArray2D<double> &M, bool convolve, const vpImage<bool> *p_mask);
+                                                  const vpArray2D<double> &M, bool convolve, const vpImage<bool> *p_mask,
+                                                  const int &nbThread);
 
 template
 void vpImageFilter::filter<float, float>(const vpImage<float> &I, vpImage<float> &Iu, vpImage<float> &Iv,
@@ -164,17 +166,17 @@ void vpImageFilter::sepFilter(const vpImage<unsigned char> &I, vpImage<double> &
  */
 template
 void vpImageFilter::filterX<unsigned char, float>(const vpImage<unsigned char> &I, vpImage<float> &dIx, const float *filter,
-                                                  unsigned int size, const vpImage<bool> *p_mask);
+                                                  unsigned int size, const vpImage<bool> *p_mask, const int &nbThread);
 
 template
 void vpImageFilter::filterX<unsigned char, double>(const vpImage<unsigned char> &I, vpImage<double> &dIx, const double *filter,
-                                                   unsigned int size, const vpImage<bool> *p_mask);
+                                                   unsigned int size, const vpImage<bool> *p_mask, const int &nbThread);
 
 template
-void vpImageFilter::filterX<float, float>(const vpImage<float> &I, vpImage<float> &dIx, const float *filter, unsigned int size, const vpImage<bool> *p_mask);
+void vpImageFilter::filterX<float, float>(const vpImage<float> &I, vpImage<float> &dIx, const float *filter, unsigned int size, const vpImage<bool> *p_mask, const int &nbThread);
 
 template
-void vpImageFilter::filterX<double, double>(const vpImage<double> &I, vpImage<double> &dIx, const double *filter, unsigned int size, const vpImage<bool> *p_mask);
+void vpImageFilter::filterX<double, double>(const vpImage<double> &I, vpImage<double> &dIx, const double *filter, unsigned int size, const vpImage<bool> *p_mask, const int &nbThread);
 /**
  * \endcond
  */
@@ -228,17 +230,17 @@ void vpImageFilter::filterX(const vpImage<vpRGBa> &I, vpImage<vpRGBa> &dIx, cons
  */
 template
 void vpImageFilter::filterY<unsigned char, float>(const vpImage<unsigned char> &I, vpImage<float> &dIy, const float *filter,
-                                                  unsigned int size, const vpImage<bool> *p_mask);
+                                                  unsigned int size, const vpImage<bool> *p_mask, const int &nbThread);
 
 template
 void vpImageFilter::filterY<unsigned char, double>(const vpImage<unsigned char> &I, vpImage<double> &dIy, const double *filter,
-                                                   unsigned int size, const vpImage<bool> *p_mask);
+                                                   unsigned int size, const vpImage<bool> *p_mask, const int &nbThread);
 
 template
-void vpImageFilter::filterY<float, float>(const vpImage<float> &I, vpImage<float> &dIy, const float *filter, unsigned int size, const vpImage<bool> *p_mask);
+void vpImageFilter::filterY<float, float>(const vpImage<float> &I, vpImage<float> &dIy, const float *filter, unsigned int size, const vpImage<bool> *p_mask, const int &nbThread);
 
 template
-void vpImageFilter::filterY<double, double>(const vpImage<double> &I, vpImage<double> &dIy, const double *filter, unsigned int size, const vpImage<bool> *p_mask);
+void vpImageFilter::filterY<double, double>(const vpImage<double> &I, vpImage<double> &dIy, const double *filter, unsigned int size, const vpImage<bool> *p_mask, const int &nbThread);
 /**
  * \endcond
  */
@@ -342,6 +344,116 @@ void vpImageFilter::gaussianBlur(const vpImage<vpRGBa> &I, vpImage<vpRGBa> &GI,
 }
 #endif
 
+#if (VISP_CXX_STANDARD >= VISP_CXX_STANDARD_11)
+/*!
+  Apply a normalized Gaussian blur to a grayscale image using fixed-point arithmetic.
+
+  The kernel coefficients are quantized with 8 fractional bits, the horizontal pass is stored on 16 bits and the
+  vertical pass is accumulated on 32 bits before being rounded. The borders are handled as in gaussianBlur(). The
+  result differs from the one of gaussianBlur() computed in floating point, that truncates the intermediate and final
+  values, by at most a few gray levels, but it avoids any conversion to floating point.
+
+  \param[in] I : Input image.
+  \param[out] GI : Filtered image.
+  \param[in] size : Filter size. This value should be odd.
+  \param[in] sigma : Gaussian standard deviation. If it is equal to zero or
+  negative, it is computed from filter size as sigma = (size-1)/6.
+
+  \sa gaussianBlur()
+ */
+void vpImageFilter::gaussianBlurFixedPoint(const vpImage<unsigned char> &I, vpImage<unsigned char> &GI, unsigned int size,
+                                           float sigma)
+{
+  const unsigned int height = I.getHeight(), width = I.getWidth();
+  const unsigned int half = (size - 1) / 2;
+  if ((size == 0) || (width <= (2 * half)) || (height <= (2 * half))) {
+    std::ostringstream oss;
+    oss << "Image size (" << width << "x" << height << ") is too small for the Gaussian kernel ("
+      << "size=" << size << "), min size is " << size;
+    throw vpException(vpException::dimensionError, oss.str());
+  }
+
+  std::vector<float> fg(half + 1);
+  vpImageFilter::getGaussianKernel<float>(fg.data(), size, sigma, true);
+
+  // Quantize the kernel with 8 fractional bits. The central coefficient absorbs the rounding errors so that the
+  // coefficients sum exactly to 256.
+  const int shift = 8;
+  std::vector<int> fq(half + 1);
+  int sum = 0;
+  for (unsigned int k = 1; k <= half; ++k) {
+    fq[k] = vpMath::round(fg[k] * static_cast<float>(1 << shift));
+    sum += 2 * fq[k];
+  }
+  fq[0] = (1 << shift) - sum;
+
+  GI.resize(height, width);
+  std::vector<unsigned short> Ix(static_cast<size_t>(height) * width);
+  const int nbRows = static_cast<int>(height);
+
+#ifdef VISP_HAVE_OPENMP
+#pragma omp parallel
+#endif
+  {
+    std::vector<unsigned char> buffer(width + (2 * half));
+    std::vector<int> acc(width);
+    std::vector<const unsigned short *> taps((2 * half) + 1);
+
+    // Horizontal pass, at most 255 * 256 which fits on 16 bits
+#ifdef VISP_HAVE_OPENMP
+#pragma omp for schedule(static)
+#endif
+    for (int i = 0; i < nbRows; ++i) {
+      mirrorRow(I[i], buffer.data(), width, half);
+      const unsigned char *b = buffer.data() + half;
+      for (unsigned int j = 0; j < width; ++j) {
+        acc[j] = fq[0] * b[j];
+      }
+      for (unsigned int k = 1; k <= half; ++k) {
+        const int fk = fq[k];
+        const unsigned char *after = b + k;
+        const unsigned char *before = b - k;
+        for (unsigned int j = 0; j < width; ++j) {
+          acc[j] += fk * (after[j] + before[j]);
+        }
+      }
+      unsigned short *dst = Ix.data() + (static_cast<size_t>(i) * width);
+      for (unsigned int j = 0; j < width; ++j) {
+        dst[j] = static_cast<unsigned short>(acc[j]);
+      }
+    }
+
+    // Vertical pass, at most 255 * 256 * 256 which fits on 32 bits
+#ifdef VISP_HAVE_OPENMP
+#pragma omp for schedule(static)
+#endif
+    for (int i = 0; i < nbRows; ++i) {
+      for (int k = -static_cast<int>(half); k <= static_cast<int>(half); ++k) {
+        taps[static_cast<size_t>(k + static_cast<int>(half))] =
+          Ix.data() + (static_cast<size_t>(mirrorIndex(i + k, nbRows)) * width);
+      }
+      const unsigned short *center = taps[half];
+      for (unsigned int j = 0; j < width; ++j) {
+        acc[j] = fq[0] * center[j];
+      }
+      for (unsigned int k = 1; k <= half; ++k) {
+        const int fk = fq[k];
+        const unsigned short *after = taps[half + k];
+        const unsigned short *before = taps[half - k];
+        for (unsigned int j = 0; j < width; ++j) {
+          acc[j] += fk * (after[j] + before[j]);
+        }
+      }
+      unsigned char *dst = GI[i];
+      const int round = 1 << ((2 * shift) - 1);
+      for (unsigned int j = 0; j < width; ++j) {
+        dst[j] = static_cast<unsigned char>((acc[j] + round) >> (2 * shift));
+      }
+    }
+  }
+}
+#endif
+
 /**
  * \cond DO_NOT_DOCUMENT
  */
@@ -0,0 +1,175 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Pool of reusable images for temporary results.
+ */
+
+#include <visp3/core/vpImagePool.h>
+
+BEGIN_VISP_NAMESPACE
+
+namespace
+{
+#if (VISP_CXX_STANDARD >= VISP_CXX_STANDARD_11)
+thread_local vpImagePool *g_threadPool = nullptr;
+#else
+vpImagePool *g_threadPool = nullptr;
+#endif
+}
+
+/*!
+  Default constructor that creates an empty pool, that keeps at most 32 images.
+
+  \sa setMaxNbImages()
+*/
+vpImagePool::vpImagePool()
+  : m_entries(), m_nbAcquisitions(0), m_nbAllocations(0), m_maxNbImages(32), m_clock(0)
+{ }
+
+/*!
+  Destructor that releases the memory of all the images of the pool. If the pool is attached to the current thread,
+  it is detached.
+*/
+vpImagePool::~vpImagePool()
+{
+  if (g_threadPool == this) {
+    g_threadPool = nullptr;
+  }
+  size_t nbEntries = m_entries.size();
+  for (size_t i = 0; i < nbEntries; ++i) {
+    delete m_entries[i];
+  }
+}
+
+/*!
+  Release the memory of all the images of the pool.
+
+  \exception vpException::fatalError When an image obtained with acquire() has not been released.
+*/
+void vpImagePool::clear()
+{
+  if (getNbImagesInUse() != 0) {
+    throw(vpException(vpException::fatalError, "Cannot clear the pool while %d images are in use",
+                      getNbImagesInUse()));
+  }
+  size_t nbEntries = m_entries.size();
+  for (size_t i = 0; i < nbEntries; ++i) {
+    delete m_entries[i];
+  }
+  m_entries.clear();
+}
+
+/*!
+  Number of images obtained with acquire() that have not been released yet.
+*/
+unsigned int vpImagePool::getNbImagesInUse() const
+{
+  unsigned int nbInUse = 0;
+  size_t nbEntries = m_entries.size();
+  for (size_t i = 0; i < nbEntries; ++i) {
+    if (m_entries[i]->m_inUse) {
+      ++nbInUse;
+    }
+  }
+  return nbInUse;
+}
+
+/*!
+  Reset the acquisition and allocation counters, typically at the beginning of a frame.
+
+  \sa getNbAcquisitions(), getNbAllocations()
+*/
+void vpImagePool::resetCounters()
+{
+  m_nbAcquisitions = 0;
+  m_nbAllocations = 0;
+}
+
+/*!
+  Set the maximum number of images kept by the pool. When the pool holds more images, the free images that were used
+  the least recently are released. Images in use are never released: when all the images are in use, acquire() adds
+  a new image even if the maximum is reached.
+
+  The maximum has to be greater than the number of temporary images needed to process a frame, otherwise memory is
+  allocated on each frame.
+
+  \param maxNbImages : Maximum number of images, 0 to keep all the images until clear() is called.
+
+  \sa getMaxNbImages()
+*/
+void vpImagePool::setMaxNbImages(unsigned int maxNbImages)
+{
+  m_maxNbImages = maxNbImages;
+  if (m_maxNbImages > 0) {
+    evict(m_maxNbImages);
+  }
+}
+
+/*!
+  Release the free images that were used the least recently until the pool holds at most \e nbImages images, or
+  until all the remaining images are in use.
+*/
+void vpImagePool::evict(unsigned int nbImages)
+{
+  while (m_entries.size() > nbImages) {
+    size_t oldest = m_entries.size();
+    size_t nbEntries = m_entries.size();
+    for (size_t i = 0; i < nbEntries; ++i) {
+      if ((!m_entries[i]->m_inUse) &&
+          ((oldest == nbEntries) || (m_entries[i]->m_lastUse < m_entries[oldest]->m_lastUse))) {
+        oldest = i;
+      }
+    }
+    if (oldest == nbEntries) {
+      return;
+    }
+    delete m_entries[oldest];
+    m_entries.erase(m_entries.begin() + static_cast<std::ptrdiff_t>(oldest));
+  }
+}
+
+/*!
+  Get the pool attached to the calling thread.
+
+  \return The pool used by the image processing functions called from this thread, or nullptr when temporary images
+  are allocated on each call.
+*/
+vpImagePool *vpImagePool::getThreadPool() { return g_threadPool; }
+
+/*!
+  Attach a pool to the calling thread. The image processing functions called from this thread then draw their
+  temporary images from this pool.
+
+  \param pool : The pool to use, or nullptr to allocate temporary images on each call. The pool has to remain valid
+  as long as it is attached.
+*/
+void vpImagePool::setThreadPool(vpImagePool *pool) { g_threadPool = pool; }
+
+END_VISP_NAMESPACE
@@ -153,16 +153,24 @@ void vpImageTools::imageDifference(const vpImage<unsigned char> &I1, const vpIma
     Idiff.resize(I1.getHeight(), I1.getWidth());
   }
 
+  // The images are processed row by row, a single row covering the whole images when they are contiguous
+  const bool contiguous = I1.isContiguous() && I2.isContiguous() && Idiff.isContiguous();
+  const unsigned int nbRows = contiguous ? 1 : I1.getHeight();
+  const unsigned int rowSize = contiguous ? I1.getSize() : I1.getWidth();
+  for (unsigned int i = 0; i < nbRows; ++i) {
 #if defined(VISP_HAVE_SIMDLIB)
-  SimdImageDifference(I1.bitmap, I2.bitmap, I1.getSize(), Idiff.bitmap);
+    SimdImageDifference(I1[i], I2[i], rowSize, Idiff[i]);
 #else
-  const int val_255 = 255;
-  unsigned int i1_size = I1.getSize();
-  for (unsigned int i = 0; i < i1_size; ++i) {
-    int diff = (I1.bitmap[i] - I2.bitmap[i]) + 128;
-    Idiff.bitmap[i] = static_cast<unsigned char>(std::max<unsigned char>(std::min<unsigned char>(diff, val_255), 0));
-  }
+    const int val_255 = 255;
+    const unsigned char *i1 = I1[i];
+    const unsigned char *i2 = I2[i];
+    unsigned char *idiff = Idiff[i];
+    for (unsigned int j = 0; j < rowSize; ++j) {
+      int diff = (i1[j] - i2[j]) + 128;
+      idiff[j] = static_cast<unsigned char>(std::max<int>(std::min<int>(diff, val_255), 0));
+    }
 #endif
+  }
 }
 
 /*!
@@ -191,24 +199,32 @@ void vpImageTools::imageDifference(const vpImage<vpRGBa> &I1, const vpImage<vpRG
     Idiff.resize(I1.getHeight(), I1.getWidth());
   }
 
+  // The images are processed row by row, a single row covering the whole images when they are contiguous
+  const bool contiguous = I1.isContiguous() && I2.isContiguous() && Idiff.isContiguous();
+  const unsigned int nbRows = contiguous ? 1 : I1.getHeight();
+  const unsigned int rowSize = contiguous ? I1.getSize() : I1.getWidth();
+  for (unsigned int i = 0; i < nbRows; ++i) {
 #if defined(VISP_HAVE_SIMDLIB)
-  SimdImageDifference(reinterpret_cast<unsigned char *>(I1.bitmap), reinterpret_cast<unsigned char *>(I2.bitmap),
-                      I1.getSize() * 4, reinterpret_cast<unsigned char *>(Idiff.bitmap));
+    const unsigned int val_4 = 4;
+    SimdImageDifference(reinterpret_cast<const unsigned char *>(I1[i]), reinterpret_cast<const unsigned char *>(I2[i]),
+                        rowSize * val_4, reinterpret_cast<unsigned char *>(Idiff[i]));
 #else
-  const unsigned int val_4 = 4;
-  const int val_255 = 255;
-  unsigned int i1_size = I1.getSize();
-  for (unsigned int i = 0; i < (i1_size * val_4); ++i) {
-    int diffR = (I1.bitmap[i].R - I2.bitmap[i].R) + 128;
-    int diffG = (I1.bitmap[i].G - I2.bitmap[i].G) + 128;
-    int diffB = (I1.bitmap[i].B - I2.bitmap[i].B) + 128;
-    int diffA = (I1.bitmap[i].A - I2.bitmap[i].A) + 128;
-    Idiff.bitmap[i].R = static_cast<unsigned char>(vpMath::maximum(vpMath::minimum(diffR, val_255), 0));
-    Idiff.bitmap[i].G = static_cast<unsigned char>(vpMath::maximum(vpMath::minimum(diffG, val_255), 0));
-    Idiff.bitmap[i].B = static_cast<unsigned char>(vpMath::maximum(vpMath::minimum(diffB, val_255), 0));
-    Idiff.bitmap[i].A = static_cast<unsigned char>(vpMath::maximum(vpMath::minimum(diffA, val_255), 0));
-  }
+    const int val_255 = 255;
+    const vpRGBa *i1 = I1[i];
+    const vpRGBa *i2 = I2[i];
+    vpRGBa *idiff = Idiff[i];
+    for (unsigned int j = 0; j < rowSize; ++j) {
+      int diffR = (i1[j].R - i2[j].R) + 128;
+      int diffG = (i1[j].G - i2[j].G) + 128;
+      int diffB = (i1[j].B - i2[j].B) + 128;
+      int diffA = (i1[j].A - i2[j].A) + 128;
+      idiff[j].R = static_cast<unsigned char>(vpMath::maximum(vpMath::minimum(diffR, val_255), 0));
+      idiff[j].G = static_cast<unsigned char>(vpMath::maximum(vpMath::minimum(diffG, val_255), 0));
+      idiff[j].B = static_cast<unsigned char>(vpMath::maximum(vpMath::minimum(diffB, val_255), 0));
+      idiff[j].A = static_cast<unsigned char>(vpMath::maximum(vpMath::minimum(diffA, val_255), 0));
+    }
 #endif
+  }
 }
 
 /*!
@@ -232,10 +248,15 @@ void vpImageTools::imageDifferenceAbsolute(const vpImage<unsigned char> &I1, con
     Idiff.resize(I1.getHeight(), I1.getWidth());
   }
 
-  unsigned int n = I1.getHeight() * I1.getWidth();
-  for (unsigned int b = 0; b < n; ++b) {
-    int diff = I1.bitmap[b] - I2.bitmap[b];
-    Idiff.bitmap[b] = static_cast<unsigned char>(vpMath::abs(diff));
+  const unsigned int height = I1.getHeight(), width = I1.getWidth();
+  for (unsigned int i = 0; i < height; ++i) {
+    const unsigned char *i1 = I1[i];
+    const unsigned char *i2 = I2[i];
+    unsigned char *idiff = Idiff[i];
+    for (unsigned int j = 0; j < width; ++j) {
+      int diff = i1[j] - i2[j];
+      idiff[j] = static_cast<unsigned char>(vpMath::abs(diff));
+    }
   }
 }
 
@@ -256,9 +277,14 @@ void vpImageTools::imageDifferenceAbsolute(const vpImage<double> &I1, const vpIm
     Idiff.resize(I1.getHeight(), I1.getWidth());
   }
 
-  unsigned int n = I1.getHeight() * I1.getWidth();
-  for (unsigned int b = 0; b < n; ++b) {
-    Idiff.bitmap[b] = vpMath::abs(I1.bitmap[b] - I2.bitmap[b]);
+  const unsigned int height = I1.getHeight(), width = I1.getWidth();
+  for (unsigned int i = 0; i < height; ++i) {
+    const double *i1 = I1[i];
+    const double *i2 = I2[i];
+    double *idiff = Idiff[i];
+    for (unsigned int j = 0; j < width; ++j) {
+      idiff[j] = vpMath::abs(i1[j] - i2[j]);
+    }
   }
 }
 
@@ -285,17 +311,22 @@ void vpImageTools::imageDifferenceAbsolute(const vpImage<vpRGBa> &I1, const vpIm
     Idiff.resize(I1.getHeight(), I1.getWidth());
   }
 
-  unsigned int n = I1.getHeight() * I1.getWidth();
-  for (unsigned int b = 0; b < n; ++b) {
-    int diffR = I1.bitmap[b].R - I2.bitmap[b].R;
-    int diffG = I1.bitmap[b].G - I2.bitmap[b].G;
-    int diffB = I1.bitmap[b].B - I2.bitmap[b].B;
-    // --comment: int diffA eq I1 dot bitmap[b] dot A minus I2 dot bitmap[b] dot A
-    Idiff.bitmap[b].R = static_cast<unsigned char>(vpMath::abs(diffR));
-    Idiff.bitmap[b].G = static_cast<unsigned char>(vpMath::abs(diffG));
-    Idiff.bitmap[b].B = static_cast<unsigned char>(vpMath::abs(diffB));
-    // --comment: Idiff dot bitmap[b] dot A eq diffA
-    Idiff.bitmap[b].A = 0;
+  const unsigned int height = I1.getHeight(), width = I1.getWidth();
+  for (unsigned int i = 0; i < height; ++i) {
+    const vpRGBa *i1 = I1[i];
+    const vpRGBa *i2 = I2[i];
+    vpRGBa *idiff = Idiff[i];
+    for (unsigned int j = 0; j < width; ++j) {
+      int diffR = i1[j].R - i2[j].R;
+      int diffG = i1[j].G - i2[j].G;
+      int diffB = i1[j].B - i2[j].B;
+      // --comment: int diffA eq I1 dot bitmap[b] dot A minus I2 dot bitmap[b] dot A
+      idiff[j].R = static_cast<unsigned char>(vpMath::abs(diffR));
+      idiff[j].G = static_cast<unsigned char>(vpMath::abs(diffG));
+      idiff[j].B = static_cast<unsigned char>(vpMath::abs(diffB));
+      // --comment: Idiff dot bitmap[b] dot A eq diffA
+      idiff[j].A = 0;
+    }
   }
 }
 
@@ -325,19 +356,21 @@ void vpImageTools::imageAdd(const vpImage<unsigned char> &I1, const vpImage<unsi
 
 #if defined(VISP_HAVE_SIMDLIB)
   typedef Simd::View<Simd::Allocator> View;
-  View img1(I1.getWidth(), I1.getHeight(), I1.getWidth(), View::Gray8, I1.bitmap);
-  View img2(I2.getWidth(), I2.getHeight(), I2.getWidth(), View::Gray8, I2.bitmap);
-  View imgAdd(Ires.getWidth(), Ires.getHeight(), Ires.getWidth(), View::Gray8, Ires.bitmap);
+  View img1(I1.getWidth(), I1.getHeight(), I1.getStride(), View::Gray8, I1.bitmap);
+  View img2(I2.getWidth(), I2.getHeight(), I2.getStride(), View::Gray8, I2.bitmap);
+  View imgAdd(Ires.getWidth(), Ires.getHeight(), Ires.getStride(), View::Gray8, Ires.bitmap);
 
   Simd::OperationBinary8u(img1, img2, imgAdd,
                           saturate ? SimdOperationBinary8uSaturatedAddition : SimdOperationBinary8uAddition);
 #else
-  unsigned char *ptr_I1 = I1.bitmap;
-  unsigned char *ptr_I2 = I2.bitmap;
-  unsigned char *ptr_Ires = Ires.bitmap;
-  unsigned int ires_size = Ires.getSize();
-  for (unsigned int cpt = 0; cpt < ires_size; ++cpt, ++ptr_I1, ++ptr_I2, ++ptr_Ires) {
-    *ptr_Ires = saturate ? vpMath::saturate<unsigned char>(static_cast<short int>(*ptr_I1) + static_cast<short int>(*ptr_I2)) : ((*ptr_I1) + (*ptr_I2));
+  const unsigned int height = Ires.getHeight(), width = Ires.getWidth();
+  for (unsigned int i = 0; i < height; ++i) {
+    const unsigned char *ptr_I1 = I1[i];
+    const unsigned char *ptr_I2 = I2[i];
+    unsigned char *ptr_Ires = Ires[i];
+    for (unsigned int j = 0; j < width; ++j, ++ptr_I1, ++ptr_I2, ++ptr_Ires) {
+      *ptr_Ires = saturate ? vpMath::saturate<unsigned char>(static_cast<short int>(*ptr_I1) + static_cast<short int>(*ptr_I2)) : ((*ptr_I1) + (*ptr_I2));
+    }
   }
 #endif
 }
@@ -368,21 +401,23 @@ void vpImageTools::imageSubtract(const vpImage<unsigned char> &I1, const vpImage
 
 #if defined(VISP_HAVE_SIMDLIB)
   typedef Simd::View<Simd::Allocator> View;
-  View img1(I1.getWidth(), I1.getHeight(), I1.getWidth(), View::Gray8, I1.bitmap);
-  View img2(I2.getWidth(), I2.getHeight(), I2.getWidth(), View::Gray8, I2.bitmap);
-  View imgAdd(Ires.getWidth(), Ires.getHeight(), Ires.getWidth(), View::Gray8, Ires.bitmap);
+  View img1(I1.getWidth(), I1.getHeight(), I1.getStride(), View::Gray8, I1.bitmap);
+  View img2(I2.getWidth(), I2.getHeight(), I2.getStride(), View::Gray8, I2.bitmap);
+  View imgAdd(Ires.getWidth(), Ires.getHeight(), Ires.getStride(), View::Gray8, Ires.bitmap);
 
   Simd::OperationBinary8u(img1, img2, imgAdd,
                           saturate ? SimdOperationBinary8uSaturatedSubtraction : SimdOperationBinary8uSubtraction);
 #else
-  unsigned char *ptr_I1 = I1.bitmap;
-  unsigned char *ptr_I2 = I2.bitmap;
-  unsigned char *ptr_Ires = Ires.bitmap;
-  unsigned int ires_size = Ires.getSize();
-  for (unsigned int cpt = 0; cpt < ires_size; ++cpt, ++ptr_I1, ++ptr_I2, ++ptr_Ires) {
-    *ptr_Ires = saturate ?
-      vpMath::saturate<unsigned char>(static_cast<short int>(*ptr_I1) - static_cast<short int>(*ptr_I2)) :
-      ((*ptr_I1) - (*ptr_I2));
+  const unsigned int height = Ires.getHeight(), width = Ires.getWidth();
+  for (unsigned int i = 0; i < height; ++i) {
+    const unsigned char *ptr_I1 = I1[i];
+    const unsigned char *ptr_I2 = I2[i];
+    unsigned char *ptr_Ires = Ires[i];
+    for (unsigned int j = 0; j < width; ++j, ++ptr_I1, ++ptr_I2, ++ptr_Ires) {
+      *ptr_Ires = saturate ?
+        vpMath::saturate<unsigned char>(static_cast<short int>(*ptr_I1) - static_cast<short int>(*ptr_I2)) :
+        ((*ptr_I1) - (*ptr_I2));
+    }
   }
 #endif
 }
@@ -567,16 +602,22 @@ double vpImageTools::normalizedCorrelation(const vpImage<double> &I1, const vpIm
   double b2 = 0.0;
 
 #if defined(VISP_HAVE_SIMDLIB)
-  SimdNormalizedCorrelation(I1.bitmap, a, I2.bitmap, b, I1.getSize(), a2, b2, ab, useOptimized);
-#else
-  unsigned int i1_size = I1.getSize();
-  for (unsigned int cpt = 0; cpt < i1_size; ++cpt) {
-    ab += (I1.bitmap[cpt] - a) * (I2.bitmap[cpt] - b);
-    a2 += vpMath::sqr(I1.bitmap[cpt] - a);
-    b2 += vpMath::sqr(I2.bitmap[cpt] - b);
+  if (I1.isContiguous() && I2.isContiguous()) {
+    SimdNormalizedCorrelation(I1.bitmap, a, I2.bitmap, b, I1.getSize(), a2, b2, ab, useOptimized);
+    return ab / sqrt(a2 * b2);
   }
-  (void)useOptimized;
 #endif
+  (void)useOptimized;
+  const unsigned int height = I1.getHeight(), width = I1.getWidth();
+  for (unsigned int i = 0; i < height; ++i) {
+    const double *i1 = I1[i];
+    const double *i2 = I2[i];
+    for (unsigned int j = 0; j < width; ++j) {
+      ab += (i1[j] - a) * (i2[j] - b);
+      a2 += vpMath::sqr(i1[j] - a);
+      b2 += vpMath::sqr(i2[j] - b);
+    }
+  }
 
   return ab / sqrt(a2 * b2);
 }
@@ -860,7 +901,7 @@ double vpImageTools::normalizedCorrelation(const vpImage<double> &I1, const vpIm
   double ab = 0.0;
 
 #if defined(VISP_HAVE_SIMDLIB)
-  SimdNormalizedCorrelation2(I1.bitmap, I1.getWidth(), I2.bitmap, I2.getWidth(), I2.getHeight(), i0, j0, ab);
+  SimdNormalizedCorrelation2(I1.bitmap, I1.getStride(), I2.bitmap, I2.getWidth(), I2.getHeight(), i0, j0, ab);
 #else
   unsigned int i2_height = I2.getHeight();
   unsigned int i2_width = I2.getWidth();
@@ -947,15 +988,22 @@ void vpImageTools::remap(const vpImage<vpRGBa> &I, const vpArray2D<int> &mapU, c
 {
   Iundist.resize(I.getHeight(), I.getWidth());
   const int I_height = static_cast<int>(I.getHeight());
+#if defined(VISP_HAVE_SIMDLIB)
+  // SimdRemap() reads and writes the bitmaps as contiguous arrays
+  const bool contiguous = I.isContiguous() && Iundist.isContiguous();
+#endif
 #if defined(_OPENMP) // only to disable warning: ignoring #pragma omp parallel [-Wunknown-pragmas]
 #pragma omp parallel for schedule(dynamic)
 #endif
   for (int i = 0; i < I_height; ++i) {
 #if defined(VISP_HAVE_SIMDLIB)
-    SimdRemap(reinterpret_cast<unsigned char *>(I.bitmap), 4, I.getWidth(), I.getHeight(),
-              static_cast<size_t>(i) * static_cast<size_t>(I.getWidth()), mapU.data,
-              mapV.data, mapDu.data, mapDv.data, reinterpret_cast<unsigned char *>(Iundist.bitmap));
-#else
+    if (contiguous) {
+      SimdRemap(reinterpret_cast<unsigned char *>(I.bitmap), 4, I.getWidth(), I.getHeight(),
+                static_cast<size_t>(i) * static_cast<size_t>(I.getWidth()), mapU.data,
+                mapV.data, mapDu.data, mapDv.data, reinterpret_cast<unsigned char *>(Iundist.bitmap));
+      continue;
+    }
+#endif
     const unsigned int i_ = static_cast<unsigned int>(i);
     unsigned int i_width = I.getWidth();
     for (unsigned int j = 0; j < i_width; ++j) {
@@ -997,7 +1045,6 @@ void vpImageTools::remap(const vpImage<vpRGBa> &I, const vpArray2D<int> &mapU, c
         Iundist[i][j] = 0;
       }
     }
-#endif
   }
 }
 
@@ -1008,8 +1055,8 @@ void vpImageTools::resizeSimdlib(const vpImage<vpRGBa> &Isrc, unsigned int resiz
   Idst.resize(resizeHeight, resizeWidth);
 
   typedef Simd::View<Simd::Allocator> View;
-  View src(Isrc.getWidth(), Isrc.getHeight(), Isrc.getWidth() * sizeof(vpRGBa), View::Bgra32, Isrc.bitmap);
-  View dst(Idst.getWidth(), Idst.getHeight(), Idst.getWidth() * sizeof(vpRGBa), View::Bgra32, Idst.bitmap);
+  View src(Isrc.getWidth(), Isrc.getHeight(), Isrc.getStride() * sizeof(vpRGBa), View::Bgra32, Isrc.bitmap);
+  View dst(Idst.getWidth(), Idst.getHeight(), Idst.getStride() * sizeof(vpRGBa), View::Bgra32, Idst.bitmap);
 
   Simd::Resize(src, dst, method == INTERPOLATION_LINEAR ? SimdResizeMethodBilinear : SimdResizeMethodArea);
 }
@@ -1020,8 +1067,8 @@ void vpImageTools::resizeSimdlib(const vpImage<unsigned char> &Isrc, unsigned in
   Idst.resize(resizeHeight, resizeWidth);
 
   typedef Simd::View<Simd::Allocator> View;
-  View src(Isrc.getWidth(), Isrc.getHeight(), Isrc.getWidth(), View::Gray8, Isrc.bitmap);
-  View dst(Idst.getWidth(), Idst.getHeight(), Idst.getWidth(), View::Gray8, Idst.bitmap);
+  View src(Isrc.getWidth(), Isrc.getHeight(), Isrc.getStride(), View::Gray8, Isrc.bitmap);
+  View dst(Idst.getWidth(), Idst.getHeight(), Idst.getStride(), View::Gray8, Idst.bitmap);
 
   Simd::Resize(src, dst, method == INTERPOLATION_LINEAR ? SimdResizeMethodBilinear : SimdResizeMethodArea);
 }
@@ -116,6 +116,12 @@ void vpMatrix::blas_dsyev(char jobz, char uplo, unsigned int n_, double *a_data,
 #if !defined(VISP_USE_MSVC) || (defined(VISP_USE_MSVC) && !defined(VISP_BUILD_SHARED_LIBS))
 const unsigned int vpMatrix::m_lapack_min_size_default = 0;
 unsigned int vpMatrix::m_lapack_min_size = vpMatrix::m_lapack_min_size_default;
+#if defined(VISP_HAVE_LAPACK)
+bool vpMatrix::m_native_blas = false;
+#else
+bool vpMatrix::m_native_blas = true;
+#endif
+int vpMatrix::m_native_blas_nb_thread = 1;
 #endif
 
 // Prototypes of specific functions
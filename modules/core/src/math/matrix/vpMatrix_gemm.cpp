@@ -0,0 +1,312 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Built-in cache-blocked matrix-matrix and matrix-vector products.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <visp3/core/vpConfig.h>
+#include <visp3/core/vpMatrix.h>
+
+#ifdef VISP_HAVE_OPENMP
+#include <omp.h>
+#endif
+
+BEGIN_VISP_NAMESPACE
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace
+{
+// Size of the block of C computed in registers by the micro-kernel
+const unsigned int vpGemmMR = 4;
+const unsigned int vpGemmNR = 4;
+// Size of the blocks of op(A) and op(B) packed to remain in cache
+const unsigned int vpGemmMC = 128;
+const unsigned int vpGemmKC = 256;
+const unsigned int vpGemmNC = 2048;
+// Under this number of multiply-add operations, packing costs more than it saves
+const double vpGemmMinPackedSize = 32. * 32. * 32.;
+// Under this number of multiply-add operations, threads cost more than they save
+const double vpGemmMinParallelSize = 64. * 64. * 64.;
+
+inline bool isTransposed(char trans) { return (trans != 'n') && (trans != 'N'); }
+
+// Element (r, c) of op(X), X being stored in column major order
+inline double opElement(const double *x, unsigned int ldx, bool trans, unsigned int r, unsigned int c)
+{
+  return trans ? x[c + (static_cast<size_t>(r) * ldx)] : x[r + (static_cast<size_t>(c) * ldx)];
+}
+
+// Pack the mc x kc block of op(A) starting at (ic, pc) in panels of vpGemmMR rows padded with zeros
+void packA(const double *a, unsigned int lda, bool trans, unsigned int ic, unsigned int pc, unsigned int mc,
+           unsigned int kc, double *buffer)
+{
+  for (unsigned int ir = 0; ir < mc; ir += vpGemmMR) {
+    const unsigned int mr = std::min<unsigned int>(vpGemmMR, mc - ir);
+    for (unsigned int k = 0; k < kc; ++k) {
+      for (unsigned int i = 0; i < mr; ++i) {
+        buffer[i] = opElement(a, lda, trans, ic + ir + i, pc + k);
+      }
+      for (unsigned int i = mr; i < vpGemmMR; ++i) {
+        buffer[i] = 0.;
+      }
+      buffer += vpGemmMR;
+    }
+  }
+}
+
+// Pack the kc x nc block of op(B) starting at (pc, jc) in panels of vpGemmNR columns padded with zeros
+void packB(const double *b, unsigned int ldb, bool trans, unsigned int pc, unsigned int jc, unsigned int kc,
+           unsigned int nc, double *buffer)
+{
+  for (unsigned int jr = 0; jr < nc; jr += vpGemmNR) {
+    const unsigned int nr = std::min<unsigned int>(vpGemmNR, nc - jr);
+    for (unsigned int k = 0; k < kc; ++k) {
+      for (unsigned int j = 0; j < nr; ++j) {
+        buffer[j] = opElement(b, ldb, trans, pc + k, jc + jr + j);
+      }
+      for (unsigned int j = nr; j < vpGemmNR; ++j) {
+        buffer[j] = 0.;
+      }
+      buffer += vpGemmNR;
+    }
+  }
+}
+
+// C(0:mr, 0:nr) += alpha * A_panel * B_panel, the fixed size accumulator being vectorized by the compiler
+inline void microKernel(unsigned int kc, const double *a, const double *b, double alpha, double *c, unsigned int ldc,
+                        unsigned int mr, unsigned int nr)
+{
+  double ab[vpGemmMR * vpGemmNR];
+  for (unsigned int i = 0; i < (vpGemmMR * vpGemmNR); ++i) {
+    ab[i] = 0.;
+  }
+  for (unsigned int k = 0; k < kc; ++k) {
+    for (unsigned int j = 0; j < vpGemmNR; ++j) {
+      const double bj = b[j];
+      for (unsigned int i = 0; i < vpGemmMR; ++i) {
+        ab[(j * vpGemmMR) + i] += a[i] * bj;
+      }
+    }
+    a += vpGemmMR;
+    b += vpGemmNR;
+  }
+  for (unsigned int j = 0; j < nr; ++j) {
+    double *cj = c + (static_cast<size_t>(j) * ldc);
+    for (unsigned int i = 0; i < mr; ++i) {
+      cj[i] += alpha * ab[(j * vpGemmMR) + i];
+    }
+  }
+}
+
+// Dot product with independent partial sums so that the compiler can vectorize it
+inline double dot(const double *x, const double *y, unsigned int n)
+{
+  double s0 = 0., s1 = 0., s2 = 0., s3 = 0.;
+  unsigned int i = 0;
+  for (; (i + 3) < n; i += 4) {
+    s0 += x[i] * y[i];
+    s1 += x[i + 1] * y[i + 1];
+    s2 += x[i + 2] * y[i + 2];
+    s3 += x[i + 3] * y[i + 3];
+  }
+  for (; i < n; ++i) {
+    s0 += x[i] * y[i];
+  }
+  return (s0 + s1) + (s2 + s3);
+}
+} // namespace
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/*!
+ * Set the number of threads used by the built-in Blas kernels for large products.
+ *
+ * \param nbThread : Number of threads. A negative value means that the number of threads is chosen by OpenMP.
+ * Without OpenMP, the kernels always use a single thread.
+ *
+ * \sa setUseNativeBlas()
+ */
+void vpMatrix::setNativeBlasNbThread(int nbThread)
+{
+#ifdef VISP_HAVE_OPENMP
+  m_native_blas_nb_thread = (nbThread < 0) ? omp_get_max_threads() : std::max<int>(nbThread, 1);
+#else
+  (void)nbThread;
+  m_native_blas_nb_thread = 1;
+#endif
+}
+
+/*!
+ * Built-in cache-blocked matrix-matrix product \f$ C = \alpha op(A) op(B) + \beta C \f$ following the Blas dgemm
+ * column major convention, where \f$ op(A) \f$ is a M by K matrix, \f$ op(B) \f$ a K by N matrix and \f$ C \f$ a
+ * M by N matrix.
+ */
+void vpMatrix::native_dgemm(char trans_a, char trans_b, unsigned int M, unsigned int N, unsigned int K, double alpha,
+                            const double *a_data, unsigned int lda, const double *b_data, unsigned int ldb,
+                            double beta, double *c_data, unsigned int ldc)
+{
+  const bool transA = isTransposed(trans_a);
+  const bool transB = isTransposed(trans_b);
+
+  // C = beta C, with C = 0 when beta = 0 even if C contains NaN as required by Blas
+  for (unsigned int j = 0; j < N; ++j) {
+    double *cj = c_data + (static_cast<size_t>(j) * ldc);
+    if (beta == 0.) {
+      std::fill(cj, cj + M, 0.);
+    }
+    else if (beta != 1.) {
+      for (unsigned int i = 0; i < M; ++i) {
+        cj[i] *= beta;
+      }
+    }
+  }
+  if ((alpha == 0.) || (K == 0)) {
+    return;
+  }
+
+  const double size = static_cast<double>(M) * static_cast<double>(N) * static_cast<double>(K);
+  if (size < vpGemmMinPackedSize) {
+    for (unsigned int j = 0; j < N; ++j) {
+      double *cj = c_data + (static_cast<size_t>(j) * ldc);
+      for (unsigned int i = 0; i < M; ++i) {
+        double s = 0.;
+        for (unsigned int k = 0; k < K; ++k) {
+          s += opElement(a_data, lda, transA, i, k) * opElement(b_data, ldb, transB, k, j);
+        }
+        cj[i] += alpha * s;
+      }
+    }
+    return;
+  }
+
+  const int nbThread = m_native_blas_nb_thread;
+  const unsigned int nc_max = std::min<unsigned int>(vpGemmNC, N);
+  const unsigned int kc_max = std::min<unsigned int>(vpGemmKC, K);
+  const unsigned int mc_max = std::min<unsigned int>(vpGemmMC, M);
+  std::vector<double> packedA(static_cast<size_t>(((mc_max + vpGemmMR) - 1) / vpGemmMR) * vpGemmMR * kc_max);
+  std::vector<double> packedB(static_cast<size_t>(((nc_max + vpGemmNR) - 1) / vpGemmNR) * vpGemmNR * kc_max);
+
+  for (unsigned int jc = 0; jc < N; jc += vpGemmNC) {
+    const unsigned int nc = std::min<unsigned int>(vpGemmNC, N - jc);
+    const int nbPanelsB = static_cast<int>(((nc + vpGemmNR) - 1) / vpGemmNR);
+    for (unsigned int pc = 0; pc < K; pc += vpGemmKC) {
+      const unsigned int kc = std::min<unsigned int>(vpGemmKC, K - pc);
+      packB(b_data, ldb, transB, pc, jc, kc, nc, packedB.data());
+      for (unsigned int ic = 0; ic < M; ic += vpGemmMC) {
+        const unsigned int mc = std::min<unsigned int>(vpGemmMC, M - ic);
+        packA(a_data, lda, transA, ic, pc, mc, kc, packedA.data());
+        const double *pA = packedA.data();
+        const double *pB = packedB.data();
+        const bool parallel = (nbThread > 1) && ((static_cast<double>(mc) * nc * kc) >= vpGemmMinParallelSize);
+        (void)parallel;
+        // Each panel of B updates its own columns of C
+#ifdef VISP_HAVE_OPENMP
+#pragma omp parallel for num_threads(nbThread) schedule(static) if(parallel)
+#endif
+        for (int jp = 0; jp < nbPanelsB; ++jp) {
+          const unsigned int jr = static_cast<unsigned int>(jp) * vpGemmNR;
+          const unsigned int nr = std::min<unsigned int>(vpGemmNR, nc - jr);
+          const double *panelB = pB + (static_cast<size_t>(jr) * kc);
+          double *cBlock = c_data + ic + (static_cast<size_t>(jc + jr) * ldc);
+          for (unsigned int ir = 0; ir < mc; ir += vpGemmMR) {
+            const unsigned int mr = std::min<unsigned int>(vpGemmMR, mc - ir);
+            microKernel(kc, pA + (static_cast<size_t>(ir) * kc), panelB, alpha, cBlock + ir, ldc, mr, nr);
+          }
+        }
+      }
+    }
+  }
+}
+
+/*!
+ * Built-in matrix-vector product \f$ y = \alpha op(A) x + \beta y \f$ following the Blas dgemv column major
+ * convention, where \f$ A \f$ is a M by N matrix.
+ */
+void vpMatrix::native_dgemv(char trans, unsigned int M, unsigned int N, double alpha, const double *a_data,
+                            unsigned int lda, const double *x_data, int incx, double beta, double *y_data, int incy)
+{
+  const bool transA = isTransposed(trans);
+  const unsigned int ySize = transA ? N : M;
+  const unsigned int xSize = transA ? M : N;
+  const int nbThread = m_native_blas_nb_thread;
+  const bool parallel = (nbThread > 1) && ((static_cast<double>(M) * N) >= vpGemmMinParallelSize);
+  (void)parallel;
+
+  if ((incx != 1) || (incy != 1)) {
+    // Generic strided vectors
+    for (unsigned int i = 0; i < ySize; ++i) {
+      double s = 0.;
+      for (unsigned int k = 0; k < xSize; ++k) {
+        s += opElement(a_data, lda, transA, i, k) * x_data[static_cast<ptrdiff_t>(k) * incx];
+      }
+      double &yi = y_data[static_cast<ptrdiff_t>(i) * incy];
+      yi = (beta == 0.) ? alpha * s : (alpha * s) + (beta * yi);
+    }
+    return;
+  }
+
+  if (transA) {
+    // y(j) = alpha A(:, j).x + beta y(j) where columns of A are contiguous
+#ifdef VISP_HAVE_OPENMP
+#pragma omp parallel for num_threads(nbThread) schedule(static) if(parallel)
+#endif
+    for (int j = 0; j < static_cast<int>(N); ++j) {
+      const double s = dot(a_data + (static_cast<size_t>(j) * lda), x_data, M);
+      y_data[j] = (beta == 0.) ? alpha * s : (alpha * s) + (beta * y_data[j]);
+    }
+  }
+  else {
+    // y = alpha sum_j A(:, j) x(j) + beta y, computed by blocks of rows so that threads write different elements
+    const int blockSize = 256;
+    const int nbBlocks = static_cast<int>((M + blockSize) - 1) / blockSize;
+#ifdef VISP_HAVE_OPENMP
+#pragma omp parallel for num_threads(nbThread) schedule(static) if(parallel)
+#endif
+    for (int b = 0; b < nbBlocks; ++b) {
+      const unsigned int i0 = static_cast<unsigned int>(b * blockSize);
+      const unsigned int i1 = std::min<unsigned int>(i0 + blockSize, M);
+      double *y = y_data;
+      for (unsigned int i = i0; i < i1; ++i) {
+        y[i] = (beta == 0.) ? 0. : beta * y[i];
+      }
+      for (unsigned int j = 0; j < N; ++j) {
+        const double *aj = a_data + (static_cast<size_t>(j) * lda);
+        const double t = alpha * x_data[j];
+        for (unsigned int i = i0; i < i1; ++i) {
+          y[i] += aj[i] * t;
+        }
+      }
+    }
+  }
+}
+
+END_VISP_NAMESPACE
@@ -46,6 +46,10 @@ void vpMatrix::blas_dgemm(char trans_a, char trans_b, unsigned int M_, unsigned
                           double *a_data, unsigned int lda_, double *b_data, unsigned int ldb_, double beta,
                           double *c_data, unsigned int ldc_)
 {
+  if (m_native_blas) {
+    native_dgemm(trans_a, trans_b, M_, N_, K_, alpha, a_data, lda_, b_data, ldb_, beta, c_data, ldc_);
+    return;
+  }
   MKL_INT M = static_cast<MKL_INT>(M_);
   MKL_INT N = static_cast<MKL_INT>(N_);
   MKL_INT K = static_cast<MKL_INT>(K_);
@@ -59,6 +63,10 @@ void vpMatrix::blas_dgemm(char trans_a, char trans_b, unsigned int M_, unsigned
 void vpMatrix::blas_dgemv(char trans, unsigned int M_, unsigned int N_, double alpha, double *a_data, unsigned int lda_,
                           double *x_data, int incx_, double beta, double *y_data, int incy_)
 {
+  if (m_native_blas) {
+    native_dgemv(trans, M_, N_, alpha, a_data, lda_, x_data, incx_, beta, y_data, incy_);
+    return;
+  }
   MKL_INT M = static_cast<MKL_INT>(M_);
   MKL_INT N = static_cast<MKL_INT>(N_);
   MKL_INT lda = static_cast<MKL_INT>(lda_);
@@ -89,6 +97,11 @@ void vpMatrix::blas_dgemv(char trans, unsigned int M_, unsigned int N_, double a
                             double *A_data, unsigned int lda, double *B_data, unsigned int ldb, double beta,
                             double *C_data, unsigned int ldc)
 {
+  if (m_native_blas) {
+    // GSL matrices are row major: C^T = op(B)^T op(A)^T in column major
+    native_dgemm(trans_b, trans_a, N, M, K, alpha, B_data, ldb, A_data, lda, beta, C_data, ldc);
+    return;
+  }
   CBLAS_TRANSPOSE_t TransA = (trans_a == 'n' || trans_a == 'N') ? CblasNoTrans : CblasTrans;
   CBLAS_TRANSPOSE_t TransB = (trans_b == 'n' || trans_b == 'N') ? CblasNoTrans : CblasTrans;
 
@@ -112,6 +125,12 @@ void vpMatrix::blas_dgemv(char trans, unsigned int M_, unsigned int N_, double a
 void vpMatrix::blas_dgemv(char trans, unsigned int M, unsigned int N, double alpha, double *A_data, unsigned int lda,
                           double *x_data, int incx, double beta, double *y_data, int incy)
 {
+  if (m_native_blas) {
+    // GSL matrices are row major: A is seen as its transpose in column major
+    char native_trans = ((trans == 'n') || (trans == 'N')) ? 't' : 'n';
+    native_dgemv(native_trans, N, M, alpha, A_data, lda, x_data, incx, beta, y_data, incy);
+    return;
+  }
   CBLAS_TRANSPOSE_t Trans = (trans == 'n' || trans == 'N') ? CblasNoTrans : CblasTrans;
 
   unsigned int A_rows = (Trans == CblasNoTrans) ? M : N;
@@ -141,6 +160,10 @@ void vpMatrix::blas_dgemm(char trans_a, char trans_b, unsigned int M_, unsigned
                           double *a_data, unsigned int lda_, double *b_data, unsigned int ldb_, double beta,
                           double *c_data, unsigned int ldc_)
 {
+  if (m_native_blas) {
+    native_dgemm(trans_a, trans_b, M_, N_, K_, alpha, a_data, lda_, b_data, ldb_, beta, c_data, ldc_);
+    return;
+  }
   integer M = static_cast<integer>(M_);
   integer K = static_cast<integer>(K_);
   integer N = static_cast<integer>(N_);
@@ -154,6 +177,10 @@ void vpMatrix::blas_dgemm(char trans_a, char trans_b, unsigned int M_, unsigned
 void vpMatrix::blas_dgemv(char trans, unsigned int M_, unsigned int N_, double alpha, double *a_data, unsigned int lda_,
                           double *x_data, int incx_, double beta, double *y_data, int incy_)
 {
+  if (m_native_blas) {
+    native_dgemv(trans, M_, N_, alpha, a_data, lda_, x_data, incx_, beta, y_data, incy_);
+    return;
+  }
   integer M = static_cast<integer>(M_);
   integer N = static_cast<integer>(N_);
   integer lda = static_cast<integer>(lda_);
@@ -165,9 +192,21 @@ void vpMatrix::blas_dgemv(char trans, unsigned int M_, unsigned int N_, double a
 #endif
 END_VISP_NAMESPACE
 #else
-// Work around to avoid warning LNK4221: This object file does not define any
-// previously undefined public symbols
-void dummy_vpMatrix_blas() {}
+BEGIN_VISP_NAMESPACE
+// Without Blas/Lapack third party, the products of large matrices use the built-in kernels
+void vpMatrix::blas_dgemm(char trans_a, char trans_b, unsigned int M_, unsigned int N_, unsigned int K_, double alpha,
+                          double *a_data, unsigned int lda_, double *b_data, unsigned int ldb_, double beta,
+                          double *c_data, unsigned int ldc_)
+{
+  native_dgemm(trans_a, trans_b, M_, N_, K_, alpha, a_data, lda_, b_data, ldb_, beta, c_data, ldc_);
+}
+
+void vpMatrix::blas_dgemv(char trans, unsigned int M_, unsigned int N_, double alpha, double *a_data, unsigned int lda_,
+                          double *x_data, int incx_, double beta, double *y_data, int incy_)
+{
+  native_dgemv(trans, M_, N_, alpha, a_data, lda_, x_data, incx_, beta, y_data, incy_);
+}
+END_VISP_NAMESPACE
 #endif
 
 #endif // #ifndef DOXYGEN_SHOULD_SKIP_THIS
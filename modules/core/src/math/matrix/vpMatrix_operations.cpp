@@ -110,14 +110,10 @@ void vpMatrix::multMatrixVector(const vpMatrix &A, const vpColVector &v, vpColVe
     w.resize(A.rowNum, false);
   }
 
-  // If available use Lapack only for large matrices
+  // Use Lapack, or the built-in Blas kernels when Lapack is not available, only for large matrices
   bool useLapack = ((A.rowNum > vpMatrix::m_lapack_min_size) || (A.colNum > vpMatrix::m_lapack_min_size));
-#if !defined(VISP_HAVE_LAPACK)
-  useLapack = false;
-#endif
 
   if (useLapack) {
-#if defined(VISP_HAVE_LAPACK)
     double alpha = 1.0;
     double beta = 0.0;
     int incr = 1;
@@ -128,7 +124,6 @@ void vpMatrix::multMatrixVector(const vpMatrix &A, const vpColVector &v, vpColVe
 #else // BLAS matrix is column major
     const char trans = 't';
     vpMatrix::blas_dgemv(trans, A.colNum, A.rowNum, alpha, A.data, A.colNum, v.data, incr, beta, w.data, incr);
-#endif
 #endif
   }
   else {
@@ -166,15 +161,11 @@ void vpMatrix::mult2Matrices(const vpMatrix &A, const vpMatrix &B, vpMatrix &C)
                       A.getCols(), B.getRows(), B.getCols()));
   }
 
-  // If available use Lapack only for large matrices
+  // Use Lapack, or the built-in Blas kernels when Lapack is not available, only for large matrices
   bool useLapack = ((A.getRows() > vpMatrix::m_lapack_min_size) || (A.getCols() > vpMatrix::m_lapack_min_size) ||
                     (B.getCols() > vpMatrix::m_lapack_min_size));
-#if !defined(VISP_HAVE_LAPACK)
-  useLapack = false;
-#endif
 
   if (useLapack) {
-#if defined(VISP_HAVE_LAPACK)
     const double alpha = 1.0;
     const double beta = 0.0;
     const char trans = 'n';
@@ -185,7 +176,6 @@ void vpMatrix::mult2Matrices(const vpMatrix &A, const vpMatrix &B, vpMatrix &C)
 #else
     vpMatrix::blas_dgemm(trans, trans, B.getCols(), A.getRows(), A.getCols(), alpha, B.data, B.getCols(), A.data, A.getCols(), beta,
                          C.data, B.getCols());
-#endif
 #endif
   }
   else {
@@ -226,15 +216,11 @@ void vpMatrix::mult2Matrices(const vpMatrix &A, const vpRotationMatrix &B, vpMat
                       A.getCols(), B.getRows(), B.getCols()));
   }
 
-  // If available use Lapack only for large matrices
+  // Use Lapack, or the built-in Blas kernels when Lapack is not available, only for large matrices
   bool useLapack = ((A.getRows() > vpMatrix::m_lapack_min_size) || (A.getCols() > vpMatrix::m_lapack_min_size) ||
                     (B.getCols() > vpMatrix::m_lapack_min_size));
-#if !defined(VISP_HAVE_LAPACK)
-  useLapack = false;
-#endif
 
   if (useLapack) {
-#if defined(VISP_HAVE_LAPACK)
     const double alpha = 1.0;
     const double beta = 0.0;
     const char trans = 'n';
@@ -245,7 +231,6 @@ void vpMatrix::mult2Matrices(const vpMatrix &A, const vpRotationMatrix &B, vpMat
 #else
     vpMatrix::blas_dgemm(trans, trans, B.getCols(), A.getRows(), A.getCols(), alpha, B.data, B.getCols(), A.data, A.getCols(), beta,
                          C.data, B.getCols());
-#endif
 #endif
   }
   else {
@@ -285,15 +270,11 @@ void vpMatrix::mult2Matrices(const vpRotationMatrix &A, const vpMatrix &B, vpMat
                       A.getCols(), B.getRows(), B.getCols()));
   }
 
-  // If available use Lapack only for large matrices
+  // Use Lapack, or the built-in Blas kernels when Lapack is not available, only for large matrices
   bool useLapack = ((A.getRows() > vpMatrix::m_lapack_min_size) || (A.getCols() > vpMatrix::m_lapack_min_size) ||
                     (B.colNum > vpMatrix::m_lapack_min_size));
-#if !defined(VISP_HAVE_LAPACK)
-  useLapack = false;
-#endif
 
   if (useLapack) {
-#if defined(VISP_HAVE_LAPACK)
     const double alpha = 1.0;
     const double beta = 0.0;
     const char trans = 'n';
@@ -304,7 +285,6 @@ void vpMatrix::mult2Matrices(const vpRotationMatrix &A, const vpMatrix &B, vpMat
 #else
     vpMatrix::blas_dgemm(trans, trans, B.getCols(), A.getRows(), A.getCols(), alpha, B.data, B.getCols(), A.data, A.getCols(), beta,
                          C.data, B.getCols());
-#endif
 #endif
   }
   else {
@@ -384,15 +364,11 @@ void vpMatrix::mult2Matrices(const vpMatrix &A, const vpMatrix &B, vpHomogeneous
                       A.getRows(), A.getCols(), B.getRows(), B.getCols()));
   }
 
-  // If available use Lapack only for large matrices
+  // Use Lapack, or the built-in Blas kernels when Lapack is not available, only for large matrices
   bool useLapack = ((A.rowNum > vpMatrix::m_lapack_min_size) || (A.colNum > vpMatrix::m_lapack_min_size) ||
                     (B.colNum > vpMatrix::m_lapack_min_size));
-#if !defined(VISP_HAVE_LAPACK)
-  useLapack = false;
-#endif
 
   if (useLapack) {
-#if defined(VISP_HAVE_LAPACK)
     const double alpha = 1.0;
     const double beta = 0.0;
     const char trans = 'n';
@@ -403,7 +379,6 @@ void vpMatrix::mult2Matrices(const vpMatrix &A, const vpMatrix &B, vpHomogeneous
 #else
     vpMatrix::blas_dgemm(trans, trans, B.getCols(), A.getRows(), A.getCols(), alpha, B.data, B.getCols(), A.data, A.getCols(), beta,
                          C.data, B.getCols());
-#endif
 #endif
   }
   else {
@@ -667,14 +642,10 @@ void vpMatrix::AAt(vpMatrix &B) const
     B.resize(rowNum, rowNum, false, false);
   }
 
-  // If available use Lapack only for large matrices
+  // Use Lapack, or the built-in Blas kernels when Lapack is not available, only for large matrices
   bool useLapack = ((rowNum > vpMatrix::m_lapack_min_size) || (colNum > vpMatrix::m_lapack_min_size));
-#if !defined(VISP_HAVE_LAPACK)
-  useLapack = false;
-#endif
 
   if (useLapack) {
-#if defined(VISP_HAVE_LAPACK)
     const double alpha = 1.0;
     const double beta = 0.0;
 
@@ -687,7 +658,6 @@ void vpMatrix::AAt(vpMatrix &B) const
 #endif
 
     vpMatrix::blas_dgemm(transa, transb, rowNum, rowNum, colNum, alpha, data, colNum, data, colNum, beta, B.data, rowNum);
-#endif
   }
   else {
     // compute A*A^T
@@ -730,14 +700,10 @@ void vpMatrix::AtA(vpMatrix &B) const
     B.resize(colNum, colNum, false, false);
   }
 
-  // If available use Lapack only for large matrices
+  // Use Lapack, or the built-in Blas kernels when Lapack is not available, only for large matrices
   bool useLapack = ((rowNum > vpMatrix::m_lapack_min_size) || (colNum > vpMatrix::m_lapack_min_size));
-#if !defined(VISP_HAVE_LAPACK)
-  useLapack = false;
-#endif
 
   if (useLapack) {
-#if defined(VISP_HAVE_LAPACK)
     const double alpha = 1.0;
     const double beta = 0.0;
 
@@ -750,7 +716,6 @@ void vpMatrix::AtA(vpMatrix &B) const
     const char transb = 't';
 
     vpMatrix::blas_dgemm(transa, transb, colNum, colNum, rowNum, alpha, data, colNum, data, colNum, beta, B.data, colNum);
-#endif
 #endif
   }
   else {
@@ -497,15 +497,11 @@ vpMatrix vpMatrix::operator*(const vpVelocityTwistMatrix &V) const
   const unsigned int val_6 = 6;
   M.resize(rowNum, val_6, false, false);
 
-  // If available use Lapack only for large matrices
+  // Use Lapack, or the built-in Blas kernels when Lapack is not available, only for large matrices
   bool useLapack = ((rowNum > vpMatrix::m_lapack_min_size) || (colNum > vpMatrix::m_lapack_min_size) ||
                     (V.colNum > vpMatrix::m_lapack_min_size));
-#if !defined(VISP_HAVE_LAPACK)
-  useLapack = false;
-#endif
 
   if (useLapack) {
-#if defined(VISP_HAVE_LAPACK)
     const double alpha = 1.0;
     const double beta = 0.0;
     const char trans = 'n';
@@ -515,7 +511,6 @@ vpMatrix vpMatrix::operator*(const vpVelocityTwistMatrix &V) const
 #else
     vpMatrix::blas_dgemm(trans, trans, V.colNum, rowNum, colNum, alpha, V.data, V.colNum, data, colNum, beta, M.data,
                          M.colNum);
-#endif
 #endif
   }
   else {
@@ -555,15 +550,11 @@ vpMatrix vpMatrix::operator*(const vpForceTwistMatrix &V) const
   const unsigned int val_6 = 6;
   M.resize(rowNum, val_6, false, false);
 
-  // If available use Lapack only for large matrices
+  // Use Lapack, or the built-in Blas kernels when Lapack is not available, only for large matrices
   bool useLapack = ((rowNum > vpMatrix::m_lapack_min_size) || (colNum > vpMatrix::m_lapack_min_size) ||
                     (V.getCols() > vpMatrix::m_lapack_min_size));
-#if !defined(VISP_HAVE_LAPACK)
-  useLapack = false;
-#endif
 
   if (useLapack) {
-#if defined(VISP_HAVE_LAPACK)
     const double alpha = 1.0;
     const double beta = 0.0;
     const char trans = 'n';
@@ -573,7 +564,6 @@ vpMatrix vpMatrix::operator*(const vpForceTwistMatrix &V) const
 #else
     vpMatrix::blas_dgemm(trans, trans, V.getCols(), rowNum, colNum, alpha, V.data, V.getCols(), data, colNum, beta, M.data,
                          M.colNum);
-#endif
 #endif
   }
   else {
@@ -35,7 +35,7 @@
   \file vpRobust.cpp
 */
 
-#include <algorithm> // std::swap
+#include <algorithm> // std::nth_element
 #include <cmath>     // std::fabs
 #include <limits>    // numeric_limits
 #include <stdio.h>
@@ -55,7 +55,7 @@ vpRobust::vpRobust()
 #if defined(VISP_BUILD_DEPRECATED_FUNCTIONS)
   m_iter(0),
 #endif
-  m_size(0), m_mad(0)
+  m_size(0), m_mad(0), m_approx_median_threshold(0), m_histogram()
 {}
 
 /*!
@@ -78,6 +78,7 @@ vpRobust &vpRobust::operator=(const vpRobust &other)
   m_iter = other.m_iter;
 #endif
   m_size = other.m_size;
+  m_approx_median_threshold = other.m_approx_median_threshold;
   return *this;
 }
 
@@ -96,10 +97,27 @@ vpRobust &vpRobust::operator=(const vpRobust &&other)
   m_iter = std::move(other.m_iter);
 #endif
   m_size = std::move(other.m_size);
+  m_approx_median_threshold = std::move(other.m_approx_median_threshold);
   return *this;
 }
 #endif
 
+/*!
+  Enable the approximation of the median and of the Median Absolute Deviation (MAD) computed in MEstimator()
+  for large residual vectors.
+
+  When the number of residues is greater or equal to \e nbResidues, the median and the MAD are no longer
+  computed exactly by partially sorting a copy of the residues, but are read from two successive histograms
+  of 1024 bins. The residues are then only read, without being copied, and the error on the median is
+  bounded by the width of a bin of the second histogram, i.e. by the residual range divided by \f$ 1024^2 \f$.
+
+  \param nbResidues : Minimal number of residues from which the approximation is used. Set to 0 (default value)
+  to always compute the exact median.
+
+  \sa getMedianApproximationThreshold()
+*/
+void vpRobust::setMedianApproximationThreshold(unsigned int nbResidues) { m_approx_median_threshold = nbResidues; }
+
 /*!
   Resize containers.
   \param n_data : size of input data vector.
@@ -136,23 +154,38 @@ void vpRobust::MEstimator(const vpRobustEstimatorType method, const vpColVector
   unsigned int n_data = residues.getRows();
   weights.resize(n_data, false);
   resize(n_data);
-
-  m_sorted_residues = residues;
+  if (n_data == 0) {
+    return;
+  }
 
   unsigned int ind_med = static_cast<unsigned int>(ceil(n_data / 2.0)) - 1;
+  bool approx = (m_approx_median_threshold > 0) && (n_data >= m_approx_median_threshold);
 
   // Calculate median
-  med = select(m_sorted_residues, 0, static_cast<int>(n_data) - 1, static_cast<int>(ind_med));
+  if (approx) {
+    med = selectApprox(residues.data, n_data, ind_med);
+  }
+  else {
+    m_sorted_residues = residues;
+    med = select(m_sorted_residues, 0, static_cast<int>(n_data) - 1, static_cast<int>(ind_med));
+  }
   // --comment: residualMedian = med
 
   // Normalize residues
+  const double *res = residues.data;
+  double *normres = m_normres.data;
   for (unsigned int i = 0; i < n_data; ++i) {
-    m_normres[i] = (fabs(residues[i] - med));
-    m_sorted_normres[i] = (fabs(m_sorted_residues[i] - med));
+    normres[i] = std::fabs(res[i] - med);
   }
 
   // Calculate MAD
-  normmedian = select(m_sorted_normres, 0, static_cast<int>(n_data) - 1, static_cast<int>(ind_med));
+  if (approx) {
+    normmedian = selectApprox(m_normres.data, n_data, ind_med);
+  }
+  else {
+    m_sorted_normres = m_normres;
+    normmedian = select(m_sorted_normres, 0, static_cast<int>(n_data) - 1, static_cast<int>(ind_med));
+  }
   // normalizedResidualMedian = normmedian ;
   // 1.48 keeps scale estimate consistent for a normal probability dist.
   m_mad = 1.4826 * normmedian; // median Absolute Deviation
@@ -192,21 +225,17 @@ void vpRobust::MEstimator(const vpRobustEstimatorType method, const vpColVector
 void vpRobust::psiTukey(double sigma, const vpColVector &x, vpColVector &weights)
 {
   unsigned int n_data = x.getRows();
-  double C = sigma * 4.6851;
-
   // Here we consider that sigma cannot be equal to 0
+  double inv_C = 1. / (sigma * 4.6851);
+  const double *px = x.data;
+  double *pw = weights.data;
+
+  // Branch-free loop that the compiler is able to vectorize
   for (unsigned int i = 0; i < n_data; ++i) {
-    double xi = x[i] / C;
+    double xi = px[i] * inv_C;
     xi *= xi;
-
-    if (xi > 1.) {
-      weights[i] = 0;
-    }
-    else {
-      xi = 1 - xi;
-      xi *= xi;
-      weights[i] = xi;
-    }
+    double wi = 1. - xi;
+    pw[i] = (xi > 1.) ? 0. : wi * wi;
   }
 }
 
@@ -221,15 +250,13 @@ void vpRobust::psiHuber(double sigma, const vpColVector &x, vpColVector &weights
 {
   double C = sigma * 1.2107;
   unsigned int n_data = x.getRows();
+  const double *px = x.data;
+  double *pw = weights.data;
 
+  // Branch-free loop that the compiler is able to vectorize
   for (unsigned int i = 0; i < n_data; ++i) {
-    double xi = x[i] / C;
-    if (fabs(xi) > 1.) {
-      weights[i] = std::fabs(1. / xi);
-    }
-    else {
-      weights[i] = 1;
-    }
+    double xi = std::fabs(px[i]);
+    pw[i] = (xi > C) ? (C / xi) : 1.;
   }
 }
 
@@ -244,45 +271,23 @@ void vpRobust::psiHuber(double sigma, const vpColVector &x, vpColVector &weights
 void vpRobust::psiCauchy(double sigma, const vpColVector &x, vpColVector &weights)
 {
   unsigned int n_data = x.getRows();
-  double C = sigma * 2.3849;
+  double inv_C = 1. / (sigma * 2.3849);
+  const double *px = x.data;
+  double *pw = weights.data;
 
   // Calculate Cauchy's equation
   for (unsigned int i = 0; i < n_data; ++i) {
-    weights[i] = 1. / (1. + vpMath::sqr(x[i] / C));
+    double xi = px[i] * inv_C;
+    pw[i] = 1. / (1. + (xi * xi));
   }
 }
 
 /*!
-  Partition function.
-  \param a : vector to be sorted.
-  \param l : first value to be considered.
-  \param r : last value to be considered.
-*/
-int vpRobust::partition(vpColVector &a, int l, int r)
-{
-  int i = l - 1;
-  int j = r;
-  double v = a[static_cast<unsigned int>(r)];
+  \brief Partially sort a part of a vector and select a value of this new vector.
 
-  for (;;) {
-    while (a[static_cast<unsigned int>(++i)] < v) { }
+  After the call, the value at index \e k is the one that would be at this index if a[l..r] was sorted, all the
+  values before are lower or equal, and all the values after are greater or equal.
 
-    while (v < a[static_cast<unsigned int>(--j)]) {
-      if (j == l) {
-        break;
-      }
-    }
-    if (i >= j) {
-      break;
-    }
-    std::swap(a[static_cast<unsigned int>(i)], a[static_cast<unsigned int>(j)]);
-  }
-  std::swap(a[static_cast<unsigned int>(i)], a[static_cast<unsigned int>(r)]);
-  return i;
-}
-
-/*!
-  \brief Sort a part of a vector and select a value of this new vector.
   \param a : vector to be sorted
   \param l : first value to be considered
   \param r : last value to be considered
@@ -290,16 +295,77 @@ int vpRobust::partition(vpColVector &a, int l, int r)
 */
 double vpRobust::select(vpColVector &a, int l, int r, int k)
 {
-  while (r > l) {
-    int i = partition(a, l, r);
-    if (i >= k) {
-      r = i - 1;
+  if (r > l) {
+    std::nth_element(a.data + l, a.data + k, a.data + r + 1);
+  }
+  return a[static_cast<unsigned int>(k)];
+}
+
+/*!
+  \brief Approximate the k-th smallest value of an array without modifying it.
+
+  A first histogram of the values between their min and max is used to find the bin that contains the k-th
+  smallest value. A second histogram restricted to this bin refines the estimate that is finally
+  interpolated linearly inside the selected bin of the second histogram.
+
+  \param a : Array of values.
+  \param n : Number of values.
+  \param k : Rank of the value to be selected, with \e k < \e n.
+  \return Approximation of the value that is at index \e k when the array is sorted.
+*/
+double vpRobust::selectApprox(const double *a, unsigned int n, unsigned int k)
+{
+  const unsigned int nb_bins = 1024;
+  const unsigned int nb_levels = 2;
+
+  double lo = a[0];
+  double hi = a[0];
+  for (unsigned int i = 1; i < n; ++i) {
+    lo = std::min<double>(lo, a[i]);
+    hi = std::max<double>(hi, a[i]);
+  }
+
+  m_histogram.resize(nb_bins);
+  unsigned int k_bin = k; // Rank of the value among the ones in [lo, hi]
+  for (unsigned int level = 0; level < nb_levels; ++level) {
+    double width = (hi - lo) / nb_bins;
+    if (!(width > 0.)) {
+      return lo;
+    }
+    double inv_width = 1. / width;
+
+    std::fill(m_histogram.begin(), m_histogram.end(), 0u);
+    unsigned int nb_inside = 0;
+    for (unsigned int i = 0; i < n; ++i) {
+      double v = a[i];
+      if ((v >= lo) && (v <= hi)) {
+        unsigned int bin = std::min<unsigned int>(static_cast<unsigned int>((v - lo) * inv_width), nb_bins - 1);
+        ++m_histogram[bin];
+        ++nb_inside;
+      }
+    }
+    if (nb_inside == 0) {
+      return 0.5 * (lo + hi);
+    }
+    // Rounding may move a few values at the boundaries of the refined range
+    k_bin = std::min<unsigned int>(k_bin, nb_inside - 1);
+
+    unsigned int bin = 0;
+    unsigned int cumul = 0;
+    while ((cumul + m_histogram[bin]) <= k_bin) {
+      cumul += m_histogram[bin];
+      ++bin;
     }
-    if (i <= k) {
-      l = i + 1;
+    k_bin -= cumul;
+    lo += bin * width;
+    hi = lo + width;
+
+    if (level == (nb_levels - 1)) {
+      return lo + (((k_bin + 0.5) / m_histogram[bin]) * width);
     }
   }
-  return a[static_cast<unsigned int>(k)];
+
+  return lo;
 }
 
 /**********************
@@ -315,7 +381,7 @@ vpRobust::vpRobust(unsigned int n_data)
 #if defined(VISP_BUILD_DEPRECATED_FUNCTIONS)
   m_iter(0),
 #endif
-  m_size(n_data), m_mad(0)
+  m_size(n_data), m_mad(0), m_approx_median_threshold(0), m_histogram()
 {
   m_normres.resize(n_data);
   m_sorted_normres.resize(n_data);
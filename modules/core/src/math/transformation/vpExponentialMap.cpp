@@ -74,52 +74,72 @@ vpHomogeneousMatrix vpExponentialMap::direct(const vpColVector &v) { return vpEx
 vpHomogeneousMatrix vpExponentialMap::direct(const vpColVector &v, const double &delta_t)
 {
   const unsigned int v_size = 6;
-  const unsigned int index_0 = 0;
-  const unsigned int index_1 = 1;
-  const unsigned int index_2 = 2;
-  const unsigned int index_3 = 3;
-  const unsigned int index_4 = 4;
-  const unsigned int index_5 = 5;
 
   if (v.size() != v_size) {
     throw(vpException(vpException::dimensionError,
                       "Cannot compute direct exponential map from a %d-dim velocity vector. Should be 6-dim.",
                       v.size()));
   }
-  double theta, si, co, sinc, mcosc, msinc;
-  vpThetaUVector u;
-  vpRotationMatrix rd;
-  vpTranslationVector dt;
+  vpHomogeneousMatrix Delta;
+  direct(vpMatrixFixed<6, 1>(v), delta_t).copyTo(Delta);
 
-  vpColVector v_dt = v * delta_t;
+  return Delta;
+}
 
-  u[index_0] = v_dt[index_3];
-  u[index_1] = v_dt[index_4];
-  u[index_2] = v_dt[index_5];
-  rd.buildFrom(u);
+/*!
 
-  theta = sqrt((u[index_0] * u[index_0]) + (u[index_1] * u[index_1]) + (u[index_2] * u[index_2]));
-  si = sin(theta);
-  co = cos(theta);
-  sinc = vpMath::sinc(si, theta);
-  mcosc = vpMath::mcosc(co, theta);
-  msinc = vpMath::msinc(si, theta);
+  Compute the exponential map without any heap allocation. The inverse function is inverse().
 
-  dt[index_0] = ((v_dt[index_0] * (sinc + (u[index_0] * u[index_0] * msinc))) +
-          (v_dt[index_1] * ((u[index_0] * u[index_1] * msinc) - (u[index_2] * mcosc)))) +
-    (v_dt[index_2] * ((u[index_0] * u[index_2] * msinc) + (u[index_1] * mcosc)));
+  \param v : Instantaneous velocity skew represented by a 6 dimension
+  vector \f$ {\bf v} = [v, \omega] \f$ where \f$ v \f$ is a translation
+  velocity vector and \f$ \omega \f$ is a rotation velocity vector.
 
-  dt[index_1] = ((v_dt[index_0] * ((u[index_0] * u[index_1] * msinc) + (u[index_2] * mcosc))) +
-          (v_dt[index_1] * (sinc + (u[index_1] * u[index_1] * msinc)))) +
-    (v_dt[index_2] * ((u[index_1] * u[index_2] * msinc) - (u[index_0] * mcosc)));
+  \param delta_t : Sampling time \f$ \Delta t \f$. Time during which the
+  velocity \f$ \bf v \f$ is applied.
 
-  dt[index_2] = ((v_dt[index_0] * ((u[index_0] * u[index_2] * msinc) - (u[index_1] * mcosc))) +
-          (v_dt[index_1] * ((u[index_1] * u[index_2] * msinc) + (u[index_0] * mcosc)))) +
-    (v_dt[index_2] * (sinc + (u[index_2] * u[index_2] * msinc)));
+  \return The 4-by-4 homogeneous matrix \f$ {\bf M} = \exp{({\bf v} \Delta t)} \f$.
 
-  vpHomogeneousMatrix Delta;
-  Delta.insert(rd);
-  Delta.insert(dt);
+  \sa direct(const vpColVector &, const double &)
+*/
+vpMatrixFixed<4, 4> vpExponentialMap::direct(const vpMatrixFixed<6, 1> &v, const double &delta_t)
+{
+  const double *v_ = v.data();
+  const double vx = v_[0] * delta_t;
+  const double vy = v_[1] * delta_t;
+  const double vz = v_[2] * delta_t;
+  const double ux = v_[3] * delta_t;
+  const double uy = v_[4] * delta_t;
+  const double uz = v_[5] * delta_t;
+
+  const double theta = sqrt((ux * ux) + (uy * uy) + (uz * uz));
+  const double si = sin(theta);
+  const double co = cos(theta);
+  const double sinc = vpMath::sinc(si, theta);
+  const double mcosc = vpMath::mcosc(co, theta);
+  const double msinc = vpMath::msinc(si, theta);
+
+  vpMatrixFixed<4, 4> Delta;
+  double *M = Delta.data();
+
+  // Rotation from the theta u vector, as in vpRotationMatrix::buildFrom(const vpThetaUVector &)
+  M[0] = co + (mcosc * ux * ux);
+  M[1] = (-sinc * uz) + (mcosc * ux * uy);
+  M[2] = (sinc * uy) + (mcosc * ux * uz);
+  M[4] = (sinc * uz) + (mcosc * uy * ux);
+  M[5] = co + (mcosc * uy * uy);
+  M[6] = (-sinc * ux) + (mcosc * uy * uz);
+  M[8] = (-sinc * uy) + (mcosc * uz * ux);
+  M[9] = (sinc * ux) + (mcosc * uz * uy);
+  M[10] = co + (mcosc * uz * uz);
+
+  M[3] = ((vx * (sinc + (ux * ux * msinc))) + (vy * ((ux * uy * msinc) - (uz * mcosc)))) +
+    (vz * ((ux * uz * msinc) + (uy * mcosc)));
+  M[7] = ((vx * ((ux * uy * msinc) + (uz * mcosc))) + (vy * (sinc + (uy * uy * msinc)))) +
+    (vz * ((uy * uz * msinc) - (ux * mcosc)));
+  M[11] = ((vx * ((ux * uz * msinc) - (uy * mcosc))) + (vy * ((uy * uz * msinc) + (ux * mcosc)))) +
+    (vz * (sinc + (uz * uz * msinc)));
+
+  M[15] = 1.;
 
   return Delta;
 }
@@ -40,6 +40,7 @@
 #include <visp3/core/vpException.h>
 #include <visp3/core/vpHomogeneousMatrix.h>
 #include <visp3/core/vpMatrix.h>
+#include <visp3/core/vpMatrixFixed.h>
 #include <visp3/core/vpPoint.h>
 #include <visp3/core/vpQuaternionVector.h>
 
@@ -588,23 +589,7 @@ vpHomogeneousMatrix &vpHomogeneousMatrix::operator=(const vpHomogeneousMatrix &M
 vpHomogeneousMatrix vpHomogeneousMatrix::operator*(const vpHomogeneousMatrix &M) const
 {
   vpHomogeneousMatrix p;
-
-  vpRotationMatrix R1, R2, R;
-  vpTranslationVector T1, T2, T;
-
-  extract(T1);
-  M.extract(T2);
-
-  extract(R1);
-  M.extract(R2);
-
-  R = R1 * R2;
-
-  T = (R1 * T2) + T1;
-
-  p.insert(T);
-  p.insert(R);
-
+  vpMatrixFixed<4, 4>(*this).composeRigid(vpMatrixFixed<4, 4>(M)).copyTo(p);
   return p;
 }
 
@@ -631,7 +616,7 @@ vpHomogeneousMatrix vpHomogeneousMatrix::operator*(const vpHomogeneousMatrix &M)
 */
 vpHomogeneousMatrix &vpHomogeneousMatrix::operator*=(const vpHomogeneousMatrix &M)
 {
-  (*this) = (*this) * M;
+  vpMatrixFixed<4, 4>(*this).composeRigid(vpMatrixFixed<4, 4>(M)).copyTo(*this);
   return (*this);
 }
 
@@ -1016,18 +1001,7 @@ void vpHomogeneousMatrix::insert(const vpQuaternionVector &q) { insert(vpRotatio
 vpHomogeneousMatrix vpHomogeneousMatrix::inverse() const
 {
   vpHomogeneousMatrix Mi;
-
-  vpRotationMatrix R;
-  extract(R);
-  vpTranslationVector T;
-  extract(T);
-
-  vpTranslationVector RtT;
-  RtT = -(R.t() * T);
-
-  Mi.insert(R.t());
-  Mi.insert(RtT);
-
+  vpMatrixFixed<4, 4>(*this).inverseRigid().copyTo(Mi);
   return Mi;
 }
 
@@ -1073,7 +1047,7 @@ void vpHomogeneousMatrix::eye()
   \right]\f$
 
 */
-void vpHomogeneousMatrix::inverse(vpHomogeneousMatrix &M) const { M = inverse(); }
+void vpHomogeneousMatrix::inverse(vpHomogeneousMatrix &M) const { vpMatrixFixed<4, 4>(*this).inverseRigid().copyTo(M); }
 
 void vpHomogeneousMatrix::save(std::ofstream &f) const
 {
@@ -43,6 +43,7 @@
 #include <sstream>
 
 #include <visp3/core/vpException.h>
+#include <visp3/core/vpMatrixFixed.h>
 #include <visp3/core/vpVelocityTwistMatrix.h>
 
 BEGIN_VISP_NAMESPACE
@@ -231,16 +232,7 @@ vpVelocityTwistMatrix::vpVelocityTwistMatrix(double tx, double ty, double tz, do
 vpVelocityTwistMatrix vpVelocityTwistMatrix::operator*(const vpVelocityTwistMatrix &V) const
 {
   vpVelocityTwistMatrix p;
-  const unsigned int nparam = 6;
-  for (unsigned int i = 0; i < nparam; ++i) {
-    for (unsigned int j = 0; j < nparam; ++j) {
-      double s = 0;
-      for (unsigned int k = 0; k < nparam; ++k) {
-        s += rowPtrs[i][k] * V.rowPtrs[k][j];
-      }
-      p[i][j] = s;
-    }
-  }
+  (vpMatrixFixed<6, 6>(*this) * vpMatrixFixed<6, 6>(V)).copyTo(p);
   return p;
 }
 
@@ -332,13 +324,7 @@ vpColVector vpVelocityTwistMatrix::operator*(const vpColVector &v) const
                       v.getRows()));
   }
 
-  c = 0.0;
-
-  for (unsigned int i = 0; i < nparam; ++i) {
-    for (unsigned int j = 0; j < nparam; ++j) {
-      c[i] += rowPtrs[i][j] * v[j];
-    }
-  }
+  (vpMatrixFixed<6, 6>(*this) * vpMatrixFixed<6, 1>(v)).copyTo(c);
 
   return c;
 }
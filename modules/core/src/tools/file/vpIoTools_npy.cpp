@@ -35,6 +35,41 @@
 #include <visp3/core/vpIoTools.h>
 
 #if defined(VISP_HAVE_MINIZ) && defined(VISP_HAVE_WORKING_REGEX)
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+
+#include <visp3/core/vpMatrix.h>
+
+#if defined(VISP_HAVE_THREADS)
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#endif
+
+#if !defined(_WIN32) && (defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))) // UNIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define VP_NPY_HAVE_POSIX_MMAP
+#elif defined(_WIN32) && !defined(WINRT)
+// Mute warning with clang-cl
+// warning : non-portable path to file '<Windows.h>'; specified path differs in case from file name on disk [-Wnonportable-system-include-path]
+#if defined(__clang__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wnonportable-system-include-path"
+#endif
+
+#include <windows.h>
+
+#if defined(__clang__)
+#  pragma clang diagnostic pop
+#endif
+#define VP_NPY_HAVE_WIN32_MMAP
+#endif
+
 #define USE_ZLIB_API 0
 
 #if !USE_ZLIB_API
@@ -62,8 +97,7 @@ namespace
 using namespace VISP_NAMESPACE_NAME; // for vpEndian calls
 #endif
 
-void reverse_data(std::shared_ptr<std::vector<char> > &data_holder, const std::vector<size_t> &shape,
-  size_t word_size, char data_type)
+void reverse_data(char *data, size_t num_bytes, const std::vector<size_t> &shape, size_t word_size, char data_type)
 {
   if (!shape.empty()) {
     size_t total_size = shape[0];
@@ -76,14 +110,14 @@ void reverse_data(std::shared_ptr<std::vector<char> > &data_holder, const std::v
       const size_t half_word_size = word_size / 2;
       for (size_t i = 0; i < total_size; i++) {
         // real
-        std::reverse(data_holder->begin() + i*word_size, data_holder->begin() + i*word_size + half_word_size);
+        std::reverse(data + i*word_size, data + i*word_size + half_word_size);
         // imag
-        std::reverse(data_holder->begin() + i*word_size + half_word_size, data_holder->begin() + (i+1)*word_size);
+        std::reverse(data + i*word_size + half_word_size, data + (i+1)*word_size);
       }
     }
     else if (data_type != 'U') {
       for (size_t i = 0; i < total_size; i++) {
-        std::reverse(data_holder->begin() + i*word_size, data_holder->begin() + (i+1)*word_size);
+        std::reverse(data + i*word_size, data + (i+1)*word_size);
       }
     }
   }
@@ -92,161 +126,163 @@ void reverse_data(std::shared_ptr<std::vector<char> > &data_holder, const std::v
     if (data_type == 'c') {
       const size_t half_word_size = word_size / 2;
       // real
-      std::reverse(data_holder->begin(), data_holder->begin() + half_word_size);
+      std::reverse(data, data + half_word_size);
       // imag
-      std::reverse(data_holder->begin() + half_word_size, data_holder->begin() + word_size);
+      std::reverse(data + half_word_size, data + word_size);
     }
     else if (data_type != 'U') {
-      std::reverse(data_holder->begin(), data_holder->begin() + word_size);
+      std::reverse(data, data + word_size);
     }
   }
 
   if (data_type == 'U') { // special case to handle UTF-32 string data
     size_t utf32_size = 4;
-    for (size_t i = 0; i < data_holder->size(); i += utf32_size) {
-      std::reverse(data_holder->begin() + i, data_holder->begin() + (i+utf32_size)); // NumPy saves string in UTF-32
+    for (size_t i = 0; i < num_bytes; i += utf32_size) {
+      std::reverse(data + i, data + (i+utf32_size)); // NumPy saves string in UTF-32
     }
   }
 }
 
-uint16_t swap16bits_if(uint16_t val, bool swap)
+void reverse_data_if(visp::cnpy::NpyArray &arr, bool little_endian)
 {
-  if (swap) {
-    return vpEndian::swap16bits(val);
+#ifdef VISP_LITTLE_ENDIAN
+  const bool swap = !little_endian;
+#else
+  const bool swap = little_endian;
+#endif
+  if (swap && (arr.num_bytes() > 0)) {
+    reverse_data(arr.data<char>(), arr.num_bytes(), arr.shape, arr.word_size, arr.data_type);
   }
-
-  return val;
 }
 
-uint32_t swap32bits_if(uint32_t val, bool swap)
+// Zip and npy headers are stored in little endian
+uint16_t read16bits_le(const unsigned char *buffer)
 {
-  if (swap) {
-    return vpEndian::swap32bits(val);
-  }
-
-  return val;
+  return static_cast<uint16_t>(buffer[0] | (buffer[1] << 8));
 }
 
-// https://github.com/rogersce/cnpy/pull/78/files
-// https://github.com/nmcclatchey/Bugfix-for-cnpy/blob/e148a5ce5db80fa3e28ce6d551343cfc8ebdc832/cnpy.cpp#L285
-struct AutoCloser
+uint32_t read32bits_le(const unsigned char *buffer)
 {
-  FILE *fp;
-  AutoCloser() : fp(nullptr) { }
-  ~AutoCloser()
-  {
-    if (fp != nullptr) {
-      fclose(fp);
-    }
-  }
-};
+  return static_cast<uint32_t>(read16bits_le(buffer)) | (static_cast<uint32_t>(read16bits_le(buffer + 2)) << 16);
+}
 
-// https://github.com/francescopace/cnpy/blob/4170b94634e5ff5b6925708f450480a9601627a9/cnpy.cpp#L191-L207
-// Helper function to parse ZIP64 extended info from extra field
-void parse_zip64_sizes(const std::vector<char> &extra_field, uint32_t &compr_bytes, uint32_t &uncompr_bytes)
+uint64_t read64bits_le(const unsigned char *buffer)
 {
-  if (extra_field.size() >= 4 && (compr_bytes == 0xFFFFFFFF || uncompr_bytes == 0xFFFFFFFF)) {
-    uint16_t extra_id = *reinterpret_cast<const uint16_t *>(&extra_field[0]);
-    uint16_t extra_size = *reinterpret_cast<const uint16_t *>(&extra_field[2]);
-    if (extra_id == 0x0001 && extra_size >= 16) { // ZIP64 extended info
-      size_t offset = 4;
-      if (uncompr_bytes == 0xFFFFFFFF) {
-        uncompr_bytes = static_cast<uint32_t>(*reinterpret_cast<const uint64_t *>(&extra_field[offset]));
-        offset += 8;
-      }
-      if (compr_bytes == 0xFFFFFFFF) {
-        compr_bytes = static_cast<uint32_t>(*reinterpret_cast<const uint64_t *>(&extra_field[offset]));
-      }
-    }
-  }
+  return static_cast<uint64_t>(read32bits_le(buffer)) | (static_cast<uint64_t>(read32bits_le(buffer + 4)) << 32);
 }
-} // anonymous namespace
 
-#ifndef DOXYGEN_SHOULD_SKIP_THIS
-char visp::cnpy::BigEndianTest()
+void append16bits_le(std::vector<char> &buffer, uint16_t val)
 {
-  int x = 1;
-  return (((reinterpret_cast<char *>(&x))[0]) ? '<' : '>');
+  buffer.push_back(static_cast<char>(val & 0xFF));
+  buffer.push_back(static_cast<char>((val >> 8) & 0xFF));
 }
 
-char visp::cnpy::map_type(const std::type_info &t)
+void append32bits_le(std::vector<char> &buffer, uint32_t val)
 {
-  if (t == typeid(float)) { return 'f'; }
-  if (t == typeid(double)) { return 'f'; }
-  if (t == typeid(long double)) { return 'f'; }
-
-  if (t == typeid(int)) { return 'i'; }
-  if (t == typeid(char)) { return 'i'; }
-  if (t == typeid(short)) { return 'i'; }
-  if (t == typeid(long)) { return 'i'; }
-  if (t == typeid(long long)) { return 'i'; }
-
-  if (t == typeid(unsigned char)) { return 'u'; }
-  if (t == typeid(unsigned short)) { return 'u'; }
-  if (t == typeid(unsigned long)) { return 'u'; }
-  if (t == typeid(unsigned long long)) { return 'u'; }
-  if (t == typeid(unsigned int)) { return 'u'; }
-
-  if (t == typeid(bool)) { return 'b'; }
-
-  if (t == typeid(std::complex<float>)) { return 'c'; }
-  if (t == typeid(std::complex<double>)) { return 'c'; }
-  if (t == typeid(std::complex<long double>)) { return 'c'; }
-
-  if (t == typeid(std::string)) { return 'U'; }
-
-  else { return '?'; }
+  append16bits_le(buffer, static_cast<uint16_t>(val & 0xFFFF));
+  append16bits_le(buffer, static_cast<uint16_t>(val >> 16));
 }
 
-void visp::cnpy::parse_npy_header(unsigned char *buffer, size_t &word_size, std::vector<size_t> &shape,
-  bool &fortran_order, bool &little_endian, char &data_type)
+void append64bits_le(std::vector<char> &buffer, uint64_t val)
 {
-  uint16_t header_len = *reinterpret_cast<uint16_t *>(buffer+8);
-  std::string header(reinterpret_cast<char *>(buffer+9), header_len);
-
-  //fortran order
-  size_t loc1 = header.find("fortran_order")+16;
-  fortran_order = (header.substr(loc1, 4) == "True" ? true : false);
-
-  //shape
-  loc1 = header.find("(");
-  size_t loc2 = header.find(")");
-
-  std::regex num_regex("[0-9][0-9]*");
-  std::smatch sm;
-  shape.clear();
+  append32bits_le(buffer, static_cast<uint32_t>(val & 0xFFFFFFFF));
+  append32bits_le(buffer, static_cast<uint32_t>(val >> 32));
+}
 
-  std::string str_shape = header.substr(loc1+1, loc2-loc1-1);
-  while (std::regex_search(str_shape, sm, num_regex)) {
-    // https://github.com/rogersce/cnpy/commit/ca6c0ce5bed57e3b5b64aede4f39aa07a9e71f5e
-    shape.push_back(std::stoll(sm[0].str()));
-    str_shape = sm.suffix().str();
+// Raw deflate compression of the concatenation of the given buffers
+void deflate_buffers(const std::vector<std::pair<const char *, size_t> > &buffers, std::vector<char> &compressed)
+{
+  z_stream strm;
+  strm.zalloc = Z_NULL;
+  strm.zfree = Z_NULL;
+  strm.opaque = Z_NULL;
+  int ret = deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+  if (ret != Z_OK) {
+    throw std::runtime_error("deflate_buffers(): deflateInit2 failed");
   }
 
-  //endian, word size, data type
-  //byte order code | stands for not applicable.
-  //not sure when this applies except for byte array
-  loc1 = header.find("descr")+9;
-  little_endian = ((header[loc1] == '<') || (header[loc1] == '|') ? true : false);
-  data_type = header[loc1+1];
+  // zlib counts are 32 bits
+  const size_t max_chunk = static_cast<size_t>(1) << 30;
+  const size_t min_free_space = static_cast<size_t>(1) << 16;
+  size_t nbytes_out = 0;
+  compressed.resize(min_free_space);
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    const char *in = buffers[i].first;
+    size_t in_left = buffers[i].second;
+    do {
+      const size_t in_chunk = std::min(in_left, max_chunk);
+      const bool last_chunk = (i + 1 == buffers.size()) && (in_chunk == in_left);
+      const int flush = last_chunk ? Z_FINISH : Z_NO_FLUSH;
+      strm.next_in = reinterpret_cast<unsigned char *>(const_cast<char *>(in));
+      strm.avail_in = static_cast<unsigned int>(in_chunk);
+      do {
+        if (compressed.size() - nbytes_out < min_free_space) {
+          compressed.resize(2 * compressed.size());
+        }
+        strm.next_out = reinterpret_cast<unsigned char *>(&compressed[nbytes_out]);
+        strm.avail_out = static_cast<unsigned int>(std::min(compressed.size() - nbytes_out, max_chunk));
+        const size_t avail_out = strm.avail_out;
+        ret = deflate(&strm, flush);
+        nbytes_out += avail_out - strm.avail_out;
+        if ((ret != Z_OK) && (ret != Z_STREAM_END)) {
+          deflateEnd(&strm);
+          throw std::runtime_error("deflate_buffers(): deflate failed");
+        }
+      } while ((strm.avail_in > 0) || (last_chunk && (ret != Z_STREAM_END)));
+      in += in_chunk;
+      in_left -= in_chunk;
+    } while (in_left > 0);
+  }
+  deflateEnd(&strm);
+  compressed.resize(nbytes_out);
+}
 
-  std::string str_ws = header.substr(loc1+2);
-  loc2 = str_ws.find("'");
-  word_size = atoll(str_ws.substr(0, loc2).c_str());
+// https://github.com/francescopace/cnpy/blob/4170b94634e5ff5b6925708f450480a9601627a9/cnpy.cpp#L191-L207
+// Helper function to parse ZIP64 extended info from extra field
+void parse_zip64_sizes(const unsigned char *extra_field, size_t extra_field_len, uint64_t &compr_bytes,
+                       uint64_t &uncompr_bytes)
+{
+  if ((compr_bytes != 0xFFFFFFFF) && (uncompr_bytes != 0xFFFFFFFF)) {
+    return;
+  }
+  size_t field = 0;
+  while (field + 4 <= extra_field_len) {
+    uint16_t extra_id = read16bits_le(extra_field + field);
+    uint16_t extra_size = read16bits_le(extra_field + field + 2);
+    if ((extra_id == 0x0001) && (field + 4 + extra_size <= extra_field_len)) { // ZIP64 extended info
+      size_t offset = field + 4;
+      if ((uncompr_bytes == 0xFFFFFFFF) && (offset + 8 <= field + 4 + extra_size)) {
+        uncompr_bytes = read64bits_le(extra_field + offset);
+        offset += 8;
+      }
+      if ((compr_bytes == 0xFFFFFFFF) && (offset + 8 <= field + 4 + extra_size)) {
+        compr_bytes = read64bits_le(extra_field + offset);
+      }
+      return;
+    }
+    field += 4 + extra_size;
+  }
 }
 
-void visp::cnpy::parse_npy_header(FILE *fp, size_t &word_size, std::vector<size_t> &shape,
-  bool &fortran_order, bool &little_endian, char &data_type)
+// Parse the header of the npy data stored in buffer and return its size in bytes
+size_t parse_npy_header_buffer(const unsigned char *buffer, size_t buffer_size, size_t &word_size,
+                               std::vector<size_t> &shape, bool &fortran_order, bool &little_endian, char &data_type)
 {
-  char buffer[256];
-  size_t res = fread(buffer, sizeof(char), 11, fp);
-  if (res != 11) {
-    std::ostringstream oss;
-    oss << "parse_npy_header: failed fread, res=" << res;
-    throw std::runtime_error(oss.str());
+  const size_t preamble_size_v1 = 10, preamble_size_v2 = 12;
+  if ((buffer_size < preamble_size_v1) || (buffer[0] != 0x93) || (memcmp(buffer + 1, "NUMPY", 5) != 0)) {
+    throw std::runtime_error("parse_npy_header: not a npy file");
   }
-  std::string header = fgets(buffer, 256, fp);
-  assert(header[header.size()-1] == '\n');
+  // Since version 2.0 of the npy format, the header length is stored on 4 bytes
+  const bool is_v1 = (buffer[6] == 1);
+  if (!is_v1 && (buffer_size < preamble_size_v2)) {
+    throw std::runtime_error("parse_npy_header: truncated header");
+  }
+  const size_t preamble_size = is_v1 ? preamble_size_v1 : preamble_size_v2;
+  const size_t header_len = is_v1 ? read16bits_le(buffer + 8) : read32bits_le(buffer + 8);
+  if (header_len > buffer_size - preamble_size) {
+    throw std::runtime_error("parse_npy_header: truncated header");
+  }
+  std::string header(reinterpret_cast<const char *>(buffer + preamble_size), header_len);
 
   size_t loc1, loc2;
 
@@ -293,268 +329,508 @@ void visp::cnpy::parse_npy_header(FILE *fp, size_t &word_size, std::vector<size_
   if (data_type == 'U') {
     word_size *= 4; // UTF-32 with NumPy
   }
+
+  return preamble_size + header_len;
 }
 
-void visp::cnpy::parse_zip_footer(FILE *fp, uint16_t &nrecs, size_t &global_header_size, size_t &global_header_offset)
+// Read-only view of a whole file. Pages are mapped copy-on-write so that the arrays pointing into the mapping can
+// be modified (e.g. byte swapped) without altering the file.
+class MappedFile
 {
-  std::vector<char> footer(22);
-  fseek(fp, -22, SEEK_END);
-  size_t res = fread(&footer[0], sizeof(char), 22, fp);
-  if (res != 22) {
-    std::ostringstream oss;
-    oss << "parse_zip_footer: failed fread, res=" << res;
-    throw std::runtime_error(oss.str());
+public:
+  explicit MappedFile(const std::string &fname) : m_data(nullptr), m_size(0), m_mapped(false)
+  {
+#if defined(VP_NPY_HAVE_POSIX_MMAP)
+    int fd = open(fname.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw std::runtime_error("npy/npz: Unable to open file " + fname + "!");
+    }
+    struct stat st;
+    if ((fstat(fd, &st) == 0) && (st.st_size > 0)) {
+      void *addr = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+      if (addr != MAP_FAILED) {
+        m_data = static_cast<unsigned char *>(addr);
+        m_size = static_cast<size_t>(st.st_size);
+        m_mapped = true;
+      }
+    }
+    close(fd);
+#elif defined(VP_NPY_HAVE_WIN32_MMAP)
+    HANDLE file = CreateFileA(fname.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+      throw std::runtime_error("npy/npz: Unable to open file " + fname + "!");
+    }
+    LARGE_INTEGER file_size;
+    if (GetFileSizeEx(file, &file_size) && (file_size.QuadPart > 0)) {
+      HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+      if (mapping != nullptr) {
+        void *addr = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+        if (addr != nullptr) {
+          m_data = static_cast<unsigned char *>(addr);
+          m_size = static_cast<size_t>(file_size.QuadPart);
+          m_mapped = true;
+        }
+        CloseHandle(mapping);
+      }
+    }
+    CloseHandle(file);
+#endif
+    if (!m_mapped) {
+      // No memory mapping on this platform (or it failed), read the whole file instead
+      FILE *fp = fopen(fname.c_str(), "rb");
+      if (!fp) {
+        throw std::runtime_error("npy/npz: Unable to open file " + fname + "!");
+      }
+      fseek(fp, 0, SEEK_END);
+      long file_size = ftell(fp);
+      fseek(fp, 0, SEEK_SET);
+      m_buffer.resize(file_size > 0 ? static_cast<size_t>(file_size) : 0);
+      size_t nread = m_buffer.empty() ? 0 : fread(&m_buffer[0], 1, m_buffer.size(), fp);
+      fclose(fp);
+      if (nread != m_buffer.size()) {
+        std::ostringstream oss;
+        oss << "npy/npz: failed fread, nread=" << nread << " ; file_size=" << m_buffer.size();
+        throw std::runtime_error(oss.str());
+      }
+      m_data = m_buffer.empty() ? nullptr : &m_buffer[0];
+      m_size = m_buffer.size();
+    }
   }
 
-  uint16_t disk_no, disk_start, nrecs_on_disk, comment_len;
-#ifdef VISP_BIG_ENDIAN
-  disk_no = vpEndian::swap16bits(*(uint16_t *)&footer[4]);
-  disk_start = vpEndian::swap16bits(*(uint16_t *)&footer[6]);
-  nrecs_on_disk = vpEndian::swap16bits(*(uint16_t *)&footer[8]);
-  nrecs = vpEndian::swap16bits(*(uint16_t *)&footer[10]);
-  global_header_size = vpEndian::swap32bits(*(uint32_t *)&footer[12]);
-  global_header_offset = vpEndian::swap32bits(*(uint32_t *)&footer[16]);
-  comment_len = vpEndian::swap16bits(*(uint16_t *)&footer[20]);
-#else
-  disk_no = *(uint16_t *)&footer[4];
-  disk_start = *(uint16_t *)&footer[6];
-  nrecs_on_disk = *(uint16_t *)&footer[8];
-  nrecs = *(uint16_t *)&footer[10];
-  global_header_size = *(uint32_t *)&footer[12];
-  global_header_offset = *(uint32_t *)&footer[16];
-  comment_len = *(uint16_t *)&footer[20];
+  ~MappedFile()
+  {
+    if (m_mapped) {
+#if defined(VP_NPY_HAVE_POSIX_MMAP)
+      munmap(m_data, m_size);
+#elif defined(VP_NPY_HAVE_WIN32_MMAP)
+      UnmapViewOfFile(m_data);
 #endif
+    }
+  }
 
-  UNUSED(disk_no); assert(disk_no == 0);
-  UNUSED(disk_start); assert(disk_start == 0);
-  UNUSED(nrecs_on_disk); assert(nrecs_on_disk == nrecs);
-  UNUSED(comment_len); assert(comment_len == 0);
+  unsigned char *data() { return m_data; }
+  size_t size() const { return m_size; }
+
+private:
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  unsigned char *m_data;
+  size_t m_size;
+  bool m_mapped;
+  std::vector<unsigned char> m_buffer;
+};
+
+// Raw deflate decompression that writes straight into the destination buffers, without holding the whole
+// compressed or decompressed stream in memory
+class StreamInflater
+{
+public:
+  StreamInflater(const unsigned char *in, size_t in_bytes) : m_in(in), m_in_left(in_bytes)
+  {
+    m_stream.zalloc = Z_NULL;
+    m_stream.zfree = Z_NULL;
+    m_stream.opaque = Z_NULL;
+    m_stream.avail_in = 0;
+    m_stream.next_in = Z_NULL;
+    int err = inflateInit2(&m_stream, -MAX_WBITS);
+    // https://github.com/rogersce/cnpy/commit/3ed2bc4063c455269b37af63442c595ee1bd60e1
+    if (err != Z_OK) {
+      std::ostringstream oss;
+      oss << "load_the_npz_array: zlib inflateInit2 failed ; err=" << err;
+      throw std::runtime_error(oss.str());
+    }
+  }
+
+  ~StreamInflater()
+  {
+    inflateEnd(&m_stream);
+  }
+
+  void read(unsigned char *out, size_t nbytes)
+  {
+    // zlib counts are 32 bits
+    const size_t max_chunk = static_cast<size_t>(1) << 30;
+    while (nbytes > 0) {
+      const size_t out_chunk = std::min(nbytes, max_chunk);
+      m_stream.next_out = out;
+      m_stream.avail_out = static_cast<unsigned int>(out_chunk);
+      while (m_stream.avail_out > 0) {
+        if ((m_stream.avail_in == 0) && (m_in_left > 0)) {
+          const size_t in_chunk = std::min(m_in_left, max_chunk);
+          m_stream.next_in = const_cast<unsigned char *>(m_in);
+          m_stream.avail_in = static_cast<unsigned int>(in_chunk);
+          m_in += in_chunk;
+          m_in_left -= in_chunk;
+        }
+        int err = inflate(&m_stream, Z_NO_FLUSH);
+        if ((err == Z_STREAM_END) && (m_stream.avail_out > 0)) {
+          throw std::runtime_error("load_the_npz_array: zlib stream is shorter than the array");
+        }
+        if ((err != Z_OK) && (err != Z_STREAM_END)) {
+          std::ostringstream oss;
+          oss << "load_the_npz_array: zlib inflate failed ; err=" << err;
+          throw std::runtime_error(oss.str());
+        }
+      }
+      out += out_chunk;
+      nbytes -= out_chunk;
+    }
+  }
+
+private:
+  StreamInflater(const StreamInflater &) = delete;
+  StreamInflater &operator=(const StreamInflater &) = delete;
+
+  z_stream m_stream;
+  const unsigned char *m_in;
+  size_t m_in_left;
+};
+
+// Largest alignment the elements of an array may require
+size_t npy_alignment(size_t word_size)
+{
+  size_t alignment = word_size & (~word_size + 1); // largest power of two dividing word_size
+  return std::max<size_t>(1, std::min<size_t>(alignment, alignof(std::max_align_t)));
 }
 
-visp::cnpy::NpyArray load_the_npy_file(FILE *fp)
+// Build an array from the npy data stored uncompressed in the file, at the given offset.
+// When share_data is true and the data are suitably aligned, the array points into the file mapping.
+visp::cnpy::NpyArray load_the_npy_file(const std::shared_ptr<MappedFile> &file, size_t offset, size_t nbytes,
+                                       bool share_data)
 {
+  if ((offset > file->size()) || (nbytes > file->size() - offset)) {
+    throw std::runtime_error("load_the_npy_file: truncated file");
+  }
   std::vector<size_t> shape;
   size_t word_size;
   bool fortran_order, little_endian;
   char data_type = 'i'; // integer type
-  visp::cnpy::parse_npy_header(fp, word_size, shape, fortran_order, little_endian, data_type);
+  unsigned char *buffer = file->data() + offset;
+  size_t header_size = parse_npy_header_buffer(buffer, nbytes, word_size, shape, fortran_order, little_endian,
+                                               data_type);
 
-  visp::cnpy::NpyArray arr(shape, word_size, fortran_order, data_type);
-  size_t nread = fread(arr.data<char>(), 1, arr.num_bytes(), fp);
-  if (nread != arr.num_bytes()) {
+  size_t num_bytes = word_size;
+  for (size_t i = 0; i < shape.size(); ++i) num_bytes *= shape[i];
+  if (num_bytes > nbytes - header_size) {
     std::ostringstream oss;
-    oss << "load_the_npy_file: failed fread, nread=" << nread << " ; num_bytes=" << arr.num_bytes();
+    oss << "load_the_npy_file: truncated data, available=" << (nbytes - header_size) << " ; num_bytes=" << num_bytes;
     throw std::runtime_error(oss.str());
   }
 
-#ifdef VISP_LITTLE_ENDIAN
-  if (!little_endian) {
-    reverse_data(arr.data_holder, arr.shape, arr.word_size, data_type);
+  char *data = reinterpret_cast<char *>(buffer + header_size);
+  visp::cnpy::NpyArray arr;
+  if (share_data && ((reinterpret_cast<uintptr_t>(data) % npy_alignment(word_size)) == 0)) {
+    // Aliasing constructor: the array data keep the whole mapping alive
+    arr = visp::cnpy::NpyArray(shape, word_size, fortran_order, data_type, std::shared_ptr<char>(file, data));
   }
-#else
-  if (little_endian) {
-    reverse_data(arr.data_holder, arr.shape, arr.word_size, data_type);
+  else {
+    arr = visp::cnpy::NpyArray(shape, word_size, fortran_order, data_type);
+    if (num_bytes > 0) {
+      memcpy(arr.data<char>(), data, num_bytes);
+    }
   }
-#endif
+
+  reverse_data_if(arr, little_endian);
   return arr;
 }
 
-visp::cnpy::NpyArray load_the_npz_array(FILE *fp, uint32_t compr_bytes, uint32_t uncompr_bytes)
+// Build an array from the npy data stored deflated in the file
+visp::cnpy::NpyArray load_the_npz_array(const unsigned char *buffer_compr, size_t compr_bytes, size_t uncompr_bytes)
 {
-  std::vector<unsigned char> buffer_compr(compr_bytes);
-  std::vector<unsigned char> buffer_uncompr(uncompr_bytes);
-  size_t nread = fread(&buffer_compr[0], 1, compr_bytes, fp);
-  if (nread != compr_bytes) {
-    std::ostringstream oss;
-    oss << "load_the_npz_array: failed fread, nread=" << nread << " ; compr_bytes=" << compr_bytes;
-    throw std::runtime_error(oss.str());
-  }
-
-  z_stream d_stream;
-
-  d_stream.zalloc = Z_NULL;
-  d_stream.zfree = Z_NULL;
-  d_stream.opaque = Z_NULL;
-  d_stream.avail_in = 0;
-  d_stream.next_in = Z_NULL;
-  int err = inflateInit2(&d_stream, -MAX_WBITS);
-  // https://github.com/rogersce/cnpy/commit/3ed2bc4063c455269b37af63442c595ee1bd60e1
-  if (err != Z_OK) {
-    std::ostringstream oss;
-    oss << "load_the_npz_array: zlib inflateInit2 failed ; err=" << err;
-    throw std::runtime_error(oss.str());
-  }
-
-  d_stream.avail_in = compr_bytes;
-  d_stream.next_in = &buffer_compr[0];
-  d_stream.avail_out = uncompr_bytes;
-  d_stream.next_out = &buffer_uncompr[0];
-
-  err = inflate(&d_stream, Z_FINISH);
-  if (err != Z_STREAM_END && err != Z_OK) {
-    std::ostringstream oss;
-    oss << "load_the_npz_array: zlib inflate failed ; err=" << err;
-    throw std::runtime_error(oss.str());
+  StreamInflater inflater(buffer_compr, compr_bytes);
+
+  // Decompress the npy header first, to know where to decompress the data
+  const size_t preamble_size_v1 = 10, preamble_size_v2 = 12;
+  std::vector<unsigned char> header(preamble_size_v2);
+  inflater.read(&header[0], preamble_size_v1);
+  // Since version 2.0 of the npy format, the header length is stored on 4 bytes
+  const bool is_v1 = (header[6] == 1);
+  const size_t preamble_size = is_v1 ? preamble_size_v1 : preamble_size_v2;
+  if (!is_v1) {
+    inflater.read(&header[preamble_size_v1], preamble_size_v2 - preamble_size_v1);
   }
-  err = inflateEnd(&d_stream);
-  if (err != Z_OK) {
-    std::ostringstream oss;
-    oss << "load_the_npz_array: zlib inflateEnd failed ; err=" << err;
-    throw std::runtime_error(oss.str());
+  const size_t header_size = preamble_size + (is_v1 ? read16bits_le(&header[8]) : read32bits_le(&header[8]));
+  if (header_size > uncompr_bytes) {
+    throw std::runtime_error("load_the_npz_array: truncated header");
   }
+  header.resize(header_size);
+  inflater.read(&header[preamble_size], header_size - preamble_size);
 
   std::vector<size_t> shape;
   size_t word_size;
   bool fortran_order;
   bool little_endian = true;
   char data_type = 'i'; // integer type
-  visp::cnpy::parse_npy_header(&buffer_uncompr[0], word_size, shape, fortran_order, little_endian, data_type);
-
-  visp::cnpy::NpyArray array(shape, word_size, fortran_order, data_type);
-
-  size_t offset = uncompr_bytes - array.num_bytes();
-  memcpy(array.data<unsigned char>(), &buffer_uncompr[0]+offset, array.num_bytes());
+  parse_npy_header_buffer(&header[0], header.size(), word_size, shape, fortran_order, little_endian, data_type);
 
-#ifdef VISP_LITTLE_ENDIAN
-  if (!little_endian) {
-    reverse_data(array.data_holder, array.shape, array.word_size, data_type);
+  size_t num_bytes = word_size;
+  for (size_t i = 0; i < shape.size(); ++i) num_bytes *= shape[i];
+  if (num_bytes > uncompr_bytes - header_size) {
+    std::ostringstream oss;
+    oss << "load_the_npz_array: truncated data, available=" << (uncompr_bytes - header_size) << " ; num_bytes="
+      << num_bytes;
+    throw std::runtime_error(oss.str());
   }
-#else
-  if (little_endian) {
-    reverse_data(array.data_holder, array.shape, array.word_size, data_type);
+
+  visp::cnpy::NpyArray array(shape, word_size, fortran_order, data_type);
+  if (num_bytes > 0) {
+    inflater.read(array.data<unsigned char>(), num_bytes);
   }
-#endif
 
+  reverse_data_if(array, little_endian);
   return array;
 }
 
-// https://github.com/francescopace/cnpy/blob/4170b94634e5ff5b6925708f450480a9601627a9/cnpy.h#L187-L214
-void visp::cnpy::compressData(size_t nbytes_uncompressed, std::vector<uint8_t> &uncompressed,
-                              std::vector<uint8_t> &buffer_compressed, size_t &nbytes_on_disk, FILE *fp)
+// Walk through the local headers of the npz file and load all its arrays, or only varname when not null
+void load_the_npz_file(const std::shared_ptr<MappedFile> &file, const std::string *varname, bool share_data,
+                       visp::cnpy::npz_t &arrays)
 {
-  // Compress using zlib deflate (raw deflate, no zlib/gzip header)
-  uLongf max_compressed_size = compressBound(nbytes_uncompressed);
-  buffer_compressed.resize(max_compressed_size);
+  const size_t local_header_size = 30;
+  const unsigned char *data = file->data();
+  size_t offset = 0;
+  while (offset + local_header_size <= file->size()) {
+    const unsigned char *local_header = data + offset;
 
-  z_stream strm;
-  strm.zalloc = Z_NULL;
-  strm.zfree = Z_NULL;
-  strm.opaque = Z_NULL;
-  int ret = deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
-  if (ret != Z_OK) {
-    fclose(fp);
-    throw std::runtime_error("compressData(): deflateInit2 failed");
-  }
+    //if we've reached the global header, stop reading
+    if ((local_header[0] != 'P') || (local_header[1] != 'K') || (local_header[2] != 0x03) || (local_header[3] != 0x04)) {
+      break;
+    }
 
-  strm.avail_in = nbytes_uncompressed;
-  strm.next_in = &uncompressed[0];
-  strm.avail_out = max_compressed_size;
-  strm.next_out = &buffer_compressed[0];
+    uint16_t compr_method = read16bits_le(local_header + 8);
+    uint64_t compr_bytes = read32bits_le(local_header + 18);
+    uint64_t uncompr_bytes = read32bits_le(local_header + 22);
+    uint16_t name_len = read16bits_le(local_header + 26);
+    uint16_t extra_field_len = read16bits_le(local_header + 28);
+    offset += local_header_size;
+    if (offset + name_len + extra_field_len > file->size()) {
+      throw std::runtime_error("npz_load: truncated local header");
+    }
 
-  ret = deflate(&strm, Z_FINISH);
-  if (ret != Z_STREAM_END) {
-    deflateEnd(&strm);
-    fclose(fp);
-    throw std::runtime_error("compressData(): deflate failed");
-  }
+    //read in the variable name and erase the lagging .npy
+    std::string vname(reinterpret_cast<const char *>(data + offset), name_len);
+    if ((vname.size() >= 4) && (vname.compare(vname.size() - 4, 4, ".npy") == 0)) {
+      vname.erase(vname.end()-4, vname.end());
+    }
+    offset += name_len;
 
-  nbytes_on_disk = strm.total_out;
-  deflateEnd(&strm);
-}
+    // ZIP64 support: if sizes are 0xFFFFFFFF, read from extra field
+    parse_zip64_sizes(data + offset, extra_field_len, compr_bytes, uncompr_bytes);
+    offset += extra_field_len;
+    if (compr_bytes > file->size() - offset) {
+      throw std::runtime_error("npz_load: truncated array " + vname);
+    }
 
-#endif // DOXYGEN_SHOULD_SKIP_THIS
+    if ((varname == nullptr) || (vname == *varname)) {
+      if (compr_method == 0) {
+        arrays[vname] = load_the_npy_file(file, offset, static_cast<size_t>(compr_bytes), share_data);
+      }
+      else {
+        arrays[vname] = load_the_npz_array(data + offset, static_cast<size_t>(compr_bytes),
+                                           static_cast<size_t>(uncompr_bytes));
+      }
+      if (varname != nullptr) {
+        return;
+      }
+    }
 
-/*!
-  Load the specified \p fname filepath as arrays of data. This function is similar to the
-  <a href="https://numpy.org/doc/stable/reference/generated/numpy.load.html">numpy.load</a> function.
-  \param[in] fname : Path to the npz file.
-  \return A map of arrays data. The key represents the variable name, the value is an array of basic data type.
-  \warning This function has only been tested on little endian platform.
-  \note Original library: <a href="https://github.com/rogersce/cnpy">cnpy</a> with MIT license.
+    //skip past the data (use compr_bytes for compressed data)
+    offset += static_cast<size_t>(compr_bytes);
+  }
+}
 
-  \sa To see how to use it, you may have a look at \ref tutorial-npz
- */
-visp::cnpy::npz_t visp::cnpy::npz_load(const std::string &fname)
+std::shared_ptr<MappedFile> open_mapped_file(const std::string &fname)
 {
   if (!vpIoTools::checkFilename(fname)) {
     throw vpException(vpException::ioError, "This file does not exist: " + fname);
   }
+  return std::make_shared<MappedFile>(fname);
+}
 
-  AutoCloser closer;
-  closer.fp = fopen(fname.c_str(), "rb");
+int fseek64(FILE *fp, uint64_t offset)
+{
+#if defined(_WIN32)
+  return _fseeki64(fp, static_cast<__int64>(offset), SEEK_SET);
+#else
+  return fseeko(fp, static_cast<off_t>(offset), SEEK_SET);
+#endif
+}
 
-  if (!closer.fp) {
-    throw std::runtime_error("npz_load: Error! Unable to open file " + fname + "!");
+visp::cnpy::NpyArray load_the_npz_array(const std::string &fname, const std::string &varname, bool share_data)
+{
+  visp::cnpy::npz_t arrays;
+  load_the_npz_file(open_mapped_file(fname), &varname, share_data, arrays);
+  if (arrays.empty()) {
+    //if we get here, we haven't found the variable in the file
+    throw std::runtime_error("npz_load 2: Variable name " + varname + " not found in " + fname);
   }
+  return arrays.begin()->second;
+}
+} // anonymous namespace
 
-  visp::cnpy::npz_t arrays;
-  bool quit = false;
-  const unsigned int index_2 = 2;
-  const unsigned int index_3 = 3;
-  const unsigned int index_26 = 26;
-  const unsigned int index_28 = 28;
-  const unsigned int val_8 = 8;
-  const unsigned int val_18 = 18;
-  const unsigned int val_22 = 22;
-  const unsigned int val_30 = 30;
-
-  bool host_is_LE = true;
-#ifndef VISP_LITTLE_ENDIAN
-  host_is_LE = false;
-#endif
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+char visp::cnpy::BigEndianTest()
+{
+  int x = 1;
+  return (((reinterpret_cast<char *>(&x))[0]) ? '<' : '>');
+}
 
-  const bool header_file_is_LE = true;
-  bool same_endianness = (host_is_LE == header_file_is_LE);
-  while (!quit) {
-    std::vector<char> local_header(val_30);
-    size_t headerres = fread(&local_header[0], sizeof(char), val_30, closer.fp);
-    if (headerres != 30) {
-      throw std::runtime_error("npz_load: failed fread 1");
-    }
+char visp::cnpy::map_type(const std::type_info &t)
+{
+  if (t == typeid(float)) { return 'f'; }
+  if (t == typeid(double)) { return 'f'; }
+  if (t == typeid(long double)) { return 'f'; }
 
-    //if we've reached the global header, stop reading
-    if ((local_header[index_2] != 0x03) || (local_header[index_3] != 0x04)) {
-      quit = true;
-    }
-    else {
-      //read in the variable name
-      uint16_t name_len = swap16bits_if(*(uint16_t *)&local_header[index_26], !same_endianness);
-      std::string varname(name_len, ' ');
-      size_t vname_res = fread(&varname[0], sizeof(char), name_len, closer.fp);
-      if (vname_res != name_len) {
-        throw std::runtime_error("npz_load: failed fread 2");
-      }
+  if (t == typeid(int)) { return 'i'; }
+  if (t == typeid(char)) { return 'i'; }
+  if (t == typeid(short)) { return 'i'; }
+  if (t == typeid(long)) { return 'i'; }
+  if (t == typeid(long long)) { return 'i'; }
 
-      //erase the lagging .npy
-      varname.erase(varname.end()-4, varname.end());
-
-      //read in the extra field
-      uint16_t extra_field_len = swap16bits_if(*(uint16_t *)&local_header[index_28], !same_endianness);
-      std::vector<char> extra_field(extra_field_len);
-      if (extra_field_len > 0) {
-        std::vector<char> buff(extra_field_len);
-        size_t efield_res = fread(&extra_field[0], sizeof(char), extra_field_len, closer.fp);
-        if (efield_res != extra_field_len) {
-          throw std::runtime_error("npz_load: failed fread 3");
-        }
-      }
+  if (t == typeid(unsigned char)) { return 'u'; }
+  if (t == typeid(unsigned short)) { return 'u'; }
+  if (t == typeid(unsigned long)) { return 'u'; }
+  if (t == typeid(unsigned long long)) { return 'u'; }
+  if (t == typeid(unsigned int)) { return 'u'; }
 
-      uint16_t compr_method = swap16bits_if(*reinterpret_cast<uint16_t *>(&local_header[0] + val_8), !same_endianness);
-      uint32_t compr_bytes = swap32bits_if(*reinterpret_cast<uint32_t *>(&local_header[0] + val_18), !same_endianness);
-      uint32_t uncompr_bytes = swap32bits_if(*reinterpret_cast<uint32_t *>(&local_header[0] + val_22), !same_endianness);
+  if (t == typeid(bool)) { return 'b'; }
 
-      // ZIP64 support: if sizes are 0xFFFFFFFF, read from extra field
-      parse_zip64_sizes(extra_field, compr_bytes, uncompr_bytes);
+  if (t == typeid(std::complex<float>)) { return 'c'; }
+  if (t == typeid(std::complex<double>)) { return 'c'; }
+  if (t == typeid(std::complex<long double>)) { return 'c'; }
 
-      if (compr_method == 0) {
-        arrays[varname] = load_the_npy_file(closer.fp);
-      }
-      else {
-        arrays[varname] = load_the_npz_array(closer.fp, compr_bytes, uncompr_bytes);
-      }
+  if (t == typeid(std::string)) { return 'U'; }
+
+  else { return '?'; }
+}
+
+void visp::cnpy::parse_npy_header(unsigned char *buffer, size_t &word_size, std::vector<size_t> &shape,
+  bool &fortran_order, bool &little_endian, char &data_type)
+{
+  parse_npy_header_buffer(buffer, std::numeric_limits<size_t>::max(), word_size, shape, fortran_order, little_endian,
+                          data_type);
+}
+
+void visp::cnpy::parse_npy_header(FILE *fp, size_t &word_size, std::vector<size_t> &shape,
+  bool &fortran_order, bool &little_endian, char &data_type)
+{
+  const size_t preamble_size_v1 = 10, preamble_size_v2 = 12;
+  std::vector<unsigned char> buffer(preamble_size_v2);
+  size_t res = fread(&buffer[0], sizeof(char), preamble_size_v1, fp);
+  if (res != preamble_size_v1) {
+    std::ostringstream oss;
+    oss << "parse_npy_header: failed fread, res=" << res;
+    throw std::runtime_error(oss.str());
+  }
+  // Since version 2.0 of the npy format, the header length is stored on 4 bytes
+  const bool is_v1 = (buffer[6] == 1);
+  if (!is_v1) {
+    res = fread(&buffer[preamble_size_v1], sizeof(char), preamble_size_v2 - preamble_size_v1, fp);
+    if (res != (preamble_size_v2 - preamble_size_v1)) {
+      std::ostringstream oss;
+      oss << "parse_npy_header: failed fread, res=" << res;
+      throw std::runtime_error(oss.str());
     }
   }
+  const size_t preamble_size = is_v1 ? preamble_size_v1 : preamble_size_v2;
+  const size_t header_len = is_v1 ? read16bits_le(&buffer[8]) : read32bits_le(&buffer[8]);
+  buffer.resize(preamble_size + header_len);
+  res = fread(&buffer[preamble_size], sizeof(char), header_len, fp);
+  if (res != header_len) {
+    std::ostringstream oss;
+    oss << "parse_npy_header: failed fread, res=" << res;
+    throw std::runtime_error(oss.str());
+  }
+  parse_npy_header_buffer(&buffer[0], buffer.size(), word_size, shape, fortran_order, little_endian, data_type);
+}
 
+void visp::cnpy::parse_zip_footer(FILE *fp, uint16_t &nrecs, size_t &global_header_size, size_t &global_header_offset)
+{
+  std::vector<char> footer(22);
+  fseek(fp, -22, SEEK_END);
+  size_t res = fread(&footer[0], sizeof(char), 22, fp);
+  if (res != 22) {
+    std::ostringstream oss;
+    oss << "parse_zip_footer: failed fread, res=" << res;
+    throw std::runtime_error(oss.str());
+  }
+
+  uint16_t disk_no, disk_start, nrecs_on_disk, comment_len;
+#ifdef VISP_BIG_ENDIAN
+  disk_no = vpEndian::swap16bits(*(uint16_t *)&footer[4]);
+  disk_start = vpEndian::swap16bits(*(uint16_t *)&footer[6]);
+  nrecs_on_disk = vpEndian::swap16bits(*(uint16_t *)&footer[8]);
+  nrecs = vpEndian::swap16bits(*(uint16_t *)&footer[10]);
+  global_header_size = vpEndian::swap32bits(*(uint32_t *)&footer[12]);
+  global_header_offset = vpEndian::swap32bits(*(uint32_t *)&footer[16]);
+  comment_len = vpEndian::swap16bits(*(uint16_t *)&footer[20]);
+#else
+  disk_no = *(uint16_t *)&footer[4];
+  disk_start = *(uint16_t *)&footer[6];
+  nrecs_on_disk = *(uint16_t *)&footer[8];
+  nrecs = *(uint16_t *)&footer[10];
+  global_header_size = *(uint32_t *)&footer[12];
+  global_header_offset = *(uint32_t *)&footer[16];
+  comment_len = *(uint16_t *)&footer[20];
+#endif
+
+  UNUSED(disk_no); assert(disk_no == 0);
+  UNUSED(disk_start); assert(disk_start == 0);
+  UNUSED(nrecs_on_disk); assert(nrecs_on_disk == nrecs);
+  UNUSED(comment_len); assert(comment_len == 0);
+}
+
+// https://github.com/francescopace/cnpy/blob/4170b94634e5ff5b6925708f450480a9601627a9/cnpy.h#L187-L214
+void visp::cnpy::compressData(size_t nbytes_uncompressed, std::vector<uint8_t> &uncompressed,
+                              std::vector<uint8_t> &buffer_compressed, size_t &nbytes_on_disk, FILE *fp)
+{
+  // Compress using zlib deflate (raw deflate, no zlib/gzip header)
+  uLongf max_compressed_size = compressBound(nbytes_uncompressed);
+  buffer_compressed.resize(max_compressed_size);
+
+  z_stream strm;
+  strm.zalloc = Z_NULL;
+  strm.zfree = Z_NULL;
+  strm.opaque = Z_NULL;
+  int ret = deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+  if (ret != Z_OK) {
+    fclose(fp);
+    throw std::runtime_error("compressData(): deflateInit2 failed");
+  }
+
+  strm.avail_in = nbytes_uncompressed;
+  strm.next_in = &uncompressed[0];
+  strm.avail_out = max_compressed_size;
+  strm.next_out = &buffer_compressed[0];
+
+  ret = deflate(&strm, Z_FINISH);
+  if (ret != Z_STREAM_END) {
+    deflateEnd(&strm);
+    fclose(fp);
+    throw std::runtime_error("compressData(): deflate failed");
+  }
+
+  nbytes_on_disk = strm.total_out;
+  deflateEnd(&strm);
+}
+
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/*!
+  Load the specified \p fname filepath as arrays of data. This function is similar to the
+  <a href="https://numpy.org/doc/stable/reference/generated/numpy.load.html">numpy.load</a> function.
+  \param[in] fname : Path to the npz file.
+  \return A map of arrays data. The key represents the variable name, the value is an array of basic data type.
+  \warning This function has only been tested on little endian platform.
+  \note Original library: <a href="https://github.com/rogersce/cnpy">cnpy</a> with MIT license.
+
+  \sa To see how to use it, you may have a look at \ref tutorial-npz
+ */
+visp::cnpy::npz_t visp::cnpy::npz_load(const std::string &fname)
+{
+  visp::cnpy::npz_t arrays;
+  load_the_npz_file(open_mapped_file(fname), nullptr, false, arrays);
   return arrays;
 }
 
@@ -571,112 +847,619 @@ visp::cnpy::npz_t visp::cnpy::npz_load(const std::string &fname)
  */
 visp::cnpy::NpyArray visp::cnpy::npz_load(const std::string &fname, const std::string &varname)
 {
-  if (!vpIoTools::checkFilename(fname)) {
-    throw vpException(vpException::ioError, "This file does not exist: " + fname);
+  return load_the_npz_array(fname, varname, false);
+}
+
+/*!
+  Load the specified npy \p fname filepath as one array of data. This function is similar to the
+  <a href="https://numpy.org/doc/stable/reference/generated/numpy.load.html">numpy.load</a> function.
+  \param[in] fname : Path to the npy file.
+  \return An array of basic data type.
+  \warning This function has only been tested on little endian platform.
+  \note Original library: <a href="https://github.com/rogersce/cnpy">cnpy</a> with MIT license.
+ */
+visp::cnpy::NpyArray visp::cnpy::npy_load(const std::string &fname)
+{
+  std::shared_ptr<MappedFile> file = open_mapped_file(fname);
+  return load_the_npy_file(file, 0, file->size(), false);
+}
+
+/*!
+  Memory-map the specified \p fname npz file and return its arrays. This function is similar to the
+  <a href="https://numpy.org/doc/stable/reference/generated/numpy.load.html">numpy.load</a> function with
+  `mmap_mode='c'`: the arrays stored without compression are not copied but point into the mapped file (see
+  NpyArray::is_mapped()), the file being unmapped when the last of them is destroyed. Compressed arrays are inflated
+  in memory.
+
+  Pages are mapped copy-on-write, modifying the arrays does not modify the file. The file must however not be
+  modified or truncated while arrays are mapped.
+  \param[in] fname : Path to the npz file.
+  \return A map of arrays data. The key represents the variable name, the value is an array of basic data type.
+  \note Arrays written by npz_save() without compression are aligned in the file and can always be mapped. Arrays
+  written by other tools are copied when their data are not suitably aligned.
+
+  \sa npy_view() to get images or matrices that do not own their data.
+ */
+visp::cnpy::npz_t visp::cnpy::npz_mmap(const std::string &fname)
+{
+  visp::cnpy::npz_t arrays;
+  load_the_npz_file(open_mapped_file(fname), nullptr, true, arrays);
+  return arrays;
+}
+
+/*!
+  Memory-map the specified \p fname npz file and return its \p varname array. See npz_mmap(const std::string &).
+  \param[in] fname : Path to the npz file.
+  \param[in] varname : Identifier for the requested array of data.
+  \return An array of basic data type.
+ */
+visp::cnpy::NpyArray visp::cnpy::npz_mmap(const std::string &fname, const std::string &varname)
+{
+  return load_the_npz_array(fname, varname, true);
+}
+
+/*!
+  Memory-map the specified npy \p fname file. The returned array does not copy the data but points into the mapped
+  file, see npz_mmap(const std::string &) for the limitations.
+  \param[in] fname : Path to the npy file.
+  \return An array of basic data type.
+ */
+visp::cnpy::NpyArray visp::cnpy::npy_mmap(const std::string &fname)
+{
+  std::shared_ptr<MappedFile> file = open_mapped_file(fname);
+  return load_the_npy_file(file, 0, file->size(), true);
+}
+
+/*!
+  Make \p M a view of the 2-D array of double \p arr, without copying the data.
+  \param[in] arr : Array of data stored in C order, that must outlive the view.
+  \param[out] M : Matrix that does not own its data.
+  \exception vpException::dimensionError : If the array is not a 2-D array of double.
+ */
+void visp::cnpy::npy_view(NpyArray &arr, vpMatrix &M)
+{
+  if ((arr.shape.size() != 2) || arr.fortran_order || (arr.data_type != 'f') || (arr.word_size != sizeof(double))) {
+    throw vpException(vpException::dimensionError, "npy_view: the array cannot be viewed as a matrix");
   }
+  vpMatrix::view(M, arr.data<double>(), static_cast<unsigned int>(arr.shape[0]),
+                 static_cast<unsigned int>(arr.shape[1]));
+}
 
-  AutoCloser closer;
-  closer.fp = fopen(fname.c_str(), "rb");
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+struct visp::cnpy::NpzWriter::Member
+{
+  std::string name;
+  std::vector<char> npy_header;
+  std::vector<char> payload; //!< Copy of the data, for arrays written in the background
+  const char *data = nullptr;
+  size_t nbytes = 0;
+};
 
-  if (!closer.fp) {
-    throw std::runtime_error("npz_load: Unable to open file " + fname + "!");
+#if defined(VISP_HAVE_THREADS)
+class visp::cnpy::NpzWriter::Worker
+{
+public:
+  Worker(NpzWriter *writer, size_t max_pending)
+    : m_writer(writer), m_mutex(), m_cond(), m_members(), m_max_pending(max_pending), m_nb_pending(0), m_error(),
+    m_stop(false), m_thread()
+  {
+    m_thread = std::thread(&Worker::run, this);
   }
 
-  bool quit = false;
-  const unsigned int index_2 = 2;
-  const unsigned int index_3 = 3;
-  const unsigned int index_26 = 26;
-  const unsigned int index_28 = 28;
-  const unsigned int val_8 = 8;
-  const unsigned int val_18 = 18;
-  const unsigned int val_22 = 22;
-  const unsigned int val_30 = 30;
+  //! Write the pending arrays and stop the background thread.
+  ~Worker()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_cond.notify_all();
+    m_thread.join();
+  }
 
-  bool host_is_LE = true;
-#ifndef VISP_LITTLE_ENDIAN
-  host_is_LE = false;
-#endif
+  size_t get_nb_pending() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_nb_pending;
+  }
 
-  const bool header_file_is_LE = true;
-  bool same_endianness = (host_is_LE == header_file_is_LE);
-  while (!quit) {
-    std::vector<char> local_header(val_30);
-    size_t header_res = fread(&local_header[0], sizeof(char), val_30, closer.fp);
-    if (header_res != 30) {
-      throw std::runtime_error("npz_load 2: failed fread");
+  void set_max_pending(size_t max_pending)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_max_pending = max_pending;
+    m_cond.notify_all();
+  }
+
+  //! Queue the array, waiting first while the maximum number of arrays are pending.
+  void push(Member &member)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while ((m_max_pending > 0) && (m_nb_pending >= m_max_pending) && m_error.empty()) {
+      m_cond.wait(lock);
     }
+    throw_error();
+    m_members.push_back(Member());
+    std::swap(m_members.back(), member);
+    ++m_nb_pending;
+    m_cond.notify_all();
+  }
 
-    //if we've reached the global header, stop reading
-    if ((local_header[index_2] != 0x03) || (local_header[index_3] != 0x04)) {
-      quit = true;
+  //! Wait until all the arrays are written and throw an exception if an array could not be written.
+  void wait()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (m_nb_pending > 0) {
+      m_cond.wait(lock);
     }
-    else {
-      //read in the variable name
-      uint16_t name_len = swap16bits_if(*(uint16_t *)&local_header[index_26], !same_endianness);
-      std::string vname(name_len, ' ');
-      size_t vname_res = fread(&vname[0], sizeof(char), name_len, closer.fp);
-      if (vname_res != name_len) {
-        throw std::runtime_error("npz_load 2: failed fread");
-      }
-      vname.erase(vname.end()-4, vname.end()); //erase the lagging .npy
+    throw_error();
+  }
+
+private:
+  void throw_error()
+  {
+    if (!m_error.empty()) {
+      std::string error;
+      std::swap(error, m_error);
+      throw(vpException(vpException::ioError, error));
+    }
+  }
 
-      //read in the extra field
-      uint16_t extra_field_len = swap16bits_if(*(uint16_t *)&local_header[index_28], !same_endianness);
-      fseek(closer.fp, extra_field_len, SEEK_CUR); //skip past the extra field
+  void run()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    bool failed = false;
+    for (;;) {
+      while ((!m_stop) && m_members.empty()) {
+        m_cond.wait(lock);
+      }
+      if (m_members.empty()) {
+        return; // Stop requested and all the arrays are written
+      }
+      Member member;
+      std::swap(member, m_members.front());
+      m_members.pop_front();
+      lock.unlock();
+
+      // Once an array could not be written the offsets in the archive are wrong, the next arrays are dropped
+      std::string error;
+      if (failed) {
+        error = "NpzWriter: array " + member.name + " dropped after a write error";
+      }
+      else {
+        try {
+          m_writer->write_member(member);
+        }
+        catch (const std::exception &e) {
+          error = e.what();
+          failed = true;
+        }
+      }
+      member = Member();
 
-      std::vector<char> extra_field(extra_field_len);
-      if (extra_field_len > 0) {
-        size_t efield_res = fread(&extra_field[0], sizeof(char), extra_field_len, closer.fp);
-        if (efield_res != extra_field_len)
-          throw std::runtime_error("npz_load 2: failed fread");
+      lock.lock();
+      --m_nb_pending;
+      if (m_error.empty()) {
+        m_error = error;
       }
+      m_cond.notify_all();
+    }
+  }
+
+  NpzWriter *m_writer;
+  mutable std::mutex m_mutex;
+  std::condition_variable m_cond;
+  std::deque<Member> m_members;
+  size_t m_max_pending;
+  size_t m_nb_pending;
+  std::string m_error;
+  bool m_stop;
+  std::thread m_thread;
+};
+#else
+class visp::cnpy::NpzWriter::Worker
+{ };
+#endif
+#endif // DOXYGEN_SHOULD_SKIP_THIS
 
-      uint16_t compr_method = swap16bits_if(*reinterpret_cast<uint16_t *>(&local_header[0] + val_8), !same_endianness);
-      uint32_t compr_bytes = swap32bits_if(*reinterpret_cast<uint32_t *>(&local_header[0] + val_18), !same_endianness);
-      uint32_t uncompr_bytes = swap32bits_if(*reinterpret_cast<uint32_t *>(&local_header[0] + val_22), !same_endianness);
+/*!
+  Default constructor. Use open() to create the archive.
+ */
+visp::cnpy::NpzWriter::NpzWriter()
+  : m_fp(nullptr), m_compress(false), m_offset(0), m_central_directory(), m_num_entries(0), m_names(), m_worker(),
+  m_max_pending(16), m_error()
+{ }
+
+/*!
+  Create the \p zipname npz file, see open().
+ */
+visp::cnpy::NpzWriter::NpzWriter(const std::string &zipname, bool compress_data, bool asynchronous,
+                                 const std::string &mode)
+  : m_fp(nullptr), m_compress(false), m_offset(0), m_central_directory(), m_num_entries(0), m_names(), m_worker(),
+  m_max_pending(16), m_error()
+{
+  open(zipname, compress_data, asynchronous, mode);
+}
 
-      // ZIP64 support: if sizes are 0xFFFFFFFF, read from extra field
-      parse_zip64_sizes(extra_field, compr_bytes, uncompr_bytes);
+/*!
+  Destructor. Close the archive, errors that occur while writing the pending arrays are ignored. Call close() to be
+  notified of them.
+ */
+visp::cnpy::NpzWriter::~NpzWriter()
+{
+  try {
+    close();
+  }
+  catch (...) {
+  }
+}
 
-      if (vname == varname) {
-        NpyArray array = (compr_method == 0) ? load_the_npy_file(closer.fp) : load_the_npz_array(closer.fp, compr_bytes, uncompr_bytes);
-        return array;
+/*!
+  Open the \p zipname npz file.
+  \param[in] zipname : Path to the npz file.
+  \param[in] compress_data : Flag to indicate if the arrays should be compressed or not.
+  \param[in] asynchronous : When true, the arrays are compressed and written by a background thread. Requires ViSP to
+  be built with threads support, otherwise the arrays are written in add().
+  \param[in] mode : Writing mode, i.e. overwrite (w) or append (a) to the file. In append mode, the central directory
+  of the existing archive is read once and the new arrays are written in place of it.
+  \exception vpException::ioError : If the file cannot be opened, or is not a valid archive in append mode.
+ */
+void visp::cnpy::NpzWriter::open(const std::string &zipname, bool compress_data, bool asynchronous,
+                                 const std::string &mode)
+{
+  close();
+
+  m_compress = compress_data;
+  m_offset = 0;
+  m_central_directory.clear();
+  m_num_entries = 0;
+  m_names.clear();
+  m_error.clear();
+
+  if ((mode == "a") && vpIoTools::checkFilename(zipname)) {
+    // Read the end of central directory record, that is the last 22 bytes since npz files have no comment
+    std::shared_ptr<MappedFile> file = open_mapped_file(zipname);
+    const size_t eocd_size = 22, locator_size = 20;
+    const unsigned char *data = file->data();
+    if ((file->size() < eocd_size) || (read32bits_le(data + file->size() - eocd_size) != 0x06054b50)) {
+      throw vpException(vpException::ioError, "NpzWriter: " + zipname + " is not a valid npz file");
+    }
+    const unsigned char *eocd = data + file->size() - eocd_size;
+    m_num_entries = read16bits_le(eocd + 10);
+    uint64_t central_directory_size = read32bits_le(eocd + 12);
+    m_offset = read32bits_le(eocd + 16);
+    if ((m_num_entries == 0xFFFF) || (central_directory_size == 0xFFFFFFFF) || (m_offset == 0xFFFFFFFF)) {
+      // ZIP64 end of central directory record, pointed by the locator that precedes the end of central directory
+      const unsigned char *locator = eocd - locator_size;
+      if ((file->size() < eocd_size + locator_size) || (read32bits_le(locator) != 0x07064b50)) {
+        throw vpException(vpException::ioError, "NpzWriter: " + zipname + " is not a valid npz file");
       }
-      else {
-        //skip past the data (use compr_bytes for compressed data)
-        fseek(closer.fp, compr_bytes, SEEK_CUR);
+      const uint64_t zip64_eocd_offset = read64bits_le(locator + 8);
+      if ((zip64_eocd_offset + 56 > file->size()) || (read32bits_le(data + zip64_eocd_offset) != 0x06064b50)) {
+        throw vpException(vpException::ioError, "NpzWriter: " + zipname + " is not a valid npz file");
+      }
+      const unsigned char *zip64_eocd = data + zip64_eocd_offset;
+      m_num_entries = read64bits_le(zip64_eocd + 32);
+      central_directory_size = read64bits_le(zip64_eocd + 40);
+      m_offset = read64bits_le(zip64_eocd + 48);
+    }
+    if (m_offset + central_directory_size > file->size()) {
+      throw vpException(vpException::ioError, "NpzWriter: " + zipname + " is not a valid npz file");
+    }
+    const char *central_directory = reinterpret_cast<const char *>(data + m_offset);
+    m_central_directory.assign(central_directory, central_directory + central_directory_size);
+
+    // Names of the existing arrays
+    const size_t entry_size = 46;
+    size_t entry = 0;
+    for (uint64_t i = 0; (i < m_num_entries) && (entry + entry_size <= m_central_directory.size()); ++i) {
+      const unsigned char *entry_header = reinterpret_cast<const unsigned char *>(&m_central_directory[entry]);
+      const uint16_t name_len = read16bits_le(entry_header + 28);
+      const uint16_t extra_field_len = read16bits_le(entry_header + 30);
+      const uint16_t comment_len = read16bits_le(entry_header + 32);
+      std::string name(&m_central_directory[entry + entry_size],
+                       std::min<size_t>(name_len, m_central_directory.size() - entry - entry_size));
+      // Members are stored as <array name>.npy
+      if ((name.size() > 4) && (name.compare(name.size() - 4, 4, ".npy") == 0)) {
+        name.erase(name.size() - 4);
       }
+      m_names.insert(name);
+      entry += entry_size + name_len + extra_field_len + comment_len;
+    }
+    file.reset();
+
+    m_fp = fopen(zipname.c_str(), "r+b");
+    if ((m_fp != nullptr) && (fseek64(m_fp, m_offset) != 0)) {
+      fclose(m_fp);
+      m_fp = nullptr;
     }
   }
+  else {
+    m_fp = fopen(zipname.c_str(), "wb");
+  }
+  if (m_fp == nullptr) {
+    throw vpException(vpException::ioError, "NpzWriter: Unable to open file " + zipname);
+  }
 
-  //if we get here, we haven't found the variable in the file
-  throw std::runtime_error("npz_load 2: Variable name " + varname + " not found in " + fname);
+#if defined(VISP_HAVE_THREADS)
+  if (asynchronous) {
+    m_worker = std::make_shared<Worker>(this, m_max_pending);
+  }
+#else
+  (void)asynchronous;
+#endif
 }
 
 /*!
-  Load the specified npy \p fname filepath as one array of data. This function is similar to the
-  <a href="https://numpy.org/doc/stable/reference/generated/numpy.load.html">numpy.load</a> function.
-  \param[in] fname : Path to the npy file.
-  \return An array of basic data type.
-  \warning This function has only been tested on little endian platform.
-  \note Original library: <a href="https://github.com/rogersce/cnpy">cnpy</a> with MIT license.
+  Write the pending arrays and the central directory, and close the archive. Does nothing if the archive is not
+  opened.
+  \exception vpException::ioError : If an array or the central directory could not be written. Once an array could
+  not be written, the file is closed without its central directory.
  */
-visp::cnpy::NpyArray visp::cnpy::npy_load(const std::string &fname)
+void visp::cnpy::NpzWriter::close()
 {
-  if (!vpIoTools::checkFilename(fname)) {
-    throw vpException(vpException::ioError, "This file does not exist: " + fname);
+  if (m_fp == nullptr) {
+    return;
+  }
+
+  try {
+    flush();
+  }
+  catch (...) {
+    m_worker.reset();
+    fclose(m_fp);
+    m_fp = nullptr;
+    throw;
   }
+  m_worker.reset();
 
-  AutoCloser closer;
-  closer.fp = fopen(fname.c_str(), "rb");
+  // End of central directory record, preceded by its ZIP64 version when the archive is too large
+  const uint64_t central_directory_offset = m_offset;
+  const uint64_t central_directory_size = m_central_directory.size();
+  std::vector<char> footer;
+  if ((m_num_entries >= 0xFFFF) || (central_directory_offset >= 0xFFFFFFFF) ||
+      (central_directory_size >= 0xFFFFFFFF)) {
+    const uint64_t zip64_eocd_offset = central_directory_offset + central_directory_size;
+    append32bits_le(footer, 0x06064b50); //zip64 end of central directory signature
+    append64bits_le(footer, 44); //size of the remaining record
+    append16bits_le(footer, 45); //version made by
+    append16bits_le(footer, 45); //min version to extract
+    append32bits_le(footer, 0); //number of this disk
+    append32bits_le(footer, 0); //disk where central directory starts
+    append64bits_le(footer, m_num_entries); //number of records on this disk
+    append64bits_le(footer, m_num_entries); //total number of records
+    append64bits_le(footer, central_directory_size); //nbytes of global headers
+    append64bits_le(footer, central_directory_offset); //offset of start of global headers
+
+    append32bits_le(footer, 0x07064b50); //zip64 end of central directory locator signature
+    append32bits_le(footer, 0); //disk where the zip64 end of central directory starts
+    append64bits_le(footer, zip64_eocd_offset); //offset of the zip64 end of central directory
+    append32bits_le(footer, 1); //total number of disks
+  }
+  append32bits_le(footer, 0x06054b50); //end of central directory signature
+  append16bits_le(footer, 0); //number of this disk
+  append16bits_le(footer, 0); //disk where footer starts
+  append16bits_le(footer, static_cast<uint16_t>(std::min<uint64_t>(m_num_entries, 0xFFFF))); //number of records on this disk
+  append16bits_le(footer, static_cast<uint16_t>(std::min<uint64_t>(m_num_entries, 0xFFFF))); //total number of records
+  append32bits_le(footer, static_cast<uint32_t>(std::min<uint64_t>(central_directory_size, 0xFFFFFFFF))); //nbytes of global headers
+  append32bits_le(footer, static_cast<uint32_t>(std::min<uint64_t>(central_directory_offset, 0xFFFFFFFF))); //offset of start of global headers
+  append16bits_le(footer, 0); //zip file comment length
+
+  bool success = true;
+  if (!m_central_directory.empty()) {
+    success = (fwrite(&m_central_directory[0], 1, m_central_directory.size(), m_fp) == m_central_directory.size());
+  }
+  success = success && (fwrite(&footer[0], 1, footer.size(), m_fp) == footer.size());
+  success = (fclose(m_fp) == 0) && success;
+  m_fp = nullptr;
+  m_central_directory.clear();
+  if (!success) {
+    throw vpException(vpException::ioError, "NpzWriter: cannot write the central directory");
+  }
+}
 
-  if (!closer.fp) {
-    throw std::runtime_error("npy_load: Unable to open file " + fname + "!");
+/*!
+  Wait until all the arrays added so far are written. Does nothing when the arrays are not written in the
+  background.
+  \exception vpException::ioError : If an array could not be written, now or by a previous call.
+ */
+void visp::cnpy::NpzWriter::flush()
+{
+  if (!m_error.empty()) {
+    throw vpException(vpException::ioError, m_error);
+  }
+#if defined(VISP_HAVE_THREADS)
+  if (m_worker) {
+    try {
+      m_worker->wait();
+    }
+    catch (const vpException &e) {
+      m_error = e.getStringMessage();
+      throw;
+    }
   }
+#endif
+}
 
-  NpyArray arr = load_the_npy_file(closer.fp);
+/*!
+  Return the number of arrays in the archive, including the pending ones.
+ */
+size_t visp::cnpy::NpzWriter::num_arrays() const
+{
+  return m_names.size();
+}
 
-  return arr;
+/*!
+  Return the number of arrays waiting to be written in the background.
+ */
+size_t visp::cnpy::NpzWriter::num_pending() const
+{
+#if defined(VISP_HAVE_THREADS)
+  if (m_worker) {
+    return m_worker->get_nb_pending();
+  }
+#endif
+  return 0;
+}
+
+/*!
+  Set the maximum number of arrays waiting to be written in the background. When it is reached, add() waits until an
+  array is written, which bounds the memory used by the queue. The default value is 16.
+  \param[in] max_pending : Maximum number of pending arrays, 0 for no limit.
+ */
+void visp::cnpy::NpzWriter::set_max_pending(size_t max_pending)
+{
+  m_max_pending = max_pending;
+#if defined(VISP_HAVE_THREADS)
+  if (m_worker) {
+    m_worker->set_max_pending(max_pending);
+  }
+#endif
+}
+
+void visp::cnpy::NpzWriter::add_npy(const std::string &fname, const std::vector<char> &npy_header, const char *data,
+                                    size_t nbytes)
+{
+  if (m_fp == nullptr) {
+    throw vpException(vpException::notInitialized, "NpzWriter: the archive is not opened");
+  }
+  if (!m_error.empty()) {
+    throw vpException(vpException::ioError, m_error);
+  }
+  if (m_names.find(fname) != m_names.end()) {
+    throw vpException(vpException::badValue, "NpzWriter: array " + fname + " is already in the archive");
+  }
+
+  Member member;
+  member.name = fname + ".npy";
+  member.npy_header = npy_header;
+  member.data = data;
+  member.nbytes = nbytes;
+#if defined(VISP_HAVE_THREADS)
+  if (m_worker) {
+    if (nbytes > 0) {
+      member.payload.assign(data, data + nbytes);
+      member.data = &member.payload[0];
+    }
+    try {
+      m_worker->push(member);
+    }
+    catch (const vpException &e) {
+      m_error = e.getStringMessage();
+      throw;
+    }
+    m_names.insert(fname);
+    return;
+  }
+#endif
+  try {
+    write_member(member);
+  }
+  catch (const std::exception &e) {
+    m_error = e.what();
+    throw;
+  }
+  m_names.insert(fname);
+}
+
+void visp::cnpy::NpzWriter::write_member(const Member &member)
+{
+  std::vector<std::pair<const char *, size_t> > buffers;
+  buffers.push_back(std::make_pair(&member.npy_header[0], member.npy_header.size()));
+  if (member.nbytes > 0) {
+    buffers.push_back(std::make_pair(member.data, member.nbytes));
+  }
+
+  uint32_t crc = 0;
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    crc = vp_mz_crc32(crc, reinterpret_cast<const unsigned char *>(buffers[i].first), buffers[i].second);
+  }
+  const uint64_t nbytes_uncompressed = member.npy_header.size() + member.nbytes;
+  uint64_t nbytes_on_disk = nbytes_uncompressed;
+  uint16_t compression_method = 0; // store
+  std::vector<char> compressed;
+  if (m_compress && (member.nbytes > 0)) {
+    deflate_buffers(buffers, compressed);
+    buffers.assign(1, std::make_pair(&compressed[0], compressed.size()));
+    nbytes_on_disk = compressed.size();
+    compression_method = 8; // deflate
+  }
+
+  // ZIP64 extended information of the local header, with both sizes
+  const bool zip64_sizes = (nbytes_uncompressed >= 0xFFFFFFFF) || (nbytes_on_disk >= 0xFFFFFFFF);
+  std::vector<char> extra_field;
+  if (zip64_sizes) {
+    append16bits_le(extra_field, 0x0001); //zip64 extra field id
+    append16bits_le(extra_field, 16); //extra field data size
+    append64bits_le(extra_field, nbytes_uncompressed); //uncompressed size
+    append64bits_le(extra_field, nbytes_on_disk); //compressed size
+  }
+  // Pad stored arrays so that their data are aligned, see npz_save()
+  const size_t local_header_size = 30;
+  if (compression_method == 0) {
+    const size_t alignment = 64;
+    const uint64_t data_offset = m_offset + local_header_size + member.name.size() + extra_field.size() +
+      member.npy_header.size();
+    if ((data_offset % alignment) != 0) {
+      const size_t padding = static_cast<size_t>((alignment - ((data_offset + 6) % alignment)) % alignment);
+      append16bits_le(extra_field, 0xD935); //zipalign extra field id
+      append16bits_le(extra_field, static_cast<uint16_t>(2 + padding)); //extra field data size
+      append16bits_le(extra_field, static_cast<uint16_t>(alignment)); //alignment
+      extra_field.insert(extra_field.end(), padding, 0);
+    }
+  }
+
+  const bool zip64_offset = (m_offset >= 0xFFFFFFFF);
+  const uint16_t version = (zip64_sizes || zip64_offset) ? 45 : 20;
+  std::vector<char> local_header;
+  append32bits_le(local_header, 0x04034b50); //sig
+  append16bits_le(local_header, version); //min version to extract
+  append16bits_le(local_header, 0); //general purpose bit flag
+  append16bits_le(local_header, compression_method); //compression method
+  append16bits_le(local_header, 0); //file last mod time
+  append16bits_le(local_header, 0); //file last mod date
+  append32bits_le(local_header, crc); //crc
+  append32bits_le(local_header, zip64_sizes ? 0xFFFFFFFF : static_cast<uint32_t>(nbytes_on_disk)); //compressed size
+  append32bits_le(local_header, zip64_sizes ? 0xFFFFFFFF : static_cast<uint32_t>(nbytes_uncompressed)); //uncompressed size
+  append16bits_le(local_header, static_cast<uint16_t>(member.name.size())); //fname length
+  append16bits_le(local_header, static_cast<uint16_t>(extra_field.size())); //extra field length
+  local_header.insert(local_header.end(), member.name.begin(), member.name.end());
+  local_header.insert(local_header.end(), extra_field.begin(), extra_field.end());
+
+  bool success = (fwrite(&local_header[0], 1, local_header.size(), m_fp) == local_header.size());
+  for (size_t i = 0; success && (i < buffers.size()); ++i) {
+    success = (fwrite(buffers[i].first, 1, buffers[i].second, m_fp) == buffers[i].second);
+  }
+  if (!success) {
+    throw vpException(vpException::ioError, "NpzWriter: cannot write array " + member.name);
+  }
+
+  // Central directory entry, with the ZIP64 extended information of the fields that overflow
+  std::vector<char> central_extra_field;
+  if (zip64_sizes || zip64_offset) {
+    append16bits_le(central_extra_field, 0x0001); //zip64 extra field id
+    append16bits_le(central_extra_field, static_cast<uint16_t>((zip64_sizes ? 16 : 0) + (zip64_offset ? 8 : 0)));
+    if (zip64_sizes) {
+      append64bits_le(central_extra_field, nbytes_uncompressed); //uncompressed size
+      append64bits_le(central_extra_field, nbytes_on_disk); //compressed size
+    }
+    if (zip64_offset) {
+      append64bits_le(central_extra_field, m_offset); //relative offset of local file header
+    }
+  }
+  append32bits_le(m_central_directory, 0x02014b50); //sig
+  append16bits_le(m_central_directory, version); //version made by
+  m_central_directory.insert(m_central_directory.end(), local_header.begin() + 4, local_header.begin() + 28);
+  append16bits_le(m_central_directory, static_cast<uint16_t>(central_extra_field.size())); //extra field length
+  append16bits_le(m_central_directory, 0); //file comment length
+  append16bits_le(m_central_directory, 0); //disk number where file starts
+  append16bits_le(m_central_directory, 0); //internal file attributes
+  append32bits_le(m_central_directory, 0); //external file attributes
+  append32bits_le(m_central_directory, zip64_offset ? 0xFFFFFFFF : static_cast<uint32_t>(m_offset)); //relative offset of local file header
+  m_central_directory.insert(m_central_directory.end(), member.name.begin(), member.name.end());
+  m_central_directory.insert(m_central_directory.end(), central_extra_field.begin(), central_extra_field.end());
+
+  m_offset += local_header.size() + nbytes_on_disk;
+  ++m_num_entries;
 }
 
 namespace visp
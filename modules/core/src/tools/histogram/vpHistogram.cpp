@@ -293,9 +293,15 @@ void vpHistogram::init(unsigned size_)
   \param I : Gray level image.
   \param nbins : Number of bins to compute the histogram.
   \param nbThreads : Number of threads to use for the computation.
+
+  \exception vpException::badValue If the image or the mask is not contiguous, see vpImage::isContiguous().
 */
 void vpHistogram::calculate(const vpImage<unsigned char> &I, unsigned int nbins, unsigned int nbThreads)
 {
+  if ((!I.isContiguous()) || ((mp_mask != nullptr) && (!mp_mask->isContiguous()))) {
+    throw(vpException(vpException::badValue, "vpHistogram::calculate() does not support non contiguous images such "
+                      "as views, see vpImage::isContiguous()"));
+  }
   const unsigned int val_256 = 256;
   if (m_size != nbins) {
     if (m_histogram != nullptr) {
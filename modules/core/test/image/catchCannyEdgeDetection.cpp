@@ -0,0 +1,174 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Test the Canny edge detector.
+ */
+
+/*!
+  \example catchCannyEdgeDetection.cpp
+
+  Test that the Canny edge detector gives the same results whatever the number of threads and
+  that the edge tracking step can follow very long chains of weak edges.
+ */
+#include <visp3/core/vpConfig.h>
+
+#if defined(VISP_HAVE_CATCH2) && (VISP_CXX_STANDARD >= VISP_CXX_STANDARD_11)
+#include <cmath>
+
+#include <visp3/core/vpCannyEdgeDetection.h>
+#include <visp3/core/vpUniRand.h>
+
+#if defined(VISP_BUILD_CATCH2)
+#include <catch_amalgamated.hpp>
+#else // Since v3.1.1
+#include <catch2/catch_all.hpp>
+#endif
+
+#ifdef ENABLE_VISP_NAMESPACE
+using namespace VISP_NAMESPACE_NAME;
+#endif
+
+namespace
+{
+// Smooth pattern with noise, that gives a lot of weak edges
+void texturedImage(vpImage<unsigned char> &I, unsigned int height, unsigned int width)
+{
+  vpUniRand rng(42);
+  I.resize(height, width);
+  for (unsigned int i = 0; i < height; ++i) {
+    for (unsigned int j = 0; j < width; ++j) {
+      double val = 128. + (60. * std::sin(i * 0.05) * std::cos(j * 0.03)) + (40. * std::sin((i + j) * 0.2))
+        + rng.uniform(-30., 30.);
+      I[i][j] = static_cast<unsigned char>(std::max<double>(0., std::min<double>(255., val)));
+    }
+  }
+}
+
+bool equal(const std::vector<vpImagePoint> &l1, const std::vector<vpImagePoint> &l2)
+{
+  if (l1.size() != l2.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < l1.size(); ++i) {
+    if (l1[i] != l2[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+TEST_CASE("Canny edge detection is deterministic", "[vpCannyEdgeDetection]")
+{
+  vpImage<unsigned char> I;
+  texturedImage(I, 480, 640);
+
+  const float thresholds[][2] = { { -1.f, -1.f }, { 1.f, 4.f } };
+  for (auto threshold : thresholds) {
+    vpCannyEdgeDetection detector_ref(5, 1.f, 3, threshold[0], threshold[1], 0.6f, 0.8f,
+                                      vpImageFilter::CANNY_GBLUR_SOBEL_FILTERING, true, 1);
+    vpImage<unsigned char> E_ref = detector_ref.detect(I);
+    std::vector<vpImagePoint> list_ref = detector_ref.getEdgePointsList();
+    CHECK(list_ref.size() > 0);
+
+    unsigned int nbEdges = 0;
+    for (unsigned int i = 0; i < E_ref.getSize(); ++i) {
+      nbEdges += (E_ref.bitmap[i] == 255) ? 1 : 0;
+    }
+    CHECK(nbEdges == list_ref.size());
+
+    const int nbThreads[] = { 2, 3, 4 };
+    for (auto nbThread : nbThreads) {
+      vpCannyEdgeDetection detector(5, 1.f, 3, threshold[0], threshold[1], 0.6f, 0.8f,
+                                    vpImageFilter::CANNY_GBLUR_SOBEL_FILTERING, true, nbThread);
+      // The buffers of the detector are reused between two calls
+      for (unsigned int n = 0; n < 2; ++n) {
+        vpImage<unsigned char> E = detector.detect(I);
+        CHECK(E == E_ref);
+        CHECK(equal(detector.getEdgePointsList(), list_ref));
+      }
+    }
+  }
+}
+
+TEST_CASE("Canny edge tracking of long weak edges", "[vpCannyEdgeDetection]")
+{
+  // Gradients forming a single chain of weak edges that meanders through the whole image,
+  // with a strong edge at its very end
+  const unsigned int height = 1000, width = 1001;
+  const float weak = 5.f, strong = 100.f;
+  vpImage<float> dIx(height, width, 0.f), dIy(height, width, 0.f);
+  unsigned int nbWeakEdges = 0;
+  for (unsigned int j = 2; j < (width - 2); j += 2) {
+    for (unsigned int i = 2; i < (height - 2); ++i) {
+      dIx[i][j] = weak;
+      ++nbWeakEdges;
+    }
+    if ((j + 3) < width) {
+      // Link with the next column, alternatively at the bottom and at the top of the image
+      unsigned int i = ((j / 2) % 2 == 1) ? (height - 3) : 2;
+      dIx[i][j + 1] = weak;
+      ++nbWeakEdges;
+    }
+  }
+  const unsigned int lastCol = ((width - 3) / 2) * 2;
+  const unsigned int lastRow = ((lastCol / 2) % 2 == 1) ? (height - 3) : 2;
+  dIx[lastRow][lastCol] = strong;
+
+  vpCannyEdgeDetection detector(5, 1.f, 3, 1.f, 50.f, 0.6f, 0.8f, vpImageFilter::CANNY_GBLUR_SOBEL_FILTERING, true, 1);
+  detector.setGradients(dIx, dIy);
+  vpImage<unsigned char> I(height, width, 0);
+  vpImage<unsigned char> E = detector.detect(I);
+
+  unsigned int nbEdges = 0;
+  bool isEdgeMapValid = true;
+  for (unsigned int i = 0; i < E.getSize(); ++i) {
+    if (E.bitmap[i] == 255) {
+      ++nbEdges;
+      isEdgeMapValid = isEdgeMapValid && (dIx.bitmap[i] > 0.f);
+    }
+  }
+  CHECK(isEdgeMapValid);
+  CHECK(nbEdges == nbWeakEdges);
+  CHECK(detector.getEdgePointsList().size() == nbWeakEdges);
+}
+
+int main(int argc, char *argv[])
+{
+  Catch::Session session;
+  session.applyCommandLine(argc, argv);
+  int numFailed = session.run();
+  return numFailed;
+}
+#else
+#include <iostream>
+
+int main() { return EXIT_SUCCESS; }
+#endif
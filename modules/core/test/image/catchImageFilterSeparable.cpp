@@ -0,0 +1,273 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Test the separable filters of vpImageFilter.
+ */
+
+/*!
+  \example catchImageFilterSeparable.cpp
+
+  Test that the row-buffered separable filters of vpImageFilter give the same results as the per pixel
+  implementation, which is used when a mask is given.
+ */
+#include <visp3/core/vpConfig.h>
+
+#if defined(VISP_HAVE_CATCH2) && (VISP_CXX_STANDARD >= VISP_CXX_STANDARD_11)
+#include <visp3/core/vpImageFilter.h>
+#include <visp3/core/vpImagePool.h>
+#include <visp3/core/vpUniRand.h>
+
+#if defined(VISP_BUILD_CATCH2)
+#include <catch_amalgamated.hpp>
+#else // Since v3.1.1
+#include <catch2/catch_all.hpp>
+#endif
+
+#ifdef ENABLE_VISP_NAMESPACE
+using namespace VISP_NAMESPACE_NAME;
+#endif
+
+namespace
+{
+template <typename Type> bool equal(const vpImage<Type> &I1, const vpImage<Type> &I2)
+{
+  if ((I1.getHeight() != I2.getHeight()) || (I1.getWidth() != I2.getWidth())) {
+    return false;
+  }
+  for (unsigned int i = 0; i < I1.getHeight(); ++i) {
+    for (unsigned int j = 0; j < I1.getWidth(); ++j) {
+      if (!(I1[i][j] == I2[i][j])) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+template <typename Type> void randomImage(vpImage<Type> &I, unsigned int height, unsigned int width, vpUniRand &rng)
+{
+  I.resize(height, width);
+  for (unsigned int i = 0; i < height; ++i) {
+    for (unsigned int j = 0; j < width; ++j) {
+      I[i][j] = static_cast<Type>(rng.uniform(0, 256));
+    }
+  }
+}
+
+void randomImage(vpImage<vpRGBa> &I, unsigned int height, unsigned int width, vpUniRand &rng)
+{
+  I.resize(height, width);
+  for (unsigned int i = 0; i < height; ++i) {
+    for (unsigned int j = 0; j < width; ++j) {
+      I[i][j] = vpRGBa(static_cast<unsigned char>(rng.uniform(0, 256)), static_cast<unsigned char>(rng.uniform(0, 256)),
+                       static_cast<unsigned char>(rng.uniform(0, 256)));
+    }
+  }
+}
+}
+
+TEST_CASE("Separable filters", "[vpImageFilter]")
+{
+  vpUniRand rng(42);
+  const unsigned int sizes[] = { 3, 5, 7, 9 };
+  vpImage<unsigned char> I;
+  vpImage<float> If;
+  vpImage<double> Id;
+  randomImage(I, 53, 67, rng);
+  randomImage(If, 53, 67, rng);
+  randomImage(Id, 53, 67, rng);
+  vpImage<bool> mask(53, 67, true);
+
+  for (auto size : sizes) {
+    std::vector<float> kernel((size + 1) / 2), derivative((size + 1) / 2);
+    vpImageFilter::getGaussianKernel(kernel.data(), size, 0.f, true);
+    vpImageFilter::getGaussianDerivativeKernel(derivative.data(), size, 0.f, true);
+    std::vector<double> kernel_d(kernel.begin(), kernel.end());
+
+    vpImage<float> dI, dI_ref;
+    vpImageFilter::filterX(I, dI, kernel.data(), size);
+    vpImageFilter::filterX(I, dI_ref, kernel.data(), size, &mask);
+    CHECK(equal(dI, dI_ref));
+
+    vpImageFilter::filterY(I, dI, kernel.data(), size);
+    vpImageFilter::filterY(I, dI_ref, kernel.data(), size, &mask);
+    CHECK(equal(dI, dI_ref));
+
+    vpImageFilter::filterX(If, dI, kernel.data(), size);
+    vpImageFilter::filterX(If, dI_ref, kernel.data(), size, &mask);
+    CHECK(equal(dI, dI_ref));
+
+    vpImageFilter::filterY(If, dI, kernel.data(), size);
+    vpImageFilter::filterY(If, dI_ref, kernel.data(), size, &mask);
+    CHECK(equal(dI, dI_ref));
+
+    vpImage<double> dId, dId_ref;
+    vpImageFilter::filterX(Id, dId, kernel_d.data(), size);
+    vpImageFilter::filterX(Id, dId_ref, kernel_d.data(), size, &mask);
+    CHECK(equal(dId, dId_ref));
+
+    vpImageFilter::filterY(Id, dId, kernel_d.data(), size);
+    vpImageFilter::filterY(Id, dId_ref, kernel_d.data(), size, &mask);
+    CHECK(equal(dId, dId_ref));
+
+    vpImageFilter::getGradX(I, dI, derivative.data(), size);
+    vpImageFilter::getGradX(I, dI_ref, derivative.data(), size, &mask);
+    CHECK(equal(dI, dI_ref));
+
+    vpImageFilter::getGradY(I, dI, derivative.data(), size);
+    vpImageFilter::getGradY(I, dI_ref, derivative.data(), size, &mask);
+    CHECK(equal(dI, dI_ref));
+
+    vpImageFilter::getGradXGauss2D(I, dI, kernel.data(), derivative.data(), size);
+    vpImageFilter::getGradXGauss2D(I, dI_ref, kernel.data(), derivative.data(), size, &mask);
+    CHECK(equal(dI, dI_ref));
+
+    vpImageFilter::getGradYGauss2D(I, dI, kernel.data(), derivative.data(), size);
+    vpImageFilter::getGradYGauss2D(I, dI_ref, kernel.data(), derivative.data(), size, &mask);
+    CHECK(equal(dI, dI_ref));
+
+    vpImage<unsigned char> GI, GI_ref;
+    vpImageFilter::gaussianBlur(I, GI, size, 0.f);
+    vpImageFilter::gaussianBlur(I, GI_ref, size, 0.f, true, &mask);
+    CHECK(equal(GI, GI_ref));
+  }
+}
+
+TEST_CASE("Separable filters on color images", "[vpImageFilter]")
+{
+  vpUniRand rng(42);
+  vpImage<vpRGBa> I;
+  randomImage(I, 41, 37, rng);
+  vpImage<bool> mask(41, 37, true);
+
+  const unsigned int sizes[] = { 3, 7 };
+  for (auto size : sizes) {
+    vpImage<vpRGBa> GI, GI_ref;
+    vpImageFilter::gaussianBlur(I, GI, size, 0.f);
+    vpImageFilter::gaussianBlur(I, GI_ref, size, 0.f, true, &mask);
+    CHECK(equal(GI, GI_ref));
+
+    vpImageFilter::gaussianBlur(I, GI, size, 0.);
+    vpImageFilter::gaussianBlur(I, GI_ref, size, 0., true, &mask);
+    CHECK(equal(GI, GI_ref));
+  }
+}
+
+TEST_CASE("Separable filters threads and pool", "[vpImageFilter]")
+{
+  vpUniRand rng(42);
+  vpImage<unsigned char> I;
+  randomImage(I, 53, 67, rng);
+  vpImage<vpRGBa> Irgba;
+  randomImage(Irgba, 41, 37, rng);
+  const unsigned int size = 7;
+  std::vector<float> kernel((size + 1) / 2);
+  vpImageFilter::getGaussianKernel(kernel.data(), size, 0.f, true);
+  std::vector<double> kernel_d(kernel.begin(), kernel.end());
+
+  vpImage<float> dIx_ref, dIy_ref;
+  vpImageFilter::filterX(I, dIx_ref, kernel.data(), size, nullptr, 1);
+  vpImageFilter::filterY(I, dIy_ref, kernel.data(), size, nullptr, 1);
+  vpImage<vpRGBa> dIx_rgba_ref, dIy_rgba_ref;
+  vpImageFilter::filterX(Irgba, dIx_rgba_ref, kernel_d.data(), size, nullptr, 1);
+  vpImageFilter::filterY(Irgba, dIy_rgba_ref, kernel_d.data(), size, nullptr, 1);
+
+  // The row buffers of the threads come from the pool of the calling thread
+  vpImagePool pool;
+  vpImagePool::setThreadPool(&pool);
+  const int nbThreads[] = { 1, 3, -1 };
+  for (auto nbThread : nbThreads) {
+    vpImage<float> dIx, dIy;
+    vpImage<vpRGBa> dIx_rgba, dIy_rgba;
+    for (unsigned int iter = 0; iter < 3; ++iter) {
+      vpImageFilter::filterX(I, dIx, kernel.data(), size, nullptr, nbThread);
+      vpImageFilter::filterY(I, dIy, kernel.data(), size, nullptr, nbThread);
+      vpImageFilter::filterX(Irgba, dIx_rgba, kernel_d.data(), size, nullptr, nbThread);
+      vpImageFilter::filterY(Irgba, dIy_rgba, kernel_d.data(), size, nullptr, nbThread);
+      CHECK(equal(dIx, dIx_ref));
+      CHECK(equal(dIy, dIy_ref));
+      CHECK(equal(dIx_rgba, dIx_rgba_ref));
+      CHECK(equal(dIy_rgba, dIy_rgba_ref));
+      if (iter == 0) {
+        pool.resetCounters();
+      }
+    }
+    CHECK(pool.getNbAcquisitions() > 0);
+    CHECK(pool.getNbAllocations() == 0);
+    CHECK(pool.getNbImagesInUse() == 0);
+  }
+  vpImagePool::setThreadPool(nullptr);
+}
+
+TEST_CASE("Fixed-point Gaussian blur", "[vpImageFilter]")
+{
+  vpUniRand rng(42);
+  vpImage<unsigned char> I;
+  randomImage(I, 53, 67, rng);
+
+  const unsigned int sizes[] = { 3, 5, 7 };
+  for (auto size : sizes) {
+    vpImage<double> GI_ref;
+    vpImageFilter::gaussianBlur(I, GI_ref, size, 0.);
+    vpImage<unsigned char> GI;
+    vpImageFilter::gaussianBlurFixedPoint(I, GI, size);
+
+    REQUIRE(GI.getHeight() == I.getHeight());
+    REQUIRE(GI.getWidth() == I.getWidth());
+    int max_error = 0;
+    for (unsigned int i = 0; i < I.getHeight(); ++i) {
+      for (unsigned int j = 0; j < I.getWidth(); ++j) {
+        max_error = std::max<int>(max_error, std::abs(vpMath::round(GI_ref[i][j]) - GI[i][j]));
+      }
+    }
+    CHECK(max_error <= 1);
+  }
+
+  // Constant images are preserved
+  vpImage<unsigned char> C(20, 20, 200), GC;
+  vpImageFilter::gaussianBlurFixedPoint(C, GC, 7);
+  CHECK(equal(C, GC));
+
+  vpImage<unsigned char> tiny(4, 4, 0);
+  CHECK_THROWS_AS(vpImageFilter::gaussianBlurFixedPoint(tiny, GC, 7), vpException);
+}
+
+int main(int argc, char *argv[])
+{
+  Catch::Session session;
+  session.applyCommandLine(argc, argv);
+  int numFailed = session.run();
+  return numFailed;
+}
+#else
+#include <iostream>
+
+int main() { return EXIT_SUCCESS; }
+#endif
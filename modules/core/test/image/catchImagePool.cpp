@@ -0,0 +1,218 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Test the pool of temporary images.
+ */
+/*!
+  \example catchImagePool.cpp
+
+  \brief Test the pool of temporary images used by the image processing functions.
+*/
+
+#include <iostream>
+
+#include <visp3/core/vpConfig.h>
+#include <visp3/core/vpCannyEdgeDetection.h>
+#include <visp3/core/vpImageFilter.h>
+#include <visp3/core/vpImagePool.h>
+
+#ifdef ENABLE_VISP_NAMESPACE
+using namespace VISP_NAMESPACE_NAME;
+#endif
+
+#if defined(VISP_HAVE_CATCH2)
+
+#if defined(VISP_BUILD_CATCH2)
+#include <catch_amalgamated.hpp>
+#else // Since v3.1.1
+#include <catch2/catch_all.hpp>
+#endif
+
+namespace
+{
+vpImage<unsigned char> createImage(unsigned int h, unsigned int w)
+{
+  vpImage<unsigned char> I(h, w);
+  for (unsigned int i = 0; i < h; ++i) {
+    for (unsigned int j = 0; j < w; ++j) {
+      I[i][j] = ((i / 16 + j / 16) % 2) ? 200 : 50;
+    }
+  }
+  return I;
+}
+}
+
+TEST_CASE("Acquire and release images", "[vpImagePool]")
+{
+  vpImagePool pool;
+  vpImage<float> &I1 = pool.acquire<float>(10, 20);
+  vpImage<float> &I2 = pool.acquire<float>(10, 20);
+  CHECK(&I1 != &I2);
+  CHECK(pool.getNbImages() == 2);
+  CHECK(pool.getNbImagesInUse() == 2);
+  CHECK(pool.getNbAllocations() == 2);
+
+  pool.release(I1);
+  pool.release(I2);
+  CHECK(pool.getNbImagesInUse() == 0);
+
+  // Images of the requested size and type are reused
+  vpImage<float> &I3 = pool.acquire<float>(10, 20);
+  CHECK(((&I3 == &I1) || (&I3 == &I2)));
+  CHECK(pool.getNbAllocations() == 2);
+
+  // Other types get their own images
+  vpImage<unsigned char> &I4 = pool.acquire<unsigned char>(10, 20);
+  CHECK(pool.getNbImages() == 3);
+  CHECK(pool.getNbAllocations() == 3);
+  CHECK(pool.getNbAcquisitions() == 4);
+
+  vpImage<unsigned char> I_foreign;
+  CHECK_THROWS_AS(pool.release(I_foreign), vpException);
+  CHECK_THROWS_AS(pool.clear(), vpException);
+
+  pool.release(I3);
+  pool.release(I4);
+  pool.clear();
+  CHECK(pool.getNbImages() == 0);
+}
+
+TEST_CASE("Images of different sizes used in turn", "[vpImagePool]")
+{
+  vpImagePool pool;
+  for (unsigned int frame = 0; frame < 3; ++frame) {
+    vpImage<float> &I_big = pool.acquire<float>(120, 160);
+    pool.release(I_big);
+    // The free image of another size is not resized
+    vpImage<float> &I_row = pool.acquire<float>(1, 160);
+    CHECK(&I_row != &I_big);
+    CHECK(I_big.getHeight() == 120);
+    pool.release(I_row);
+  }
+  CHECK(pool.getNbImages() == 2);
+  CHECK(pool.getNbAllocations() == 2);
+  pool.clear();
+}
+
+TEST_CASE("Bounded number of images", "[vpImagePool]")
+{
+  vpImagePool pool;
+  CHECK(pool.getMaxNbImages() > 0);
+  pool.setMaxNbImages(4);
+  CHECK(pool.getMaxNbImages() == 4);
+
+  // Images of ever changing sizes do not make the pool grow
+  for (unsigned int frame = 0; frame < 20; ++frame) {
+    vpImage<float> &I = pool.acquire<float>(10 + frame, 20);
+    pool.release(I);
+    CHECK(pool.getNbImages() <= 4);
+  }
+  CHECK(pool.getNbAllocations() == 20);
+
+  // The least recently used free image is released first, not the oldest one
+  vpImage<float> &I_recent = pool.acquire<float>(26, 20);
+  CHECK(pool.getNbAllocations() == 20);
+  pool.release(I_recent);
+  vpImage<float> &I_new = pool.acquire<float>(5, 5);
+  pool.release(I_new);
+  vpImage<float> &I_kept = pool.acquire<float>(26, 20);
+  CHECK(&I_kept == &I_recent);
+  CHECK(pool.getNbAllocations() == 21);
+  vpImage<float> &I_evicted = pool.acquire<float>(27, 20);
+  CHECK(pool.getNbAllocations() == 22);
+  pool.release(I_evicted);
+
+  // Images in use are kept even when the maximum is reached
+  std::vector<vpImage<unsigned char> *> images;
+  for (unsigned int i = 0; i < 6; ++i) {
+    images.push_back(&pool.acquire<unsigned char>(10, 20));
+  }
+  CHECK(pool.getNbImages() == 7);
+  for (size_t i = 0; i < images.size(); ++i) {
+    pool.release(*images[i]);
+  }
+  pool.release(I_kept);
+  pool.setMaxNbImages(2);
+  CHECK(pool.getNbImages() == 2);
+  pool.clear();
+}
+
+TEST_CASE("Temporary images of the image processing functions", "[vpImagePool]")
+{
+  const vpImage<unsigned char> I = createImage(120, 160);
+  vpCannyEdgeDetection canny(5, 1.f, 3, -1.f, -1.f, 0.6f, 0.8f);
+
+  vpImage<float> I_blur_ref;
+  vpImageFilter::gaussianBlur(I, I_blur_ref, 5, 1.f);
+  vpImage<unsigned char> I_edges_ref = canny.detect(I);
+
+  vpImagePool pool;
+  vpImagePool::setThreadPool(&pool);
+  CHECK(vpImagePool::getThreadPool() == &pool);
+
+  unsigned int nbAllocationsFirstFrame = 0;
+  for (unsigned int frame = 0; frame < 3; ++frame) {
+    pool.resetCounters();
+
+    vpImage<float> I_blur;
+    vpImageFilter::gaussianBlur(I, I_blur, 5, 1.f);
+    CHECK(I_blur == I_blur_ref);
+
+    vpImage<unsigned char> I_edges = canny.detect(I);
+    CHECK(I_edges == I_edges_ref);
+
+    CHECK(pool.getNbImagesInUse() == 0);
+    CHECK(pool.getNbAcquisitions() > 0);
+    if (frame == 0) {
+      nbAllocationsFirstFrame = pool.getNbAllocations();
+      CHECK(nbAllocationsFirstFrame > 0);
+    }
+    else {
+      // Steady state: the temporary images are all reused
+      CHECK(pool.getNbAllocations() == 0);
+    }
+  }
+
+  vpImagePool::setThreadPool(nullptr);
+  CHECK(vpImagePool::getThreadPool() == nullptr);
+}
+
+int main(int argc, char *argv[])
+{
+  Catch::Session session;
+  session.applyCommandLine(argc, argv);
+  int numFailed = session.run();
+  std::cout << (numFailed ? "Test failed" : "Test succeed") << std::endl;
+  return numFailed;
+}
+
+#else
+int main() { return EXIT_SUCCESS; }
+#endif
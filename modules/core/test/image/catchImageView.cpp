@@ -0,0 +1,313 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Test vpImage strided storage, aligned rows and views.
+ */
+/*!
+  \example catchImageView.cpp
+
+  \brief Test vpImage strided storage, aligned rows and views.
+*/
+
+#include <iostream>
+#include <vector>
+
+#include <visp3/core/vpConfig.h>
+#include <visp3/core/vpGaussianFilter.h>
+#include <visp3/core/vpHistogram.h>
+#include <visp3/core/vpImage.h>
+#include <visp3/core/vpImageConvert.h>
+#include <visp3/core/vpImageFilter.h>
+#include <visp3/core/vpImageTools.h>
+
+#ifdef ENABLE_VISP_NAMESPACE
+using namespace VISP_NAMESPACE_NAME;
+#endif
+
+#if defined(VISP_HAVE_CATCH2)
+
+#if defined(VISP_BUILD_CATCH2)
+#include <catch_amalgamated.hpp>
+#else // Since v3.1.1
+#include <catch2/catch_all.hpp>
+#endif
+
+namespace
+{
+vpImage<unsigned char> createImage(unsigned int h, unsigned int w)
+{
+  vpImage<unsigned char> I(h, w);
+  for (unsigned int i = 0; i < h; ++i) {
+    for (unsigned int j = 0; j < w; ++j) {
+      I[i][j] = static_cast<unsigned char>((i * w + j) % 256);
+    }
+  }
+  return I;
+}
+}
+
+TEST_CASE("Wrap a buffer with padded rows", "[vpImage][stride]")
+{
+  const unsigned int h = 4, w = 5, stride = 8;
+  std::vector<unsigned char> buffer(h * stride, 255);
+  for (unsigned int i = 0; i < h; ++i) {
+    for (unsigned int j = 0; j < w; ++j) {
+      buffer[i * stride + j] = static_cast<unsigned char>(i * w + j);
+    }
+  }
+
+  SECTION("Without copy")
+  {
+    vpImage<unsigned char> I(buffer.data(), h, w, stride, false);
+    CHECK(I.getStride() == stride);
+    CHECK_FALSE(I.isContiguous());
+    CHECK(I == createImage(h, w));
+    CHECK(I.getMaxValue() == h * w - 1);
+    CHECK(I.getSum() == Catch::Approx(createImage(h, w).getSum()));
+
+    I[2][3] = 100;
+    CHECK(buffer[2 * stride + 3] == 100);
+    I = 0;
+    CHECK(buffer[stride - 1] == 255);
+  }
+
+  SECTION("With copy")
+  {
+    vpImage<unsigned char> I(buffer.data(), h, w, stride, true);
+    CHECK(I.isContiguous());
+    CHECK(I == createImage(h, w));
+    I[2][3] = 100;
+    CHECK(buffer[2 * stride + 3] == 2 * w + 3);
+  }
+
+  SECTION("Invalid stride")
+  {
+    vpImage<unsigned char> I;
+    CHECK_THROWS_AS(I.init(buffer.data(), h, w, w - 1, false), vpException);
+  }
+}
+
+TEST_CASE("Aligned rows", "[vpImage][stride]")
+{
+  const unsigned int alignment = 64;
+  vpImage<vpRGBa> I;
+  I.initAligned(7, 13, alignment);
+  CHECK(I.getHeight() == 7);
+  CHECK(I.getWidth() == 13);
+  CHECK(I.getStride() == 16);
+  for (unsigned int i = 0; i < I.getHeight(); ++i) {
+    CHECK(reinterpret_cast<size_t>(I[i]) % alignment == 0);
+  }
+
+  I = vpRGBa(10, 20, 30, 40);
+  vpImage<vpRGBa> I_copy = I;
+  CHECK(I_copy.isContiguous());
+  CHECK(I_copy == I);
+
+  CHECK_THROWS_AS(I.initAligned(2, 2, 24), vpException);
+}
+
+TEST_CASE("Region of interest view", "[vpImage][view]")
+{
+  vpImage<unsigned char> I = createImage(20, 30);
+  vpImage<unsigned char> I_view;
+  vpImage<unsigned char>::view(I_view, I, 5, 7, 10, 12);
+
+  CHECK(I_view.getHeight() == 10);
+  CHECK(I_view.getWidth() == 12);
+  CHECK(I_view.getStride() == I.getWidth());
+  CHECK_FALSE(I_view.isContiguous());
+
+  SECTION("Same pixels as crop")
+  {
+    vpImage<unsigned char> I_crop;
+    vpImageTools::crop(I, vpRect(7, 5, 12, 10), I_crop);
+    CHECK(I_view == I_crop);
+
+    vpImage<unsigned char> I_view_rect;
+    vpImage<unsigned char>::view(I_view_rect, I, vpRect(7, 5, 12, 10));
+    CHECK(I_view_rect == I_crop);
+
+    CHECK(I_view.getMinValue() == I_crop.getMinValue());
+    CHECK(I_view.getMaxValue() == I_crop.getMaxValue());
+    CHECK(I_view.getMeanValue() == Catch::Approx(I_crop.getMeanValue()));
+    CHECK(I_view.getStdev() == Catch::Approx(I_crop.getStdev()));
+  }
+
+  SECTION("Write through the view")
+  {
+    I_view = 0;
+    CHECK(I[5][7] == 0);
+    CHECK(I[14][18] == 0);
+    CHECK(I[4][7] == createImage(20, 30)[4][7]);
+    CHECK(I[5][19] == createImage(20, 30)[5][19]);
+    CHECK(I[15][18] == createImage(20, 30)[15][18]);
+
+    // Same size copy keeps the link with the viewed image
+    vpImage<unsigned char> I_ones(10, 12, 1);
+    I_view = I_ones;
+    CHECK(I[10][10] == 1);
+  }
+
+  SECTION("Copy of a view is contiguous")
+  {
+    vpImage<unsigned char> I_copy(I_view);
+    CHECK(I_copy.isContiguous());
+    CHECK(I_copy == I_view);
+    I_copy[0][0] = 255;
+    CHECK(I[5][7] != 255);
+  }
+
+  SECTION("Lookup table on a view")
+  {
+    unsigned char lut[256];
+    for (unsigned int i = 0; i < 256; ++i) {
+      lut[i] = static_cast<unsigned char>(255 - i);
+    }
+    I_view.performLut(lut, 4);
+    CHECK(I[5][7] == 255 - createImage(20, 30)[5][7]);
+    CHECK(I[5][6] == createImage(20, 30)[5][6]);
+  }
+
+  SECTION("Region of interest outside the image")
+  {
+    vpImage<unsigned char> I_bad_view;
+    CHECK_THROWS_AS(vpImage<unsigned char>::view(I_bad_view, I, 15, 7, 10, 12), vpException);
+  }
+}
+
+TEST_CASE("Statistics of a view", "[vpImage][view]")
+{
+  vpImage<float> I(20, 30);
+  for (unsigned int i = 0; i < I.getHeight(); ++i) {
+    for (unsigned int j = 0; j < I.getWidth(); ++j) {
+      I[i][j] = static_cast<float>(i) - static_cast<float>(j);
+    }
+  }
+  vpImage<float> I_view;
+  vpImage<float>::view(I_view, I, 5, 7, 10, 12);
+  vpImage<float> I_crop;
+  vpImageTools::crop(I, vpRect(7, 5, 12, 10), I_crop);
+
+  float min_view, max_view, min_crop, max_crop;
+  I_view.getMinMaxValue(min_view, max_view);
+  I_crop.getMinMaxValue(min_crop, max_crop);
+  CHECK(min_view == min_crop);
+  CHECK(max_view == max_crop);
+  CHECK(min_view == 5.f - 18.f);
+  CHECK(max_view == 14.f - 7.f);
+  CHECK(I_view.getSum() == Catch::Approx(I_crop.getSum()));
+
+  vpImage<bool> mask(10, 12, false);
+  mask[3][4] = true;
+  mask[9][11] = true;
+  unsigned int nbValidPoints = 0;
+  CHECK(I_view.getMeanValue(&mask, &nbValidPoints) == Catch::Approx(I_crop.getMeanValue(&mask)));
+  CHECK(nbValidPoints == 2);
+}
+
+TEST_CASE("Image processing on a view", "[vpImage][view]")
+{
+  vpImage<unsigned char> I = createImage(20, 30);
+  vpImage<unsigned char> I_view;
+  vpImage<unsigned char>::view(I_view, I, 5, 7, 10, 12);
+  vpImage<unsigned char> I_crop;
+  vpImageTools::crop(I, vpRect(7, 5, 12, 10), I_crop);
+
+  SECTION("Crop a padded bitmap")
+  {
+    vpImage<unsigned char> I_crop_bitmap;
+    vpImageTools::crop(I_view.bitmap, I_view.getWidth(), I_view.getHeight(), I_view.getStride(), vpRect(2, 1, 6, 4),
+                       I_crop_bitmap);
+    vpImage<unsigned char> I_crop_view;
+    vpImageTools::crop(I_view, vpRect(2, 1, 6, 4), I_crop_view);
+    CHECK(I_crop_bitmap == I_crop_view);
+    CHECK_THROWS_AS(vpImageTools::crop(I_view.bitmap, I_view.getWidth(), I_view.getHeight(), I_view.getWidth() - 1,
+                                       vpRect(2, 1, 6, 4), I_crop_bitmap), vpException);
+  }
+
+  SECTION("Canny threshold")
+  {
+    float lower_view = 0.f, lower_crop = 0.f;
+    float upper_view = vpImageFilter::computeCannyThreshold<float>(I_view, lower_view);
+    float upper_crop = vpImageFilter::computeCannyThreshold<float>(I_crop, lower_crop);
+    CHECK(upper_view == upper_crop);
+    CHECK(lower_view == lower_crop);
+
+    vpImage<bool> mask_view;
+    vpImage<bool> mask(20, 30, true);
+    vpImage<bool>::view(mask_view, mask, 5, 7, 10, 12);
+    CHECK_THROWS_AS(vpImageFilter::computeCannyThreshold<float>(I_crop, lower_crop, nullptr, nullptr, 5, 2.f, 3, 0.6f,
+                                                                0.8f, vpImageFilter::CANNY_GBLUR_SOBEL_FILTERING,
+                                                                &mask_view), vpException);
+  }
+
+#if defined(VISP_HAVE_SIMDLIB)
+  SECTION("Gaussian filter")
+  {
+    vpGaussianFilter filter(I_view.getWidth(), I_view.getHeight(), 1.5f);
+    vpImage<unsigned char> I_blur_view, I_blur_crop;
+    filter.apply(I_view, I_blur_view);
+    filter.apply(I_crop, I_blur_crop);
+    CHECK(I_blur_view == I_blur_crop);
+  }
+#endif
+
+  SECTION("Linear bitmap consumers reject views")
+  {
+    vpImage<float> I_float;
+    CHECK_THROWS_AS(vpImageConvert::convert(I_view, I_float), vpException);
+    vpImage<unsigned char> I_dest(10, 12);
+    vpImage<unsigned char> I_dest_view;
+    vpImage<unsigned char>::view(I_dest_view, I, 0, 0, 10, 12);
+    vpImage<vpRGBa> I_rgba(10, 12);
+    CHECK_THROWS_AS(vpImageConvert::convert(I_rgba, I_dest_view), vpException);
+    // The viewed image is left untouched
+    CHECK(I == createImage(20, 30));
+
+    vpHistogram histogram;
+    CHECK_THROWS_AS(histogram.calculate(I_view), vpException);
+    histogram.calculate(I_crop);
+    CHECK(histogram.getTotal() == I_crop.getSize());
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  Catch::Session session;
+  session.applyCommandLine(argc, argv);
+  int numFailed = session.run();
+  std::cout << (numFailed ? "Test failed" : "Test succeed") << std::endl;
+  return numFailed;
+}
+
+#else
+int main() { return EXIT_SUCCESS; }
+#endif
@@ -0,0 +1,136 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ * Description:
+ * Benchmark the Canny edge detector.
+ */
+
+/*!
+  \example perfCannyEdgeDetection.cpp
+ */
+
+#include <visp3/core/vpConfig.h>
+
+#if defined(VISP_HAVE_CATCH2)
+
+#if defined(VISP_BUILD_CATCH2)
+#include <catch_amalgamated.hpp>
+#else // Since v3.1.1
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+#include <visp3/core/vpCannyEdgeDetection.h>
+#include <visp3/core/vpUniRand.h>
+
+#ifdef ENABLE_VISP_NAMESPACE
+using namespace VISP_NAMESPACE_NAME;
+#endif
+
+namespace
+{
+bool g_runBenchmark = false;
+int g_nbThread = -1;
+
+// Smooth pattern with noise, that gives a lot of weak edges
+vpImage<unsigned char> generateImage(unsigned int height, unsigned int width)
+{
+  vpUniRand rng(42);
+  vpImage<unsigned char> I(height, width);
+  for (unsigned int i = 0; i < height; ++i) {
+    for (unsigned int j = 0; j < width; ++j) {
+      double val = 128. + (60. * std::sin(i * 0.05) * std::cos(j * 0.03)) + (40. * std::sin((i + j) * 0.2))
+        + rng.uniform(-30., 30.);
+      I[i][j] = static_cast<unsigned char>(std::max<double>(0., std::min<double>(255., val)));
+    }
+  }
+  return I;
+}
+} // namespace
+
+TEST_CASE("Benchmark vpCannyEdgeDetection", "[benchmark]")
+{
+  if (g_runBenchmark) {
+    const std::vector<std::pair<unsigned int, unsigned int> > sizes = { {480, 640}, {1080, 1920}, {2160, 3840} };
+
+    for (auto sz : sizes) {
+      const vpImage<unsigned char> I = generateImage(sz.first, sz.second);
+      vpCannyEdgeDetection detector(5, 1.f, 3, -1.f, -1.f, 0.6f, 0.8f, vpImageFilter::CANNY_GBLUR_SOBEL_FILTERING,
+                                    false, g_nbThread);
+
+      std::ostringstream oss;
+      oss << sz.second << "x" << sz.first << " - detect(), nbThread=" << g_nbThread;
+      BENCHMARK(oss.str().c_str())
+      {
+        return detector.detect(I);
+      };
+
+      oss.str("");
+      oss << sz.second << "x" << sz.first << " - detect() with edge-points list, nbThread=" << g_nbThread;
+      detector.setStoreEdgePoints(true);
+      BENCHMARK(oss.str().c_str())
+      {
+        return detector.detect(I);
+      };
+    }
+  }
+  else {
+    // Only check that the detector runs on a 4K frame
+    const vpImage<unsigned char> I = generateImage(2160, 3840);
+    vpCannyEdgeDetection detector(5, 1.f, 3, -1.f, -1.f, 0.6f, 0.8f, vpImageFilter::CANNY_GBLUR_SOBEL_FILTERING,
+                                  false, g_nbThread);
+    vpImage<unsigned char> E = detector.detect(I);
+    REQUIRE(E.getHeight() == I.getHeight());
+    REQUIRE(E.getWidth() == I.getWidth());
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  Catch::Session session;
+  auto cli = session.cli()
+    | Catch::Clara::Opt(g_runBenchmark)["--benchmark"]("run benchmark?")
+    | Catch::Clara::Opt(g_nbThread, "nbThread")["--nbThread"]("Number of threads, -1 to use all the available threads");
+
+  session.cli(cli);
+  session.applyCommandLine(argc, argv);
+
+  int numFailed = session.run();
+
+  return numFailed;
+}
+#else
+#include <iostream>
+
+int main() { return EXIT_SUCCESS; }
+#endif
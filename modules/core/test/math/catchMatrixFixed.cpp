@@ -0,0 +1,220 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Test vpMatrixFixed and the transformations that rely on it.
+ */
+
+/*!
+  \example catchMatrixFixed.cpp
+
+  Test vpMatrixFixed and the transformations that rely on it.
+ */
+#include <visp3/core/vpConfig.h>
+
+#if defined(VISP_HAVE_CATCH2)
+#include <visp3/core/vpExponentialMap.h>
+#include <visp3/core/vpHomogeneousMatrix.h>
+#include <visp3/core/vpMatrixFixed.h>
+#include <visp3/core/vpUniRand.h>
+#include <visp3/core/vpVelocityTwistMatrix.h>
+
+#if defined(VISP_BUILD_CATCH2)
+#include <catch_amalgamated.hpp>
+#else // Since v3.1.1
+#include <catch2/catch_all.hpp>
+#endif
+
+#ifdef ENABLE_VISP_NAMESPACE
+using namespace VISP_NAMESPACE_NAME;
+#endif
+
+namespace
+{
+bool equal(const vpArray2D<double> &A, const vpArray2D<double> &B, double epsilon = 1e-12)
+{
+  if ((A.getRows() != B.getRows()) || (A.getCols() != B.getCols())) {
+    return false;
+  }
+  for (unsigned int i = 0; i < A.size(); ++i) {
+    if (!vpMath::equal(A.data[i], B.data[i], epsilon)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+vpMatrix randomMatrix(unsigned int rows, unsigned int cols, vpUniRand &rng)
+{
+  vpMatrix M(rows, cols);
+  for (unsigned int i = 0; i < M.size(); ++i) {
+    M.data[i] = rng.uniform(-1., 1.);
+  }
+  return M;
+}
+
+vpHomogeneousMatrix randomPose(vpUniRand &rng)
+{
+  return vpHomogeneousMatrix(rng.uniform(-1., 1.), rng.uniform(-1., 1.), rng.uniform(-1., 1.), rng.uniform(-M_PI, M_PI),
+                             rng.uniform(-M_PI, M_PI), rng.uniform(-M_PI, M_PI));
+}
+}
+
+TEST_CASE("vpMatrixFixed arithmetic", "[vpMatrixFixed]")
+{
+  vpUniRand rng(42);
+  vpMatrix A = randomMatrix(6, 4, rng);
+  vpMatrix B = randomMatrix(4, 3, rng);
+  vpMatrix v = randomMatrix(6, 1, rng);
+
+  vpMatrixFixed<6, 4> A_fixed(A);
+  vpMatrixFixed<4, 3> B_fixed(B);
+  vpMatrixFixed<6, 1> v_fixed(v);
+
+  CHECK(equal((A_fixed * B_fixed).toMatrix(), A * B));
+  CHECK(equal(A_fixed.t().toMatrix(), A.t()));
+  CHECK(equal((A_fixed.t() * v_fixed).toMatrix(), A.t() * v));
+  CHECK(equal((A_fixed + A_fixed).toMatrix(), 2. * A));
+  CHECK(equal((A_fixed - A_fixed).toMatrix(), vpMatrix(6, 4, 0.)));
+  CHECK(equal((0.5 * A_fixed).toMatrix(), A * 0.5));
+
+  vpMatrix A_copy;
+  A_fixed.copyTo(A_copy);
+  CHECK(A_copy == A);
+
+  CHECK_THROWS_AS(([&A]() { vpMatrixFixed<3, 3> M(A); })(), vpException);
+}
+
+TEST_CASE("vpMatrixFixed inverse", "[vpMatrixFixed]")
+{
+  vpUniRand rng(42);
+  vpMatrix H = randomMatrix(6, 6, rng);
+  vpMatrix I;
+  I.eye(6);
+  H = H.AtA() + I;
+  vpMatrixFixed<6, 6> H_fixed(H);
+
+  CHECK(equal(H_fixed.inverse().toMatrix(), H.inverseByLU(), 1e-10));
+  CHECK(equal((H_fixed * H_fixed.inverse()).toMatrix(), I, 1e-10));
+
+  vpMatrixFixed<3, 3> S;
+  S[0][0] = 1.;
+  S[1][1] = 1.;
+  CHECK_THROWS_AS(S.inverse(), vpException);
+  CHECK_THROWS_AS((vpMatrixFixed<3, 3>()).inverse(), vpException);
+
+  // The singularity test is relative to the scale of the matrix
+  vpMatrixFixed<6, 6> H_small = 1e-20 * H_fixed;
+  CHECK(equal((H_small * H_small.inverse()).toMatrix(), I, 1e-10));
+  vpMatrixFixed<3, 3> S_big = 1e6 * S;
+  S_big[2][2] = 1e-12;
+  CHECK_THROWS_AS(S_big.inverse(), vpException);
+}
+
+TEST_CASE("Rigid transformations", "[vpMatrixFixed][vpHomogeneousMatrix]")
+{
+  vpUniRand rng(42);
+  for (unsigned int trial = 0; trial < 10; ++trial) {
+    vpHomogeneousMatrix aMb = randomPose(rng);
+    vpHomogeneousMatrix bMc = randomPose(rng);
+
+    SECTION("Composition")
+    {
+      vpMatrix aMc = static_cast<vpMatrix>(aMb) * static_cast<vpMatrix>(bMc);
+      CHECK(equal(aMb * bMc, aMc));
+
+      vpHomogeneousMatrix M = aMb;
+      M *= bMc;
+      CHECK(equal(M, aMc));
+
+      CHECK(equal(vpMatrixFixed<4, 4>(aMb).composeRigid(vpMatrixFixed<4, 4>(bMc)).toMatrix(), aMc));
+    }
+
+    SECTION("Inverse")
+    {
+      vpMatrix bMa = static_cast<vpMatrix>(aMb).inverseByLU();
+      CHECK(equal(aMb.inverse(), bMa, 1e-10));
+
+      vpHomogeneousMatrix M;
+      aMb.inverse(M);
+      CHECK(equal(M, bMa, 1e-10));
+      CHECK(equal(vpMatrixFixed<4, 4>(aMb).inverse().toMatrix(), bMa, 1e-10));
+    }
+
+    SECTION("Velocity twist")
+    {
+      vpVelocityTwistMatrix aVb(aMb), bVc(bMc);
+      vpMatrix aVc = static_cast<vpMatrix>(aVb) * static_cast<vpMatrix>(bVc);
+      CHECK(equal(aVb * bVc, aVc));
+      CHECK(equal(aVb * bVc, vpVelocityTwistMatrix(aMb * bMc), 1e-10));
+
+      vpColVector v(6);
+      for (unsigned int i = 0; i < 6; ++i) {
+        v[i] = rng.uniform(-1., 1.);
+      }
+      CHECK(equal(aVb * v, static_cast<vpMatrix>(aVb) * v));
+    }
+  }
+}
+
+TEST_CASE("Exponential map", "[vpMatrixFixed][vpExponentialMap]")
+{
+  vpUniRand rng(42);
+  for (unsigned int trial = 0; trial < 10; ++trial) {
+    vpColVector v(6);
+    for (unsigned int i = 0; i < 6; ++i) {
+      v[i] = rng.uniform(-1., 1.);
+    }
+    const double delta_t = 0.04;
+
+    vpHomogeneousMatrix M = vpExponentialMap::direct(v, delta_t);
+    CHECK(equal(vpExponentialMap::direct(vpMatrixFixed<6, 1>(v), delta_t).toMatrix(), M));
+
+    vpThetaUVector tu(v[3] * delta_t, v[4] * delta_t, v[5] * delta_t);
+    CHECK(equal(M.getRotationMatrix(), vpRotationMatrix(tu)));
+    CHECK(equal(vpExponentialMap::inverse(M, delta_t), v, 1e-10));
+  }
+
+  vpColVector v_zero(6, 0.);
+  CHECK(equal(vpExponentialMap::direct(v_zero), vpHomogeneousMatrix()));
+  CHECK_THROWS_AS(vpExponentialMap::direct(vpColVector(3)), vpException);
+}
+
+int main(int argc, char *argv[])
+{
+  Catch::Session session;
+  session.applyCommandLine(argc, argv);
+  int numFailed = session.run();
+  return numFailed;
+}
+#else
+#include <iostream>
+
+int main() { return EXIT_SUCCESS; }
+#endif
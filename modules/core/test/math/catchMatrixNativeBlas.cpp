@@ -0,0 +1,186 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Test the built-in Blas kernels used for matrix products.
+ */
+
+/*!
+  \example catchMatrixNativeBlas.cpp
+  \brief Test the built-in Blas kernels used for matrix-matrix and matrix-vector products.
+*/
+
+#include <visp3/core/vpConfig.h>
+
+#if defined(VISP_HAVE_CATCH2)
+#include <visp3/core/vpMatrix.h>
+#include <visp3/core/vpUniRand.h>
+#include <visp3/core/vpVelocityTwistMatrix.h>
+
+#if defined(VISP_BUILD_CATCH2)
+#include <catch_amalgamated.hpp>
+#else // Since v3.1.1
+#include <catch2/catch_all.hpp>
+#endif
+
+#ifdef ENABLE_VISP_NAMESPACE
+using namespace VISP_NAMESPACE_NAME;
+#endif
+
+namespace
+{
+vpMatrix generateRandomMatrix(vpUniRand &rng, unsigned int rows, unsigned int cols)
+{
+  vpMatrix M(rows, cols);
+  for (unsigned int i = 0; i < M.getRows(); ++i) {
+    for (unsigned int j = 0; j < M.getCols(); ++j) {
+      M[i][j] = rng.uniform(-1., 1.);
+    }
+  }
+  return M;
+}
+
+vpColVector generateRandomVector(vpUniRand &rng, unsigned int rows)
+{
+  vpColVector v(rows);
+  for (unsigned int i = 0; i < v.getRows(); ++i) {
+    v[i] = rng.uniform(-1., 1.);
+  }
+  return v;
+}
+
+vpMatrix dgemm_regular(const vpMatrix &A, const vpMatrix &B)
+{
+  vpMatrix C(A.getRows(), B.getCols(), 0.);
+  for (unsigned int i = 0; i < A.getRows(); ++i) {
+    for (unsigned int k = 0; k < A.getCols(); ++k) {
+      double a_ik = A[i][k];
+      for (unsigned int j = 0; j < B.getCols(); ++j) {
+        C[i][j] += a_ik * B[k][j];
+      }
+    }
+  }
+  return C;
+}
+
+vpColVector dgemv_regular(const vpMatrix &A, const vpColVector &v)
+{
+  vpColVector w(A.getRows(), 0.);
+  for (unsigned int i = 0; i < A.getRows(); ++i) {
+    for (unsigned int j = 0; j < A.getCols(); ++j) {
+      w[i] += A[i][j] * v[j];
+    }
+  }
+  return w;
+}
+
+bool equalMatrix(const vpMatrix &A, const vpMatrix &B, double tol = 1e-9)
+{
+  if ((A.getRows() != B.getRows()) || (A.getCols() != B.getCols())) {
+    return false;
+  }
+  for (unsigned int i = 0; i < A.getRows(); ++i) {
+    for (unsigned int j = 0; j < A.getCols(); ++j) {
+      if (!vpMath::equal(A[i][j], B[i][j], tol)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+} // namespace
+
+TEST_CASE("Built-in Blas kernels", "[matrix]")
+{
+  const bool useNativeBlas = vpMatrix::getUseNativeBlas();
+  const int nativeBlasNbThread = vpMatrix::getNativeBlasNbThread();
+  const unsigned int lapackMinSize = vpMatrix::getLapackMatrixMinSize();
+  vpMatrix::setLapackMatrixMinSize(0);
+  vpMatrix::setUseNativeBlas(true);
+  CHECK(vpMatrix::getUseNativeBlas());
+
+  vpUniRand rng(4321);
+  const int nbThreads[] = { 1, 4 };
+  for (auto nbThread : nbThreads) {
+    vpMatrix::setNativeBlasNbThread(nbThread);
+    CHECK(vpMatrix::getNativeBlasNbThread() >= 1);
+
+    {
+      // Sizes that do not fit the register and cache blocks
+      vpMatrix A = generateRandomMatrix(rng, 131, 301);
+      vpMatrix B = generateRandomMatrix(rng, 301, 67);
+      vpColVector v = generateRandomVector(rng, 301);
+      CHECK(equalMatrix(A * B, dgemm_regular(A, B)));
+      CHECK(equalMatrix(A.AtA(), dgemm_regular(A.t(), A)));
+      CHECK(equalMatrix(A.AAt(), dgemm_regular(A, A.t())));
+      CHECK(equalMatrix(static_cast<vpMatrix>(A * v), static_cast<vpMatrix>(dgemv_regular(A, v))));
+    }
+
+    {
+      // Sizes of the products done by the trackers
+      vpMatrix L = generateRandomMatrix(rng, 2503, 6);
+      vpMatrix Lt = L.t();
+      vpColVector e = generateRandomVector(rng, 2503);
+      vpVelocityTwistMatrix V(vpTranslationVector(0.1, -0.2, 0.3), vpThetaUVector(0.2, 0.1, -0.3));
+      CHECK(equalMatrix(Lt * L, dgemm_regular(Lt, L)));
+      CHECK(equalMatrix(L.AtA(), dgemm_regular(Lt, L)));
+      CHECK(equalMatrix(L * V, dgemm_regular(L, static_cast<vpMatrix>(V))));
+      CHECK(equalMatrix(static_cast<vpMatrix>(Lt * e), static_cast<vpMatrix>(dgemv_regular(Lt, e))));
+    }
+
+    {
+      // Degenerated sizes
+      vpMatrix A = generateRandomMatrix(rng, 1, 7);
+      vpMatrix B = generateRandomMatrix(rng, 7, 1);
+      CHECK(equalMatrix(A * B, dgemm_regular(A, B)));
+      CHECK(equalMatrix(B * A, dgemm_regular(B, A)));
+    }
+  }
+
+  vpMatrix::setUseNativeBlas(useNativeBlas);
+  vpMatrix::setNativeBlasNbThread(nativeBlasNbThread);
+  vpMatrix::setLapackMatrixMinSize(lapackMinSize);
+}
+
+int main(int argc, char *argv[])
+{
+  Catch::Session session;
+  session.applyCommandLine(argc, argv);
+  int numFailed = session.run();
+  return numFailed;
+}
+#else
+#include <iostream>
+
+int main()
+{
+  std::cout << "Test ignored: Catch2 is not available" << std::endl;
+  return EXIT_SUCCESS;
+}
+#endif
@@ -0,0 +1,184 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Test the M-estimator of vpRobust.
+ */
+
+/*!
+  \example catchRobust.cpp
+
+  Test the M-estimator of vpRobust against a reference implementation based on a full sort.
+ */
+#include <visp3/core/vpConfig.h>
+
+#if defined(VISP_HAVE_CATCH2)
+#include <algorithm>
+#include <vector>
+
+#include <visp3/core/vpRobust.h>
+#include <visp3/core/vpUniRand.h>
+
+#if defined(VISP_BUILD_CATCH2)
+#include <catch_amalgamated.hpp>
+#else // Since v3.1.1
+#include <catch2/catch_all.hpp>
+#endif
+
+#ifdef ENABLE_VISP_NAMESPACE
+using namespace VISP_NAMESPACE_NAME;
+#endif
+
+namespace
+{
+double sortedSelect(std::vector<double> v, size_t k)
+{
+  std::sort(v.begin(), v.end());
+  return v[k];
+}
+
+// Reference MAD computed with a full sort
+double referenceMAD(const vpColVector &residues, double mad_min)
+{
+  size_t n = residues.size();
+  size_t ind_med = static_cast<size_t>(std::ceil(n / 2.0)) - 1;
+  std::vector<double> r(residues.data, residues.data + n);
+  double med = sortedSelect(r, ind_med);
+  for (size_t i = 0; i < n; ++i) {
+    r[i] = std::fabs(r[i] - med);
+  }
+  return std::max<double>(1.4826 * sortedSelect(r, ind_med), mad_min);
+}
+
+// Gaussian noise with 20% of outliers
+vpColVector generateResidues(unsigned int n)
+{
+  vpUniRand rng(42);
+  vpColVector residues(n);
+  for (unsigned int i = 0; i < n; ++i) {
+    double u1 = rng.uniform(1e-9, 1.), u2 = rng.uniform(0., 1.);
+    residues[i] = 0.5 + 0.1 * std::sqrt(-2. * std::log(u1)) * std::cos(2. * M_PI * u2);
+    if (rng.uniform(0., 1.) < 0.2) {
+      residues[i] += rng.uniform(-50., 50.);
+    }
+  }
+  return residues;
+}
+}
+
+TEST_CASE("Exact MAD", "[vpRobust]")
+{
+  const unsigned int sizes[] = { 1, 2, 3, 10, 101, 10000 };
+  for (auto n : sizes) {
+    vpColVector residues = generateResidues(n);
+    vpColVector weights;
+    vpRobust robust;
+    robust.setMinMedianAbsoluteDeviation(1e-6);
+    robust.MEstimator(vpRobust::TUKEY, residues, weights);
+    CHECK(robust.getMedianAbsoluteDeviation() == referenceMAD(residues, 1e-6));
+    CHECK(weights.size() == n);
+  }
+}
+
+TEST_CASE("Influence functions", "[vpRobust]")
+{
+  vpColVector residues = generateResidues(1000);
+  vpRobust robust;
+  vpColVector weights;
+  const vpRobust::vpRobustEstimatorType methods[] = { vpRobust::TUKEY, vpRobust::CAUCHY, vpRobust::HUBER };
+
+  for (auto method : methods) {
+    robust.MEstimator(method, residues, weights);
+    double sigma = robust.getMedianAbsoluteDeviation();
+    std::vector<double> r(residues.data, residues.data + residues.size());
+    double med = sortedSelect(r, static_cast<size_t>(std::ceil(r.size() / 2.0)) - 1);
+
+    for (unsigned int i = 0; i < residues.size(); ++i) {
+      double x = std::fabs(residues[i] - med);
+      double w = 0.;
+      if (method == vpRobust::TUKEY) {
+        double C = 4.6851 * sigma;
+        w = (x > C) ? 0. : vpMath::sqr(1. - vpMath::sqr(x / C));
+      }
+      else if (method == vpRobust::CAUCHY) {
+        w = 1. / (1. + vpMath::sqr(x / (2.3849 * sigma)));
+      }
+      else {
+        double C = 1.2107 * sigma;
+        w = (x > C) ? C / x : 1.;
+      }
+      CHECK(weights[i] == Catch::Approx(w).margin(1e-12));
+    }
+  }
+}
+
+TEST_CASE("Approximated MAD", "[vpRobust]")
+{
+  vpColVector residues = generateResidues(200000);
+  vpRobust robust_exact, robust_approx;
+  robust_approx.setMedianApproximationThreshold(100000);
+  CHECK(robust_approx.getMedianApproximationThreshold() == 100000);
+
+  vpColVector weights_exact, weights_approx;
+  robust_exact.MEstimator(vpRobust::TUKEY, residues, weights_exact);
+  robust_approx.MEstimator(vpRobust::TUKEY, residues, weights_approx);
+
+  double mad = robust_exact.getMedianAbsoluteDeviation();
+  CHECK(robust_approx.getMedianAbsoluteDeviation() == Catch::Approx(mad).epsilon(1e-3));
+  double max_error = 0.;
+  for (unsigned int i = 0; i < residues.size(); ++i) {
+    max_error = std::max<double>(max_error, std::fabs(weights_approx[i] - weights_exact[i]));
+  }
+  CHECK(max_error < 1e-2);
+
+  // Constant residues
+  vpColVector constant(200000, 2.);
+  robust_approx.MEstimator(vpRobust::TUKEY, constant, weights_approx);
+  CHECK(robust_approx.getMedianAbsoluteDeviation() == robust_approx.getMinMedianAbsoluteDeviation());
+  CHECK(weights_approx.sum() == Catch::Approx(200000.));
+
+  // Below the threshold the exact path is used
+  vpColVector few_residues = generateResidues(1000);
+  robust_approx.MEstimator(vpRobust::TUKEY, few_residues, weights_approx);
+  robust_exact.MEstimator(vpRobust::TUKEY, few_residues, weights_exact);
+  CHECK(robust_approx.getMedianAbsoluteDeviation() == robust_exact.getMedianAbsoluteDeviation());
+}
+
+int main(int argc, char *argv[])
+{
+  Catch::Session session;
+  session.applyCommandLine(argc, argv);
+  int numFailed = session.run();
+  return numFailed;
+}
+#else
+#include <iostream>
+
+int main() { return EXIT_SUCCESS; }
+#endif
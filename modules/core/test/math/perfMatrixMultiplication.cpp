@@ -1009,6 +1009,90 @@ TEST_CASE("Benchmark matrix-force twist multiplication", "[benchmark]")
   }
 }
 
+TEST_CASE("Benchmark built-in Blas kernels", "[benchmark]")
+{
+  const bool useNativeBlas = vpMatrix::getUseNativeBlas();
+  const int nativeBlasNbThread = vpMatrix::getNativeBlasNbThread();
+
+  if (runBenchmark || runBenchmarkAll) {
+    // Sizes of the products done by the model-based tracker: interaction matrices are N x 6
+    std::vector<unsigned int> sizes = { 500, 1000, 2000, 4000 };
+
+    for (auto N : sizes) {
+      vpMatrix L = generateRandomMatrix(N, 6);
+      vpMatrix Lt = L.t();
+      vpMatrix H = generateRandomMatrix(6, 6);
+      vpColVector e = generateRandomVector(N);
+      vpMatrix LtL, LH;
+      vpColVector Lte;
+
+      std::ostringstream oss;
+      oss << "(6x" << N << ")x(" << N << "x6) - Naive code";
+      BENCHMARK(oss.str().c_str())
+      {
+        LtL = dgemm_regular(Lt, L);
+        return LtL;
+      };
+      oss.str("");
+      oss << "(" << N << "x6)x(6x6) - Naive code";
+      BENCHMARK(oss.str().c_str())
+      {
+        LH = dgemm_regular(L, H);
+        return LH;
+      };
+      oss.str("");
+      oss << "(6x" << N << ")x(" << N << ") - Naive code";
+      BENCHMARK(oss.str().c_str())
+      {
+        Lte = dgemv_regular(Lt, e);
+        return Lte;
+      };
+
+      std::vector<std::pair<std::string, int> > backends;
+#if defined(VISP_HAVE_LAPACK)
+      backends.push_back(std::make_pair(std::string("Blas/Lapack third party"), 0));
+#endif
+      backends.push_back(std::make_pair(std::string("built-in kernels"), 1));
+#if defined(VISP_HAVE_OPENMP)
+      backends.push_back(std::make_pair(std::string("built-in kernels multi-threaded"), -1));
+#endif
+      for (auto backend : backends) {
+        vpMatrix::setUseNativeBlas(backend.second != 0);
+        vpMatrix::setNativeBlasNbThread(backend.second);
+        vpMatrix LtL_backend, LH_backend;
+        vpColVector Lte_backend;
+
+        oss.str("");
+        oss << "(6x" << N << ")x(" << N << "x6) - " << backend.first;
+        BENCHMARK(oss.str().c_str())
+        {
+          LtL_backend = Lt * L;
+          return LtL_backend;
+        };
+        oss.str("");
+        oss << "(" << N << "x6)x(6x6) - " << backend.first;
+        BENCHMARK(oss.str().c_str())
+        {
+          LH_backend = L * H;
+          return LH_backend;
+        };
+        oss.str("");
+        oss << "(6x" << N << ")x(" << N << ") - " << backend.first;
+        BENCHMARK(oss.str().c_str())
+        {
+          Lte_backend = Lt * e;
+          return Lte_backend;
+        };
+        CHECK(equalMatrix(LtL_backend, LtL));
+        CHECK(equalMatrix(LH_backend, LH));
+        CHECK(equalMatrix(static_cast<vpMatrix>(Lte_backend), static_cast<vpMatrix>(Lte)));
+      }
+      vpMatrix::setUseNativeBlas(useNativeBlas);
+      vpMatrix::setNativeBlasNbThread(nativeBlasNbThread);
+    }
+  }
+}
+
 int main(int argc, char *argv[])
 {
   // Set random seed explicitly to avoid confusion
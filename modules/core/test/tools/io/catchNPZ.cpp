@@ -52,6 +52,7 @@
 #include <complex>
 #include <visp3/core/vpIoTools.h>
 #include <visp3/core/vpImage.h>
+#include <visp3/core/vpMatrix.h>
 
 #ifdef ENABLE_VISP_NAMESPACE
 using namespace VISP_NAMESPACE_NAME;
@@ -425,6 +426,201 @@ TEMPLATE_LIST_TEST_CASE("Test visp::cnpy::npy_load/npz_save", "[BasicTypes][list
   REQUIRE(vpIoTools::remove(directory_filename));
   REQUIRE(!vpIoTools::checkDirectory(directory_filename));
 }
+TEST_CASE("Test visp::cnpy::npy_mmap/npz_mmap", "[visp::cnpy I/O]")
+{
+  std::string directory_filename = createTmpDir();
+  REQUIRE(vpIoTools::checkDirectory(directory_filename));
+  std::string npz_filename = directory_filename + "/test_npz_mmap.npz";
+
+  vpImage<float> I_depth(240, 320);
+  for (unsigned int i = 0; i < I_depth.getSize(); i++) {
+    I_depth.bitmap[i] = 0.001f * i;
+  }
+  vpImage<vpRGBa> I_color(31, 17);
+  for (unsigned int i = 0; i < I_color.getSize(); i++) {
+    I_color.bitmap[i] = vpRGBa(i % 256, (3 * i) % 256, (7 * i) % 256, 255);
+  }
+  vpMatrix M(7, 5);
+  for (unsigned int i = 0; i < M.size(); i++) {
+    M.data[i] = 0.5 * i - 3;
+  }
+  // Odd name lengths, to check that the data are aligned whatever the size of the headers
+  visp::cnpy::npz_save(npz_filename, "a", &M.data[0], { M.getRows(), M.getCols() }, "w");
+  visp::cnpy::npz_save(npz_filename, "depth", &I_depth.bitmap[0], { I_depth.getRows(), I_depth.getCols() }, "a");
+  visp::cnpy::npz_save(npz_filename, "color_image", &I_color.bitmap[0], { I_color.getRows(), I_color.getCols() }, "a");
+  visp::cnpy::npz_save(npz_filename, "depth_compressed", &I_depth.bitmap[0], { I_depth.getRows(), I_depth.getCols() },
+                       "a", true);
+
+  SECTION("Mapped npz arrays")
+  {
+    visp::cnpy::npz_t npz_data = visp::cnpy::npz_mmap(npz_filename);
+    REQUIRE(npz_data.size() == 4);
+    CHECK(npz_data["a"].is_mapped());
+    CHECK(npz_data["depth"].is_mapped());
+    CHECK(npz_data["color_image"].is_mapped());
+    CHECK(!npz_data["depth_compressed"].is_mapped());
+    CHECK(reinterpret_cast<uintptr_t>(npz_data["depth"].data<float>()) % 64 == 0);
+
+    vpImage<float> I_depth_view, I_depth_inflated;
+    visp::cnpy::npy_view(npz_data["depth"], I_depth_view);
+    CHECK(I_depth_view.bitmap == npz_data["depth"].data<float>());
+    CHECK(I_depth_view == I_depth);
+    visp::cnpy::npy_view(npz_data["depth_compressed"], I_depth_inflated);
+    CHECK(I_depth_inflated == I_depth);
+
+    vpImage<vpRGBa> I_color_view;
+    visp::cnpy::npy_view(npz_data["color_image"], I_color_view);
+    CHECK(I_color_view == I_color);
+
+    vpMatrix M_view;
+    visp::cnpy::npy_view(npz_data["a"], M_view);
+    CHECK(M_view.data == npz_data["a"].data<double>());
+    CHECK(M_view == M);
+
+    vpImage<unsigned char> I_wrong_type;
+    CHECK_THROWS_AS(visp::cnpy::npy_view(npz_data["depth"], I_wrong_type), vpException);
+    CHECK_THROWS_AS(visp::cnpy::npy_view(npz_data["depth"], M_view), vpException);
+
+    // The mapping is copy-on-write
+    I_depth_view[0][0] = -1.f;
+    CHECK(visp::cnpy::npz_load(npz_filename, "depth").data<float>()[0] == I_depth[0][0]);
+
+    // The mapping outlives the map of arrays
+    visp::cnpy::NpyArray arr_depth = visp::cnpy::npz_mmap(npz_filename, "depth");
+    npz_data.clear();
+    CHECK(arr_depth.is_mapped());
+    CHECK(arr_depth.data<float>()[arr_depth.num_vals - 1] == I_depth.bitmap[I_depth.getSize() - 1]);
+  }
+
+  SECTION("Same arrays as npz_load")
+  {
+    visp::cnpy::npz_t npz_data = visp::cnpy::npz_load(npz_filename);
+    visp::cnpy::npz_t npz_data_mapped = visp::cnpy::npz_mmap(npz_filename);
+    REQUIRE(npz_data.size() == npz_data_mapped.size());
+    for (visp::cnpy::npz_t::iterator it = npz_data.begin(); it != npz_data.end(); ++it) {
+      visp::cnpy::NpyArray &arr_mapped = npz_data_mapped[it->first];
+      CHECK(!it->second.is_mapped());
+      CHECK(it->second.shape == arr_mapped.shape);
+      REQUIRE(it->second.num_bytes() == arr_mapped.num_bytes());
+      CHECK(memcmp(it->second.data<char>(), arr_mapped.data<char>(), arr_mapped.num_bytes()) == 0);
+    }
+    CHECK_THROWS(visp::cnpy::npz_mmap(npz_filename, "missing"));
+  }
+
+  SECTION("Mapped npy array")
+  {
+    std::string npy_filename = directory_filename + "/test_npy_mmap.npy";
+    visp::cnpy::npy_save(npy_filename, &I_depth.bitmap[0], { I_depth.getRows(), I_depth.getCols() });
+    visp::cnpy::NpyArray arr_depth = visp::cnpy::npy_mmap(npy_filename);
+    CHECK(arr_depth.is_mapped());
+    vpImage<float> I_depth_view;
+    visp::cnpy::npy_view(arr_depth, I_depth_view);
+    CHECK(I_depth_view == I_depth);
+
+    visp::cnpy::NpyArray arr_depth_copy = visp::cnpy::npy_load(npy_filename);
+    CHECK(!arr_depth_copy.is_mapped());
+    CHECK(memcmp(arr_depth_copy.data<char>(), arr_depth.data<char>(), arr_depth.num_bytes()) == 0);
+  }
+
+  REQUIRE(vpIoTools::remove(directory_filename));
+  REQUIRE(!vpIoTools::checkDirectory(directory_filename));
+}
+
+TEST_CASE("Test visp::cnpy::NpzWriter", "[visp::cnpy I/O]")
+{
+  std::string directory_filename = createTmpDir();
+  REQUIRE(vpIoTools::checkDirectory(directory_filename));
+  std::string npz_filename = directory_filename + "/test_npz_writer.npz";
+
+  vpImage<float> I_depth(48, 64);
+  for (unsigned int i = 0; i < I_depth.getSize(); i++) {
+    I_depth.bitmap[i] = 0.25f * i;
+  }
+  const unsigned int nb_frames = 40;
+
+  const bool compress_data[] = { false, true };
+  const bool asynchronous[] = { false, true };
+  for (auto compress : compress_data) {
+    for (auto async : asynchronous) {
+      {
+        visp::cnpy::NpzWriter writer(npz_filename, compress, async);
+        writer.set_max_pending(2);
+        for (unsigned int frame = 0; frame < nb_frames; frame++) {
+          std::vector<double> pose(6, static_cast<double>(frame));
+          writer.add("pose_" + std::to_string(frame), pose);
+          I_depth[0][0] = static_cast<float>(frame);
+          writer.add("depth_" + std::to_string(frame), I_depth.bitmap, { I_depth.getRows(), I_depth.getCols() });
+        }
+        CHECK(writer.num_arrays() == 2 * nb_frames);
+        CHECK_THROWS_AS(writer.add("pose_0", std::vector<double>(6)), vpException);
+        writer.close();
+        CHECK(!writer.is_open());
+        CHECK_THROWS_AS(writer.add("pose_0", std::vector<double>(6)), vpException);
+      }
+
+      visp::cnpy::npz_t npz_data = visp::cnpy::npz_mmap(npz_filename);
+      REQUIRE(npz_data.size() == 2 * nb_frames);
+      for (unsigned int frame = 0; frame < nb_frames; frame++) {
+        std::vector<double> pose = npz_data["pose_" + std::to_string(frame)].as_vec<double>();
+        CHECK(pose == std::vector<double>(6, static_cast<double>(frame)));
+        visp::cnpy::NpyArray &arr_depth = npz_data["depth_" + std::to_string(frame)];
+        CHECK(arr_depth.is_mapped() == !compress);
+        vpImage<float> I_depth_read;
+        visp::cnpy::npy_view(arr_depth, I_depth_read);
+        I_depth[0][0] = static_cast<float>(frame);
+        CHECK(I_depth_read == I_depth);
+      }
+    }
+  }
+
+  SECTION("Append to an existing archive")
+  {
+    const std::vector<int> data_npz_save = { 1, 2, 3 };
+    visp::cnpy::npz_save(npz_filename, "npz_save", data_npz_save, "w");
+    {
+      visp::cnpy::NpzWriter writer(npz_filename, false, true, "a");
+      CHECK(writer.num_arrays() == 1);
+      CHECK_THROWS_AS(writer.add("npz_save", data_npz_save), vpException);
+      writer.add("writer", std::vector<float>(10, 2.f));
+    }
+    // The archive written by NpzWriter can be extended with npz_save
+    visp::cnpy::npz_save(npz_filename, "npz_save_2", data_npz_save, "a", true);
+
+    visp::cnpy::npz_t npz_data = visp::cnpy::npz_load(npz_filename);
+    REQUIRE(npz_data.size() == 3);
+    CHECK(npz_data["npz_save"].as_vec<int>() == data_npz_save);
+    CHECK(npz_data["writer"].as_vec<float>() == std::vector<float>(10, 2.f));
+    CHECK(npz_data["npz_save_2"].as_vec<int>() == data_npz_save);
+  }
+
+#if defined(__linux__)
+  SECTION("Write error")
+  {
+    // Writing to /dev/full always fails
+    for (auto async : asynchronous) {
+      visp::cnpy::NpzWriter writer("/dev/full", false, async);
+      const std::vector<size_t> shape = { I_depth.getRows(), I_depth.getCols() };
+      bool failed = false;
+      try {
+        writer.add("depth_0", I_depth.bitmap, shape);
+        writer.flush();
+      }
+      catch (const vpException &) {
+        failed = true;
+      }
+      CHECK(failed);
+      // The writer stays failed until the archive is closed
+      CHECK_THROWS_AS(writer.add("depth_1", I_depth.bitmap, shape), vpException);
+      CHECK_THROWS_AS(writer.flush(), vpException);
+      CHECK_THROWS_AS(writer.close(), vpException);
+      CHECK(!writer.is_open());
+    }
+  }
+#endif
+
+  REQUIRE(vpIoTools::remove(directory_filename));
+  REQUIRE(!vpIoTools::checkDirectory(directory_filename));
+}
 
 #if defined(VISP_HAVE_DATASET) && (VISP_HAVE_DATASET_VERSION >= 0x030703)
 namespace
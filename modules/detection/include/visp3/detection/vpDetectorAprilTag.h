@@ -42,6 +42,7 @@
 #include <visp3/core/vpColor.h>
 #include <visp3/core/vpHomogeneousMatrix.h>
 #include <visp3/core/vpImage.h>
+#include <visp3/core/vpRect.h>
 #include <visp3/detection/vpDetectorBase.h>
 
 #ifdef VISP_HAVE_NLOHMANN_JSON
@@ -85,11 +86,15 @@ BEGIN_VISP_NAMESPACE
  * using getPolygon(), the encoded message using getMessage(), the bounding box
  * using getBBox() and the center of gravity using getCog().
  *
+ * For high frame rate tag tracking, setAprilTagRoiTracking() enables a mode where the tags are only searched
+ * in regions of interest around their location predicted from the previous detections, the whole image
+ * being processed periodically to find new tags.
+ *
  * If camera parameters and the size of the tag are provided, you can also estimate
  * the 3D pose of the tag in terms of position and orientation wrt the camera considering 2 cases:
  * 1. If all the tags have the same size use
  *    detect(const vpImage<unsigned char> &, double, const vpCameraParameters &, std::vector<vpHomogeneousMatrix> &, std::vector<vpHomogeneousMatrix> *, std::vector<double> *, std::vector<double> *)
- * 2. If tag sizes differ, use rather getPose()
+ * 2. If tag sizes differ, use rather getPoses() that refines all the poses in parallel, or getPose() for a single tag
  *
  * \note With ViSP, the size of the tag corresponds to the black part of the tag. Note also that to be detected,
  * the black part of the tag must be surrounded by a white border as wide as the black border as in the next image:
@@ -453,8 +458,13 @@ public:
   }
 
   int getAprilTagHammingDistanceThreshold() const;
+  bool getAprilTagRoiTracking() const;
+  std::vector<vpRect> getAprilTagRois() const;
   bool getPose(size_t tagIndex, double tagSize, const vpCameraParameters &cam, vpHomogeneousMatrix &cMo,
                vpHomogeneousMatrix *cMo2 = nullptr, double *projError = nullptr, double *projError2 = nullptr);
+  bool getPoses(const std::map<int, double> &tagsSize, const vpCameraParameters &cam,
+                std::vector<vpHomogeneousMatrix> &cMo_vec, std::vector<vpHomogeneousMatrix> *cMo_vec2 = nullptr,
+                std::vector<double> *projErrors = nullptr, std::vector<double> *projErrors2 = nullptr);
 
   /*!
    * Return the pose estimation method.
@@ -483,6 +493,7 @@ public:
   void setAprilTagQuadDecimate(float quadDecimate);
   void setAprilTagQuadSigma(float quadSigma);
   void setAprilTagRefineEdges(bool refineEdges);
+  void setAprilTagRoiTracking(bool roiTracking, unsigned int fullFrameDetectionPeriod = 10, float roiMargin = 0.5f);
 
 
   /*! Allow to enable the display of overlay tag information in the windows
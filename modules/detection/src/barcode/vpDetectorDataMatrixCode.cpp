@@ -73,7 +73,14 @@ bool vpDetectorDataMatrixCode::detect(const vpImage<unsigned char> &I)
     dmtx_timeout->usec += m_timeout_ms * 1000;
   }
 
-  img = dmtxImageCreate(I.bitmap, static_cast<int>(I.getWidth()), static_cast<int>(I.getHeight()), DmtxPack8bppK);
+  // The image buffer is wrapped as is, views and padded images are copied into contiguous memory
+  const vpImage<unsigned char> *p_I = &I;
+  vpImage<unsigned char> I_contiguous;
+  if (!I.isContiguous()) {
+    I_contiguous = I;
+    p_I = &I_contiguous;
+  }
+  img = dmtxImageCreate(p_I->bitmap, static_cast<int>(I.getWidth()), static_cast<int>(I.getHeight()), DmtxPack8bppK);
   assert(img != nullptr);
 
   dec = dmtxDecodeCreate(img, 1);
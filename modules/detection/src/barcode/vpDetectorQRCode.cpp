@@ -64,8 +64,15 @@ bool vpDetectorQRCode::detect(const vpImage<unsigned char> &I)
   unsigned int width = I.getWidth();
   unsigned int height = I.getHeight();
 
+  // The image buffer is wrapped as is, views and padded images are copied into contiguous memory
+  const vpImage<unsigned char> *p_I = &I;
+  vpImage<unsigned char> I_contiguous;
+  if (!I.isContiguous()) {
+    I_contiguous = I;
+    p_I = &I_contiguous;
+  }
   // wrap image data
-  zbar::Image img(width, height, "Y800", I.bitmap, (unsigned long)(width * height));
+  zbar::Image img(width, height, "Y800", p_I->bitmap, (unsigned long)(width * height));
 
   // scan the image for barcodes
   m_nb_objects = static_cast<size_t>(m_scanner.scan(img));
@@ -33,6 +33,8 @@
 #include <visp3/core/vpConfig.h>
 
 #ifdef VISP_HAVE_APRILTAG
+#include <cmath>
+#include <limits>
 #include <map>
 
 #ifdef __cplusplus
@@ -340,8 +342,10 @@ class vpDetectorAprilTag::Impl
 public:
   Impl(const vpAprilTagFamily &tagFamily, const vpPoseEstimationMethod &method)
     : m_poseEstimationMethod(method), m_tagsId(), m_tagFamily(tagFamily), m_tagsDecisionMargin(),
-    m_tagsHammingDistance(), m_td(nullptr), m_tf(nullptr),
-    m_detections(nullptr), m_decisionMarginThreshold(-1), m_hammingDistanceThreshold(2), m_zAlignedWithCameraFrame(false)
+    m_tagsHammingDistance(), m_keptDetections(), m_td(nullptr), m_tf(nullptr),
+    m_detections(nullptr), m_decisionMarginThreshold(-1), m_hammingDistanceThreshold(2), m_zAlignedWithCameraFrame(false),
+    m_roiTracking(false), m_roiFullFrameDetectionPeriod(10), m_roiMargin(0.5f), m_roiNbFramesSinceFullFrameDetection(0),
+    m_roiFullFrameDetectionRequired(true), m_trackedTags(), m_rois()
   {
     switch (m_tagFamily) {
     case TAG_36h10:
@@ -483,9 +487,12 @@ public:
 
   Impl(const Impl &o)
     : m_poseEstimationMethod(o.m_poseEstimationMethod), m_tagsId(o.m_tagsId), m_tagFamily(o.m_tagFamily),
-    m_tagsDecisionMargin(o.m_tagsDecisionMargin), m_tagsHammingDistance(o.m_tagsHammingDistance), m_td(nullptr),
-    m_tf(nullptr), m_detections(nullptr), m_decisionMarginThreshold(o.m_decisionMarginThreshold),
-    m_hammingDistanceThreshold(o.m_hammingDistanceThreshold), m_zAlignedWithCameraFrame(o.m_zAlignedWithCameraFrame)
+    m_tagsDecisionMargin(o.m_tagsDecisionMargin), m_tagsHammingDistance(o.m_tagsHammingDistance),
+    m_keptDetections(o.m_keptDetections), m_td(nullptr), m_tf(nullptr), m_detections(nullptr), m_decisionMarginThreshold(o.m_decisionMarginThreshold),
+    m_hammingDistanceThreshold(o.m_hammingDistanceThreshold), m_zAlignedWithCameraFrame(o.m_zAlignedWithCameraFrame),
+    m_roiTracking(o.m_roiTracking), m_roiFullFrameDetectionPeriod(o.m_roiFullFrameDetectionPeriod),
+    m_roiMargin(o.m_roiMargin), m_roiNbFramesSinceFullFrameDetection(o.m_roiNbFramesSinceFullFrameDetection),
+    m_roiFullFrameDetectionRequired(o.m_roiFullFrameDetectionRequired), m_trackedTags(o.m_trackedTags), m_rois(o.m_rois)
   {
     switch (m_tagFamily) {
     case TAG_36h10:
@@ -793,26 +800,41 @@ public:
 
     const bool computePose = (cMo_vec != nullptr);
 
-    image_u8_t im = {/*.width =*/static_cast<int32_t>(I.getWidth()),
-      /*.height =*/static_cast<int32_t>(I.getHeight()),
-      /*.stride =*/static_cast<int32_t>(I.getWidth()),
-      /*.buf =*/I.bitmap };
-
     if (m_detections) {
       apriltag_detections_destroy(m_detections);
       m_detections = nullptr;
     }
 
-    m_detections = apriltag_detector_detect(m_td, &im);
+    const bool roiDetection = m_roiTracking && (!m_roiFullFrameDetectionRequired) && (!m_trackedTags.empty()) &&
+      ((m_roiFullFrameDetectionPeriod == 0) || ((m_roiNbFramesSinceFullFrameDetection + 1) < m_roiFullFrameDetectionPeriod));
+    m_rois.clear();
+    if (roiDetection) {
+      computeRois(I.getHeight(), I.getWidth());
+      m_detections = detectInRois(I);
+      ++m_roiNbFramesSinceFullFrameDetection;
+    }
+    else {
+      // The image buffer is used as is by AprilTag, without any copy. AprilTag supports padded rows, so that the
+      // image may be a view
+      image_u8_t im = {/*.width =*/static_cast<int32_t>(I.getWidth()),
+        /*.height =*/static_cast<int32_t>(I.getHeight()),
+        /*.stride =*/static_cast<int32_t>(I.getStride()),
+        /*.buf =*/I.bitmap };
+
+      m_detections = apriltag_detector_detect(m_td, &im);
+      m_roiNbFramesSinceFullFrameDetection = 0;
+    }
     int nb_detections = zarray_size(m_detections);
     bool detected = nb_detections > 0;
 
     polygons.clear(); messages.clear(); m_tagsId.clear(); m_tagsDecisionMargin.clear(); m_tagsHammingDistance.clear();
+    m_keptDetections.clear();
     polygons.reserve(static_cast<size_t>(nb_detections));
     messages.reserve(static_cast<size_t>(nb_detections));
     m_tagsId.reserve(static_cast<size_t>(nb_detections));
     m_tagsDecisionMargin.reserve(static_cast<size_t>(nb_detections));
     m_tagsHammingDistance.reserve(static_cast<size_t>(nb_detections));
+    m_keptDetections.reserve(static_cast<size_t>(nb_detections));
 
     int zarray_size_m_detections = zarray_size(m_detections);
     for (int i = 0; i < zarray_size_m_detections; ++i) {
@@ -840,6 +862,7 @@ public:
       m_tagsId.push_back(det->id);
       m_tagsDecisionMargin.push_back(det->decision_margin);
       m_tagsHammingDistance.push_back(det->hamming);
+      m_keptDetections.push_back(i);
 
       if (displayTag) {
         vpColor Ox = (color == vpColor::none) ? vpColor::red : color;
@@ -857,28 +880,184 @@ public:
         vpDisplay::displayLine(I, static_cast<int>(det->p[polyId2][1]), static_cast<int>(det->p[polyId2][0]),
             static_cast<int>(det->p[polyId3][1]), static_cast<int>(det->p[polyId3][0]), Oy2, thickness);
       }
+    }
+
+    if (computePose) {
+      // The tags are refined as a batch, in parallel
+      getPoses(std::vector<double>(m_keptDetections.size(), tagSize), cam, *cMo_vec, cMo_vec2, projErrors, projErrors2);
+    }
+
+    if (m_roiTracking) {
+      updateTrackedTags(polygons, roiDetection);
+    }
+
+    return detected;
+  }
+
+  /*!
+   * Compute the regions of interest where the tags are searched, from the corners of the tracked tags
+   * predicted with a constant velocity model. Overlapping regions are merged so that a tag cannot be detected twice.
+   */
+  void computeRois(unsigned int height, unsigned int width)
+  {
+    const unsigned int nbCorners = 4;
+    std::vector<vpRect> rois;
+    rois.reserve(m_trackedTags.size());
+    size_t nbTrackedTags = m_trackedTags.size();
+    for (size_t i = 0; i < nbTrackedTags; ++i) {
+      const vpTrackedTag &tag = m_trackedTags[i];
+      double u_min = std::numeric_limits<double>::max(), v_min = std::numeric_limits<double>::max();
+      double u_max = -std::numeric_limits<double>::max(), v_max = -std::numeric_limits<double>::max();
+      double displacement = 0.;
+      for (unsigned int j = 0; j < nbCorners; ++j) {
+        vpImagePoint corner = tag.m_corners[j] + tag.m_velocity[j];
+        u_min = std::min<double>(u_min, corner.get_u());
+        u_max = std::max<double>(u_max, corner.get_u());
+        v_min = std::min<double>(v_min, corner.get_v());
+        v_max = std::max<double>(v_max, corner.get_v());
+        displacement = std::max<double>(displacement, std::max<double>(std::fabs(tag.m_velocity[j].get_u()),
+                                                                       std::fabs(tag.m_velocity[j].get_v())));
+      }
+      // The tag white border has to be in the region, whatever the margin
+      const double minMargin = 0.25;
+      double margin = (std::max<double>(m_roiMargin, minMargin) * std::max<double>(u_max - u_min, v_max - v_min)) +
+        displacement;
+      u_min = std::max<double>(0., std::floor(u_min - margin));
+      v_min = std::max<double>(0., std::floor(v_min - margin));
+      u_max = std::min<double>(width, std::ceil(u_max + margin));
+      v_max = std::min<double>(height, std::ceil(v_max + margin));
+      if ((u_max > u_min) && (v_max > v_min)) {
+        rois.push_back(vpRect(u_min, v_min, u_max - u_min, v_max - v_min));
+      }
+    }
 
-      if (computePose) {
-        vpHomogeneousMatrix cMo, cMo2;
-        double err1, err2;
-        if (getPose(static_cast<size_t>(i), tagSize, cam, cMo, cMo_vec2 ? &cMo2 : nullptr, projErrors ? &err1 : nullptr,
-                    projErrors2 ? &err2 : nullptr)) {
-          cMo_vec->push_back(cMo);
-          if (cMo_vec2) {
-            cMo_vec2->push_back(cMo2);
+    // Merge the overlapping regions
+    bool merged = true;
+    while (merged) {
+      merged = false;
+      for (size_t i = 0; (i < rois.size()) && (!merged); ++i) {
+        for (size_t j = i + 1; (j < rois.size()) && (!merged); ++j) {
+          const vpRect &a = rois[i], &b = rois[j];
+          double left = std::min<double>(a.getLeft(), b.getLeft());
+          double top = std::min<double>(a.getTop(), b.getTop());
+          double right = std::max<double>(a.getLeft() + a.getWidth(), b.getLeft() + b.getWidth());
+          double bottom = std::max<double>(a.getTop() + a.getHeight(), b.getTop() + b.getHeight());
+          bool intersect = ((right - left) <= (a.getWidth() + b.getWidth())) &&
+            ((bottom - top) <= (a.getHeight() + b.getHeight()));
+          if (intersect) {
+            rois[i] = vpRect(left, top, right - left, bottom - top);
+            rois.erase(rois.begin() + static_cast<std::ptrdiff_t>(j));
+            merged = true;
           }
-          if (projErrors) {
-            projErrors->push_back(err1);
+        }
+      }
+    }
+    m_rois = rois;
+  }
+
+  /*!
+   * Run the AprilTag detector on each region of interest. The regions are views on the image buffer, and the
+   * detections are expressed in the full image.
+   */
+  zarray_t *detectInRois(const vpImage<unsigned char> &I)
+  {
+    zarray_t *detections = zarray_create(sizeof(apriltag_detection_t *));
+    size_t nbRois = m_rois.size();
+    for (size_t r = 0; r < nbRois; ++r) {
+      const int x0 = static_cast<int>(m_rois[r].getLeft());
+      const int y0 = static_cast<int>(m_rois[r].getTop());
+      image_u8_t im = {/*.width =*/static_cast<int32_t>(vpMath::round(m_rois[r].getWidth())),
+        /*.height =*/static_cast<int32_t>(vpMath::round(m_rois[r].getHeight())),
+        /*.stride =*/static_cast<int32_t>(I.getStride()),
+        /*.buf =*/I.bitmap + (static_cast<size_t>(y0) * I.getStride()) + static_cast<size_t>(x0) };
+
+      zarray_t *roiDetections = apriltag_detector_detect(m_td, &im);
+      int nbRoiDetections = zarray_size(roiDetections);
+      for (int i = 0; i < nbRoiDetections; ++i) {
+        apriltag_detection_t *det;
+        zarray_get(roiDetections, i, &det);
+        shiftDetection(det, x0, y0);
+        zarray_add(detections, &det);
+      }
+      // The detections are now owned by the returned array
+      zarray_destroy(roiDetections);
+    }
+    return detections;
+  }
+
+  /*!
+   * Express a detection obtained in a region of interest with top-left corner (x0, y0) in the full image.
+   */
+  static void shiftDetection(apriltag_detection_t *det, int x0, int y0)
+  {
+    const unsigned int nbCorners = 4;
+    for (unsigned int j = 0; j < nbCorners; ++j) {
+      det->p[j][0] += x0;
+      det->p[j][1] += y0;
+    }
+    det->c[0] += x0;
+    det->c[1] += y0;
+    // H maps the tag frame to the image: the translation is applied on the left
+    const int nbCols = 3;
+    for (int j = 0; j < nbCols; ++j) {
+      MATD_EL(det->H, 0, j) += x0 * MATD_EL(det->H, 2, j);
+      MATD_EL(det->H, 1, j) += y0 * MATD_EL(det->H, 2, j);
+    }
+  }
+
+  /*!
+   * Update the tracked tags with the tags kept after the detection. A tag that was tracked but is not found
+   * anymore in its region of interest triggers a full frame detection at the next call.
+   */
+  void updateTrackedTags(const std::vector<std::vector<vpImagePoint> > &polygons, bool roiDetection)
+  {
+    const unsigned int nbCorners = 4;
+    std::vector<vpTrackedTag> trackedTags(polygons.size());
+    std::vector<bool> matched(m_trackedTags.size(), false);
+    size_t nbPolygons = polygons.size();
+    for (size_t i = 0; i < nbPolygons; ++i) {
+      vpTrackedTag &tag = trackedTags[i];
+      tag.m_id = m_tagsId[i];
+      vpImagePoint cog;
+      for (unsigned int j = 0; j < nbCorners; ++j) {
+        tag.m_corners[j] = polygons[i][j];
+        tag.m_velocity[j] = vpImagePoint(0, 0);
+        cog += polygons[i][j] / nbCorners;
+      }
+
+      // The same id may be used by different tags: the previous tag with the closest center is used
+      double minDist = std::numeric_limits<double>::max();
+      size_t prevIndex = m_trackedTags.size();
+      size_t nbTrackedTags = m_trackedTags.size();
+      for (size_t k = 0; k < nbTrackedTags; ++k) {
+        if ((!matched[k]) && (m_trackedTags[k].m_id == tag.m_id)) {
+          vpImagePoint prevCog;
+          for (unsigned int j = 0; j < nbCorners; ++j) {
+            prevCog += m_trackedTags[k].m_corners[j] / nbCorners;
           }
-          if (projErrors2) {
-            projErrors2->push_back(err2);
+          double dist = vpImagePoint::sqrDistance(cog, prevCog);
+          if (dist < minDist) {
+            minDist = dist;
+            prevIndex = k;
           }
         }
-        // else case should never happen
+      }
+      if (prevIndex < m_trackedTags.size()) {
+        matched[prevIndex] = true;
+        for (unsigned int j = 0; j < nbCorners; ++j) {
+          tag.m_velocity[j] = tag.m_corners[j] - m_trackedTags[prevIndex].m_corners[j];
+        }
       }
     }
 
-    return detected;
+    // A lost tag requires a full frame detection, even when a new tag keeps the number of tags unchanged
+    bool tagLost = false;
+    size_t nbMatched = matched.size();
+    for (size_t k = 0; (k < nbMatched) && (!tagLost); ++k) {
+      tagLost = !matched[k];
+    }
+    m_roiFullFrameDetectionRequired = roiDetection && tagLost;
+    m_trackedTags = trackedTags;
   }
 
   void displayFrames(const vpImage<unsigned char> &I, const std::vector<vpHomogeneousMatrix> &cMo_vec,
@@ -1004,14 +1183,110 @@ public:
     }
 #endif
 
+    int nb_detections = zarray_size(m_detections);
+    if (tagIndex >= static_cast<size_t>(nb_detections)) {
+      return false;
+    }
+
     apriltag_detection_t *det;
     zarray_get(m_detections, static_cast<int>(tagIndex), &det);
 
-    int nb_detections = zarray_size(m_detections);
-    if (tagIndex >= static_cast<size_t>(nb_detections)) {
+    vpPose pose;
+    return computePose(det, tagSize, cam, pose, cMo, cMo2, projErrors, projErrors2);
+  }
+
+  /*!
+   * Compute the pose of the tags kept during the last detection. The poses are computed in parallel, using
+   * the number of threads of the AprilTag detector.
+   *
+   * \param[in] tagsSize : Size of each tag kept during the last detection.
+   * \param[in] cam : Camera intrinsic parameters.
+   * \param[out] cMo_vec : The poses are appended to this vector.
+   * \param[out] cMo_vec2 : If not null, the second solutions are appended to this vector.
+   * \param[out] projErrors : If not null, the projection errors are appended to this vector.
+   * \param[out] projErrors2 : If not null, the projection errors of the second solutions are appended to this vector.
+   * \return true if the poses are computed.
+   */
+  bool getPoses(const std::vector<double> &tagsSize, const vpCameraParameters &cam,
+                std::vector<vpHomogeneousMatrix> &cMo_vec, std::vector<vpHomogeneousMatrix> *cMo_vec2,
+                std::vector<double> *projErrors, std::vector<double> *projErrors2)
+  {
+    if (m_detections == nullptr) {
+      throw(vpException(vpException::fatalError, "Cannot get tags pose: detection empty"));
+    }
+    if (tagsSize.size() != m_keptDetections.size()) {
+      throw(vpException(vpException::dimensionError, "Cannot get tags pose: %d tag sizes for %d tags",
+                        static_cast<int>(tagsSize.size()), static_cast<int>(m_keptDetections.size())));
+    }
+#if !defined(VISP_HAVE_APRILTAG_BIG_FAMILY)
+    if ((m_tagFamily == TAG_CIRCLE49h12) || (m_tagFamily == TAG_CUSTOM48h12) || (m_tagFamily == TAG_STANDARD41h12) ||
+        (m_tagFamily == TAG_STANDARD52h13)) {
+      std::cerr << "TAG_CIRCLE49h12, TAG_CUSTOM48h12, TAG_STANDARD41h12 and TAG_STANDARD52h13 are disabled."
+        << std::endl;
       return false;
     }
+#endif
 
+    const int nbTags = static_cast<int>(m_keptDetections.size());
+    std::vector<vpHomogeneousMatrix> poses(static_cast<size_t>(nbTags));
+    std::vector<vpHomogeneousMatrix> poses2(cMo_vec2 ? static_cast<size_t>(nbTags) : 0);
+    std::vector<double> errors(projErrors ? static_cast<size_t>(nbTags) : 0);
+    std::vector<double> errors2(projErrors2 ? static_cast<size_t>(nbTags) : 0);
+    std::vector<unsigned char> computed(static_cast<size_t>(nbTags), 0);
+
+#ifdef VISP_HAVE_OPENMP
+    int nbThreads = std::max<int>(1, std::min<int>(m_td->nthreads, nbTags));
+#pragma omp parallel num_threads(nbThreads)
+#endif
+    {
+      // The points and matrices used by the pose estimation are reused from one tag to the next one
+      vpPose pose;
+#ifdef VISP_HAVE_OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+      for (int i = 0; i < nbTags; ++i) {
+        apriltag_detection_t *det;
+        zarray_get(m_detections, m_keptDetections[static_cast<size_t>(i)], &det);
+        const size_t idx = static_cast<size_t>(i);
+        computed[idx] = computePose(det, tagsSize[idx], cam, pose, poses[idx], cMo_vec2 ? &poses2[idx] : nullptr,
+                                    projErrors ? &errors[idx] : nullptr, projErrors2 ? &errors2[idx] : nullptr);
+      }
+    }
+
+    // Results are appended in the detection order, as with successive calls to getPose()
+    for (size_t i = 0; i < computed.size(); ++i) {
+      if (!computed[i]) {
+        continue; // should never happen
+      }
+      cMo_vec.push_back(poses[i]);
+      if (cMo_vec2) {
+        cMo_vec2->push_back(poses2[i]);
+      }
+      if (projErrors) {
+        projErrors->push_back(errors[i]);
+      }
+      if (projErrors2) {
+        projErrors2->push_back(errors2[i]);
+      }
+    }
+    return true;
+  }
+
+  /*!
+   * Compute the pose of a detected tag.
+   *
+   * \param[in] det : The detection.
+   * \param[in] tagSize : Tag size in meter.
+   * \param[in] cam : Camera intrinsic parameters.
+   * \param[in] pose : Pose estimator, whose points are replaced by the corners of the tag.
+   * \param[out] cMo : Pose of the tag.
+   * \param[out] cMo2 : Optional second solution.
+   * \param[out] projErrors : Optional projection error.
+   * \param[out] projErrors2 : Optional projection error of the second solution.
+   */
+  bool computePose(apriltag_detection_t *det, double tagSize, const vpCameraParameters &cam, vpPose &pose,
+                   vpHomogeneousMatrix &cMo, vpHomogeneousMatrix *cMo2, double *projErrors, double *projErrors2)
+  {
 #if defined(VISP_HAVE_APRILTAG_POSE_FCT)
     // In AprilTag3, estimate_pose_for_tag_homography() and estimate_tag_pose() have been added.
     // They use a tag frame aligned with the camera frame
@@ -1051,21 +1326,21 @@ public:
       info.cx = cx;
       info.cy = cy;
 
-      apriltag_pose_t pose;
+      apriltag_pose_t tagPose;
 
-      estimate_pose_for_tag_homography(&info, &pose);
-      convertHomogeneousMatrix(pose, cMo);
+      estimate_pose_for_tag_homography(&info, &tagPose);
+      convertHomogeneousMatrix(tagPose, cMo);
 
       // Since matd_destroy() symbol is not exported in libapriltag we are using my_matd_destroy()
-      my_matd_destroy(pose.R);
-      my_matd_destroy(pose.t);
+      my_matd_destroy(tagPose.R);
+      my_matd_destroy(tagPose.t);
 
       cMo_homography = cMo;
     }
 #endif
 
     // Add marker object points
-    vpPose pose;
+    pose.clearPoint();
     vpPoint pt;
 
     vpImagePoint imPt;
@@ -1142,7 +1417,8 @@ public:
         cMo = *(poses.begin() + minIndex);
       }
       else {
-        pose.computePose(m_mapOfCorrespondingPoseMethods[m_poseEstimationMethod], cMo);
+        // find() rather than operator[] since this method may be called concurrently
+        pose.computePose(m_mapOfCorrespondingPoseMethods.find(m_poseEstimationMethod)->second, cMo);
       }
     }
 
@@ -1396,19 +1672,56 @@ public:
     return m_zAlignedWithCameraFrame;
   }
 
+  bool getRoiTracking() const { return m_roiTracking; }
+
+  std::vector<vpRect> getRois() const { return m_rois; }
+
+  void getRoiTrackingParameters(unsigned int &fullFrameDetectionPeriod, float &roiMargin) const
+  {
+    fullFrameDetectionPeriod = m_roiFullFrameDetectionPeriod;
+    roiMargin = m_roiMargin;
+  }
+
+  void setRoiTracking(bool roiTracking, unsigned int fullFrameDetectionPeriod, float roiMargin)
+  {
+    m_roiTracking = roiTracking;
+    m_roiFullFrameDetectionPeriod = fullFrameDetectionPeriod;
+    m_roiMargin = roiMargin;
+    // Start again with a detection on the whole image
+    m_roiNbFramesSinceFullFrameDetection = 0;
+    m_roiFullFrameDetectionRequired = true;
+    m_trackedTags.clear();
+    m_rois.clear();
+  }
+
 protected:
+  struct vpTrackedTag
+  {
+    int m_id;                     //!< Tag id.
+    vpImagePoint m_corners[4];    //!< Corners of the tag in the last image.
+    vpImagePoint m_velocity[4];   //!< Displacement of the corners between the two last images.
+  };
+
   std::map<vpPoseEstimationMethod, vpPose::vpPoseMethodType> m_mapOfCorrespondingPoseMethods;
   vpPoseEstimationMethod m_poseEstimationMethod;
   std::vector<int> m_tagsId;
   vpAprilTagFamily m_tagFamily;
   std::vector<float> m_tagsDecisionMargin;
   std::vector<int> m_tagsHammingDistance;
+  std::vector<int> m_keptDetections; //!< Index in m_detections of the tags kept after the margin and hamming filtering.
   apriltag_detector_t *m_td;
   apriltag_family_t *m_tf;
   zarray_t *m_detections;
   float m_decisionMarginThreshold;
   int m_hammingDistanceThreshold;
   bool m_zAlignedWithCameraFrame;
+  bool m_roiTracking;
+  unsigned int m_roiFullFrameDetectionPeriod;
+  float m_roiMargin;
+  unsigned int m_roiNbFramesSinceFullFrameDetection;
+  bool m_roiFullFrameDetectionRequired;
+  std::vector<vpTrackedTag> m_trackedTags;
+  std::vector<vpRect> m_rois;
 };
 
 namespace
@@ -1903,6 +2216,81 @@ bool vpDetectorAprilTag::getPose(size_t tagIndex, double tagSize, const vpCamera
   return m_impl->getPose(tagIndex, tagSize, cam, cMo, cMo2, projError, projError2);
 }
 
+/*!
+  Get the pose of all the tags detected by the last call to detect(), each tag having its own size.
+  This function gives the same poses as successive calls to getPose(), but the poses are refined in parallel
+  using the number of threads set with setAprilTagNbThreads(), the pose estimation data being reused from one
+  tag to the next one.
+
+  \param[in] tagsSize : A map that contains as first element a tag id and as second element its size in meter.
+  When first element of this map is -1, the second element corresponds to the default tag size.
+  \param[in] cam : Camera intrinsic parameters.
+  \param[out] cMo_vec : List of tag poses, in the same order as getTagsId().
+  \param[out] cMo_vec2 : Optional second list of tag poses.
+  \note This second solution is only computed when the pose estimation method
+  is set to HOMOGRAPHY_ORTHOGONAL_ITERATION. For other methods, this vector
+  will contain identity matrices and projection errors `projErrors2` will be set to `HUGE_VAL`.
+  \param[out] projErrors : Optional (sum of squared) projection errors in the normalized camera frame.
+  \param[out] projErrors2 : Optional (sum of squared) projection errors for the 2nd solution in the normalized camera
+  frame.
+  \return true if success, false otherwise.
+
+  The following code shows how to use this function:
+  \code
+  vpCameraParameters cam;
+  vpDetectorAprilTag detector(vpDetectorAprilTag::TAG_36h11);
+  detector.setAprilTagNbThreads(4);
+  detector.detect(I);
+  std::map<int, double> tagsSize;
+  tagsSize[-1] = 0.05; // Default tag size in meter
+  tagsSize[10] = 0.1;  // All tags with id 10 are 0.1 meter large
+  std::vector<vpHomogeneousMatrix> cMo_vec;
+  detector.getPoses(tagsSize, cam, cMo_vec);
+  \endcode
+
+  \sa getPose(), getTagsPoints3D()
+ */
+bool vpDetectorAprilTag::getPoses(const std::map<int, double> &tagsSize, const vpCameraParameters &cam,
+                                  std::vector<vpHomogeneousMatrix> &cMo_vec,
+                                  std::vector<vpHomogeneousMatrix> *cMo_vec2, std::vector<double> *projErrors,
+                                  std::vector<double> *projErrors2)
+{
+  cMo_vec.clear();
+  if (cMo_vec2) {
+    cMo_vec2->clear();
+  }
+  if (projErrors) {
+    projErrors->clear();
+  }
+  if (projErrors2) {
+    projErrors2->clear();
+  }
+
+  double default_size = -1;
+  std::map<int, double>::const_iterator it = tagsSize.find(-1);
+  if (it != tagsSize.end()) {
+    default_size = it->second; // Default size
+  }
+
+  std::vector<int> tagsId = m_impl->getTagsId();
+  std::vector<double> sizes(tagsId.size(), default_size);
+  size_t tagsid_size = tagsId.size();
+  for (size_t i = 0; i < tagsid_size; ++i) {
+    it = tagsSize.find(tagsId[i]);
+    if (it == tagsSize.end()) {
+      if (default_size < 0) { // no default size found
+        throw(vpException(vpException::fatalError,
+                          "Tag with id %d has no 3D size or there is no default 3D size defined", tagsId[i]));
+      }
+    }
+    else {
+      sizes[i] = it->second;
+    }
+  }
+
+  return m_impl->getPoses(sizes, cam, cMo_vec, cMo_vec2, projErrors, projErrors2);
+}
+
 /*!
   Return a vector that contains for each tag id the corresponding tag 3D corners coordinates in the tag frame.
 
@@ -1997,6 +2385,21 @@ int vpDetectorAprilTag::getAprilTagHammingDistanceThreshold() const
   return m_impl->getAprilTagHammingDistanceThreshold();
 }
 
+/*!
+  Return true if the tags are tracked in regions of interest from one image to the next one.
+
+  \sa setAprilTagRoiTracking(), getAprilTagRois()
+*/
+bool vpDetectorAprilTag::getAprilTagRoiTracking() const { return m_impl->getRoiTracking(); }
+
+/*!
+  Return the regions of interest where the tags were searched during the last call to detect().
+  The list is empty when the whole image was processed.
+
+  \sa setAprilTagRoiTracking()
+*/
+std::vector<vpRect> vpDetectorAprilTag::getAprilTagRois() const { return m_impl->getRois(); }
+
 /*!
   Return the corners coordinates for the detected tags.
 
@@ -2168,6 +2571,10 @@ void vpDetectorAprilTag::setAprilTagFamily(const vpAprilTagFamily &tagFamily)
   bool refineEdges = true;
   m_impl->getRefineEdges(refineEdges);
   bool zAxis = m_impl->getZAlignedWithCameraAxis();
+  bool roiTracking = m_impl->getRoiTracking();
+  unsigned int fullFrameDetectionPeriod = 10;
+  float roiMargin = 0.5f;
+  m_impl->getRoiTrackingParameters(fullFrameDetectionPeriod, roiMargin);
 
   delete m_impl;
   m_tagFamily = tagFamily;
@@ -2178,6 +2585,7 @@ void vpDetectorAprilTag::setAprilTagFamily(const vpAprilTagFamily &tagFamily)
   m_impl->setQuadSigma(quadSigma);
   m_impl->setRefineEdges(refineEdges);
   m_impl->setZAlignedWithCameraAxis(zAxis);
+  m_impl->setRoiTracking(roiTracking, fullFrameDetectionPeriod, roiMargin);
 }
 
 /*!
@@ -2257,6 +2665,34 @@ void vpDetectorAprilTag::setAprilTagRefineDecode(bool refineDecode)
 */
 void vpDetectorAprilTag::setAprilTagRefineEdges(bool refineEdges) { m_impl->setRefineEdges(refineEdges); }
 
+/*!
+  Enable or disable the tracking of the tags in regions of interest.
+
+  When enabled, the location of the corners of each tag is predicted from its two last detections, considering a
+  constant velocity. The next call to detect() then only processes padded regions of interest around the predicted
+  locations instead of the whole image. The regions are views on the image buffer, no copy is done. Overlapping
+  regions are merged.
+
+  The whole image is processed at the first call, when no tag is tracked, when a tracked tag was not found in its
+  region of interest and periodically to detect the tags that appear in the image.
+  When the tags are sparse in the image, this reduces a lot the detection time.
+
+  The pose of the tags obtained with detect() or getPose() is computed as usual from the detected corners.
+
+  \param roiTracking : If true, enable the tracking in regions of interest. Calling this function resets the
+  tracked tags.
+  \param fullFrameDetectionPeriod : The whole image is processed once every \e fullFrameDetectionPeriod images. If 0,
+  the whole image is only processed when a tracked tag is lost.
+  \param roiMargin : Margin added around the predicted bounding box of a tag, as a ratio of the size of the bounding
+  box. The margin is at least 0.25 so that the white border of the tag is in the region of interest.
+
+  \sa getAprilTagRoiTracking(), getAprilTagRois()
+*/
+void vpDetectorAprilTag::setAprilTagRoiTracking(bool roiTracking, unsigned int fullFrameDetectionPeriod, float roiMargin)
+{
+  m_impl->setRoiTracking(roiTracking, fullFrameDetectionPeriod, roiMargin);
+}
+
 #if defined(VISP_BUILD_DEPRECATED_FUNCTIONS)
 /*!
   \deprecated Deprecated parameter from AprilTag 2 version.
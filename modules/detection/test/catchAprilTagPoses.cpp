@@ -0,0 +1,166 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ * Description:
+ * Test the batched pose estimation of AprilTag.
+ */
+/*!
+  \example catchAprilTagPoses.cpp
+
+  \brief Test that the poses of many tags refined in parallel by vpDetectorAprilTag are the same as the ones
+  computed tag by tag.
+*/
+
+#include <visp3/core/vpConfig.h>
+
+#if defined(VISP_HAVE_CATCH2) && defined(VISP_HAVE_APRILTAG)
+
+#if defined(VISP_BUILD_CATCH2)
+#include <catch_amalgamated.hpp>
+#else // Since v3.1.1
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <map>
+#include <visp3/core/vpImageTools.h>
+#include <visp3/detection/vpDetectorAprilTag.h>
+
+#ifdef ENABLE_VISP_NAMESPACE
+using namespace VISP_NAMESPACE_NAME;
+#endif
+
+namespace
+{
+// Draw a grid of tags of different sizes
+void drawScene(vpDetectorAprilTag &detector, vpImage<unsigned char> &I)
+{
+  I.resize(600, 800, 255);
+  const unsigned int nbRows = 5, nbCols = 6;
+  for (unsigned int i = 0; i < nbRows; ++i) {
+    for (unsigned int j = 0; j < nbCols; ++j) {
+      const int id = static_cast<int>(i * nbCols + j);
+      const unsigned int scale = 4 + (id % 3);
+      vpImage<unsigned char> tag_img;
+      detector.getTagImage(tag_img, id);
+      vpImage<unsigned char> tag_img_big(tag_img.getHeight() * scale, tag_img.getWidth() * scale);
+      vpImageTools::resize(tag_img, tag_img_big, vpImageTools::INTERPOLATION_NEAREST);
+      I.insert(tag_img_big, vpImagePoint(10 + i * 115, 10 + j * 130));
+    }
+  }
+}
+
+bool equal(const vpHomogeneousMatrix &M1, const vpHomogeneousMatrix &M2)
+{
+  for (unsigned int i = 0; i < M1.size(); ++i) {
+    if (M1.data[i] != M2.data[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+TEST_CASE("AprilTag batched poses", "[apriltag]")
+{
+  vpCameraParameters cam(600, 600, 400, 300);
+  const vpDetectorAprilTag::vpPoseEstimationMethod methods[] = {
+    vpDetectorAprilTag::HOMOGRAPHY, vpDetectorAprilTag::HOMOGRAPHY_VIRTUAL_VS,
+    vpDetectorAprilTag::DEMENTHON_VIRTUAL_VS, vpDetectorAprilTag::LAGRANGE_VIRTUAL_VS,
+    vpDetectorAprilTag::BEST_RESIDUAL_VIRTUAL_VS, vpDetectorAprilTag::HOMOGRAPHY_ORTHOGONAL_ITERATION };
+
+  for (auto method : methods) {
+    vpDetectorAprilTag detector(vpDetectorAprilTag::TAG_36h11, method);
+    vpImage<unsigned char> I;
+    drawScene(detector, I);
+
+    std::map<int, double> tagsSize;
+    tagsSize[-1] = 0.05;
+    tagsSize[3] = 0.08;
+    tagsSize[7] = 0.1;
+
+    const int nbThreads[] = { 1, 4 };
+    for (auto nbThread : nbThreads) {
+      detector.setAprilTagNbThreads(nbThread);
+
+      // Same tag size: detect() against getPose()
+      std::vector<vpHomogeneousMatrix> cMo_vec, cMo_vec2;
+      std::vector<double> projErrors, projErrors2;
+      detector.detect(I, 0.05, cam, cMo_vec, &cMo_vec2, &projErrors, &projErrors2);
+      REQUIRE(detector.getNbObjects() == 30);
+      REQUIRE(cMo_vec.size() == detector.getNbObjects());
+      REQUIRE(cMo_vec2.size() == detector.getNbObjects());
+      REQUIRE(projErrors.size() == detector.getNbObjects());
+      REQUIRE(projErrors2.size() == detector.getNbObjects());
+      for (size_t i = 0; i < detector.getNbObjects(); ++i) {
+        vpHomogeneousMatrix cMo, cMo2;
+        double projError = 0., projError2 = 0.;
+        REQUIRE(detector.getPose(i, 0.05, cam, cMo, &cMo2, &projError, &projError2));
+        CHECK(equal(cMo, cMo_vec[i]));
+        CHECK(equal(cMo2, cMo_vec2[i]));
+        CHECK(projError == projErrors[i]);
+        CHECK(projError2 == projErrors2[i]);
+      }
+
+      // Different tag sizes: getPoses() against getPose()
+      REQUIRE(detector.getPoses(tagsSize, cam, cMo_vec, &cMo_vec2, &projErrors, &projErrors2));
+      REQUIRE(cMo_vec.size() == detector.getNbObjects());
+      std::vector<int> tagsId = detector.getTagsId();
+      for (size_t i = 0; i < detector.getNbObjects(); ++i) {
+        const double tagSize = (tagsSize.find(tagsId[i]) != tagsSize.end()) ? tagsSize[tagsId[i]] : tagsSize[-1];
+        vpHomogeneousMatrix cMo, cMo2;
+        double projError = 0., projError2 = 0.;
+        REQUIRE(detector.getPose(i, tagSize, cam, cMo, &cMo2, &projError, &projError2));
+        CHECK(equal(cMo, cMo_vec[i]));
+        CHECK(equal(cMo2, cMo_vec2[i]));
+        CHECK(projError == projErrors[i]);
+        CHECK(projError2 == projErrors2[i]);
+      }
+    }
+
+    // A missing tag size is an error
+    std::map<int, double> missingSize;
+    missingSize[0] = 0.05;
+    std::vector<vpHomogeneousMatrix> cMo_vec;
+    CHECK_THROWS_AS(detector.getPoses(missingSize, cam, cMo_vec), vpException);
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  Catch::Session session;
+  session.applyCommandLine(argc, argv);
+  int numFailed = session.run();
+  return numFailed;
+}
+#else
+#include <iostream>
+
+int main() { return EXIT_SUCCESS; }
+#endif
@@ -0,0 +1,256 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ * Description:
+ * Test AprilTag detection in regions of interest.
+ */
+/*!
+  \example catchAprilTagRoiTracking.cpp
+
+  \brief Test that the tags tracked in regions of interest by vpDetectorAprilTag are detected as on the whole image.
+*/
+
+#include <visp3/core/vpConfig.h>
+
+#if defined(VISP_HAVE_CATCH2) && defined(VISP_HAVE_APRILTAG)
+
+#if defined(VISP_BUILD_CATCH2)
+#include <catch_amalgamated.hpp>
+#else // Since v3.1.1
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <map>
+#include <visp3/core/vpImageTools.h>
+#include <visp3/detection/vpDetectorAprilTag.h>
+
+#ifdef ENABLE_VISP_NAMESPACE
+using namespace VISP_NAMESPACE_NAME;
+#endif
+
+namespace
+{
+// Draw the tags with their top-left corner at the given locations, the tag ids are the location indexes by default
+void drawScene(vpDetectorAprilTag &detector, const std::vector<vpImagePoint> &locations, vpImage<unsigned char> &I,
+               const std::vector<int> &ids = std::vector<int>())
+{
+  const unsigned int scale = 8;
+  I.resize(480, 640, 255);
+  for (size_t id = 0; id < locations.size(); ++id) {
+    vpImage<unsigned char> tag_img;
+    detector.getTagImage(tag_img, ids.empty() ? static_cast<int>(id) : ids[id]);
+    vpImage<unsigned char> tag_img_big(tag_img.getHeight() * scale, tag_img.getWidth() * scale);
+    vpImageTools::resize(tag_img, tag_img_big, vpImageTools::INTERPOLATION_NEAREST);
+    I.insert(tag_img_big, locations[id]);
+  }
+}
+
+// Tag corners and poses sorted by tag id
+void detectTags(vpDetectorAprilTag &detector, const vpImage<unsigned char> &I, const vpCameraParameters &cam,
+                std::map<int, std::vector<vpImagePoint> > &corners, std::map<int, vpHomogeneousMatrix> &poses)
+{
+  std::vector<vpHomogeneousMatrix> cMo_vec;
+  detector.detect(I, 0.05, cam, cMo_vec);
+  REQUIRE(cMo_vec.size() == detector.getNbObjects());
+  std::vector<int> ids = detector.getTagsId();
+  corners.clear();
+  poses.clear();
+  for (size_t i = 0; i < detector.getNbObjects(); ++i) {
+    corners[ids[i]] = detector.getPolygon(i);
+    poses[ids[i]] = cMo_vec[i];
+  }
+}
+}
+
+TEST_CASE("AprilTag ROI tracking", "[apriltag]")
+{
+  vpCameraParameters cam(600, 600, 320, 240);
+  vpDetectorAprilTag detector_full(vpDetectorAprilTag::TAG_36h11, vpDetectorAprilTag::HOMOGRAPHY);
+  vpDetectorAprilTag detector_roi(vpDetectorAprilTag::TAG_36h11, vpDetectorAprilTag::HOMOGRAPHY);
+  const unsigned int fullFrameDetectionPeriod = 5;
+  detector_roi.setAprilTagRoiTracking(true, fullFrameDetectionPeriod);
+  CHECK(detector_roi.getAprilTagRoiTracking());
+  CHECK_FALSE(detector_full.getAprilTagRoiTracking());
+
+  std::vector<vpImagePoint> locations;
+  locations.push_back(vpImagePoint(20, 30));
+  locations.push_back(vpImagePoint(300, 60));
+  locations.push_back(vpImagePoint(150, 450));
+  std::vector<vpImagePoint> velocities;
+  velocities.push_back(vpImagePoint(3, 4));
+  velocities.push_back(vpImagePoint(-2, 5));
+  velocities.push_back(vpImagePoint(4, -3));
+
+  const unsigned int nbFrames = 20;
+  for (unsigned int frame = 0; frame < nbFrames; ++frame) {
+    vpImage<unsigned char> I;
+    std::vector<vpImagePoint> frameLocations;
+    for (size_t i = 0; i < locations.size(); ++i) {
+      frameLocations.push_back(locations[i] + (velocities[i] * frame));
+    }
+    drawScene(detector_full, frameLocations, I);
+
+    std::map<int, std::vector<vpImagePoint> > corners_full, corners_roi;
+    std::map<int, vpHomogeneousMatrix> poses_full, poses_roi;
+    detectTags(detector_full, I, cam, corners_full, poses_full);
+    detectTags(detector_roi, I, cam, corners_roi, poses_roi);
+    REQUIRE(corners_full.size() == locations.size());
+    REQUIRE(corners_roi.size() == corners_full.size());
+
+    std::vector<vpRect> rois = detector_roi.getAprilTagRois();
+    if ((frame % fullFrameDetectionPeriod) == 0) {
+      CHECK(rois.empty());
+    }
+    else {
+      CHECK(rois.size() == locations.size());
+      double area = 0.;
+      for (size_t i = 0; i < rois.size(); ++i) {
+        area += rois[i].getArea();
+      }
+      CHECK(area < (0.5 * I.getSize()));
+    }
+
+    for (std::map<int, std::vector<vpImagePoint> >::const_iterator it = corners_full.begin(); it != corners_full.end();
+         ++it) {
+      REQUIRE(corners_roi.find(it->first) != corners_roi.end());
+      for (size_t j = 0; j < it->second.size(); ++j) {
+        CHECK(vpImagePoint::distance(it->second[j], corners_roi[it->first][j]) < 0.5);
+      }
+      vpTranslationVector t_full = poses_full[it->first].getTranslationVector();
+      vpTranslationVector t_roi = poses_roi[it->first].getTranslationVector();
+      CHECK((t_full - t_roi).frobeniusNorm() < 1e-3);
+    }
+  }
+
+  // A new tag is found at the next detection on the whole image
+  vpImage<unsigned char> I;
+  std::vector<vpImagePoint> frameLocations;
+  for (size_t i = 0; i < locations.size(); ++i) {
+    frameLocations.push_back(locations[i] + (velocities[i] * nbFrames));
+  }
+  frameLocations.push_back(vpImagePoint(380, 500));
+  drawScene(detector_full, frameLocations, I);
+  unsigned int nbImages = 0;
+  while (detector_roi.detect(I) && (detector_roi.getNbObjects() < frameLocations.size())) {
+    ++nbImages;
+    REQUIRE(nbImages <= fullFrameDetectionPeriod);
+  }
+  CHECK(detector_roi.getNbObjects() == frameLocations.size());
+}
+
+TEST_CASE("AprilTag ROI tracking with a tag replaced by another one", "[apriltag]")
+{
+  vpDetectorAprilTag detector(vpDetectorAprilTag::TAG_36h11, vpDetectorAprilTag::HOMOGRAPHY);
+  const unsigned int fullFrameDetectionPeriod = 10;
+  detector.setAprilTagRoiTracking(true, fullFrameDetectionPeriod);
+
+  std::vector<vpImagePoint> locations;
+  locations.push_back(vpImagePoint(20, 30));
+  locations.push_back(vpImagePoint(300, 60));
+  locations.push_back(vpImagePoint(150, 450));
+  vpImage<unsigned char> I;
+  drawScene(detector, locations, I);
+  REQUIRE(detector.detect(I));
+  REQUIRE(detector.getNbObjects() == locations.size());
+  REQUIRE(detector.detect(I));
+  CHECK_FALSE(detector.getAprilTagRois().empty());
+
+  // The last tag is replaced by a new one in its region of interest: the number of tags does not change
+  std::vector<int> ids;
+  ids.push_back(0);
+  ids.push_back(1);
+  ids.push_back(3);
+  drawScene(detector, locations, I, ids);
+  REQUIRE(detector.detect(I));
+  CHECK_FALSE(detector.getAprilTagRois().empty());
+  CHECK(detector.getNbObjects() == locations.size());
+
+  // The lost tag triggers a detection on the whole image
+  REQUIRE(detector.detect(I));
+  CHECK(detector.getAprilTagRois().empty());
+}
+
+TEST_CASE("AprilTag detection on a view", "[apriltag]")
+{
+  vpCameraParameters cam(600, 600, 160, 120);
+  vpDetectorAprilTag detector_crop(vpDetectorAprilTag::TAG_36h11, vpDetectorAprilTag::HOMOGRAPHY);
+  vpDetectorAprilTag detector_view(vpDetectorAprilTag::TAG_36h11, vpDetectorAprilTag::HOMOGRAPHY);
+
+  std::vector<vpImagePoint> locations;
+  locations.push_back(vpImagePoint(110, 230));
+  locations.push_back(vpImagePoint(200, 380));
+  vpImage<unsigned char> I;
+  drawScene(detector_crop, locations, I);
+
+  // The view rows are not contiguous in memory
+  const vpRect rect(200, 90, 320, 240);
+  vpImage<unsigned char> I_view;
+  vpImage<unsigned char>::view(I_view, I, rect);
+  REQUIRE_FALSE(I_view.isContiguous());
+  vpImage<unsigned char> I_crop;
+  vpImageTools::crop(I, rect, I_crop);
+
+  std::map<int, std::vector<vpImagePoint> > corners_crop, corners_view;
+  std::map<int, vpHomogeneousMatrix> poses_crop, poses_view;
+  detectTags(detector_crop, I_crop, cam, corners_crop, poses_crop);
+  detectTags(detector_view, I_view, cam, corners_view, poses_view);
+  REQUIRE(corners_crop.size() == locations.size());
+  REQUIRE(corners_view.size() == corners_crop.size());
+  for (std::map<int, std::vector<vpImagePoint> >::const_iterator it = corners_crop.begin(); it != corners_crop.end();
+       ++it) {
+    REQUIRE(corners_view.find(it->first) != corners_view.end());
+    for (size_t j = 0; j < it->second.size(); ++j) {
+      CHECK(vpImagePoint::distance(it->second[j], corners_view[it->first][j]) < 1e-6);
+    }
+    vpTranslationVector t_crop = poses_crop[it->first].getTranslationVector();
+    vpTranslationVector t_view = poses_view[it->first].getTranslationVector();
+    CHECK((t_crop - t_view).frobeniusNorm() < 1e-9);
+  }
+
+  // Detection in regions of interest of a view
+  detector_view.setAprilTagRoiTracking(true, 5);
+  REQUIRE(detector_view.detect(I_view));
+  REQUIRE(detector_view.detect(I_view));
+  CHECK(detector_view.getAprilTagRois().size() == locations.size());
+  CHECK(detector_view.getNbObjects() == locations.size());
+}
+
+int main(int argc, char *argv[])
+{
+  Catch::Session session;
+  session.applyCommandLine(argc, argv);
+  int numFailed = session.run();
+  return numFailed;
+}
+#else
+#include <iostream>
+
+int main() { return EXIT_SUCCESS; }
+#endif
@@ -205,7 +205,8 @@ public:
   {
     if (scale == 1) {
       /* Copie de l'image dans le pixmap fond */
-      gdk_draw_gray_image(m_background, m_gc, 0, 0, width, height, GDK_RGB_DITHER_NONE, I.bitmap, width);
+      gdk_draw_gray_image(m_background, m_gc, 0, 0, width, height, GDK_RGB_DITHER_NONE, I.bitmap,
+                          static_cast<gint>(I.getStride()));
     }
     else {
       vpImage<unsigned char> sampled;
@@ -222,7 +223,7 @@ public:
     if (scale == 1) {
       /* Copie de l'image dans le pixmap fond */
       gdk_draw_rgb_32_image(m_background, m_gc, 0, 0, width, height, GDK_RGB_DITHER_NONE, (unsigned char *)I.bitmap,
-                            4 * width);
+                            4 * static_cast<gint>(I.getStride()));
     }
     else {
       vpImage<vpRGBa> sampled;
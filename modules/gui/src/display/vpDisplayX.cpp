@@ -190,20 +190,18 @@ public:
       // ROUGE, VERT, BLEU, JAUNE
       unsigned char nivGrisMax = 255 - vpColor::id_unknown;
       if (scale == 1) {
-        unsigned char *src_8 = (unsigned char *)I.bitmap;
         unsigned char *dst_8 = (unsigned char *)Ximage->data;
-        unsigned int i = 0;
-        unsigned int size = width * height;
-
-        while (i < size) {
-          unsigned char nivGris = src_8[i];
-          if (nivGris > nivGrisMax) {
-            dst_8[i] = 255;
-          }
-          else {
-            dst_8[i] = nivGris;
+        for (unsigned int i = 0; i < height; ++i) {
+          const unsigned char *src_8 = I[i];
+          for (unsigned int j = 0; j < width; ++j) {
+            unsigned char nivGris = src_8[j];
+            if (nivGris > nivGrisMax) {
+              *(dst_8++) = 255;
+            }
+            else {
+              *(dst_8++) = nivGris;
+            }
           }
-          ++i;
         }
       }
       else {
@@ -258,29 +256,30 @@ public:
     default: {
       unsigned char *dst_32 = (unsigned char *)Ximage->data;
       if (scale == 1) {
-        unsigned int size_ = width * height;
-        unsigned char *bitmap = I.bitmap;
-        unsigned char *n = I.bitmap + size_;
-        // for (unsigned int i = 0; i < size; i++) // suppression de
-        // l'iterateur i
         if (XImageByteOrder(display) == 1) {
           // big endian
-          while (bitmap < n) {
-            unsigned char val = *(bitmap++);
-            *(dst_32++) = vpRGBa::alpha_default;
-            *(dst_32++) = val; // Red
-            *(dst_32++) = val; // Green
-            *(dst_32++) = val; // Blue
+          for (unsigned int i = 0; i < height; ++i) {
+            const unsigned char *bitmap = I[i];
+            for (unsigned int j = 0; j < width; ++j) {
+              unsigned char val = bitmap[j];
+              *(dst_32++) = vpRGBa::alpha_default;
+              *(dst_32++) = val; // Red
+              *(dst_32++) = val; // Green
+              *(dst_32++) = val; // Blue
+            }
           }
         }
         else {
        // little endian
-          while (bitmap < n) {
-            unsigned char val = *(bitmap++);
-            *(dst_32++) = val; // Blue
-            *(dst_32++) = val; // Green
-            *(dst_32++) = val; // Red
-            *(dst_32++) = vpRGBa::alpha_default;
+          for (unsigned int i = 0; i < height; ++i) {
+            const unsigned char *bitmap = I[i];
+            for (unsigned int j = 0; j < width; ++j) {
+              unsigned char val = bitmap[j];
+              *(dst_32++) = val; // Blue
+              *(dst_32++) = val; // Green
+              *(dst_32++) = val; // Red
+              *(dst_32++) = vpRGBa::alpha_default;
+            }
           }
         }
       }
@@ -323,7 +322,6 @@ public:
   {
     switch (screen_depth) {
     case 16: {
-      vpRGBa *bitmap = I.bitmap;
       unsigned int r, g, b;
       unsigned int bytes_per_line = static_cast<unsigned int>(Ximage->bytes_per_line);
 
@@ -331,6 +329,7 @@ public:
         for (unsigned int i = 0; i < height; i++) {
           unsigned char *dst_8 = (unsigned char *)Ximage->data + i * bytes_per_line;
           unsigned short *dst_16 = (unsigned short *)dst_8;
+          const vpRGBa *bitmap = I[i];
           for (unsigned int j = 0; j < width; j++) {
             r = bitmap->R;
             g = bitmap->G;
@@ -352,7 +351,6 @@ public:
             b = val.B;
             *(dst_16 + j) =
               (((r << 8) >> RShift) & RMask) | (((g << 8) >> GShift) & GMask) | (((b << 8) >> BShift) & BMask);
-            bitmap++;
           }
         }
       }
@@ -370,26 +368,30 @@ public:
       unsigned char *dst_32 = nullptr;
       dst_32 = (unsigned char *)Ximage->data;
       if (scale == 1) {
-        vpRGBa *bitmap = I.bitmap;
-        unsigned int sizeI = width * height;
         if (XImageByteOrder(display) == 1) {
           // big endian
-          for (unsigned int i = 0; i < sizeI; i++) {
-            *(dst_32++) = bitmap->A;
-            *(dst_32++) = bitmap->R;
-            *(dst_32++) = bitmap->G;
-            *(dst_32++) = bitmap->B;
-            bitmap++;
+          for (unsigned int i = 0; i < height; i++) {
+            const vpRGBa *bitmap = I[i];
+            for (unsigned int j = 0; j < width; j++) {
+              *(dst_32++) = bitmap->A;
+              *(dst_32++) = bitmap->R;
+              *(dst_32++) = bitmap->G;
+              *(dst_32++) = bitmap->B;
+              bitmap++;
+            }
           }
         }
         else {
        // little endian
-          for (unsigned int i = 0; i < sizeI; i++) {
-            *(dst_32++) = bitmap->B;
-            *(dst_32++) = bitmap->G;
-            *(dst_32++) = bitmap->R;
-            *(dst_32++) = bitmap->A;
-            bitmap++;
+          for (unsigned int i = 0; i < height; i++) {
+            const vpRGBa *bitmap = I[i];
+            for (unsigned int j = 0; j < width; j++) {
+              *(dst_32++) = bitmap->B;
+              *(dst_32++) = bitmap->G;
+              *(dst_32++) = bitmap->R;
+              *(dst_32++) = bitmap->A;
+              bitmap++;
+            }
           }
         }
       }
@@ -456,11 +458,10 @@ public:
       // ROUGE, VERT, BLEU, JAUNE
       unsigned char nivGrisMax = 255 - vpColor::id_unknown;
       if (scale == 1) {
-        unsigned char *src_8 = (unsigned char *)I.bitmap;
+        const unsigned char *src_8 = I[static_cast<unsigned int>(iP.get_i())] + static_cast<int>(iP.get_j());
         unsigned char *dst_8 = (unsigned char *)Ximage->data;
-        unsigned int iwidth = I.getWidth();
+        unsigned int iwidth = I.getStride();
 
-        src_8 = src_8 + static_cast<int>(iP.get_i() * iwidth + iP.get_j());
         dst_8 = dst_8 + static_cast<int>(iP.get_i() * width + iP.get_j());
 
         unsigned int i = 0;
@@ -555,8 +556,8 @@ public:
     case 24:
     default: {
       if (scale == 1) {
-        unsigned int iwidth = I.getWidth();
-        unsigned char *src_8 = I.bitmap + static_cast<int>(iP.get_i() * iwidth + iP.get_j());
+        unsigned int iwidth = I.getStride();
+        const unsigned char *src_8 = I[static_cast<unsigned int>(iP.get_i())] + static_cast<int>(iP.get_j());
         unsigned char *dst_32 = (unsigned char *)Ximage->data + static_cast<int>(iP.get_i() * 4 * width + iP.get_j() * 4);
 
         if (XImageByteOrder(display) == 1) {
@@ -707,11 +708,10 @@ public:
 
       if (scale == 1) {
         unsigned char *dst_32 = (unsigned char *)Ximage->data;
-        vpRGBa *src_32 = I.bitmap;
+        const vpRGBa *src_32 = I[static_cast<unsigned int>(iP.get_i())] + static_cast<int>(iP.get_j());
 
-        unsigned int iwidth = I.getWidth();
+        unsigned int iwidth = I.getStride();
 
-        src_32 = src_32 + static_cast<int>(iP.get_i() * iwidth + iP.get_j());
         dst_32 = dst_32 + static_cast<int>(iP.get_i() * 4 * width + iP.get_j() * 4);
 
         unsigned int i = 0;
@@ -977,17 +977,16 @@ public:
 
     if (screen_depth == 16) {
       for (unsigned int i = 0; i < I.getHeight(); i++) {
-        size_t i_ = i * width;
+        vpRGBa *dst = I[i];
         for (unsigned int j = 0; j < height; j++) {
-          size_t ij_ = i_ + j;
           unsigned long pixel = XGetPixel(xi, static_cast<int>(j), static_cast<int>(i));
-          I.bitmap[ij_].R = (((pixel & RMask) << RShift) >> 8);
-          I.bitmap[ij_].G = (((pixel & GMask) << GShift) >> 8);
-          I.bitmap[ij_].B = (((pixel & BMask) << BShift) >> 8);
+          dst[j].R = (((pixel & RMask) << RShift) >> 8);
+          dst[j].G = (((pixel & GMask) << GShift) >> 8);
+          dst[j].B = (((pixel & BMask) << BShift) >> 8);
           // On OSX the bottom/right corner (around the resizing icon) has
           // alpha component with different values than 255. That's why we
           // force alpha to vpRGBa::alpha_default
-          I.bitmap[ij_].A = vpRGBa::alpha_default;
+          dst[j].A = vpRGBa::alpha_default;
         }
       }
 
@@ -995,26 +994,34 @@ public:
     else {
       if (XImageByteOrder(display) == 1) {
         // big endian
-        for (unsigned int i = 0; i < width * height; i++) {
-          // On OSX the bottom/right corner (around the resizing icon) has
-          // alpha component with different values than 255. That's why we
-          // force alpha to vpRGBa::alpha_default
-          I.bitmap[i].A = vpRGBa::alpha_default; // src_32[i*4] ;
-          I.bitmap[i].R = src_32[i * 4 + 1];
-          I.bitmap[i].G = src_32[i * 4 + 2];
-          I.bitmap[i].B = src_32[i * 4 + 3];
+        for (unsigned int i = 0; i < height; i++) {
+          vpRGBa *dst = I[i];
+          for (unsigned int j = 0; j < width; j++) {
+            // On OSX the bottom/right corner (around the resizing icon) has
+            // alpha component with different values than 255. That's why we
+            // force alpha to vpRGBa::alpha_default
+            dst[j].A = vpRGBa::alpha_default; // src_32[0] ;
+            dst[j].R = src_32[1];
+            dst[j].G = src_32[2];
+            dst[j].B = src_32[3];
+            src_32 += 4;
+          }
         }
       }
       else {
      // little endian
-        for (unsigned int i = 0; i < width * height; i++) {
-          I.bitmap[i].B = src_32[i * 4];
-          I.bitmap[i].G = src_32[i * 4 + 1];
-          I.bitmap[i].R = src_32[i * 4 + 2];
-          // On OSX the bottom/right corner (around the resizing icon) has
-          // alpha component with different values than 255. That's why we
-          // force alpha to vpRGBa::alpha_default
-          I.bitmap[i].A = vpRGBa::alpha_default; // src_32[i*4 + 3];
+        for (unsigned int i = 0; i < height; i++) {
+          vpRGBa *dst = I[i];
+          for (unsigned int j = 0; j < width; j++) {
+            dst[j].B = src_32[0];
+            dst[j].G = src_32[1];
+            dst[j].R = src_32[2];
+            // On OSX the bottom/right corner (around the resizing icon) has
+            // alpha component with different values than 255. That's why we
+            // force alpha to vpRGBa::alpha_default
+            dst[j].A = vpRGBa::alpha_default; // src_32[3];
+            src_32 += 4;
+          }
         }
       }
     }
@@ -1130,24 +1130,18 @@ void vpD3DRenderer::drawArrow(const vpImagePoint &ip1, const vpImagePoint &ip2,
 */
 void TextureToRGBa(vpImage<vpRGBa> &I, unsigned char *imBuffer, unsigned int pitch)
 {
-  unsigned int j = I.getWidth();
-
-  unsigned int k = 0;
-  for (unsigned int i = 0; i < I.getHeight() * I.getWidth(); ++i) {
+  for (unsigned int i = 0; i < I.getHeight(); ++i) {
     // go to the next line
-    if (j == 0) {
-      k += pitch - (I.getWidth() * 4);
-      j = I.getWidth();
+    const unsigned char *src = imBuffer + (i * pitch);
+    vpRGBa *dst = I[i];
+    for (unsigned int j = 0; j < I.getWidth(); ++j) {
+      // simple conversion from bgra to rgba
+      dst[j].B = src[0];
+      dst[j].G = src[1];
+      dst[j].R = src[2];
+      dst[j].A = src[3];
+      src += 4;
     }
-
-    // simple conversion from bgra to rgba
-    I.bitmap[i].B = imBuffer[k + 0];
-    I.bitmap[i].G = imBuffer[k + 1];
-    I.bitmap[i].R = imBuffer[k + 2];
-    I.bitmap[i].A = imBuffer[k + 3];
-
-    k += 4;
-    j--;
   }
 }
 
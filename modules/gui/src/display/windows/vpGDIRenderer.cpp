@@ -216,7 +216,8 @@ void vpGDIRenderer::convert(const vpImage<vpRGBa> &I, HBITMAP &hBmp)
   // allocate the buffer
   unsigned char *imBuffer = new unsigned char[m_rwidth * m_rheight * 4];
 
-  if (m_rscale == 1) {
+  // The bitmap can only be walked linearly when the rows are contiguous, see vpImage::isContiguous()
+  if ((m_rscale == 1) && I.isContiguous()) {
     for (unsigned int i = 0, k = 0; i < m_rwidth * m_rheight * 4; i += 4, ++k) {
       imBuffer[i + 0] = I.bitmap[k].B;
       imBuffer[i + 1] = I.bitmap[k].G;
@@ -268,9 +269,8 @@ void vpGDIRenderer::convertROI(const vpImage<vpRGBa> &I, const vpImagePoint &iP,
   unsigned char *imBuffer = new unsigned char[w * h * 4];
 
   if (m_rscale == 1) {
-    vpRGBa *bitmap = I.bitmap;
-    unsigned int iwidth = I.getWidth();
-    bitmap = bitmap + static_cast<int>(i_min * iwidth + j_min);
+    const vpRGBa *bitmap = I[i_min] + j_min;
+    unsigned int iwidth = I.getStride();
 
     int k = 0;
     for (int i = 0; i < w * h * 4; i += 4) {
@@ -318,7 +318,8 @@ void vpGDIRenderer::convert(const vpImage<unsigned char> &I, HBITMAP &hBmp)
   // allocate the buffer
   unsigned char *imBuffer = new unsigned char[m_rwidth * m_rheight * 4];
 
-  if (m_rscale == 1) {
+  // The bitmap can only be walked linearly when the rows are contiguous, see vpImage::isContiguous()
+  if ((m_rscale == 1) && I.isContiguous()) {
     for (unsigned int i = 0, k = 0; i < m_rwidth * m_rheight * 4; i += 4, ++k) {
       imBuffer[i + 0] = I.bitmap[k];
       imBuffer[i + 1] = I.bitmap[k];
@@ -1024,11 +1025,16 @@ void vpGDIRenderer::getImage(vpImage<vpRGBa> &I)
   I.resize(m_rheight, m_rwidth);
 
   // copy the content
-  for (unsigned int i = 0; i < size; i += 4) {
-    I.bitmap[i >> 2].R = imBuffer[i + 2];
-    I.bitmap[i >> 2].G = imBuffer[i + 1];
-    I.bitmap[i >> 2].B = imBuffer[i + 0];
-    I.bitmap[i >> 2].A = vpRGBa::alpha_default; // default opacity
+  const unsigned char *src = imBuffer;
+  for (unsigned int i = 0; i < m_rheight; ++i) {
+    vpRGBa *dst = I[i];
+    for (unsigned int j = 0; j < m_rwidth; ++j) {
+      dst[j].R = src[2];
+      dst[j].G = src[1];
+      dst[j].B = src[0];
+      dst[j].A = vpRGBa::alpha_default; // default opacity
+      src += 4;
+    }
   }
 
   delete[] imBuffer;
@@ -449,28 +449,17 @@ void clahe(const vpImage<vpRGBa> &I1, vpImage<vpRGBa> &I2, int blockRadius, int
   clahe(pG, resG, blockRadius, bins, slope, fast);
   clahe(pB, resB, blockRadius, bins, slope, fast);
 
-  const unsigned int sizeRGBa = 4;
   I2.resize(I1.getHeight(), I1.getWidth());
-  unsigned int size = I2.getWidth() * I2.getHeight();
-  unsigned char *ptrStart = reinterpret_cast<unsigned char *>(I2.bitmap);
-  unsigned char *ptrEnd = ptrStart + (size * sizeRGBa);
-  unsigned char *ptrCurrent = ptrStart;
-
-  unsigned int cpt = 0;
-  while (ptrCurrent != ptrEnd) {
-    *ptrCurrent = resR.bitmap[cpt];
-    ++ptrCurrent;
-
-    *ptrCurrent = resG.bitmap[cpt];
-    ++ptrCurrent;
-
-    *ptrCurrent = resB.bitmap[cpt];
-    ++ptrCurrent;
-
-    *ptrCurrent = pa.bitmap[cpt];
-    ++ptrCurrent;
-
-    ++cpt;
+  const unsigned int height = I2.getHeight(), width = I2.getWidth();
+  for (unsigned int i = 0; i < height; ++i) {
+    vpRGBa *ptrCurrent = I2[i];
+    for (unsigned int j = 0; j < width; ++j) {
+      ptrCurrent->R = resR[i][j];
+      ptrCurrent->G = resG[i][j];
+      ptrCurrent->B = resB[i][j];
+      ptrCurrent->A = pa[i][j];
+      ++ptrCurrent;
+    }
   }
 }
 
@@ -321,7 +321,7 @@ void findContours(const vpImage<unsigned char> &I_original, vpContour &contours,
 
   for (unsigned int i = 0; i < i_height; ++i) {
     if ((i == 0) || (i == (i_height - 1))) {
-      memset(I.bitmap, 0, sizeof(int) * i_width);
+      memset(I[i], 0, sizeof(int) * i_width);
     }
     else {
       I[i][0] = 0;
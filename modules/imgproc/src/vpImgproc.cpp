@@ -241,6 +241,13 @@ void equalizeHistogram(const vpImage<unsigned char> &I1, vpImage<unsigned char>
 
 void equalizeHistogram(vpImage<vpRGBa> &I, bool useHSV)
 {
+  if (!I.isContiguous()) {
+    // The bitmap is walked linearly: process views and padded images in a contiguous copy
+    vpImage<vpRGBa> I_contiguous = I;
+    equalizeHistogram(I_contiguous, useHSV);
+    I = I_contiguous;
+    return;
+  }
   if ((I.getWidth() * I.getHeight()) == 0) {
     return;
   }
@@ -485,6 +492,12 @@ void gammaCorrectionProbBasedMethod(vpImage<unsigned char> &I, const vpImage<boo
  */
 void gammaCorrectionSpatialBased(vpImage<unsigned char> &I, const vpImage<bool> *p_mask)
 {
+  if (!I.isContiguous()) {
+    vpImage<unsigned char> I_contiguous = I;
+    gammaCorrectionSpatialBased(I_contiguous, p_mask);
+    I = I_contiguous;
+    return;
+  }
   unsigned int width = I.getWidth(), height = I.getHeight();
   const unsigned int scale2 = 2, scale4 = 4, scale8 = 8;
   vpImage<unsigned char> I_2, I_4, I_8;
@@ -547,6 +560,12 @@ void gammaCorrectionSpatialBased(vpImage<unsigned char> &I, const vpImage<bool>
  */
 void gammaCorrectionSpatialBased(vpImage<vpRGBa> &I, const vpImage<bool> *p_mask)
 {
+  if (!I.isContiguous()) {
+    vpImage<vpRGBa> I_contiguous = I;
+    gammaCorrectionSpatialBased(I_contiguous, p_mask);
+    I = I_contiguous;
+    return;
+  }
   unsigned int width = I.getWidth(), height = I.getHeight();
   unsigned int size = height * width;
   vpImage<unsigned char> I_gray(height, width);
@@ -664,6 +683,12 @@ void gammaCorrection(const vpImage<unsigned char> &I1, vpImage<unsigned char> &I
 void gammaCorrection(vpImage<vpRGBa> &I, const float &gamma, const vpGammaColorHandling &colorHandling,
                      const vpGammaMethod &method, const vpImage<bool> *p_mask)
 {
+  if (!I.isContiguous()) {
+    vpImage<vpRGBa> I_contiguous = I;
+    gammaCorrection(I_contiguous, gamma, colorHandling, method, p_mask);
+    I = I_contiguous;
+    return;
+  }
   if (method ==  GAMMA_SPATIAL_VARIANT_BASED) {
     gammaCorrectionSpatialBased(I, p_mask);
   }
@@ -825,6 +850,12 @@ void stretchContrast(const vpImage<vpRGBa> &I1, vpImage<vpRGBa> &I2)
 
 void stretchContrastHSV(vpImage<vpRGBa> &I)
 {
+  if (!I.isContiguous()) {
+    vpImage<vpRGBa> I_contiguous = I;
+    stretchContrastHSV(I_contiguous);
+    I = I_contiguous;
+    return;
+  }
   unsigned int size = I.getWidth() * I.getHeight();
 
   // Convert RGB to HSV
@@ -876,6 +907,12 @@ void stretchContrastHSV(const vpImage<vpRGBa> &I1, vpImage<vpRGBa> &I2)
 
 void unsharpMask(vpImage<unsigned char> &I, float sigma, double weight)
 {
+  if (!I.isContiguous()) {
+    vpImage<unsigned char> I_contiguous = I;
+    unsharpMask(I_contiguous, sigma, weight);
+    I = I_contiguous;
+    return;
+  }
   if ((weight < 1.0) && (weight >= 0.0)) {
 #if defined(VISP_HAVE_SIMDLIB)
     // Gaussian blurred image
@@ -908,6 +945,12 @@ void unsharpMask(const vpImage<unsigned char> &I, vpImage<unsigned char> &Ires,
 
 void unsharpMask(vpImage<vpRGBa> &I, float sigma, double weight)
 {
+  if (!I.isContiguous()) {
+    vpImage<vpRGBa> I_contiguous = I;
+    unsharpMask(I_contiguous, sigma, weight);
+    I = I_contiguous;
+    return;
+  }
   if ((weight < 1.0) && (weight >= 0.0)) {
 #if defined(VISP_HAVE_SIMDLIB)
     // Gaussian blurred image
@@ -263,6 +263,14 @@ void retinex(vpImage<vpRGBa> &I, int scale, int scaleDiv, int level, const doubl
     return;
   }
 
+  if (!I.isContiguous()) {
+    // MSRCR() walks the bitmap linearly: process views and padded images in a contiguous copy
+    vpImage<vpRGBa> I_contiguous = I;
+    MSRCR(I_contiguous, scale, scaleDiv, level, dynamic, kernelSize);
+    I = I_contiguous;
+    return;
+  }
+
   MSRCR(I, scale, scaleDiv, level, dynamic, kernelSize);
 }
 
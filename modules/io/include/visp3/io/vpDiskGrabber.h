@@ -225,6 +225,11 @@ public:
    */
   inline long getImageNumber() const { return m_image_number; }
 
+  /*!
+   * Return the number of the image that will be read by the next call to acquire().
+   */
+  inline long getNextImageNumber() const { return m_image_number_next; }
+
   /*!
    * Return the name of the file in which the last frame was read.
    */
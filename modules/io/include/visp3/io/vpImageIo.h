@@ -68,6 +68,9 @@ BEGIN_VISP_NAMESPACE
     not installed OpenCV is also used to consider these image formats.
     Installation instructions are provided here https://visp.inria.fr/3rd_opencv.
 
+  The images that are read or written must be contiguous (see vpImage::isContiguous()):
+  a vpImageException::ioError is thrown when the image is a view of a region of interest.
+
   The code below shows how to convert an PPM P6 image file format into
   a PGM P5 image file format. The extension of the filename is here
   used in read() and write() functions to set the image file format
@@ -98,6 +101,16 @@ BEGIN_VISP_NAMESPACE
   read/write jpeg images. It supposes that `libjpeg` is installed.
 
   \include tutorial-image-reader.cpp
+
+  When many images have to be loaded or saved, readBatch() and writeBatch() encode or decode them in parallel and
+  report the time spent on each image.
+  \code
+  std::vector<vpImage<unsigned char> > images;
+  std::vector<std::string> filenames;
+  // ...
+  std::vector<double> durations;
+  vpImageIo::writeBatch(images, filenames, &durations);
+  \endcode
 */
 
 class VISP_EXPORT vpImageIo
@@ -191,6 +204,36 @@ public:
       int backend = IO_DEFAULT_BACKEND);
   static void writePNGtoMem(const vpImage<vpRGBa> &I, std::vector<unsigned char> &buffer,
       int backend = IO_DEFAULT_BACKEND, bool saveAlpha = false);
+
+  static void readBatch(std::vector<vpImage<unsigned char> > &I, const std::vector<std::string> &filenames,
+                        std::vector<double> *durations = nullptr, int backend = IO_DEFAULT_BACKEND,
+                        unsigned int nbThreads = 0);
+  static void readBatch(std::vector<vpImage<vpRGBa> > &I, const std::vector<std::string> &filenames,
+                        std::vector<double> *durations = nullptr, int backend = IO_DEFAULT_BACKEND,
+                        unsigned int nbThreads = 0);
+
+  static void writeBatch(const std::vector<vpImage<unsigned char> > &I, const std::vector<std::string> &filenames,
+                         std::vector<double> *durations = nullptr, int backend = IO_DEFAULT_BACKEND,
+                         unsigned int nbThreads = 0);
+  static void writeBatch(const std::vector<vpImage<vpRGBa> > &I, const std::vector<std::string> &filenames,
+                         std::vector<double> *durations = nullptr, int backend = IO_DEFAULT_BACKEND,
+                         unsigned int nbThreads = 0);
+
+  static void readPNGfromMemBatch(const std::vector<std::vector<unsigned char> > &buffers,
+                                  std::vector<vpImage<unsigned char> > &I, std::vector<double> *durations = nullptr,
+                                  int backend = IO_DEFAULT_BACKEND, unsigned int nbThreads = 0);
+  static void readPNGfromMemBatch(const std::vector<std::vector<unsigned char> > &buffers,
+                                  std::vector<vpImage<vpRGBa> > &I, std::vector<double> *durations = nullptr,
+                                  int backend = IO_DEFAULT_BACKEND, unsigned int nbThreads = 0);
+
+  static void writePNGtoMemBatch(const std::vector<vpImage<unsigned char> > &I,
+                                 std::vector<std::vector<unsigned char> > &buffers,
+                                 std::vector<double> *durations = nullptr, int backend = IO_DEFAULT_BACKEND,
+                                 unsigned int nbThreads = 0);
+  static void writePNGtoMemBatch(const std::vector<vpImage<vpRGBa> > &I,
+                                 std::vector<std::vector<unsigned char> > &buffers,
+                                 std::vector<double> *durations = nullptr, int backend = IO_DEFAULT_BACKEND,
+                                 unsigned int nbThreads = 0);
 };
 
 END_VISP_NAMESPACE
@@ -175,6 +175,19 @@ BEGIN_VISP_NAMESPACE
  *   return 0;
  * }
  * \endcode
+ *
+ * When replaying a sequence of images, the loading and the decoding of the images can be done in the background
+ * using setPrefetch(). A ring of the next frames is then decoded by background threads while the current frame is
+ * processed. acquire() and getFrame() take the frames from this ring when they are already decoded.
+ * \code
+ * vpVideoReader reader;
+ * reader.setFileName("./image/image%04d.png");
+ * reader.setPrefetch(16); // Decode up to 16 frames ahead, with as many threads as CPU cores
+ * reader.open(I);
+ * while (! reader.end() ) {
+ *   reader.acquire(I);
+ * }
+ * \endcode
 */
 
 class VISP_EXPORT vpVideoReader : public vpFrameGrabber
@@ -239,6 +252,14 @@ private:
   long m_frameStep;
   double m_frameRate;
 
+  class vpFramePrefetcher;
+  //! Background decoding of the next images of a sequence
+  vpFramePrefetcher *m_prefetcher;
+  //! Number of frames decoded ahead, 0 when prefetching is disabled
+  unsigned int m_prefetchSize;
+  //! Number of decoding threads, 0 to use as many threads as CPU cores
+  unsigned int m_prefetchNbThreads;
+
 public:
   vpVideoReader();
   vpVideoReader(const vpVideoReader &reader);
@@ -329,6 +350,13 @@ public:
    */
   inline long getFrameStep() const { return m_frameStep; }
 
+  /*!
+   * Return the number of frames that are decoded ahead, 0 when prefetching is disabled.
+   *
+   * \sa setPrefetch()
+   */
+  inline unsigned int getPrefetch() const { return m_prefetchSize; }
+
   bool isVideoFormat() const;
   void open(vpImage<vpRGBa> &I) VP_OVERRIDE;
   void open(vpImage<unsigned char> &I) VP_OVERRIDE;
@@ -384,6 +412,8 @@ public:
    */
   inline void setFrameStep(const long frame_step) { m_frameStep = frame_step; }
 
+  void setPrefetch(unsigned int nbFrames, unsigned int nbThreads = 0);
+
 private:
   vpVideoFormatType getFormat(const std::string &filename) const;
   static std::string getExtension(const std::string &filename);
@@ -393,6 +423,10 @@ private:
   bool isVideoExtensionSupported() const;
   bool checkImageNameFormat(const std::string &format) const;
   void getProperties();
+  template <typename Type> void acquirePrefetched(vpImage<Type> &I);
+  template <typename Type> bool getPrefetchedFrame(vpImage<Type> &I, long frame_index);
+  void startPrefetch();
+  void stopPrefetch();
 };
 
 END_VISP_NAMESPACE
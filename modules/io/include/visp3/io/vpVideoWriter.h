@@ -39,6 +39,7 @@
 #ifndef VP_VIDEO_WRITER_H
 #define VP_VIDEO_WRITER_H
 
+#include <memory>
 #include <string>
 
 #include <visp3/io/vpImageIo.h>
@@ -165,6 +166,21 @@ BEGIN_VISP_NAMESPACE
     return 0;
   }
   \endcode
+
+  When recording a sequence of images from a control loop, the encoding of the images, that may take several ms
+  for PNG images, can be done in the background with setAsynchronousSaving(). saveFrame() then only copies the
+  image and returns immediately, the frames being written by background threads. close() or flush() wait until all
+  the frames are written. The number of frames waiting to be written is bounded with setMaxPendingFrames().
+  \code
+  vpVideoWriter writer;
+  writer.setFileName("./image/image%04d.png");
+  writer.setAsynchronousSaving(true);
+  writer.open(I);
+  for ( ; ; ) {
+    writer.saveFrame(I); // Does not wait for the image to be written
+  }
+  writer.close();
+  \endcode
 */
 
 class VISP_EXPORT vpVideoWriter
@@ -216,11 +232,22 @@ private:
 
   int m_frameStep;
 
+  class vpFrameSaver;
+  //! Background saving of the images of a sequence, null when frames are saved synchronously
+  std::shared_ptr<vpFrameSaver> m_saver;
+  //! Number of encoding threads used by the background saving, 0 to use as many threads as CPU cores
+  unsigned int m_saverNbThreads;
+  //! Maximum number of frames waiting to be written in the background, 0 for no limit
+  unsigned int m_saverMaxPending;
+  //! Indicates if the images of a sequence are saved in the background.
+  bool m_asynchronous;
+
 public:
   vpVideoWriter();
   virtual ~vpVideoWriter();
 
   void close();
+  void flush();
 
   /*!
     Gets the current frame index.
@@ -232,6 +259,7 @@ public:
    * Return the name of the file in which the last frame was saved.
    */
   inline std::string getFrameName() const { return m_frameName; }
+  unsigned int getNbPendingFrames() const;
 
   void open(vpImage<vpRGBa> &I);
   void open(vpImage<unsigned char> &I);
@@ -251,8 +279,10 @@ public:
   inline void setCodec(const int fourcc_codec) { m_fourcc = fourcc_codec; }
 #endif
 
+  void setAsynchronousSaving(bool asynchronous, unsigned int nbThreads = 0);
   void setFileName(const std::string &filename);
   void setFirstFrameIndex(int first_frame);
+  void setMaxPendingFrames(unsigned int maxPending);
 
   /*!
    * Sets the framerate in Hz of the video when encoding.
@@ -124,20 +124,17 @@ namespace
 typedef struct
 {
   int last_pos;
-  void *context;
+  std::vector<unsigned char> *context;
 } custom_stbi_mem_context;
 
-// custom write function
+// custom write function, the buffer grows since the encoded image may be larger than the raw one
 static void custom_stbi_write_mem(void *context, void *data, int size)
 {
   custom_stbi_mem_context *c = (custom_stbi_mem_context *)context;
-  char *dst = (char *)c->context;
-  char *src = (char *)data;
-  int cur_pos = c->last_pos;
-  for (int i = 0; i < size; ++i) {
-    dst[cur_pos++] = src[i];
-  }
-  c->last_pos = cur_pos;
+  unsigned char *src = (unsigned char *)data;
+  c->context->resize(static_cast<size_t>(c->last_pos));
+  c->context->insert(c->context->end(), src, src + size);
+  c->last_pos += size;
 }
 }
 
@@ -206,8 +203,9 @@ void writePNGtoMemStb(const vpImage<unsigned char> &I, std::vector<unsigned char
 
   custom_stbi_mem_context context;
   context.last_pos = 0;
-  buffer.resize(static_cast<size_t>(I.getHeight()) * static_cast<size_t>(I.getWidth()));
-  context.context = (void *)buffer.data();
+  buffer.clear();
+  buffer.reserve(static_cast<size_t>(I.getHeight()) * static_cast<size_t>(I.getWidth()));
+  context.context = &buffer;
 
   const int stride_bytes = 0;
   int result = stbi_write_png_to_func(custom_stbi_write_mem, &context, width, height, channels, I.bitmap, stride_bytes);
@@ -240,8 +238,9 @@ void writePNGtoMemStb(const vpImage<vpRGBa> &I_color, std::vector<unsigned char>
 
   custom_stbi_mem_context context;
   context.last_pos = 0;
-  buffer.resize(static_cast<size_t>(height) * static_cast<size_t>(width) * static_cast<size_t>(channels));
-  context.context = (void *)buffer.data();
+  buffer.clear();
+  buffer.reserve(static_cast<size_t>(height) * static_cast<size_t>(width) * static_cast<size_t>(channels));
+  context.context = &buffer;
 
   const int stride_bytes = 0;
   int result = 0;
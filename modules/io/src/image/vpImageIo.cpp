@@ -45,6 +45,18 @@
 using namespace VISP_NAMESPACE_NAME;
 #endif
 
+namespace
+{
+// The backends read and write the bitmap linearly, which is only valid when the rows are contiguous
+template <typename Type> void checkContiguous(const vpImage<Type> &I, const char *func)
+{
+  if (!I.isContiguous()) {
+    throw(vpImageException(vpImageException::ioError, "%s() does not support non contiguous images such as views, "
+                           "see vpImage::isContiguous()", func));
+  }
+}
+}
+
 vpImageIo::vpImageFormatType vpImageIo::getFormat(const std::string &filename)
 {
   std::string ext = vpIoTools::toLowerCase(vpIoTools::getFileExtension(filename));
@@ -115,6 +127,7 @@ vpImageIo::vpImageFormatType vpImageIo::getFormat(const std::string &filename)
  */
 void vpImageIo::read(vpImage<unsigned char> &I, const std::string &filename, int backend)
 {
+  checkContiguous(I, "vpImageIo::read");
   bool exist = vpIoTools::checkFilename(filename);
   if (!exist) {
     const std::string message = "Cannot read file: \"" + std::string(filename) + "\" doesn't exist";
@@ -196,6 +209,7 @@ void vpImageIo::read(vpImage<unsigned char> &I, const std::string &filename, int
  */
 void vpImageIo::read(vpImage<vpRGBa> &I, const std::string &filename, int backend)
 {
+  checkContiguous(I, "vpImageIo::read");
   bool exist = vpIoTools::checkFilename(filename);
   if (!exist) {
     const std::string message = "Cannot read file: \"" + std::string(filename) + "\" doesn't exist";
@@ -265,6 +279,7 @@ void vpImageIo::read(vpImage<vpRGBa> &I, const std::string &filename, int backen
  */
 void vpImageIo::read(vpImage<float> &I, const std::string &filename)
 {
+  checkContiguous(I, "vpImageIo::read");
   bool exist = vpIoTools::checkFilename(filename);
   if (!exist) {
     const std::string message = "Cannot read file: \"" + std::string(filename) + "\" doesn't exist";
@@ -335,6 +350,7 @@ void vpImageIo::read(vpImage<float> &I, const std::string &filename)
 */
 void vpImageIo::write(const vpImage<unsigned char> &I, const std::string &filename, int backend)
 {
+  checkContiguous(I, "vpImageIo::write");
   bool try_opencv_writer = false;
 
   switch (getFormat(filename)) {
@@ -398,6 +414,7 @@ void vpImageIo::write(const vpImage<unsigned char> &I, const std::string &filena
  */
 void vpImageIo::write(const vpImage<vpRGBa> &I, const std::string &filename, int backend)
 {
+  checkContiguous(I, "vpImageIo::write");
   bool try_opencv_writer = false;
 
   switch (getFormat(filename)) {
@@ -449,6 +466,7 @@ void vpImageIo::write(const vpImage<vpRGBa> &I, const std::string &filename, int
 // Default: 1. opencv, 2. system, 3. stb_image
 void vpImageIo::readJPEG(vpImage<unsigned char> &I, const std::string &filename, int backend)
 {
+  checkContiguous(I, "vpImageIo::readJPEG");
   if (backend == IO_SYSTEM_LIB_BACKEND) {
 #if !defined(VISP_HAVE_JPEG)
     // Libjpeg backend is not available to read file \"" + filename + "\": switch to stb_image backend
@@ -536,6 +554,7 @@ void vpImageIo::readJPEG(vpImage<unsigned char> &I, const std::string &filename,
 // Default: 1. opencv, 2. system, 3. stb_image
 void vpImageIo::readJPEG(vpImage<vpRGBa> &I, const std::string &filename, int backend)
 {
+  checkContiguous(I, "vpImageIo::readJPEG");
   if (backend == IO_SYSTEM_LIB_BACKEND) {
 #if !defined(VISP_HAVE_JPEG)
     // Libjpeg backend is not available to read file \"" + filename + "\": switch to stb_image backend";
@@ -621,6 +640,7 @@ void vpImageIo::readJPEG(vpImage<vpRGBa> &I, const std::string &filename, int ba
 // Default: 1. system, 2. opencv, 3. stb_image
 void vpImageIo::readPNG(vpImage<unsigned char> &I, const std::string &filename, int backend)
 {
+  checkContiguous(I, "vpImageIo::readPNG");
   if (backend == IO_SYSTEM_LIB_BACKEND) {
 #if !defined(VISP_HAVE_PNG)
     // Libpng backend is not available to read file \"" + filename + "\": switch to stb_image backend";
@@ -706,6 +726,7 @@ void vpImageIo::readPNG(vpImage<unsigned char> &I, const std::string &filename,
 // Default: 1. opencv, 2. stb_image
 void vpImageIo::readPNG(vpImage<vpRGBa> &I, const std::string &filename, int backend)
 {
+  checkContiguous(I, "vpImageIo::readPNG");
   if (backend == IO_SYSTEM_LIB_BACKEND) {
 #if !defined(VISP_HAVE_PNG)
     // Libpng backend is not available to read file \"" + filename + "\": switch to stb_image backend";
@@ -789,6 +810,7 @@ void vpImageIo::readPNG(vpImage<vpRGBa> &I, const std::string &filename, int bac
  */
 void vpImageIo::readEXR(vpImage<float> &I, const std::string &filename, int backend)
 {
+  checkContiguous(I, "vpImageIo::readEXR");
   if (backend == IO_SYSTEM_LIB_BACKEND || backend == IO_SIMDLIB_BACKEND || backend == IO_STB_IMAGE_BACKEND) {
     // This backend cannot read file \"" + filename + "\": switch to the default TinyEXR backend
     backend = IO_DEFAULT_BACKEND;
@@ -840,6 +862,7 @@ void vpImageIo::readEXR(vpImage<float> &I, const std::string &filename, int back
  */
 void vpImageIo::readEXR(vpImage<vpRGBf> &I, const std::string &filename, int backend)
 {
+  checkContiguous(I, "vpImageIo::readEXR");
   if (backend == IO_SYSTEM_LIB_BACKEND || backend == IO_SIMDLIB_BACKEND || backend == IO_STB_IMAGE_BACKEND) {
     // This backend cannot read file \"" + filename + "\": switch to the default TinyEXR backend
     backend = IO_DEFAULT_BACKEND;
@@ -894,6 +917,7 @@ void vpImageIo::readEXR(vpImage<vpRGBf> &I, const std::string &filename, int bac
 // Default: 1. system, 2. opencv, 3. simd
 void vpImageIo::writeJPEG(const vpImage<unsigned char> &I, const std::string &filename, int backend, int quality)
 {
+  checkContiguous(I, "vpImageIo::writeJPEG");
   if (backend == IO_SYSTEM_LIB_BACKEND) {
 #if !defined(VISP_HAVE_JPEG)
 #if defined(VISP_HAVE_SIMDLIB)
@@ -994,6 +1018,7 @@ void vpImageIo::writeJPEG(const vpImage<unsigned char> &I, const std::string &fi
 // Default: 1. system, 2. opencv, , 3. simd
 void vpImageIo::writeJPEG(const vpImage<vpRGBa> &I, const std::string &filename, int backend, int quality)
 {
+  checkContiguous(I, "vpImageIo::writeJPEG");
   if (backend == IO_SYSTEM_LIB_BACKEND) {
 #if !defined(VISP_HAVE_JPEG)
 #if defined(VISP_HAVE_SIMDLIB)
@@ -1093,6 +1118,7 @@ void vpImageIo::writeJPEG(const vpImage<vpRGBa> &I, const std::string &filename,
 // Default: 1. opencv, 2. simd
 void vpImageIo::writePNG(const vpImage<unsigned char> &I, const std::string &filename, int backend)
 {
+  checkContiguous(I, "vpImageIo::writePNG");
   if (backend == IO_SYSTEM_LIB_BACKEND) {
 #if !defined(VISP_HAVE_PNG)
 #if defined(VISP_HAVE_SIMDLIB)
@@ -1188,6 +1214,7 @@ void vpImageIo::writePNG(const vpImage<unsigned char> &I, const std::string &fil
 // Default: 1. opencv, 2. system, 3. simd
 void vpImageIo::writePNG(const vpImage<vpRGBa> &I, const std::string &filename, int backend)
 {
+  checkContiguous(I, "vpImageIo::writePNG");
   if (backend == IO_SYSTEM_LIB_BACKEND) {
 #if !defined(VISP_HAVE_PNG)
 #if defined(VISP_HAVE_SIMDLIB)
@@ -1281,6 +1308,7 @@ void vpImageIo::writePNG(const vpImage<vpRGBa> &I, const std::string &filename,
  */
 void vpImageIo::writeEXR(const vpImage<float> &I, const std::string &filename, int backend)
 {
+  checkContiguous(I, "vpImageIo::writeEXR");
   if (backend == IO_SYSTEM_LIB_BACKEND || backend == IO_SIMDLIB_BACKEND || backend == IO_STB_IMAGE_BACKEND) {
     // This backend cannot save file \"" + filename + "\": switch to the default TinyEXR backend
     backend = IO_DEFAULT_BACKEND;
@@ -1333,6 +1361,7 @@ void vpImageIo::writeEXR(const vpImage<float> &I, const std::string &filename, i
  */
 void vpImageIo::writeEXR(const vpImage<vpRGBf> &I, const std::string &filename, int backend)
 {
+  checkContiguous(I, "vpImageIo::writeEXR");
   if (backend == IO_SYSTEM_LIB_BACKEND || backend == IO_SIMDLIB_BACKEND || backend == IO_STB_IMAGE_BACKEND) {
     // This backend cannot save file \"" + filename + "\": switch to the default TinyEXR backend
     backend = IO_DEFAULT_BACKEND;
@@ -1379,7 +1408,11 @@ void vpImageIo::writeEXR(const vpImage<vpRGBf> &I, const std::string &filename,
   \param[in] I : Image to save.
   \param[in] filename : Image location.
  */
-void vpImageIo::writePFM(const vpImage<float> &I, const std::string &filename) { vp_writePFM(I, filename); }
+void vpImageIo::writePFM(const vpImage<float> &I, const std::string &filename)
+{
+  checkContiguous(I, "vpImageIo::writePFM");
+  vp_writePFM(I, filename);
+}
 
 /*!
   Save a high-dynamic range (not restricted to the [0-255] intensity range) floating-point image
@@ -1387,7 +1420,11 @@ void vpImageIo::writePFM(const vpImage<float> &I, const std::string &filename) {
   \param[in] I : Grayscale floating-point image to save.
   \param[in] filename : Image location.
  */
-void vpImageIo::writePFM_HDR(const vpImage<float> &I, const std::string &filename) { vp_writePFM_HDR(I, filename); }
+void vpImageIo::writePFM_HDR(const vpImage<float> &I, const std::string &filename)
+{
+  checkContiguous(I, "vpImageIo::writePFM_HDR");
+  vp_writePFM_HDR(I, filename);
+}
 
 /*!
   Save a RGB high-dynamic range (not restricted to the [0-255] intensity range) floating-point image
@@ -1395,91 +1432,143 @@ void vpImageIo::writePFM_HDR(const vpImage<float> &I, const std::string &filenam
   \param[in] I : RGB floating-point image to save.
   \param[in] filename : Image location.
  */
-void vpImageIo::writePFM_HDR(const vpImage<vpRGBf> &I, const std::string &filename) { vp_writePFM_HDR(I, filename); }
+void vpImageIo::writePFM_HDR(const vpImage<vpRGBf> &I, const std::string &filename)
+{
+  checkContiguous(I, "vpImageIo::writePFM_HDR");
+  vp_writePFM_HDR(I, filename);
+}
 
 /*!
   Save an image in portable gray map format.
   \param[in] I : Image to save.
   \param[in] filename : Image location.
  */
-void vpImageIo::writePGM(const vpImage<unsigned char> &I, const std::string &filename) { vp_writePGM(I, filename); }
+void vpImageIo::writePGM(const vpImage<unsigned char> &I, const std::string &filename)
+{
+  checkContiguous(I, "vpImageIo::writePGM");
+  vp_writePGM(I, filename);
+}
 
 /*!
   Save a gray level image in portable gray map format.
   \param[in] I : Image to save.
   \param[in] filename : Image location.
  */
-void vpImageIo::writePGM(const vpImage<short> &I, const std::string &filename) { vp_writePGM(I, filename); }
+void vpImageIo::writePGM(const vpImage<short> &I, const std::string &filename)
+{
+  checkContiguous(I, "vpImageIo::writePGM");
+  vp_writePGM(I, filename);
+}
 
 /*!
   Save a color image in portable gray map format.
   \param[in] I : Image to save.
   \param[in] filename : Image location.
  */
-void vpImageIo::writePGM(const vpImage<vpRGBa> &I, const std::string &filename) { vp_writePGM(I, filename); }
+void vpImageIo::writePGM(const vpImage<vpRGBa> &I, const std::string &filename)
+{
+  checkContiguous(I, "vpImageIo::writePGM");
+  vp_writePGM(I, filename);
+}
 
 /*!
   Load an image in portable float map format.
   \param[out] I : Image read from filename.
   \param[in] filename : Image location.
  */
-void vpImageIo::readPFM(vpImage<float> &I, const std::string &filename) { vp_readPFM(I, filename); }
+void vpImageIo::readPFM(vpImage<float> &I, const std::string &filename)
+{
+  checkContiguous(I, "vpImageIo::readPFM");
+  vp_readPFM(I, filename);
+}
 
 /*!
   Load an image in portable float map format and not restricted to the [0, 255] dynamic range.
   \param[out] I : Image read from filename.
   \param[in] filename : Image location.
  */
-void vpImageIo::readPFM_HDR(vpImage<float> &I, const std::string &filename) { vp_readPFM_HDR(I, filename); }
+void vpImageIo::readPFM_HDR(vpImage<float> &I, const std::string &filename)
+{
+  checkContiguous(I, "vpImageIo::readPFM_HDR");
+  vp_readPFM_HDR(I, filename);
+}
 
 /*!
   Load an image in portable float map format and not restricted to the [0, 255] dynamic range.
   \param[out] I : Image read from filename and with three channels.
   \param[in] filename : Image location.
  */
-void vpImageIo::readPFM_HDR(vpImage<vpRGBf> &I, const std::string &filename) { vp_readPFM_HDR(I, filename); }
+void vpImageIo::readPFM_HDR(vpImage<vpRGBf> &I, const std::string &filename)
+{
+  checkContiguous(I, "vpImageIo::readPFM_HDR");
+  vp_readPFM_HDR(I, filename);
+}
 
 /*!
   Load an image in portable gray map format. If the image is in color, it is converted in gray level.
   \param[out] I : Image read from filename.
   \param[in] filename : Image location.
  */
-void vpImageIo::readPGM(vpImage<unsigned char> &I, const std::string &filename) { vp_readPGM(I, filename); }
+void vpImageIo::readPGM(vpImage<unsigned char> &I, const std::string &filename)
+{
+  checkContiguous(I, "vpImageIo::readPGM");
+  vp_readPGM(I, filename);
+}
 
 /*!
   Load an image in portable float map format. If the image is in gray, it is converted in color.
   \param[out] I : Image read from filename.
   \param[in] filename : Image location.
  */
-void vpImageIo::readPGM(vpImage<vpRGBa> &I, const std::string &filename) { vp_readPGM(I, filename); }
+void vpImageIo::readPGM(vpImage<vpRGBa> &I, const std::string &filename)
+{
+  checkContiguous(I, "vpImageIo::readPGM");
+  vp_readPGM(I, filename);
+}
 
 /*!
   Load an image in portable pixmap format. If the image is in color, it is converted in gray level.
   \param[out] I : Image read from filename.
   \param[in] filename : Image location.
  */
-void vpImageIo::readPPM(vpImage<unsigned char> &I, const std::string &filename) { vp_readPPM(I, filename); }
+void vpImageIo::readPPM(vpImage<unsigned char> &I, const std::string &filename)
+{
+  checkContiguous(I, "vpImageIo::readPPM");
+  vp_readPPM(I, filename);
+}
 
 /*!
   Load an image in portable pixmap format. If the image is in gray, it is converted in color.
   \param[out] I : Image read from filename.
   \param[in] filename : Image location.
  */
-void vpImageIo::readPPM(vpImage<vpRGBa> &I, const std::string &filename) { vp_readPPM(I, filename); }
+void vpImageIo::readPPM(vpImage<vpRGBa> &I, const std::string &filename)
+{
+  checkContiguous(I, "vpImageIo::readPPM");
+  vp_readPPM(I, filename);
+}
 
 /*!
   Save a gray level image in portable pixmap format.
   \param[in] I : Image to save.
   \param[in] filename : Image location.
  */
-void vpImageIo::writePPM(const vpImage<unsigned char> &I, const std::string &filename) { vp_writePPM(I, filename); }
+void vpImageIo::writePPM(const vpImage<unsigned char> &I, const std::string &filename)
+{
+  checkContiguous(I, "vpImageIo::writePPM");
+  vp_writePPM(I, filename);
+}
 
 /*!
   Save a color level image in portable pixmap format.
   \param[in] I : Image to save.
   \param[in] filename : Image location.
  */
-void vpImageIo::writePPM(const vpImage<vpRGBa> &I, const std::string &filename) { vp_writePPM(I, filename); }
+void vpImageIo::writePPM(const vpImage<vpRGBa> &I, const std::string &filename)
+{
+  checkContiguous(I, "vpImageIo::writePPM");
+  vp_writePPM(I, filename);
+}
 
 /*!
   Read the content of the grayscale image bitmap stored in memory and encoded using the PNG format.
@@ -1490,6 +1579,7 @@ void vpImageIo::writePPM(const vpImage<vpRGBa> &I, const std::string &filename)
  */
 void vpImageIo::readPNGfromMem(const std::vector<unsigned char> &buffer, vpImage<unsigned char> &I, int backend)
 {
+  checkContiguous(I, "vpImageIo::readPNGfromMem");
   if (backend == IO_SYSTEM_LIB_BACKEND || backend == IO_SIMDLIB_BACKEND) {
     backend = IO_STB_IMAGE_BACKEND;
   }
@@ -1548,6 +1638,7 @@ void vpImageIo::readPNGfromMem(const std::vector<unsigned char> &buffer, vpImage
  */
 void vpImageIo::readPNGfromMem(const std::vector<unsigned char> &buffer, vpImage<vpRGBa> &I, int backend)
 {
+  checkContiguous(I, "vpImageIo::readPNGfromMem");
   if (backend == IO_SYSTEM_LIB_BACKEND || backend == IO_SIMDLIB_BACKEND) {
     backend = IO_STB_IMAGE_BACKEND;
   }
@@ -1607,6 +1698,7 @@ void vpImageIo::readPNGfromMem(const std::vector<unsigned char> &buffer, vpImage
 */
 void vpImageIo::writePNGtoMem(const vpImage<unsigned char> &I, std::vector<unsigned char> &buffer, int backend)
 {
+  checkContiguous(I, "vpImageIo::writePNGtoMem");
   if (backend == IO_SYSTEM_LIB_BACKEND || backend == IO_SIMDLIB_BACKEND) {
     backend = IO_STB_IMAGE_BACKEND;
   }
@@ -1671,6 +1763,7 @@ void vpImageIo::writePNGtoMem(const vpImage<unsigned char> &I, std::vector<unsig
 */
 void vpImageIo::writePNGtoMem(const vpImage<vpRGBa> &I, std::vector<unsigned char> &buffer, int backend, bool saveAlpha)
 {
+  checkContiguous(I, "vpImageIo::writePNGtoMem");
   if (backend == IO_SYSTEM_LIB_BACKEND || backend == IO_SIMDLIB_BACKEND) {
     backend = IO_STB_IMAGE_BACKEND;
   }
@@ -0,0 +1,332 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2025 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ * Description:
+ * Read/write batches of images.
+ */
+
+/*!
+  \file vpImageIoBatch.cpp
+  \brief Read/write batches of images in parallel
+*/
+
+#include <visp3/core/vpTime.h>
+#include <visp3/io/vpImageIo.h>
+
+#include <algorithm>
+#include <exception>
+#include <string>
+#include <vector>
+
+#if defined(VISP_HAVE_THREADS)
+#include <atomic>
+#include <thread>
+#endif
+
+#ifdef ENABLE_VISP_NAMESPACE
+using namespace VISP_NAMESPACE_NAME;
+#endif
+
+namespace
+{
+/*!
+  Run `process(i)` for each item of a batch on a pool of threads. A failure on an item does not prevent the other
+  items from being processed: an exception describing the first failed item is thrown once the whole batch is done.
+
+  \param[in] nbItems : Number of items in the batch.
+  \param[in] nbThreads : Number of threads. When 0, the number of CPU cores is used.
+  \param[out] durations : If not null, time in ms spent to process each item.
+  \param[in] process : Function processing one item.
+  \param[in] what : Description of the processing used in the error message.
+*/
+template <typename Function>
+void runBatch(size_t nbItems, unsigned int nbThreads, std::vector<double> *durations, const Function &process,
+              const char *what)
+{
+  std::vector<double> times(nbItems, 0.);
+  std::vector<std::string> errors(nbItems);
+
+  auto processItem = [&](size_t i) {
+    double t = vpTime::measureTimeMs();
+    try {
+      process(i);
+    }
+    catch (const vpException &e) {
+      errors[i] = e.getStringMessage();
+    }
+    catch (const std::exception &e) {
+      errors[i] = e.what();
+    }
+    catch (...) {
+      errors[i] = "unknown error";
+    }
+    times[i] = vpTime::measureTimeMs() - t;
+    };
+
+#if defined(VISP_HAVE_THREADS)
+  if (nbThreads == 0) {
+    nbThreads = std::max<unsigned int>(1, std::thread::hardware_concurrency());
+  }
+  nbThreads = static_cast<unsigned int>(std::min<size_t>(nbThreads, nbItems));
+
+  if (nbThreads > 1) {
+    // Items are dispatched one at a time since their processing time may be very different
+    std::atomic<size_t> nextItem(0);
+    auto worker = [&]() {
+      for (size_t i = nextItem++; i < nbItems; i = nextItem++) {
+        processItem(i);
+      }
+      };
+    std::vector<std::thread> threadpool;
+    for (unsigned int i = 1; i < nbThreads; ++i) {
+      threadpool.emplace_back(worker);
+    }
+    worker();
+    for (auto &th : threadpool) {
+      th.join();
+    }
+  }
+  else
+#else
+  (void)nbThreads;
+#endif
+  {
+    for (size_t i = 0; i < nbItems; ++i) {
+      processItem(i);
+    }
+  }
+
+  if (durations != nullptr) {
+    *durations = times;
+  }
+
+  unsigned int nbErrors = 0;
+  size_t firstError = nbItems;
+  for (size_t i = 0; i < nbItems; ++i) {
+    if (!errors[i].empty()) {
+      ++nbErrors;
+      firstError = std::min<size_t>(firstError, i);
+    }
+  }
+  if (nbErrors > 0) {
+    throw(vpImageException(vpImageException::ioError, "Cannot %s %u image(s) out of %u, image %u: %s", what, nbErrors,
+                           static_cast<unsigned int>(nbItems), static_cast<unsigned int>(firstError),
+                           errors[firstError].c_str()));
+  }
+}
+
+void checkBatchSize(size_t nbImages, size_t nbNames)
+{
+  if (nbImages != nbNames) {
+    throw(vpException(vpException::dimensionError, "Cannot process a batch of %u images with %u file names",
+                      static_cast<unsigned int>(nbImages), static_cast<unsigned int>(nbNames)));
+  }
+}
+
+template <typename Type>
+void readImages(std::vector<vpImage<Type> > &I, const std::vector<std::string> &filenames,
+                std::vector<double> *durations, int backend, unsigned int nbThreads)
+{
+  I.resize(filenames.size());
+  runBatch(filenames.size(), nbThreads, durations,
+           [&](size_t i) { vpImageIo::read(I[i], filenames[i], backend); }, "read");
+}
+
+template <typename Type>
+void writeImages(const std::vector<vpImage<Type> > &I, const std::vector<std::string> &filenames,
+                 std::vector<double> *durations, int backend, unsigned int nbThreads)
+{
+  checkBatchSize(I.size(), filenames.size());
+  runBatch(I.size(), nbThreads, durations, [&](size_t i) { vpImageIo::write(I[i], filenames[i], backend); },
+           "write");
+}
+
+template <typename Type>
+void readImagesFromMem(const std::vector<std::vector<unsigned char> > &buffers, std::vector<vpImage<Type> > &I,
+                       std::vector<double> *durations, int backend, unsigned int nbThreads)
+{
+  I.resize(buffers.size());
+  runBatch(buffers.size(), nbThreads, durations,
+           [&](size_t i) { vpImageIo::readPNGfromMem(buffers[i], I[i], backend); }, "decode");
+}
+
+template <typename Type>
+void writeImagesToMem(const std::vector<vpImage<Type> > &I, std::vector<std::vector<unsigned char> > &buffers,
+                      std::vector<double> *durations, int backend, unsigned int nbThreads)
+{
+  buffers.resize(I.size());
+  runBatch(I.size(), nbThreads, durations, [&](size_t i) { vpImageIo::writePNGtoMem(I[i], buffers[i], backend); },
+           "encode");
+}
+}
+
+/*!
+  Read a batch of images, the images being loaded and decoded in parallel.
+
+  \param[out] I : Images read from the files. The vector is resized to the number of files.
+  \param[in] filenames : Location of each image.
+  \param[out] durations : If not null, time in ms spent to read each image.
+  \param[in] backend : Library backend type (see vpImageIo::vpImageIoBackendType) used for each image, see read().
+  \param[in] nbThreads : Number of threads used to read the images. When 0, the number of CPU cores is used.
+
+  \exception vpImageException::ioError : When at least one image cannot be read. The other images are read anyway.
+ */
+void vpImageIo::readBatch(std::vector<vpImage<unsigned char> > &I, const std::vector<std::string> &filenames,
+                          std::vector<double> *durations, int backend, unsigned int nbThreads)
+{
+  readImages(I, filenames, durations, backend, nbThreads);
+}
+
+/*!
+  Read a batch of color images, the images being loaded and decoded in parallel.
+
+  \param[out] I : Images read from the files. The vector is resized to the number of files.
+  \param[in] filenames : Location of each image.
+  \param[out] durations : If not null, time in ms spent to read each image.
+  \param[in] backend : Library backend type (see vpImageIo::vpImageIoBackendType) used for each image, see read().
+  \param[in] nbThreads : Number of threads used to read the images. When 0, the number of CPU cores is used.
+
+  \exception vpImageException::ioError : When at least one image cannot be read. The other images are read anyway.
+ */
+void vpImageIo::readBatch(std::vector<vpImage<vpRGBa> > &I, const std::vector<std::string> &filenames,
+                          std::vector<double> *durations, int backend, unsigned int nbThreads)
+{
+  readImages(I, filenames, durations, backend, nbThreads);
+}
+
+/*!
+  Write a batch of images, the images being encoded and saved in parallel.
+
+  \param[in] I : Images to save.
+  \param[in] filenames : Location of each image.
+  \param[out] durations : If not null, time in ms spent to write each image.
+  \param[in] backend : Library backend type (see vpImageIo::vpImageIoBackendType) used for each image, see write().
+  \param[in] nbThreads : Number of threads used to write the images. When 0, the number of CPU cores is used.
+
+  \exception vpException::dimensionError : When the number of images and file names differ.
+  \exception vpImageException::ioError : When at least one image cannot be written. The other images are written
+  anyway.
+ */
+void vpImageIo::writeBatch(const std::vector<vpImage<unsigned char> > &I, const std::vector<std::string> &filenames,
+                           std::vector<double> *durations, int backend, unsigned int nbThreads)
+{
+  writeImages(I, filenames, durations, backend, nbThreads);
+}
+
+/*!
+  Write a batch of color images, the images being encoded and saved in parallel.
+
+  \param[in] I : Images to save.
+  \param[in] filenames : Location of each image.
+  \param[out] durations : If not null, time in ms spent to write each image.
+  \param[in] backend : Library backend type (see vpImageIo::vpImageIoBackendType) used for each image, see write().
+  \param[in] nbThreads : Number of threads used to write the images. When 0, the number of CPU cores is used.
+
+  \exception vpException::dimensionError : When the number of images and file names differ.
+  \exception vpImageException::ioError : When at least one image cannot be written. The other images are written
+  anyway.
+ */
+void vpImageIo::writeBatch(const std::vector<vpImage<vpRGBa> > &I, const std::vector<std::string> &filenames,
+                           std::vector<double> *durations, int backend, unsigned int nbThreads)
+{
+  writeImages(I, filenames, durations, backend, nbThreads);
+}
+
+/*!
+  Decode in parallel a batch of grayscale images stored in memory and encoded using the PNG format.
+
+  \param[in] buffers : Image buffers encoded in PNG.
+  \param[out] I : Decoded images. The vector is resized to the number of buffers.
+  \param[out] durations : If not null, time in ms spent to decode each image.
+  \param[in] backend : Library backend type, see readPNGfromMem().
+  \param[in] nbThreads : Number of threads used to decode the images. When 0, the number of CPU cores is used.
+
+  \exception vpImageException::ioError : When at least one image cannot be decoded.
+ */
+void vpImageIo::readPNGfromMemBatch(const std::vector<std::vector<unsigned char> > &buffers,
+                                    std::vector<vpImage<unsigned char> > &I, std::vector<double> *durations,
+                                    int backend, unsigned int nbThreads)
+{
+  readImagesFromMem(buffers, I, durations, backend, nbThreads);
+}
+
+/*!
+  Decode in parallel a batch of color images stored in memory and encoded using the PNG format.
+
+  \param[in] buffers : Image buffers encoded in PNG.
+  \param[out] I : Decoded images. The vector is resized to the number of buffers.
+  \param[out] durations : If not null, time in ms spent to decode each image.
+  \param[in] backend : Library backend type, see readPNGfromMem().
+  \param[in] nbThreads : Number of threads used to decode the images. When 0, the number of CPU cores is used.
+
+  \exception vpImageException::ioError : When at least one image cannot be decoded.
+ */
+void vpImageIo::readPNGfromMemBatch(const std::vector<std::vector<unsigned char> > &buffers,
+                                    std::vector<vpImage<vpRGBa> > &I, std::vector<double> *durations, int backend,
+                                    unsigned int nbThreads)
+{
+  readImagesFromMem(buffers, I, durations, backend, nbThreads);
+}
+
+/*!
+  Encode in parallel a batch of grayscale images in PNG format, in memory.
+
+  \param[in] I : Images to encode.
+  \param[out] buffers : Encoded images. The vector is resized to the number of images.
+  \param[out] durations : If not null, time in ms spent to encode each image.
+  \param[in] backend : Library backend type, see writePNGtoMem().
+  \param[in] nbThreads : Number of threads used to encode the images. When 0, the number of CPU cores is used.
+
+  \exception vpImageException::ioError : When at least one image cannot be encoded.
+ */
+void vpImageIo::writePNGtoMemBatch(const std::vector<vpImage<unsigned char> > &I,
+                                   std::vector<std::vector<unsigned char> > &buffers, std::vector<double> *durations,
+                                   int backend, unsigned int nbThreads)
+{
+  writeImagesToMem(I, buffers, durations, backend, nbThreads);
+}
+
+/*!
+  Encode in parallel a batch of color images in PNG format, in memory. The alpha channel is not saved.
+
+  \param[in] I : Images to encode.
+  \param[out] buffers : Encoded images. The vector is resized to the number of images.
+  \param[out] durations : If not null, time in ms spent to encode each image.
+  \param[in] backend : Library backend type, see writePNGtoMem().
+  \param[in] nbThreads : Number of threads used to encode the images. When 0, the number of CPU cores is used.
+
+  \exception vpImageException::ioError : When at least one image cannot be encoded.
+ */
+void vpImageIo::writePNGtoMemBatch(const std::vector<vpImage<vpRGBa> > &I,
+                                   std::vector<std::vector<unsigned char> > &buffers, std::vector<double> *durations,
+                                   int backend, unsigned int nbThreads)
+{
+  writeImagesToMem(I, buffers, durations, backend, nbThreads);
+}
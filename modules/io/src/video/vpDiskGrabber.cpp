@@ -187,7 +187,8 @@ void vpDiskGrabber::acquire(vpImage<float> &I)
 
   if (extension.find("npy") != std::string::npos) {
 #if defined (VISP_HAVE_MINIZ) && (VISP_CXX_STANDARD > VISP_CXX_STANDARD_98) && defined(VISP_HAVE_WORKING_REGEX)
-    visp::cnpy::NpyArray array = visp::cnpy::npy_load(m_image_name);
+    // The pixels are copied once from the mapped file into the image
+    visp::cnpy::NpyArray array = visp::cnpy::npy_mmap(m_image_name);
     float *data = array.data<float>();
     I.init(data, static_cast<unsigned int>(array.shape[0]), static_cast<unsigned int>(array.shape[1]), true);
 #else
@@ -37,14 +37,216 @@
  */
 
 #include <visp3/core/vpIoTools.h>
+#include <visp3/io/vpImageIo.h>
 #include <visp3/io/vpVideoReader.h>
 
+#include <algorithm>
 #include <cctype>
 #include <fstream>
 #include <iostream>
 
+#if defined(VISP_HAVE_THREADS)
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
 BEGIN_VISP_NAMESPACE
 
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#if defined(VISP_HAVE_THREADS)
+/*!
+ * Ring of frames of an image sequence decoded ahead by background threads.
+ *
+ * The ring contains the frames `index + k * step`, with `k` in `[0, size-1]`, where `index` is the last requested
+ * frame. Each request slides the ring: the frames that are not in the ring anymore are released and the threads
+ * start decoding the new ones.
+ */
+class vpVideoReader::vpFramePrefetcher
+{
+public:
+  vpFramePrefetcher(const std::string &genericName, unsigned int size, unsigned int nbThreads)
+    : m_genericName(genericName), m_size(size), m_mutex(), m_cond(), m_slots(), m_threads(), m_stop(false),
+    m_active(false), m_color(false), m_generation(0), m_index(0), m_step(1), m_first(0), m_last(0)
+  {
+    for (unsigned int i = 0; i < nbThreads; ++i) {
+      m_threads.push_back(std::thread(&vpFramePrefetcher::run, this));
+    }
+  }
+
+  ~vpFramePrefetcher()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_cond.notify_all();
+    for (size_t i = 0; i < m_threads.size(); ++i) {
+      m_threads[i].join();
+    }
+  }
+
+  /*!
+   * Get a frame of the sequence, waiting for its decoding if needed, and slide the ring so that it starts at
+   * this frame.
+   *
+   * \return false if the frame could not be read, in that case `I` is left unchanged.
+   */
+  template <typename Type> bool get(long index, long step, long first, long last, vpImage<Type> &I)
+  {
+    const bool color = isColor(I);
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if ((!m_active) || (color != m_color) || (step != m_step) || (first != m_first) || (last != m_last)) {
+      // The frames being decoded with the previous settings are discarded
+      ++m_generation;
+      m_slots.clear();
+      m_active = true;
+      m_color = color;
+      m_step = step;
+      m_first = first;
+      m_last = last;
+    }
+    m_index = index;
+    std::map<long, vpSlot>::iterator it = m_slots.begin();
+    while (it != m_slots.end()) {
+      if (isInRing(it->first)) {
+        ++it;
+      }
+      else {
+        m_slots.erase(it++);
+      }
+    }
+    m_cond.notify_all();
+
+    if ((index < first) || (index > last)) {
+      // Frames out of the sequence range are never prefetched
+      lock.unlock();
+      return read(vpIoTools::formatString(m_genericName, static_cast<unsigned int>(index)), I);
+    }
+
+    while (((it = m_slots.find(index)) == m_slots.end()) || (it->second.m_state == DECODING)) {
+      m_cond.wait(lock);
+    }
+    if (it->second.m_state == FAILED) {
+      return false;
+    }
+    I = image(it->second, I);
+    return true;
+  }
+
+private:
+  typedef enum { DECODING, READY, FAILED } vpSlotState;
+
+  struct vpSlot
+  {
+    vpSlot() : m_state(DECODING), m_I(), m_Irgba() { }
+
+    vpSlotState m_state;
+    vpImage<unsigned char> m_I;
+    vpImage<vpRGBa> m_Irgba;
+  };
+
+  static bool isColor(const vpImage<unsigned char> &) { return false; }
+  static bool isColor(const vpImage<vpRGBa> &) { return true; }
+  static const vpImage<unsigned char> &image(const vpSlot &slot, const vpImage<unsigned char> &) { return slot.m_I; }
+  static const vpImage<vpRGBa> &image(const vpSlot &slot, const vpImage<vpRGBa> &) { return slot.m_Irgba; }
+
+  template <typename Type> static bool read(const std::string &filename, vpImage<Type> &I)
+  {
+    try {
+      vpImageIo::read(I, filename);
+    }
+    catch (...) {
+      return false;
+    }
+    return true;
+  }
+
+  bool isInRing(long index) const
+  {
+    long offset = index - m_index;
+    if (m_step == 0) {
+      return offset == 0;
+    }
+    return ((offset % m_step) == 0) && ((offset / m_step) >= 0) && ((offset / m_step) < static_cast<long>(m_size));
+  }
+
+  // Next frame of the ring that is neither decoded nor being decoded
+  bool nextFrameToDecode(long &index) const
+  {
+    if (!m_active) {
+      return false;
+    }
+    const unsigned int size = (m_step == 0) ? 1 : m_size;
+    for (unsigned int k = 0; k < size; ++k) {
+      long frame = m_index + (static_cast<long>(k) * m_step);
+      if ((frame < m_first) || (frame > m_last)) {
+        return false;
+      }
+      if (m_slots.find(frame) == m_slots.end()) {
+        index = frame;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void run()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+      long index = 0;
+      while ((!m_stop) && (!nextFrameToDecode(index))) {
+        m_cond.wait(lock);
+      }
+      if (m_stop) {
+        return;
+      }
+      m_slots[index] = vpSlot();
+      const bool color = m_color;
+      const unsigned int generation = m_generation;
+      lock.unlock();
+
+      // Decoding is done without holding the lock
+      vpSlot slot;
+      const std::string filename = vpIoTools::formatString(m_genericName, static_cast<unsigned int>(index));
+      bool success = color ? read(filename, slot.m_Irgba) : read(filename, slot.m_I);
+      slot.m_state = success ? READY : FAILED;
+
+      lock.lock();
+      std::map<long, vpSlot>::iterator it = m_slots.find(index);
+      if ((generation == m_generation) && (it != m_slots.end()) && (it->second.m_state == DECODING)) {
+        std::swap(it->second.m_state, slot.m_state);
+        swap(it->second.m_I, slot.m_I);
+        swap(it->second.m_Irgba, slot.m_Irgba);
+      }
+      m_cond.notify_all();
+    }
+  }
+
+  std::string m_genericName;
+  unsigned int m_size;
+  std::mutex m_mutex;
+  std::condition_variable m_cond;
+  std::map<long, vpSlot> m_slots;
+  std::vector<std::thread> m_threads;
+  bool m_stop;
+  bool m_active;
+  bool m_color;
+  unsigned int m_generation;
+  long m_index;
+  long m_step;
+  long m_first;
+  long m_last;
+};
+#else
+class vpVideoReader::vpFramePrefetcher
+{ };
+#endif
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
 /*!
  * Basic constructor.
  */
@@ -57,13 +259,13 @@ BEGIN_VISP_NAMESPACE
 #endif
   m_formatType(FORMAT_UNKNOWN), m_videoName(), m_frameName(), m_initFileName(false), m_isOpen(false), m_frameCount(0),
   m_firstFrame(0), m_lastFrame(0), m_firstFrameIndexIsSet(false), m_lastFrameIndexIsSet(false), m_frameStep(1),
-  m_frameRate(0.)
+  m_frameRate(0.), m_prefetcher(nullptr), m_prefetchSize(0), m_prefetchNbThreads(0)
 { }
 
 /*!
  * Copy constructor.
  */
-vpVideoReader::vpVideoReader(const vpVideoReader &reader) : vpFrameGrabber(reader)
+vpVideoReader::vpVideoReader(const vpVideoReader &reader) : vpFrameGrabber(reader), m_prefetcher(nullptr)
 {
   *this = reader;
 }
@@ -73,6 +275,7 @@ vpVideoReader::vpVideoReader(const vpVideoReader &reader) : vpFrameGrabber(reade
  */
 vpVideoReader::~vpVideoReader()
 {
+  stopPrefetch();
   if (m_imSequence != nullptr) {
     delete m_imSequence;
   }
@@ -103,6 +306,10 @@ vpVideoReader &vpVideoReader::operator=(const vpVideoReader &reader)
   m_lastFrameIndexIsSet = reader.m_lastFrameIndexIsSet;
   m_frameStep = reader.m_frameStep;
   m_frameRate = reader.m_frameRate;
+  // The decoded frames are not shared, the prefetching restarts at the next acquisition
+  stopPrefetch();
+  m_prefetchSize = reader.m_prefetchSize;
+  m_prefetchNbThreads = reader.m_prefetchNbThreads;
   return *this;
 }
 
@@ -126,6 +333,7 @@ void vpVideoReader::setFileName(const std::string &filename)
     throw(vpImageException(vpImageException::noFileNameError, "filename empty "));
   }
 
+  stopPrefetch();
   m_videoName = filename;
   m_frameName = filename;
 
@@ -288,7 +496,11 @@ void vpVideoReader::acquire(vpImage<vpRGBa> &I)
   if (!m_isOpen) {
     open(I);
   }
-  if (m_imSequence != nullptr) {
+  startPrefetch();
+  if (m_prefetcher != nullptr) {
+    acquirePrefetched(I);
+  }
+  else if (m_imSequence != nullptr) {
     m_imSequence->setStep(m_frameStep);
     bool skip_frame = false;
     do {
@@ -385,7 +597,11 @@ void vpVideoReader::acquire(vpImage<unsigned char> &I)
     open(I);
   }
 
-  if (m_imSequence != nullptr) {
+  startPrefetch();
+  if (m_prefetcher != nullptr) {
+    acquirePrefetched(I);
+  }
+  else if (m_imSequence != nullptr) {
     m_imSequence->setStep(m_frameStep);
     bool skip_frame = false;
     do {
@@ -479,7 +695,11 @@ void vpVideoReader::acquire(vpImage<unsigned char> &I)
 */
 bool vpVideoReader::getFrame(vpImage<vpRGBa> &I, long frame_index)
 {
-  if (m_imSequence != nullptr) {
+  startPrefetch();
+  if (m_prefetcher != nullptr) {
+    return getPrefetchedFrame(I, frame_index);
+  }
+  else if (m_imSequence != nullptr) {
     try {
       m_imSequence->acquire(I, frame_index);
       width = I.getWidth();
@@ -558,7 +778,11 @@ bool vpVideoReader::getFrame(vpImage<vpRGBa> &I, long frame_index)
 */
 bool vpVideoReader::getFrame(vpImage<unsigned char> &I, long frame_index)
 {
-  if (m_imSequence != nullptr) {
+  startPrefetch();
+  if (m_prefetcher != nullptr) {
+    return getPrefetchedFrame(I, frame_index);
+  }
+  else if (m_imSequence != nullptr) {
     try {
       m_imSequence->acquire(I, frame_index);
       width = I.getWidth();
@@ -626,6 +850,112 @@ bool vpVideoReader::getFrame(vpImage<unsigned char> &I, long frame_index)
   return true;
 }
 
+/*!
+  Enable the decoding of the next frames of a sequence of images by background threads. While the current frame is
+  processed, up to `nbFrames` frames following it are loaded and decoded, so that acquire() and getFrame() only
+  have to copy them when they are requested. Replaying a sequence of PNG or JPEG images is then no longer limited by
+  the decoding time of a single core.
+
+  The decoded frames are taken from the frames `k`, `k + step`, ..., `k + (nbFrames-1) * step` where `k` is the
+  frame that was last requested and `step` the value set with setFrameStep(). Requesting a frame outside of these
+  frames with getFrame() restarts the prefetching from this frame.
+
+  \param[in] nbFrames : Number of frames decoded ahead. 0 disables the prefetching, which is the default.
+  \param[in] nbThreads : Number of decoding threads. When 0, the number of CPU cores is used.
+
+  \note Prefetching only applies to sequences of images and requires ViSP to be built with threads support. Video
+  files are still decoded when the frames are acquired.
+
+  \sa getPrefetch()
+*/
+void vpVideoReader::setPrefetch(unsigned int nbFrames, unsigned int nbThreads)
+{
+  stopPrefetch();
+  m_prefetchSize = nbFrames;
+  m_prefetchNbThreads = nbThreads;
+}
+
+/*!
+  Start the decoding threads if prefetching is enabled and the reader is opened on a sequence of images.
+*/
+void vpVideoReader::startPrefetch()
+{
+#if defined(VISP_HAVE_THREADS)
+  if ((m_prefetcher == nullptr) && (m_prefetchSize > 0) && (m_imSequence != nullptr)) {
+    unsigned int nbThreads = m_prefetchNbThreads;
+    if (nbThreads == 0) {
+      nbThreads = std::max<unsigned int>(1, std::thread::hardware_concurrency());
+    }
+    nbThreads = std::min<unsigned int>(nbThreads, m_prefetchSize);
+    m_prefetcher = new vpFramePrefetcher(m_videoName, m_prefetchSize, nbThreads);
+  }
+#endif
+}
+
+/*!
+  Stop the decoding threads and release the decoded frames.
+*/
+void vpVideoReader::stopPrefetch()
+{
+  if (m_prefetcher != nullptr) {
+    delete m_prefetcher;
+    m_prefetcher = nullptr;
+  }
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+/*!
+  Same as acquire() for a sequence of images, the frame being taken from the prefetched frames.
+*/
+template <typename Type> void vpVideoReader::acquirePrefetched(vpImage<Type> &I)
+{
+#if defined(VISP_HAVE_THREADS)
+  m_imSequence->setStep(m_frameStep);
+  long next_frame = m_imSequence->getNextImageNumber();
+  bool skip_frame = false;
+  do {
+    m_frameCount = next_frame;
+    next_frame += m_frameStep;
+    skip_frame = !m_prefetcher->get(m_frameCount, m_frameStep, m_firstFrame, m_lastFrame, I);
+  } while (skip_frame && (m_frameCount < m_lastFrame));
+  m_frameName = vpIoTools::formatString(m_videoName, static_cast<unsigned int>(m_frameCount));
+
+  // Position the grabber on the next image, as vpDiskGrabber::acquire() does
+  if ((m_frameCount + m_frameStep > m_lastFrame) || (m_frameCount + m_frameStep < m_firstFrame)) {
+    m_imSequence->setImageNumber(m_frameCount);
+  }
+  else {
+    m_imSequence->setImageNumber(m_frameCount + m_frameStep);
+  }
+#else
+  (void)I;
+#endif
+}
+
+/*!
+  Same as getFrame() for a sequence of images, the frame being taken from the prefetched frames.
+*/
+template <typename Type> bool vpVideoReader::getPrefetchedFrame(vpImage<Type> &I, long frame_index)
+{
+#if defined(VISP_HAVE_THREADS)
+  if (!m_prefetcher->get(frame_index, m_frameStep, m_firstFrame, m_lastFrame, I)) {
+    // As vpDiskGrabber::acquire(), the next image is the one following the requested image
+    m_imSequence->setImageNumber(frame_index + m_frameStep);
+    return false;
+  }
+  width = I.getWidth();
+  height = I.getHeight();
+  m_frameCount = frame_index;
+  m_imSequence->setImageNumber(m_frameCount); // to not increment vpDiskGrabber next image
+  return true;
+#else
+  (void)I;
+  (void)frame_index;
+  return false;
+#endif
+}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
 /*!
   Gets the format of the file(s) which has/have to be read.
 
@@ -36,6 +36,8 @@
   \brief Write image sequences.
 */
 
+#include <iostream>
+
 #include <visp3/core/vpIoTools.h>
 #include <visp3/io/vpVideoWriter.h>
 
@@ -43,8 +45,171 @@
 #include <opencv2/imgproc/imgproc.hpp>
 #endif
 
+#if defined(VISP_HAVE_THREADS)
+#include <condition_variable>
+#include <deque>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
 BEGIN_VISP_NAMESPACE
 
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#if defined(VISP_HAVE_THREADS)
+/*!
+ * Queue of frames written by a background thread. The frames queued while a batch is written form the next
+ * batch, which is encoded in parallel with vpImageIo::writeBatch().
+ */
+class vpVideoWriter::vpFrameSaver
+{
+public:
+  vpFrameSaver(unsigned int nbThreads, unsigned int maxPending)
+    : m_nbThreads(nbThreads), m_mutex(), m_cond(), m_I(), m_names(), m_Irgba(), m_namesRgba(), m_maxPending(maxPending),
+    m_nbPending(0), m_error(), m_stop(false), m_thread()
+  {
+    m_thread = std::thread(&vpFrameSaver::run, this);
+  }
+
+  //! Write the pending frames and stop the background thread.
+  ~vpFrameSaver()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_cond.notify_all();
+    m_thread.join();
+  }
+
+  unsigned int getNbPending() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_nbPending;
+  }
+
+  void setMaxPending(unsigned int maxPending)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_maxPending = maxPending;
+    m_cond.notify_all();
+  }
+
+  //! Queue a copy of the frame, waiting first while the maximum number of frames are pending.
+  void push(const vpImage<unsigned char> &I, const std::string &filename)
+  {
+    // Copy before locking so that the background thread can take the queued frames meanwhile
+    vpImage<unsigned char> I_copy(I);
+    std::unique_lock<std::mutex> lock(m_mutex);
+    waitSlot(lock);
+    m_I.push_back(std::move(I_copy));
+    m_names.push_back(filename);
+    ++m_nbPending;
+    m_cond.notify_all();
+  }
+
+  //! Queue a copy of the frame, waiting first while the maximum number of frames are pending.
+  void push(const vpImage<vpRGBa> &I, const std::string &filename)
+  {
+    vpImage<vpRGBa> I_copy(I);
+    std::unique_lock<std::mutex> lock(m_mutex);
+    waitSlot(lock);
+    m_Irgba.push_back(std::move(I_copy));
+    m_namesRgba.push_back(filename);
+    ++m_nbPending;
+    m_cond.notify_all();
+  }
+
+  //! Wait until all the frames are written and throw an exception if a frame could not be written.
+  void wait()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (m_nbPending > 0) {
+      m_cond.wait(lock);
+    }
+    if (!m_error.empty()) {
+      std::string error;
+      std::swap(error, m_error);
+      throw(vpImageException(vpImageException::ioError, error));
+    }
+  }
+
+private:
+  void waitSlot(std::unique_lock<std::mutex> &lock)
+  {
+    while ((m_maxPending > 0) && (m_nbPending >= m_maxPending)) {
+      m_cond.wait(lock);
+    }
+  }
+
+  void run()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+      while ((!m_stop) && m_names.empty() && m_namesRgba.empty()) {
+        m_cond.wait(lock);
+      }
+      if (m_names.empty() && m_namesRgba.empty()) {
+        return; // Stop requested and all the frames are written
+      }
+      // The frames are moved, not copied, while the lock is held
+      std::vector<vpImage<unsigned char> > I(std::make_move_iterator(m_I.begin()),
+                                             std::make_move_iterator(m_I.end()));
+      std::vector<vpImage<vpRGBa> > Irgba(std::make_move_iterator(m_Irgba.begin()),
+                                          std::make_move_iterator(m_Irgba.end()));
+      std::vector<std::string> names(m_names.begin(), m_names.end());
+      std::vector<std::string> namesRgba(m_namesRgba.begin(), m_namesRgba.end());
+      m_I.clear();
+      m_Irgba.clear();
+      m_names.clear();
+      m_namesRgba.clear();
+      lock.unlock();
+
+      std::string error;
+      try {
+        vpImageIo::writeBatch(I, names, nullptr, vpImageIo::IO_DEFAULT_BACKEND, m_nbThreads);
+      }
+      catch (const vpException &e) {
+        error = e.getStringMessage();
+      }
+      try {
+        vpImageIo::writeBatch(Irgba, namesRgba, nullptr, vpImageIo::IO_DEFAULT_BACKEND, m_nbThreads);
+      }
+      catch (const vpException &e) {
+        error = error.empty() ? e.getStringMessage() : error;
+      }
+      I.clear();
+      Irgba.clear();
+
+      lock.lock();
+      m_nbPending -= static_cast<unsigned int>(names.size() + namesRgba.size());
+      if (m_error.empty()) {
+        m_error = error;
+      }
+      m_cond.notify_all();
+    }
+  }
+
+  unsigned int m_nbThreads;
+  mutable std::mutex m_mutex;
+  std::condition_variable m_cond;
+  std::deque<vpImage<unsigned char> > m_I;
+  std::deque<std::string> m_names;
+  std::deque<vpImage<vpRGBa> > m_Irgba;
+  std::deque<std::string> m_namesRgba;
+  unsigned int m_maxPending;
+  unsigned int m_nbPending;
+  std::string m_error;
+  bool m_stop;
+  std::thread m_thread;
+};
+#else
+class vpVideoWriter::vpFrameSaver
+{ };
+#endif
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
 /*!
   Basic constructor.
 */
@@ -56,7 +221,8 @@ vpVideoWriter::vpVideoWriter()
   m_writer(), m_framerate(25.0),
 #endif
   m_formatType(FORMAT_UNKNOWN), m_videoName(), m_frameName(), m_initFileName(false), m_isOpen(false), m_frameCount(0),
-  m_firstFrame(0), m_width(0), m_height(0), m_frameStep(1)
+  m_firstFrame(0), m_width(0), m_height(0), m_frameStep(1), m_saver(), m_saverNbThreads(0), m_saverMaxPending(16),
+  m_asynchronous(false)
 {
 #if defined(VISP_HAVE_OPENCV) && \
     (((VISP_HAVE_OPENCV_VERSION < 0x030000) && defined(HAVE_OPENCV_HIGHGUI)) || \
@@ -70,9 +236,100 @@ vpVideoWriter::vpVideoWriter()
 }
 
 /*!
-  Basic destructor.
+  Basic destructor. When the frames are saved in the background, waits until all the frames are written. Since a
+  destructor cannot throw, errors that occur while writing the last frames are printed on std::cerr, call close() or
+  flush() before to handle them.
+*/
+vpVideoWriter::~vpVideoWriter()
+{
+  try {
+    flush();
+  }
+  catch (const std::exception &e) {
+    std::cerr << "vpVideoWriter: " << e.what() << std::endl;
+  }
+}
+
+/*!
+  Enable the saving of the images of a sequence in the background. saveFrame() then only copies the image in a
+  queue and returns without waiting for its encoding, so that recording does not slow down the loop producing the
+  images. The queued frames are encoded in parallel and written by a background thread.
+
+  Errors that occur while writing a frame in the background are reported by the next call to flush() or close().
+
+  \param[in] asynchronous : true to save the frames in the background, false to save them in saveFrame().
+  \param[in] nbThreads : Number of threads used to encode the queued frames. When 0, the number of CPU cores is used.
+
+  \note Background saving only applies to sequences of images and requires ViSP to be built with threads support.
+  Video files are still encoded in saveFrame().
+
+  \exception vpImageException::ioError : When a frame queued before this call could not be written. The error is
+  reported once and the saving mode is left unchanged, call this function again to change it.
+
+  \sa flush(), getNbPendingFrames(), setMaxPendingFrames()
+*/
+void vpVideoWriter::setAsynchronousSaving(bool asynchronous, unsigned int nbThreads)
+{
+  flush();
+  m_saver.reset();
+#if defined(VISP_HAVE_THREADS)
+  m_asynchronous = asynchronous;
+#else
+  (void)asynchronous;
+#endif
+  m_saverNbThreads = nbThreads;
+}
+
+/*!
+  Set the maximum number of frames waiting to be written in the background. When it is reached, saveFrame() waits
+  until a frame is written, which bounds the memory used by the queue. The default value is 16.
+
+  \param[in] maxPending : Maximum number of pending frames, 0 for no limit.
+
+  \sa setAsynchronousSaving()
+*/
+void vpVideoWriter::setMaxPendingFrames(unsigned int maxPending)
+{
+  m_saverMaxPending = maxPending;
+#if defined(VISP_HAVE_THREADS)
+  if (m_saver) {
+    m_saver->setMaxPending(maxPending);
+  }
+#endif
+}
+
+/*!
+  Wait until all the frames passed to saveFrame() are written. Does nothing when the frames are not saved in the
+  background.
+
+  \exception vpImageException::ioError : When a frame could not be written in the background.
+
+  \sa setAsynchronousSaving()
+*/
+void vpVideoWriter::flush()
+{
+#if defined(VISP_HAVE_THREADS)
+  if (m_saver) {
+    m_saver->wait();
+  }
+#endif
+}
+
+/*!
+  Return the number of frames passed to saveFrame() that are not yet written when the frames are saved in the
+  background.
+
+  \sa setAsynchronousSaving()
 */
-vpVideoWriter::~vpVideoWriter() {}
+unsigned int vpVideoWriter::getNbPendingFrames() const
+{
+#if defined(VISP_HAVE_THREADS)
+  if (m_saver) {
+    return m_saver->getNbPending();
+  }
+#endif
+  return 0;
+}
 
 /*!
   It enables to set the path and the name of the video or sequence of images
@@ -208,7 +465,18 @@ void vpVideoWriter::saveFrame(vpImage<vpRGBa> &I)
   if (m_formatType == FORMAT_PGM || m_formatType == FORMAT_PPM || m_formatType == FORMAT_JPEG ||
       m_formatType == FORMAT_PNG) {
     m_frameName = vpIoTools::formatString(m_videoName, static_cast<unsigned int>(m_frameCount));
-    vpImageIo::write(I, m_frameName);
+#if defined(VISP_HAVE_THREADS)
+    if (m_asynchronous) {
+      if (!m_saver) {
+        m_saver = std::make_shared<vpFrameSaver>(m_saverNbThreads, m_saverMaxPending);
+      }
+      m_saver->push(I, m_frameName);
+    }
+    else
+#endif
+    {
+      vpImageIo::write(I, m_frameName);
+    }
   }
   else {
 #if defined(VISP_HAVE_OPENCV) && \
@@ -241,7 +509,18 @@ void vpVideoWriter::saveFrame(vpImage<unsigned char> &I)
   if (m_formatType == FORMAT_PGM || m_formatType == FORMAT_PPM || m_formatType == FORMAT_JPEG ||
       m_formatType == FORMAT_PNG) {
     m_frameName = vpIoTools::formatString(m_videoName, static_cast<unsigned int>(m_frameCount));
-    vpImageIo::write(I, m_frameName);
+#if defined(VISP_HAVE_THREADS)
+    if (m_asynchronous) {
+      if (!m_saver) {
+        m_saver = std::make_shared<vpFrameSaver>(m_saverNbThreads, m_saverMaxPending);
+      }
+      m_saver->push(I, m_frameName);
+    }
+    else
+#endif
+    {
+      vpImageIo::write(I, m_frameName);
+    }
   }
   else {
 #if defined(VISP_HAVE_OPENCV) && \
@@ -265,13 +544,15 @@ void vpVideoWriter::saveFrame(vpImage<unsigned char> &I)
 }
 
 /*!
-  Deallocates parameters use to write the video or the image sequence.
+  Deallocates parameters use to write the video or the image sequence. When the frames are saved in the
+  background, waits until all the frames are written.
 */
 void vpVideoWriter::close()
 {
   if (!m_isOpen) {
     throw(vpException(vpException::notInitialized, "Cannot close video writer: not yet opened"));
   }
+  flush();
 }
 
 /*!
@@ -0,0 +1,196 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ * Description:
+ * Test batch image i/o.
+ */
+
+/*!
+  \file catchImageIoBatch.cpp
+  \brief Test reading and writing batches of images with vpImageIo.
+ */
+
+#include <visp3/core/vpConfig.h>
+
+#if defined(VISP_HAVE_CATCH2)
+
+#if defined(VISP_BUILD_CATCH2)
+#include <catch_amalgamated.hpp>
+#else // Since v3.1.1
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <visp3/core/vpIoTools.h>
+#include <visp3/core/vpUniRand.h>
+#include <visp3/io/vpImageIo.h>
+
+#ifdef ENABLE_VISP_NAMESPACE
+using namespace VISP_NAMESPACE_NAME;
+#endif
+
+VP_ATTRIBUTE_NO_DESTROY static std::string tmp;
+
+namespace
+{
+void randomImages(std::vector<vpImage<unsigned char> > &I, std::vector<vpImage<vpRGBa> > &Irgba, size_t nbImages)
+{
+  vpUniRand rng(42);
+  I.resize(nbImages);
+  Irgba.resize(nbImages);
+  for (size_t k = 0; k < nbImages; ++k) {
+    unsigned int height = 20 + 3 * static_cast<unsigned int>(k), width = 30 + 5 * static_cast<unsigned int>(k);
+    I[k].resize(height, width);
+    Irgba[k].resize(height, width);
+    for (unsigned int i = 0; i < I[k].getSize(); ++i) {
+      I[k].bitmap[i] = static_cast<unsigned char>(rng.uniform(0, 256));
+      Irgba[k].bitmap[i] = vpRGBa(static_cast<unsigned char>(rng.uniform(0, 256)),
+                                  static_cast<unsigned char>(rng.uniform(0, 256)),
+                                  static_cast<unsigned char>(rng.uniform(0, 256)));
+    }
+  }
+}
+
+std::vector<std::string> fileNames(const std::string &format, size_t nbImages)
+{
+  std::vector<std::string> names;
+  for (size_t k = 0; k < nbImages; ++k) {
+    names.push_back(vpIoTools::formatString(tmp + "/" + format, static_cast<unsigned int>(k)));
+  }
+  return names;
+}
+}
+
+TEST_CASE("Batch write and read of images", "[vpImageIo]")
+{
+  const size_t nbImages = 9;
+  std::vector<vpImage<unsigned char> > I;
+  std::vector<vpImage<vpRGBa> > Irgba;
+  randomImages(I, Irgba, nbImages);
+
+  const std::string formats[] = { "I%02d.png", "I%02d.pgm" };
+  for (auto format : formats) {
+    std::vector<std::string> names = fileNames(format, nbImages);
+    std::vector<std::string> names_rgba = fileNames("C" + format, nbImages);
+    const unsigned int nbThreads[] = { 1, 4 };
+    for (auto nbThread : nbThreads) {
+      std::vector<double> durations;
+      vpImageIo::writeBatch(I, names, &durations, vpImageIo::IO_DEFAULT_BACKEND, nbThread);
+      CHECK(durations.size() == nbImages);
+      vpImageIo::writeBatch(Irgba, names_rgba, nullptr, vpImageIo::IO_DEFAULT_BACKEND, nbThread);
+
+      std::vector<vpImage<unsigned char> > I_read;
+      vpImageIo::readBatch(I_read, names, &durations, vpImageIo::IO_DEFAULT_BACKEND, nbThread);
+      CHECK(durations.size() == nbImages);
+      CHECK(I_read == I);
+
+      // Same result as reading the images one by one
+      std::vector<vpImage<vpRGBa> > Irgba_read;
+      vpImageIo::readBatch(Irgba_read, names_rgba, nullptr, vpImageIo::IO_DEFAULT_BACKEND, nbThread);
+      REQUIRE(Irgba_read.size() == nbImages);
+      for (size_t k = 0; k < nbImages; ++k) {
+        vpImage<vpRGBa> Irgba_ref;
+        vpImageIo::read(Irgba_ref, names_rgba[k]);
+        CHECK(Irgba_read[k] == Irgba_ref);
+      }
+    }
+  }
+}
+
+TEST_CASE("Batch encode and decode of PNG images in memory", "[vpImageIo]")
+{
+  const size_t nbImages = 7;
+  std::vector<vpImage<unsigned char> > I;
+  std::vector<vpImage<vpRGBa> > Irgba;
+  randomImages(I, Irgba, nbImages);
+
+  try {
+    std::vector<unsigned char> buffer;
+    vpImageIo::writePNGtoMem(I[0], buffer);
+  }
+  catch (const vpException &) {
+    SKIP("In-memory PNG encoding is not available");
+  }
+
+  std::vector<std::vector<unsigned char> > buffers;
+  std::vector<double> durations;
+  vpImageIo::writePNGtoMemBatch(I, buffers, &durations);
+  REQUIRE(buffers.size() == nbImages);
+  CHECK(durations.size() == nbImages);
+  for (size_t k = 0; k < nbImages; ++k) {
+    std::vector<unsigned char> buffer;
+    vpImageIo::writePNGtoMem(I[k], buffer);
+    CHECK(buffers[k] == buffer);
+  }
+  std::vector<vpImage<unsigned char> > I_read;
+  vpImageIo::readPNGfromMemBatch(buffers, I_read, &durations);
+  CHECK(I_read == I);
+
+  vpImageIo::writePNGtoMemBatch(Irgba, buffers);
+  std::vector<vpImage<vpRGBa> > Irgba_read;
+  vpImageIo::readPNGfromMemBatch(buffers, Irgba_read);
+  CHECK(Irgba_read == Irgba);
+}
+
+TEST_CASE("Batch read with missing images", "[vpImageIo]")
+{
+  const size_t nbImages = 5;
+  std::vector<vpImage<unsigned char> > I;
+  std::vector<vpImage<vpRGBa> > Irgba;
+  randomImages(I, Irgba, nbImages);
+  std::vector<std::string> names = fileNames("M%02d.pgm", nbImages);
+  vpImageIo::writeBatch(I, names);
+  names[2] = tmp + "/missing.pgm";
+
+  // The other images are read anyway
+  std::vector<vpImage<unsigned char> > I_read;
+  std::vector<double> durations;
+  CHECK_THROWS_AS(vpImageIo::readBatch(I_read, names, &durations), vpImageException);
+  REQUIRE(I_read.size() == nbImages);
+  CHECK(durations.size() == nbImages);
+  CHECK(I_read[4] == I[4]);
+  CHECK(I_read[2].getSize() == 0);
+
+  names.pop_back();
+  CHECK_THROWS_AS(vpImageIo::writeBatch(I, names), vpException);
+}
+
+int main(int argc, char *argv[])
+{
+  Catch::Session session;
+  session.applyCommandLine(argc, argv);
+
+  tmp = vpIoTools::makeTempDirectory(vpIoTools::getTempPath());
+  int numFailed = session.run();
+  vpIoTools::remove(tmp);
+  return numFailed;
+}
+#else
+int main() { return EXIT_SUCCESS; }
+#endif
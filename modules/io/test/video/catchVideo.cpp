@@ -47,6 +47,7 @@
 #endif
 
 #include <visp3/core/vpIoTools.h>
+#include <visp3/io/vpImageIo.h>
 #include <visp3/io/vpVideoReader.h>
 #include <visp3/io/vpVideoWriter.h>
 
@@ -163,6 +164,150 @@ TEST_CASE("Test saving sequence of color images with step 2", "[color]")
   }
 }
 
+template <class Type>
+void readAll(const std::string &videoname, long step, unsigned int prefetch, std::vector<long> &indexes,
+             std::vector<std::string> &names, std::vector<vpImage<Type> > &images)
+{
+  vpVideoReader reader;
+  reader.setFileName(videoname);
+  reader.setFrameStep(step);
+  reader.setPrefetch(prefetch, 3);
+  CHECK(reader.getPrefetch() == prefetch);
+  vpImage<Type> I;
+  reader.open(I);
+  indexes.clear();
+  names.clear();
+  images.clear();
+  while (!reader.end()) {
+    reader.acquire(I);
+    indexes.push_back(reader.getFrameIndex());
+    names.push_back(reader.getFrameName());
+    images.push_back(I);
+  }
+}
+
+template <class Type> void test_prefetchSequence(const std::string &videoname)
+{
+  const long steps[] = { 1, 3 };
+  for (auto step : steps) {
+    std::vector<long> indexes, indexes_prefetch;
+    std::vector<std::string> names, names_prefetch;
+    std::vector<vpImage<Type> > images, images_prefetch;
+    readAll(videoname, step, 0, indexes, names, images);
+    readAll(videoname, step, 4, indexes_prefetch, names_prefetch, images_prefetch);
+    CHECK(indexes.size() > 1);
+    CHECK(indexes_prefetch == indexes);
+    CHECK(names_prefetch == names);
+    CHECK(images_prefetch == images);
+  }
+
+  // Random access followed by acquisitions
+  vpVideoReader reader, reader_prefetch;
+  reader.setFileName(videoname);
+  reader_prefetch.setFileName(videoname);
+  reader_prefetch.setPrefetch(5);
+  vpImage<Type> I, I_prefetch;
+  reader.open(I);
+  reader_prefetch.open(I_prefetch);
+  const long frames[] = { 7, 2, 2, 12, 30 };
+  for (auto frame : frames) {
+    CHECK(reader_prefetch.getFrame(I_prefetch, frame) == reader.getFrame(I, frame));
+    CHECK(I_prefetch == I);
+    CHECK(reader_prefetch.getFrameIndex() == reader.getFrameIndex());
+    for (unsigned int i = 0; (i < 3) && !reader.end(); ++i) {
+      reader.acquire(I);
+      reader_prefetch.acquire(I_prefetch);
+      CHECK(I_prefetch == I);
+      CHECK(reader_prefetch.getFrameIndex() == reader.getFrameIndex());
+    }
+  }
+}
+
+TEST_CASE("Test prefetched reading of sequences of images", "[prefetch]")
+{
+  const unsigned int nbImages = 20;
+  vpImage<unsigned char> I(3, 5);
+  vpImage<vpRGBa> Irgba(3, 5);
+  vpVideoWriter writer_grey, writer_color;
+  writer_grey.setFileName(tmp + std::string("/P%04d.pgm"));
+  writer_color.setFileName(tmp + std::string("/P%04d.ppm"));
+  writer_grey.open(I);
+  writer_color.open(Irgba);
+  for (unsigned int i = 0; i < nbImages; ++i) {
+    I = static_cast<unsigned char>(10 * i);
+    Irgba = vpRGBa(static_cast<unsigned char>(i), static_cast<unsigned char>(2 * i), static_cast<unsigned char>(3 * i));
+    writer_grey.saveFrame(I);
+    writer_color.saveFrame(Irgba);
+  }
+  // A missing image is skipped in the same way with prefetching
+  vpIoTools::remove(tmp + std::string("/P0010.pgm"));
+
+  test_prefetchSequence<unsigned char>(tmp + std::string("/P%04d.pgm"));
+  test_prefetchSequence<vpRGBa>(tmp + std::string("/P%04d.ppm"));
+}
+
+TEST_CASE("Test saving sequences of images in the background", "[async]")
+{
+  const unsigned int nbImages = 30;
+  vpImage<unsigned char> I(12, 16);
+  vpImage<vpRGBa> Irgba(12, 16);
+  vpVideoWriter writer_grey, writer_color;
+  writer_grey.setFileName(tmp + std::string("/A%04d.png"));
+  writer_color.setFileName(tmp + std::string("/A%04d.ppm"));
+  const unsigned int maxPending = 3;
+  writer_grey.setAsynchronousSaving(true, 2);
+  writer_color.setAsynchronousSaving(true);
+  writer_color.setMaxPendingFrames(maxPending);
+  writer_grey.open(I);
+  writer_color.open(Irgba);
+  for (unsigned int i = 0; i < nbImages; ++i) {
+    I = static_cast<unsigned char>(5 * i);
+    Irgba = vpRGBa(static_cast<unsigned char>(i), static_cast<unsigned char>(2 * i), static_cast<unsigned char>(3 * i));
+    writer_grey.saveFrame(I);
+    writer_color.saveFrame(Irgba);
+    CHECK(writer_color.getNbPendingFrames() <= maxPending);
+    CHECK(writer_grey.getFrameName() == vpIoTools::formatString(tmp + std::string("/A%04d.png"), i));
+  }
+  writer_grey.close();
+  writer_color.close();
+  CHECK(writer_grey.getNbPendingFrames() == 0);
+  CHECK(writer_color.getNbPendingFrames() == 0);
+
+  for (unsigned int i = 0; i < nbImages; ++i) {
+    vpImage<unsigned char> I_read;
+    vpImage<vpRGBa> Irgba_read;
+    vpImageIo::read(I_read, vpIoTools::formatString(tmp + std::string("/A%04d.png"), i));
+    vpImageIo::read(Irgba_read, vpIoTools::formatString(tmp + std::string("/A%04d.ppm"), i));
+    CHECK(I_read == vpImage<unsigned char>(12, 16, static_cast<unsigned char>(5 * i)));
+    CHECK(Irgba_read == vpImage<vpRGBa>(12, 16, vpRGBa(static_cast<unsigned char>(i), static_cast<unsigned char>(2 * i),
+                                                        static_cast<unsigned char>(3 * i))));
+  }
+
+  // Errors in the background are reported by flush()
+  vpVideoWriter writer;
+  writer.setFileName(tmp + std::string("/removed/A%04d.pgm"));
+  writer.setAsynchronousSaving(true);
+  writer.open(I);
+  vpIoTools::remove(tmp + std::string("/removed"));
+  writer.saveFrame(I);
+  CHECK_THROWS_AS(writer.flush(), vpImageException);
+  // The error of a frame queued before is reported once by setAsynchronousSaving(), that leaves the mode unchanged
+  writer.saveFrame(I);
+  CHECK_THROWS_AS(writer.setAsynchronousSaving(false), vpImageException);
+  writer.setAsynchronousSaving(false);
+  writer.close();
+
+  // The destructor prints the errors of the last frames instead of throwing
+  {
+    vpVideoWriter writer_destroyed;
+    writer_destroyed.setFileName(tmp + std::string("/removed_destroyed/A%04d.pgm"));
+    writer_destroyed.setAsynchronousSaving(true);
+    writer_destroyed.open(I);
+    vpIoTools::remove(tmp + std::string("/removed_destroyed"));
+    writer_destroyed.saveFrame(I);
+  }
+}
+
 int main(int argc, char *argv[])
 {
   Catch::Session session; // There must be exactly one instance
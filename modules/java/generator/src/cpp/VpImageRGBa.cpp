@@ -91,7 +91,10 @@ extern "C" {
   {
     vpImage<vpRGBa> *me = (vpImage<vpRGBa> *)address; // TODO: check for nullptr
     jbyteArray ret = env->NewByteArray(static_cast<jint>(me->getNumberOfPixel() * 4));
-    env->SetByteArrayRegion(ret, 0, static_cast<jint>(me->getNumberOfPixel() * 4), (jbyte *)me->bitmap);
+    const jint w = static_cast<jint>(me->getWidth() * 4);
+    for (unsigned int i = 0; i < me->getHeight(); ++i) {
+      env->SetByteArrayRegion(ret, static_cast<jint>(i) * w, w, (jbyte *)(*me)[i]);
+    }
     return ret;
   }
 
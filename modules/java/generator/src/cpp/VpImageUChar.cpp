@@ -86,7 +86,10 @@ extern "C" {
   {
     vpImage<u_char> *me = (vpImage<u_char> *)address; // TODO: check for nullptr
     jbyteArray ret = env->NewByteArray(static_cast<jint>(me->getNumberOfPixel()));
-    env->SetByteArrayRegion(ret, 0, static_cast<jint>(me->getNumberOfPixel()), (jbyte *)me->bitmap);
+    const jint w = static_cast<jint>(me->getWidth());
+    for (unsigned int i = 0; i < me->getHeight(); ++i) {
+      env->SetByteArrayRegion(ret, static_cast<jint>(i) * w, w, (jbyte *)(*me)[i]);
+    }
     return ret;
   }
 
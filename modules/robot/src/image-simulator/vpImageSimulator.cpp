@@ -208,8 +208,6 @@ void vpImageSimulator::getImage(vpImage<unsigned char> &I, const vpCameraParamet
     double left = rect.getLeft();
     double right = rect.getRight();
 
-    unsigned char *bitmap = I.bitmap;
-    unsigned int width = I.getWidth();
     vpImagePoint ip;
 
     for (unsigned int i = static_cast<unsigned int>(top); i < static_cast<unsigned int>(bottom); i++) {
@@ -221,7 +219,7 @@ void vpImageSimulator::getImage(vpImage<unsigned char> &I, const vpCameraParamet
         if (colorI == GRAY_SCALED) {
           unsigned char Ipixelplan = 0;
           if (getPixel(ip, Ipixelplan)) {
-            *(bitmap + i * width + j) = Ipixelplan;
+            I[i][j] = Ipixelplan;
           }
         }
         else if (colorI == COLORED) {
@@ -229,7 +227,7 @@ void vpImageSimulator::getImage(vpImage<unsigned char> &I, const vpCameraParamet
           if (getPixel(ip, Ipixelplan)) {
             unsigned char pixelgrey =
               static_cast<unsigned char>(0.2126 * Ipixelplan.R + 0.7152 * Ipixelplan.G + 0.0722 * Ipixelplan.B);
-            *(bitmap + i * width + j) = pixelgrey;
+            I[i][j] = pixelgrey;
           }
         }
       }
@@ -267,8 +265,6 @@ void vpImageSimulator::getImage(vpImage<unsigned char> &I, vpImage<unsigned char
     double left = rect.getLeft();
     double right = rect.getRight();
 
-    unsigned char *bitmap = I.bitmap;
-    unsigned int width = I.getWidth();
     vpImagePoint ip;
 
     for (unsigned int i = static_cast<unsigned int>(top); i < static_cast<unsigned int>(bottom); i++) {
@@ -279,7 +275,7 @@ void vpImageSimulator::getImage(vpImage<unsigned char> &I, vpImage<unsigned char
         ip.set_ij(y, x);
         unsigned char Ipixelplan = 0;
         if (getPixel(Isrc, ip, Ipixelplan)) {
-          *(bitmap + i * width + j) = Ipixelplan;
+          I[i][j] = Ipixelplan;
         }
       }
     }
@@ -326,8 +322,6 @@ void vpImageSimulator::getImage(vpImage<unsigned char> &I, const vpCameraParamet
     double left = rect.getLeft();
     double right = rect.getRight();
 
-    unsigned char *bitmap = I.bitmap;
-    unsigned int width = I.getWidth();
     vpImagePoint ip;
 
     for (unsigned int i = static_cast<unsigned int>(top); i < static_cast<unsigned int>(bottom); i++) {
@@ -340,7 +334,7 @@ void vpImageSimulator::getImage(vpImage<unsigned char> &I, const vpCameraParamet
           unsigned char Ipixelplan;
           if (getPixel(ip, Ipixelplan)) {
             if (Xinter_optim[2] < zBuffer[i][j] || zBuffer[i][j] < 0) {
-              *(bitmap + i * width + j) = Ipixelplan;
+              I[i][j] = Ipixelplan;
               zBuffer[i][j] = Xinter_optim[2];
             }
           }
@@ -351,7 +345,7 @@ void vpImageSimulator::getImage(vpImage<unsigned char> &I, const vpCameraParamet
             if (Xinter_optim[2] < zBuffer[i][j] || zBuffer[i][j] < 0) {
               unsigned char pixelgrey =
                 static_cast<unsigned char>(0.2126 * Ipixelplan.R + 0.7152 * Ipixelplan.G + 0.0722 * Ipixelplan.B);
-              *(bitmap + i * width + j) = pixelgrey;
+              I[i][j] = pixelgrey;
               zBuffer[i][j] = Xinter_optim[2];
             }
           }
@@ -389,8 +383,6 @@ void vpImageSimulator::getImage(vpImage<vpRGBa> &I, const vpCameraParameters &ca
     double left = rect.getLeft();
     double right = rect.getRight();
 
-    vpRGBa *bitmap = I.bitmap;
-    unsigned int width = I.getWidth();
     vpImagePoint ip;
 
     for (unsigned int i = static_cast<unsigned int>(top); i < static_cast<unsigned int>(bottom); i++) {
@@ -406,13 +398,13 @@ void vpImageSimulator::getImage(vpImage<vpRGBa> &I, const vpCameraParameters &ca
             pixelcolor.R = Ipixelplan;
             pixelcolor.G = Ipixelplan;
             pixelcolor.B = Ipixelplan;
-            *(bitmap + i * width + j) = pixelcolor;
+            I[i][j] = pixelcolor;
           }
         }
         else if (colorI == COLORED) {
           vpRGBa Ipixelplan;
           if (getPixel(ip, Ipixelplan)) {
-            *(bitmap + i * width + j) = Ipixelplan;
+            I[i][j] = Ipixelplan;
           }
         }
       }
@@ -450,8 +442,6 @@ void vpImageSimulator::getImage(vpImage<vpRGBa> &I, vpImage<vpRGBa> &Isrc, const
     double left = rect.getLeft();
     double right = rect.getRight();
 
-    vpRGBa *bitmap = I.bitmap;
-    unsigned int width = I.getWidth();
     vpImagePoint ip;
 
     for (unsigned int i = static_cast<unsigned int>(top); i < static_cast<unsigned int>(bottom); i++) {
@@ -462,7 +452,7 @@ void vpImageSimulator::getImage(vpImage<vpRGBa> &I, vpImage<vpRGBa> &Isrc, const
         ip.set_ij(y, x);
         vpRGBa Ipixelplan;
         if (getPixel(Isrc, ip, Ipixelplan)) {
-          *(bitmap + i * width + j) = Ipixelplan;
+          I[i][j] = Ipixelplan;
         }
       }
     }
@@ -508,8 +498,6 @@ void vpImageSimulator::getImage(vpImage<vpRGBa> &I, const vpCameraParameters &ca
     double left = rect.getLeft();
     double right = rect.getRight();
 
-    vpRGBa *bitmap = I.bitmap;
-    unsigned int width = I.getWidth();
     vpImagePoint ip;
 
     for (unsigned int i = static_cast<unsigned int>(top); i < static_cast<unsigned int>(bottom); i++) {
@@ -526,7 +514,7 @@ void vpImageSimulator::getImage(vpImage<vpRGBa> &I, const vpCameraParameters &ca
               pixelcolor.R = Ipixelplan;
               pixelcolor.G = Ipixelplan;
               pixelcolor.B = Ipixelplan;
-              *(bitmap + i * width + j) = pixelcolor;
+              I[i][j] = pixelcolor;
               zBuffer[i][j] = Xinter_optim[2];
             }
           }
@@ -535,7 +523,7 @@ void vpImageSimulator::getImage(vpImage<vpRGBa> &I, const vpCameraParameters &ca
           vpRGBa Ipixelplan;
           if (getPixel(ip, Ipixelplan)) {
             if (Xinter_optim[2] < zBuffer[i][j] || zBuffer[i][j] < 0) {
-              *(bitmap + i * width + j) = Ipixelplan;
+              I[i][j] = Ipixelplan;
               zBuffer[i][j] = Xinter_optim[2];
             }
           }
@@ -705,7 +693,6 @@ void vpImageSimulator::getImage(vpImage<unsigned char> &I, std::list<vpImageSimu
 
   double zmin = -1;
   int indice = -1;
-  unsigned char *bitmap = I.bitmap;
   vpImagePoint ip;
 
   for (unsigned int i = static_cast<unsigned int>(topFinal); i < static_cast<unsigned int>(bottomFinal); i++) {
@@ -728,14 +715,14 @@ void vpImageSimulator::getImage(vpImage<unsigned char> &I, std::list<vpImageSimu
         if (simList[indice]->colorI == GRAY_SCALED) {
           unsigned char Ipixelplan = 255;
           simList[indice]->getPixel(ip, Ipixelplan);
-          *(bitmap + i * width + j) = Ipixelplan;
+          I[i][j] = Ipixelplan;
         }
         else if (simList[indice]->colorI == COLORED) {
           vpRGBa Ipixelplan(255, 255, 255);
           simList[indice]->getPixel(ip, Ipixelplan);
           unsigned char pixelgrey =
             static_cast<unsigned char>(0.2126 * Ipixelplan.R + 0.7152 * Ipixelplan.G + 0.0722 * Ipixelplan.B);
-          *(bitmap + i * width + j) = pixelgrey;
+          I[i][j] = pixelgrey;
         }
       }
     }
@@ -906,7 +893,6 @@ void vpImageSimulator::getImage(vpImage<vpRGBa> &I, std::list<vpImageSimulator>
 
   double zmin = -1;
   int indice = -1;
-  vpRGBa *bitmap = I.bitmap;
   vpImagePoint ip;
 
   for (unsigned int i = static_cast<unsigned int>(topFinal); i < static_cast<unsigned int>(bottomFinal); i++) {
@@ -933,14 +919,14 @@ void vpImageSimulator::getImage(vpImage<vpRGBa> &I, std::list<vpImageSimulator>
           pixelcolor.R = Ipixelplan;
           pixelcolor.G = Ipixelplan;
           pixelcolor.B = Ipixelplan;
-          *(bitmap + i * width + j) = pixelcolor;
+          I[i][j] = pixelcolor;
         }
         else if (simList[indice]->colorI == COLORED) {
           vpRGBa Ipixelplan(255, 255, 255);
           simList[indice]->getPixel(ip, Ipixelplan);
           // unsigned char pixelgrey = 0.2126 * Ipixelplan.R + 0.7152 *
           // Ipixelplan.G + 0.0722 * Ipixelplan.B;
-          *(bitmap + i * width + j) = Ipixelplan;
+          I[i][j] = Ipixelplan;
         }
       }
     }
@@ -800,6 +800,13 @@ void vpRobotBebop2::stopMoving()
 */
 void vpRobotBebop2::getGrayscaleImage(vpImage<unsigned char> &I)
 {
+  if (!I.isContiguous()) {
+    // The picture is converted as a whole: fill views and padded images from a contiguous copy
+    vpImage<unsigned char> I_contiguous;
+    getGrayscaleImage(I_contiguous);
+    I = I_contiguous;
+    return;
+  }
   if (m_videoDecodingStarted) {
 
     if (m_bgr_picture->data[0] != nullptr) {
@@ -830,6 +837,12 @@ void vpRobotBebop2::getGrayscaleImage(vpImage<unsigned char> &I)
 */
 void vpRobotBebop2::getRGBaImage(vpImage<vpRGBa> &I)
 {
+  if (!I.isContiguous()) {
+    vpImage<vpRGBa> I_contiguous;
+    getRGBaImage(I_contiguous);
+    I = I_contiguous;
+    return;
+  }
   if (m_videoDecodingStarted) {
 
     if (m_bgr_picture->data[0] != nullptr) {
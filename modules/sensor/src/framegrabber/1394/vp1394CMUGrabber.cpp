@@ -204,6 +204,11 @@ void vp1394CMUGrabber::open(vpImage<vpRGBa> &I)
   */
 void vp1394CMUGrabber::acquire(vpImage<unsigned char> &I)
 {
+  if (!I.isContiguous()) {
+    throw(vpFrameGrabberException(vpFrameGrabberException::otherError,
+                                  "vp1394CMUGrabber::acquire() does not support non contiguous images such as views, "
+                                  "see vpImage::isContiguous()"));
+  }
   // get image data
   unsigned long length;
   unsigned char *rawdata = nullptr;
@@ -259,6 +264,11 @@ void vp1394CMUGrabber::acquire(vpImage<unsigned char> &I)
  */
 void vp1394CMUGrabber::acquire(vpImage<vpRGBa> &I)
 {
+  if (!I.isContiguous()) {
+    throw(vpFrameGrabberException(vpFrameGrabberException::otherError,
+                                  "vp1394CMUGrabber::acquire() does not support non contiguous images such as views, "
+                                  "see vpImage::isContiguous()"));
+  }
   // get image data
   unsigned long length;
   unsigned char *rawdata = nullptr;
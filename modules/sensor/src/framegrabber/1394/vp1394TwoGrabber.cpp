@@ -2301,6 +2301,11 @@ dc1394video_frame_t *vp1394TwoGrabber::dequeue(vpImage<unsigned char> &I)
 */
 dc1394video_frame_t *vp1394TwoGrabber::dequeue(vpImage<unsigned char> &I, uint64_t &timestamp, uint32_t &id)
 {
+  if (!I.isContiguous()) {
+    throw(vpFrameGrabberException(vpFrameGrabberException::otherError,
+                                  "vp1394TwoGrabber::dequeue() does not support non contiguous images such as views, "
+                                  "see vpImage::isContiguous()"));
+  }
 
   open();
 
@@ -2464,6 +2469,11 @@ dc1394video_frame_t *vp1394TwoGrabber::dequeue(vpImage<vpRGBa> &I)
 */
 dc1394video_frame_t *vp1394TwoGrabber::dequeue(vpImage<vpRGBa> &I, uint64_t &timestamp, uint32_t &id)
 {
+  if (!I.isContiguous()) {
+    throw(vpFrameGrabberException(vpFrameGrabberException::otherError,
+                                  "vp1394TwoGrabber::dequeue() does not support non contiguous images such as views, "
+                                  "see vpImage::isContiguous()"));
+  }
 
   open();
 
@@ -2638,6 +2648,11 @@ void vp1394TwoGrabber::acquire(vpImage<vpRGBa> &I)
 */
 void vp1394TwoGrabber::acquire(vpImage<vpRGBa> &I, uint64_t &timestamp, uint32_t &id)
 {
+  if (!I.isContiguous()) {
+    throw(vpFrameGrabberException(vpFrameGrabberException::otherError,
+                                  "vp1394TwoGrabber::acquire() does not support non contiguous images such as views, "
+                                  "see vpImage::isContiguous()"));
+  }
   dc1394video_frame_t *frame;
 
   open();
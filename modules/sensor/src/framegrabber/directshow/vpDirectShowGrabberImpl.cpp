@@ -566,6 +566,11 @@ void vpDirectShowGrabberImpl::acquire(vpImage<vpRGBa> &I)
     close();
     throw(vpFrameGrabberException(vpFrameGrabberException::initializationError, "Initialization not done"));
   }
+  if (!I.isContiguous()) {
+    throw(vpFrameGrabberException(vpFrameGrabberException::otherError,
+                                  "vpDirectShowGrabberImpl::acquire() does not support non contiguous images such as "
+                                  "views, see vpImage::isContiguous()"));
+  }
 
   // set the rgbaIm pointer on I (will be filled on the next framegrabber
   // callback)
@@ -602,6 +607,11 @@ void vpDirectShowGrabberImpl::acquire(vpImage<unsigned char> &I)
     close();
     throw(vpFrameGrabberException(vpFrameGrabberException::initializationError, "Initialization not done"));
   }
+  if (!I.isContiguous()) {
+    throw(vpFrameGrabberException(vpFrameGrabberException::otherError,
+                                  "vpDirectShowGrabberImpl::acquire() does not support non contiguous images such as "
+                                  "views, see vpImage::isContiguous()"));
+  }
 
   // set the grayIm pointer on I (will be filled on the next framegrabber
   // callback)
@@ -1156,6 +1156,10 @@ void vpFlyCaptureGrabber::acquire(vpImage<unsigned char> &I)
 */
 void vpFlyCaptureGrabber::acquire(vpImage<unsigned char> &I, FlyCapture2::TimeStamp &timestamp)
 {
+  if (!I.isContiguous()) {
+    throw(vpException(vpException::badValue, "vpFlyCaptureGrabber::acquire() does not support non contiguous images such as views, "
+                      "see vpImage::isContiguous()"));
+  }
   this->open();
 
   FlyCapture2::Error error;
@@ -657,6 +657,10 @@ void vpPylonGrabberGigE::close()
 */
 void vpPylonGrabberGigE::acquire(vpImage<unsigned char> &I)
 {
+  if (!I.isContiguous()) {
+    throw(vpException(vpException::badValue, "vpPylonGrabberGigE::acquire() does not support non contiguous images such as views, "
+                      "see vpImage::isContiguous()"));
+  }
   open();
 
   Pylon::CGrabResultPtr grabResult;
@@ -639,6 +639,10 @@ void vpPylonGrabberUsb::close()
 */
 void vpPylonGrabberUsb::acquire(vpImage<unsigned char> &I)
 {
+  if (!I.isContiguous()) {
+    throw(vpException(vpException::badValue, "vpPylonGrabberUsb::acquire() does not support non contiguous images such as views, "
+                      "see vpImage::isContiguous()"));
+  }
   open();
 
   Pylon::CGrabResultPtr grabResult;
@@ -1168,6 +1168,10 @@ vpUeyeGrabber::~vpUeyeGrabber() { delete m_impl; }
  */
 void vpUeyeGrabber::acquire(vpImage<unsigned char> &I, double *timestamp_camera, std::string *timestamp_system)
 {
+  if (!I.isContiguous()) {
+    throw(vpException(vpException::badValue, "vpUeyeGrabber::acquire() does not support non contiguous images such as views, "
+                      "see vpImage::isContiguous()"));
+  }
   m_impl->acquire(I, timestamp_camera, timestamp_system);
 }
 
@@ -1193,6 +1197,10 @@ void vpUeyeGrabber::acquire(vpImage<unsigned char> &I, double *timestamp_camera,
  */
 void vpUeyeGrabber::acquire(vpImage<vpRGBa> &I, double *timestamp_camera, std::string *timestamp_system)
 {
+  if (!I.isContiguous()) {
+    throw(vpException(vpException::badValue, "vpUeyeGrabber::acquire() does not support non contiguous images such as views, "
+                      "see vpImage::isContiguous()"));
+  }
   m_impl->acquire(I, timestamp_camera, timestamp_system);
 }
 
@@ -569,6 +569,11 @@ void vpV4l2Grabber::acquire(vpImage<unsigned char> &I, const vpRect &roi)
 */
 void vpV4l2Grabber::acquire(vpImage<unsigned char> &I, struct timeval &timestamp, const vpRect &roi)
 {
+  if (!I.isContiguous()) {
+    throw(vpFrameGrabberException(vpFrameGrabberException::otherError,
+                                  "vpV4l2Grabber::acquire() does not support non contiguous images such as views, "
+                                  "see vpImage::isContiguous()"));
+  }
   if (init == false) {
     open(I);
   }
@@ -695,6 +700,11 @@ void vpV4l2Grabber::acquire(vpImage<vpRGBa> &I, const vpRect &roi)
 */
 void vpV4l2Grabber::acquire(vpImage<vpRGBa> &I, struct timeval &timestamp, const vpRect &roi)
 {
+  if (!I.isContiguous()) {
+    throw(vpFrameGrabberException(vpFrameGrabberException::otherError,
+                                  "vpV4l2Grabber::acquire() does not support non contiguous images such as views, "
+                                  "see vpImage::isContiguous()"));
+  }
   if (init == false) {
     open(I);
   }
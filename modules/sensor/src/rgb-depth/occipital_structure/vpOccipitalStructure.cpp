@@ -70,6 +70,10 @@ vpOccipitalStructure::~vpOccipitalStructure() { close(); }
  */
 void vpOccipitalStructure::acquire(vpImage<unsigned char> &gray, bool undistorted, double *ts)
 {
+  if (!gray.isContiguous()) {
+    throw(vpException(vpException::badValue, "vpOccipitalStructure::acquire() does not support non contiguous images such as views, "
+                      "see vpImage::isContiguous()"));
+  }
   std::unique_lock<std::mutex> u(m_delegate.m_sampleLock);
   m_delegate.cv_sampleLock.wait(u);
 
@@ -94,6 +98,10 @@ void vpOccipitalStructure::acquire(vpImage<unsigned char> &gray, bool undistorte
  */
 void vpOccipitalStructure::acquire(vpImage<vpRGBa> &rgb, bool undistorted, double *ts)
 {
+  if (!rgb.isContiguous()) {
+    throw(vpException(vpException::badValue, "vpOccipitalStructure::acquire() does not support non contiguous images such as views, "
+                      "see vpImage::isContiguous()"));
+  }
   std::unique_lock<std::mutex> u(m_delegate.m_sampleLock);
   m_delegate.cv_sampleLock.wait(u);
 
@@ -135,6 +143,14 @@ void vpOccipitalStructure::acquire(vpImage<vpRGBa> &rgb, bool undistorted, doubl
 void vpOccipitalStructure::acquire(vpImage<vpRGBa> *rgb, vpImage<vpRGBa> *depth, vpColVector *acceleration_data,
                                    vpColVector *gyroscope_data, bool undistorted, double *ts)
 {
+  if ((rgb != nullptr) && (!rgb->isContiguous())) {
+    throw(vpException(vpException::badValue, "vpOccipitalStructure::acquire() does not support non contiguous images such as views, "
+                      "see vpImage::isContiguous()"));
+  }
+  if ((depth != nullptr) && (!depth->isContiguous())) {
+    throw(vpException(vpException::badValue, "vpOccipitalStructure::acquire() does not support non contiguous images such as views, "
+                      "see vpImage::isContiguous()"));
+  }
   std::unique_lock<std::mutex> u(m_delegate.m_sampleLock);
   m_delegate.cv_sampleLock.wait(u);
 
@@ -197,6 +213,14 @@ void vpOccipitalStructure::acquire(vpImage<vpRGBa> *rgb, vpImage<vpRGBa> *depth,
 void vpOccipitalStructure::acquire(vpImage<unsigned char> *gray, vpImage<vpRGBa> *depth, vpColVector *acceleration_data,
                                    vpColVector *gyroscope_data, bool undistorted, double *ts)
 {
+  if ((gray != nullptr) && (!gray->isContiguous())) {
+    throw(vpException(vpException::badValue, "vpOccipitalStructure::acquire() does not support non contiguous images such as views, "
+                      "see vpImage::isContiguous()"));
+  }
+  if ((depth != nullptr) && (!depth->isContiguous())) {
+    throw(vpException(vpException::badValue, "vpOccipitalStructure::acquire() does not support non contiguous images such as views, "
+                      "see vpImage::isContiguous()"));
+  }
   std::unique_lock<std::mutex> u(m_delegate.m_sampleLock);
   m_delegate.cv_sampleLock.wait(u);
 
@@ -258,6 +258,14 @@ void vpRealSense2::acquire(unsigned char *const data_image, unsigned char *const
  */
 void vpRealSense2::acquire(vpImage<unsigned char> *left, vpImage<unsigned char> *right, double *ts)
 {
+  if ((left != nullptr) && (!left->isContiguous())) {
+    throw(vpException(vpException::badValue, "vpRealSense2::acquire() does not support non contiguous images such as views, "
+                      "see vpImage::isContiguous()"));
+  }
+  if ((right != nullptr) && (!right->isContiguous())) {
+    throw(vpException(vpException::badValue, "vpRealSense2::acquire() does not support non contiguous images such as views, "
+                      "see vpImage::isContiguous()"));
+  }
   auto data = m_pipe.wait_for_frames();
 
   if (left != nullptr) {
@@ -312,6 +320,14 @@ void vpRealSense2::acquire(vpImage<unsigned char> *left, vpImage<unsigned char>
 void vpRealSense2::acquire(vpImage<unsigned char> *left, vpImage<unsigned char> *right, vpHomogeneousMatrix *cMw,
                            vpColVector *odo_vel, vpColVector *odo_acc, unsigned int *confidence, double *ts)
 {
+  if ((left != nullptr) && (!left->isContiguous())) {
+    throw(vpException(vpException::badValue, "vpRealSense2::acquire() does not support non contiguous images such as views, "
+                      "see vpImage::isContiguous()"));
+  }
+  if ((right != nullptr) && (!right->isContiguous())) {
+    throw(vpException(vpException::badValue, "vpRealSense2::acquire() does not support non contiguous images such as views, "
+                      "see vpImage::isContiguous()"));
+  }
   auto data = m_pipe.wait_for_frames();
 
   if (left != nullptr) {
@@ -392,6 +408,14 @@ void vpRealSense2::acquire(vpImage<unsigned char> *left, vpImage<unsigned char>
                            vpColVector *odo_vel, vpColVector *odo_acc, vpColVector *imu_vel, vpColVector *imu_acc,
                            unsigned int *confidence, double *ts)
 {
+  if ((left != nullptr) && (!left->isContiguous())) {
+    throw(vpException(vpException::badValue, "vpRealSense2::acquire() does not support non contiguous images such as views, "
+                      "see vpImage::isContiguous()"));
+  }
+  if ((right != nullptr) && (!right->isContiguous())) {
+    throw(vpException(vpException::badValue, "vpRealSense2::acquire() does not support non contiguous images such as views, "
+                      "see vpImage::isContiguous()"));
+  }
   auto data = m_pipe.wait_for_frames();
 
   if (left != nullptr) {
@@ -731,6 +755,10 @@ rs2_intrinsics vpRealSense2::getIntrinsics(const rs2_stream &stream, int index)
 
 void vpRealSense2::getColorFrame(const rs2::frame &frame, vpImage<vpRGBa> &color)
 {
+  if (!color.isContiguous()) {
+    throw(vpException(vpException::badValue, "vpRealSense2::getColorFrame() does not support non contiguous images such as views, "
+                      "see vpImage::isContiguous()"));
+  }
   auto vf = frame.as<rs2::video_frame>();
   unsigned int width = static_cast<unsigned int>(vf.get_width());
   unsigned int height = static_cast<unsigned int>(vf.get_height());
@@ -785,6 +813,10 @@ float vpRealSense2::getDepthScale()
 
 void vpRealSense2::getGreyFrame(const rs2::frame &frame, vpImage<unsigned char> &grey)
 {
+  if (!grey.isContiguous()) {
+    throw(vpException(vpException::badValue, "vpRealSense2::getGreyFrame() does not support non contiguous images such as views, "
+                      "see vpImage::isContiguous()"));
+  }
   auto vf = frame.as<rs2::video_frame>();
   unsigned int width = static_cast<unsigned int>(vf.get_width());
   unsigned int height = static_cast<unsigned int>(vf.get_height());
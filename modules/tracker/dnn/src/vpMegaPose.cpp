@@ -139,9 +139,11 @@ void encode(std::vector<uint8_t> &buffer, const vpImage<vpRGBa> &object)
   const uint32_t sentSize = static_cast<uint32_t>(height) * static_cast<uint32_t>(width) * 4;
 
   buffer.reserve(buffer.size() + sentSize); // Avoid resizing multiple times as we iterate on pixels
-  const uint8_t *const bitmap = (uint8_t *)object.bitmap;
-  buffer.insert(buffer.end(), bitmap, bitmap + sentSize);
-  //std::copy(bitmap, bitmap + sentSize, buffer.end());
+  const uint32_t rowSize = static_cast<uint32_t>(width) * 4;
+  for (unsigned int i = 0; i < object.getHeight(); ++i) {
+    const uint8_t *const row = (const uint8_t *)object[i];
+    buffer.insert(buffer.end(), row, row + rowSize);
+  }
 }
 
 template<>
@@ -157,8 +159,11 @@ void encode(std::vector<uint8_t> &buffer, const vpImage<uint16_t> &object)
 
   buffer.reserve(buffer.size() + sentSize + 1);
   buffer.push_back(endianness);
-  const uint8_t *const bitmap = (uint8_t *)object.bitmap;
-  buffer.insert(buffer.end(), bitmap, bitmap + sentSize);
+  const uint32_t rowSize = static_cast<uint32_t>(width) * 2;
+  for (unsigned int i = 0; i < object.getHeight(); ++i) {
+    const uint8_t *const row = (const uint8_t *)object[i];
+    buffer.insert(buffer.end(), row, row + rowSize);
+  }
 }
 
 template<>
@@ -264,15 +269,17 @@ void decode(const std::vector<uint8_t> &buffer, unsigned int &index, vpImage<vpR
   if (channels == 3) {
     for (int i = 0; i < height; ++i) {
       for (int j = 0; j < width; ++j) {
-        value.bitmap[i * width + j] = vpRGBa(buffer[index], buffer[index + 1], buffer[index + 2], 255);
+        value[i][j] = vpRGBa(buffer[index], buffer[index + 1], buffer[index + 2], 255);
         index += 3;
       }
     }
   }
   else if (channels == 4) { // Despite having 4 channels, this is faster
-    const unsigned int copySize = static_cast<unsigned int>(height * width * channels);
-    memcpy((uint8_t *)value.bitmap, &buffer[index], copySize);
-    index += copySize;
+    const unsigned int rowSize = static_cast<unsigned int>(width * channels);
+    for (int i = 0; i < height; ++i) {
+      memcpy((uint8_t *)value[i], &buffer[index], rowSize);
+      index += rowSize;
+    }
   }
 }
 
@@ -333,6 +333,10 @@ protected:
   vpRobust m_robust_edge;
   //! Display features
   std::vector<std::vector<double> > m_featuresToBeDisplayedEdge;
+  //! Number of threads used to track the moving edges
+  int m_meNbThread;
+  //! Copies of the moving edges parameters used by each thread
+  std::vector<vpMe> m_meThreads;
 public:
   vpMbEdgeTracker();
   virtual ~vpMbEdgeTracker() VP_OVERRIDE;
@@ -387,6 +391,13 @@ public:
    */
   inline double getGoodMovingEdgesRatioThreshold() const { return percentageGdPt; }
 
+  /*!
+   *  \return The number of threads used to track the moving edges.
+   *
+   *  \sa setMovingEdgeNbThread()
+   */
+  inline int getMovingEdgeNbThread() const { return m_meNbThread; }
+
   virtual inline vpColVector getError() const VP_OVERRIDE { return m_error_edge; }
 
   virtual inline vpColVector getRobustWeights() const VP_OVERRIDE { return m_w_edge; }
@@ -481,6 +492,8 @@ public:
 
   void setMovingEdge(const vpMe &me);
 
+  void setMovingEdgeNbThread(int nbThread);
+
   virtual void setPose(const vpImage<unsigned char> &I, const vpHomogeneousMatrix &cdMo) VP_OVERRIDE;
   virtual void setPose(const vpImage<vpRGBa> &I_color, const vpHomogeneousMatrix &cdMo) VP_OVERRIDE;
 
@@ -538,6 +538,7 @@ public:
   virtual void setMovingEdge(const vpMe &me);
   virtual void setMovingEdge(const vpMe &me1, const vpMe &me2);
   virtual void setMovingEdge(const std::map<std::string, vpMe> &mapOfMe);
+  virtual void setMovingEdgeNbThread(int nbThread);
 
   virtual void setNearClippingDistance(const double &dist) VP_OVERRIDE;
   virtual void setNearClippingDistance(const double &dist1, const double &dist2);
@@ -581,6 +582,8 @@ public:
   virtual void setUseKltTracking(const std::string &name, const bool &useKltTracking);
 #endif
 
+  virtual void setVVSNbThread(int nbThread) VP_OVERRIDE;
+
   virtual void testTracking() VP_OVERRIDE;
 
   virtual void track(const vpImage<unsigned char> &I) VP_OVERRIDE;
@@ -200,6 +200,8 @@ protected:
   double m_stopCriteriaEpsilon;
   //! Initial Mu for Levenberg Marquardt optimization loop
   double m_initialMu;
+  //! Number of threads used to build the normal equations of the virtual visual servoing stage
+  int m_vvsNbThread;
 
   //! Distance line primitives for projection error
   std::vector<vpMbtDistanceLine *> m_projectionErrorLines;
@@ -308,6 +310,13 @@ public:
    */
   virtual inline unsigned int getMaxIter() const { return m_maxIter; }
 
+  /*!
+    Get the number of threads used to build the normal equations of the virtual visual servoing stage.
+
+    \sa setVVSNbThread()
+  */
+  inline int getVVSNbThread() const { return m_vvsNbThread; }
+
   /*!
     Get the error angle between the gradient direction of the model features
     projected at the resulting pose and their normal. The error is expressed
@@ -555,6 +564,8 @@ public:
    */
   virtual inline void setMaxIter(unsigned int max) { m_maxIter = max; }
 
+  virtual void setVVSNbThread(int nbThread);
+
   virtual void setMinLineLengthThresh(double minLineLengthThresh, const std::string &name = "");
 
   virtual void setMinPolygonAreaThresh(double minPolygonAreaThresh, const std::string &name = "");
@@ -817,6 +828,8 @@ protected:
                                           const vpMatrix &LVJ_true, const vpColVector &error);
 
   void computeJTR(const vpMatrix &J, const vpColVector &R, vpColVector &JTR) const;
+  void computeWeightedNormalEquations(const vpMatrix &L, const vpColVector &w, const vpColVector &R, vpMatrix &LTL,
+                                      vpColVector &LTR) const;
 
   double computeProjectionErrorImpl(const vpImage<unsigned char> &I, const vpHomogeneousMatrix &_cMo,
                                     const vpCameraParameters &_cam, unsigned int &nbFeatures);
@@ -831,6 +844,11 @@ protected:
                                         vpColVector &R, const vpColVector &error, vpColVector &error_prev,
                                         vpColVector &LTR, double &mu, vpColVector &v, const vpColVector *const w = nullptr,
                                         vpColVector *const m_w_prev = nullptr);
+  void computeVVSWeightedPoseEstimation(const bool isoJoIdentity, unsigned int iter, const vpMatrix &L,
+                                        const vpColVector &w_L, vpMatrix &LTL, const vpColVector &R,
+                                        const vpColVector &error, vpColVector &error_prev, vpColVector &LTR, double &mu,
+                                        vpColVector &v, const vpColVector *const w = nullptr,
+                                        vpColVector *const m_w_prev = nullptr);
   virtual void computeVVSWeights(vpRobust &robust, const vpColVector &error, vpColVector &w);
 
 #ifdef VISP_HAVE_COIN3D
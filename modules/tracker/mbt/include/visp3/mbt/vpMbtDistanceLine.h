@@ -247,7 +247,7 @@ public:
   */
   inline void setMeanWeight(double w_mean) { this->wmean = w_mean; }
 
-  void setMovingEdge(vpMe *Me);
+  void setMovingEdge(vpMe *Me, bool resetMovingEdges = true);
 
   /*!
     Set the name of the line.
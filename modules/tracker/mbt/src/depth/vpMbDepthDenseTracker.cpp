@@ -252,15 +252,10 @@ void vpMbDepthDenseTracker::computeVVS()
         m_weightedError_depthDense[i] = m_w_depthDense[i] * m_error_depthDense[i];
         num += m_w_depthDense[i] * vpMath::sqr(m_error_depthDense[i]);
         den += m_w_depthDense[i];
-
-        // weight interaction matrix
-        for (unsigned int j = 0; j < 6; j++) {
-          m_L_depthDense[i][j] *= m_w_depthDense[i];
-        }
       }
 
-      computeVVSPoseEstimation(isoJoIdentity, iter, m_L_depthDense, LTL, m_weightedError_depthDense,
-                               m_error_depthDense, error_prev, LTR, mu, v);
+      computeVVSWeightedPoseEstimation(isoJoIdentity, iter, m_L_depthDense, m_w_depthDense, LTL,
+                                       m_weightedError_depthDense, m_error_depthDense, error_prev, LTR, mu, v);
 
       cMo_prev = m_cMo;
       m_cMo = vpExponentialMap::direct(v).inverse() * m_cMo;
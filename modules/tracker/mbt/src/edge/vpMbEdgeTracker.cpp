@@ -56,7 +56,50 @@
 #include <sstream>
 #include <string>
 
+#ifdef VISP_HAVE_OPENMP
+#include <omp.h>
+#endif
+
 BEGIN_VISP_NAMESPACE
+
+namespace
+{
+bool isDisplayed(const vpMeTracker *meTracker)
+{
+  return (meTracker != nullptr) && (meTracker->getDisplay() != vpMeSite::NONE);
+}
+
+bool isDisplayed(const vpMbtDistanceLine *l)
+{
+  for (size_t i = 0; i < l->meline.size(); ++i) {
+    if (isDisplayed(l->meline[i])) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool isDisplayed(const vpMbtDistanceCylinder *cy) { return isDisplayed(cy->meline1) || isDisplayed(cy->meline2); }
+
+bool isDisplayed(const vpMbtDistanceCircle *ci) { return isDisplayed(ci->meEllipse); }
+
+// Move the features whose moving edges are displayed while tracked to displayed, keeping the order of the others
+template <typename Feature>
+void partitionDisplayed(std::vector<Feature *> &features, std::vector<Feature *> &displayed)
+{
+  size_t n = 0;
+  for (size_t i = 0; i < features.size(); ++i) {
+    if (isDisplayed(features[i])) {
+      displayed.push_back(features[i]);
+    }
+    else {
+      features[n++] = features[i];
+    }
+  }
+  features.resize(n);
+}
+}
+
 /*!
   Basic constructor
 */
@@ -65,7 +108,7 @@ vpMbEdgeTracker::vpMbEdgeTracker()
   percentageGdPt(0.4), scales(1), Ipyramid(0), scaleLevel(0), nbFeaturesForProjErrorComputation(0), m_factor(),
   m_robustLines(), m_robustCylinders(), m_robustCircles(), m_wLines(), m_wCylinders(), m_wCircles(), m_errorLines(),
   m_errorCylinders(), m_errorCircles(), m_L_edge(), m_error_edge(), m_w_edge(), m_weightedError_edge(),
-  m_robust_edge(), m_featuresToBeDisplayedEdge()
+  m_robust_edge(), m_featuresToBeDisplayedEdge(), m_meNbThread(1), m_meThreads()
 {
   scales[0] = true;
 
@@ -127,6 +170,9 @@ vpMbEdgeTracker::~vpMbEdgeTracker()
 void vpMbEdgeTracker::setMovingEdge(const vpMe &p_me)
 {
   this->me = p_me;
+  if (!m_meThreads.empty()) {
+    m_meThreads.assign(m_meThreads.size(), this->me);
+  }
 
   for (unsigned int i = 0; i < scales.size(); i += 1) {
     if (scales[i]) {
@@ -197,6 +243,7 @@ void vpMbEdgeTracker::computeVVS(const vpImage<unsigned char> &I_, unsigned int
   /*** Second phase ***/
   vpHomogeneousMatrix cMoPrev;
   vpColVector W_true(nbrow);
+  vpColVector W_L(nbrow);
   vpMatrix L_true;
   vpMatrix LVJ_true;
 
@@ -236,38 +283,28 @@ void vpMbEdgeTracker::computeVVS(const vpImage<unsigned char> &I_, unsigned int
 
       double wi = 0.0, eri = 0.0;
       double num = 0.0, den = 0.0;
-      if ((iter == 0) || m_computeInteraction) {
-        for (unsigned int i = 0; i < nbrow; i++) {
-          wi = m_w_edge[i] * m_factor[i];
-          W_true[i] = wi;
-          eri = m_error_edge[i];
-          num += wi * vpMath::sqr(eri);
-          den += wi;
-
-          m_weightedError_edge[i] = wi * eri;
+      for (unsigned int i = 0; i < nbrow; i++) {
+        wi = m_w_edge[i] * m_factor[i];
+        W_true[i] = wi;
+        eri = m_error_edge[i];
+        num += wi * vpMath::sqr(eri);
+        den += wi;
 
-          for (unsigned int j = 0; j < 6; j++) {
-            m_L_edge[i][j] = wi * m_L_edge[i][j];
-          }
-        }
+        m_weightedError_edge[i] = wi * eri;
+      }
+      // The interaction matrix is weighted only when it is computed at each iteration
+      if ((iter == 0) || m_computeInteraction) {
+        W_L = W_true;
       }
       else {
-        for (unsigned int i = 0; i < nbrow; i++) {
-          wi = m_w_edge[i] * m_factor[i];
-          W_true[i] = wi;
-          eri = m_error_edge[i];
-          num += wi * vpMath::sqr(eri);
-          den += wi;
-
-          m_weightedError_edge[i] = wi * eri;
-        }
+        W_L = 1.0;
       }
 
       residu_1 = r;
       r = sqrt(num / den); // Le critere d'arret prend en compte le poids
 
-      computeVVSPoseEstimation(isoJoIdentity, iter, m_L_edge, LTL, m_weightedError_edge, m_error_edge, m_error_prev,
-                               LTR, mu, v, &m_w_edge, &m_w_prev);
+      computeVVSWeightedPoseEstimation(isoJoIdentity, iter, m_L_edge, W_L, LTL, m_weightedError_edge, m_error_edge,
+                                       m_error_prev, LTR, mu, v, &m_w_edge, &m_w_prev);
 
       cMoPrev = m_cMo;
       m_cMo = vpExponentialMap::direct(v).inverse() * m_cMo;
@@ -318,13 +355,13 @@ void vpMbEdgeTracker::computeVVSFirstPhase(const vpImage<unsigned char> &I_, uns
         }
       }
 
-      std::list<vpMeSite>::const_iterator itListLine;
+      std::vector<vpMeSite>::const_iterator itListLine;
 
       unsigned int indexFeature = 0;
 
       for (size_t a = 0; a < l->meline.size(); a++) {
         if (iter == 0 && l->meline[a] != nullptr)
-          itListLine = l->meline[a]->getMeList().begin();
+          itListLine = l->meline[a]->getMeSites().begin();
 
         for (unsigned int i = 0; i < l->nbFeature[a]; i++) {
           for (unsigned int j = 0; j < 6; j++) {
@@ -392,11 +429,11 @@ void vpMbEdgeTracker::computeVVSFirstPhase(const vpImage<unsigned char> &I_, uns
       cy->computeInteractionMatrixError(m_cMo, I_);
       double fac = 1.0;
 
-      std::list<vpMeSite>::const_iterator itCyl1;
-      std::list<vpMeSite>::const_iterator itCyl2;
+      std::vector<vpMeSite>::const_iterator itCyl1;
+      std::vector<vpMeSite>::const_iterator itCyl2;
       if (iter == 0 && (cy->meline1 != nullptr || cy->meline2 != nullptr)) {
-        itCyl1 = cy->meline1->getMeList().begin();
-        itCyl2 = cy->meline2->getMeList().begin();
+        itCyl1 = cy->meline1->getMeSites().begin();
+        itCyl2 = cy->meline2->getMeSites().begin();
       }
 
       for (unsigned int i = 0; i < cy->nbFeature; i++) {
@@ -489,9 +526,9 @@ void vpMbEdgeTracker::computeVVSFirstPhase(const vpImage<unsigned char> &I_, uns
       ci->computeInteractionMatrixError(m_cMo);
       double fac = 1.0;
 
-      std::list<vpMeSite>::const_iterator itCir;
+      std::vector<vpMeSite>::const_iterator itCir;
       if (iter == 0 && (ci->meEllipse != nullptr)) {
-        itCir = ci->meEllipse->getMeList().begin();
+        itCir = ci->meEllipse->getMeSites().begin();
       }
 
       for (unsigned int i = 0; i < ci->nbFeature; i++) {
@@ -580,9 +617,9 @@ void vpMbEdgeTracker::computeVVSFirstPhaseFactor(const vpImage<unsigned char> &I
       }
 
       for (size_t a = 0; a < l->meline.size(); a++) {
-        std::list<vpMeSite>::const_iterator itListLine;
+        std::vector<vpMeSite>::const_iterator itListLine;
         if (l->meline[a] != nullptr) {
-          itListLine = l->meline[a]->getMeList().begin();
+          itListLine = l->meline[a]->getMeSites().begin();
 
           for (unsigned int i = 0; i < l->nbFeature[a]; i++) {
             m_factor[n + i] = fac;
@@ -603,11 +640,11 @@ void vpMbEdgeTracker::computeVVSFirstPhaseFactor(const vpImage<unsigned char> &I
       cy = *it;
       cy->computeInteractionMatrixError(m_cMo, I);
 
-      std::list<vpMeSite>::const_iterator itCyl1;
-      std::list<vpMeSite>::const_iterator itCyl2;
+      std::vector<vpMeSite>::const_iterator itCyl1;
+      std::vector<vpMeSite>::const_iterator itCyl2;
       if ((cy->meline1 != nullptr || cy->meline2 != nullptr)) {
-        itCyl1 = cy->meline1->getMeList().begin();
-        itCyl2 = cy->meline2->getMeList().begin();
+        itCyl1 = cy->meline1->getMeSites().begin();
+        itCyl2 = cy->meline2->getMeSites().begin();
 
         double fac = 1.0;
         for (unsigned int i = 0; i < cy->nbFeature; i++) {
@@ -634,9 +671,9 @@ void vpMbEdgeTracker::computeVVSFirstPhaseFactor(const vpImage<unsigned char> &I
       ci = *it;
       ci->computeInteractionMatrixError(m_cMo);
 
-      std::list<vpMeSite>::const_iterator itCir;
+      std::vector<vpMeSite>::const_iterator itCir;
       if (ci->meEllipse != nullptr) {
-        itCir = ci->meEllipse->getMeList().begin();
+        itCir = ci->meEllipse->getMeSites().begin();
         double fac = 1.0;
 
         for (unsigned int i = 0; i < ci->nbFeature; i++) {
@@ -951,8 +988,8 @@ void vpMbEdgeTracker::testTracking()
       for (size_t a = 0; a < l->meline.size(); a++) {
         if (l->meline[a] != nullptr) {
           nbExpectedPoint += static_cast<int>(l->meline[a]->expecteddensity);
-          for (std::list<vpMeSite>::const_iterator itme = l->meline[a]->getMeList().begin();
-               itme != l->meline[a]->getMeList().end(); ++itme) {
+          for (std::vector<vpMeSite>::const_iterator itme = l->meline[a]->getMeSites().begin();
+               itme != l->meline[a]->getMeSites().end(); ++itme) {
             vpMeSite pix = *itme;
             if (pix.getState() == vpMeSite::NO_SUPPRESSION)
               nbGoodPoint++;
@@ -969,8 +1006,8 @@ void vpMbEdgeTracker::testTracking()
     vpMbtDistanceCylinder *cy = *it;
     if ((cy->meline1 != nullptr && cy->meline2 != nullptr) && cy->isVisible() && cy->isTracked()) {
       nbExpectedPoint += static_cast<int>(cy->meline1->expecteddensity);
-      for (std::list<vpMeSite>::const_iterator itme1 = cy->meline1->getMeList().begin();
-           itme1 != cy->meline1->getMeList().end(); ++itme1) {
+      for (std::vector<vpMeSite>::const_iterator itme1 = cy->meline1->getMeSites().begin();
+           itme1 != cy->meline1->getMeSites().end(); ++itme1) {
         vpMeSite pix = *itme1;
         if (pix.getState() == vpMeSite::NO_SUPPRESSION)
           nbGoodPoint++;
@@ -978,8 +1015,8 @@ void vpMbEdgeTracker::testTracking()
           nbBadPoint++;
       }
       nbExpectedPoint += static_cast<int>(cy->meline2->expecteddensity);
-      for (std::list<vpMeSite>::const_iterator itme2 = cy->meline2->getMeList().begin();
-           itme2 != cy->meline2->getMeList().end(); ++itme2) {
+      for (std::vector<vpMeSite>::const_iterator itme2 = cy->meline2->getMeSites().begin();
+           itme2 != cy->meline2->getMeSites().end(); ++itme2) {
         vpMeSite pix = *itme2;
         if (pix.getState() == vpMeSite::NO_SUPPRESSION)
           nbGoodPoint++;
@@ -994,8 +1031,8 @@ void vpMbEdgeTracker::testTracking()
     vpMbtDistanceCircle *ci = *it;
     if (ci->isVisible() && ci->isTracked() && ci->meEllipse != nullptr) {
       nbExpectedPoint += static_cast<int>(ci->meEllipse->getExpectedDensity());
-      for (std::list<vpMeSite>::const_iterator itme = ci->meEllipse->getMeList().begin();
-           itme != ci->meEllipse->getMeList().end(); ++itme) {
+      for (std::vector<vpMeSite>::const_iterator itme = ci->meEllipse->getMeSites().begin();
+           itme != ci->meEllipse->getMeSites().end(); ++itme) {
         vpMeSite pix = *itme;
         if (pix.getState() == vpMeSite::NO_SUPPRESSION)
           nbGoodPoint++;
@@ -1666,6 +1703,9 @@ void vpMbEdgeTracker::trackMovingEdge(const vpImage<unsigned char> &I)
 {
   const bool doNotTrack = false;
 
+  // The features without moving edges are initialized first. Since the initialization relies on the shared moving
+  // edges parameters, it is done sequentially
+  std::vector<vpMbtDistanceLine *> linesToTrack;
   for (std::list<vpMbtDistanceLine *>::const_iterator it = lines[scaleLevel].begin(); it != lines[scaleLevel].end();
        ++it) {
     vpMbtDistanceLine *l = *it;
@@ -1673,10 +1713,11 @@ void vpMbEdgeTracker::trackMovingEdge(const vpImage<unsigned char> &I)
       if (l->meline.empty()) {
         l->initMovingEdge(I, m_cMo, doNotTrack, m_mask);
       }
-      l->trackMovingEdge(I);
+      linesToTrack.push_back(l);
     }
   }
 
+  std::vector<vpMbtDistanceCylinder *> cylindersToTrack;
   for (std::list<vpMbtDistanceCylinder *>::const_iterator it = cylinders[scaleLevel].begin();
        it != cylinders[scaleLevel].end(); ++it) {
     vpMbtDistanceCylinder *cy = *it;
@@ -1684,10 +1725,11 @@ void vpMbEdgeTracker::trackMovingEdge(const vpImage<unsigned char> &I)
       if (cy->meline1 == nullptr || cy->meline2 == nullptr) {
         cy->initMovingEdge(I, m_cMo, doNotTrack, m_mask);
       }
-      cy->trackMovingEdge(I, m_cMo);
+      cylindersToTrack.push_back(cy);
     }
   }
 
+  std::vector<vpMbtDistanceCircle *> circlesToTrack;
   for (std::list<vpMbtDistanceCircle *>::const_iterator it = circles[scaleLevel].begin();
        it != circles[scaleLevel].end(); ++it) {
     vpMbtDistanceCircle *ci = *it;
@@ -1695,9 +1737,97 @@ void vpMbEdgeTracker::trackMovingEdge(const vpImage<unsigned char> &I)
       if (ci->meEllipse == nullptr) {
         ci->initMovingEdge(I, m_cMo, doNotTrack, m_mask);
       }
+      circlesToTrack.push_back(ci);
+    }
+  }
+
+  // Since the displays are not thread-safe, the features that are displayed while tracked are left to the calling
+  // thread
+  std::vector<vpMbtDistanceLine *> displayedLines;
+  std::vector<vpMbtDistanceCylinder *> displayedCylinders;
+  std::vector<vpMbtDistanceCircle *> displayedCircles;
+  if (m_meNbThread > 1) {
+    partitionDisplayed(linesToTrack, displayedLines);
+    partitionDisplayed(cylindersToTrack, displayedCylinders);
+    partitionDisplayed(circlesToTrack, displayedCircles);
+  }
+
+  const int nbLines = static_cast<int>(linesToTrack.size());
+  const int nbCylinders = static_cast<int>(cylindersToTrack.size());
+  const int nbFeatures = nbLines + nbCylinders + static_cast<int>(circlesToTrack.size());
+  const int nbThread = (m_meNbThread > 1) ? std::min<int>(m_meNbThread, nbFeatures) : 1;
+
+  // The features are tracked independently. Since the moving edges parameters are temporarily modified while a
+  // feature is tracked, each thread works on its own copy of them, kept up to date by setMovingEdge()
+  if (static_cast<int>(m_meThreads.size()) < nbThread) {
+    m_meThreads.assign(static_cast<size_t>(nbThread), me);
+  }
+
+#ifdef VISP_HAVE_OPENMP
+#pragma omp parallel for num_threads(nbThread) schedule(dynamic) if (nbThread > 1)
+#endif
+  for (int k = 0; k < nbFeatures; ++k) {
+    vpMe *p_me = &me;
+#ifdef VISP_HAVE_OPENMP
+    if (nbThread > 1) {
+      p_me = &m_meThreads[static_cast<size_t>(omp_get_thread_num())];
+    }
+#endif
+    if (k < nbLines) {
+      vpMbtDistanceLine *l = linesToTrack[static_cast<size_t>(k)];
+      l->setMovingEdge(p_me, false);
+      l->trackMovingEdge(I);
+      l->setMovingEdge(&me, false);
+    }
+    else if (k < (nbLines + nbCylinders)) {
+      vpMbtDistanceCylinder *cy = cylindersToTrack[static_cast<size_t>(k - nbLines)];
+      cy->setMovingEdge(p_me);
+      cy->trackMovingEdge(I, m_cMo);
+      cy->setMovingEdge(&me);
+    }
+    else {
+      vpMbtDistanceCircle *ci = circlesToTrack[static_cast<size_t>(k - nbLines - nbCylinders)];
+      ci->setMovingEdge(p_me);
       ci->trackMovingEdge(I, m_cMo);
+      ci->setMovingEdge(&me);
     }
   }
+
+  for (size_t i = 0; i < displayedLines.size(); ++i) {
+    displayedLines[i]->trackMovingEdge(I);
+  }
+  for (size_t i = 0; i < displayedCylinders.size(); ++i) {
+    displayedCylinders[i]->trackMovingEdge(I, m_cMo);
+  }
+  for (size_t i = 0; i < displayedCircles.size(); ++i) {
+    displayedCircles[i]->trackMovingEdge(I, m_cMo);
+  }
+}
+
+/*!
+  Set the number of threads used to track the moving edges of the lines, cylinders and circles. The features are
+  partitioned across the threads and tracked independently, so that the tracking result does not depend on the
+  number of threads.
+
+  \param nbThread : Number of threads. 1 (default) keeps the sequential tracking, a negative value uses the maximum
+  number of threads available. Without OpenMP, the tracking remains sequential.
+
+  \sa getMovingEdgeNbThread()
+*/
+void vpMbEdgeTracker::setMovingEdgeNbThread(int nbThread)
+{
+#ifdef VISP_HAVE_OPENMP
+  m_meNbThread = (nbThread < 0) ? omp_get_max_threads() : std::max<int>(nbThread, 1);
+#else
+  (void)nbThread;
+  m_meNbThread = 1;
+#endif
+  if (m_meNbThread > 1) {
+    m_meThreads.assign(static_cast<size_t>(m_meNbThread), me);
+  }
+  else {
+    m_meThreads.clear();
+  }
 }
 
 /*!
@@ -1757,8 +1887,8 @@ void vpMbEdgeTracker::updateMovingEdgeWeights()
       double wmean = 0;
       for (size_t a = 0; a < l->meline.size(); a++) {
         if (l->nbFeature[a] > 0) {
-          std::list<vpMeSite>::iterator itListLine;
-          itListLine = l->meline[a]->getMeList().begin();
+          std::vector<vpMeSite>::iterator itListLine;
+          itListLine = l->meline[a]->getMeSites().begin();
 
           for (unsigned int i = 0; i < l->nbFeature[a]; i++) {
             wmean += m_w_edge[n + indexLine];
@@ -1795,12 +1925,12 @@ void vpMbEdgeTracker::updateMovingEdgeWeights()
     if ((*it)->isTracked()) {
       cy = *it;
       double wmean = 0;
-      std::list<vpMeSite>::iterator itListCyl1;
-      std::list<vpMeSite>::iterator itListCyl2;
+      std::vector<vpMeSite>::iterator itListCyl1;
+      std::vector<vpMeSite>::iterator itListCyl2;
 
       if (cy->nbFeature > 0) {
-        itListCyl1 = cy->meline1->getMeList().begin();
-        itListCyl2 = cy->meline2->getMeList().begin();
+        itListCyl1 = cy->meline1->getMeSites().begin();
+        itListCyl2 = cy->meline2->getMeSites().begin();
 
         for (unsigned int i = 0; i < cy->nbFeaturel1; i++) {
           wmean += m_w_edge[n + i];
@@ -1861,10 +1991,10 @@ void vpMbEdgeTracker::updateMovingEdgeWeights()
     if ((*it)->isTracked()) {
       ci = *it;
       double wmean = 0;
-      std::list<vpMeSite>::iterator itListCir;
+      std::vector<vpMeSite>::iterator itListCir;
 
       if (ci->nbFeature > 0) {
-        itListCir = ci->meEllipse->getMeList().begin();
+        itListCir = ci->meEllipse->getMeSites().begin();
       }
 
       wmean = 0;
@@ -2553,8 +2683,8 @@ unsigned int vpMbEdgeTracker::getNbPoints(unsigned int level) const
     if (l->isVisible() && l->isTracked()) {
       for (size_t a = 0; a < l->meline.size(); a++) {
         if (l->nbFeature[a] != 0)
-          for (std::list<vpMeSite>::const_iterator itme = l->meline[a]->getMeList().begin();
-               itme != l->meline[a]->getMeList().end(); ++itme) {
+          for (std::vector<vpMeSite>::const_iterator itme = l->meline[a]->getMeSites().begin();
+               itme != l->meline[a]->getMeSites().end(); ++itme) {
           if (itme->getState() == vpMeSite::NO_SUPPRESSION)
             nbGoodPoints++;
         }
@@ -2567,13 +2697,13 @@ unsigned int vpMbEdgeTracker::getNbPoints(unsigned int level) const
        ++it) {
     cy = *it;
     if (cy->isVisible() && cy->isTracked() && (cy->meline1 != nullptr || cy->meline2 != nullptr)) {
-      for (std::list<vpMeSite>::const_iterator itme1 = cy->meline1->getMeList().begin();
-           itme1 != cy->meline1->getMeList().end(); ++itme1) {
+      for (std::vector<vpMeSite>::const_iterator itme1 = cy->meline1->getMeSites().begin();
+           itme1 != cy->meline1->getMeSites().end(); ++itme1) {
         if (itme1->getState() == vpMeSite::NO_SUPPRESSION)
           nbGoodPoints++;
       }
-      for (std::list<vpMeSite>::const_iterator itme2 = cy->meline2->getMeList().begin();
-           itme2 != cy->meline2->getMeList().end(); ++itme2) {
+      for (std::vector<vpMeSite>::const_iterator itme2 = cy->meline2->getMeSites().begin();
+           itme2 != cy->meline2->getMeSites().end(); ++itme2) {
         if (itme2->getState() == vpMeSite::NO_SUPPRESSION)
           nbGoodPoints++;
       }
@@ -2584,8 +2714,8 @@ unsigned int vpMbEdgeTracker::getNbPoints(unsigned int level) const
   for (std::list<vpMbtDistanceCircle *>::const_iterator it = circles[level].begin(); it != circles[level].end(); ++it) {
     ci = *it;
     if (ci->isVisible() && ci->isTracked() && ci->meEllipse != nullptr) {
-      for (std::list<vpMeSite>::const_iterator itme = ci->meEllipse->getMeList().begin();
-           itme != ci->meEllipse->getMeList().end(); ++itme) {
+      for (std::vector<vpMeSite>::const_iterator itme = ci->meEllipse->getMeSites().begin();
+           itme != ci->meEllipse->getMeSites().end(); ++itme) {
         if (itme->getState() == vpMeSite::NO_SUPPRESSION)
           nbGoodPoints++;
       }
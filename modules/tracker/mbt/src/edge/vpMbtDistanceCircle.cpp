@@ -219,7 +219,7 @@ void vpMbtDistanceCircle::trackMovingEdge(const vpImage<unsigned char> &I, const
     }
 
     // Update the number of features
-    nbFeature = static_cast<unsigned int>(meEllipse->getMeList().size());
+    nbFeature = static_cast<unsigned int>(meEllipse->getMeSites().size());
   }
   me->setInitRange(oldInitRange);
 }
@@ -256,7 +256,7 @@ void vpMbtDistanceCircle::updateMovingEdge(const vpImage<unsigned char> &I, cons
     catch (...) {
       Reinit = true;
     }
-    nbFeature = static_cast<unsigned int>(meEllipse->getMeList().size());
+    nbFeature = static_cast<unsigned int>(meEllipse->getMeSites().size());
   }
   me->setInitRange(oldInitRange);
 }
@@ -343,7 +343,7 @@ std::vector<std::vector<double> > vpMbtDistanceCircle::getFeaturesForDisplay()
   std::vector<std::vector<double> > features;
 
   if (meEllipse != nullptr) {
-    for (std::list<vpMeSite>::const_iterator it = meEllipse->getMeList().begin(); it != meEllipse->getMeList().end();
+    for (std::vector<vpMeSite>::const_iterator it = meEllipse->getMeSites().begin(); it != meEllipse->getMeSites().end();
          ++it) {
       vpMeSite p_me = *it;
 #if (VISP_CXX_STANDARD > VISP_CXX_STANDARD_98)
@@ -443,7 +443,7 @@ void vpMbtDistanceCircle::displayMovingEdges(const vpImage<vpRGBa> &I)
 void vpMbtDistanceCircle::initInteractionMatrixError()
 {
   if (isvisible) {
-    nbFeature = static_cast<unsigned int>(meEllipse->getMeList().size());
+    nbFeature = static_cast<unsigned int>(meEllipse->getMeSites().size());
     L.resize(nbFeature, 6);
     error.resize(nbFeature);
   }
@@ -483,7 +483,7 @@ void vpMbtDistanceCircle::computeInteractionMatrixError(const vpHomogeneousMatri
 
     unsigned int j = 0;
 
-    for (std::list<vpMeSite>::const_iterator it = meEllipse->getMeList().begin(); it != meEllipse->getMeList().end();
+    for (std::vector<vpMeSite>::const_iterator it = meEllipse->getMeSites().begin(); it != meEllipse->getMeSites().end();
          ++it) {
       vpPixelMeterConversion::convertPoint(cam, it->m_j, it->m_i, x, y);
       // TRO Chaumette 2004 eq 25
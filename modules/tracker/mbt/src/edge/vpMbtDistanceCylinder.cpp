@@ -362,8 +362,8 @@ void vpMbtDistanceCylinder::trackMovingEdge(const vpImage<unsigned char> &I, con
     }
 
     // Update the number of features
-    nbFeaturel1 = static_cast<unsigned int>(meline1->getMeList().size());
-    nbFeaturel2 = static_cast<unsigned int>(meline2->getMeList().size());
+    nbFeaturel1 = static_cast<unsigned int>(meline1->getMeSites().size());
+    nbFeaturel2 = static_cast<unsigned int>(meline2->getMeSites().size());
     nbFeature = nbFeaturel1 + nbFeaturel2;
   }
   me->setInitRange(oldInitRange);
@@ -504,8 +504,8 @@ void vpMbtDistanceCylinder::updateMovingEdge(const vpImage<unsigned char> &I, co
     }
 
     // Update the numbers of features
-    nbFeaturel1 = static_cast<unsigned int>(meline1->getMeList().size());
-    nbFeaturel2 = static_cast<unsigned int>(meline2->getMeList().size());
+    nbFeaturel1 = static_cast<unsigned int>(meline1->getMeSites().size());
+    nbFeaturel2 = static_cast<unsigned int>(meline2->getMeSites().size());
     nbFeature = nbFeaturel1 + nbFeaturel2;
   }
   me->setInitRange(oldInitRange);
@@ -598,7 +598,7 @@ std::vector<std::vector<double> > vpMbtDistanceCylinder::getFeaturesForDisplay()
   std::vector<std::vector<double> > features;
 
   if (meline1 != nullptr) {
-    for (std::list<vpMeSite>::const_iterator it = meline1->getMeList().begin(); it != meline1->getMeList().end();
+    for (std::vector<vpMeSite>::const_iterator it = meline1->getMeSites().begin(); it != meline1->getMeSites().end();
          ++it) {
       vpMeSite p_me = *it;
 #if (VISP_CXX_STANDARD > VISP_CXX_STANDARD_98)
@@ -619,7 +619,7 @@ std::vector<std::vector<double> > vpMbtDistanceCylinder::getFeaturesForDisplay()
   }
 
   if (meline2 != nullptr) {
-    for (std::list<vpMeSite>::const_iterator it = meline2->getMeList().begin(); it != meline2->getMeList().end();
+    for (std::vector<vpMeSite>::const_iterator it = meline2->getMeSites().begin(); it != meline2->getMeSites().end();
          ++it) {
       vpMeSite p_me = *it;
 #if (VISP_CXX_STANDARD > VISP_CXX_STANDARD_98)
@@ -783,8 +783,8 @@ void vpMbtDistanceCylinder::displayMovingEdges(const vpImage<vpRGBa> &I)
 void vpMbtDistanceCylinder::initInteractionMatrixError()
 {
   if (isvisible) {
-    nbFeaturel1 = static_cast<unsigned int>(meline1->getMeList().size());
-    nbFeaturel2 = static_cast<unsigned int>(meline2->getMeList().size());
+    nbFeaturel1 = static_cast<unsigned int>(meline1->getMeSites().size());
+    nbFeaturel2 = static_cast<unsigned int>(meline2->getMeSites().size());
     nbFeature = nbFeaturel1 + nbFeaturel2;
     L.resize(nbFeature, 6);
     error.resize(nbFeature);
@@ -853,7 +853,7 @@ void vpMbtDistanceCylinder::computeInteractionMatrixError(const vpHomogeneousMat
 
     vpMeSite p;
     unsigned int j = 0;
-    for (std::list<vpMeSite>::const_iterator it = meline1->getMeList().begin(); it != meline1->getMeList().end();
+    for (std::vector<vpMeSite>::const_iterator it = meline1->getMeSites().begin(); it != meline1->getMeSites().end();
          ++it) {
       double x = static_cast<double>(it->m_j);
       double y = static_cast<double>(it->m_i);
@@ -877,7 +877,7 @@ void vpMbtDistanceCylinder::computeInteractionMatrixError(const vpHomogeneousMat
       j++;
     }
 
-    for (std::list<vpMeSite>::const_iterator it = meline2->getMeList().begin(); it != meline2->getMeList().end();
+    for (std::vector<vpMeSite>::const_iterator it = meline2->getMeSites().begin(); it != meline2->getMeSites().end();
          ++it) {
       double x = static_cast<double>(it->m_j);
       double y = static_cast<double>(it->m_i);
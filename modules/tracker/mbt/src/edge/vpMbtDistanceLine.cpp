@@ -280,15 +280,18 @@ void vpMbtDistanceLine::updateTracked()
   Set the moving edge parameters.
 
   \param _me : an instance of vpMe containing all the desired parameters
+  \param resetMovingEdges : If true, the moving edges already tracked along the line are removed.
 */
-void vpMbtDistanceLine::setMovingEdge(vpMe *_me)
+void vpMbtDistanceLine::setMovingEdge(vpMe *_me, bool resetMovingEdges)
 {
   me = _me;
 
   for (unsigned int i = 0; i < meline.size(); i++)
     if (meline[i] != nullptr) {
       //      nbFeature[i] = 0;
-      meline[i]->reset();
+      if (resetMovingEdges) {
+        meline[i]->reset();
+      }
       meline[i]->setMe(me);
     }
 
@@ -412,7 +415,7 @@ bool vpMbtDistanceLine::initMovingEdge(const vpImage<unsigned char> &I, const vp
           melinePt->initTracking(I, ip1, ip2, rho, theta, doNotTrack);
           me->setInitRange(oldInitRange);
           meline.push_back(melinePt);
-          nbFeature.push_back(static_cast<unsigned int>(melinePt->getMeList().size()));
+          nbFeature.push_back(static_cast<unsigned int>(melinePt->getMeSites().size()));
           nbFeatureTotal += nbFeature.back();
         }
         catch (...) {
@@ -446,8 +449,8 @@ void vpMbtDistanceLine::trackMovingEdge(const vpImage<unsigned char> &I)
       nbFeatureTotal = 0;
       for (size_t i = 0; i < meline.size(); i++) {
         meline[i]->track(I);
-        nbFeature.push_back(static_cast<unsigned int>(meline[i]->getMeList().size()));
-        nbFeatureTotal += static_cast<unsigned int>(meline[i]->getMeList().size());
+        nbFeature.push_back(static_cast<unsigned int>(meline[i]->getMeSites().size()));
+        nbFeatureTotal += static_cast<unsigned int>(meline[i]->getMeSites().size());
       }
     }
     catch (...) {
@@ -570,7 +573,7 @@ void vpMbtDistanceLine::updateMovingEdge(const vpImage<unsigned char> &I, const
             }
             me->setInitRange(defaultRange);
             meline[i]->updateParameters(I, ip1, ip2, rho, theta);
-            nbFeature[i] = static_cast<unsigned int>(meline[i]->getMeList().size());
+            nbFeature[i] = static_cast<unsigned int>(meline[i]->getMeSites().size());
             nbFeatureTotal += nbFeature[i];
           }
         }
@@ -724,7 +727,7 @@ std::vector<std::vector<double> > vpMbtDistanceLine::getFeaturesForDisplay()
   for (size_t i = 0; i < meline.size(); i++) {
     vpMbtMeLine *me_l = meline[i];
     if (me_l != nullptr) {
-      for (std::list<vpMeSite>::const_iterator it = me_l->getMeList().begin(); it != me_l->getMeList().end(); ++it) {
+      for (std::vector<vpMeSite>::const_iterator it = me_l->getMeSites().begin(); it != me_l->getMeSites().end(); ++it) {
         vpMeSite p_me_l = *it;
 #if (VISP_CXX_STANDARD > VISP_CXX_STANDARD_98)
         std::vector<double> params = { 0, //ME
@@ -835,7 +838,7 @@ void vpMbtDistanceLine::initInteractionMatrixError()
     for (size_t i = 0; i < meline.size(); i++) {
       nbFeature[i] = 0;
       // To be consistent with nbFeature[i] = 0
-      std::list<vpMeSite> &me_site_list = meline[i]->getMeList();
+      std::vector<vpMeSite> &me_site_list = meline[i]->getMeSites();
       me_site_list.clear();
     }
     nbFeatureTotal = 0;
@@ -874,8 +877,8 @@ void vpMbtDistanceLine::computeInteractionMatrixError(const vpHomogeneousMatrix
       unsigned int j = 0;
 
       for (size_t i = 0; i < meline.size(); i++) {
-        for (std::list<vpMeSite>::const_iterator it = meline[i]->getMeList().begin();
-             it != meline[i]->getMeList().end(); ++it) {
+        for (std::vector<vpMeSite>::const_iterator it = meline[i]->getMeSites().begin();
+             it != meline[i]->getMeSites().end(); ++it) {
           x = static_cast<double>(it->m_j);
           y = static_cast<double>(it->m_i);
 
@@ -900,8 +903,8 @@ void vpMbtDistanceLine::computeInteractionMatrixError(const vpHomogeneousMatrix
    // Set the corresponding interaction matrix part to zero
       unsigned int j = 0;
       for (size_t i = 0; i < meline.size(); i++) {
-        for (std::list<vpMeSite>::const_iterator it = meline[i]->getMeList().begin();
-             it != meline[i]->getMeList().end(); ++it) {
+        for (std::vector<vpMeSite>::const_iterator it = meline[i]->getMeSites().begin();
+             it != meline[i]->getMeSites().end(); ++it) {
           for (unsigned int k = 0; k < 6; k++) {
             L[j][k] = 0.0;
           }
@@ -930,7 +933,7 @@ bool vpMbtDistanceLine::closeToImageBorder(const vpImage<unsigned char> &I, cons
   if (isvisible) {
 
     for (size_t i = 0; i < meline.size(); i++) {
-      for (std::list<vpMeSite>::const_iterator it = meline[i]->getMeList().begin(); it != meline[i]->getMeList().end();
+      for (std::vector<vpMeSite>::const_iterator it = meline[i]->getMeSites().begin(); it != meline[i]->getMeSites().end();
            ++it) {
         int i_ = it->m_i;
         int j_ = it->m_j;
@@ -79,7 +79,7 @@ void vpMbtMeEllipse::computeProjectionError(const vpImage<unsigned char> &I, dou
   vpColVector vecSite(2);
   vpColVector vecGrad(2);
 
-  for (std::list<vpMeSite>::iterator it = m_meList.begin(); it != m_meList.end(); ++it) {
+  for (std::vector<vpMeSite>::iterator it = m_meList.begin(); it != m_meList.end(); ++it) {
     double iSite = it->m_ifloat;
     double jSite = it->m_jfloat;
 
@@ -357,14 +357,15 @@ void vpMbtMeEllipse::sample(const vpImage<unsigned char> &I, bool doNotTrack)
 */
 void vpMbtMeEllipse::suppressPoints()
 {
-  // Loop through list of sites to track
-  for (std::list<vpMeSite>::iterator it = m_meList.begin(); it != m_meList.end();) {
-    vpMeSite s = *it; // current reference pixel
-    if (s.getState() != vpMeSite::NO_SUPPRESSION)
-      it = m_meList.erase(it);
-    else
-      ++it;
+  // Loop through list of sites to track, the kept ones are moved at the beginning
+  std::vector<vpMeSite>::iterator kept = m_meList.begin();
+  for (std::vector<vpMeSite>::iterator it = m_meList.begin(); it != m_meList.end(); ++it) {
+    if (it->getState() == vpMeSite::NO_SUPPRESSION) {
+      *kept = *it;
+      ++kept;
+    }
   }
+  m_meList.erase(kept, m_meList.end());
 }
 END_VISP_NAMESPACE
 #endif // #ifndef DOXYGEN_SHOULD_SKIP_THIS
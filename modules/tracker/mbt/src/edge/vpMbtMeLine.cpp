@@ -204,9 +204,9 @@ unsigned int vpMbtMeLine::seekExtremities(const vpImage<unsigned char> &I)
         double contrastThreshold = fabs(convolution) * marginRatio;
         P.setContrastThreshold(contrastThreshold, *m_me);
         // fin ajout
-        P.track(I, m_me, false);
+        P.track(I, m_me, false, m_queryBuffer);
         if (P.getState() == vpMeSite::NO_SUPPRESSION) {
-          m_meList.push_front(P);
+          m_meList.insert(m_meList.begin(), P);
           nb_added_points++;
           if (vpDEBUG_ENABLE(3)) {
             vpDisplay::displayCross(I, iP, 5, vpColor::green);
@@ -252,7 +252,7 @@ unsigned int vpMbtMeLine::seekExtremities(const vpImage<unsigned char> &I)
         double contrastThreshold = fabs(convolution) * marginRatio;
         P.setContrastThreshold(contrastThreshold, *m_me);
         // fin ajout
-        P.track(I, m_me, false);
+        P.track(I, m_me, false, m_queryBuffer);
         if (P.getState() == vpMeSite::NO_SUPPRESSION) {
           m_meList.push_back(P);
           nb_added_points++;
@@ -280,8 +280,10 @@ unsigned int vpMbtMeLine::seekExtremities(const vpImage<unsigned char> &I)
 */
 void vpMbtMeLine::suppressPoints(const vpImage<unsigned char> &I)
 {
-  for (std::list<vpMeSite>::iterator it = m_meList.begin(); it != m_meList.end();) {
-    vpMeSite s = *it; // current reference pixel
+  // The kept sites are moved at the beginning
+  std::vector<vpMeSite>::iterator kept = m_meList.begin();
+  for (std::vector<vpMeSite>::iterator it = m_meList.begin(); it != m_meList.end(); ++it) {
+    vpMeSite &s = *it; // current reference pixel
 
     // Vertical line management
     if (fabs(sin(m_theta)) > 0.9) {
@@ -304,13 +306,12 @@ void vpMbtMeLine::suppressPoints(const vpImage<unsigned char> &I)
       s.setState(vpMeSite::TOO_NEAR);
     }
 
-    if (s.getState() != vpMeSite::NO_SUPPRESSION) {
-      it = m_meList.erase(it);
-    }
-    else {
-      ++it;
+    if (s.getState() == vpMeSite::NO_SUPPRESSION) {
+      *kept = s;
+      ++kept;
     }
   }
+  m_meList.erase(kept, m_meList.end());
 }
 
 /*!
@@ -350,7 +351,7 @@ void vpMbtMeLine::computeProjectionError(const vpImage<unsigned char> &I, double
 
   double offset = std::floor(SobelX.getRows() / 2.0);
 
-  for (std::list<vpMeSite>::const_iterator it = m_meList.begin(); it != m_meList.end(); ++it) {
+  for (std::vector<vpMeSite>::const_iterator it = m_meList.begin(); it != m_meList.end(); ++it) {
     if (iter != 0 && iter + 1 != m_meList.size()) {
       double gradientX = 0;
       double gradientY = 0;
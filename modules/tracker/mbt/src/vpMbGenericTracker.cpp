@@ -408,10 +408,6 @@ void vpMbGenericTracker::computeVVS(std::map<std::string, const vpImage<unsigned
 
             num += wi * vpMath::sqr(m_error[start_index + i]);
             den += wi;
-
-            for (unsigned int j = 0; j < m_L.getCols(); j++) {
-              m_L[start_index + i][j] *= wi;
-            }
           }
 
           start_index += tracker->m_error_edge.getRows();
@@ -426,10 +422,6 @@ void vpMbGenericTracker::computeVVS(std::map<std::string, const vpImage<unsigned
 
             num += wi * vpMath::sqr(m_error[start_index + i]);
             den += wi;
-
-            for (unsigned int j = 0; j < m_L.getCols(); j++) {
-              m_L[start_index + i][j] *= wi;
-            }
           }
 
           start_index += tracker->m_error_klt.getRows();
@@ -444,10 +436,6 @@ void vpMbGenericTracker::computeVVS(std::map<std::string, const vpImage<unsigned
 
             num += wi * vpMath::sqr(m_error[start_index + i]);
             den += wi;
-
-            for (unsigned int j = 0; j < m_L.getCols(); j++) {
-              m_L[start_index + i][j] *= wi;
-            }
           }
 
           start_index += tracker->m_error_depthNormal.getRows();
@@ -461,10 +449,6 @@ void vpMbGenericTracker::computeVVS(std::map<std::string, const vpImage<unsigned
 
             num += wi * vpMath::sqr(m_error[start_index + i]);
             den += wi;
-
-            for (unsigned int j = 0; j < m_L.getCols(); j++) {
-              m_L[start_index + i][j] *= wi;
-            }
           }
 
           start_index += tracker->m_error_depthDense.getRows();
@@ -474,7 +458,8 @@ void vpMbGenericTracker::computeVVS(std::map<std::string, const vpImage<unsigned
       normRes_1 = normRes;
       normRes = sqrt(num / den);
 
-      computeVVSPoseEstimation(isoJoIdentity, iter, m_L, LTL, m_weightedError, m_error, error_prev, LTR, mu, v);
+      computeVVSWeightedPoseEstimation(isoJoIdentity, iter, m_L, W_true, LTL, m_weightedError, m_error, error_prev, LTR,
+                                       mu, v);
 
       cMo_prev = m_cMo;
 
@@ -4683,6 +4668,25 @@ void vpMbGenericTracker::setMovingEdge(const std::map<std::string, vpMe> &mapOfM
   }
 }
 
+/*!
+  Set the number of threads used to track the moving edges of each camera.
+
+  \param nbThread : Number of threads. 1 (default) keeps the sequential tracking, a negative value uses the maximum
+  number of threads available.
+
+  \note This function will set the new parameter for all the cameras.
+
+  \sa vpMbEdgeTracker::setMovingEdgeNbThread()
+*/
+void vpMbGenericTracker::setMovingEdgeNbThread(int nbThread)
+{
+  for (std::map<std::string, TrackerWrapper *>::const_iterator it = m_mapOfTrackers.begin();
+    it != m_mapOfTrackers.end(); ++it) {
+    TrackerWrapper *tracker = it->second;
+    tracker->setMovingEdgeNbThread(nbThread);
+  }
+}
+
 /*!
   Set the near distance for clipping.
 
@@ -5313,6 +5317,25 @@ void vpMbGenericTracker::setUseKltTracking(const std::string &name, const bool &
 }
 #endif
 
+/*!
+  Set the number of threads used to build the normal equations of the virtual visual servoing stage.
+
+  \param nbThread : Number of threads. 1 (default) keeps the sequential computation, a negative value uses the
+  maximum number of threads available.
+
+  \note This function will set the new parameter for all the cameras.
+*/
+void vpMbGenericTracker::setVVSNbThread(int nbThread)
+{
+  vpMbTracker::setVVSNbThread(nbThread);
+
+  for (std::map<std::string, TrackerWrapper *>::const_iterator it = m_mapOfTrackers.begin();
+    it != m_mapOfTrackers.end(); ++it) {
+    TrackerWrapper *tracker = it->second;
+    tracker->setVVSNbThread(nbThread);
+  }
+}
+
 void vpMbGenericTracker::testTracking()
 {
   // Test tracking fails only if all testTracking have failed
@@ -6109,10 +6132,6 @@ void vpMbGenericTracker::TrackerWrapper::computeVVS(const vpImage<unsigned char>
 
           num += wi * vpMath::sqr(m_error[i]);
           den += wi;
-
-          for (unsigned int j = 0; j < m_L.getCols(); j++) {
-            m_L[i][j] *= wi;
-          }
         }
 
         start_index += nb_edge_features;
@@ -6127,10 +6146,6 @@ void vpMbGenericTracker::TrackerWrapper::computeVVS(const vpImage<unsigned char>
 
           num += wi * vpMath::sqr(m_error[start_index + i]);
           den += wi;
-
-          for (unsigned int j = 0; j < m_L.getCols(); j++) {
-            m_L[start_index + i][j] *= wi;
-          }
         }
 
         start_index += nb_klt_features;
@@ -6140,15 +6155,12 @@ void vpMbGenericTracker::TrackerWrapper::computeVVS(const vpImage<unsigned char>
       if (m_trackerType & DEPTH_NORMAL_TRACKER) {
         for (unsigned int i = 0; i < nb_depth_features; i++) {
           double wi = m_w_depthNormal[i] * factorDepth;
+          W_true[start_index + i] = wi;
           m_w[start_index + i] = m_w_depthNormal[i];
           m_weightedError[start_index + i] = wi * m_error[start_index + i];
 
           num += wi * vpMath::sqr(m_error[start_index + i]);
           den += wi;
-
-          for (unsigned int j = 0; j < m_L.getCols(); j++) {
-            m_L[start_index + i][j] *= wi;
-          }
         }
 
         start_index += nb_depth_features;
@@ -6157,21 +6169,19 @@ void vpMbGenericTracker::TrackerWrapper::computeVVS(const vpImage<unsigned char>
       if (m_trackerType & DEPTH_DENSE_TRACKER) {
         for (unsigned int i = 0; i < nb_depth_dense_features; i++) {
           double wi = m_w_depthDense[i] * factorDepthDense;
+          W_true[start_index + i] = wi;
           m_w[start_index + i] = m_w_depthDense[i];
           m_weightedError[start_index + i] = wi * m_error[start_index + i];
 
           num += wi * vpMath::sqr(m_error[start_index + i]);
           den += wi;
-
-          for (unsigned int j = 0; j < m_L.getCols(); j++) {
-            m_L[start_index + i][j] *= wi;
-          }
         }
 
         //        start_index += nb_depth_dense_features;
       }
 
-      computeVVSPoseEstimation(isoJoIdentity, iter, m_L, LTL, m_weightedError, m_error, error_prev, LTR, mu, v);
+      computeVVSWeightedPoseEstimation(isoJoIdentity, iter, m_L, W_true, LTL, m_weightedError, m_error, error_prev, LTR,
+                                       mu, v);
 
       cMo_prev = m_cMo;
 #if defined(VISP_HAVE_MODULE_KLT) && defined(VISP_HAVE_OPENCV) && defined(HAVE_OPENCV_IMGPROC) && defined(HAVE_OPENCV_VIDEO)
@@ -42,6 +42,10 @@
 #include <sstream>
 
 #include <visp3/core/vpConfig.h>
+
+#ifdef VISP_HAVE_OPENMP
+#include <omp.h>
+#endif
 #if defined(VISP_HAVE_SIMDLIB)
 #include <Simd/SimdLib.h>
 #endif
@@ -190,7 +194,7 @@ vpMbTracker::vpMbTracker()
   nbPolygonPoints(0), nbCylinders(0), nbCircles(0), useLodGeneral(false), applyLodSettingInConfig(false),
   minLineLengthThresholdGeneral(50.0), minPolygonAreaThresholdGeneral(2500.0), mapOfParameterNames(),
   m_computeInteraction(true), m_lambda(1.0), m_maxIter(30), m_stopCriteriaEpsilon(1e-8), m_initialMu(0.01),
-  m_projectionErrorLines(), m_projectionErrorCylinders(), m_projectionErrorCircles(), m_projectionErrorFaces(),
+  m_vvsNbThread(1), m_projectionErrorLines(), m_projectionErrorCylinders(), m_projectionErrorCircles(), m_projectionErrorFaces(),
   m_projectionErrorOgreShowConfigDialog(false), m_projectionErrorMe(), m_projectionErrorKernelSize(2), m_SobelX(5, 5),
   m_SobelY(5, 5), m_projectionErrorDisplay(false), m_projectionErrorDisplayLength(20),
   m_projectionErrorDisplayThickness(1), m_projectionErrorCam(), m_mask(nullptr), m_I(), m_sodb_init_called(false),
@@ -263,6 +267,7 @@ vpMbTracker &vpMbTracker::operator=(const vpMbTracker &tracker)
   m_maxIter = tracker.m_maxIter;
   m_stopCriteriaEpsilon = tracker.m_stopCriteriaEpsilon;
   m_initialMu = tracker.m_initialMu;
+  m_vvsNbThread = tracker.m_vvsNbThread;
   m_projectionErrorLines = tracker.m_projectionErrorLines;
   m_projectionErrorCylinders = tracker.m_projectionErrorCylinders;
   m_projectionErrorCircles = tracker.m_projectionErrorCircles;
@@ -3068,6 +3073,25 @@ void vpMbTracker::setFarClippingDistance(const double &dist)
   }
 }
 
+/*!
+  Set the number of threads used to build the normal equations of the virtual visual servoing stage. Using several
+  threads only pays off with many features, typically with the dense depth features.
+
+  \param nbThread : Number of threads. 1 (default) keeps the sequential computation, a negative value uses the
+  maximum number of threads available. Without OpenMP, the computation is always sequential.
+
+  \sa getVVSNbThread(), computeWeightedNormalEquations()
+*/
+void vpMbTracker::setVVSNbThread(int nbThread)
+{
+#ifdef VISP_HAVE_OPENMP
+  m_vvsNbThread = (nbThread < 0) ? omp_get_max_threads() : std::max<int>(nbThread, 1);
+#else
+  (void)nbThread;
+  m_vvsNbThread = 1;
+#endif
+}
+
 /*!
   Set the flag to consider if the level of detail (LOD) is used.
 
@@ -3214,6 +3238,106 @@ void vpMbTracker::computeJTR(const vpMatrix &interaction, const vpColVector &err
 #endif
 }
 
+/*!
+  Compute the normal equations \f$ {\bf L}^T {\bf W}^2 {\bf L} \f$ and \f$ {\bf L}^T {\bf W} {\bf R} \f$ of the
+  weighted least squares problem solved at each iteration of the virtual visual servoing, with
+  \f$ {\bf W} = \mbox{diag}({\bf w}) \f$. The result is the same as calling vpMatrix::AtA() and computeJTR() on the
+  interaction matrix whose rows are multiplied by the weights, but the rows are weighted and accumulated on the fly,
+  without modifying \e L nor building the weighted interaction matrix.
+
+  The rows are processed by blocks. With setVVSNbThread() the blocks are shared between several threads. The partial
+  sums of the blocks are always added in the same order, so that the result does not depend on the number of threads.
+
+  \param[in] L : Interaction matrix with 6 columns, not weighted.
+  \param[in] w : Weight of each row of the interaction matrix.
+  \param[in] R : Residual, usually already weighted.
+  \param[out] LTL : The 6-by-6 matrix \f$ {\bf L}^T {\bf W}^2 {\bf L} \f$.
+  \param[out] LTR : The 6-dimension vector \f$ {\bf L}^T {\bf W} {\bf R} \f$.
+*/
+void vpMbTracker::computeWeightedNormalEquations(const vpMatrix &L, const vpColVector &w, const vpColVector &R,
+                                                 vpMatrix &LTL, vpColVector &LTR) const
+{
+  if ((L.getCols() != 6) || (L.getRows() != w.getRows()) || (L.getRows() != R.getRows())) {
+    throw vpMatrixException(vpMatrixException::incorrectMatrixSizeError,
+                            "Incorrect matrices size in computeWeightedNormalEquations.");
+  }
+
+  // 21 coefficients of the upper triangle of LTL followed by the 6 coefficients of LTR
+  const unsigned int nbSums = 27;
+  const int blockSize = 512;
+  const int nbRows = static_cast<int>(L.getRows());
+  const int nbBlocks = (nbRows + blockSize - 1) / blockSize;
+  const int nbThread = (m_vvsNbThread > 1) ? std::min<int>(m_vvsNbThread, nbBlocks) : 1;
+
+  double sums[nbSums];
+  for (unsigned int k = 0; k < nbSums; ++k) {
+    sums[k] = 0.;
+  }
+  std::vector<double> blockSums;
+  if (nbThread > 1) {
+    blockSums.resize(static_cast<size_t>(nbBlocks) * nbSums);
+  }
+
+#ifdef VISP_HAVE_OPENMP
+#pragma omp parallel for num_threads(nbThread) schedule(static) if (nbThread > 1)
+#endif
+  for (int b = 0; b < nbBlocks; ++b) {
+    double acc[nbSums];
+    for (unsigned int k = 0; k < nbSums; ++k) {
+      acc[k] = 0.;
+    }
+    const int end = std::min<int>(nbRows, (b + 1) * blockSize);
+    for (int i = b * blockSize; i < end; ++i) {
+      const double *l = L[static_cast<unsigned int>(i)];
+      const double wi = w.data[i];
+      const double wl[6] = { wi * l[0], wi * l[1], wi * l[2], wi * l[3], wi * l[4], wi * l[5] };
+      const double ri = R.data[i];
+      unsigned int k = 0;
+      for (unsigned int r = 0; r < 6; ++r) {
+        for (unsigned int c = r; c < 6; ++c) {
+          acc[k] += wl[r] * wl[c];
+          ++k;
+        }
+      }
+      for (unsigned int r = 0; r < 6; ++r) {
+        acc[21 + r] += wl[r] * ri;
+      }
+    }
+
+    if (nbThread > 1) {
+      std::copy(acc, acc + nbSums, blockSums.begin() + (static_cast<size_t>(b) * nbSums));
+    }
+    else {
+      for (unsigned int k = 0; k < nbSums; ++k) {
+        sums[k] += acc[k];
+      }
+    }
+  }
+
+  if (nbThread > 1) {
+    for (int b = 0; b < nbBlocks; ++b) {
+      const double *acc = &blockSums[static_cast<size_t>(b) * nbSums];
+      for (unsigned int k = 0; k < nbSums; ++k) {
+        sums[k] += acc[k];
+      }
+    }
+  }
+
+  LTL.resize(6, 6, false, false);
+  LTR.resize(6, false);
+  unsigned int k = 0;
+  for (unsigned int r = 0; r < 6; ++r) {
+    for (unsigned int c = r; c < 6; ++c) {
+      LTL[r][c] = sums[k];
+      LTL[c][r] = sums[k];
+      ++k;
+    }
+  }
+  for (unsigned int r = 0; r < 6; ++r) {
+    LTR[r] = sums[21 + r];
+  }
+}
+
 void vpMbTracker::computeVVSCheckLevenbergMarquardt(unsigned int iter, vpColVector &error,
                                                     const vpColVector &m_error_prev, const vpHomogeneousMatrix &cMoPrev,
                                                     double &mu, bool &reStartFromLastIncrement, vpColVector *const w,
@@ -3300,6 +3424,77 @@ void vpMbTracker::computeVVSPoseEstimation(const bool isoJoIdentity, unsigned in
   }
 }
 
+/*!
+  Same as computeVVSPoseEstimation(), but the interaction matrix \e L is not weighted beforehand: the normal equations
+  are built with computeWeightedNormalEquations() from \e L and the weights \e w_L of its rows.
+
+  \param[in] isoJoIdentity : When false, the degrees of freedom are restricted by oJo.
+  \param[in] iter : Current iteration.
+  \param[in] L : Interaction matrix, not weighted.
+  \param[in] w_L : Weight of each row of the interaction matrix.
+  \param[out] LTL : Normal matrix, only updated when \e isoJoIdentity is true.
+  \param[in] R : Weighted residual.
+  \param[in] error : Residual, used for the Levenberg-Marquardt optimization.
+  \param[out] error_prev : Residual of the previous iteration, used for the Levenberg-Marquardt optimization.
+  \param[out] LTR : Projected residual, only updated when \e isoJoIdentity is true.
+  \param[in,out] mu : Levenberg-Marquardt damping.
+  \param[out] v : Velocity to apply to the pose.
+  \param[in] w : Robust weights, saved in \e m_w_prev for the Levenberg-Marquardt optimization.
+  \param[out] m_w_prev : Robust weights of the previous iteration.
+*/
+void vpMbTracker::computeVVSWeightedPoseEstimation(const bool isoJoIdentity, unsigned int iter, const vpMatrix &L,
+                                                   const vpColVector &w_L, vpMatrix &LTL, const vpColVector &R,
+                                                   const vpColVector &error, vpColVector &error_prev,
+                                                   vpColVector &LTR, double &mu, vpColVector &v,
+                                                   const vpColVector *const w, vpColVector *const m_w_prev)
+{
+  vpVelocityTwistMatrix cVo;
+  vpMatrix LVJTLVJ;
+  vpColVector LVJTR;
+  if (isoJoIdentity) {
+    computeWeightedNormalEquations(L, w_L, R, LTL, LTR);
+  }
+  else {
+    // (L V J)^T W^2 (L V J) = (V J)^T (L^T W^2 L) (V J)
+    cVo.buildFrom(m_cMo);
+    vpMatrix VJ = cVo * oJo;
+    vpMatrix VJt = VJ.t();
+    vpMatrix LtL;
+    vpColVector LtR;
+    computeWeightedNormalEquations(L, w_L, R, LtL, LtR);
+    LVJTLVJ = VJt * LtL * VJ;
+    LVJTR = VJt * LtR;
+  }
+  const vpMatrix &H = isoJoIdentity ? LTL : LVJTLVJ;
+  const vpColVector &g = isoJoIdentity ? LTR : LVJTR;
+
+  switch (m_optimizationMethod) {
+  case vpMbTracker::LEVENBERG_MARQUARDT_OPT: {
+    vpMatrix LMA(H.getRows(), H.getCols());
+    LMA.eye();
+    vpMatrix LTLmuI = H + (LMA * mu);
+    v = -m_lambda * LTLmuI.pseudoInverse(LTLmuI.getRows() * std::numeric_limits<double>::epsilon()) * g;
+
+    if (iter != 0)
+      mu /= 10.0;
+
+    error_prev = error;
+    if (w != nullptr && m_w_prev != nullptr)
+      *m_w_prev = *w;
+    break;
+  }
+
+  case vpMbTracker::GAUSS_NEWTON_OPT:
+  default:
+    v = -m_lambda * H.pseudoInverse(H.getRows() * std::numeric_limits<double>::epsilon()) * g;
+    break;
+  }
+
+  if (!isoJoIdentity) {
+    v = cVo * v;
+  }
+}
+
 void vpMbTracker::computeVVSWeights(vpRobust &robust, const vpColVector &error, vpColVector &w)
 {
   if (error.getRows() > 0)
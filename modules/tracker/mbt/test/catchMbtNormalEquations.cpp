@@ -0,0 +1,229 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Test the weighted normal equations of the model-based trackers.
+ */
+
+/*!
+  \example catchMbtNormalEquations.cpp
+
+  Test the weighted normal equations built at each iteration of the virtual visual servoing of the model-based
+  trackers.
+ */
+#include <visp3/core/vpConfig.h>
+
+#if defined(VISP_HAVE_CATCH2)
+#include <visp3/core/vpUniRand.h>
+#include <visp3/mbt/vpMbDepthDenseTracker.h>
+#include <visp3/mbt/vpMbGenericTracker.h>
+
+#if defined(VISP_BUILD_CATCH2)
+#include <catch_amalgamated.hpp>
+#else // Since v3.1.1
+#include <catch2/catch_all.hpp>
+#endif
+
+#ifdef ENABLE_VISP_NAMESPACE
+using namespace VISP_NAMESPACE_NAME;
+#endif
+
+namespace
+{
+class vpMbTrackerNormalEquations : public vpMbDepthDenseTracker
+{
+public:
+  using vpMbTracker::computeVVSPoseEstimation;
+  using vpMbTracker::computeVVSWeightedPoseEstimation;
+  using vpMbTracker::computeWeightedNormalEquations;
+
+  void setJacobian(const vpMatrix &J) { oJo = J; }
+  void setCurrentPose(const vpHomogeneousMatrix &cMo) { m_cMo = cMo; }
+};
+
+class vpMbGenericTrackerCameras : public vpMbGenericTracker
+{
+public:
+  vpMbGenericTrackerCameras(unsigned int nbCameras) : vpMbGenericTracker(nbCameras, vpMbGenericTracker::EDGE_TRACKER)
+  { }
+
+  std::vector<int> getCamerasVVSNbThread() const
+  {
+    std::vector<int> nbThreads;
+    for (auto it = m_mapOfTrackers.begin(); it != m_mapOfTrackers.end(); ++it) {
+      nbThreads.push_back(it->second->getVVSNbThread());
+    }
+    return nbThreads;
+  }
+};
+
+bool equal(const vpArray2D<double> &A, const vpArray2D<double> &B, double epsilon)
+{
+  if ((A.getRows() != B.getRows()) || (A.getCols() != B.getCols())) {
+    return false;
+  }
+  for (unsigned int i = 0; i < A.size(); ++i) {
+    if (!vpMath::equal(A.data[i], B.data[i], epsilon)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void generateProblem(unsigned int nbRows, vpMatrix &L, vpColVector &w, vpColVector &error, vpColVector &R)
+{
+  vpUniRand rng(42);
+  L.resize(nbRows, 6, false, false);
+  w.resize(nbRows, false);
+  error.resize(nbRows, false);
+  R.resize(nbRows, false);
+  for (unsigned int i = 0; i < nbRows; ++i) {
+    for (unsigned int j = 0; j < 6; ++j) {
+      L[i][j] = rng.uniform(-1., 1.);
+    }
+    w[i] = rng.uniform(0., 1.);
+    error[i] = rng.uniform(-1., 1.);
+    R[i] = w[i] * error[i];
+  }
+}
+
+vpMatrix weightRows(const vpMatrix &L, const vpColVector &w)
+{
+  vpMatrix WL = L;
+  for (unsigned int i = 0; i < WL.getRows(); ++i) {
+    for (unsigned int j = 0; j < WL.getCols(); ++j) {
+      WL[i][j] *= w[i];
+    }
+  }
+  return WL;
+}
+}
+
+TEST_CASE("Weighted normal equations", "[mbt][vvs]")
+{
+  vpMbTrackerNormalEquations tracker;
+  const unsigned int sizes[] = { 4, 511, 512, 513, 20000 };
+
+  for (auto nbRows : sizes) {
+    vpMatrix L;
+    vpColVector w, error, R;
+    generateProblem(nbRows, L, w, error, R);
+    vpMatrix WL = weightRows(L, w);
+
+    vpMatrix LTL;
+    vpColVector LTR;
+    tracker.computeWeightedNormalEquations(L, w, R, LTL, LTR);
+    CHECK(equal(LTL, WL.AtA(), 1e-9));
+    CHECK(equal(LTR, WL.t() * R, 1e-9));
+
+    // The result does not depend on the number of threads
+    tracker.setVVSNbThread(4);
+    vpMatrix LTL_mt;
+    vpColVector LTR_mt;
+    tracker.computeWeightedNormalEquations(L, w, R, LTL_mt, LTR_mt);
+    CHECK(LTL_mt == LTL);
+    CHECK(LTR_mt == LTR);
+    tracker.setVVSNbThread(1);
+  }
+
+  vpMatrix L(10, 5), LTL;
+  vpColVector w(10), R(10), LTR;
+  CHECK_THROWS_AS(tracker.computeWeightedNormalEquations(L, w, R, LTL, LTR), vpException);
+}
+
+TEST_CASE("Weighted pose estimation", "[mbt][vvs]")
+{
+  vpMatrix L;
+  vpColVector w, error, R;
+  generateProblem(1000, L, w, error, R);
+
+  const vpMbTracker::vpMbtOptimizationMethod methods[] = { vpMbTracker::GAUSS_NEWTON_OPT,
+                                                           vpMbTracker::LEVENBERG_MARQUARDT_OPT };
+  for (auto method : methods) {
+    for (unsigned int dof = 0; dof < 2; ++dof) {
+      const bool isoJoIdentity = (dof == 0);
+      vpMbTrackerNormalEquations tracker;
+      tracker.setOptimizationMethod(method);
+      tracker.setCurrentPose(vpHomogeneousMatrix(0.1, -0.2, 0.5, 0.1, 0.2, -0.3));
+      if (!isoJoIdentity) {
+        // Do not estimate the rotation around the z axis
+        vpMatrix J;
+        J.eye(6);
+        J[5][5] = 0.;
+        tracker.setJacobian(J);
+      }
+
+      vpMatrix WL = weightRows(L, w);
+      vpMatrix LTL_ref, LTL;
+      vpColVector LTR_ref, LTR, v_ref, v, error_prev_ref, error_prev;
+      double mu_ref = 0.01, mu = 0.01;
+      tracker.computeVVSPoseEstimation(isoJoIdentity, 1, WL, LTL_ref, R, error, error_prev_ref, LTR_ref, mu_ref, v_ref);
+      tracker.computeVVSWeightedPoseEstimation(isoJoIdentity, 1, L, w, LTL, R, error, error_prev, LTR, mu, v);
+
+      CHECK(equal(v, v_ref, 1e-9));
+      CHECK(mu == Catch::Approx(mu_ref));
+    }
+  }
+}
+
+TEST_CASE("Number of threads of the virtual visual servoing", "[mbt][vvs]")
+{
+  vpMbGenericTrackerCameras tracker(2);
+  tracker.setVVSNbThread(2);
+#if defined(VISP_HAVE_OPENMP)
+  const int expected = 2;
+#else
+  const int expected = 1;
+#endif
+  CHECK(tracker.getVVSNbThread() == expected);
+  const std::vector<int> nbThreads = tracker.getCamerasVVSNbThread();
+  REQUIRE(nbThreads.size() == 2);
+  for (size_t i = 0; i < nbThreads.size(); ++i) {
+    CHECK(nbThreads[i] == expected);
+  }
+
+  vpMbTracker &base = tracker;
+  base.setVVSNbThread(1);
+  for (int nbThread : tracker.getCamerasVVSNbThread()) {
+    CHECK(nbThread == 1);
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  Catch::Session session;
+  session.applyCommandLine(argc, argv);
+  int numFailed = session.run();
+  return numFailed;
+}
+#else
+#include <iostream>
+
+int main() { return EXIT_SUCCESS; }
+#endif
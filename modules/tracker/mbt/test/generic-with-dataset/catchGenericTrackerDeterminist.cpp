@@ -285,6 +285,33 @@ TEST_CASE("Check Stereo MBT determinism parallel", "[MBT_determinism]")
   checkPoses(cMo1, cMo2);
 }
 
+TEST_CASE("Check MBT determinism with multi-threaded moving edges", "[MBT_determinism]")
+{
+  // Sequential moving edges tracking
+  vpMbGenericTracker tracker1;
+  vpCameraParameters cam;
+  configureTracker(tracker1, cam);
+
+  // Moving edges of the lines and cylinders tracked with several threads
+  vpMbGenericTracker tracker2;
+  configureTracker(tracker2, cam);
+  tracker2.setMovingEdgeNbThread(4);
+
+  vpImage<unsigned char> I;
+  vpHomogeneousMatrix cMo1, cMo2;
+  for (int cpt = 0; read_data(cpt, I); cpt++) {
+    tracker1.track(I);
+    tracker1.getPose(cMo1);
+    tracker2.track(I);
+    tracker2.getPose(cMo2);
+  }
+  std::cout << "Sequential moving edges, final cMo:\n" << cMo1 << std::endl;
+  std::cout << "Multi-threaded moving edges, final cMo:\n" << cMo2 << std::endl;
+
+  // Check that both poses are identical
+  checkPoses(cMo1, cMo2);
+}
+
 int main(int argc, char *argv[])
 {
   Catch::Session session;
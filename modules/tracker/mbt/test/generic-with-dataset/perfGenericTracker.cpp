@@ -418,6 +418,184 @@ TEST_CASE("Benchmark generic tracker", "[benchmark]")
 } // if (runBenchmark)
 }
 
+TEST_CASE("Benchmark moving-edges tracking", "[benchmark]")
+{
+  if (runBenchmark) {
+    vpMbGenericTracker tracker(vpMbGenericTracker::EDGE_TRACKER);
+
+    const std::string input_directory =
+      vpIoTools::createFilePath(vpIoTools::getViSPImagesDataPath(), "mbt-depth/Castle-simu");
+
+    vpCameraParameters cam;
+    cam.initPersProjWithoutDistortion(700.0, 700.0, 320.0, 240.0);
+    tracker.setCameraParameters(cam);
+
+    vpMe me;
+    me.setMaskSize(5);
+    me.setMaskNumber(180);
+    me.setRange(8);
+    me.setLikelihoodThresholdType(vpMe::NORMALIZED_THRESHOLD);
+    me.setThreshold(5);
+    me.setMu1(0.5);
+    me.setMu2(0.5);
+    me.setSampleStep(5);
+    tracker.setMovingEdge(me);
+
+    tracker.setAngleAppear(vpMath::rad(85.0));
+    tracker.setAngleDisappear(vpMath::rad(89.0));
+    tracker.setNearClippingDistance(0.01);
+    tracker.setFarClippingDistance(2.0);
+    tracker.setClipping(tracker.getClipping() | vpMbtPolygon::FOV_CLIPPING);
+
+    REQUIRE(vpIoTools::checkFilename(input_directory + "/Models/chateau.cao"));
+    tracker.loadModel(input_directory + "/Models/chateau.cao");
+
+    // load all the data in memory to not take into account I/O from disk
+    vpImage<unsigned char> I;
+    vpImage<uint16_t> I_depth_raw;
+    std::vector<vpColVector> pointcloud;
+    vpHomogeneousMatrix cMo_truth;
+    std::vector<vpImage<unsigned char> > images;
+    std::vector<vpHomogeneousMatrix> cMo_truth_all;
+    for (int i = 1; i <= 40; i++) {
+      if (read_data(input_directory, i, cam, I, I_depth_raw, pointcloud, cMo_truth)) {
+        images.push_back(I);
+        cMo_truth_all.push_back(cMo_truth);
+      }
+    }
+    REQUIRE(images.size() > 1);
+
+    // Whole per-frame tracking: moving-edges tracking, virtual visual servoing and moving-edges update
+    vpHomogeneousMatrix cMo;
+    BENCHMARK("Edge MBT track()")
+    {
+      tracker.initFromPose(images.front(), cMo_truth_all.front());
+      for (size_t i = 1; i < images.size(); i++) {
+        tracker.track(images[i]);
+      }
+      cMo = tracker.getPose();
+      return cMo;
+    };
+
+    // Keep, for each frame, the moving-edges of the visible lines before they are tracked in the next image
+    std::vector<std::vector<vpMbtMeLine> > melines_per_frame;
+    tracker.initFromPose(images.front(), cMo_truth_all.front());
+    for (size_t i = 1; i < images.size(); i++) {
+      std::list<vpMbtDistanceLine *> lines;
+      tracker.getLline(lines);
+      std::vector<vpMbtMeLine> melines;
+      for (std::list<vpMbtDistanceLine *>::const_iterator it = lines.begin(); it != lines.end(); ++it) {
+        for (size_t j = 0; j < (*it)->meline.size(); j++) {
+          if ((*it)->meline[j] != nullptr) {
+            melines.push_back(*(*it)->meline[j]);
+          }
+        }
+      }
+      melines_per_frame.push_back(melines);
+      tracker.track(images[i]);
+    }
+
+    // Moving-edges tracking alone, as done by the lines at each frame: site search, line fitting and
+    // suppression of the rejected sites
+    BENCHMARK_ADVANCED("vpMbtMeLine track()")(Catch::Benchmark::Chronometer meter)
+    {
+      std::vector<std::vector<std::vector<vpMbtMeLine> > > melines(static_cast<size_t>(meter.runs()),
+                                                                    melines_per_frame);
+      meter.measure([&](int run) {
+        int nbPoints = 0;
+        std::vector<std::vector<vpMbtMeLine> > &melines_run = melines[static_cast<size_t>(run)];
+        for (size_t f = 0; f < melines_run.size(); f++) {
+          for (size_t l = 0; l < melines_run[f].size(); l++) {
+            try {
+              melines_run[f][l].track(images[f + 1]);
+              nbPoints += melines_run[f][l].getNbPoints();
+            }
+            catch (...) {
+              // Lines that are lost are also lost by the tracker
+            }
+          }
+        }
+        return nbPoints;
+      });
+    };
+
+    // Sites of each line after the search in the next image, with the states set by the search
+    std::vector<std::vector<vpMeSite> > searched_sites;
+    for (size_t f = 0; f < melines_per_frame.size(); f++) {
+      for (size_t l = 0; l < melines_per_frame[f].size(); l++) {
+        vpMbtMeLine meline = melines_per_frame[f][l];
+        try {
+          meline.vpMeTracker::track(images[f + 1]);
+          searched_sites.push_back(meline.getMeSites());
+        }
+        catch (...) {
+          // Lines that are lost are also lost by the tracker
+        }
+      }
+    }
+    REQUIRE(!searched_sites.empty());
+
+    // Per-frame work that depends on the site storage: a traversal of the sites of each line to build the features,
+    // followed by the suppression of the rejected sites. The sites are stored in a std::list as before, or in the
+    // std::vector used by vpMeTracker. The containers are filled before the measure.
+    BENCHMARK_ADVANCED("Sites stored in std::list")(Catch::Benchmark::Chronometer meter)
+    {
+      std::vector<std::vector<std::list<vpMeSite> > > sites(static_cast<size_t>(meter.runs()));
+      for (size_t r = 0; r < sites.size(); r++) {
+        for (size_t k = 0; k < searched_sites.size(); k++) {
+          sites[r].push_back(std::list<vpMeSite>(searched_sites[k].begin(), searched_sites[k].end()));
+        }
+      }
+      meter.measure([&](int run) {
+        double acc = 0;
+        std::vector<std::list<vpMeSite> > &sites_run = sites[static_cast<size_t>(run)];
+        for (size_t k = 0; k < sites_run.size(); k++) {
+          std::list<vpMeSite> &list = sites_run[k];
+          for (std::list<vpMeSite>::const_iterator it = list.begin(); it != list.end(); ++it) {
+            acc += (it->get_ifloat() * cos(it->getAlpha())) + (it->get_jfloat() * sin(it->getAlpha()));
+          }
+          for (std::list<vpMeSite>::iterator it = list.begin(); it != list.end();) {
+            if (it->getState() != vpMeSite::NO_SUPPRESSION) {
+              it = list.erase(it);
+            }
+            else {
+              ++it;
+            }
+          }
+          acc += static_cast<double>(list.size());
+        }
+        return acc;
+      });
+    };
+
+    BENCHMARK_ADVANCED("Sites stored in std::vector")(Catch::Benchmark::Chronometer meter)
+    {
+      std::vector<std::vector<std::vector<vpMeSite> > > sites(static_cast<size_t>(meter.runs()), searched_sites);
+      meter.measure([&](int run) {
+        double acc = 0;
+        std::vector<std::vector<vpMeSite> > &sites_run = sites[static_cast<size_t>(run)];
+        for (size_t k = 0; k < sites_run.size(); k++) {
+          std::vector<vpMeSite> &vector = sites_run[k];
+          for (std::vector<vpMeSite>::const_iterator it = vector.begin(); it != vector.end(); ++it) {
+            acc += (it->get_ifloat() * cos(it->getAlpha())) + (it->get_jfloat() * sin(it->getAlpha()));
+          }
+          // Same order preserving suppression as vpMbtMeLine::suppressPoints()
+          std::vector<vpMeSite>::iterator kept = vector.begin();
+          for (std::vector<vpMeSite>::iterator it = vector.begin(); it != vector.end(); ++it) {
+            if (it->getState() == vpMeSite::NO_SUPPRESSION) {
+              *kept = *it;
+              ++kept;
+            }
+          }
+          vector.erase(kept, vector.end());
+          acc += static_cast<double>(vector.size());
+        }
+        return acc;
+      });
+    };
+  } // if (runBenchmark)
+}
+
 int main(int argc, char *argv[])
 {
   Catch::Session session;
@@ -350,6 +350,24 @@ public:
                           const std::list<vpMeSite> &site_list, const double &A, const double &B, const double &C,
                           const vpColor &color = vpColor::green, unsigned int thickness = 1);
 
+  /*!
+   * Display of a moving line thanks to its equation parameters and its
+   * extremities with all the sites.
+   *
+   * \param I : The image used as background.
+   * \param PExt1 : First extremity
+   * \param PExt2 : Second extremity
+   * \param site_list : vpMeSite vector
+   * \param A : Parameter a of the line equation a*i + b*j + c = 0
+   * \param B : Parameter b of the line equation a*i + b*j + c = 0
+   * \param C : Parameter c of the line equation a*i + b*j + c = 0
+   * \param color : Color used to display the line.
+   * \param thickness : Thickness of the line.
+   */
+  static void displayLine(const vpImage<unsigned char> &I, const vpMeSite &PExt1, const vpMeSite &PExt2,
+                          const std::vector<vpMeSite> &site_list, const double &A, const double &B, const double &C,
+                          const vpColor &color = vpColor::green, unsigned int thickness = 1);
+
   /*!
    * Display of a moving line thanks to its equation parameters and its
    * extremities with all the site list.
@@ -368,6 +386,24 @@ public:
                           const std::list<vpMeSite> &site_list, const double &A, const double &B, const double &C,
                           const vpColor &color = vpColor::green, unsigned int thickness = 1);
 
+  /*!
+   * Display of a moving line thanks to its equation parameters and its
+   * extremities with all the sites.
+   *
+   * \param I : The image used as background.
+   * \param PExt1 : First extremity
+   * \param PExt2 : Second extremity
+   * \param site_list : vpMeSite vector
+   * \param A : Parameter a of the line equation a*i + b*j + c = 0
+   * \param B : Parameter b of the line equation a*i + b*j + c = 0
+   * \param C : Parameter c of the line equation a*i + b*j + c = 0
+   * \param color : Color used to display the line.
+   * \param thickness : Thickness of the line.
+   */
+  static void displayLine(const vpImage<vpRGBa> &I, const vpMeSite &PExt1, const vpMeSite &PExt2,
+                          const std::vector<vpMeSite> &site_list, const double &A, const double &B, const double &C,
+                          const vpColor &color = vpColor::green, unsigned int thickness = 1);
+
   /*!
    * Computes the intersection point of two lines. The result is given in
    * the (i,j) frame.
@@ -45,6 +45,8 @@
 #include <visp3/core/vpMatrix.h>
 #include <visp3/me/vpMe.h>
 
+#include <vector>
+
 BEGIN_VISP_NAMESPACE
 
 /*!
@@ -102,6 +104,31 @@ public:
     OUTSIDE_ROI_MASK = 6  ///< Point is outside the region of interest mask, but retained in the ME list.
   } vpMeSiteState;
 
+  /*!
+   * Scratch buffers used by track() to evaluate the query sites along the normal to the contour.
+   *
+   * The query sites are stored as a structure of arrays, so that the mask convolution can be evaluated for all the
+   * candidates at once. Passing the same instance to successive track() calls, as vpMeTracker does, avoids any
+   * heap allocation once the buffers have reached the size required by vpMe::getRange() and vpMe::getMaskSize().
+   */
+  class vpMeSiteQueryBuffer
+  {
+  public:
+    /*!
+     * Resize the buffers to hold \e numQueries query sites convolved with a \e maskSize x \e maskSize mask.
+     * The capacity of the buffers is never reduced.
+     */
+    void resize(unsigned int numQueries, unsigned int maskSize);
+
+    std::vector<double> m_ifloat; //!< Subpixel coordinates along i of the query sites
+    std::vector<double> m_jfloat; //!< Subpixel coordinates along j of the query sites
+    std::vector<int> m_i; //!< Integer coordinates along i of the query sites
+    std::vector<int> m_j; //!< Integer coordinates along j of the query sites
+    std::vector<unsigned char> m_inside; //!< Whether the convolution mask of the query site fits in the image
+    std::vector<double> m_convolution; //!< Convolution result for each query site
+    std::vector<double> m_pixels; //!< Pixels under the mask, stored mask element by mask element, then query by query
+  };
+
   //! Integer coordinate along i of a site
   int m_i;
   //! Integer coordinates along j of a site
@@ -260,6 +287,19 @@ public:
    */
   void track(const vpImage<unsigned char> &I, const vpMe *me, const bool &test_contrast = true);
 
+  /*!
+   * Same as track(const vpImage<unsigned char> &, const vpMe *, const bool &) but uses \e buffer as scratch memory
+   * to evaluate the query sites. Reusing the same buffer across calls makes the search allocation-free.
+   * Results are identical to the ones of the other track() function.
+   *
+   * \warning To display the moving edges graphics a call to vpDisplay::flush() is needed after this function.
+   * \param[in] I : Input image.
+   * \param[in] me : Pointer to the moving-edges settings.
+   * \param[in] test_contrast : When true tracking is based on contrast, otherwise on the likelihood.
+   * \param[inout] buffer : Scratch buffers used to store the query sites and their convolution.
+   */
+  void track(const vpImage<unsigned char> &I, const vpMe *me, const bool &test_contrast, vpMeSiteQueryBuffer &buffer);
+
   /*!
    * Similar to the track() function, but stores the best numCandidates hypotheses in `outputHypotheses`.
    * The best matching hypotheses (if it is not suppressed) is assigned to *this* and is stored as the first
@@ -286,6 +326,11 @@ public:
    */
   void setDisplay(vpMeSiteDisplayType select) { m_selectDisplay = select; }
 
+  /*!
+   * Return the display selector.
+   */
+  inline vpMeSiteDisplayType getDisplay() const { return m_selectDisplay; }
+
   /*!
    * Set the state of the site.
    *
@@ -446,6 +491,13 @@ public:
                       const vpMeSiteState &state = NO_SUPPRESSION);
 
 private:
+  /*!
+   * Fill \e buffer with the query sites along the normal in the given range and compute their convolution
+   * with the mask \e mask_index, using the current mask sign.
+   */
+  void computeQueryConvolutions(const vpImage<unsigned char> &I, const vpMe &me, unsigned int mask_index,
+                                vpMeSiteQueryBuffer &buffer) const;
+
   vpMeSiteDisplayType m_selectDisplay; //!< Display selector
   vpMeSiteState m_state; //!< Site state
   unsigned int m_index_prev; //!< previous convolution index
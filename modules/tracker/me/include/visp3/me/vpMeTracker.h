@@ -46,6 +46,7 @@
 
 #include <iostream>
 #include <list>
+#include <vector>
 #include <math.h>
 
 BEGIN_VISP_NAMESPACE
@@ -58,6 +59,11 @@ BEGIN_VISP_NAMESPACE
  *
  * 2D state = list of points, 3D state = feature
  *
+ * The moving-edges sites are stored contiguously, see getMeSites(). The index of a site is stable while the sites
+ * are tracked by track() and while their state is updated, e.g. by the robust estimation of a model-based tracker.
+ * Sites are only removed or inserted when the derived trackers suppress the rejected sites, look for new sites at
+ * the extremities of the feature or resample it. These steps keep the relative order of the remaining sites.
+ *
  * <h2 id="header-details" class="groupheader">Tutorials & Examples</h2>
  *
  * <b>Tutorials</b><br>
@@ -145,6 +151,13 @@ public:
    */
   static bool inMeMaskCandidates(const vpImage<bool> *meMaskCandidates, unsigned int i, unsigned int j);
 
+  /*!
+   * Return the type of moving-edges display.
+   *
+   * \sa setDisplay()
+   */
+  inline vpMeSite::vpMeSiteDisplayType getDisplay() const { return m_selectDisplay; }
+
   /*!
    * Return the moving edges initialisation parameters.
    *
@@ -153,18 +166,27 @@ public:
   inline vpMe *getMe() { return m_me; }
 
   /*!
-   * Return the list of moving edges
+   * Return the moving edges. The sites are stored contiguously and can be accessed by their index.
+   *
+   * \return Moving Edges.
+   */
+  inline std::vector<vpMeSite> &getMeSites() { return m_meList; }
+
+  /*!
+   * Return the moving edges. The sites are stored contiguously and can be accessed by their index.
    *
-   * \return List of Moving Edges.
+   * \return Moving Edges.
    */
-  inline std::list<vpMeSite> &getMeList() { return m_meList; }
+  inline const std::vector<vpMeSite> &getMeSites() const { return m_meList; }
 
   /*!
-   * Return the list of moving edges
+   * Return a copy of the moving edges as a list, for the code written when they were stored in a std::list.
+   * Modifying the returned list has no effect on the tracker: use getMeSites() to access or modify the moving
+   * edges in place, or setMeList() to replace them.
    *
-   * \return List of Moving Edges.
+   * \return A copy of the moving edges as a list.
    */
-  inline std::list<vpMeSite> getMeList() const { return m_meList; }
+  inline std::list<vpMeSite> getMeList() const { return std::list<vpMeSite>(m_meList.begin(), m_meList.end()); }
 
   /*!
    * Return the number of points that has not been suppressed.
@@ -173,6 +195,13 @@ public:
    */
   inline int getNbPoints() const { return m_nGoodElement; }
 
+  /*!
+   * Return the number of threads used to track the moving-edges sites.
+   *
+   * \sa setNbThread()
+   */
+  inline int getNbThread() const { return m_nbThread; }
+
   /*!
    * Initialize the tracker.
    */
@@ -258,8 +287,27 @@ public:
    * Set the list of moving edges.
    *
    * \param[in] meList : List of Moving Edges.
+   * \sa setMeSites()
    */
-  void setMeList(const std::list<vpMeSite> &meList) { m_meList = meList; }
+  void setMeList(const std::list<vpMeSite> &meList) { m_meList.assign(meList.begin(), meList.end()); }
+
+  /*!
+   * Set the moving edges.
+   *
+   * \param[in] meSites : Moving Edges.
+   */
+  void setMeSites(const std::vector<vpMeSite> &meSites) { m_meList = meSites; }
+
+  /*!
+   * Set the number of threads used by track() to search the moving-edges sites. The sites are partitioned
+   * across the threads, each site being searched independently, so that the result does not depend on the
+   * number of threads. The sites that are displayed while being tracked (see setDisplay()) are searched on the
+   * calling thread.
+   *
+   * \param[in] nbThread : Number of threads. 1 (default) keeps the sequential search, a negative value uses
+   * the maximum number of threads available. Without OpenMP, the search remains sequential.
+   */
+  void setNbThread(const int &nbThread);
 
   /*!
    * Return the total number of moving-edges.
@@ -302,8 +350,8 @@ protected:
   /** @name Protected Attributes Inherited from vpMeTracker */
   //@{
   //! Tracking dependent variables/functions
-  //! List of tracked moving edges points.
-  std::list<vpMeSite> m_meList;
+  //! Tracked moving edges points, stored contiguously.
+  std::vector<vpMeSite> m_meList;
   //! Moving edges initialisation parameters
   vpMe *m_me;
   //! Number of good moving-edges that are tracked
@@ -314,8 +362,21 @@ protected:
   const vpImage<bool> *m_maskCandidates;
   //! Moving-edges display type
   vpMeSite::vpMeSiteDisplayType m_selectDisplay;
+  //! Scratch buffers reused by all the moving-edges searches of the tracker
+  vpMeSite::vpMeSiteQueryBuffer m_queryBuffer;
+  //! Number of threads used to search the moving-edges sites
+  int m_nbThread;
+  //! Scratch buffers of each thread when the sites are searched in parallel
+  std::vector<vpMeSite::vpMeSiteQueryBuffer> m_threadQueryBuffers;
   //@}
 
+  /*!
+   * Track a single moving-edge site and update its state according to the mask.
+   *
+   * \return true if the site is still a good point after the tracking.
+   */
+  bool trackSite(const vpImage<unsigned char> &I, vpMeSite &s, vpMeSite::vpMeSiteQueryBuffer &buffer);
+
 };
 
 END_VISP_NAMESPACE
@@ -434,6 +434,17 @@ public:
   */
   void globalCurveInterp(const std::list<vpMeSite> &l_crossingPoints);
 
+  /*!
+   * Method which enables to compute a NURBS curve passing through a set of data
+   * points.
+   *
+   * The result of the method is composed by a knot vector, a set of control
+   * points and a set of associated weights.
+   *
+   * \param l_crossingPoints : The data points which have to be interpolated.
+   */
+  void globalCurveInterp(const std::vector<vpMeSite> &l_crossingPoints);
+
   /*!
    * Method which enables to compute a NURBS curve passing through a set of data
    * points.
@@ -513,6 +524,22 @@ public:
    */
   void globalCurveApprox(const std::list<vpMeSite> &l_crossingPoints, unsigned int n);
 
+  /*!
+   * Method which enables to compute a NURBS curve approximating a set of
+   * data points.
+   *
+   * The data points are approximated thanks to a least square method.
+   *
+   * The result of the method is composed by a knot vector, a set of
+   * control points and a set of associated weights.
+   *
+   * \param l_crossingPoints : The data points which have to be interpolated.
+   *
+   * \param n : The desired number of control points. This parameter \e n
+   * must be under or equal to the number of data points.
+   */
+  void globalCurveApprox(const std::vector<vpMeSite> &l_crossingPoints, unsigned int n);
+
   /*!
    * Method which enables to compute a NURBS curve approximating a set of data
    * points.
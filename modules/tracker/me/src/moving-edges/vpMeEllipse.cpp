@@ -126,8 +126,8 @@ void vpMeEllipse::updateTheta()
 {
   vpMeSite p_me;
   vpImagePoint iP;
-  std::list<vpMeSite>::iterator end = m_meList.end();
-  for (std::list<vpMeSite>::iterator it = m_meList.begin(); it != end; ++it) {
+  std::vector<vpMeSite>::iterator end = m_meList.end();
+  for (std::vector<vpMeSite>::iterator it = m_meList.begin(); it != end; ++it) {
     p_me = *it;
     // (i,j) frame used for vpMESite
     iP.set_ij(p_me.m_ifloat, p_me.m_jfloat);
@@ -388,7 +388,7 @@ unsigned int vpMeEllipse::plugHoles(const vpImage<unsigned char> &I)
   // Detect holes and try to complete them
   // In this option, the sample step is used to complete the holes as much as possible
   std::list<double>::iterator angleList = m_angleList.begin();
-  std::list<vpMeSite>::iterator meList = m_meList.begin();
+  std::vector<vpMeSite>::iterator meList = m_meList.begin();
   const double marginRatio = m_me->getThresholdMarginRatio();
   double ang = *angleList;
   ++angleList;
@@ -414,7 +414,7 @@ unsigned int vpMeEllipse::plugHoles(const vpImage<unsigned char> &I)
             double convolution = pix.convolution(I, m_me);
             double contrastThreshold = fabs(convolution) * marginRatio;
             pix.setContrastThreshold(contrastThreshold, *m_me);
-            pix.track(I, m_me, false);
+            pix.track(I, m_me, false, m_queryBuffer);
             if (pix.getState() == vpMeSite::NO_SUPPRESSION) { // good point
               ++nb_pts_added;
               iP.set_ij(pix.get_ifloat(), pix.get_jfloat());
@@ -425,7 +425,8 @@ unsigned int vpMeEllipse::plugHoles(const vpImage<unsigned char> &I)
               else if ((ang - new_ang) > M_PI) {
                 new_ang += 2.0 * M_PI;
               }
-              m_meList.insert(meList, pix);
+              meList = m_meList.insert(meList, pix);
+              ++meList;
               m_angleList.insert(angleList, new_ang);
             }
           }
@@ -467,7 +468,7 @@ unsigned int vpMeEllipse::plugHoles(const vpImage<unsigned char> &I)
           double convolution = pix.convolution(I, m_me);
           double contrastThreshold = fabs(convolution) * marginRatio;
           pix.setContrastThreshold(contrastThreshold, *m_me);
-          pix.track(I, m_me, false);
+          pix.track(I, m_me, false, m_queryBuffer);
           if (pix.getState() == vpMeSite::NO_SUPPRESSION) { // good point
             ++nb_pts_added;
             iP.set_ij(pix.get_ifloat(), pix.get_jfloat());
@@ -478,7 +479,8 @@ unsigned int vpMeEllipse::plugHoles(const vpImage<unsigned char> &I)
             else if ((ang - new_ang) > M_PI) {
               new_ang += 2.0 * M_PI;
             }
-            m_meList.insert(meList, pix);
+            meList = m_meList.insert(meList, pix);
+            ++meList;
             m_angleList.insert(angleList, new_ang);
           }
         }
@@ -515,7 +517,7 @@ unsigned int vpMeEllipse::plugHoles(const vpImage<unsigned char> &I)
         double convolution = pix.convolution(I, m_me);
         double contrastThreshold = fabs(convolution) * marginRatio;
         pix.setContrastThreshold(contrastThreshold, *m_me);
-        pix.track(I, m_me, false);
+        pix.track(I, m_me, false, m_queryBuffer);
         if (pix.getState() == vpMeSite::NO_SUPPRESSION) {
           ++nb_pts_added;
           iP.set_ij(pix.get_ifloat(), pix.get_jfloat());
@@ -526,7 +528,7 @@ unsigned int vpMeEllipse::plugHoles(const vpImage<unsigned char> &I)
           else if ((ang - new_ang) > M_PI) {
             new_ang += 2.0 * M_PI;
           }
-          m_meList.push_front(pix);
+          m_meList.insert(m_meList.begin(), pix);
           m_angleList.push_front(new_ang);
         }
       }
@@ -557,7 +559,7 @@ unsigned int vpMeEllipse::plugHoles(const vpImage<unsigned char> &I)
         double convolution = pix.convolution(I, m_me);
         double contrastThreshold = fabs(convolution) * marginRatio;
         pix.setContrastThreshold(contrastThreshold, *m_me);
-        pix.track(I, m_me, false);
+        pix.track(I, m_me, false, m_queryBuffer);
         if (pix.getState() == vpMeSite::NO_SUPPRESSION) {
           ++nb_pts_added;
           iP.set_ij(pix.get_ifloat(), pix.get_jfloat());
@@ -149,9 +149,9 @@ void vpMeEllipse::leastSquareRobustCircle(const double &um, const double &vm, un
 
   // Useful to compute the weights in the robust estimation
   vpColVector xp(nos), yp(nos);
-  std::list<vpMeSite>::const_iterator end = m_meList.end();
+  std::vector<vpMeSite>::const_iterator end = m_meList.end();
 
-  for (std::list<vpMeSite>::const_iterator it = m_meList.begin(); it != end; ++it) {
+  for (std::vector<vpMeSite>::const_iterator it = m_meList.begin(); it != end; ++it) {
     vpMeSite p_me = *it;
     if (p_me.getState() == vpMeSite::NO_SUPPRESSION) {
       // from (i,j) to (u,v) frame + normalization so that (u,v) in [-1;1]
@@ -261,9 +261,9 @@ void vpMeEllipse::leastSquareRobustEllipse(const double &um, const double &vm, u
   vpMatrix A(nos, nbColsA);
   // Useful to compute the weights in the robust estimation
   vpColVector xp(nos), yp(nos);
-  std::list<vpMeSite>::const_iterator end = m_meList.end();
+  std::vector<vpMeSite>::const_iterator end = m_meList.end();
 
-  for (std::list<vpMeSite>::const_iterator it = m_meList.begin(); it != end; ++it) {
+  for (std::vector<vpMeSite>::const_iterator it = m_meList.begin(); it != end; ++it) {
     vpMeSite p_me = *it;
     if (p_me.getState() == vpMeSite::NO_SUPPRESSION) {
       // from (i,j) to (u,v) frame + normalization so that (u,v) in [-1;1]
@@ -378,19 +378,21 @@ unsigned int vpMeEllipse::leastSquareRobust(const vpImage<unsigned char> &I)
   // Modify the angle to order the list
   double previous_ang = -4.0 * M_PI;
   k = 0;
+  // The kept sites are compacted at the beginning of the vector
   std::list<double>::iterator angleList = m_angleList.begin();
-  std::list<vpMeSite>::iterator end = m_meList.end();
-  std::list<vpMeSite>::iterator meList = m_meList.begin();
+  std::vector<vpMeSite>::iterator end = m_meList.end();
+  std::vector<vpMeSite>::iterator meList = m_meList.begin();
+  std::vector<vpMeSite>::iterator meKept = m_meList.begin();
   while (meList != end) {
     vpMeSite p_me = *meList;
     if (p_me.getState() != vpMeSite::NO_SUPPRESSION) {
       // points not selected as me
-      meList = m_meList.erase(meList);
+      ++meList;
       angleList = m_angleList.erase(angleList);
     }
     else {
       if (w[k] < m_thresholdWeight) { // outlier
-        meList = m_meList.erase(meList);
+        ++meList;
         angleList = m_angleList.erase(angleList);
       }
       else { //  good point
@@ -406,12 +408,15 @@ unsigned int vpMeEllipse::leastSquareRobust(const vpImage<unsigned char> &I)
         }
         previous_ang = new_ang;
         *angleList = new_ang;
+        *meKept = p_me;
+        ++meKept;
         ++meList;
         ++angleList;
       }
       ++k; // k contains good points and outliers (used for w[k])
     }
   }
+  m_meList.erase(meKept, m_meList.end());
 
   if (m_meList.size() != m_angleList.size()) {
     // Should never occur
@@ -423,12 +428,11 @@ unsigned int vpMeEllipse::leastSquareRobust(const vpImage<unsigned char> &I)
   bool nbdeb = false;
   std::list<double> finAngle;
   finAngle.clear();
-  std::list<vpMeSite> finMe;
-  finMe.clear();
+  std::vector<vpMeSite> debutMe, finMe;
   std::list<double>::iterator debutAngleList;
-  std::list<vpMeSite>::iterator debutMeList;
   angleList = m_angleList.begin();
   meList = m_meList.begin();
+  meKept = m_meList.begin();
   end = m_meList.end();
   while (meList != end) {
     vpMeSite p_me = *meList;
@@ -439,42 +443,38 @@ unsigned int vpMeEllipse::leastSquareRobust(const vpImage<unsigned char> &I)
       ang += 2.0 * M_PI;
       angleList = m_angleList.erase(angleList);
       finAngle.push_back(ang);
-      meList = m_meList.erase(meList);
       finMe.push_back(p_me);
     }
     // Moved at the beginning of  the list
     else if (ang > m_alpha2) {
       ang -= 2.0 * M_PI;
       angleList = m_angleList.erase(angleList);
-      meList = m_meList.erase(meList);
       if (!nbdeb) {
         m_angleList.push_front(ang);
         debutAngleList = m_angleList.begin();
         ++debutAngleList;
 
-        m_meList.push_front(p_me);
-        debutMeList = m_meList.begin();
-        ++debutMeList;
-
         nbdeb = true;
       }
       else {
         debutAngleList = m_angleList.insert(debutAngleList, ang);
         ++debutAngleList;
-        debutMeList = m_meList.insert(debutMeList, p_me);
-        ++debutMeList;
       }
+      debutMe.push_back(p_me);
     }
     else {
       ++angleList;
-      ++meList;
+      *meKept = p_me;
+      ++meKept;
     }
+    ++meList;
   }
   // Fuse the lists
   angleList = m_angleList.end();
   m_angleList.splice(angleList, finAngle);
-  meList = m_meList.end();
-  m_meList.splice(meList, finMe);
+  m_meList.erase(meKept, m_meList.end());
+  m_meList.insert(m_meList.begin(), debutMe.begin(), debutMe.end());
+  m_meList.insert(m_meList.end(), finMe.begin(), finMe.end());
 
   unsigned int numberOfGoodPoints = 0;
   previous_ang = -4.0 * M_PI;
@@ -496,26 +496,27 @@ unsigned int vpMeEllipse::leastSquareRobust(const vpImage<unsigned char> &I)
   angleList = m_angleList.begin();
   end = m_meList.end();
   meList = m_meList.begin();
+  meKept = m_meList.begin();
   while (meList != end) {
-    vpMeSite p_me = *meList;
     double new_ang = *angleList;
     if ((new_ang >= m_alpha1) && (new_ang <= m_alpha2)) {
       if ((new_ang - previous_ang) >= (0.6 * incr)) {
         previous_ang = new_ang;
         ++numberOfGoodPoints;
-        ++meList;
+        *meKept = *meList;
+        ++meKept;
         ++angleList;
       }
       else {
-        meList = m_meList.erase(meList);
         angleList = m_angleList.erase(angleList);
       }
     }
     else { // point not in the interval [alpha1 ; alpha2]
-      meList = m_meList.erase(meList);
       angleList = m_angleList.erase(angleList);
     }
+    ++meList;
   }
+  m_meList.erase(meKept, m_meList.end());
 
   if ((m_meList.size() != numberOfGoodPoints) || (m_angleList.size() != numberOfGoodPoints)) {
     // Should never occur
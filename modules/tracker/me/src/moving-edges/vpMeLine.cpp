@@ -226,9 +226,9 @@ void vpMeLine::leastSquare(const vpImage<unsigned char> &I)
 
     // Useful to compute the weights in the robust estimation
   vpColVector xp(nos), yp(nos);
-  std::list<vpMeSite>::const_iterator end = m_meList.end();
+  std::vector<vpMeSite>::const_iterator end = m_meList.end();
 
-  for (std::list<vpMeSite>::const_iterator it = m_meList.begin(); it != end; ++it) {
+  for (std::vector<vpMeSite>::const_iterator it = m_meList.begin(); it != end; ++it) {
     vpMeSite p_me = *it;
     if (p_me.getState() == vpMeSite::NO_SUPPRESSION) {
       // From (i,j) to (u,v) frame so that (u,v) in [-1;1]
@@ -308,25 +308,22 @@ void vpMeLine::leastSquare(const vpImage<unsigned char> &I)
   m_b = x[1];
   m_c = x[2];
 
-  // remove all bad points in the list
+  // remove all bad points in the list, the good ones are compacted at the beginning
   unsigned int i = 0;
   end = m_meList.end();
-  for (std::list<vpMeSite>::iterator it = m_meList.begin(); it != end;) {
-    vpMeSite p_me = *it;
-    if (p_me.getState() != vpMeSite::NO_SUPPRESSION) {
-      it = m_meList.erase(it);
-    }
-    else {
+  std::vector<vpMeSite>::iterator kept = m_meList.begin();
+  for (std::vector<vpMeSite>::iterator it = m_meList.begin(); it != end; ++it) {
+    if (it->getState() == vpMeSite::NO_SUPPRESSION) {
       // remove outliers
-      if (w[i] < 0.2) {  // FS: m_thresholdWeight pour vpMeEllipse
-        it = m_meList.erase(it);
-      }
-      else { // good point
-        ++it;
+      if (w[i] >= 0.2) {  // FS: m_thresholdWeight pour vpMeEllipse
+        // good point
+        *kept = *it;
+        ++kept;
       }
       ++i;
     }
   }
+  m_meList.erase(kept, m_meList.end());
 }
 
 void vpMeLine::initTracking(const vpImage<unsigned char> &I, const vpImagePoint &ip1, const vpImagePoint &ip2)
@@ -382,8 +379,7 @@ unsigned int vpMeLine::plugHoles(const vpImage<unsigned char> &I)
 
   unsigned int nb_added_points = 0;
 
-  std::list<vpMeSite>::iterator meList = m_meList.begin();
-  std::list<vpMeSite>::const_iterator end = m_meList.end();
+  std::vector<vpMeSite>::iterator meList = m_meList.begin();
 
   vpImagePoint ip1, ip2;
   if (getExtremities(ip1, ip2) == false) {
@@ -401,7 +397,7 @@ unsigned int vpMeLine::plugHoles(const vpImage<unsigned char> &I)
   vpMeSite pix1 = *meList;
   project(m_a, m_b, m_c, pix1, ip1);
   ++meList;
-  while (meList != end) {
+  while (meList != m_meList.end()) {
     vpMeSite pix2 = *meList;
     project(m_a, m_b, m_c, pix2, ip2);
 
@@ -425,10 +421,11 @@ unsigned int vpMeLine::plugHoles(const vpImage<unsigned char> &I)
             double convolution = pix.convolution(I, m_me);
             double contrastThreshold = fabs(convolution) * marginRatio;
             pix.setContrastThreshold(contrastThreshold, *m_me);
-            pix.track(I, m_me, false);
+            pix.track(I, m_me, false, m_queryBuffer);
             if (pix.getState() == vpMeSite::NO_SUPPRESSION) { // good point
               nb_added_points++;
-              m_meList.insert(meList, pix);
+              meList = m_meList.insert(meList, pix);
+              ++meList;
             }
             if (vpDEBUG_ENABLE(3)) {
               vpDisplay::displayCross(I, iP, 2, vpColor::blue);
@@ -508,9 +505,9 @@ unsigned int vpMeLine::seekExtremities(const vpImage<unsigned char> &I)
         double contrastThreshold = fabs(convolution) * marginRatio;
         P.setContrastThreshold(contrastThreshold, *m_me);
         // fin ajout
-        P.track(I, m_me, false);
+        P.track(I, m_me, false, m_queryBuffer);
         if (P.getState() == vpMeSite::NO_SUPPRESSION) {
-          m_meList.push_front(P);
+          m_meList.insert(m_meList.begin(), P);
           nb_added_points++;
           if (vpDEBUG_ENABLE(3)) {
             vpDisplay::displayCross(I, iP, 5, vpColor::green);
@@ -545,7 +542,7 @@ unsigned int vpMeLine::seekExtremities(const vpImage<unsigned char> &I)
         double convolution = P.convolution(I, m_me);
         double contrastThreshold = fabs(convolution) * marginRatio;
         P.setContrastThreshold(contrastThreshold, *m_me);
-        P.track(I, m_me, false);
+        P.track(I, m_me, false, m_queryBuffer);
         if (P.getState() == vpMeSite::NO_SUPPRESSION) {
           m_meList.push_back(P);
           nb_added_points++;
@@ -604,8 +601,8 @@ void vpMeLine::updateDelta()
 
   // Update delta
   m_delta = atan2(m_a, m_b);
-  std::list<vpMeSite>::const_iterator end = m_meList.end();
-  for (std::list<vpMeSite>::iterator it = m_meList.begin(); it != end; ++it) {
+  std::vector<vpMeSite>::const_iterator end = m_meList.end();
+  for (std::vector<vpMeSite>::iterator it = m_meList.begin(); it != end; ++it) {
     p_me = *it;
     p_me.setAlpha(m_delta);
     *it = p_me;
@@ -664,8 +661,8 @@ void vpMeLine::computeRhoTheta()
   unsigned int nb_pos = 0;
   unsigned int nb_neg = 0;
 
-  std::list<vpMeSite>::const_iterator it = m_meList.begin();
-  std::list<vpMeSite>::const_iterator end = m_meList.end();
+  std::vector<vpMeSite>::const_iterator it = m_meList.begin();
+  std::vector<vpMeSite>::const_iterator end = m_meList.end();
 
   for (; it != end; ++it) {
     vpMeSite p_me = *it;
@@ -915,11 +912,19 @@ void vpMeLine::displayLine(const vpImage<vpRGBa> &I, const vpMeSite &PExt1, cons
 void vpMeLine::displayLine(const vpImage<unsigned char> &I, const vpMeSite &PExt1, const vpMeSite &PExt2,
                            const std::list<vpMeSite> &site_list, const double &A, const double &B, const double &C,
                            const vpColor &color, unsigned int thickness)
+{
+  const std::vector<vpMeSite> site_vector(site_list.begin(), site_list.end());
+  vpMeLine::displayLine(I, PExt1, PExt2, site_vector, A, B, C, color, thickness);
+}
+
+void vpMeLine::displayLine(const vpImage<unsigned char> &I, const vpMeSite &PExt1, const vpMeSite &PExt2,
+                           const std::vector<vpMeSite> &site_list, const double &A, const double &B, const double &C,
+                           const vpColor &color, unsigned int thickness)
 {
   vpImagePoint ip;
-  std::list<vpMeSite>::const_iterator end = site_list.end();
+  std::vector<vpMeSite>::const_iterator end = site_list.end();
 
-  for (std::list<vpMeSite>::const_iterator it = site_list.begin(); it != end; ++it) {
+  for (std::vector<vpMeSite>::const_iterator it = site_list.begin(); it != end; ++it) {
     vpMeSite pix = *it;
     ip.set_i(pix.m_ifloat);
     ip.set_j(pix.m_jfloat);
@@ -968,11 +973,19 @@ void vpMeLine::displayLine(const vpImage<unsigned char> &I, const vpMeSite &PExt
 void vpMeLine::displayLine(const vpImage<vpRGBa> &I, const vpMeSite &PExt1, const vpMeSite &PExt2,
                            const std::list<vpMeSite> &site_list, const double &A, const double &B, const double &C,
                            const vpColor &color, unsigned int thickness)
+{
+  const std::vector<vpMeSite> site_vector(site_list.begin(), site_list.end());
+  vpMeLine::displayLine(I, PExt1, PExt2, site_vector, A, B, C, color, thickness);
+}
+
+void vpMeLine::displayLine(const vpImage<vpRGBa> &I, const vpMeSite &PExt1, const vpMeSite &PExt2,
+                           const std::vector<vpMeSite> &site_list, const double &A, const double &B, const double &C,
+                           const vpColor &color, unsigned int thickness)
 {
   vpImagePoint ip;
-  std::list<vpMeSite>::const_iterator end = site_list.end();
+  std::vector<vpMeSite>::const_iterator end = site_list.end();
 
-  for (std::list<vpMeSite>::const_iterator it = site_list.begin(); it != end; ++it) {
+  for (std::vector<vpMeSite>::const_iterator it = site_list.begin(); it != end; ++it) {
     vpMeSite pix = *it;
     ip.set_i(pix.m_ifloat);
     ip.set_j(pix.m_jfloat);
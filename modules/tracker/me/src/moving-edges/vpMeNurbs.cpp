@@ -270,15 +270,15 @@ void vpMeNurbs::sample(const vpImage<unsigned char> &I, bool doNotTrack)
 
 void vpMeNurbs::suppressPoints()
 {
-  for (std::list<vpMeSite>::iterator it = m_meList.begin(); it != m_meList.end();) {
-    vpMeSite s = *it; // current reference pixel
-
-    if (s.getState() != vpMeSite::NO_SUPPRESSION) {
-      it = m_meList.erase(it);
+  // Keep the sites that are not suppressed at the beginning of the vector
+  std::vector<vpMeSite>::iterator kept = m_meList.begin();
+  for (std::vector<vpMeSite>::iterator it = m_meList.begin(); it != m_meList.end(); ++it) {
+    if (it->getState() == vpMeSite::NO_SUPPRESSION) {
+      *kept = *it;
+      ++kept;
     }
-    else
-      ++it;
   }
+  m_meList.erase(kept, m_meList.end());
 }
 
 void vpMeNurbs::updateDelta()
@@ -286,7 +286,7 @@ void vpMeNurbs::updateDelta()
   double u = 0.0;
   double d = 1e6;
   double d_1 = 1e6;
-  std::list<vpMeSite>::iterator it = m_meList.begin();
+  std::vector<vpMeSite>::iterator it = m_meList.begin();
 
   vpImagePoint Cu;
   vpImagePoint *der = nullptr;
@@ -362,10 +362,10 @@ void vpMeNurbs::seekExtremities(const vpImage<unsigned char> &I)
       if (vpImagePoint::distance(end[0], pt) < threshold)
         break;
       if (!outOfImage(P.get_i(), P.get_j(), 5, rows, cols)) {
-        P.track(I, m_me, false);
+        P.track(I, m_me, false, m_queryBuffer);
 
         if (P.getState() == vpMeSite::NO_SUPPRESSION) {
-          m_meList.push_front(P);
+          m_meList.insert(m_meList.begin(), P);
           beginPtAdded = true;
           pt_max = pt;
           if (vpDEBUG_ENABLE(3)) {
@@ -401,7 +401,7 @@ void vpMeNurbs::seekExtremities(const vpImage<unsigned char> &I)
       if (vpImagePoint::distance(begin[0], pt) < threshold)
         break;
       if (!outOfImage(P.get_i(), P.get_j(), 5, rows, cols)) {
-        P.track(I, m_me, false);
+        P.track(I, m_me, false, m_queryBuffer);
 
         if (P.getState() == vpMeSite::NO_SUPPRESSION) {
           m_meList.push_back(P);
@@ -422,7 +422,7 @@ void vpMeNurbs::seekExtremities(const vpImage<unsigned char> &I)
     m_me->setRange(memory_range);
   }
   else {
-    m_meList.pop_front();
+    m_meList.erase(m_meList.begin());
   }
   /*if(begin != nullptr)*/ delete[] begin;
   /*if(end != nullptr)  */ delete[] end;
@@ -501,17 +501,13 @@ void vpMeNurbs::seekExtremitiesCanny(const vpImage<unsigned char> &I)
     }
 
     if (findCenterPoint(&ip_edges_list)) {
-      for (std::list<vpMeSite>::iterator it = m_meList.begin(); it != m_meList.end();
-        /*++it*/) {
-        vpMeSite s = *it;
-        vpImagePoint iP(s.m_ifloat, s.m_jfloat);
-        if (inRectangle(iP, rect))
-          it = m_meList.erase(it);
-        else
-          break;
+      std::vector<vpMeSite>::iterator it = m_meList.begin();
+      while (it != m_meList.end() && inRectangle(vpImagePoint(it->m_ifloat, it->m_jfloat), rect)) {
+        ++it;
       }
+      m_meList.erase(m_meList.begin(), it);
 
-      std::list<vpMeSite>::iterator itList = m_meList.begin();
+      std::vector<vpMeSite>::iterator itList = m_meList.begin();
       double convlt;
       double delta = 0;
       unsigned int nbr = 0;
@@ -534,8 +530,7 @@ void vpMeNurbs::seekExtremitiesCanny(const vpImage<unsigned char> &I)
             findAngle(I, iPtemp, m_me, delta, convlt);
             pix.init(iPtemp.get_i(), iPtemp.get_j(), delta, convlt);
             pix.setDisplay(m_selectDisplay);
-            --itList;
-            m_meList.insert(itList, pix);
+            itList = m_meList.insert(itList, pix);
             ++itList;
             addedPt.push_front(pix);
             nbr++;
@@ -545,10 +540,10 @@ void vpMeNurbs::seekExtremitiesCanny(const vpImage<unsigned char> &I)
 
       unsigned int memory_range = m_me->getRange();
       m_me->setRange(3);
-      std::list<vpMeSite>::iterator itList2 = m_meList.begin();
+      std::vector<vpMeSite>::iterator itList2 = m_meList.begin();
       for (unsigned int j = 0; j < nbr; j++) {
         vpMeSite s = *itList2;
-        s.track(I, m_me, false);
+        s.track(I, m_me, false, m_queryBuffer);
         *itList2 = s;
         ++itList2;
       }
@@ -630,25 +625,20 @@ void vpMeNurbs::seekExtremitiesCanny(const vpImage<unsigned char> &I)
     if (findCenterPoint(&ip_edges_list)) {
       vpMeSite s;
 
-      for (std::list<vpMeSite>::iterator it = m_meList.begin(); it!=m_meList.end(); ++it) {
-        s = *it;
-        vpImagePoint iP(s.m_ifloat, s.m_jfloat);
-        if (inRectangle(iP, rect)) {
-          m_meList.erase(it);
-        }
-        else
-          break;
+      std::vector<vpMeSite>::iterator it = m_meList.begin();
+      while (it != m_meList.end() && inRectangle(vpImagePoint(it->m_ifloat, it->m_jfloat), rect)) {
+        ++it;
       }
+      m_meList.erase(m_meList.begin(), it);
 
-      std::list<vpMeSite>::iterator itList = m_meList.end();
-      --itList; // Move on the last element
+      const size_t lastIndex = m_meList.size() - 1; // Index of the last element
       double convlt;
       double delta;
       unsigned int nbr = 0;
       std::list<vpMeSite> addedPt;
       for (std::list<vpImagePoint>::const_iterator itEdges = ip_edges_list.begin(); itEdges != ip_edges_list.end();
         ++itEdges) {
-        s = *itList;
+        s = m_meList[lastIndex];
         vpImagePoint iPtemp = *itEdges + topLeft;
         vpMeSite pix;
         pix.init(iPtemp.get_i(), iPtemp.get_j(), 0);
@@ -673,13 +663,14 @@ void vpMeNurbs::seekExtremitiesCanny(const vpImage<unsigned char> &I)
 
       unsigned int memory_range = m_me->getRange();
       m_me->setRange(3);
-      std::list<vpMeSite>::iterator itList2 = m_meList.end();
+      std::vector<vpMeSite>::iterator itList2 = m_meList.end();
       --itList2; // Move to the last element
       for (unsigned int j = 0; j < nbr; j++) {
-        vpMeSite me_s = *itList2;
-        me_s.track(I, m_me, false);
-        *itList2 = me_s;
-        --itList2;
+        vpMeSite &me_s = *itList2;
+        me_s.track(I, m_me, false, m_queryBuffer);
+        if (j + 1 < nbr) {
+          --itList2;
+        }
       }
       m_me->setRange(memory_range);
     }
@@ -702,14 +693,19 @@ void vpMeNurbs::reSample(const vpImage<unsigned char> &I)
 
 void vpMeNurbs::localReSample(const vpImage<unsigned char> &I)
 {
+  // Pairs of consecutive sites are walked
+  if (m_meList.size() < 2) {
+    return;
+  }
+
   int rows = static_cast<int>(I.getHeight());
   int cols = static_cast<int>(I.getWidth());
   vpImagePoint *iP = nullptr;
 
   int n = static_cast<int>(numberOfSignal());
 
-  std::list<vpMeSite>::iterator it = m_meList.begin();
-  std::list<vpMeSite>::iterator itNext = m_meList.begin();
+  std::vector<vpMeSite>::iterator it = m_meList.begin();
+  std::vector<vpMeSite>::iterator itNext = m_meList.begin();
   ++itNext;
 
   unsigned int range_tmp = m_me->getRange();
@@ -765,9 +761,11 @@ void vpMeNurbs::localReSample(const vpImage<unsigned char> &I)
             vpMeSite pix;
             pix.init(iP[0].get_i(), iP[0].get_j(), delta);
             pix.setDisplay(m_selectDisplay);
-            pix.track(I, m_me, false);
+            pix.track(I, m_me, false, m_queryBuffer);
             if (pix.getState() == vpMeSite::NO_SUPPRESSION) {
-              m_meList.insert(it, pix);
+              it = m_meList.insert(it, pix);
+              ++it;
+              itNext = it + 1;
               iP_1 = iP[0];
             }
           }
@@ -786,8 +784,12 @@ void vpMeNurbs::localReSample(const vpImage<unsigned char> &I)
 
 void vpMeNurbs::supressNearPoints()
 {
-  std::list<vpMeSite>::const_iterator it = m_meList.begin();
-  std::list<vpMeSite>::iterator itNext = m_meList.begin();
+  if (m_meList.size() < 2) {
+    return;
+  }
+
+  std::vector<vpMeSite>::const_iterator it = m_meList.begin();
+  std::vector<vpMeSite>::iterator itNext = m_meList.begin();
   ++itNext;
   for (; itNext != m_meList.end();) {
     vpMeSite s = *it;          // current reference pixel
@@ -330,7 +330,104 @@ double vpMeSite::convolution(const vpImage<unsigned char> &I, const vpMe &me, co
   return conv;
 }
 
+void vpMeSite::vpMeSiteQueryBuffer::resize(unsigned int numQueries, unsigned int maskSize)
+{
+  // std::vector::resize() never reduces the capacity: no allocation once the largest size has been reached
+  m_ifloat.resize(numQueries);
+  m_jfloat.resize(numQueries);
+  m_i.resize(numQueries);
+  m_j.resize(numQueries);
+  m_inside.resize(numQueries);
+  m_convolution.resize(numQueries);
+  m_pixels.resize(static_cast<size_t>(maskSize) * maskSize * numQueries);
+}
+
+void vpMeSite::computeQueryConvolutions(const vpImage<unsigned char> &I, const vpMe &me, unsigned int mask_index,
+                                        vpMeSiteQueryBuffer &buffer) const
+{
+  const int range = static_cast<int>(me.getRange());
+  const unsigned int numQueries = static_cast<unsigned int>(buffer.m_convolution.size());
+  const unsigned int msize = me.getMaskSize();
+  const int half = static_cast<int>((msize - 1) >> 1);
+  const int height = static_cast<int>(I.getHeight());
+  const int width = static_cast<int>(I.getWidth());
+
+  // Query sites along the normal, as in getQueryList()
+  double salpha = sin(m_alpha);
+  double calpha = cos(m_alpha);
+  unsigned int n = 0;
+  for (int k = -range; k <= range; ++k) {
+    double ii = m_ifloat + (k * salpha);
+    double jj = m_jfloat + (k * calpha);
+
+    // Display
+    if ((m_selectDisplay == RANGE_RESULT) || (m_selectDisplay == RANGE)) {
+      vpDisplay::displayCross(I, vpImagePoint(ii, jj), 1, vpColor::yellow);
+    }
+
+    buffer.m_ifloat[n] = ii;
+    buffer.m_jfloat[n] = jj;
+    buffer.m_i[n] = static_cast<int>(ii);
+    buffer.m_j[n] = static_cast<int>(jj);
+    ++n;
+  }
+
+  // Gather the pixels under the mask of each query site
+  double *pixels = buffer.m_pixels.data();
+  for (n = 0; n < numQueries; ++n) {
+    if (outsideImage(buffer.m_i[n], buffer.m_j[n], half + me.getStrip(), height, width)) {
+      buffer.m_inside[n] = 0;
+      for (unsigned int ab = 0; ab < (msize * msize); ++ab) {
+        pixels[(ab * numQueries) + n] = 0.0;
+      }
+    }
+    else {
+      buffer.m_inside[n] = 1;
+      unsigned int ihalf = static_cast<unsigned int>(buffer.m_i[n] - half);
+      unsigned int jhalf = static_cast<unsigned int>(buffer.m_j[n] - half);
+      for (unsigned int a = 0; a < msize; ++a) {
+        const unsigned char *row = I[ihalf + a] + jhalf;
+        for (unsigned int b = 0; b < msize; ++b) {
+          pixels[((a * msize + b) * numQueries) + n] = row[b];
+        }
+      }
+    }
+  }
+
+  // Convolution of all the query sites at once. Each query accumulates the mask elements in the same order
+  // as convolution(), so that the result is the same.
+  double *conv = buffer.m_convolution.data();
+  for (n = 0; n < numQueries; ++n) {
+    conv[n] = 0.0;
+  }
+  const vpMatrix &mask = me.getMask()[mask_index];
+  for (unsigned int a = 0; a < msize; ++a) {
+    for (unsigned int b = 0; b < msize; ++b) {
+      const double w = m_mask_sign * mask[a][b];
+      const double *p = pixels + ((a * msize + b) * numQueries);
+      for (n = 0; n < numQueries; ++n) {
+        conv[n] += w * p[n];
+      }
+    }
+  }
+
+  for (n = 0; n < numQueries; ++n) {
+    if (!buffer.m_inside[n]) {
+      conv[n] = 0.0;
+      buffer.m_i[n] = 0;
+      buffer.m_j[n] = 0;
+    }
+  }
+}
+
 void vpMeSite::track(const vpImage<unsigned char> &I, const vpMe *me, const bool &test_contrast)
+{
+  vpMeSiteQueryBuffer buffer;
+  track(I, me, test_contrast, buffer);
+}
+
+void vpMeSite::track(const vpImage<unsigned char> &I, const vpMe *me, const bool &test_contrast,
+                     vpMeSiteQueryBuffer &buffer)
 {
   int max_rank = -1;
   double max_convolution = 0;
@@ -343,24 +440,29 @@ void vpMeSite::track(const vpImage<unsigned char> &I, const vpMe *me, const bool
   const unsigned int normalSides = 2;
   const unsigned int numQueries = range * normalSides + 1;
   unsigned int mask_index = computeMaskIndex(m_alpha, *me);
-  vpMeSite *list_query_pixels = getQueryList(I, static_cast<int>(range));
 
   double contrast_max = 1 + me->getMu2();
   double contrast_min = 1 - me->getMu1();
 
   double threshold = computeFinalThreshold(*me);
 
-  if (test_contrast) { // likelihood test
-    double diff = 1e6;
+  if (test_contrast) {
     // Change of mask sign to have a continuity at 0 and 180.
     // Threshold at 120 to be more than the 90 initial value
     if (vpMath::abs(static_cast<int>(mask_index - m_index_prev)) > 120) {
       m_mask_sign = -m_mask_sign;
     }
+  }
+
+  buffer.resize(numQueries, me->getMaskSize());
+  computeQueryConvolutions(I, *me, mask_index, buffer);
+  const double *convolutions = buffer.m_convolution.data();
+
+  if (test_contrast) { // likelihood test
+    double diff = 1e6;
     for (unsigned int n = 0; n < numQueries; ++n) {
       // Convolution results
-      list_query_pixels[n].m_mask_sign = m_mask_sign;
-      double convolution_ = list_query_pixels[n].convolution(I, *me, mask_index);
+      double convolution_ = convolutions[n];
       // no fabs since m_convlt > 0 and we look for a similar one
       const double likelihood = convolution_ + m_convlt;
 
@@ -378,7 +480,7 @@ void vpMeSite::track(const vpImage<unsigned char> &I, const vpMe *me, const bool
   else { // test on contrast only
     for (unsigned int n = 0; n < numQueries; ++n) {
       // Convolution results
-      double convolution_ = list_query_pixels[n].convolution(I, me);
+      double convolution_ = convolutions[n];
       const double likelihood = fabs(2 * convolution_);
       if ((likelihood > max) && (likelihood > threshold)) {
         max_convolution = convolution_;
@@ -398,23 +500,27 @@ void vpMeSite::track(const vpImage<unsigned char> &I, const vpMe *me, const bool
 
   if (max_rank >= 0) {
     if ((m_selectDisplay == RANGE_RESULT) || (m_selectDisplay == RESULT)) {
-      ip.set_i(list_query_pixels[max_rank].m_i);
-      ip.set_j(list_query_pixels[max_rank].m_j);
+      ip.set_i(buffer.m_i[max_rank]);
+      ip.set_j(buffer.m_j[max_rank]);
       vpDisplay::displayPoint(I, ip, vpColor::red);
     }
 
-    list_query_pixels[max_rank].m_mask_sign = m_mask_sign;
-    list_query_pixels[max_rank].m_index_prev = mask_index;
-    list_query_pixels[max_rank].m_convlt = max_convolution;
-    list_query_pixels[max_rank].m_normGradient = vpMath::sqr(max_convolution);
-
-    *this = list_query_pixels[max_rank]; // The vpMeSite2 is replaced by the vpMeSite2 of max likelihood
+    // The site is replaced by the query site of max likelihood
+    m_i = buffer.m_i[max_rank];
+    m_j = buffer.m_j[max_rank];
+    m_ifloat = buffer.m_ifloat[max_rank];
+    m_jfloat = buffer.m_jfloat[max_rank];
+    m_index_prev = mask_index;
+    m_convlt = max_convolution;
+    m_normGradient = vpMath::sqr(max_convolution);
+    m_weight = 1;
+    m_state = NO_SUPPRESSION;
   }
   else // none of the query sites is better than the threshold
   {
     if ((m_selectDisplay == RANGE_RESULT) || (m_selectDisplay == RESULT)) {
-      ip.set_i(list_query_pixels[0].m_i);
-      ip.set_j(list_query_pixels[0].m_j);
+      ip.set_i(buffer.m_i[0]);
+      ip.set_j(buffer.m_j[0]);
       vpDisplay::displayPoint(I, ip, vpColor::green);
     }
     m_normGradient = 0;
@@ -424,9 +530,7 @@ void vpMeSite::track(const vpImage<unsigned char> &I, const vpMe *me, const bool
     else {
       m_state = THRESHOLD; // threshold suppression
     }
-
   }
-  delete[] list_query_pixels;
 }
 
 void vpMeSite::trackMultipleHypotheses(const vpImage<unsigned char> &I, const vpMe &me, const bool &test_contrast,
@@ -43,6 +43,10 @@
 #include <algorithm>
 #include <visp3/core/vpTrackingException.h>
 
+#ifdef VISP_HAVE_OPENMP
+#include <omp.h>
+#endif
+
 BEGIN_VISP_NAMESPACE
 
 void vpMeTracker::init()
@@ -54,13 +58,15 @@ void vpMeTracker::init()
 }
 
 vpMeTracker::vpMeTracker()
-  : m_meList(), m_me(nullptr), m_nGoodElement(0), m_mask(nullptr), m_maskCandidates(nullptr), m_selectDisplay(vpMeSite::NONE)
+  : m_meList(), m_me(nullptr), m_nGoodElement(0), m_mask(nullptr), m_maskCandidates(nullptr), m_selectDisplay(vpMeSite::NONE),
+  m_queryBuffer(), m_nbThread(1), m_threadQueryBuffers()
 {
   init();
 }
 
 vpMeTracker::vpMeTracker(const vpMeTracker &meTracker)
-  : vpTracker(meTracker), m_meList(), m_me(nullptr), m_nGoodElement(0), m_mask(nullptr), m_maskCandidates(nullptr), m_selectDisplay(vpMeSite::NONE)
+  : vpTracker(meTracker), m_meList(), m_me(nullptr), m_nGoodElement(0), m_mask(nullptr), m_maskCandidates(nullptr), m_selectDisplay(vpMeSite::NONE),
+  m_queryBuffer(), m_nbThread(1), m_threadQueryBuffers()
 {
   init();
 
@@ -68,6 +74,7 @@ vpMeTracker::vpMeTracker(const vpMeTracker &meTracker)
   m_meList = meTracker.m_meList;
   m_nGoodElement = meTracker.m_nGoodElement;
   m_selectDisplay = meTracker.m_selectDisplay;
+  m_nbThread = meTracker.m_nbThread;
 }
 
 void vpMeTracker::reset()
@@ -84,6 +91,7 @@ vpMeTracker &vpMeTracker::operator=(vpMeTracker &meTracker)
   m_me = meTracker.m_me;
   m_selectDisplay = meTracker.m_selectDisplay;
   m_nGoodElement = meTracker.m_nGoodElement;
+  m_nbThread = meTracker.m_nbThread;
   return *this;
 }
 
@@ -190,21 +198,19 @@ void vpMeTracker::initTracking(const vpImage<unsigned char> &I)
   m_nGoodElement = 0;
 
   // Loop through list of sites to track
-  std::list<vpMeSite>::iterator end = m_meList.end();
-  for (std::list<vpMeSite>::iterator it = m_meList.begin(); it != end; ++it) {
-    vpMeSite refp = *it; // current reference pixel
+  std::vector<vpMeSite>::iterator end = m_meList.end();
+  for (std::vector<vpMeSite>::iterator it = m_meList.begin(); it != end; ++it) {
+    vpMeSite &refp = *it; // current reference pixel
 
     // If element hasn't been suppressed
     if (refp.getState() == vpMeSite::NO_SUPPRESSION) {
 
-      refp.track(I, m_me, false);
+      refp.track(I, m_me, false, m_queryBuffer);
 
       if (refp.getState() == vpMeSite::NO_SUPPRESSION) {
         ++m_nGoodElement;
       }
     }
-
-    *it = refp;
   }
 
   m_me->setRange(range_tmp);
@@ -222,37 +228,79 @@ void vpMeTracker::track(const vpImage<unsigned char> &I)
 
   m_nGoodElement = 0;
 
-  // Loop through list of sites to track
-  std::list<vpMeSite>::iterator it = m_meList.begin();
-  std::list<vpMeSite>::iterator end = m_meList.end();
-  while (it != end) {
-    vpMeSite s = *it; // current reference pixel
+  int nbGoodElement = 0;
+  const int nbSites = static_cast<int>(m_meList.size());
+  const int nbThread = (m_nbThread > 1) ? std::min<int>(m_nbThread, nbSites) : 1;
+  if (static_cast<int>(m_threadQueryBuffers.size()) < nbThread) {
+    m_threadQueryBuffers.resize(static_cast<size_t>(nbThread));
+  }
+
+  // Loop through list of sites to track. The sites are independent, each thread uses its own scratch buffers.
+  // Since the displays are not thread-safe, the sites that are displayed while tracked are left to the calling thread
+  bool hasDisplayedSites = false;
+#ifdef VISP_HAVE_OPENMP
+#pragma omp parallel for num_threads(nbThread) schedule(static) reduction(+:nbGoodElement) reduction(||:hasDisplayedSites) if (nbThread > 1)
+#endif
+  for (int k = 0; k < nbSites; ++k) {
+    vpMeSite &s = m_meList[static_cast<size_t>(k)]; // current reference pixel
 
     // If element hasn't been suppressed
     if (s.getState() == vpMeSite::NO_SUPPRESSION) {
-      s.track(I, m_me, true);
-
-
-      if (vpMeTracker::inRoiMask(m_mask, static_cast<unsigned int>(s.get_i()), static_cast<unsigned int>(s.get_j()))) {
-        if (s.getState() == vpMeSite::NO_SUPPRESSION) {
-          ++m_nGoodElement;
-        }
+      if ((nbThread > 1) && (s.getDisplay() != vpMeSite::NONE)) {
+        hasDisplayedSites = true;
       }
       else {
-        // Site outside mask
-        s.setState(vpMeSite::OUTSIDE_ROI_MASK);
+#ifdef VISP_HAVE_OPENMP
+        vpMeSite::vpMeSiteQueryBuffer &buffer = (nbThread > 1) ? m_threadQueryBuffers[static_cast<size_t>(omp_get_thread_num())] : m_queryBuffer;
+#else
+        vpMeSite::vpMeSiteQueryBuffer &buffer = m_queryBuffer;
+#endif
+        if (trackSite(I, s, buffer)) {
+          ++nbGoodElement;
+        }
+      }
+    }
+  }
+
+  if (hasDisplayedSites) {
+    for (int k = 0; k < nbSites; ++k) {
+      vpMeSite &s = m_meList[static_cast<size_t>(k)];
+      if ((s.getState() == vpMeSite::NO_SUPPRESSION) && (s.getDisplay() != vpMeSite::NONE)) {
+        if (trackSite(I, s, m_queryBuffer)) {
+          ++nbGoodElement;
+        }
       }
     }
+  }
+  m_nGoodElement = nbGoodElement;
+}
 
-    *it = s;
-    ++it;
+bool vpMeTracker::trackSite(const vpImage<unsigned char> &I, vpMeSite &s, vpMeSite::vpMeSiteQueryBuffer &buffer)
+{
+  s.track(I, m_me, true, buffer);
+
+  if (!vpMeTracker::inRoiMask(m_mask, static_cast<unsigned int>(s.get_i()), static_cast<unsigned int>(s.get_j()))) {
+    // Site outside mask
+    s.setState(vpMeSite::OUTSIDE_ROI_MASK);
+    return false;
   }
+  return (s.getState() == vpMeSite::NO_SUPPRESSION);
+}
+
+void vpMeTracker::setNbThread(const int &nbThread)
+{
+#ifdef VISP_HAVE_OPENMP
+  m_nbThread = (nbThread < 0) ? omp_get_max_threads() : std::max<int>(nbThread, 1);
+#else
+  (void)nbThread;
+  m_nbThread = 1;
+#endif
 }
 
 void vpMeTracker::display(const vpImage<unsigned char> &I)
 {
-  std::list<vpMeSite>::const_iterator end = m_meList.end();
-  for (std::list<vpMeSite>::const_iterator it = m_meList.begin(); it != end; ++it) {
+  std::vector<vpMeSite>::const_iterator end = m_meList.end();
+  for (std::vector<vpMeSite>::const_iterator it = m_meList.begin(); it != end; ++it) {
     vpMeSite p_me = *it;
     p_me.display(I);
   }
@@ -260,8 +308,8 @@ void vpMeTracker::display(const vpImage<unsigned char> &I)
 
 void vpMeTracker::display(const vpImage<vpRGBa> &I)
 {
-  std::list<vpMeSite>::const_iterator end = m_meList.end();
-  for (std::list<vpMeSite>::const_iterator it = m_meList.begin(); it != end; ++it) {
+  std::vector<vpMeSite>::const_iterator end = m_meList.end();
+  for (std::vector<vpMeSite>::const_iterator it = m_meList.begin(); it != end; ++it) {
     vpMeSite p_me = *it;
     p_me.display(I);
   }
@@ -269,8 +317,8 @@ void vpMeTracker::display(const vpImage<vpRGBa> &I)
 
 void vpMeTracker::display(const vpImage<unsigned char> &I, vpColVector &w, unsigned int &index_w)
 {
-  std::list<vpMeSite>::iterator end = m_meList.end();
-  for (std::list<vpMeSite>::iterator it = m_meList.begin(); it != end; ++it) {
+  std::vector<vpMeSite>::iterator end = m_meList.end();
+  for (std::vector<vpMeSite>::iterator it = m_meList.begin(); it != end; ++it) {
     vpMeSite P = *it;
 
     if (P.getState() == vpMeSite::NO_SUPPRESSION) {
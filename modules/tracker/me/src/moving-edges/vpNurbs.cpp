@@ -572,13 +572,18 @@ void vpNurbs::globalCurveInterp(const std::list<vpImagePoint> &l_crossingPoints)
 
 
 void vpNurbs::globalCurveInterp(const std::list<vpMeSite> &l_crossingPoints)
+{
+  globalCurveInterp(std::vector<vpMeSite>(l_crossingPoints.begin(), l_crossingPoints.end()));
+}
+
+void vpNurbs::globalCurveInterp(const std::vector<vpMeSite> &l_crossingPoints)
 {
   std::vector<vpImagePoint> v_crossingPoints;
   vpMeSite s = l_crossingPoints.front();
   vpImagePoint pt(s.get_ifloat(), s.get_jfloat());
   vpImagePoint pt_1 = pt;
   v_crossingPoints.push_back(pt);
-  std::list<vpMeSite>::const_iterator it = l_crossingPoints.begin();
+  std::vector<vpMeSite>::const_iterator it = l_crossingPoints.begin();
   ++it;
   for (; it != l_crossingPoints.end(); ++it) {
     vpImagePoint pt_tmp(it->get_ifloat(), it->get_jfloat());
@@ -735,9 +740,15 @@ void vpNurbs::globalCurveApprox(const std::list<vpImagePoint> &l_crossingPoints,
 }
 
 void vpNurbs::globalCurveApprox(const std::list<vpMeSite> &l_crossingPoints, unsigned int n)
+{
+  globalCurveApprox(std::vector<vpMeSite>(l_crossingPoints.begin(), l_crossingPoints.end()), n);
+}
+
+void vpNurbs::globalCurveApprox(const std::vector<vpMeSite> &l_crossingPoints, unsigned int n)
 {
   std::vector<vpImagePoint> v_crossingPoints;
-  for (std::list<vpMeSite>::const_iterator it = l_crossingPoints.begin(); it != l_crossingPoints.end(); ++it) {
+  v_crossingPoints.reserve(l_crossingPoints.size());
+  for (std::vector<vpMeSite>::const_iterator it = l_crossingPoints.begin(); it != l_crossingPoints.end(); ++it) {
     vpImagePoint pt(it->get_ifloat(), it->get_jfloat());
     v_crossingPoints.push_back(pt);
   }
@@ -0,0 +1,331 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Test vpMeSite tracking along the normal.
+ */
+
+/*!
+  \file catchMeSite.cpp
+
+  Test that vpMeSite::track() gives the same result as the reference search
+  built on vpMeSite::getQueryList() and vpMeSite::convolution().
+*/
+
+#include <visp3/core/vpConfig.h>
+
+#if defined(VISP_HAVE_CATCH2)
+
+#include <random>
+#include <vector>
+
+#include <visp3/core/vpImage.h>
+#include <visp3/core/vpMath.h>
+#include <visp3/me/vpMe.h>
+#include <visp3/me/vpMeSite.h>
+#include <visp3/me/vpMeTracker.h>
+
+#if defined(VISP_BUILD_CATCH2)
+#include <catch_amalgamated.hpp>
+#else // Since v3.1.1
+#include <catch2/catch_all.hpp>
+#endif
+
+#ifdef ENABLE_VISP_NAMESPACE
+using namespace VISP_NAMESPACE_NAME;
+#endif
+
+namespace
+{
+// Synthetic image with a tilted step edge and some noise
+void buildImage(vpImage<unsigned char> &I, double theta, double offset, unsigned int seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> noise(-10, 10);
+  const double c = cos(theta), s = sin(theta);
+  for (unsigned int i = 0; i < I.getHeight(); ++i) {
+    for (unsigned int j = 0; j < I.getWidth(); ++j) {
+      const int level = (((i * s) + (j * c)) > offset) ? 180 : 60;
+      I[i][j] = static_cast<unsigned char>(level + noise(gen));
+    }
+  }
+}
+
+// Search along the normal as done before the structure-of-arrays implementation of vpMeSite::track()
+struct vpMeSiteExpected
+{
+  bool found;
+  vpMeSite site;
+  int mask_sign;
+  vpMeSite::vpMeSiteState state;
+};
+
+vpMeSiteExpected referenceTrack(const vpMeSite &input, const vpImage<unsigned char> &I, const vpMe &me, bool test_contrast)
+{
+  vpMeSite s = input;
+  vpMeSiteExpected res;
+  const int range = static_cast<int>(me.getRange());
+  const unsigned int numQueries = me.getRange() * 2 + 1;
+  const unsigned int mask_index = s.computeMaskIndex(s.getAlpha(), me);
+  const double contrast_max = 1 + me.getMu2();
+  const double contrast_min = 1 - me.getMu1();
+  const double threshold = s.computeFinalThreshold(me);
+  vpMeSite *list = s.getQueryList(I, range);
+  int max_rank = -1;
+  double max_convolution = 0, max = 0, contrast = 0;
+  int sign = s.m_mask_sign;
+
+  if (test_contrast) {
+    if (vpMath::abs(static_cast<int>(mask_index - s.getIndex())) > 120) {
+      sign = -sign;
+    }
+    double diff = 1e6;
+    for (unsigned int n = 0; n < numQueries; ++n) {
+      list[n].m_mask_sign = sign;
+      const double conv = list[n].convolution(I, me, mask_index);
+      const double likelihood = conv + s.m_convlt;
+      if (likelihood > threshold) {
+        contrast = conv / s.m_convlt;
+        if ((contrast > contrast_min) && (contrast < contrast_max) && (fabs(1 - contrast) < diff)) {
+          diff = fabs(1 - contrast);
+          max_convolution = conv;
+          max = likelihood;
+          max_rank = static_cast<int>(n);
+        }
+      }
+    }
+  }
+  else {
+    for (unsigned int n = 0; n < numQueries; ++n) {
+      const double conv = list[n].convolution(I, &me);
+      const double likelihood = fabs(2 * conv);
+      if ((likelihood > max) && (likelihood > threshold)) {
+        max_convolution = conv;
+        max = likelihood;
+        max_rank = static_cast<int>(n);
+      }
+    }
+    if (max_convolution < 0) {
+      max_convolution = -max_convolution;
+      sign = -sign;
+    }
+  }
+
+  res.found = (max_rank >= 0);
+  res.mask_sign = sign;
+  if (res.found) {
+    res.site = list[max_rank];
+    res.site.m_convlt = max_convolution;
+    res.site.m_normGradient = vpMath::sqr(max_convolution);
+    res.state = vpMeSite::NO_SUPPRESSION;
+  }
+  else {
+    res.site = s;
+    res.site.m_normGradient = 0;
+    res.state = (std::fabs(contrast) > std::numeric_limits<double>::epsilon()) ? vpMeSite::CONTRAST : vpMeSite::THRESHOLD;
+  }
+  delete[] list;
+  return res;
+}
+
+void checkSame(const vpMeSite &tracked, const vpMeSiteExpected &expected, unsigned int mask_index)
+{
+  CHECK(tracked.getState() == expected.state);
+  CHECK(tracked.m_mask_sign == expected.mask_sign);
+  CHECK(tracked.get_i() == expected.site.get_i());
+  CHECK(tracked.get_j() == expected.site.get_j());
+  CHECK(tracked.get_ifloat() == expected.site.get_ifloat());
+  CHECK(tracked.get_jfloat() == expected.site.get_jfloat());
+  CHECK(tracked.m_convlt == expected.site.m_convlt);
+  CHECK(tracked.m_normGradient == expected.site.m_normGradient);
+  CHECK(tracked.getWeight() == expected.site.getWeight());
+  if (expected.found) {
+    CHECK(tracked.getIndex() == mask_index);
+  }
+}
+
+// Moving-edges tracker on a given set of sites
+class vpMeSiteSetTracker : public vpMeTracker
+{
+public:
+  void sample(const vpImage<unsigned char> &, bool) VP_OVERRIDE { }
+};
+
+// Sites close to the edge, some of them with a mask that does not fit in the image, and sites anywhere in the image
+std::vector<vpMeSite> buildSites(const vpImage<unsigned char> &I, const vpMe &me, double theta)
+{
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> ri(0., I.getHeight()), rj(0., I.getWidth()), ralpha(-M_PI, M_PI);
+  std::uniform_real_distribution<double> rt(-250., 250.), rn(-5., 5.), rdalpha(-0.2, 0.2);
+
+  std::vector<vpMeSite> sites;
+  for (unsigned int k = 0; k < 300; ++k) {
+    const double t = rt(gen), d = 150 + rn(gen);
+    vpMeSite s;
+    s.init((d * sin(theta)) - (t * cos(theta)), (d * cos(theta)) + (t * sin(theta)), theta + rdalpha(gen), 0, 1);
+    s.setContrastThreshold(20, me);
+    sites.push_back(s);
+  }
+  for (unsigned int k = 0; k < 100; ++k) {
+    vpMeSite s;
+    s.init(ri(gen), rj(gen), ralpha(gen), 0, 1);
+    s.setContrastThreshold(20, me);
+    sites.push_back(s);
+  }
+  return sites;
+}
+}
+
+SCENARIO("Tracking moving-edges sites along the normal", "[vpMeSite]")
+{
+  const unsigned int nbFrames = 5;
+  vpImage<unsigned char> I(240, 320);
+  vpMe me;
+  me.setRange(12);
+  me.setMaskSize(5);
+  me.setMaskNumber(180);
+  me.setLikelihoodThresholdType(vpMe::NORMALIZED_THRESHOLD);
+  me.setThreshold(20);
+
+  const double theta = vpMath::rad(30);
+  std::vector<vpMeSite> sites = buildSites(I, me, theta);
+
+  GIVEN("A reusable query buffer")
+  {
+    vpMeSite::vpMeSiteQueryBuffer buffer;
+    for (unsigned int f = 0; f < nbFrames; ++f) {
+      buildImage(I, theta, 150 + (2.0 * f), f);
+      const bool test_contrast = (f > 0);
+      for (size_t k = 0; k < sites.size(); ++k) {
+        if (sites[k].getState() != vpMeSite::NO_SUPPRESSION) {
+          continue;
+        }
+        const unsigned int mask_index = sites[k].computeMaskIndex(sites[k].getAlpha(), me);
+        const vpMeSiteExpected expected = referenceTrack(sites[k], I, me, test_contrast);
+        vpMeSite withoutBuffer = sites[k];
+        withoutBuffer.track(I, &me, test_contrast);
+        sites[k].track(I, &me, test_contrast, buffer);
+        checkSame(sites[k], expected, mask_index);
+        checkSame(withoutBuffer, expected, mask_index);
+      }
+    }
+  }
+}
+
+SCENARIO("Tracking moving-edges sites with several threads", "[vpMeTracker]")
+{
+  const unsigned int nbFrames = 5;
+  vpImage<unsigned char> I(240, 320);
+  vpMe me;
+  me.setRange(12);
+  me.setMaskSize(5);
+  me.setMaskNumber(180);
+  me.setLikelihoodThresholdType(vpMe::NORMALIZED_THRESHOLD);
+  me.setThreshold(20);
+  const double theta = vpMath::rad(30);
+
+  GIVEN("A sequential and a multi-threaded tracker on the same sites")
+  {
+    vpMeSiteSetTracker sequential, parallel;
+    sequential.setMe(&me);
+    parallel.setMe(&me);
+    sequential.setMeSites(buildSites(I, me, theta));
+    parallel.setMeSites(sequential.getMeSites());
+    parallel.setNbThread(4);
+
+    THEN("Both trackers give the same sites")
+    {
+      for (unsigned int f = 0; f < nbFrames; ++f) {
+        buildImage(I, theta, 150 + (2.0 * f), f);
+        sequential.track(I);
+        parallel.track(I);
+
+        CHECK(parallel.getNbPoints() == sequential.getNbPoints());
+        const std::vector<vpMeSite> &expected = sequential.getMeSites();
+        const std::vector<vpMeSite> &tracked = parallel.getMeSites();
+        REQUIRE(tracked.size() == expected.size());
+        for (size_t k = 0; k < tracked.size(); ++k) {
+          CHECK(tracked[k].getState() == expected[k].getState());
+          CHECK(tracked[k].get_ifloat() == expected[k].get_ifloat());
+          CHECK(tracked[k].get_jfloat() == expected[k].get_jfloat());
+          CHECK(tracked[k].m_convlt == expected[k].m_convlt);
+          CHECK(tracked[k].m_mask_sign == expected[k].m_mask_sign);
+        }
+      }
+    }
+  }
+
+  GIVEN("A multi-threaded tracker with some displayed sites")
+  {
+    vpMeSiteSetTracker sequential, parallel;
+    sequential.setMe(&me);
+    parallel.setMe(&me);
+    sequential.setMeSites(buildSites(I, me, theta));
+    std::vector<vpMeSite> sites = sequential.getMeSites();
+    for (size_t k = 0; k < sites.size(); k += 3) {
+      sites[k].setDisplay(vpMeSite::RANGE_RESULT);
+    }
+    parallel.setMeSites(sites);
+    parallel.setNbThread(4);
+
+    THEN("The displayed sites are tracked as the others")
+    {
+      for (unsigned int f = 0; f < nbFrames; ++f) {
+        buildImage(I, theta, 150 + (2.0 * f), f);
+        sequential.track(I);
+        parallel.track(I);
+
+        CHECK(parallel.getNbPoints() == sequential.getNbPoints());
+        const std::vector<vpMeSite> &expected = sequential.getMeSites();
+        const std::vector<vpMeSite> &tracked = parallel.getMeSites();
+        REQUIRE(tracked.size() == expected.size());
+        for (size_t k = 0; k < tracked.size(); ++k) {
+          CHECK(tracked[k].getState() == expected[k].getState());
+          CHECK(tracked[k].get_ifloat() == expected[k].get_ifloat());
+          CHECK(tracked[k].get_jfloat() == expected[k].get_jfloat());
+        }
+      }
+    }
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  Catch::Session session; // There must be exactly one instance
+  session.applyCommandLine(argc, argv);
+
+  int numFailed = session.run();
+  return numFailed;
+}
+
+#else
+
+int main() { return EXIT_SUCCESS; }
+
+#endif
@@ -131,7 +131,7 @@ public:
 
       target.resize(h, w, clearValue);
       for (unsigned int i = top; i < bottom; ++i) {
-        memcpy(target.bitmap + i * w + left, render[i - top], (right - left) * sizeof(T));
+        memcpy(target[i] + left, render[i - top], (right - left) * sizeof(T));
         // for (unsigned int j = left; j < right; ++j) {
         //   target[i][j] = render[i - unsigned(m_bb.getTop())][j - unsigned(m_bb.getLeft())];
         // }
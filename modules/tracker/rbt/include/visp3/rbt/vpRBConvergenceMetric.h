@@ -61,6 +61,10 @@ public:
 
 
   void sampleObject(vpObjectCentricRenderer &renderer);
+  /**
+   * \brief Sample the points used to compute the metric in the 3D bounding box of the object, given in the object frame.
+   */
+  void sampleObject(const vpTranslationVector &minAxes, const vpTranslationVector &maxAxes);
 
   virtual double operator()(const vpCameraParameters &cam, const vpHomogeneousMatrix &cTo1, const vpHomogeneousMatrix &cTo2) = 0;
 
@@ -134,14 +134,24 @@ public:
   /**
    * \brief Extract features from the frame data and the current pose estimate
    *
+   * \param frame : The frame to track, with the renders of the object at a pose close to \p cMo.
+   * \param previousFrame : The frame given to the previous call to vpRBTracker::track(). Its renders may be empty:
+   * when the render is not updated between two frames, the renders are moved to the new frame rather than copied.
+   * Use the renders of \p frame instead.
+   * \param cMo : The current pose estimate.
    */
   virtual void extractFeatures(const vpRBFeatureTrackerInput &frame, const vpRBFeatureTrackerInput &previousFrame, const vpHomogeneousMatrix &cMo) = 0;
 
   /**
    * \brief Track the features
+   *
+   * As in extractFeatures(), the renders of \p previousFrame may be empty.
    */
   virtual void trackFeatures(const vpRBFeatureTrackerInput &frame, const vpRBFeatureTrackerInput &previousFrame, const vpHomogeneousMatrix &cMo) = 0;
 
+  /**
+   * \brief Prepare the optimization. As in extractFeatures(), the renders of \p previousFrame may be empty.
+   */
   virtual void initVVS(const vpRBFeatureTrackerInput &frame, const vpRBFeatureTrackerInput &previousFrame, const vpHomogeneousMatrix &cMo) = 0;
   virtual void computeVVSIter(const vpRBFeatureTrackerInput &frame, const vpHomogeneousMatrix &cMo, unsigned int iteration) = 0;
 
@@ -46,6 +46,7 @@
 #include <visp3/rbt/vpRBTrackingResult.h>
 #include <visp3/rbt/vpRBConvergenceMetric.h>
 #include <visp3/rbt/vpRBInitializationHelper.h>
+#include <visp3/ar/vpSoftwareGeometryRenderer.h>
 #include <visp3/core/vpDisplay.h>
 
 #include <ostream>
@@ -118,6 +119,22 @@ public:
    * \return vpObjectCentricRenderer&
   */
   vpObjectCentricRenderer &getRenderer();
+  /**
+   * \brief Get the CPU renderer, used instead of the Panda3D renderer when software rendering is enabled.
+   *
+   * \return vpSoftwareGeometryRenderer&
+  */
+  vpSoftwareGeometryRenderer &getSoftwareRenderer() { return m_softwareRenderer; }
+  /**
+   * \brief Whether to compute the renders on the CPU with vpSoftwareGeometryRenderer rather than with Panda3D.
+   * Software rendering does not need a GPU nor a display, which allows to track on headless machines.
+   * The 3D model should then be a Wavefront .obj file.
+   * Should be called before startTracking().
+   *
+   * \param enable True to use software rendering.
+  */
+  void setSoftwareRendering(bool enable);
+  bool isSoftwareRenderingEnabled() const { return m_useSoftwareRenderer; }
   /**
    * \brief Retrieve the most recent frame that was used when tracking the object.
    * The renders may not correspond to the latest pose that can be retrieved with getPose
@@ -235,6 +252,24 @@ public:
     m_scaleInvariantOptim = invariant;
   }
 
+  bool getParallelFeatureTracking() const { return m_parallelTrackers; }
+  /**
+   * \brief Whether the feature trackers should be run concurrently.
+   * When enabled and OpenMP is available, the tracking initialization, feature extraction and tracking, VVS
+   * initialization and VVS iterations of the different feature trackers are run in parallel. The contributions of
+   * the trackers to the optimization are still summed in the order in which the trackers were added, so that the
+   * estimated pose does not depend on this setting.
+   * The trackers should not share mutable state.
+   * The OpenMP threads are split between the trackers: the parallel regions of each tracker are run nested, with a
+   * fraction of the threads.
+   *
+   * \param parallel True to run the feature trackers concurrently
+  */
+  inline void setParallelFeatureTracking(bool parallel)
+  {
+    m_parallelTrackers = parallel;
+  }
+
   /**
    * \see setDriftDetector
    *
@@ -455,6 +490,27 @@ protected:
    * \param cMo the pose of the object at which to perform rendering
   */
   void updateRender(vpRBFeatureTrackerInput &frame, const vpHomogeneousMatrix &cMo);
+  /**
+   * \brief Update the frame data with renders computed by the software renderer at a given pose
+   *
+   * \param frame the frame to update
+   * \param cMo the pose of the object at which to perform rendering
+  */
+  void updateSoftwareRender(vpRBFeatureTrackerInput &frame, const vpHomogeneousMatrix &cMo);
+
+  /**
+   * \brief Run a stage of the tracking pipeline on every feature tracker,
+   * concurrently if parallel feature tracking is enabled.
+   *
+   * If trackers raise exceptions, the exception of the first tracker (in insertion order) is rethrown
+   * once all the trackers are done.
+   *
+   * \param stageName name of the stage, used when reporting exceptions
+   * \param elapsed time spent by each tracker in this stage, in ms
+   * \param stage function called on each tracker
+  */
+  template <typename Stage>
+  void runTrackerStage(const char *stageName, std::vector<double> &elapsed, const Stage &stage);
 
   /**
    * \brief Display the object silhouette of the frame in I
@@ -469,7 +525,7 @@ protected:
   {
     if (shouldRenderSilhouette()) {
       const vpImage<unsigned char> &Isilhouette = frame.renders.isSilhouette;
-      const vpRect bb = m_renderer.getBoundingBox();
+      const vpRect bb = frame.renders.boundingBox;
       for (unsigned int r = std::max(bb.getTop(), 0.); (r < bb.getBottom()) &&(r < I.getRows()); ++r) {
         for (unsigned int c = std::max(bb.getLeft(), 0.); (c < bb.getRight()) && (c < I.getCols()); ++c) {
           if (Isilhouette[r][c] != 0) {
@@ -521,6 +577,9 @@ protected:
   */
   bool shouldRenderSilhouette()
   {
+    if (m_useSoftwareRenderer) {
+      return m_softwareRenderer.getSilhouetteExtraction();
+    }
     return m_renderer.getRenderer<vpPanda3DDepthCannyFilter>() != nullptr;
   }
   //! Whether this is the first iteration
@@ -530,6 +589,8 @@ protected:
 
   vpRBFeatureTrackerInput m_currentFrame;
   vpRBFeatureTrackerInput m_previousFrame;
+  //! Render buffers of the last dropped frame, reused for the next render
+  vpRBRenderData m_spareRenders;
 
   //! Location of the 3D model to load
   std::string m_modelPath;
@@ -552,6 +613,8 @@ protected:
   double m_muIterFactor;
   //! Whether to use diagonal scaling in Levenberg-Marquardt regularization
   bool m_scaleInvariantOptim;
+  //! Whether the feature trackers are run concurrently
+  bool m_parallelTrackers;
 
   //! Settings for silhouette extraction
   vpSilhouettePointsExtractionSettings m_depthSilhouetteSettings;
@@ -560,6 +623,10 @@ protected:
   //! 3D renderer
   vpObjectCentricRenderer m_renderer;
   bool m_rendererIsSetup;
+  //! Whether renders are computed on the CPU
+  bool m_useSoftwareRenderer;
+  //! CPU renderer, used instead of m_renderer when m_useSoftwareRenderer is true
+  vpSoftwareGeometryRenderer m_softwareRenderer;
 
   //! Color and render image dimensions
   unsigned m_imageHeight, m_imageWidth;
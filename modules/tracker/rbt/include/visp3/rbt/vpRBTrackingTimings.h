@@ -35,8 +35,10 @@
 #ifndef VP_RB_TRACKING_TIMINGS_H
 #define VP_RB_TRACKING_TIMINGS_H
 
+#include <algorithm>
 #include <iomanip>
 #include <map>
+#include <vector>
 
 #include <visp3/core/vpConfig.h>
 #include <visp3/core/vpMath.h>
@@ -80,6 +82,12 @@ public:
 
     m_trackerFeatureTrackingTime.clear();
     m_trackerVVSIterTimes.clear();
+    m_trackerInitVVSTime.clear();
+
+    m_trackersWallTime = 0.0;
+    m_trackersCriticalPathTime = 0.0;
+    m_trackersBusyTime = 0.0;
+    m_trackerIdleTime.clear();
   }
 
   friend std::ostream &operator<<(std::ostream &, const vpRBTrackingTimings &);
@@ -129,6 +137,43 @@ public:
     m_trackerInitVVSTime[id] = elapsed;
   }
 
+  /**
+   * \brief Record the timings of a stage of the pipeline that is run by all the feature trackers,
+   * such as feature extraction or a VVS iteration.
+   *
+   * \param elapsed Time spent by each tracker in this stage, indexed by tracker id
+   * \param wallTime Time elapsed between the start and end of the stage, for all trackers
+   */
+  inline void addTrackersStageTime(const std::vector<double> &elapsed, double wallTime)
+  {
+    double criticalPath = 0.0;
+    for (double v : elapsed) {
+      criticalPath = std::max(criticalPath, v);
+      m_trackersBusyTime += v;
+    }
+    m_trackersWallTime += wallTime;
+    m_trackersCriticalPathTime += criticalPath;
+    // Time during which a tracker waited for the slowest tracker of the stage
+    for (unsigned int id = 0; id < elapsed.size(); ++id) {
+      m_trackerIdleTime[static_cast<int>(id)] += criticalPath - elapsed[id];
+    }
+  }
+
+  /**
+   * \brief Sum, over all the tracker stages, of the time taken by the slowest tracker.
+   * This is the time that would be spent in the trackers with perfect overlap between them.
+   */
+  inline double getTrackersCriticalPathTime() const { return m_trackersCriticalPathTime; }
+  /**
+   * \brief Time actually spent in the tracker stages.
+   */
+  inline double getTrackersWallTime() const { return m_trackersWallTime; }
+  /**
+   * \brief Sum, over all the tracker stages, of the time spent by each tracker.
+   * This is the time that would be spent in the trackers if they were run sequentially.
+   */
+  inline double getTrackersBusyTime() const { return m_trackersBusyTime; }
+
   inline void setDriftDetectionTime(double elapsed)
   {
     m_driftTime = elapsed;
@@ -160,6 +205,10 @@ private:
   std::map<int, double> m_trackerFeatureTrackingTime;
   std::map<int, double> m_trackerInitVVSTime;
 
+  double m_trackersWallTime; //! Time spent in the tracker stages
+  double m_trackersCriticalPathTime; //! Sum over the stages of the time of the slowest tracker
+  double m_trackersBusyTime; //! Sum over the stages and the trackers of the time spent by each tracker
+  std::map<int, double> m_trackerIdleTime; //! Per tracker, time spent waiting for the slowest tracker of each stage
 };
 
 inline std::ostream &operator<<(std::ostream &out, const vpRBTrackingTimings &timer)
@@ -174,7 +223,8 @@ inline std::ostream &operator<<(std::ostream &out, const vpRBTrackingTimings &ti
   out << "Odometry: " << timer.m_odometryTime << "ms" << std::endl;
   out << "Silhouette extraction: " << timer.m_silhouetteExtractionTime << "ms" << std::endl;
 
-  out << "Trackers: " << std::endl;
+  out << "Trackers: " << timer.m_trackersWallTime << "ms (critical path: " << timer.m_trackersCriticalPathTime << "ms, "
+    << "sum over trackers: " << timer.m_trackersBusyTime << "ms)" << std::endl;
   for (const std::pair<const int, std::vector<double>> &vvsIterData : timer.m_trackerVVSIterTimes) {
     double trackingStartTime = timer.m_trackerIterStartTime.find(vvsIterData.first)->second;
     double featTrackTime = timer.m_trackerFeatureTrackingTime.find(vvsIterData.first)->second;
@@ -192,6 +242,9 @@ inline std::ostream &operator<<(std::ostream &out, const vpRBTrackingTimings &ti
     out << "\t" << "\t" << "VVS init: " << initVVSTime << "ms" << std::endl;
     out << "\t" << "\t" << "VVS:      " << ttVVSIter << "ms (" << vpMath::getMean(vvsIterData.second) << "ms"
       << "+-" << vpMath::getStdev(vvsIterData.second) << "ms)" << std::endl;
+    if (timer.m_trackerIdleTime.count(vvsIterData.first)) {
+      out << "\t" << "\t" << "Idle:     " << timer.m_trackerIdleTime.find(vvsIterData.first)->second << "ms" << std::endl;
+    }
   }
   out << "====================================================" << std::endl;
   out.flags(flags);
@@ -214,6 +267,10 @@ inline void from_json(const nlohmann::json &j, vpRBTrackingTimings &result)
   result.m_trackerFeatureExtractionTime = jf.at("extraction");
   result.m_trackerFeatureTrackingTime = jf.at("tracking");
   result.m_trackerInitVVSTime = jf.at("vvsInit");
+  result.m_trackerIdleTime = jf.value("idle", std::map<int, double>());
+  result.m_trackersWallTime = jf.value("wall", 0.0);
+  result.m_trackersCriticalPathTime = jf.value("criticalPath", 0.0);
+  result.m_trackersBusyTime = jf.value("busy", 0.0);
 }
 inline void to_json(nlohmann::json &j, const vpRBTrackingTimings &result)
 {
@@ -228,6 +285,10 @@ inline void to_json(nlohmann::json &j, const vpRBTrackingTimings &result)
   jf["extraction"] = result.m_trackerFeatureExtractionTime;
   jf["tracking"] = result.m_trackerFeatureTrackingTime;
   jf["vvsInit"] = result.m_trackerInitVVSTime;
+  jf["idle"] = result.m_trackerIdleTime;
+  jf["wall"] = result.m_trackersWallTime;
+  jf["criticalPath"] = result.m_trackersCriticalPathTime;
+  jf["busy"] = result.m_trackersBusyTime;
   j["features"] = jf;
 }
 #endif
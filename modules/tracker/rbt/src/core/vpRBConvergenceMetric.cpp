@@ -69,10 +69,14 @@ vpRBConvergenceMetric::vpRBConvergenceMetric(double renderThreshold, double conv
 
 void vpRBConvergenceMetric::sampleObject(vpObjectCentricRenderer &renderer)
 {
-  m_random.setSeed(m_seed, 0x123465789ULL);
   vpTranslationVector minAxes, maxAxes;
   renderer.get3DExtents(minAxes, maxAxes);
+  sampleObject(minAxes, maxAxes);
+}
 
+void vpRBConvergenceMetric::sampleObject(const vpTranslationVector &minAxes, const vpTranslationVector &maxAxes)
+{
+  m_random.setSeed(m_seed, 0x123465789ULL);
   vpMatrix oX(m_map.getNumMaxPoints(), 3);
   for (unsigned int i = 0; i < oX.getRows(); ++i) {
     for (unsigned int j = 0; j < 3; ++j) {
@@ -34,8 +34,15 @@
 #include VISP_NLOHMANN_JSON(json.hpp)
 #endif
 
+#include <exception>
+
+#if defined(VISP_HAVE_OPENMP)
+#include <omp.h>
+#endif
+
 #include <visp3/core/vpExponentialMap.h>
 #include <visp3/core/vpIoTools.h>
+#include <visp3/core/vpTime.h>
 
 #include <visp3/ar/vpPanda3DRendererSet.h>
 #include <visp3/ar/vpPanda3DGeometryRenderer.h>
@@ -52,11 +59,13 @@ BEGIN_VISP_NAMESPACE
 
 vpRBTracker::vpRBTracker() :
   m_firstIteration(true), m_trackers(0), m_modelChanged(true), m_lambda(1.0), m_vvsIterations(10), m_muInit(0.0),
-  m_muIterFactor(0.5), m_scaleInvariantOptim(false), m_renderer(m_rendererSettings), m_rendererIsSetup(false),
+  m_muIterFactor(0.5), m_scaleInvariantOptim(false), m_parallelTrackers(false), m_renderer(m_rendererSettings), m_rendererIsSetup(false),
+  m_useSoftwareRenderer(false), m_softwareRenderer(vpSoftwareGeometryRenderer::OBJECT_NORMALS),
   m_imageHeight(480), m_imageWidth(640), m_convergenceMetric(nullptr), m_displaySilhouette(false)
 {
   m_rendererSettings.setClippingDistance(0.01, 1.0);
   m_renderer.setRenderParameters(m_rendererSettings);
+  m_softwareRenderer.setCameraParameters(m_cam, m_imageHeight, m_imageWidth);
 
   m_driftDetector = nullptr;
   m_mask = nullptr;
@@ -118,6 +127,7 @@ void vpRBTracker::setCameraParameters(const vpCameraParameters &cam, unsigned h,
   m_rendererSettings.setCameraIntrinsics(m_cam);
   m_rendererSettings.setImageResolution(m_imageHeight, m_imageWidth);
   m_renderer.setRenderParameters(m_rendererSettings);
+  m_softwareRenderer.setCameraParameters(m_cam, m_imageHeight, m_imageWidth);
 }
 
 void vpRBTracker::setSilhouetteExtractionParameters(const vpSilhouettePointsExtractionSettings &settings)
@@ -129,6 +139,7 @@ void vpRBTracker::reset()
 {
   m_previousFrame = vpRBFeatureTrackerInput();
   m_currentFrame = vpRBFeatureTrackerInput();
+  m_spareRenders = vpRBRenderData();
   m_firstIteration = true;
   m_cMoPrev = m_cMo;
   for (std::shared_ptr<vpRBFeatureTracker> &tracker: m_trackers) {
@@ -151,19 +162,20 @@ void vpRBTracker::setModelPath(const std::string &path)
   m_modelChanged = true;
 }
 
-void vpRBTracker::setupRenderer(const std::string &file)
+void vpRBTracker::setSoftwareRendering(bool enable)
 {
-  if (!m_rendererIsSetup) {
-    m_renderer.setRenderParameters(m_rendererSettings);
-    const std::shared_ptr<vpPanda3DGeometryRenderer> geometryRenderer = std::make_shared<vpPanda3DGeometryRenderer>(
-      vpPanda3DGeometryRenderer::vpRenderType::OBJECT_NORMALS, true);
-    m_renderer.addSubRenderer(geometryRenderer);
+  if (enable != m_useSoftwareRenderer) {
+    m_useSoftwareRenderer = enable;
+    m_modelChanged = true;
   }
+}
+
+void vpRBTracker::setupRenderer(const std::string &file)
+{
   if (!vpIoTools::checkFilename(file)) {
     throw vpException(vpException::badValue, "3D model file %s could not be found", file.c_str());
   }
 
-
   // Add silhouette extractor if required
   bool requiresSilhouetteShader = false;
   for (std::shared_ptr<vpRBFeatureTracker> &tracker: m_trackers) {
@@ -172,6 +184,23 @@ void vpRBTracker::setupRenderer(const std::string &file)
       break;
     }
   }
+
+  if (m_useSoftwareRenderer) {
+    m_softwareRenderer.setSilhouetteExtraction(requiresSilhouetteShader);
+    if (m_modelChanged) {
+      // Use the same object frame as for the models loaded by Panda3D
+      m_softwareRenderer.loadObj(file, vpPanda3DBaseRenderer::pandaToVisp());
+      m_modelChanged = false;
+    }
+    return;
+  }
+
+  if (!m_rendererIsSetup) {
+    m_renderer.setRenderParameters(m_rendererSettings);
+    const std::shared_ptr<vpPanda3DGeometryRenderer> geometryRenderer = std::make_shared<vpPanda3DGeometryRenderer>(
+      vpPanda3DGeometryRenderer::vpRenderType::OBJECT_NORMALS, true);
+    m_renderer.addSubRenderer(geometryRenderer);
+  }
   if (requiresSilhouetteShader && m_renderer.getRenderer<vpPanda3DDepthCannyFilter>() == nullptr) {
     static int cannyId = 0;
 
@@ -229,7 +258,14 @@ void vpRBTracker::startTracking()
 {
   setupRenderer(m_modelPath);
   if (m_convergenceMetric) {
-    m_convergenceMetric->sampleObject(m_renderer);
+    if (m_useSoftwareRenderer) {
+      vpTranslationVector minAxes, maxAxes;
+      m_softwareRenderer.get3DExtents(minAxes, maxAxes);
+      m_convergenceMetric->sampleObject(minAxes, maxAxes);
+    }
+    else {
+      m_convergenceMetric->sampleObject(m_renderer);
+    }
   }
   vpRBFeatureTrackerInput f;
   vpHomogeneousMatrix c(0, 0, 0.5, 0, 0, 0);
@@ -249,6 +285,57 @@ vpRBTrackingResult vpRBTracker::track(const vpImage<unsigned char> &I, const vpI
   return track(frameInput);
 }
 
+template <typename Stage>
+void vpRBTracker::runTrackerStage(const char *stageName, std::vector<double> &elapsed, const Stage &stage)
+{
+  const int nbTrackers = static_cast<int>(m_trackers.size());
+  elapsed.assign(m_trackers.size(), 0.0);
+  std::vector<std::exception_ptr> errors(m_trackers.size());
+#if defined(VISP_HAVE_OPENMP)
+  const bool parallel = m_parallelTrackers && nbTrackers > 1;
+  // Most trackers open their own parallel regions. The available threads are split between the trackers:
+  // without nesting, these inner regions would run on a single thread, and with default team sizes, they would
+  // oversubscribe the cores.
+  const int maxThreads = omp_get_max_threads();
+  const int nbOuterThreads = std::max(1, std::min(nbTrackers, maxThreads));
+  const int nbInnerThreads = std::max(1, maxThreads / nbOuterThreads);
+  const int maxActiveLevels = omp_get_max_active_levels();
+  const bool nested = parallel && (nbInnerThreads > 1) && (maxActiveLevels < (omp_get_active_level() + 2));
+  if (nested) {
+    omp_set_max_active_levels(omp_get_active_level() + 2);
+  }
+#pragma omp parallel for schedule(dynamic, 1) num_threads(nbOuterThreads) if (parallel)
+#endif
+  for (int i = 0; i < nbTrackers; ++i) {
+#if defined(VISP_HAVE_OPENMP)
+    if (parallel) {
+      // Only affects the regions opened by this thread in the current iteration
+      omp_set_num_threads(nbInnerThreads);
+    }
+#endif
+    const double start = vpTime::measureTimeMs();
+    // Exceptions cannot leave an OpenMP region: they are rethrown once all the trackers are done
+    try {
+      stage(*m_trackers[i]);
+    }
+    catch (...) {
+      errors[i] = std::current_exception();
+    }
+    elapsed[i] = vpTime::measureTimeMs() - start;
+  }
+#if defined(VISP_HAVE_OPENMP)
+  if (nested) {
+    omp_set_max_active_levels(maxActiveLevels);
+  }
+#endif
+  for (unsigned int i = 0; i < errors.size(); ++i) {
+    if (errors[i]) {
+      std::cerr << "Tracker " << i << " raised an exception in " << stageName << std::endl;
+      std::rethrow_exception(errors[i]);
+    }
+  }
+}
+
 vpRBTrackingResult vpRBTracker::track(vpRBFeatureTrackerInput &input)
 {
   vpRBTrackingResult result;
@@ -258,10 +345,17 @@ vpRBTrackingResult vpRBTracker::track(vpRBFeatureTrackerInput &input)
   // Render the object at the current pose
   timer.startTimer();
   if (m_firstIteration || !m_convergenceMetric || m_convergenceMetric->shouldUpdateRender(m_cam, m_cMo, m_currentFrame.renders.cMo)) {
+    if (input.renders.depth.getSize() == 0) {
+      // Render into the buffers of the frame that was dropped at the end of the last call, avoiding allocations
+      input.renders = std::move(m_spareRenders);
+    }
     updateRender(input);
   }
   else {
-    input.renders = m_currentFrame.renders;
+    // The renders of the last frame are still valid: transfer them rather than copying them.
+    // The last frame becomes the previous frame at the end of this call, with empty renders (see
+    // vpRBFeatureTracker::extractFeatures())
+    input.renders = std::move(m_currentFrame.renders);
   }
   timer.setRenderTime(timer.endTimer());
 
@@ -300,12 +394,14 @@ vpRBTrackingResult vpRBTracker::track(vpRBFeatureTrackerInput &input)
   }
   timer.setSilhouetteTime(timer.endTimer());
 
-  int id = 0;
-  for (std::shared_ptr<vpRBFeatureTracker> &tracker : m_trackers) {
-    timer.startTimer();
-    tracker->onTrackingIterStart(input, m_cMo);
-    timer.setTrackerIterStartTime(id, timer.endTimer());
-    id += 1;
+  std::vector<double> trackerTimes;
+  timer.startTimer();
+  runTrackerStage("onTrackingIterStart", trackerTimes, [&](vpRBFeatureTracker &tracker) {
+    tracker.onTrackingIterStart(input, m_cMo);
+  });
+  timer.addTrackersStageTime(trackerTimes, timer.endTimer());
+  for (unsigned int id = 0; id < trackerTimes.size(); ++id) {
+    timer.setTrackerIterStartTime(static_cast<int>(id), trackerTimes[id]);
   }
 
 
@@ -341,40 +437,31 @@ vpRBTrackingResult vpRBTracker::track(vpRBFeatureTrackerInput &input)
   }
 
 
-  id = 0;
-  for (std::shared_ptr<vpRBFeatureTracker> &tracker : m_trackers) {
-
-    timer.startTimer();
-    try {
-      tracker->extractFeatures(input, m_previousFrame, m_cMo);
-    }
-    catch (vpException &e) {
-      std::cerr << "Tracker " << id << " raised an exception in extractFeatures" << std::endl;
-      throw e;
-    }
-    timer.setTrackerFeatureExtractionTime(id, timer.endTimer());
-    id += 1;
+  timer.startTimer();
+  runTrackerStage("extractFeatures", trackerTimes, [&](vpRBFeatureTracker &tracker) {
+    tracker.extractFeatures(input, m_previousFrame, m_cMo);
+  });
+  timer.addTrackersStageTime(trackerTimes, timer.endTimer());
+  for (unsigned int id = 0; id < trackerTimes.size(); ++id) {
+    timer.setTrackerFeatureExtractionTime(static_cast<int>(id), trackerTimes[id]);
   }
-  id = 0;
-  for (std::shared_ptr<vpRBFeatureTracker> &tracker : m_trackers) {
-    timer.startTimer();
-    try {
-      tracker->trackFeatures(input, m_previousFrame, m_cMo);
-    }
-    catch (vpException &e) {
-      std::cerr << "Tracker " << id << " raised an exception in trackFeatures" << std::endl;
-      throw e;
-    }
-    timer.setTrackerFeatureTrackingTime(id, timer.endTimer());
-    id += 1;
+
+  timer.startTimer();
+  runTrackerStage("trackFeatures", trackerTimes, [&](vpRBFeatureTracker &tracker) {
+    tracker.trackFeatures(input, m_previousFrame, m_cMo);
+  });
+  timer.addTrackersStageTime(trackerTimes, timer.endTimer());
+  for (unsigned int id = 0; id < trackerTimes.size(); ++id) {
+    timer.setTrackerFeatureTrackingTime(static_cast<int>(id), trackerTimes[id]);
   }
 
-  id = 0;
-  for (std::shared_ptr<vpRBFeatureTracker> &tracker : m_trackers) {
-    timer.startTimer();
-    tracker->initVVS(input, m_previousFrame, m_cMo);
-    timer.setInitVVSTime(id, timer.endTimer());
-    id += 1;
+  timer.startTimer();
+  runTrackerStage("initVVS", trackerTimes, [&](vpRBFeatureTracker &tracker) {
+    tracker.initVVS(input, m_previousFrame, m_cMo);
+  });
+  timer.addTrackersStageTime(trackerTimes, timer.endTimer());
+  for (unsigned int id = 0; id < trackerTimes.size(); ++id) {
+    timer.setInitVVSTime(static_cast<int>(id), trackerTimes[id]);
   }
 
 
@@ -385,18 +472,13 @@ vpRBTrackingResult vpRBTracker::track(vpRBFeatureTrackerInput &input)
   unsigned int iter = 0;
   result.beforeIter(m_cMo);
   for (iter = 0; iter < m_vvsIterations; ++iter) {
-    id = 0;
-    for (std::shared_ptr<vpRBFeatureTracker> &tracker : m_trackers) {
-      timer.startTimer();
-      try {
-        tracker->computeVVSIter(input, m_cMo, iter);
-      }
-      catch (vpException &e) {
-        std::cerr << "Tracker " << id << " raised an exception in computeVVSIter" << std::endl;
-        throw e;
-      }
-      timer.addTrackerVVSTime(id, timer.endTimer());
-      id += 1;
+    timer.startTimer();
+    runTrackerStage("computeVVSIter", trackerTimes, [&](vpRBFeatureTracker &tracker) {
+      tracker.computeVVSIter(input, m_cMo, iter);
+    });
+    timer.addTrackersStageTime(trackerTimes, timer.endTimer());
+    for (unsigned int id = 0; id < trackerTimes.size(); ++id) {
+      timer.addTrackerVVSTime(static_cast<int>(id), trackerTimes[id]);
     }
 
     vpMatrix LTL(6, 6, 0.0);
@@ -415,7 +497,8 @@ vpRBTrackingResult vpRBTracker::track(vpRBFeatureTrackerInput &input)
     for (std::shared_ptr<vpRBFeatureTracker> &tracker : m_trackers) {
       tracker->setComputeJacobianObjectSpace(shouldComputeVelocityInObjectFrame);
     }
-    id = 0;
+    // Sum the contributions in a fixed order, so that the result does not depend on the execution of the trackers
+    int id = 0;
     for (std::shared_ptr<vpRBFeatureTracker> &tracker : m_trackers) {
       if (tracker->getNumFeatures() > 0) {
         numFeatures += tracker->getNumFeatures();
@@ -509,10 +592,12 @@ vpRBTrackingResult vpRBTracker::track(vpRBFeatureTrackerInput &input)
   }
   //m_cMo = m_kalman.filter(m_cMo, 1.0 / 20.0);
   if (m_currentFrame.I.getSize() == 0) {
-    m_currentFrame = input;
     m_previousFrame = input;
+    m_currentFrame = std::move(input);
   }
   else {
+    // Rotate the frame slots without copying images. The renders of the dropped frame are kept for the next render
+    m_spareRenders = std::move(m_previousFrame.renders);
     m_previousFrame = std::move(m_currentFrame);
     m_currentFrame = std::move(input);
   }
@@ -550,6 +635,10 @@ void vpRBTracker::updateRender(vpRBFeatureTrackerInput &frame)
 
 void vpRBTracker::updateRender(vpRBFeatureTrackerInput &frame, const vpHomogeneousMatrix &cMo)
 {
+  if (m_useSoftwareRenderer) {
+    updateSoftwareRender(frame, cMo);
+    return;
+  }
   m_renderer.setCameraPose(cMo.inverse());
 
 
@@ -631,6 +720,49 @@ void vpRBTracker::updateRender(vpRBFeatureTrackerInput &frame, const vpHomogeneo
   }
 }
 
+void vpRBTracker::updateSoftwareRender(vpRBFeatureTrackerInput &frame, const vpHomogeneousMatrix &cMo)
+{
+  frame.renders.cMo = cMo;
+
+  float clipNear, clipFar;
+  m_softwareRenderer.computeClipping(cMo, clipNear, clipFar);
+  frame.renders.zNear = std::max(0.001f, clipNear);
+  frame.renders.zFar = clipFar;
+
+  {
+    vpTranslationVector tMin, tMax;
+    m_softwareRenderer.get3DExtents(tMin, tMax);
+    double diameter = (tMax - tMin).frobeniusNorm();
+    frame.renders.objectDiameter = diameter;
+
+    vpTranslationVector center((tMax - tMin) / 2.0);
+    frame.renders.objectCenter = center;
+  }
+  // The object may be completely behind the camera, in which case nothing is rendered
+  m_softwareRenderer.setClippingDistance(frame.renders.zNear, std::max(frame.renders.zFar, 2.f * frame.renders.zNear));
+
+  const bool renderSilhouette = shouldRenderSilhouette();
+  if (renderSilhouette) {
+    // Depth is rendered in meters, the threshold does not need to be rescaled
+    double thresholdValue = m_depthSilhouetteSettings.getThreshold();
+    if (m_depthSilhouetteSettings.thresholdIsRelative()) {
+      thresholdValue *= (frame.renders.zFar - frame.renders.zNear);
+    }
+    m_softwareRenderer.setEdgeThreshold(static_cast<float>(thresholdValue));
+  }
+
+  m_softwareRenderer.render(cMo);
+  frame.renders.boundingBox = m_softwareRenderer.getBoundingBox();
+  m_softwareRenderer.getRender(frame.renders.normals, frame.renders.depth);
+  if (renderSilhouette) {
+    m_softwareRenderer.getSilhouetteRender(frame.renders.silhouetteCanny, frame.renders.isSilhouette);
+  }
+  else {
+    frame.renders.silhouetteCanny.resize(m_imageHeight, m_imageWidth);
+    frame.renders.isSilhouette.resize(m_imageHeight, m_imageWidth);
+  }
+}
+
 std::vector<vpRBSilhouettePoint>
 vpRBTracker::extractSilhouettePoints(const vpImage<vpRGBf> &Inorm, const vpImage<float> &Idepth,
                                      const vpImage<float> &silhouetteCanny, const vpImage<unsigned char> &Ivalid,
@@ -739,6 +871,7 @@ void vpRBTracker::loadConfiguration(const nlohmann::json &j)
   m_mask = nullptr;
 
   m_displaySilhouette = j.value("displaySilhouette", m_displaySilhouette);
+  setSoftwareRendering(j.value("softwareRendering", m_useSoftwareRenderer));
 
   if (j.contains("metric")) {
     m_convergenceMetric = vpRBConvergenceMetric::loadFromJSON(j.at("metric"));
@@ -762,6 +895,7 @@ void vpRBTracker::loadConfiguration(const nlohmann::json &j)
   setOptimizationInitialMu(vvsSettings.value("mu", m_muInit));
   setOptimizationMuIterFactor(vvsSettings.value("muIterFactor", m_muIterFactor));
   setScaleInvariantRegularization(vvsSettings.value("scaleInvariant", m_scaleInvariantOptim));
+  setParallelFeatureTracking(vvsSettings.value("parallelTrackers", m_parallelTrackers));
 
   m_depthSilhouetteSettings = j.at("silhouetteExtractionSettings");
 
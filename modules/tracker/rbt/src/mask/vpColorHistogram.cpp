@@ -75,11 +75,13 @@ void vpColorHistogram::build(const vpImage<vpRGBa> &image, const vpImage<bool> &
   std::vector<unsigned int> histo(m_N * m_N * m_N, 0);
   m_probas.resize(m_N * m_N * m_N);
   unsigned int pixels = 0;
-  for (unsigned int i = 0; i < image.getSize(); ++i) {
-    if (mask.bitmap[i]) {
-      unsigned int index = colorToIndex(image.bitmap[i]);
-      ++histo[index];
-      ++pixels;
+  for (unsigned int i = 0; i < image.getHeight(); ++i) {
+    for (unsigned int j = 0; j < image.getWidth(); ++j) {
+      if (mask[i][j]) {
+        unsigned int index = colorToIndex(image[i][j]);
+        ++histo[index];
+        ++pixels;
+      }
     }
   }
   m_numPixels = pixels;
@@ -127,8 +129,10 @@ void vpColorHistogram::computeProbas(const vpImage<vpRGBa> &image, vpImage<float
 #ifdef VISP_HAVE_OPENMP
 #pragma omp parallel for
 #endif
-  for (int i = 0; i < static_cast<int>(image.getSize()); ++i) {
-    proba.bitmap[i] = m_probas[colorToIndex(image.bitmap[i])];
+  for (int i = 0; i < static_cast<int>(image.getHeight()); ++i) {
+    for (unsigned int j = 0; j < image.getWidth(); ++j) {
+      proba[i][j] = m_probas[colorToIndex(image[i][j])];
+    }
   }
 }
 
@@ -205,10 +209,12 @@ void vpColorHistogram::computeSplitHistograms(const vpImage<vpRGBa> &image, cons
   {
     std::vector<unsigned int>localCountsIn(bins, 0), localCountsOut(bins, 0);
 //#pragma omp for schedule(static, 1024)
-    for (unsigned int i = 0; i < image.getSize(); ++i) {
-      unsigned int index = insideMask.colorToIndex(image.bitmap[i]);
-      localCountsIn[index] += (mask.bitmap[i] > 0);
-      localCountsOut[index] += (mask.bitmap[i] == 0);
+    for (unsigned int i = 0; i < image.getHeight(); ++i) {
+      for (unsigned int j = 0; j < image.getWidth(); ++j) {
+        unsigned int index = insideMask.colorToIndex(image[i][j]);
+        localCountsIn[index] += (mask[i][j] > 0);
+        localCountsOut[index] += (mask[i][j] == 0);
+      }
     }
 //#pragma omp critical
     {
@@ -228,6 +234,14 @@ void vpColorHistogram::computeSplitHistograms(const vpImage<vpRGBa> &image, cons
     throw vpException(vpException::badValue, "Histograms should have same number of bins");
   }
 
+  if (!image.isContiguous() || !mask.isContiguous()) {
+    // The regions around the bounding box are walked linearly: process views and padded images in contiguous copies
+    const vpImage<vpRGBa> image_contiguous = image;
+    const vpImage<bool> mask_contiguous = mask;
+    computeSplitHistograms(image_contiguous, mask_contiguous, bbInside, insideMask, outsideMask);
+    return;
+  }
+
   const unsigned int bins = static_cast<unsigned int>(insideMask.m_probas.size());
 
   std::vector<unsigned int> countsIn(bins, 0), countsOut(bins, 0);
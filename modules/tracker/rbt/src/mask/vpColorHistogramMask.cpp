@@ -167,9 +167,11 @@ void vpColorHistogramMask::updateMask(const vpRBFeatureTrackerInput &frame,
 #ifdef VISP_HAVE_OPENMP
 #pragma omp parallel for
 #endif
-    for (int i = 0; i < static_cast<int>(mask.getSize()); ++i) {
-      unsigned int index = m_histObject.colorToIndex(frame.IRGB.bitmap[i]);
-      mask.bitmap[i] = probas(index);
+    for (int i = 0; i < height; ++i) {
+      for (int j = 0; j < width; ++j) {
+        unsigned int index = m_histObject.colorToIndex(frame.IRGB[i][j]);
+        mask[i][j] = probas(index);
+      }
     }
     // if (maxValue > 0.0) {
     //   for (unsigned int i = 0; i < mask.getSize(); ++i) {
@@ -52,8 +52,10 @@ void vpCombinedDepthAndColorMask::updateMask(const vpRBFeatureTrackerInput &fram
 #ifdef VISP_HAVE_OPENMP
 #pragma omp parallel for
 #endif
-    for (int i = 0; i < static_cast<int>(m_color.getSize()); ++i) {
-      mask.bitmap[i] = std::min(m_color.bitmap[i], m_depth.bitmap[i]);
+    for (int i = 0; i < static_cast<int>(m_color.getHeight()); ++i) {
+      for (unsigned int j = 0; j < m_color.getWidth(); ++j) {
+        mask[i][j] = std::min(m_color[i][j], m_depth[i][j]);
+      }
     }
   }
   else {
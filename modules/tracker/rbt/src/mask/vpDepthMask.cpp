@@ -84,9 +84,11 @@ void vpDepthMask::updateMask(const vpRBFeatureTrackerInput &frame,
 #if defined(VISP_HAVE_OPENMP)
 #pragma omp parallel for
 #endif
-    for (int i = 0; i < static_cast<int>(frame.depth.getSize()); ++i) {
-      const float Z = frame.depth.bitmap[i];
-      mask.bitmap[i] = getProba(Z);
+    for (int i = 0; i < static_cast<int>(frame.depth.getHeight()); ++i) {
+      for (unsigned int j = 0; j < frame.depth.getWidth(); ++j) {
+        const float Z = frame.depth[i][j];
+        mask[i][j] = getProba(Z);
+      }
     }
   }
   else {
@@ -43,8 +43,10 @@ void vpObjectMask::display(const vpImage<float> &mask, vpImage<unsigned char> &I
 #ifdef VISP_HAVE_OPENMP
 #pragma omp parallel for
 #endif
-  for (int i = 0; i < static_cast<int>(mask.getSize()); ++i) {
-    Imask.bitmap[i] = static_cast<unsigned char>(mask.bitmap[i] * 255.f);
+  for (int i = 0; i < static_cast<int>(mask.getHeight()); ++i) {
+    for (unsigned int j = 0; j < mask.getWidth(); ++j) {
+      Imask[i][j] = static_cast<unsigned char>(mask[i][j] * 255.f);
+    }
   }
 
   vpDisplay::display(Imask);
@@ -43,6 +43,8 @@
 
 #include <visp3/core/vpIoTools.h>
 #include <visp3/core/vpImageConvert.h>
+#include <visp3/core/vpPoint.h>
+#include <visp3/core/vpUniRand.h>
 #include <visp3/rbt/vpRBTracker.h>
 
 #include <visp3/rbt/vpRBSilhouetteMeTracker.h>
@@ -53,6 +55,10 @@
 
 #include "test_utils.h"
 
+#if defined(VISP_HAVE_OPENMP)
+#include <omp.h>
+#endif
+
 #if defined(VISP_HAVE_NLOHMANN_JSON)
 #include VISP_NLOHMANN_JSON(json.hpp)
 #endif
@@ -125,6 +131,135 @@ std::string createObjFile()
   return objFile;
 }
 
+/*!
+ * Tracker of synthetic point features, whose observations are the projections of random object points at a
+ * reference pose. It can raise an exception when extracting features to test error forwarding, and records the
+ * renders it is given. It can also request the silhouette render.
+ */
+class vpRBStubPointTracker : public vpRBFeatureTracker
+{
+public:
+  vpRBStubPointTracker(const vpHomogeneousMatrix &cMo_ref, unsigned int seed, bool throwing, bool silhouette = false)
+    : m_points(), m_observations(), m_throwing(throwing), m_silhouette(silhouette)
+  {
+    vpUniRand rand(seed);
+    for (unsigned int i = 0; i < 10; ++i) {
+      vpPoint p(rand.uniform(-0.05, 0.05), rand.uniform(-0.05, 0.05), rand.uniform(-0.05, 0.05));
+      p.project(cMo_ref);
+      m_points.push_back(p);
+      m_observations.push_back(p.get_x());
+      m_observations.push_back(p.get_y());
+    }
+  }
+
+  bool requiresRGB() const VP_OVERRIDE { return false; }
+  bool requiresDepth() const VP_OVERRIDE { return false; }
+  bool requiresSilhouetteCandidates() const VP_OVERRIDE { return m_silhouette; }
+
+  void onTrackingIterStart(const vpRBFeatureTrackerInput & /*frame*/, const vpHomogeneousMatrix & /*cMo*/) VP_OVERRIDE { }
+  void onTrackingIterEnd(const vpHomogeneousMatrix & /*cMo*/) VP_OVERRIDE { }
+
+  void extractFeatures(const vpRBFeatureTrackerInput &frame, const vpRBFeatureTrackerInput &previousFrame,
+                       const vpHomogeneousMatrix & /*cMo*/) VP_OVERRIDE
+  {
+    if (m_throwing) {
+      throw vpException(vpException::fatalError, "Stub tracker failure");
+    }
+    m_numFeatures = static_cast<unsigned int>(m_observations.size());
+    renderSizes.push_back(frame.renders.depth.getSize());
+    previousRenderSizes.push_back(previousFrame.renders.depth.getSize());
+  }
+
+  void trackFeatures(const vpRBFeatureTrackerInput & /*frame*/, const vpRBFeatureTrackerInput & /*previousFrame*/,
+                     const vpHomogeneousMatrix & /*cMo*/) VP_OVERRIDE
+  { }
+
+  void initVVS(const vpRBFeatureTrackerInput & /*frame*/, const vpRBFeatureTrackerInput & /*previousFrame*/,
+               const vpHomogeneousMatrix & /*cMo*/) VP_OVERRIDE
+  {
+    m_L.resize(m_numFeatures, 6, false, false);
+    m_error.resize(m_numFeatures, false);
+    m_weighted_error.resize(m_numFeatures, false);
+    m_weights.resize(m_numFeatures, false);
+    m_weights = 1.0;
+    m_LTL.resize(6, 6, false, false);
+    m_LTR.resize(6, false);
+    m_cov.resize(6, 6, false, false);
+    m_covWeightDiag.resize(m_numFeatures, false);
+  }
+
+  void computeVVSIter(const vpRBFeatureTrackerInput & /*frame*/, const vpHomogeneousMatrix &cMo,
+                      unsigned int /*iteration*/) VP_OVERRIDE
+  {
+    for (unsigned int i = 0; i < m_points.size(); ++i) {
+      vpPoint &p = m_points[i];
+      p.changeFrame(cMo);
+      p.projection();
+      const double x = p.get_x(), y = p.get_y(), Zinv = 1.0 / p.get_Z();
+      const double L_x[6] = { -Zinv, 0.0, x * Zinv, x * y, -(1.0 + (x * x)), y };
+      const double L_y[6] = { 0.0, -Zinv, y * Zinv, 1.0 + (y * y), -(x * y), -x };
+      for (unsigned int dof = 0; dof < 6; ++dof) {
+        m_L[2 * i][dof] = L_x[dof];
+        m_L[(2 * i) + 1][dof] = L_y[dof];
+      }
+      m_error[2 * i] = x - m_observations[2 * i];
+      m_error[(2 * i) + 1] = y - m_observations[(2 * i) + 1];
+    }
+    updateOptimizerTerms(cMo);
+  }
+
+  void display(const vpCameraParameters & /*cam*/, const vpImage<unsigned char> & /*I*/,
+               const vpImage<vpRGBa> & /*IRGB*/, const vpImage<unsigned char> & /*depth*/) const VP_OVERRIDE
+  { }
+
+  std::vector<unsigned int> renderSizes; //!< Size of the renders of the frame given to each extractFeatures() call
+  std::vector<unsigned int> previousRenderSizes; //!< Same for the previous frame
+
+private:
+  std::vector<vpPoint> m_points;
+  std::vector<double> m_observations;
+  bool m_throwing;
+  bool m_silhouette;
+};
+
+/*!
+ * Stub point tracker that, like most feature trackers, runs its VVS iterations in its own parallel region.
+ * It records the size of the thread teams of this region.
+ */
+class vpRBStubParallelPointTracker : public vpRBStubPointTracker
+{
+public:
+  vpRBStubParallelPointTracker(const vpHomogeneousMatrix &cMo_ref, unsigned int seed)
+    : vpRBStubPointTracker(cMo_ref, seed, false), maxInnerThreads(0), m_sum(0.0)
+  { }
+
+  void computeVVSIter(const vpRBFeatureTrackerInput &frame, const vpHomogeneousMatrix &cMo,
+                      unsigned int iteration) VP_OVERRIDE
+  {
+    vpRBStubPointTracker::computeVVSIter(frame, cMo, iteration);
+    double sum = 0.0;
+#if defined(VISP_HAVE_OPENMP)
+#pragma omp parallel
+#endif
+    {
+#if defined(VISP_HAVE_OPENMP)
+#pragma omp master
+      maxInnerThreads = std::max(maxInnerThreads, omp_get_num_threads());
+#pragma omp for reduction(+:sum)
+#endif
+      for (int k = 0; k < 1000000; ++k) {
+        sum += std::sqrt(static_cast<double>(k));
+      }
+    }
+    m_sum += sum;
+  }
+
+  int maxInnerThreads; //!< Largest team of the parallel region of computeVVSIter()
+
+private:
+  double m_sum;
+};
+
 
 SCENARIO("Instantiating a silhouette me tracker", "[rbt]")
 {
@@ -556,7 +691,8 @@ SCENARIO("Instantiating a render-based tracker", "[rbt]")
         "gain": 1.0,
         "maxIterations" : 10,
         "mu": 0.5,
-        "muIterFactor": 0.1
+        "muIterFactor": 0.1,
+        "parallelTrackers": true
       },
       "model" : "path/to/model.obj",
       "silhouetteExtractionSettings" : {
@@ -621,6 +757,7 @@ SCENARIO("Instantiating a render-based tracker", "[rbt]")
 
       REQUIRE((tracker.getOptimizationGain() == Catch::Approx(1.0) && tracker.getMaxOptimizationIters() == 10));
       REQUIRE((tracker.getOptimizationInitialMu() == Catch::Approx(0.5) && tracker.getOptimizationMuIterFactor() == Catch::Approx(0.1)));
+      REQUIRE(tracker.getParallelFeatureTracking());
       };
     nlohmann::json j = nlohmann::json::parse(jsonLiteral);
     THEN("Loading configuration with trackers")
@@ -662,6 +799,75 @@ SCENARIO("Instantiating a render-based tracker", "[rbt]")
         }
       }
     }
+    THEN("Loading configuration with software rendering works without a display")
+    {
+      std::string objFile = createObjFile();
+      j["model"] = objFile;
+      j["softwareRendering"] = true;
+      tracker.loadConfiguration(j);
+      verifyBase();
+      REQUIRE(tracker.isSoftwareRenderingEnabled());
+      REQUIRE_NOTHROW(tracker.startTracking());
+      REQUIRE(tracker.getSoftwareRenderer().getNbTriangles() == 12);
+      REQUIRE(tracker.getSoftwareRenderer().getSilhouetteExtraction());
+    }
+  }
+
+  WHEN("The render is not updated between frames")
+  {
+    const unsigned int h = 240, w = 320;
+    const vpCameraParameters cam(300, 300, 160, 120);
+    const vpHomogeneousMatrix cMo_ref(0.0, 0.0, 0.3, 0.0, 0.0, 0.0);
+    nlohmann::json j = nlohmann::json::parse(R"JSON({
+      "softwareRendering": true,
+      "metric": {
+        "type": "add",
+        "renderThreshold": 0.1,
+        "convergenceThreshold": 0.0,
+        "samples": 64
+      },
+      "vvs": {
+        "gain": 1.0,
+        "maxIterations": 5,
+        "mu": 0.0,
+        "muIterFactor": 0.0
+      },
+      "silhouetteExtractionSettings": {
+        "threshold": {
+          "type": "relative",
+          "value": 0.1
+        },
+        "sampling": {
+          "type": "fixed",
+          "samplingRate": 2,
+          "numPoints": 128,
+          "reusePreviousPoints": true
+        }
+      },
+      "features": []
+    })JSON");
+    tracker.loadConfiguration(j);
+    tracker.setCameraParameters(cam, h, w);
+    tracker.setModelPath(createObjFile());
+    std::shared_ptr<vpRBStubPointTracker> stub = std::make_shared<vpRBStubPointTracker>(cMo_ref, 1, false);
+    tracker.addTracker(stub);
+    tracker.startTracking();
+    tracker.setPose(cMo_ref);
+    const vpImage<unsigned char> I(h, w, 0);
+    const unsigned int nbFrames = 4;
+    for (unsigned int i = 0; i < nbFrames; ++i) {
+      tracker.track(I);
+    }
+    THEN("The renders of the current frame are available but the ones of the previous frame may be empty")
+    {
+      REQUIRE(stub->renderSizes.size() == nbFrames);
+      for (unsigned int i = 0; i < nbFrames; ++i) {
+        REQUIRE(stub->renderSizes[i] == h * w);
+        REQUIRE(((stub->previousRenderSizes[i] == 0) || (stub->previousRenderSizes[i] == h * w)));
+      }
+      // The renders of the last frame were moved to the current frame instead of being copied
+      REQUIRE(stub->previousRenderSizes[nbFrames - 1] == 0);
+    }
   }
 
   WHEN("Adding trackers")
@@ -679,6 +885,100 @@ SCENARIO("Instantiating a render-based tracker", "[rbt]")
 #endif
 }
 
+SCENARIO("Running feature trackers in parallel", "[rbt]")
+{
+  const unsigned int h = 240, w = 320;
+  const vpCameraParameters cam(300, 300, 160, 120);
+  const vpHomogeneousMatrix cMo_ref(0.01, -0.01, 0.3, vpMath::rad(5), vpMath::rad(-5), vpMath::rad(10));
+  const vpHomogeneousMatrix cMo_init(0.0, 0.0, 0.3, 0.0, 0.0, 0.0);
+  const std::string objFile = createObjFile();
+  const vpImage<unsigned char> I(h, w, 0);
+
+  // Software rendering does not require a display
+  const auto setupTracker = [&](vpRBTracker &tracker, bool parallel, bool throwing) {
+    tracker.setCameraParameters(cam, h, w);
+    tracker.setSoftwareRendering(true);
+    tracker.setModelPath(objFile);
+    tracker.setOptimizationGain(1.0);
+    tracker.setOptimizationInitialMu(0.0);
+    tracker.setMaxOptimizationIters(20);
+    tracker.setParallelFeatureTracking(parallel);
+    tracker.addTracker(std::make_shared<vpRBStubPointTracker>(cMo_ref, 1, false));
+    tracker.addTracker(std::make_shared<vpRBStubPointTracker>(cMo_ref, 2, throwing));
+    tracker.startTracking();
+    tracker.setPose(cMo_init);
+    };
+
+  GIVEN("Two trackers of point features")
+  {
+    THEN("Running them in parallel or serially gives the same pose")
+    {
+      vpRBTracker tracker_serial, tracker_parallel;
+      setupTracker(tracker_serial, false, false);
+      setupTracker(tracker_parallel, true, false);
+      tracker_serial.track(I);
+      tracker_parallel.track(I);
+      vpHomogeneousMatrix cMo_serial, cMo_parallel;
+      tracker_serial.getPose(cMo_serial);
+      tracker_parallel.getPose(cMo_parallel);
+      const vpPoseVector p_serial(cMo_serial), p_parallel(cMo_parallel), p_ref(cMo_ref);
+      for (unsigned int i = 0; i < 6; ++i) {
+        // The contributions of the trackers are summed in the same order
+        REQUIRE(p_parallel[i] == Catch::Approx(p_serial[i]).margin(1e-12));
+        REQUIRE(p_serial[i] == Catch::Approx(p_ref[i]).margin(1e-6));
+      }
+    }
+    THEN("An exception raised by a tracker is forwarded to the caller")
+    {
+      for (bool parallel : { false, true }) {
+        vpRBTracker tracker;
+        setupTracker(tracker, parallel, true);
+        REQUIRE_THROWS_AS(tracker.track(I), vpException);
+      }
+    }
+  }
+
+  GIVEN("Two trackers with their own parallel regions")
+  {
+    THEN("The threads are shared between the trackers")
+    {
+      for (bool parallel : { false, true }) {
+        vpRBTracker tracker;
+        tracker.setCameraParameters(cam, h, w);
+        tracker.setSoftwareRendering(true);
+        tracker.setModelPath(objFile);
+        tracker.setMaxOptimizationIters(5);
+        tracker.setParallelFeatureTracking(parallel);
+        std::shared_ptr<vpRBStubParallelPointTracker> tracker1 = std::make_shared<vpRBStubParallelPointTracker>(cMo_ref, 1);
+        std::shared_ptr<vpRBStubParallelPointTracker> tracker2 = std::make_shared<vpRBStubParallelPointTracker>(cMo_ref, 2);
+        tracker.addTracker(tracker1);
+        tracker.addTracker(tracker2);
+        tracker.startTracking();
+        tracker.setPose(cMo_init);
+#if defined(VISP_HAVE_OPENMP)
+        const int maxActiveLevels = omp_get_max_active_levels();
+#endif
+        vpRBTrackingResult result = tracker.track(I);
+        const vpRBTrackingTimings &timings = result.timer();
+        std::cout << (parallel ? "Parallel" : "Serial") << " trackers: wall time = " << timings.getTrackersWallTime()
+          << " ms, critical path = " << timings.getTrackersCriticalPathTime()
+          << " ms, busy time = " << timings.getTrackersBusyTime() << " ms" << std::endl;
+        CHECK(timings.getTrackersBusyTime() >= timings.getTrackersCriticalPathTime());
+
+#if defined(VISP_HAVE_OPENMP)
+        const int maxThreads = omp_get_max_threads();
+        // Serially, each tracker uses all the threads. In parallel, the two trackers share them
+        const int expectedInnerThreads = parallel ? std::max(1, maxThreads / 2) : maxThreads;
+        CHECK(tracker1->maxInnerThreads == expectedInnerThreads);
+        CHECK(tracker2->maxInnerThreads == expectedInnerThreads);
+        // Nesting is only enabled during the tracker stages
+        CHECK(omp_get_max_active_levels() == maxActiveLevels);
+#endif
+      }
+    }
+  }
+}
+
 SCENARIO("Running tracker on static synthetic sequences", "[rbt]")
 {
   if (opt_no_display) {
@@ -748,6 +1048,95 @@ SCENARIO("Running tracker on static synthetic sequences", "[rbt]")
   }
 }
 
+SCENARIO("Comparing software rendering with Panda3D", "[rbt]")
+{
+  if (opt_no_display) {
+    std::cout << "Display is disabled for tests, skipping..." << std::endl;
+    return;
+  }
+
+  const unsigned int h = 240, w = 320;
+  const vpCameraParameters cam(300, 300, 160, 120);
+  const vpHomogeneousMatrix cMo(0.01, -0.02, 0.3, vpMath::rad(20), vpMath::rad(-30), vpMath::rad(15));
+  const std::string objFile = createObjFile();
+  const vpImage<unsigned char> I(h, w, 0);
+
+  vpRBTracker tracker_panda, tracker_software;
+  tracker_software.setSoftwareRendering(true);
+  for (vpRBTracker *tracker : { &tracker_panda, &tracker_software }) {
+    tracker->setCameraParameters(cam, h, w);
+    tracker->setModelPath(objFile);
+    tracker->setMaxOptimizationIters(1);
+    // Observations at the rendered pose: the object is rendered at cMo
+    tracker->addTracker(std::make_shared<vpRBStubPointTracker>(cMo, 1, false, true));
+    tracker->startTracking();
+    tracker->setPose(cMo);
+    tracker->track(I);
+  }
+
+  const vpRBRenderData &renders_panda = tracker_panda.getMostRecentFrame().renders;
+  const vpRBRenderData &renders_software = tracker_software.getMostRecentFrame().renders;
+  REQUIRE(renders_panda.depth.getHeight() == renders_software.depth.getHeight());
+  REQUIRE(renders_panda.depth.getWidth() == renders_software.depth.getWidth());
+  unsigned int nbObject = 0, nbMaskDifferences = 0, nbDepthDifferences = 0;
+  for (unsigned int i = 0; i < h; ++i) {
+    for (unsigned int j = 0; j < w; ++j) {
+      const bool inPanda = renders_panda.depth[i][j] > 0.f, inSoftware = renders_software.depth[i][j] > 0.f;
+      nbObject += inPanda ? 1 : 0;
+      if (inPanda != inSoftware) {
+        ++nbMaskDifferences;
+      }
+      else if (inPanda) {
+        nbDepthDifferences += (std::fabs(renders_panda.depth[i][j] - renders_software.depth[i][j]) > 1e-3f) ? 1 : 0;
+      }
+    }
+  }
+  REQUIRE(nbObject > 1000);
+  // Pixels on the object boundaries may be rasterized differently
+  CHECK(nbMaskDifferences < (nbObject / 50));
+  CHECK(nbDepthDifferences < (nbObject / 50));
+
+  // Both renderers output unit normals expressed in the object frame
+  REQUIRE(renders_panda.normals.getSize() == renders_software.normals.getSize());
+  const float cosThreshold = static_cast<float>(cos(vpMath::rad(10.0)));
+  unsigned int nbNormalDifferences = 0;
+  for (unsigned int i = 0; i < h; ++i) {
+    for (unsigned int j = 0; j < w; ++j) {
+      if ((renders_panda.depth[i][j] > 0.f) && (renders_software.depth[i][j] > 0.f)) {
+        const vpRGBf &nPanda = renders_panda.normals[i][j], &nSoftware = renders_software.normals[i][j];
+        const float cosAngle = (nPanda.R * nSoftware.R) + (nPanda.G * nSoftware.G) + (nPanda.B * nSoftware.B);
+        nbNormalDifferences += (cosAngle < cosThreshold) ? 1 : 0;
+      }
+    }
+  }
+  CHECK(nbNormalDifferences < (nbObject / 50));
+
+  // Silhouette pixels should have a counterpart in the other render, up to one pixel away
+  REQUIRE(renders_panda.isSilhouette.getSize() == renders_software.isSilhouette.getSize());
+  const vpImage<unsigned char> *silhouettes[2] = { &renders_panda.isSilhouette, &renders_software.isSilhouette };
+  for (unsigned int s = 0; s < 2; ++s) {
+    const vpImage<unsigned char> &Isil = *silhouettes[s], &Iother = *silhouettes[1 - s];
+    unsigned int nbSilhouette = 0, nbUnmatched = 0;
+    for (unsigned int i = 1; i < (h - 1); ++i) {
+      for (unsigned int j = 1; j < (w - 1); ++j) {
+        if (Isil[i][j] == 0) {
+          continue;
+        }
+        ++nbSilhouette;
+        bool matched = false;
+        for (unsigned int n = i - 1; (n <= (i + 1)) && (!matched); ++n) {
+          for (unsigned int m = j - 1; (m <= (j + 1)) && (!matched); ++m) {
+            matched = Iother[n][m] != 0;
+          }
+        }
+        nbUnmatched += matched ? 0 : 1;
+      }
+    }
+    REQUIRE(nbSilhouette > 100);
+    CHECK(nbUnmatched < (nbSilhouette / 10));
+  }
+}
+
 SCENARIO("Checking ADD convergence metric", "[rbt]")
 {
   if (opt_no_display) {
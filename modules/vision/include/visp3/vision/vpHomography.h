@@ -556,13 +556,28 @@ public:
    * an outlier if the reprojection error \f$\| {^a{\bf p} - {\hat{^a{\bf H}_b}}
    * {^b{\bf p}}} \|\f$ is greater than this threshold.
    * \param[in] normalization : When set to true, the coordinates of the points are
-   * normalized. The normalization carried out is the one preconized by Hartley.
+   * normalized before the final estimation on the consensus set. The normalization carried out is the one
+   * preconized by Hartley.
+   * \param[in] maxNbTrials : Maximum number of RANSAC trials.
+   * \param[in] useParallelRansac : If true, the trials are run concurrently by several threads that share the
+   * best consensus and stop as soon as it is reached.
+   * \param[in] nthreads : Number of threads when \e useParallelRansac is true, 0 to use all the available CPU
+   * threads.
+   * \param[in] scores : Optional quality of each matched point (for instance the opposite of the descriptor
+   * distance), the higher the better. When given, the samples are drawn with the PROSAC ordering
+   * \cite Chum05a: from the best matches first, progressively extended to all the matches. This usually finds
+   * the consensus in much fewer trials.
+   *
+   * The hypotheses are computed from samples of four points with a closed-form DLT solver and scored on all
+   * the points with a vectorizable loop.
    *
    * \return true if the homography could be computed, false otherwise.
    */
   static bool ransac(const std::vector<double> &xb, const std::vector<double> &yb, const std::vector<double> &xa,
                      const std::vector<double> &ya, vpHomography &aHb, std::vector<bool> &inliers, double &residual,
-                     unsigned int nbInliersConsensus, double threshold, bool normalization = true);
+                     unsigned int nbInliersConsensus, double threshold, bool normalization = true,
+                     int maxNbTrials = 1000, bool useParallelRansac = false, unsigned int nthreads = 0,
+                     const std::vector<double> &scores = std::vector<double>());
 
   /*!
    * Given `iPa` a pixel with coordinates \f$(u_a,v_a)\f$ in
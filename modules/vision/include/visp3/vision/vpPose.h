@@ -100,9 +100,11 @@ public:
                              initialized by Dementhon approach */
     LAGRANGE_VIRTUAL_VS,  /*!< Non linear virtual visual servoing approach
                              initialized by Lagrange approach */
-    DEMENTHON_LAGRANGE_VIRTUAL_VS /*!< Non linear virtual visual servoing approach
+    DEMENTHON_LAGRANGE_VIRTUAL_VS, /*!< Non linear virtual visual servoing approach
                              initialized by either Dementhon or Lagrange approach,
                              depending on which method has the smallest residual. */
+    P3P                   /*!< Closed-form minimal solver using three points (doesn't need an
+                             initialization) */
   } vpPoseMethodType;
 
   /*!
@@ -192,6 +194,7 @@ public:
    *   initialized by either Dementhon or Lagrange approach, depending on which method
    *   has the smallest residual.
    * - vpPose::RANSAC: Robust Ransac aproach (doesn't need an initialization)
+   * - vpPose::P3P: Closed-form minimal solver using three points, see poseP3P()
    */
   bool computePose(vpPoseMethodType method, vpHomogeneousMatrix &cMo, FuncCheckValidityPose func = nullptr);
 
@@ -323,6 +326,17 @@ public:
    */
   void poseLowe(vpHomogeneousMatrix &cMo);
 
+  /*!
+   * Compute the pose with the closed-form P3P solver of Grunert, as reviewed in \cite Haralick94. The first three
+   * points are used to compute up to four solutions. When more points are available, the solution with the smallest
+   * residual over all the points is kept.
+   *
+   * \param cMo : Estimated pose. No initialisation is requested to estimate cMo.
+   * \return true if a solution was found, false if the first three points are degenerate.
+   * \sa computeP3P()
+   */
+  bool poseP3P(vpHomogeneousMatrix &cMo);
+
   /*!
    * Compute the pose using the Ransac approach.
    *
@@ -499,6 +513,87 @@ public:
    */
   inline void setUseParallelRansac(bool use) { useParallelRansac = use; }
 
+  /*!
+   * \return True if the number of RANSAC trials is adapted to the ratio of inliers of the best consensus.
+   *
+   * \sa setUseRansacAdaptiveTermination
+   */
+  inline bool getUseRansacAdaptiveTermination() const { return useRansacAdaptiveTermination; }
+
+  /*!
+   * Enable or disable the adaptive termination of the RANSAC. When enabled, each time a larger consensus set is
+   * found, the number of trials is reduced to the one given by computeRansacIterations() for the inlier ratio of
+   * this consensus set and the probability set with setRansacProbability(). The number of trials never exceeds
+   * the one set with setRansacMaxTrials().
+   *
+   * \note By default the adaptive termination is disabled.
+   * \sa setRansacProbability
+   */
+  inline void setUseRansacAdaptiveTermination(bool use) { useRansacAdaptiveTermination = use; }
+
+  /*!
+   * Get the probability that at least one of the RANSAC samples is free from outliers, used for the adaptive
+   * termination.
+   *
+   * \sa setRansacProbability
+   */
+  inline double getRansacProbability() const { return ransacProbability; }
+
+  /*!
+   * Set the probability that at least one of the RANSAC samples is free from outliers, used for the adaptive
+   * termination. Default value is 0.99.
+   *
+   * \sa setUseRansacAdaptiveTermination
+   */
+  inline void setRansacProbability(double probability)
+  {
+    if ((probability <= 0.0) || (probability > 1.0)) {
+      throw vpException(vpException::badValue, "The RANSAC probability must be in ]0, 1].");
+    }
+    ransacProbability = probability;
+  }
+
+  /*!
+   * \return The method used to compute the pose hypotheses of the RANSAC from minimal samples.
+   *
+   * \sa setRansacMinimalSolver
+   */
+  inline vpPoseMethodType getRansacMinimalSolver() const { return ransacMinimalSolver; }
+
+  /*!
+   * Set the method used to compute the pose hypotheses of the RANSAC from minimal samples:
+   * - vpPose::DEMENTHON_LAGRANGE_VIRTUAL_VS (default): samples of four points.
+   * - vpPose::P3P: samples of three points, each one giving up to four hypotheses. The hypotheses are much cheaper
+   *   to compute and fewer samples are needed for a given outlier ratio (see computeRansacIterations()).
+   *
+   * \sa setUseRansacLocalOptimization
+   */
+  inline void setRansacMinimalSolver(vpPoseMethodType method)
+  {
+    if ((method != DEMENTHON_LAGRANGE_VIRTUAL_VS) && (method != P3P)) {
+      throw vpException(vpException::badValue,
+                        "The RANSAC minimal solver must be vpPose::DEMENTHON_LAGRANGE_VIRTUAL_VS or vpPose::P3P.");
+    }
+    ransacMinimalSolver = method;
+  }
+
+  /*!
+   * \return True if the RANSAC hypotheses that improve the best consensus are locally optimized.
+   *
+   * \sa setUseRansacLocalOptimization
+   */
+  inline bool getUseRansacLocalOptimization() const { return useRansacLocalOptimization; }
+
+  /*!
+   * Enable or disable the local optimization of the RANSAC \cite Chum03a. Each time a hypothesis improves the best
+   * consensus, the pose is refined by a few Gauss-Newton iterations on its inliers and the consensus is computed
+   * again, until it stops growing. The refined pose then initializes the final refinement on the best consensus.
+   *
+   * \note By default the local optimization is disabled.
+   * \sa setRansacMinimalSolver
+   */
+  inline void setUseRansacLocalOptimization(bool use) { useRansacLocalOptimization = use; }
+
   /*!
    * Get the vector of points.
    *
@@ -596,6 +691,18 @@ public:
   static int computeRansacIterations(double probability, double epsilon, const int sampleSize = 4,
                                      int maxIterations = 2000);
 
+  /*!
+   * Compute the poses that are consistent with three points, using the closed-form P3P solver of Grunert as
+   * reviewed in \cite Haralick94.
+   *
+   * \param p1, p2, p3 : Points with their object frame coordinates (oX, oY, oZ) and their normalized image
+   * coordinates (x, y).
+   * \param cMo_solutions : Up to four poses, with the points in front of the camera. Cleared before being filled.
+   * \return The number of solutions, 0 if the object points are collinear.
+   */
+  static unsigned int computeP3P(const vpPoint &p1, const vpPoint &p2, const vpPoint &p3,
+                                 std::vector<vpHomogeneousMatrix> &cMo_solutions);
+
   /*!
    * Display in the image \e I the pose represented by its homogenous
    * transformation \e cMo as a 3 axis frame.
@@ -832,72 +939,24 @@ private:
   bool useParallelRansac;
   //! Number of threads to spawn for the parallel RANSAC implementation
   int nbParallelRansacThreads;
+  //! If true, the number of RANSAC trials is adapted to the inlier ratio of the best consensus
+  bool useRansacAdaptiveTermination;
+  //! Probability that at least one RANSAC sample is free from outliers, for the adaptive termination
+  double ransacProbability;
+  //! Method used to compute the RANSAC hypotheses from minimal samples
+  vpPoseMethodType ransacMinimalSolver;
+  //! If true, the RANSAC hypotheses improving the best consensus are refined on their inliers
+  bool useRansacLocalOptimization;
   //! Stop the optimization loop when the residual change (|r-r_prec|) <=
   //! epsilon
   double vvsEpsilon;
 
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
   /*!
-   * Class dedicated to parallelize RANSAC.
+   * Class running RANSAC trials, possibly concurrently with other instances sharing the same best consensus.
    */
-  class vpRansacFunctor
-  {
-  public:
-    /*!
-     * Constructor.
-     */
-    vpRansacFunctor(const vpHomogeneousMatrix &cMo_, unsigned int ransacNbInlierConsensus_, const int ransacMaxTrials_,
-      double ransacThreshold_, unsigned int initial_seed_, bool checkDegeneratePoints_,
-      const std::vector<vpPoint> &listOfUniquePoints_, FuncCheckValidityPose func_)
-      : m_best_consensus(), m_checkDegeneratePoints(checkDegeneratePoints_), m_cMo(cMo_), m_foundSolution(false),
-      m_func(func_), m_listOfUniquePoints(listOfUniquePoints_), m_nbInliers(0), m_ransacMaxTrials(ransacMaxTrials_),
-      m_ransacNbInlierConsensus(ransacNbInlierConsensus_), m_ransacThreshold(ransacThreshold_),
-      m_uniRand(initial_seed_)
-    { }
-
-    /*!
-     * Operator() that calls Ransac.
-     */
-    void operator()() { m_foundSolution = poseRansacImpl(); }
-
-    /*!
-     * Access the return value.
-     */
-    bool getResult() const { return m_foundSolution; }
-
-    /*!
-     * Get Ransac best consensus.
-     */
-    std::vector<unsigned int> getBestConsensus() const { return m_best_consensus; }
-
-    /*!
-     * Get Ransac estimated pose.
-     */
-    vpHomogeneousMatrix getEstimatedPose() const { return m_cMo; }
-
-    /*!
-     * Get Ransac number of inliers.
-     */
-    unsigned int getNbInliers() const { return m_nbInliers; }
-
-  private:
-    std::vector<unsigned int> m_best_consensus; //!< Best consensus
-    bool m_checkDegeneratePoints; //!< Flag to check for degenerate points
-    vpHomogeneousMatrix m_cMo; //!< Estimated pose
-    bool m_foundSolution; //!< Solution found
-    FuncCheckValidityPose m_func; //!< Pointer to ransac function
-    std::vector<vpPoint> m_listOfUniquePoints; //!< List of unique points
-    unsigned int m_nbInliers; //!< Number of inliers
-    int m_ransacMaxTrials; //!< Ransac max trial number
-    unsigned int m_ransacNbInlierConsensus; //!< Number of inliers to check for a consensus
-    double m_ransacThreshold; //!< Residual threshold
-    vpUniRand m_uniRand; //!< Uniform random generator
-
-    /*!
-     * Ransac implementation.
-     * \return true when a solution is found.
-     */
-    bool poseRansacImpl();
-  };
+  class vpRansacFunctor;
+#endif
 };
 
 END_VISP_NAMESPACE
@@ -31,15 +31,30 @@
  * Homography estimation.
  */
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <memory>
+
 #include <visp3/core/vpDebug.h>
 #include <visp3/core/vpColVector.h>
 #include <visp3/core/vpRansac.h>
+#include <visp3/core/vpUniRand.h>
 #include <visp3/vision/vpHomography.h>
 
 #include <visp3/core/vpDisplay.h>
 #include <visp3/core/vpImage.h>
 #include <visp3/core/vpMeterPixelConversion.h>
 
+#if defined(VISP_HAVE_THREADS)
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "../private/vpRansacWorkerPool.h"
+#endif
+
 #define VPEPS 1e-6
 
 BEGIN_VISP_NAMESPACE
@@ -344,194 +359,399 @@ void vpHomography::initRansac(unsigned int n, double *xb, double *yb, double *xa
   }
 }
 
-bool vpHomography::ransac(const std::vector<double> &xb, const std::vector<double> &yb, const std::vector<double> &xa,
-                          const std::vector<double> &ya, vpHomography &aHb, std::vector<bool> &inliers,
-                          double &residual, unsigned int nbInliersConsensus, double threshold, bool normalization)
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace
 {
-  unsigned int n = static_cast<unsigned int>(xb.size());
-  if ((yb.size() != n) || (xa.size() != n) || (ya.size() != n)) {
-    throw(vpException(vpException::dimensionError, "Bad dimension for robust homography estimation"));
+//! True if the 2D points p1, p2, p3 are collinear, same criterion as iscolinear()
+inline bool isColinear2D(double x1, double y1, double x2, double y2, double x3, double y3)
+{
+  const double cross = ((x2 - x1) * (y3 - y1)) - ((y2 - y1) * (x3 - x1));
+  return (cross * cross) < VPEPS;
+}
+
+/*!
+ * Similarity normalizing 4 points (centroid at the origin, mean distance sqrt(2)), as (scale, cx, cy) such that
+ * normalized = scale * (p - c).
+ */
+bool normalizeSample(const double x[4], const double y[4], double &scale, double &cx, double &cy)
+{
+  cx = 0.25 * (x[0] + x[1] + x[2] + x[3]);
+  cy = 0.25 * (y[0] + y[1] + y[2] + y[3]);
+  double meanDist = 0.0;
+  for (unsigned int i = 0; i < 4; ++i) {
+    meanDist += std::sqrt(vpMath::sqr(x[i] - cx) + vpMath::sqr(y[i] - cy));
+  }
+  meanDist *= 0.25;
+  if (meanDist < std::numeric_limits<double>::epsilon()) {
+    return false;
   }
+  scale = std::sqrt(2.0) / meanDist;
+  return true;
+}
 
-  // 4 point are required
-  if (n < 4) {
-    throw(vpException(vpException::fatalError, "There must be at least 4 matched points"));
+/*!
+ * Homography aHb mapping exactly the 4 points b to the 4 points a, computed by solving the 8x8 DLT system with
+ * h22 = 1 on normalized coordinates. No dynamic allocation.
+ * \return false if the system is singular.
+ */
+bool computeHomography4Points(const double xb[4], const double yb[4], const double xa[4], const double ya[4],
+                              double H[9])
+{
+  double sb, cxb, cyb, sa, cxa, cya;
+  if (!normalizeSample(xb, yb, sb, cxb, cyb) || !normalizeSample(xa, ya, sa, cxa, cya)) {
+    return false;
   }
 
-  vpUniRand random(static_cast<uint64_t>(time(nullptr)));
+  double A[8][9];
+  for (unsigned int i = 0; i < 4; ++i) {
+    const double pbx = sb * (xb[i] - cxb), pby = sb * (yb[i] - cyb);
+    const double pax = sa * (xa[i] - cxa), pay = sa * (ya[i] - cya);
+    double *r1 = A[2 * i], *r2 = A[(2 * i) + 1];
+    r1[0] = pbx; r1[1] = pby; r1[2] = 1.0; r1[3] = 0.0; r1[4] = 0.0; r1[5] = 0.0;
+    r1[6] = -pax * pbx; r1[7] = -pax * pby; r1[8] = pax;
+    r2[0] = 0.0; r2[1] = 0.0; r2[2] = 0.0; r2[3] = pbx; r2[4] = pby; r2[5] = 1.0;
+    r2[6] = -pay * pbx; r2[7] = -pay * pby; r2[8] = pay;
+  }
 
-  std::vector<unsigned int> best_consensus;
-  std::vector<unsigned int> cur_consensus;
-  std::vector<unsigned int> cur_outliers;
-  std::vector<unsigned int> cur_randoms;
+  // Gaussian elimination with partial pivoting on the augmented matrix
+  for (unsigned int c = 0; c < 8; ++c) {
+    unsigned int pivot = c;
+    for (unsigned int r = c + 1; r < 8; ++r) {
+      if (std::fabs(A[r][c]) > std::fabs(A[pivot][c])) {
+        pivot = r;
+      }
+    }
+    if (std::fabs(A[pivot][c]) < 1e-10) {
+      return false;
+    }
+    if (pivot != c) {
+      for (unsigned int k = c; k < 9; ++k) {
+        std::swap(A[c][k], A[pivot][k]);
+      }
+    }
+    const double inv = 1.0 / A[c][c];
+    for (unsigned int r = c + 1; r < 8; ++r) {
+      const double f = A[r][c] * inv;
+      for (unsigned int k = c; k < 9; ++k) {
+        A[r][k] -= f * A[c][k];
+      }
+    }
+  }
+  double h[9];
+  h[8] = 1.0;
+  for (int c = 7; c >= 0; --c) {
+    double v = A[c][8];
+    for (unsigned int k = static_cast<unsigned int>(c) + 1; k < 8; ++k) {
+      v -= A[c][k] * h[k];
+    }
+    h[c] = v / A[c][c];
+  }
+
+  // Denormalization: H = Ta^-1 Hn Tb, with Tb = [sb 0 -sb cxb; 0 sb -sb cyb; 0 0 1] and
+  // Ta^-1 = [1/sa 0 cxa; 0 1/sa cya; 0 0 1]
+  double HnTb[9];
+  for (unsigned int r = 0; r < 3; ++r) {
+    HnTb[3 * r] = h[3 * r] * sb;
+    HnTb[(3 * r) + 1] = h[(3 * r) + 1] * sb;
+    HnTb[(3 * r) + 2] = h[(3 * r) + 2] - (sb * ((h[3 * r] * cxb) + (h[(3 * r) + 1] * cyb)));
+  }
+  for (unsigned int k = 0; k < 3; ++k) {
+    H[k] = (HnTb[k] / sa) + (cxa * HnTb[6 + k]);
+    H[3 + k] = (HnTb[3 + k] / sa) + (cya * HnTb[6 + k]);
+    H[6 + k] = HnTb[6 + k];
+  }
+  if (std::fabs(H[8]) < std::numeric_limits<double>::epsilon()) {
+    return false;
+  }
+  const double invH8 = 1.0 / H[8];
+  for (unsigned int k = 0; k < 9; ++k) {
+    H[k] *= invH8;
+  }
+  return true;
+}
 
-  std::vector<unsigned int> rand_ind;
+/*!
+ * PROSAC sampling schedule: the k-th trial draws its sample among the n_k best matches, n_k growing with k
+ * from 4 to the number of matches, following Chum and Matas, CVPR 2005.
+ */
+class vpProsacSchedule
+{
+public:
+  vpProsacSchedule(const std::vector<double> &scores, unsigned int nbMinRandom) : m_sorted(scores.size()), m_Tprime()
+  {
+    const size_t n = scores.size();
+    for (size_t i = 0; i < n; ++i) {
+      m_sorted[i] = static_cast<unsigned int>(i);
+    }
+    std::stable_sort(m_sorted.begin(), m_sorted.end(),
+                     [&scores](unsigned int i, unsigned int j) { return scores[i] > scores[j]; });
 
-  unsigned int nbMinRandom = 4;
-  unsigned int ransacMaxTrials = 1000;
-  unsigned int maxDegenerateIter = 1000;
+    // Number of trials after which PROSAC draws the samples uniformly, as in the paper
+    const double T_N = 200000.0;
+    double T_n = T_N;
+    for (unsigned int i = 0; i < nbMinRandom; ++i) {
+      T_n *= static_cast<double>(nbMinRandom - i) / static_cast<double>(n - i);
+    }
+    // m_Tprime[n - nbMinRandom] is the index of the last trial drawn among the n best matches
+    m_Tprime.resize(n - nbMinRandom + 1);
+    double Tprime = 1.0;
+    m_Tprime[0] = Tprime;
+    for (size_t k = nbMinRandom; k < n; ++k) {
+      const double T_n1 = (T_n * static_cast<double>(k + 1)) / static_cast<double>(k + 1 - nbMinRandom);
+      Tprime += std::ceil(T_n1 - T_n);
+      m_Tprime[k + 1 - nbMinRandom] = Tprime;
+      T_n = T_n1;
+    }
+  }
 
-  unsigned int nbTrials = 0;
-  unsigned int nbDegenerateIter = 0;
-  unsigned int nbInliers = 0;
+  //! Number of best matches among which the sample of the given trial (starting at 1) is drawn
+  size_t getNbCandidates(int trial, unsigned int nbMinRandom) const
+  {
+    std::vector<double>::const_iterator it =
+      std::lower_bound(m_Tprime.begin(), m_Tprime.end(), static_cast<double>(trial));
+    if (it == m_Tprime.end()) {
+      return m_sorted.size();
+    }
+    return static_cast<size_t>(it - m_Tprime.begin()) + nbMinRandom;
+  }
 
-  bool foundSolution = false;
+  //! Index of the match of given rank
+  unsigned int operator[](size_t rank) const { return m_sorted[rank]; }
 
-  std::vector<double> xa_rand(nbMinRandom);
-  std::vector<double> ya_rand(nbMinRandom);
-  std::vector<double> xb_rand(nbMinRandom);
-  std::vector<double> yb_rand(nbMinRandom);
+private:
+  std::vector<unsigned int> m_sorted; //!< Match indices sorted by decreasing scores
+  std::vector<double> m_Tprime;
+};
 
-  if (inliers.size() != n) {
-    inliers.resize(n);
+//! Trials counter and best consensus, shared by all the workers of the homography RANSAC
+struct vpHomographyRansacState
+{
+  vpHomographyRansacState(int maxTrials_, unsigned int nbInlierConsensus_)
+    : nbTrials(0), nbInliers(0), bestConsensus(), maxTrials(maxTrials_), nbInlierConsensus(nbInlierConsensus_)
+  { }
+
+  //! Reserve a new trial, return its index (starting at 1) or 0 when the RANSAC should stop
+  int startTrial()
+  {
+    if (nbInliers.load() >= nbInlierConsensus) {
+      return 0;
+    }
+    const int trial = nbTrials.fetch_add(1) + 1;
+    return (trial <= maxTrials) ? trial : 0;
+  }
+
+  void update(const std::vector<unsigned int> &consensus)
+  {
+#if defined(VISP_HAVE_THREADS)
+    std::lock_guard<std::mutex> lock(mutex);
+#endif
+    if (consensus.size() > nbInliers.load()) {
+      bestConsensus = consensus;
+      nbInliers.store(static_cast<unsigned int>(consensus.size()));
+    }
   }
 
-  while ((nbTrials < ransacMaxTrials) && (nbInliers < nbInliersConsensus)) {
-    cur_outliers.clear();
-    cur_randoms.clear();
+  std::atomic<int> nbTrials;
+  std::atomic<unsigned int> nbInliers;
+  std::vector<unsigned int> bestConsensus; //!< Written under the mutex
+  const int maxTrials;
+  const unsigned int nbInlierConsensus;
+#if defined(VISP_HAVE_THREADS)
+  std::mutex mutex;
+#endif
+};
 
+/*!
+ * Run homography RANSAC trials until the shared state tells to stop.
+ */
+void runHomographyRansac(const std::vector<double> &xb, const std::vector<double> &yb, const std::vector<double> &xa,
+                         const std::vector<double> &ya, double threshold, uint64_t seed,
+                         const vpProsacSchedule *prosac, vpHomographyRansacState &state)
+{
+  const unsigned int nbMinRandom = 4;
+  const unsigned int maxDegenerateIter = 1000;
+  const size_t n = xb.size();
+  const double *pxb = xb.data(), *pyb = yb.data(), *pxa = xa.data(), *pya = ya.data();
+  const double squaredThreshold = threshold * threshold;
+  vpUniRand random(seed);
+  std::vector<double> squaredErrors(n);
+  std::vector<unsigned int> consensus;
+  consensus.reserve(n);
+  double *errors = squaredErrors.data();
+
+  int trial;
+  while ((trial = state.startTrial()) > 0) {
+    double sxb[4], syb[4], sxa[4], sya[4], H[9];
+    unsigned int nbDegenerateIter = 0;
     bool degenerate = true;
-    while (degenerate == true) {
-      std::vector<bool> usedPt(n, false);
-
-      rand_ind.clear();
+    while (degenerate) {
+      // Draw 4 distinct matches, among all of them or among the best ones for PROSAC
+      unsigned int ind[4];
+      const size_t nbCandidates = (prosac != nullptr) ? prosac->getNbCandidates(trial, nbMinRandom) : n;
       for (unsigned int i = 0; i < nbMinRandom; ++i) {
-        // Generate random indicies in the range 0..n
-        unsigned int r = static_cast<unsigned int>(ceil(random() * n)) - 1;
-        while (usedPt[r]) {
-          r = static_cast<unsigned int>(ceil(random() * n)) - 1;
+        bool used = true;
+        while (used) {
+          size_t rank;
+          if ((prosac != nullptr) && (i == (nbMinRandom - 1)) && (nbCandidates < n)) {
+            // PROSAC: the sample always contains the last added match
+            rank = nbCandidates - 1;
+          }
+          else {
+            const size_t nbDraw = ((prosac != nullptr) && (nbCandidates < n)) ? nbCandidates - 1 : nbCandidates;
+            rank = static_cast<size_t>(random.uniform(0, static_cast<int>(nbDraw)));
+          }
+          ind[i] = (prosac != nullptr) ? (*prosac)[rank] : static_cast<unsigned int>(rank);
+          used = false;
+          for (unsigned int j = 0; j < i; ++j) {
+            used = used || (ind[j] == ind[i]);
+          }
         }
-        usedPt[r] = true;
-        rand_ind.push_back(r);
-
-        xa_rand[i] = xa[r];
-        ya_rand[i] = ya[r];
-        xb_rand[i] = xb[r];
-        yb_rand[i] = yb[r];
+        sxb[i] = pxb[ind[i]];
+        syb[i] = pyb[ind[i]];
+        sxa[i] = pxa[ind[i]];
+        sya[i] = pya[ind[i]];
       }
 
-      try {
-        if (!vpHomography::degenerateConfiguration(xb_rand, yb_rand, xa_rand, ya_rand)) {
-          vpHomography::DLT(xb_rand, yb_rand, xa_rand, ya_rand, aHb, normalization);
-          degenerate = false;
-        }
-      }
-      catch (...) {
-        degenerate = true;
+      degenerate = isColinear2D(sxa[0], sya[0], sxa[1], sya[1], sxa[2], sya[2]) ||
+        isColinear2D(sxa[0], sya[0], sxa[1], sya[1], sxa[3], sya[3]) ||
+        isColinear2D(sxa[0], sya[0], sxa[2], sya[2], sxa[3], sya[3]) ||
+        isColinear2D(sxa[1], sya[1], sxa[2], sya[2], sxa[3], sya[3]) ||
+        isColinear2D(sxb[0], syb[0], sxb[1], syb[1], sxb[2], syb[2]) ||
+        isColinear2D(sxb[0], syb[0], sxb[1], syb[1], sxb[3], syb[3]) ||
+        isColinear2D(sxb[0], syb[0], sxb[2], syb[2], sxb[3], syb[3]) ||
+        isColinear2D(sxb[1], syb[1], sxb[2], syb[2], sxb[3], syb[3]);
+      if (!degenerate) {
+        degenerate = !computeHomography4Points(sxb, syb, sxa, sya, H);
       }
 
       ++nbDegenerateIter;
-
-      if (nbDegenerateIter > maxDegenerateIter) {
-        vpERROR_TRACE("Unable to select a nondegenerate data set");
+      if (degenerate && (nbDegenerateIter > maxDegenerateIter)) {
         throw(vpException(vpException::fatalError, "Unable to select a nondegenerate data set"));
       }
+      if (degenerate && (prosac != nullptr)) {
+        // With PROSAC the candidates only grow with the trials: redrawing in the same trial could give the same
+        // degenerate sample, e.g. when the 4 best matches are collinear. The degenerate sample counts as a trial.
+        trial = state.startTrial();
+        if (trial == 0) {
+          return;
+        }
+      }
     }
 
-    aHb /= aHb[2][2];
-
-    // Computing Residual
-    double r = 0;
-    vpColVector a(3), b(3), c(3);
-    for (unsigned int i = 0; i < nbMinRandom; ++i) {
-      a[0] = xa_rand[i];
-      a[1] = ya_rand[i];
-      a[2] = 1;
-      b[0] = xb_rand[i];
-      b[1] = yb_rand[i];
-      b[2] = 1;
-
-      c = aHb * b;
-      c /= c[2];
-      r += (a - c).sumSquare();
+    // Branch free loop over contiguous arrays, vectorized by the compiler
+    const double h0 = H[0], h1 = H[1], h2 = H[2], h3 = H[3], h4 = H[4], h5 = H[5], h6 = H[6], h7 = H[7], h8 = H[8];
+    for (size_t i = 0; i < n; ++i) {
+      const double w = (h6 * pxb[i]) + (h7 * pyb[i]) + h8;
+      const double dx = ((((h0 * pxb[i]) + (h1 * pyb[i])) + h2) / w) - pxa[i];
+      const double dy = ((((h3 * pxb[i]) + (h4 * pyb[i])) + h5) / w) - pya[i];
+      errors[i] = (dx * dx) + (dy * dy);
+    }
+    unsigned int nbInliersCur = 0;
+    for (size_t i = 0; i < n; ++i) {
+      nbInliersCur += (errors[i] <= squaredThreshold) ? 1 : 0;
     }
 
-    // Finding inliers & ouliers
-    r = sqrt(r / nbMinRandom);
-    if (r < threshold) {
-      unsigned int nbInliersCur = 0;
-      for (unsigned int i = 0; i < n; ++i) {
-        a[0] = xa[i];
-        a[1] = ya[i];
-        a[2] = 1;
-        b[0] = xb[i];
-        b[1] = yb[i];
-        b[2] = 1;
-
-        c = aHb * b;
-        c /= c[2];
-        double error = sqrt((a - c).sumSquare());
-        if (error <= threshold) {
-          ++nbInliersCur;
-          cur_consensus.push_back(i);
-          inliers[i] = true;
-        }
-        else {
-          cur_outliers.push_back(i);
-          inliers[i] = false;
+    if (nbInliersCur > state.nbInliers.load()) {
+      consensus.clear();
+      for (size_t i = 0; i < n; ++i) {
+        if (errors[i] <= squaredThreshold) {
+          consensus.push_back(static_cast<unsigned int>(i));
         }
       }
-
-      if (nbInliersCur > nbInliers) {
-        foundSolution = true;
-        best_consensus = cur_consensus;
-        nbInliers = nbInliersCur;
-      }
-
-      cur_consensus.clear();
+      state.update(consensus);
     }
+  }
+}
+} // namespace
+#endif // DOXYGEN_SHOULD_SKIP_THIS
 
-    ++nbTrials;
-    if (nbTrials >= ransacMaxTrials) {
-      vpERROR_TRACE("Ransac reached the maximum number of trials");
-      foundSolution = true;
-    }
+bool vpHomography::ransac(const std::vector<double> &xb, const std::vector<double> &yb, const std::vector<double> &xa,
+                          const std::vector<double> &ya, vpHomography &aHb, std::vector<bool> &inliers,
+                          double &residual, unsigned int nbInliersConsensus, double threshold, bool normalization,
+                          int maxNbTrials, bool useParallelRansac, unsigned int nthreads,
+                          const std::vector<double> &scores)
+{
+  unsigned int n = static_cast<unsigned int>(xb.size());
+  if ((yb.size() != n) || (xa.size() != n) || (ya.size() != n)) {
+    throw(vpException(vpException::dimensionError, "Bad dimension for robust homography estimation"));
+  }
+  if ((!scores.empty()) && (scores.size() != n)) {
+    throw(vpException(vpException::dimensionError, "Bad dimension of the scores for robust homography estimation"));
   }
 
-  if (foundSolution) {
-    if (nbInliers >= nbInliersConsensus) {
-      const unsigned int nbConsensus = static_cast<unsigned int>(best_consensus.size());
-      std::vector<double> xa_best(nbConsensus);
-      std::vector<double> ya_best(nbConsensus);
-      std::vector<double> xb_best(nbConsensus);
-      std::vector<double> yb_best(nbConsensus);
+  // 4 point are required
+  const unsigned int nbMinRandom = 4;
+  if (n < nbMinRandom) {
+    throw(vpException(vpException::fatalError, "There must be at least 4 matched points"));
+  }
 
-      for (unsigned i = 0; i < nbConsensus; ++i) {
-        xa_best[i] = xa[best_consensus[i]];
-        ya_best[i] = ya[best_consensus[i]];
-        xb_best[i] = xb[best_consensus[i]];
-        yb_best[i] = yb[best_consensus[i]];
-      }
+  unsigned int nbThreads = 1;
+#if defined(VISP_HAVE_THREADS)
+  if (useParallelRansac) {
+    nbThreads = (nthreads == 0) ? std::max<unsigned int>(1, std::thread::hardware_concurrency()) : nthreads;
+  }
+#else
+  (void)useParallelRansac;
+  (void)nthreads;
+#endif
+
+  std::unique_ptr<vpProsacSchedule> prosac;
+  if (!scores.empty()) {
+    prosac.reset(new vpProsacSchedule(scores, nbMinRandom));
+  }
+  vpHomographyRansacState state(maxNbTrials, nbInliersConsensus);
+  const uint64_t seed = static_cast<uint64_t>(time(nullptr));
 
-      vpHomography::DLT(xb_best, yb_best, xa_best, ya_best, aHb, normalization);
-      aHb /= aHb[2][2];
+  if (nbThreads > 1) {
+#if defined(VISP_HAVE_THREADS)
+    // The workers share the trials counter and the best consensus, each one has its own random generator
+    std::function<void(unsigned int)> job = [&](unsigned int i) {
+      runHomographyRansac(xb, yb, xa, ya, threshold, seed + i, prosac.get(), state);
+      };
+    vpRansacWorkerPool::getInstance().run(nbThreads, job);
+#endif
+  }
+  else {
+    runHomographyRansac(xb, yb, xa, ya, threshold, seed, prosac.get(), state);
+  }
 
-      residual = 0;
-      vpColVector a(3), b(3), c(3);
+  if (state.nbTrials.load() >= maxNbTrials) {
+    vpERROR_TRACE("Ransac reached the maximum number of trials");
+  }
 
-      for (unsigned int i = 0; i < nbConsensus; ++i) {
-        a[0] = xa_best[i];
-        a[1] = ya_best[i];
-        a[2] = 1;
-        b[0] = xb_best[i];
-        b[1] = yb_best[i];
-        b[2] = 1;
+  const std::vector<unsigned int> &best_consensus = state.bestConsensus;
+  const unsigned int nbInliers = static_cast<unsigned int>(best_consensus.size());
+  if ((nbInliers < nbInliersConsensus) || (nbInliers < nbMinRandom)) {
+    return false;
+  }
 
-        c = aHb * b;
-        c /= c[2];
-        residual += (a - c).sumSquare();
-      }
+  inliers.assign(n, false);
+  std::vector<double> xa_best(nbInliers);
+  std::vector<double> ya_best(nbInliers);
+  std::vector<double> xb_best(nbInliers);
+  std::vector<double> yb_best(nbInliers);
 
-      residual = sqrt(residual / nbConsensus);
-      return true;
-    }
-    else {
-      return false;
-    }
+  for (unsigned i = 0; i < nbInliers; ++i) {
+    xa_best[i] = xa[best_consensus[i]];
+    ya_best[i] = ya[best_consensus[i]];
+    xb_best[i] = xb[best_consensus[i]];
+    yb_best[i] = yb[best_consensus[i]];
+    inliers[best_consensus[i]] = true;
   }
-  else {
-    return false;
+
+  vpHomography::DLT(xb_best, yb_best, xa_best, ya_best, aHb, normalization);
+  aHb /= aHb[2][2];
+
+  residual = 0;
+  for (unsigned int i = 0; i < nbInliers; ++i) {
+    const double w = (aHb[2][0] * xb_best[i]) + (aHb[2][1] * yb_best[i]) + aHb[2][2];
+    const double u = ((aHb[0][0] * xb_best[i]) + (aHb[0][1] * yb_best[i]) + aHb[0][2]) / w;
+    const double v = ((aHb[1][0] * xb_best[i]) + (aHb[1][1] * yb_best[i]) + aHb[1][2]) / w;
+    residual += vpMath::sqr(xa_best[i] - u) + vpMath::sqr(ya_best[i] - v);
   }
+
+  residual = sqrt(residual / nbInliers);
+  return true;
 }
 
 END_VISP_NAMESPACE
@@ -68,7 +68,8 @@ vpPose::vpPose()
   ransacNbInlierConsensus(def_ransacNbInlier), ransacMaxTrials(def_ransacMaxTrials), ransacInliers(), ransacInlierIndex(), ransacThreshold(0.0001),
   distToPlaneForCoplanarityTest(0.001), ransacFlag(vpPose::NO_FILTER), listOfPoints(), useParallelRansac(false),
   nbParallelRansacThreads(0), // 0 means that we use C++11 (if available) to get the number of threads
-  vvsEpsilon(1e-8)
+  useRansacAdaptiveTermination(false), ransacProbability(0.99),
+  ransacMinimalSolver(vpPose::DEMENTHON_LAGRANGE_VIRTUAL_VS), useRansacLocalOptimization(false), vvsEpsilon(1e-8)
 { }
 
 vpPose::vpPose(const std::vector<vpPoint> &lP)
@@ -78,7 +79,8 @@ vpPose::vpPose(const std::vector<vpPoint> &lP)
   ransacInliers(), ransacInlierIndex(), ransacThreshold(0.0001), distToPlaneForCoplanarityTest(0.001),
   ransacFlag(vpPose::NO_FILTER), listOfPoints(lP), useParallelRansac(false),
   nbParallelRansacThreads(0), // 0 means that we use C++11 (if available) to get the number of threads
-  vvsEpsilon(1e-8)
+  useRansacAdaptiveTermination(false), ransacProbability(0.99),
+  ransacMinimalSolver(vpPose::DEMENTHON_LAGRANGE_VIRTUAL_VS), useRansacLocalOptimization(false), vvsEpsilon(1e-8)
 { }
 
 vpPose::~vpPose()
@@ -426,6 +428,9 @@ bool vpPose::computePose(vpPoseMethodType method, vpHomogeneousMatrix &cMo, Func
   case DEMENTHON_LAGRANGE_VIRTUAL_VS: {
     return computePoseDementhonLagrangeVVS(cMo);
   }
+  case P3P: {
+    return poseP3P(cMo);
+  }
   default:
   {
     std::cout << "method not identified" << std::endl;
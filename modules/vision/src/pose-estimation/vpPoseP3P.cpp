@@ -0,0 +1,344 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Pose computation from three points.
+ */
+
+/*!
+  \file vpPoseP3P.cpp
+  \brief Closed-form pose estimation from three points (P3P).
+*/
+
+#include <cmath>
+#include <limits>
+
+#include <visp3/core/vpMath.h>
+#include <visp3/vision/vpPose.h>
+#include <visp3/vision/vpPoseException.h>
+
+BEGIN_VISP_NAMESPACE
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace
+{
+/*!
+ * Largest real root of the cubic t^3 + a t^2 + b t + c.
+ */
+double largestCubicRoot(double a, double b, double c)
+{
+  const double p = b - ((a * a) / 3.0);
+  const double q = ((2.0 * a * a * a) / 27.0) - ((a * b) / 3.0) + c;
+  const double disc = ((q * q) / 4.0) + ((p * p * p) / 27.0);
+  double t;
+  if (disc > 0.0) {
+    const double sqrtDisc = std::sqrt(disc);
+    t = std::cbrt((-q / 2.0) + sqrtDisc) + std::cbrt((-q / 2.0) - sqrtDisc);
+  }
+  else if (p < 0.0) {
+    // Three real roots, the largest one is given by k = 0
+    const double arg = std::max<double>(-1.0, std::min<double>(1.0, ((3.0 * q) / (2.0 * p)) * std::sqrt(-3.0 / p)));
+    t = 2.0 * std::sqrt(-p / 3.0) * std::cos(std::acos(arg) / 3.0);
+  }
+  else {
+    t = 0.0;
+  }
+  double root = t - (a / 3.0);
+  // Newton polishing
+  for (unsigned int iter = 0; iter < 2; ++iter) {
+    const double f = (((root + a) * root) + b) * root + c;
+    const double df = (((3.0 * root) + (2.0 * a)) * root) + b;
+    if (std::fabs(df) > std::numeric_limits<double>::epsilon()) {
+      root -= f / df;
+    }
+  }
+  return root;
+}
+
+/*!
+ * Real roots of the quadratic x^2 + b x + c, appended to roots.
+ */
+void solveMonicQuadratic(double b, double c, double roots[4], unsigned int &nbRoots)
+{
+  const double disc = (b * b) - (4.0 * c);
+  if (disc >= 0.0) {
+    const double sqrtDisc = std::sqrt(disc);
+    roots[nbRoots++] = (-b + sqrtDisc) / 2.0;
+    roots[nbRoots++] = (-b - sqrtDisc) / 2.0;
+  }
+}
+
+/*!
+ * Real roots of the quartic coeffs[4] x^4 + coeffs[3] x^3 + coeffs[2] x^2 + coeffs[1] x + coeffs[0] using the
+ * Ferrari method, polished with Newton iterations.
+ * \return The number of real roots.
+ */
+unsigned int solveQuartic(const double coeffs[5], double roots[4])
+{
+  if (std::fabs(coeffs[4]) < std::numeric_limits<double>::epsilon()) {
+    return 0;
+  }
+  const double a = coeffs[3] / coeffs[4], b = coeffs[2] / coeffs[4], c = coeffs[1] / coeffs[4],
+    d = coeffs[0] / coeffs[4];
+
+  // Depressed quartic y^4 + p y^2 + q y + r with x = y - a / 4
+  const double a2 = a * a;
+  const double p = b - ((3.0 * a2) / 8.0);
+  const double q = c - ((a * b) / 2.0) + ((a2 * a) / 8.0);
+  const double r = d - ((a * c) / 4.0) + ((a2 * b) / 16.0) - ((3.0 * a2 * a2) / 256.0);
+
+  unsigned int nbRoots = 0;
+  double y[4];
+  if (std::fabs(q) < 1e-12) {
+    // Biquadratic equation
+    double z[4];
+    unsigned int nbZ = 0;
+    solveMonicQuadratic(p, r, z, nbZ);
+    for (unsigned int i = 0; i < nbZ; ++i) {
+      if (z[i] >= 0.0) {
+        y[nbRoots++] = std::sqrt(z[i]);
+        y[nbRoots++] = -std::sqrt(z[i]);
+      }
+    }
+  }
+  else {
+    // Resolvent cubic m^3 + p m^2 + (p^2 / 4 - r) m - q^2 / 8, which has a positive root since q != 0
+    const double m = largestCubicRoot(p, ((p * p) / 4.0) - r, -(q * q) / 8.0);
+    if (m <= 0.0) {
+      return 0;
+    }
+    const double s = std::sqrt(2.0 * m);
+    solveMonicQuadratic(-s, (p / 2.0) + m + (q / (2.0 * s)), y, nbRoots);
+    solveMonicQuadratic(s, ((p / 2.0) + m) - (q / (2.0 * s)), y, nbRoots);
+  }
+
+  for (unsigned int i = 0; i < nbRoots; ++i) {
+    double x = y[i] - (a / 4.0);
+    for (unsigned int iter = 0; iter < 2; ++iter) {
+      const double f = (((((x + a) * x) + b) * x) + c) * x + d;
+      const double df = (((((4.0 * x) + (3.0 * a)) * x) + (2.0 * b)) * x) + c;
+      if (std::fabs(df) > std::numeric_limits<double>::epsilon()) {
+        x -= f / df;
+      }
+    }
+    roots[i] = x;
+  }
+  return nbRoots;
+}
+
+inline void cross(const double u[3], const double v[3], double w[3])
+{
+  w[0] = (u[1] * v[2]) - (u[2] * v[1]);
+  w[1] = (u[2] * v[0]) - (u[0] * v[2]);
+  w[2] = (u[0] * v[1]) - (u[1] * v[0]);
+}
+
+inline double dot(const double u[3], const double v[3]) { return (u[0] * v[0]) + (u[1] * v[1]) + (u[2] * v[2]); }
+
+inline bool normalize(double u[3])
+{
+  const double n = std::sqrt(dot(u, u));
+  if (n < std::numeric_limits<double>::epsilon()) {
+    return false;
+  }
+  u[0] /= n;
+  u[1] /= n;
+  u[2] /= n;
+  return true;
+}
+
+/*!
+ * Orthonormal frame attached to the triangle (P1, P2, P3), stored as the columns of F.
+ */
+bool triangleFrame(const double P1[3], const double P2[3], const double P3[3], double F[3][3])
+{
+  double e1[3] = { P2[0] - P1[0], P2[1] - P1[1], P2[2] - P1[2] };
+  const double v13[3] = { P3[0] - P1[0], P3[1] - P1[1], P3[2] - P1[2] };
+  double e3[3], e2[3];
+  cross(e1, v13, e3);
+  if (!normalize(e1) || !normalize(e3)) {
+    return false;
+  }
+  cross(e3, e1, e2);
+  for (unsigned int i = 0; i < 3; ++i) {
+    F[i][0] = e1[i];
+    F[i][1] = e2[i];
+    F[i][2] = e3[i];
+  }
+  return true;
+}
+} // namespace
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+unsigned int vpPose::computeP3P(const vpPoint &p1, const vpPoint &p2, const vpPoint &p3,
+                                std::vector<vpHomogeneousMatrix> &cMo_solutions)
+{
+  cMo_solutions.clear();
+  const vpPoint *pts[3] = { &p1, &p2, &p3 };
+  double oP[3][3], j[3][3];
+  for (unsigned int i = 0; i < 3; ++i) {
+    oP[i][0] = pts[i]->get_oX();
+    oP[i][1] = pts[i]->get_oY();
+    oP[i][2] = pts[i]->get_oZ();
+    // Unit bearing vector of the image point
+    j[i][0] = pts[i]->get_x();
+    j[i][1] = pts[i]->get_y();
+    j[i][2] = 1.0;
+    normalize(j[i]);
+  }
+
+  double F_o[3][3];
+  if (!triangleFrame(oP[0], oP[1], oP[2], F_o)) {
+    // Collinear object points
+    return 0;
+  }
+
+  // Sides of the triangle and angles between the bearing vectors, following the notations of Grunert's solution
+  // as reviewed in Haralick et al., 1994: a = |P2 P3|, b = |P1 P3|, c = |P1 P2|
+  const double a2 = vpMath::sqr(oP[1][0] - oP[2][0]) + vpMath::sqr(oP[1][1] - oP[2][1]) + vpMath::sqr(oP[1][2] - oP[2][2]);
+  const double b2 = vpMath::sqr(oP[0][0] - oP[2][0]) + vpMath::sqr(oP[0][1] - oP[2][1]) + vpMath::sqr(oP[0][2] - oP[2][2]);
+  const double c2 = vpMath::sqr(oP[0][0] - oP[1][0]) + vpMath::sqr(oP[0][1] - oP[1][1]) + vpMath::sqr(oP[0][2] - oP[1][2]);
+  const double cosAlpha = dot(j[1], j[2]), cosBeta = dot(j[0], j[2]), cosGamma = dot(j[0], j[1]);
+
+  // With s2 = u s1 and s3 = v s1 the distances of the points to the camera center, the law of cosines gives
+  // u = N(v) / D(v) and a quartic equation in v: N^2 - 2 cos(gamma) N D + E D^2 = 0
+  const double K_ac = (a2 - c2) / b2, K_c = c2 / b2;
+  const double n[3] = { 1.0 + K_ac, -2.0 * K_ac * cosBeta, K_ac - 1.0 };
+  const double dd[2] = { 2.0 * cosGamma, -2.0 * cosAlpha };
+  const double e[3] = { 1.0 - K_c, 2.0 * K_c * cosBeta, -K_c };
+
+  double N2[5] = { 0., 0., 0., 0., 0. }, ND[4] = { 0., 0., 0., 0. }, D2[3] = { 0., 0., 0. };
+  for (unsigned int i = 0; i < 3; ++i) {
+    for (unsigned int k = 0; k < 3; ++k) {
+      N2[i + k] += n[i] * n[k];
+    }
+    for (unsigned int k = 0; k < 2; ++k) {
+      ND[i + k] += n[i] * dd[k];
+    }
+  }
+  for (unsigned int i = 0; i < 2; ++i) {
+    for (unsigned int k = 0; k < 2; ++k) {
+      D2[i + k] += dd[i] * dd[k];
+    }
+  }
+  double coeffs[5];
+  for (unsigned int i = 0; i < 5; ++i) {
+    coeffs[i] = N2[i];
+    if (i < 4) {
+      coeffs[i] -= 2.0 * cosGamma * ND[i];
+    }
+    for (unsigned int k = 0; (k < 3) && (k <= i); ++k) {
+      if ((i - k) < 3) {
+        coeffs[i] += e[k] * D2[i - k];
+      }
+    }
+  }
+
+  double roots[4];
+  const unsigned int nbRoots = solveQuartic(coeffs, roots);
+  for (unsigned int r = 0; r < nbRoots; ++r) {
+    const double v = roots[r];
+    const double D = dd[0] + (dd[1] * v);
+    if ((v <= 0.0) || (std::fabs(D) < std::numeric_limits<double>::epsilon())) {
+      continue;
+    }
+    const double u = (n[0] + (n[1] * v) + (n[2] * v * v)) / D;
+    const double den = (1.0 + (v * v)) - (2.0 * v * cosBeta);
+    if ((u <= 0.0) || (den <= 0.0)) {
+      continue;
+    }
+    const double s1 = std::sqrt(b2 / den);
+    const double s[3] = { s1, u * s1, v * s1 };
+    double cP[3][3];
+    for (unsigned int i = 0; i < 3; ++i) {
+      for (unsigned int k = 0; k < 3; ++k) {
+        cP[i][k] = s[i] * j[i][k];
+      }
+    }
+
+    // The rotation maps the frame of the object triangle onto the one of the camera triangle
+    double F_c[3][3];
+    if (!triangleFrame(cP[0], cP[1], cP[2], F_c)) {
+      continue;
+    }
+    vpHomogeneousMatrix cMo;
+    for (unsigned int i = 0; i < 3; ++i) {
+      for (unsigned int k = 0; k < 3; ++k) {
+        cMo[i][k] = (F_c[i][0] * F_o[k][0]) + (F_c[i][1] * F_o[k][1]) + (F_c[i][2] * F_o[k][2]);
+      }
+    }
+    for (unsigned int i = 0; i < 3; ++i) {
+      cMo[i][3] = cP[0][i] - ((cMo[i][0] * oP[0][0]) + (cMo[i][1] * oP[0][1]) + (cMo[i][2] * oP[0][2]));
+    }
+
+    // Remove the duplicated solutions given by a double root
+    bool duplicated = false;
+    for (size_t i = 0; (i < cMo_solutions.size()) && (!duplicated); ++i) {
+      duplicated = (cMo_solutions[i].getTranslationVector() - cMo.getTranslationVector()).frobeniusNorm() < 1e-9;
+    }
+    if (!duplicated) {
+      cMo_solutions.push_back(cMo);
+    }
+  }
+
+  return static_cast<unsigned int>(cMo_solutions.size());
+}
+
+bool vpPose::poseP3P(vpHomogeneousMatrix &cMo)
+{
+  const unsigned int minNbPtP3P = 3;
+  if (listP.size() < minNbPtP3P) {
+    throw(vpPoseException(vpPoseException::notEnoughPointError,
+                          "P3P method cannot be used in that case (at least 3 points are required). "
+                          "Not enough point (%d) to compute the pose  ",
+                          listP.size()));
+  }
+
+  std::list<vpPoint>::const_iterator it = listP.begin();
+  const vpPoint &p1 = *it;
+  const vpPoint &p2 = *(++it);
+  const vpPoint &p3 = *(++it);
+  std::vector<vpHomogeneousMatrix> cMo_solutions;
+  if (computeP3P(p1, p2, p3, cMo_solutions) == 0) {
+    return false;
+  }
+
+  // The other points, if any, disambiguate the solutions
+  double r_min = std::numeric_limits<double>::max();
+  for (size_t i = 0; i < cMo_solutions.size(); ++i) {
+    const double r = computeResidual(cMo_solutions[i]);
+    if (r < r_min) {
+      r_min = r;
+      cMo = cMo_solutions[i];
+    }
+  }
+  return true;
+}
+
+END_VISP_NAMESPACE
@@ -37,6 +37,7 @@
 */
 
 #include <algorithm> // std::count
+#include <atomic>
 #include <cmath>     // std::fabs
 #include <float.h>   // DBL_MAX
 #include <iostream>
@@ -44,13 +45,18 @@
 #include <map>
 
 #include <visp3/core/vpColVector.h>
+#include <visp3/core/vpExponentialMap.h>
 #include <visp3/core/vpMath.h>
 #include <visp3/core/vpRansac.h>
 #include <visp3/vision/vpPose.h>
 #include <visp3/vision/vpPoseException.h>
 
 #if defined(VISP_HAVE_THREADS)
+#include <functional>
+#include <mutex>
 #include <thread>
+
+#include "../private/vpRansacWorkerPool.h"
 #endif
 
 #define EPS 1e-6
@@ -162,171 +168,381 @@ struct FindDegeneratePoint
 } // namespace
 #endif // DOXYGEN_SHOULD_SKIP_THIS
 
-bool vpPose::vpRansacFunctor::poseRansacImpl()
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace
 {
-  const int size = static_cast<int>(m_listOfUniquePoints.size());
-  const unsigned int nbMinRandom = 4;
-  int nbTrials = 0;
-
-  vpPoint p; // Point used to project using the estimated pose
-
-  bool foundSolution = false;
-  while ((nbTrials < m_ransacMaxTrials) && (m_nbInliers < m_ransacNbInlierConsensus)) {
-    // Hold the list of the index of the inliers (points in the consensus set)
-    std::vector<unsigned int> cur_consensus;
-    // Hold the list of the index of the outliers
-    std::vector<unsigned int> cur_outliers;
-    // Hold the list of the index of the points randomly picked
-    std::vector<unsigned int> cur_randoms;
-    // Hold the list of the current inliers points to avoid to add a
-    // degenerate point if the flag is set
-    std::vector<vpPoint> cur_inliers;
-
-    // Use a temporary variable because if not, the cMo passed in parameters
-    // will be modified when
-    // we compute the pose for the minimal sample sets but if the pose is not
-    // correct when we pass a function pointer we do not want to modify the
-    // cMo passed in parameters
-    vpHomogeneousMatrix cMo_tmp;
+/*!
+ * Points used by the RANSAC, stored as structure of arrays so that the scoring of a pose hypothesis
+ * is a vectorizable loop over contiguous coordinates.
+ */
+struct vpRansacPoints
+{
+  explicit vpRansacPoints(const std::vector<vpPoint> &points)
+    : oX(points.size()), oY(points.size()), oZ(points.size()), x(points.size()), y(points.size())
+  {
+    for (size_t i = 0; i < points.size(); ++i) {
+      oX[i] = points[i].get_oX();
+      oY[i] = points[i].get_oY();
+      oZ[i] = points[i].get_oZ();
+      x[i] = points[i].get_x();
+      y[i] = points[i].get_y();
+    }
+  }
 
-    // Vector of used points, initialized at false for all points
-    std::vector<bool> usedPt(static_cast<size_t>(size), false);
+  size_t size() const { return x.size(); }
 
-    vpPose poseMin;
-    unsigned int i = 0;
-    bool stop_loop = false;
-    while ((i < nbMinRandom) && (stop_loop == false)) {
-      if (static_cast<size_t>(std::count(usedPt.begin(), usedPt.end(), true)) == usedPt.size()) {
-        // All points were picked once, break otherwise we stay in an infinite loop
-        stop_loop = true;
+  //! Same test as FindDegeneratePoint, on points i and j
+  bool degenerate(size_t i, size_t j) const
+  {
+    const bool sameObjectPoint = (std::fabs(oX[i] - oX[j]) < EPS) && (std::fabs(oY[i] - oY[j]) < EPS) &&
+      (std::fabs(oZ[i] - oZ[j]) < EPS);
+    const bool sameImagePoint = (std::fabs(x[i] - x[j]) < EPS) && (std::fabs(y[i] - y[j]) < EPS);
+    return sameObjectPoint || sameImagePoint;
+  }
+
+  std::vector<double> oX, oY, oZ;
+  std::vector<double> x, y;
+};
+
+/*!
+ * State shared by all the workers of a RANSAC: the trials are counted globally and the best consensus is
+ * visible to all the workers, so that all of them stop as soon as a consensus is reached or the
+ * (possibly adapted) number of trials is exhausted.
+ */
+struct vpRansacSharedState
+{
+  vpRansacSharedState(int maxTrials_, unsigned int nbInlierConsensus_, bool adaptiveTermination_, double probability_,
+                      unsigned int sampleSize_)
+    : nbTrials(0), maxTrials(maxTrials_), nbInliers(0), bestConsensus(), bestPose(),
+    nbInlierConsensus(nbInlierConsensus_), initialMaxTrials(maxTrials_), adaptiveTermination(adaptiveTermination_),
+    probability(probability_), sampleSize(sampleSize_)
+  { }
+
+  //! Reserve a new trial, return false when the RANSAC should stop
+  bool startTrial()
+  {
+    if (nbInliers.load() >= nbInlierConsensus) {
+      return false;
+    }
+    return nbTrials.fetch_add(1) < maxTrials.load();
+  }
+
+  //! Update the best consensus and the corresponding pose if the given consensus is larger
+  void update(const std::vector<unsigned int> &consensus, const vpHomogeneousMatrix &cMo, size_t nbPoints)
+  {
+    const unsigned int nbInliersCur = static_cast<unsigned int>(consensus.size());
+    if (nbInliersCur <= nbInliers.load()) {
+      return;
+    }
+#if defined(VISP_HAVE_THREADS)
+    std::lock_guard<std::mutex> lock(mutex);
+#endif
+    if (nbInliersCur <= nbInliers.load()) {
+      return;
+    }
+    bestConsensus = consensus;
+    bestPose = cMo;
+    nbInliers.store(nbInliersCur);
+
+    if (adaptiveTermination && (nbInliersCur >= sampleSize)) {
+      const double outlierRatio = 1.0 - (static_cast<double>(nbInliersCur) / static_cast<double>(nbPoints));
+      const int nbTrialsNeeded =
+        vpPose::computeRansacIterations(probability, outlierRatio, static_cast<int>(sampleSize), initialMaxTrials);
+      if ((nbTrialsNeeded > 0) && (nbTrialsNeeded < maxTrials.load())) {
+        maxTrials.store(nbTrialsNeeded);
       }
-      if (!stop_loop) {
-        // Pick a point randomly
-        size_t r_ = static_cast<size_t>(m_uniRand.uniform(0, size));
+    }
+  }
+
+  std::atomic<int> nbTrials; //!< Number of trials started by all the workers
+  std::atomic<int> maxTrials; //!< Number of trials after which the RANSAC stops
+  std::atomic<unsigned int> nbInliers; //!< Size of the best consensus
+  std::vector<unsigned int> bestConsensus; //!< Best consensus, written under the mutex
+  vpHomogeneousMatrix bestPose; //!< Pose of the best consensus, written under the mutex
+  const unsigned int nbInlierConsensus;
+  const int initialMaxTrials;
+  const bool adaptiveTermination;
+  const double probability;
+  const unsigned int sampleSize; //!< Number of points of the minimal samples
+#if defined(VISP_HAVE_THREADS)
+  std::mutex mutex;
+#endif
+};
 
-        while (usedPt[r_]) {
-          // If already picked, pick another point randomly
-          r_ = static_cast<size_t>(m_uniRand.uniform(0, size));
+} // namespace
+
+class vpPose::vpRansacFunctor
+{
+public:
+  vpRansacFunctor(const std::vector<vpPoint> &listOfUniquePoints, const vpRansacPoints &points, double ransacThreshold,
+                  unsigned int initialSeed, bool checkDegeneratePoints, FuncCheckValidityPose func,
+                  vpPoseMethodType minimalSolver, bool localOptimization, vpRansacSharedState &state)
+    : m_listOfUniquePoints(listOfUniquePoints), m_points(points), m_ransacThreshold(ransacThreshold),
+    m_checkDegeneratePoints(checkDegeneratePoints), m_func(func), m_minimalSolver(minimalSolver),
+    m_localOptimization(localOptimization), m_state(state), m_uniRand(initialSeed)
+  { }
+
+  //! Run trials until the shared state tells to stop
+  void operator()()
+  {
+    const size_t size = m_points.size();
+    std::vector<double> squaredErrors(size);
+    std::vector<unsigned int> cur_consensus, lo_consensus;
+    cur_consensus.reserve(size);
+    std::vector<bool> usedPt(size);
+    vpPose poseMin;
+    vpHomogeneousMatrix cMo;
+    std::vector<vpHomogeneousMatrix> cMo_hypotheses;
+
+    while (m_state.startTrial()) {
+      if (m_minimalSolver == vpPose::P3P) {
+        if (!sampleMinimalSet(poseMin, usedPt, m_state.sampleSize)) {
+          continue;
+        }
+        std::list<vpPoint>::const_iterator it = poseMin.listP.begin();
+        const vpPoint &p1 = *it;
+        const vpPoint &p2 = *(++it);
+        const vpPoint &p3 = *(++it);
+        vpPose::computeP3P(p1, p2, p3, cMo_hypotheses);
+      }
+      else {
+        cMo_hypotheses.clear();
+        if (computeMinimalPose(poseMin, usedPt, cMo)) {
+          cMo_hypotheses.push_back(cMo);
         }
-        // Mark this point as already picked
-        usedPt[r_] = true;
-        vpPoint pt = m_listOfUniquePoints[r_];
+      }
 
-        bool degenerate = false;
-        if (m_checkDegeneratePoints) {
-          if (std::find_if(poseMin.listOfPoints.begin(), poseMin.listOfPoints.end(), FindDegeneratePoint(pt)) !=
-              poseMin.listOfPoints.end()) {
-            degenerate = true;
-          }
+      for (size_t h = 0; h < cMo_hypotheses.size(); ++h) {
+        cMo = cMo_hypotheses[h];
+        if ((m_func != nullptr) && (!m_func(cMo))) {
+          continue;
+        }
+        computeConsensus(cMo, squaredErrors, cur_consensus);
+        if (m_localOptimization && (cur_consensus.size() > m_state.nbInliers.load())) {
+          localOptimization(cMo, squaredErrors, cur_consensus, lo_consensus);
         }
+        m_state.update(cur_consensus, cMo, size);
+      }
+    }
+  }
 
-        if (!degenerate) {
-          poseMin.addPoint(pt);
-          cur_randoms.push_back(r_);
-          // Increment the number of points picked
-          ++i;
+private:
+  /*!
+   * Pick randomly nbMinRandom points, without degenerate points if m_checkDegeneratePoints is set.
+   * \return false if all the points were picked without finding enough non degenerate ones.
+   */
+  bool sampleMinimalSet(vpPose &poseMin, std::vector<bool> &usedPt, unsigned int nbMinRandom)
+  {
+    const int size = static_cast<int>(m_points.size());
+    std::fill(usedPt.begin(), usedPt.end(), false);
+    poseMin.clearPoint();
+
+    unsigned int i = 0;
+    unsigned int nbUsed = 0;
+    while (i < nbMinRandom) {
+      if (nbUsed == usedPt.size()) {
+        // All points were picked once, break otherwise we stay in an infinite loop
+        return false;
+      }
+      // Pick a point randomly
+      size_t r_ = static_cast<size_t>(m_uniRand.uniform(0, size));
+      while (usedPt[r_]) {
+        // If already picked, pick another point randomly
+        r_ = static_cast<size_t>(m_uniRand.uniform(0, size));
+      }
+      // Mark this point as already picked
+      usedPt[r_] = true;
+      ++nbUsed;
+      const vpPoint &pt = m_listOfUniquePoints[r_];
+
+      bool degenerate = false;
+      if (m_checkDegeneratePoints) {
+        if (std::find_if(poseMin.listOfPoints.begin(), poseMin.listOfPoints.end(), FindDegeneratePoint(pt)) !=
+            poseMin.listOfPoints.end()) {
+          degenerate = true;
         }
       }
+
+      if (!degenerate) {
+        poseMin.addPoint(pt);
+        // Increment the number of points picked
+        ++i;
+      }
+    }
+    return true;
+  }
+
+  /*!
+   * Compute a pose from a random minimal sample of four points.
+   * \return true if the pose is valid and its residual below the RANSAC threshold.
+   */
+  bool computeMinimalPose(vpPose &poseMin, std::vector<bool> &usedPt, vpHomogeneousMatrix &cMo)
+  {
+    const unsigned int nbMinRandom = 4;
+    if (!sampleMinimalSet(poseMin, usedPt, nbMinRandom)) {
+      return false;
     }
 
-    bool stop_for_loop = false;
-    if (poseMin.npt < nbMinRandom) {
-      ++nbTrials;
-      stop_for_loop = true;
+    bool is_pose_valid = false;
+    double r_min = DBL_MAX;
+    // Use a temporary pose, the pose is only given back if it respects the pose criterion
+    vpHomogeneousMatrix cMo_tmp;
+    try {
+      is_pose_valid = poseMin.computePose(vpPose::DEMENTHON_LAGRANGE_VIRTUAL_VS, cMo_tmp);
+      r_min = poseMin.computeResidual(cMo_tmp);
+    }
+    catch (...) {
+      // no need to take action
     }
 
-    if (!stop_for_loop) {
-      bool is_pose_valid = false;
-      double r_min = DBL_MAX;
+    // If residual returned is not a number (NAN), set valid to false
+    if (vpMath::isNaN(r_min)) {
+      is_pose_valid = false;
+    }
+    if (!is_pose_valid) {
+      return false;
+    }
 
-      try {
-        is_pose_valid = poseMin.computePose(vpPose::DEMENTHON_LAGRANGE_VIRTUAL_VS, cMo_tmp);
-        r_min = poseMin.computeResidual(cMo_tmp);
+    double r = sqrt(r_min) / static_cast<double>(nbMinRandom); // FS should be r = sqrt(r_min / (double)nbMinRandom);
+    cMo = cMo_tmp;
+    return r < m_ransacThreshold;
+  }
+
+  /*!
+   * Local optimization of a hypothesis that improves the best consensus: the pose is refined by Gauss-Newton
+   * iterations minimizing the reprojection error of its inliers, then the consensus is computed again. This is
+   * repeated while the consensus grows.
+   */
+  void localOptimization(vpHomogeneousMatrix &cMo, std::vector<double> &squaredErrors,
+                         std::vector<unsigned int> &consensus, std::vector<unsigned int> &lo_consensus) const
+  {
+    const unsigned int nbMaxLoIterations = 4;
+    const unsigned int nbMinPoints = 4;
+    for (unsigned int iter = 0; (iter < nbMaxLoIterations) && (consensus.size() >= nbMinPoints); ++iter) {
+      vpHomogeneousMatrix cMo_lo = cMo;
+      if (!refinePose(consensus, cMo_lo)) {
+        return;
       }
-      catch (...) {
-        // no need to take action
+      if ((m_func != nullptr) && (!m_func(cMo_lo))) {
+        return;
       }
-
-      // If residual returned is not a number (NAN), set valid to false
-      if (vpMath::isNaN(r_min)) {
-        is_pose_valid = false;
+      computeConsensus(cMo_lo, squaredErrors, lo_consensus);
+      if (lo_consensus.size() < consensus.size()) {
+        return;
+      }
+      const bool grown = lo_consensus.size() > consensus.size();
+      cMo = cMo_lo;
+      consensus.swap(lo_consensus);
+      if (!grown) {
+        return;
       }
+    }
+  }
 
-      // If at pose computation is OK we can continue, otherwise pick another random set
-      if (is_pose_valid) {
-        double r = sqrt(r_min) / static_cast<double>(nbMinRandom); // FS should be r = sqrt(r_min / (double)nbMinRandom);
-        // Filter the pose using some criterion (orientation angles,
-        // translations, etc.)
-        bool isPoseValid = true;
-        if (m_func != nullptr) {
-          isPoseValid = m_func(cMo_tmp);
-          if (isPoseValid) {
-            m_cMo = cMo_tmp;
+  /*!
+   * Gauss-Newton minimization of the reprojection error of the given points, initialized with cMo.
+   * The normal equations are accumulated directly, which avoids the pseudo-inverse of the 2N x 6 interaction matrix
+   * computed by vpPose::poseVirtualVS().
+   * \return false if the normal equations are singular.
+   */
+  bool refinePose(const std::vector<unsigned int> &indices, vpHomogeneousMatrix &cMo) const
+  {
+    const unsigned int nbGaussNewtonIterations = 3;
+    const double *oX = m_points.oX.data(), *oY = m_points.oY.data(), *oZ = m_points.oZ.data();
+    const double *xd = m_points.x.data(), *yd = m_points.y.data();
+    vpMatrix LTL(6, 6);
+    vpColVector LTe(6), v;
+    for (unsigned int iter = 0; iter < nbGaussNewtonIterations; ++iter) {
+      LTL = 0.0;
+      LTe = 0.0;
+      for (size_t k = 0; k < indices.size(); ++k) {
+        const unsigned int i = indices[k];
+        const double X = (cMo[0][0] * oX[i]) + (cMo[0][1] * oY[i]) + (cMo[0][2] * oZ[i]) + cMo[0][3];
+        const double Y = (cMo[1][0] * oX[i]) + (cMo[1][1] * oY[i]) + (cMo[1][2] * oZ[i]) + cMo[1][3];
+        const double Z = (cMo[2][0] * oX[i]) + (cMo[2][1] * oY[i]) + (cMo[2][2] * oZ[i]) + cMo[2][3];
+        const double x = X / Z, y = Y / Z, iZ = 1.0 / Z;
+        const double Lx[6] = { -iZ, 0.0, x * iZ, x * y, -(1.0 + (x * x)), y };
+        const double Ly[6] = { 0.0, -iZ, y * iZ, 1.0 + (y * y), -x * y, -x };
+        const double ex = x - xd[i], ey = y - yd[i];
+        for (unsigned int r = 0; r < 6; ++r) {
+          for (unsigned int c = r; c < 6; ++c) {
+            LTL[r][c] += (Lx[r] * Lx[c]) + (Ly[r] * Ly[c]);
           }
+          LTe[r] += (Lx[r] * ex) + (Ly[r] * ey);
         }
-        else {
-          // No post filtering on pose, so copy cMo_temp to cMo
-          m_cMo = cMo_tmp;
+      }
+      for (unsigned int r = 1; r < 6; ++r) {
+        for (unsigned int c = 0; c < r; ++c) {
+          LTL[r][c] = LTL[c][r];
         }
+      }
+      try {
+        v = -(LTL.inverseByLU() * LTe);
+      }
+      catch (...) {
+        return false;
+      }
+      if (vpMath::isNaN(v.sumSquare())) {
+        return false;
+      }
+      cMo = vpExponentialMap::direct(v).inverse() * cMo;
+    }
+    return true;
+  }
 
-        if (isPoseValid && (r < m_ransacThreshold)) {
-          unsigned int nbInliersCur = 0;
-          unsigned int iter = 0;
-          std::vector<vpPoint>::const_iterator m_listofuniquepoints_end = m_listOfUniquePoints.end();
-          for (std::vector<vpPoint>::const_iterator it = m_listOfUniquePoints.begin(); it != m_listofuniquepoints_end;
-               ++it, ++iter) {
-            p.setWorldCoordinates(it->get_oX(), it->get_oY(), it->get_oZ());
-            p.track(m_cMo);
-
-            double error = sqrt(vpMath::sqr(p.get_x() - it->get_x()) + vpMath::sqr(p.get_y() - it->get_y()));
-            if (error < m_ransacThreshold) {
-              bool degenerate = false;
-              if (m_checkDegeneratePoints) {
-                if (std::find_if(cur_inliers.begin(), cur_inliers.end(), FindDegeneratePoint(*it)) != cur_inliers.end()) {
-                  degenerate = true;
-                }
-              }
-
-              if (!degenerate) {
-                // the point is considered as inlier if the error is below the
-                // threshold
-                ++nbInliersCur;
-                cur_consensus.push_back(iter);
-                cur_inliers.push_back(*it);
-              }
-              else {
-                cur_outliers.push_back(iter);
-              }
-            }
-            else {
-              cur_outliers.push_back(iter);
-            }
-          }
-
-          if (nbInliersCur > m_nbInliers) {
-            foundSolution = true;
-            m_best_consensus = cur_consensus;
-            m_nbInliers = nbInliersCur;
-          }
-
-          ++nbTrials;
+  /*!
+   * Compute the indices of the points whose reprojection error for pose cMo is below the RANSAC threshold.
+   */
+  void computeConsensus(const vpHomogeneousMatrix &cMo, std::vector<double> &squaredErrors,
+                        std::vector<unsigned int> &consensus) const
+  {
+    const size_t size = m_points.size();
+    const double r00 = cMo[0][0], r01 = cMo[0][1], r02 = cMo[0][2], tx = cMo[0][3];
+    const double r10 = cMo[1][0], r11 = cMo[1][1], r12 = cMo[1][2], ty = cMo[1][3];
+    const double r20 = cMo[2][0], r21 = cMo[2][1], r22 = cMo[2][2], tz = cMo[2][3];
+    const double *oX = m_points.oX.data(), *oY = m_points.oY.data(), *oZ = m_points.oZ.data();
+    const double *x = m_points.x.data(), *y = m_points.y.data();
+    double *errors = squaredErrors.data();
+
+    // Branch free loop over contiguous arrays, vectorized by the compiler
+    for (size_t i = 0; i < size; ++i) {
+      const double X = (r00 * oX[i]) + (r01 * oY[i]) + (r02 * oZ[i]) + tx;
+      const double Y = (r10 * oX[i]) + (r11 * oY[i]) + (r12 * oZ[i]) + ty;
+      const double Z = (r20 * oX[i]) + (r21 * oY[i]) + (r22 * oZ[i]) + tz;
+      const double dx = (X / Z) - x[i];
+      const double dy = (Y / Z) - y[i];
+      errors[i] = (dx * dx) + (dy * dy);
+    }
 
-          if (nbTrials >= m_ransacMaxTrials) {
-            foundSolution = true;
+    const double squaredThreshold = m_ransacThreshold * m_ransacThreshold;
+    consensus.clear();
+    for (size_t i = 0; i < size; ++i) {
+      if (errors[i] < squaredThreshold) {
+        bool degenerate = false;
+        if (m_checkDegeneratePoints) {
+          for (size_t j = 0; (j < consensus.size()) && (!degenerate); ++j) {
+            degenerate = m_points.degenerate(i, consensus[j]);
           }
         }
-        else {
-          ++nbTrials;
+        if (!degenerate) {
+          // the point is considered as inlier if the error is below the threshold
+          consensus.push_back(static_cast<unsigned int>(i));
         }
       }
-      else {
-        ++nbTrials;
-      }
     }
   }
 
-  return foundSolution;
-}
+  const std::vector<vpPoint> &m_listOfUniquePoints; //!< List of unique points, used to compute the minimal poses
+  const vpRansacPoints &m_points; //!< Same points, as structure of arrays
+  double m_ransacThreshold; //!< Residual threshold
+  bool m_checkDegeneratePoints; //!< Flag to check for degenerate points
+  FuncCheckValidityPose m_func; //!< Pointer to ransac function
+  vpPoseMethodType m_minimalSolver; //!< Method computing the hypotheses from the minimal samples
+  bool m_localOptimization; //!< If true, the hypotheses improving the best consensus are refined on their inliers
+  vpRansacSharedState &m_state; //!< Trials counter and best consensus, shared with the other workers
+  vpUniRand m_uniRand; //!< Uniform random generator
+};
+#endif // DOXYGEN_SHOULD_SKIP_THIS
 
 bool vpPose::poseRansac(vpHomogeneousMatrix &cMo, FuncCheckValidityPose func)
 {
@@ -398,88 +614,48 @@ bool vpPose::poseRansac(vpHomogeneousMatrix &cMo, FuncCheckValidityPose func)
     throw(vpPoseException(vpPoseException::notInitializedError, "Not enough point to compute the pose"));
   }
 
+  unsigned int nbThreads = 1;
 #if defined(VISP_HAVE_THREADS)
-  int nbThreads = 1;
-  bool executeParallelVersion = useParallelRansac;
-#else
-  bool executeParallelVersion = false;
-#endif
-
-  if (executeParallelVersion) {
-#if defined(VISP_HAVE_THREADS)
+  if (useParallelRansac) {
     if (nbParallelRansacThreads <= 0) {
       // Get number of CPU threads
-      nbThreads = static_cast<int>(std::thread::hardware_concurrency());
-      if (nbThreads <= 1) {
-        nbThreads = 1;
-        executeParallelVersion = false;
-      }
+      nbThreads = std::max<unsigned int>(1, std::thread::hardware_concurrency());
     }
     else {
-      nbThreads = nbParallelRansacThreads;
+      nbThreads = static_cast<unsigned int>(nbParallelRansacThreads);
     }
-#endif
   }
+#endif
 
-  bool foundSolution = false;
+  const vpRansacPoints points(listOfUniquePoints);
+  const unsigned int sampleSize = (ransacMinimalSolver == P3P) ? 3 : 4;
+  vpRansacSharedState state(ransacMaxTrials, ransacNbInlierConsensus, useRansacAdaptiveTermination, ransacProbability,
+                            sampleSize);
 
-  if (executeParallelVersion) {
+  if (nbThreads > 1) {
 #if defined(VISP_HAVE_THREADS)
-    std::vector<std::thread> threadpool;
-    std::vector<vpRansacFunctor> ransacWorkers;
-
-    int splitTrials = ransacMaxTrials / nbThreads;
-    for (size_t i = 0; i < static_cast<size_t>(nbThreads); ++i) {
-      unsigned int initial_seed = static_cast<unsigned int>(i);
-      if (i < static_cast<size_t>(nbThreads) - 1) {
-        ransacWorkers.emplace_back(cMo, ransacNbInlierConsensus, splitTrials, ransacThreshold, initial_seed,
-                                   checkDegeneratePoints, listOfUniquePoints, func);
-      }
-      else {
-        int maxTrialsRemainder = ransacMaxTrials - splitTrials * (nbThreads - 1);
-        ransacWorkers.emplace_back(cMo, ransacNbInlierConsensus, maxTrialsRemainder, ransacThreshold, initial_seed,
-                                   checkDegeneratePoints, listOfUniquePoints, func);
-      }
-    }
-
-    for (auto &worker : ransacWorkers) {
-      threadpool.emplace_back(&vpRansacFunctor::operator(), &worker);
-    }
-
-    for (auto &th : threadpool) {
-      th.join();
-    }
-
-    bool successRansac = false;
-    size_t best_consensus_size = 0;
-
-    for (auto &worker : ransacWorkers) {
-      if (worker.getResult()) {
-        successRansac = true;
-
-        if (worker.getBestConsensus().size() > best_consensus_size) {
-          nbInliers = worker.getNbInliers();
-          best_consensus = worker.getBestConsensus();
-          best_consensus_size = worker.getBestConsensus().size();
-        }
-      }
-    }
-
-    foundSolution = successRansac;
+    // The workers share the trials counter and the best consensus, each one has its own random generator
+    std::function<void(unsigned int)> job = [&](unsigned int i) {
+      vpRansacFunctor worker(listOfUniquePoints, points, ransacThreshold, i, checkDegeneratePoints, func,
+                             ransacMinimalSolver, useRansacLocalOptimization, state);
+      worker();
+      };
+    vpRansacWorkerPool::getInstance().run(nbThreads, job);
 #endif
   }
   else {
     // Sequential RANSAC
-    vpRansacFunctor sequentialRansac(cMo, ransacNbInlierConsensus, ransacMaxTrials, ransacThreshold, 0,
-                                     checkDegeneratePoints, listOfUniquePoints, func);
+    vpRansacFunctor sequentialRansac(listOfUniquePoints, points, ransacThreshold, 0, checkDegeneratePoints, func,
+                                     ransacMinimalSolver, useRansacLocalOptimization, state);
     sequentialRansac();
-    foundSolution = sequentialRansac.getResult();
+  }
 
-    if (foundSolution) {
-      nbInliers = sequentialRansac.getNbInliers();
-      best_consensus = sequentialRansac.getBestConsensus();
-    }
+  const bool foundSolution = state.nbInliers.load() > 0;
+  if (foundSolution) {
+    nbInliers = state.nbInliers.load();
+    best_consensus = state.bestConsensus;
   }
+
   if (foundSolution) {
     const unsigned int nbMinRandom = 4;
 
@@ -512,7 +688,14 @@ bool vpPose::poseRansac(vpHomogeneousMatrix &cMo, FuncCheckValidityPose func)
       }
 
       pose.setCovarianceComputation(computeCovariance);
-      pose.computePose(vpPose::DEMENTHON_LAGRANGE_VIRTUAL_VS, cMo);
+      if (useRansacLocalOptimization) {
+        // The locally optimized pose is already close to the solution
+        cMo = state.bestPose;
+        pose.computePose(vpPose::VIRTUAL_VS, cMo);
+      }
+      else {
+        pose.computePose(vpPose::DEMENTHON_LAGRANGE_VIRTUAL_VS, cMo);
+      }
 
       // In some rare cases, the final pose could not respect the pose
       // criterion even  if the 4 minimal points picked respect the pose
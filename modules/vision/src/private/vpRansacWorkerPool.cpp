@@ -0,0 +1,159 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Threads shared by the RANSAC estimators.
+ */
+
+#include "vpRansacWorkerPool.h"
+
+#if defined(VISP_HAVE_THREADS)
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
+
+BEGIN_VISP_NAMESPACE
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+//! Counter of the tasks of a call to vpRansacWorkerPool::run()
+class vpRansacWorkerPool::vpBatch
+{
+public:
+  explicit vpBatch(unsigned int nbTasks) : m_mutex(), m_cv(), m_remaining(nbTasks) { }
+
+  void done()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (--m_remaining == 0) {
+      m_cv.notify_all();
+    }
+  }
+  bool finished()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_remaining == 0;
+  }
+  void wait()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait(lock, [this]() { return m_remaining == 0; });
+  }
+
+private:
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  unsigned int m_remaining;
+};
+
+vpRansacWorkerPool &vpRansacWorkerPool::getInstance()
+{
+  // Never destroyed: the idle workers are detached and simply end with the process
+  static vpRansacWorkerPool *pool = new vpRansacWorkerPool();
+  return *pool;
+}
+
+vpRansacWorkerPool::vpRansacWorkerPool() : m_mutex(), m_cv(), m_tasks(), m_nbWorkers(0) { }
+
+void vpRansacWorkerPool::run(unsigned int nbJobs, const std::function<void(unsigned int)> &job)
+{
+  std::vector<std::exception_ptr> errors(nbJobs);
+  std::shared_ptr<vpBatch> batch = std::make_shared<vpBatch>(nbJobs - 1);
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    while (m_nbWorkers < nbJobs - 1) {
+      std::thread(&vpRansacWorkerPool::workerLoop, this).detach();
+      ++m_nbWorkers;
+    }
+    for (unsigned int i = 1; i < nbJobs; ++i) {
+      m_tasks.push_back([batch, &job, &errors, i]() {
+        try {
+          job(i);
+        }
+        catch (...) {
+          errors[i] = std::current_exception();
+        }
+        batch->done();
+        });
+    }
+  }
+  m_cv.notify_all();
+
+  try {
+    job(0);
+  }
+  catch (...) {
+    errors[0] = std::current_exception();
+  }
+  // Rather than waiting, help with the queued tasks. This also prevents dead locks for nested calls.
+  std::function<void()> task;
+  while (!batch->finished() && popTask(task)) {
+    task();
+  }
+  batch->wait();
+
+  for (unsigned int i = 0; i < nbJobs; ++i) {
+    if (errors[i]) {
+      std::rethrow_exception(errors[i]);
+    }
+  }
+}
+
+bool vpRansacWorkerPool::popTask(std::function<void()> &task)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_tasks.empty()) {
+    return false;
+  }
+  task = std::move(m_tasks.front());
+  m_tasks.pop_front();
+  return true;
+}
+
+void vpRansacWorkerPool::workerLoop()
+{
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_cv.wait(lock, [this]() { return !m_tasks.empty(); });
+      task = std::move(m_tasks.front());
+      m_tasks.pop_front();
+    }
+    task();
+  }
+}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+END_VISP_NAMESPACE
+
+#elif !defined(VISP_BUILD_SHARED_LIBS)
+// Work around to avoid warning: libvisp_vision.a(vpRansacWorkerPool.cpp.o) has no symbols
+void dummy_vpRansacWorkerPool() { }
+#endif
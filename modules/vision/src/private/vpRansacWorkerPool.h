@@ -0,0 +1,82 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Threads shared by the RANSAC estimators.
+ */
+
+#ifndef VP_RANSAC_WORKER_POOL_H
+#define VP_RANSAC_WORKER_POOL_H
+
+#include <visp3/core/vpConfig.h>
+
+#if defined(VISP_HAVE_THREADS)
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+BEGIN_VISP_NAMESPACE
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+/*!
+ * Threads shared by all the parallel RANSAC of the process (vpPose, vpHomography). They are created when first
+ * needed and then wait for work, avoiding to spawn threads each time a model is estimated.
+ */
+class vpRansacWorkerPool
+{
+public:
+  static vpRansacWorkerPool &getInstance();
+
+  /*!
+   * Run job(0), ..., job(nbJobs - 1) concurrently, job(0) being run by the calling thread.
+   * Return once all the jobs are done. If jobs raise exceptions, the one of the job with the lowest index is
+   * rethrown.
+   */
+  void run(unsigned int nbJobs, const std::function<void(unsigned int)> &job);
+
+private:
+  class vpBatch;
+
+  vpRansacWorkerPool();
+
+  bool popTask(std::function<void()> &task);
+  void workerLoop();
+
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::deque<std::function<void()> > m_tasks;
+  unsigned int m_nbWorkers;
+};
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+END_VISP_NAMESPACE
+
+#endif
+#endif
@@ -0,0 +1,241 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Test the homography estimation with RANSAC.
+ */
+
+/*!
+  \example catchHomographyRansac.cpp
+
+  Test the sequential, parallel and PROSAC homography estimation on synthetic matches with outliers.
+ */
+
+#include <visp3/core/vpConfig.h>
+
+#if defined(VISP_HAVE_CATCH2) && (defined(VISP_HAVE_LAPACK) || defined(VISP_HAVE_EIGEN3) || defined(VISP_HAVE_OPENCV))
+
+#if defined(VISP_BUILD_CATCH2)
+#include <catch_amalgamated.hpp>
+#else // Since v3.1.1
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <vector>
+
+#include <visp3/core/vpGaussRand.h>
+#include <visp3/core/vpHomogeneousMatrix.h>
+#include <visp3/core/vpPlane.h>
+#include <visp3/core/vpUniRand.h>
+#include <visp3/vision/vpHomography.h>
+
+#ifdef ENABLE_VISP_NAMESPACE
+using namespace VISP_NAMESPACE_NAME;
+#endif
+
+namespace
+{
+struct Matches
+{
+  std::vector<double> xb, yb, xa, ya, scores;
+  std::vector<bool> isInlier;
+};
+
+// Matches between two views of a plane, the outliers having a random position in image a and a lower score
+Matches generateMatches(const vpHomography &aHb, unsigned int nbMatches, double outlierRatio, double noise)
+{
+  vpUniRand rand(42);
+  vpGaussRand gauss(noise, 0.0, 4);
+  Matches m;
+  for (unsigned int i = 0; i < nbMatches; ++i) {
+    const double xb = rand.uniform(-0.4, 0.4), yb = rand.uniform(-0.3, 0.3);
+    const bool inlier = rand.uniform(0.0, 1.0) >= outlierRatio;
+    double xa, ya;
+    if (inlier) {
+      const double w = (aHb[2][0] * xb) + (aHb[2][1] * yb) + aHb[2][2];
+      xa = (((aHb[0][0] * xb) + (aHb[0][1] * yb) + aHb[0][2]) / w) + gauss();
+      ya = (((aHb[1][0] * xb) + (aHb[1][1] * yb) + aHb[1][2]) / w) + gauss();
+    }
+    else {
+      xa = rand.uniform(-0.5, 0.5);
+      ya = rand.uniform(-0.4, 0.4);
+    }
+    m.xb.push_back(xb);
+    m.yb.push_back(yb);
+    m.xa.push_back(xa);
+    m.ya.push_back(ya);
+    m.scores.push_back(inlier ? rand.uniform(0.3, 1.0) : rand.uniform(0.0, 0.7));
+    m.isInlier.push_back(inlier);
+  }
+  return m;
+}
+
+unsigned int countInliers(const std::vector<bool> &isInlier)
+{
+  unsigned int nb = 0;
+  for (size_t i = 0; i < isInlier.size(); ++i) {
+    nb += isInlier[i] ? 1 : 0;
+  }
+  return nb;
+}
+
+void checkResult(const Matches &m, const vpHomography &aHb_ref, const vpHomography &aHb,
+                 const std::vector<bool> &inliers, double residual, unsigned int nbInliersConsensus)
+{
+  for (unsigned int i = 0; i < 3; ++i) {
+    for (unsigned int j = 0; j < 3; ++j) {
+      CHECK(aHb[i][j] == Catch::Approx(aHb_ref[i][j]).margin(1e-2));
+    }
+  }
+  REQUIRE(inliers.size() == m.isInlier.size());
+  unsigned int nbFalseInliers = 0;
+  for (size_t i = 0; i < inliers.size(); ++i) {
+    nbFalseInliers += (inliers[i] && !m.isInlier[i]) ? 1 : 0;
+  }
+  // An outlier may fall by chance close to its true position
+  CHECK(nbFalseInliers <= 2);
+  // The RANSAC stops as soon as the consensus is reached
+  CHECK(countInliers(inliers) >= nbInliersConsensus);
+  CHECK(residual < 1e-3);
+}
+} // namespace
+
+TEST_CASE("Homography estimation with RANSAC", "[homography][ransac]")
+{
+  vpHomography aHb_ref;
+  vpHomography::build(aHb_ref, vpHomogeneousMatrix(0.1, -0.05, 0.05, vpMath::rad(5), vpMath::rad(-10), vpMath::rad(15)),
+                      vpPlane(0.1, -0.2, 1.0, -1.0));
+  aHb_ref /= aHb_ref[2][2];
+  const unsigned int nbMatches = 1000;
+  const Matches m = generateMatches(aHb_ref, nbMatches, 0.5, 1e-4);
+  const unsigned int nbInliersConsensus = (countInliers(m.isInlier) * 9) / 10;
+  const double threshold = 1e-3;
+
+  SECTION("Sequential RANSAC")
+  {
+    vpHomography aHb;
+    std::vector<bool> inliers;
+    double residual = 0;
+    REQUIRE(vpHomography::ransac(m.xb, m.yb, m.xa, m.ya, aHb, inliers, residual, nbInliersConsensus, threshold));
+    checkResult(m, aHb_ref, aHb, inliers, residual, nbInliersConsensus);
+  }
+
+  SECTION("Parallel RANSAC")
+  {
+    for (unsigned int nbThreads : { 2, 4, 0 }) {
+      vpHomography aHb;
+      std::vector<bool> inliers;
+      double residual = 0;
+      REQUIRE(vpHomography::ransac(m.xb, m.yb, m.xa, m.ya, aHb, inliers, residual, nbInliersConsensus, threshold,
+                                   true, 1000, true, nbThreads));
+      checkResult(m, aHb_ref, aHb, inliers, residual, nbInliersConsensus);
+    }
+  }
+
+  SECTION("PROSAC")
+  {
+    for (bool parallel : { false, true }) {
+      vpHomography aHb;
+      std::vector<bool> inliers;
+      double residual = 0;
+      REQUIRE(vpHomography::ransac(m.xb, m.yb, m.xa, m.ya, aHb, inliers, residual, nbInliersConsensus, threshold,
+                                   true, 1000, parallel, 0, m.scores));
+      checkResult(m, aHb_ref, aHb, inliers, residual, nbInliersConsensus);
+    }
+  }
+
+  SECTION("PROSAC with collinear best matches")
+  {
+    // The 4 best matches are collinear inliers: the first PROSAC sample is degenerate
+    Matches m_collinear = m;
+    for (unsigned int i = 0; i < 4; ++i) {
+      const double xb = -0.3 + (0.2 * i), yb = 0.1 - (0.05 * i);
+      const double w = (aHb_ref[2][0] * xb) + (aHb_ref[2][1] * yb) + aHb_ref[2][2];
+      m_collinear.xb[i] = xb;
+      m_collinear.yb[i] = yb;
+      m_collinear.xa[i] = ((aHb_ref[0][0] * xb) + (aHb_ref[0][1] * yb) + aHb_ref[0][2]) / w;
+      m_collinear.ya[i] = ((aHb_ref[1][0] * xb) + (aHb_ref[1][1] * yb) + aHb_ref[1][2]) / w;
+      m_collinear.scores[i] = 2.0;
+      m_collinear.isInlier[i] = true;
+    }
+    const unsigned int nbInliersConsensusCollinear = (countInliers(m_collinear.isInlier) * 9) / 10;
+    for (bool parallel : { false, true }) {
+      vpHomography aHb;
+      std::vector<bool> inliers;
+      double residual = 0;
+      REQUIRE(vpHomography::ransac(m_collinear.xb, m_collinear.yb, m_collinear.xa, m_collinear.ya, aHb, inliers,
+                                   residual, nbInliersConsensusCollinear, threshold, true, 1000, parallel, 0,
+                                   m_collinear.scores));
+      checkResult(m_collinear, aHb_ref, aHb, inliers, residual, nbInliersConsensusCollinear);
+    }
+  }
+
+  SECTION("Consensus cannot be reached")
+  {
+    vpHomography aHb;
+    std::vector<bool> inliers;
+    double residual = 0;
+    CHECK_FALSE(vpHomography::ransac(m.xb, m.yb, m.xa, m.ya, aHb, inliers, residual, nbMatches, threshold, true, 50));
+  }
+
+  SECTION("Invalid inputs")
+  {
+    vpHomography aHb;
+    std::vector<bool> inliers;
+    double residual = 0;
+    const std::vector<double> x3(3, 0.0);
+    CHECK_THROWS_AS(vpHomography::ransac(x3, x3, x3, x3, aHb, inliers, residual, 3, threshold), vpException);
+    const std::vector<double> badScores(10, 1.0);
+    CHECK_THROWS_AS(vpHomography::ransac(m.xb, m.yb, m.xa, m.ya, aHb, inliers, residual, nbInliersConsensus,
+                                         threshold, true, 1000, false, 0, badScores),
+                    vpException);
+    // All the points are collinear
+    std::vector<double> x(10), y(10);
+    for (unsigned int i = 0; i < 10; ++i) {
+      x[i] = 0.1 * i;
+      y[i] = 0.05 * i;
+    }
+    CHECK_THROWS_AS(vpHomography::ransac(x, y, x, y, aHb, inliers, residual, 10, threshold), vpException);
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  Catch::Session session;
+  session.applyCommandLine(argc, argv);
+
+  int numFailed = session.run();
+
+  return numFailed;
+}
+#else
+#include <iostream>
+
+int main() { return EXIT_SUCCESS; }
+#endif
@@ -0,0 +1,168 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Benchmark the homography estimation with RANSAC.
+ */
+
+/*!
+  \example perfHomographyRansac.cpp
+
+  Compare the execution times of the sequential, parallel and PROSAC homography estimation.
+ */
+
+#include <visp3/core/vpConfig.h>
+
+#if defined(VISP_HAVE_CATCH2) && (defined(VISP_HAVE_LAPACK) || defined(VISP_HAVE_EIGEN3) || defined(VISP_HAVE_OPENCV))
+
+#if defined(VISP_BUILD_CATCH2)
+#include <catch_amalgamated.hpp>
+#else // Since v3.1.1
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <vector>
+
+#include <visp3/core/vpGaussRand.h>
+#include <visp3/core/vpHomogeneousMatrix.h>
+#include <visp3/core/vpPlane.h>
+#include <visp3/core/vpUniRand.h>
+#include <visp3/vision/vpHomography.h>
+
+#ifdef ENABLE_VISP_NAMESPACE
+using namespace VISP_NAMESPACE_NAME;
+#endif
+
+namespace
+{
+bool g_runBenchmark = false;
+
+struct Matches
+{
+  std::vector<double> xb, yb, xa, ya, scores;
+  std::vector<bool> isInlier;
+};
+
+// Matches between two views of a plane, the outliers having a random position in image a and a lower score
+Matches generateMatches(const vpHomography &aHb, unsigned int nbMatches, double outlierRatio, double noise)
+{
+  vpUniRand rand(42);
+  vpGaussRand gauss(noise, 0.0, 4);
+  Matches m;
+  for (unsigned int i = 0; i < nbMatches; ++i) {
+    const double xb = rand.uniform(-0.4, 0.4), yb = rand.uniform(-0.3, 0.3);
+    const bool inlier = rand.uniform(0.0, 1.0) >= outlierRatio;
+    double xa, ya;
+    if (inlier) {
+      const double w = (aHb[2][0] * xb) + (aHb[2][1] * yb) + aHb[2][2];
+      xa = (((aHb[0][0] * xb) + (aHb[0][1] * yb) + aHb[0][2]) / w) + gauss();
+      ya = (((aHb[1][0] * xb) + (aHb[1][1] * yb) + aHb[1][2]) / w) + gauss();
+    }
+    else {
+      xa = rand.uniform(-0.5, 0.5);
+      ya = rand.uniform(-0.4, 0.4);
+    }
+    m.xb.push_back(xb);
+    m.yb.push_back(yb);
+    m.xa.push_back(xa);
+    m.ya.push_back(ya);
+    m.scores.push_back(inlier ? rand.uniform(0.3, 1.0) : rand.uniform(0.0, 0.7));
+    m.isInlier.push_back(inlier);
+  }
+  return m;
+}
+
+unsigned int countInliers(const std::vector<bool> &isInlier)
+{
+  unsigned int nb = 0;
+  for (size_t i = 0; i < isInlier.size(); ++i) {
+    nb += isInlier[i] ? 1 : 0;
+  }
+  return nb;
+}
+} // namespace
+
+TEST_CASE("Benchmark homography estimation with RANSAC", "[benchmark]")
+{
+  if (g_runBenchmark) {
+    vpHomography aHb_ref;
+    vpHomography::build(aHb_ref,
+                        vpHomogeneousMatrix(0.1, -0.05, 0.05, vpMath::rad(5), vpMath::rad(-10), vpMath::rad(15)),
+                        vpPlane(0.1, -0.2, 1.0, -1.0));
+    const unsigned int nbMatches = 5000;
+    const Matches m = generateMatches(aHb_ref, nbMatches, 0.7, 1e-4);
+    // Consensus cannot be reached: all the trials are run
+    const unsigned int nbInliersConsensus = nbMatches;
+    const double threshold = 1e-3;
+    vpHomography aHb;
+    std::vector<bool> inliers;
+    double residual = 0;
+
+    BENCHMARK("Sequential RANSAC")
+    {
+      return vpHomography::ransac(m.xb, m.yb, m.xa, m.ya, aHb, inliers, residual, nbInliersConsensus, threshold);
+    };
+    BENCHMARK("Parallel RANSAC")
+    {
+      return vpHomography::ransac(m.xb, m.yb, m.xa, m.ya, aHb, inliers, residual, nbInliersConsensus, threshold,
+                                  true, 1000, true);
+    };
+    // Early termination when 90% of the inliers are found
+    const unsigned int nbInliersConsensusReachable = (countInliers(m.isInlier) * 9) / 10;
+    BENCHMARK("Sequential RANSAC, reachable consensus")
+    {
+      return vpHomography::ransac(m.xb, m.yb, m.xa, m.ya, aHb, inliers, residual, nbInliersConsensusReachable,
+                                  threshold, true, 100000);
+    };
+    BENCHMARK("PROSAC, reachable consensus")
+    {
+      return vpHomography::ransac(m.xb, m.yb, m.xa, m.ya, aHb, inliers, residual, nbInliersConsensusReachable,
+                                  threshold, true, 100000, false, 0, m.scores);
+    };
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  Catch::Session session;
+  auto cli = session.cli()
+    | Catch::Clara::Opt(g_runBenchmark)["--benchmark"]("run benchmark?");
+
+  session.cli(cli);
+  session.applyCommandLine(argc, argv);
+
+  int numFailed = session.run();
+
+  return numFailed;
+}
+#else
+#include <iostream>
+
+int main() { return EXIT_SUCCESS; }
+#endif
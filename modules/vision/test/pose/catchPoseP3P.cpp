@@ -0,0 +1,177 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Test the P3P pose estimation.
+ */
+
+/*!
+  \example catchPoseP3P.cpp
+
+  Test the closed-form pose estimation from three points on random synthetic configurations.
+ */
+
+#include <visp3/core/vpConfig.h>
+
+#if defined(VISP_HAVE_CATCH2) && (defined(VISP_HAVE_LAPACK) || defined(VISP_HAVE_EIGEN3) || defined(VISP_HAVE_OPENCV))
+
+#if defined(VISP_BUILD_CATCH2)
+#include <catch_amalgamated.hpp>
+#else // Since v3.1.1
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <cmath>
+#include <vector>
+
+#include <visp3/core/vpHomogeneousMatrix.h>
+#include <visp3/core/vpPoint.h>
+#include <visp3/core/vpUniRand.h>
+#include <visp3/vision/vpPose.h>
+
+#ifdef ENABLE_VISP_NAMESPACE
+using namespace VISP_NAMESPACE_NAME;
+#endif
+
+namespace
+{
+// Random pose and random points in front of the camera
+void generateScene(vpUniRand &rand, unsigned int nbPoints, vpHomogeneousMatrix &cMo, std::vector<vpPoint> &points)
+{
+  cMo.buildFrom(rand.uniform(-0.1, 0.1), rand.uniform(-0.1, 0.1), rand.uniform(0.5, 1.5),
+                rand.uniform(-M_PI, M_PI), rand.uniform(-M_PI / 2, M_PI / 2), rand.uniform(-M_PI, M_PI));
+  points.clear();
+  for (unsigned int i = 0; i < nbPoints; ++i) {
+    vpPoint pt(rand.uniform(-0.2, 0.2), rand.uniform(-0.2, 0.2), rand.uniform(-0.2, 0.2));
+    pt.project(cMo);
+    points.push_back(pt);
+  }
+}
+
+bool samePose(const vpHomogeneousMatrix &cMo, const vpHomogeneousMatrix &cMo_ref, double tolerance)
+{
+  const vpPoseVector p(cMo), p_ref(cMo_ref);
+  for (unsigned int i = 0; i < 6; ++i) {
+    if (std::fabs(p[i] - p_ref[i]) > tolerance) {
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
+TEST_CASE("P3P pose estimation", "[pose][p3p]")
+{
+  vpUniRand rand(7);
+  vpHomogeneousMatrix cMo_ref;
+  std::vector<vpPoint> points;
+
+  SECTION("The true pose is one of the solutions")
+  {
+    const unsigned int nbTests = 500;
+    unsigned int nbFound = 0;
+    std::vector<vpHomogeneousMatrix> cMo_solutions;
+    for (unsigned int t = 0; t < nbTests; ++t) {
+      generateScene(rand, 3, cMo_ref, points);
+      const unsigned int nbSolutions = vpPose::computeP3P(points[0], points[1], points[2], cMo_solutions);
+      REQUIRE(nbSolutions <= 4);
+      REQUIRE(nbSolutions == cMo_solutions.size());
+      bool found = false;
+      for (unsigned int i = 0; i < nbSolutions; ++i) {
+        // All the solutions reproject the three points exactly
+        vpPose pose(points);
+        CHECK(pose.computeResidual(cMo_solutions[i]) < 1e-12);
+        found = found || samePose(cMo_solutions[i], cMo_ref, 1e-6);
+      }
+      nbFound += found ? 1 : 0;
+    }
+    // Near degenerate configurations may be missed
+    CHECK(nbFound >= nbTests - 5);
+  }
+
+  SECTION("The other points disambiguate the solutions")
+  {
+    for (unsigned int t = 0; t < 100; ++t) {
+      generateScene(rand, 6, cMo_ref, points);
+      vpPose pose(points);
+      vpHomogeneousMatrix cMo;
+      if (pose.computePose(vpPose::P3P, cMo)) {
+        CHECK(samePose(cMo, cMo_ref, 1e-6));
+      }
+    }
+  }
+
+  SECTION("Degenerate configurations")
+  {
+    vpPose pose;
+    pose.addPoint(vpPoint(0.0, 0.0, 0.0));
+    pose.addPoint(vpPoint(0.1, 0.0, 0.0));
+    vpHomogeneousMatrix cMo;
+    CHECK_THROWS_AS(pose.computePose(vpPose::P3P, cMo), vpException);
+
+    // Collinear points
+    cMo_ref.buildFrom(0.0, 0.0, 1.0, 0.1, 0.2, 0.3);
+    points.clear();
+    for (unsigned int i = 0; i < 3; ++i) {
+      vpPoint pt(0.1 * i, 0.05 * i, 0.0);
+      pt.project(cMo_ref);
+      points.push_back(pt);
+    }
+    std::vector<vpHomogeneousMatrix> cMo_solutions;
+    CHECK(vpPose::computeP3P(points[0], points[1], points[2], cMo_solutions) == 0);
+    pose.clearPoint();
+    pose.addPoints(points);
+    CHECK_FALSE(pose.computePose(vpPose::P3P, cMo));
+  }
+
+  SECTION("RANSAC minimal solver setting")
+  {
+    vpPose pose;
+    CHECK(pose.getRansacMinimalSolver() == vpPose::DEMENTHON_LAGRANGE_VIRTUAL_VS);
+    pose.setRansacMinimalSolver(vpPose::P3P);
+    CHECK(pose.getRansacMinimalSolver() == vpPose::P3P);
+    CHECK_THROWS_AS(pose.setRansacMinimalSolver(vpPose::RANSAC), vpException);
+  }
+
+}
+
+int main(int argc, char *argv[])
+{
+  Catch::Session session;
+  session.applyCommandLine(argc, argv);
+
+  int numFailed = session.run();
+
+  return numFailed;
+}
+#else
+#include <iostream>
+
+int main() { return EXIT_SUCCESS; }
+#endif
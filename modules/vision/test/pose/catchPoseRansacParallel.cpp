@@ -0,0 +1,287 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Test the sequential and parallel RANSAC pose estimation.
+ */
+
+/*!
+  \example catchPoseRansacParallel.cpp
+
+  Test the sequential and parallel RANSAC pose estimation on synthetic data with outliers.
+ */
+
+#include <visp3/core/vpConfig.h>
+
+#if defined(VISP_HAVE_CATCH2) && (defined(VISP_HAVE_LAPACK) || defined(VISP_HAVE_EIGEN3) || defined(VISP_HAVE_OPENCV))
+
+#if defined(VISP_BUILD_CATCH2)
+#include <catch_amalgamated.hpp>
+#else // Since v3.1.1
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <algorithm>
+#include <vector>
+
+#include <visp3/core/vpGaussRand.h>
+#include <visp3/core/vpHomogeneousMatrix.h>
+#include <visp3/core/vpPoint.h>
+#include <visp3/core/vpUniRand.h>
+#include <visp3/vision/vpPose.h>
+
+#if defined(VISP_HAVE_THREADS)
+#include <thread>
+#endif
+
+#ifdef ENABLE_VISP_NAMESPACE
+using namespace VISP_NAMESPACE_NAME;
+#endif
+
+namespace
+{
+// Points spread in a box in front of the camera, the first nbOutliers ones having a random image position
+std::vector<vpPoint> generatePoints(const vpHomogeneousMatrix &cMo, unsigned int nbPoints, unsigned int nbOutliers,
+                                   double noise)
+{
+  vpUniRand rand(42);
+  vpGaussRand gauss(noise, 0.0, 4);
+  std::vector<vpPoint> points;
+  for (unsigned int i = 0; i < nbPoints; ++i) {
+    vpPoint pt(rand.uniform(-0.2, 0.2), rand.uniform(-0.2, 0.2), rand.uniform(-0.1, 0.1));
+    pt.project(cMo);
+    if (i < nbOutliers) {
+      pt.set_x(rand.uniform(-0.4, 0.4));
+      pt.set_y(rand.uniform(-0.4, 0.4));
+    }
+    else {
+      pt.set_x(pt.get_x() + gauss());
+      pt.set_y(pt.get_y() + gauss());
+    }
+    points.push_back(pt);
+  }
+  return points;
+}
+
+void setupPose(vpPose &pose, const std::vector<vpPoint> &points, unsigned int nbInlierToReachConsensus)
+{
+  pose.clearPoint();
+  pose.addPoints(points);
+  pose.setRansacNbInliersToReachConsensus(nbInlierToReachConsensus);
+  pose.setRansacThreshold(0.002);
+  pose.setRansacMaxTrials(300);
+}
+
+void checkPose(const vpHomogeneousMatrix &cMo, const vpHomogeneousMatrix &cMo_ref)
+{
+  const vpPoseVector p(cMo), p_ref(cMo_ref);
+  for (unsigned int i = 0; i < 3; ++i) {
+    CHECK(p[i] == Catch::Approx(p_ref[i]).margin(5e-3));
+    CHECK(p[i + 3] == Catch::Approx(p_ref[i + 3]).margin(1e-2));
+  }
+}
+
+void checkInliers(const vpPose &pose, unsigned int nbOutliers, unsigned int minNbInliers)
+{
+  const std::vector<unsigned int> inlierIndex = pose.getRansacInlierIndex();
+  CHECK(inlierIndex.size() >= minNbInliers);
+  for (unsigned int idx : inlierIndex) {
+    CHECK(idx >= nbOutliers);
+  }
+}
+} // namespace
+
+TEST_CASE("RANSAC pose estimation with outliers", "[pose][ransac]")
+{
+  const vpHomogeneousMatrix cMo_ref(0.05, -0.02, 0.8, vpMath::rad(10), vpMath::rad(-20), vpMath::rad(30));
+  const unsigned int nbPoints = 300, nbOutliers = 120;
+  const std::vector<vpPoint> points = generatePoints(cMo_ref, nbPoints, nbOutliers, 1e-4);
+  // Consensus cannot be reached: all the trials are run
+  const unsigned int unreachableConsensus = nbPoints;
+
+  SECTION("Sequential RANSAC")
+  {
+    vpPose pose;
+    setupPose(pose, points, unreachableConsensus);
+    pose.setUseParallelRansac(false);
+    vpHomogeneousMatrix cMo;
+    REQUIRE(pose.computePose(vpPose::RANSAC, cMo));
+    checkPose(cMo, cMo_ref);
+    checkInliers(pose, nbOutliers, 170);
+  }
+
+  SECTION("Parallel RANSAC gives the same consensus as the sequential one")
+  {
+    vpPose pose;
+    setupPose(pose, points, unreachableConsensus);
+    pose.setUseParallelRansac(false);
+    vpHomogeneousMatrix cMo_seq;
+    REQUIRE(pose.computePose(vpPose::RANSAC, cMo_seq));
+    const unsigned int nbInliersSeq = pose.getRansacNbInliers();
+
+    for (int nbThreads : { 2, 4, 0 }) {
+      vpPose posePar;
+      setupPose(posePar, points, unreachableConsensus);
+      posePar.setUseParallelRansac(true);
+      posePar.setNbParallelRansacThreads(nbThreads);
+      vpHomogeneousMatrix cMo;
+      REQUIRE(posePar.computePose(vpPose::RANSAC, cMo));
+      checkPose(cMo, cMo_ref);
+      checkInliers(posePar, nbOutliers, 170);
+      // Inliers are almost all found by both versions
+      CHECK(posePar.getRansacNbInliers() + 5 >= nbInliersSeq);
+    }
+  }
+
+  SECTION("Adaptive termination")
+  {
+    for (bool parallel : { false, true }) {
+      vpPose pose;
+      setupPose(pose, points, unreachableConsensus);
+      pose.setUseParallelRansac(parallel);
+      pose.setUseRansacAdaptiveTermination(true);
+      REQUIRE(pose.getUseRansacAdaptiveTermination());
+      vpHomogeneousMatrix cMo;
+      REQUIRE(pose.computePose(vpPose::RANSAC, cMo));
+      checkPose(cMo, cMo_ref);
+      checkInliers(pose, nbOutliers, 170);
+    }
+    vpPose pose;
+    CHECK(pose.getRansacProbability() == Catch::Approx(0.99));
+    CHECK_THROWS_AS(pose.setRansacProbability(0.0), vpException);
+    CHECK_THROWS_AS(pose.setRansacProbability(1.5), vpException);
+  }
+
+  SECTION("Consensus reached")
+  {
+    for (bool parallel : { false, true }) {
+      vpPose pose;
+      setupPose(pose, points, 150);
+      pose.setUseParallelRansac(parallel);
+      vpHomogeneousMatrix cMo;
+      REQUIRE(pose.computePose(vpPose::RANSAC, cMo));
+      checkPose(cMo, cMo_ref);
+      checkInliers(pose, nbOutliers, 150);
+    }
+  }
+
+  SECTION("Degenerate points check")
+  {
+    std::vector<vpPoint> duplicatedPoints = points;
+    duplicatedPoints.insert(duplicatedPoints.end(), points.begin() + nbOutliers, points.end());
+    for (bool parallel : { false, true }) {
+      vpPose pose;
+      setupPose(pose, duplicatedPoints, unreachableConsensus);
+      pose.setRansacFilterFlag(vpPose::CHECK_DEGENERATE_POINTS);
+      pose.setUseParallelRansac(parallel);
+      vpHomogeneousMatrix cMo;
+      REQUIRE(pose.computePose(vpPose::RANSAC, cMo));
+      checkPose(cMo, cMo_ref);
+      // Duplicated points are not counted twice
+      CHECK(pose.getRansacNbInliers() <= nbPoints - nbOutliers);
+    }
+  }
+
+  SECTION("P3P minimal solver and local optimization")
+  {
+    for (vpPose::vpPoseMethodType solver : { vpPose::DEMENTHON_LAGRANGE_VIRTUAL_VS, vpPose::P3P }) {
+      for (bool localOptimization : { false, true }) {
+        for (bool parallel : { false, true }) {
+          vpPose pose;
+          setupPose(pose, points, unreachableConsensus);
+          pose.setRansacMinimalSolver(solver);
+          pose.setUseRansacLocalOptimization(localOptimization);
+          REQUIRE(pose.getUseRansacLocalOptimization() == localOptimization);
+          pose.setUseParallelRansac(parallel);
+          vpHomogeneousMatrix cMo;
+          REQUIRE(pose.computePose(vpPose::RANSAC, cMo));
+          checkPose(cMo, cMo_ref);
+          checkInliers(pose, nbOutliers, 170);
+        }
+      }
+    }
+  }
+
+#if defined(VISP_HAVE_THREADS)
+  SECTION("Parallel RANSAC called from several threads")
+  {
+    const unsigned int nbCallers = 4;
+    std::vector<vpHomogeneousMatrix> poses(nbCallers);
+    std::vector<unsigned char> success(nbCallers, 0);
+    std::vector<std::thread> callers;
+    for (unsigned int i = 0; i < nbCallers; ++i) {
+      callers.emplace_back([&, i]() {
+        for (unsigned int k = 0; k < 2; ++k) {
+          vpPose pose;
+          setupPose(pose, points, unreachableConsensus);
+          pose.setUseParallelRansac(true);
+          pose.setNbParallelRansacThreads(3);
+          success[i] = pose.computePose(vpPose::RANSAC, poses[i]) ? 1 : 0;
+        }
+        });
+    }
+    for (std::thread &caller : callers) {
+      caller.join();
+    }
+    for (unsigned int i = 0; i < nbCallers; ++i) {
+      REQUIRE(success[i] == 1);
+      checkPose(poses[i], cMo_ref);
+    }
+  }
+#endif
+
+  SECTION("An exception in the pose check function is forwarded")
+  {
+    for (bool parallel : { false, true }) {
+      vpPose pose;
+      setupPose(pose, points, unreachableConsensus);
+      pose.setUseParallelRansac(parallel);
+      vpHomogeneousMatrix cMo;
+      CHECK_THROWS_AS(pose.computePose(vpPose::RANSAC, cMo, [](const vpHomogeneousMatrix &) -> bool {
+        throw vpException(vpException::fatalError, "Pose check failure");
+        }), vpException);
+    }
+  }
+
+}
+
+int main(int argc, char *argv[])
+{
+  Catch::Session session;
+  session.applyCommandLine(argc, argv);
+
+  int numFailed = session.run();
+
+  return numFailed;
+}
+#else
+#include <iostream>
+
+int main() { return EXIT_SUCCESS; }
+#endif
@@ -0,0 +1,123 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Benchmark the P3P pose estimation.
+ */
+
+/*!
+  \example perfPoseP3P.cpp
+
+  Compare the execution time of the pose estimation from three points with the one of the four points methods.
+ */
+
+#include <visp3/core/vpConfig.h>
+
+#if defined(VISP_HAVE_CATCH2) && (defined(VISP_HAVE_LAPACK) || defined(VISP_HAVE_EIGEN3) || defined(VISP_HAVE_OPENCV))
+
+#if defined(VISP_BUILD_CATCH2)
+#include <catch_amalgamated.hpp>
+#else // Since v3.1.1
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <cmath>
+#include <vector>
+
+#include <visp3/core/vpHomogeneousMatrix.h>
+#include <visp3/core/vpPoint.h>
+#include <visp3/core/vpUniRand.h>
+#include <visp3/vision/vpPose.h>
+
+#ifdef ENABLE_VISP_NAMESPACE
+using namespace VISP_NAMESPACE_NAME;
+#endif
+
+namespace
+{
+bool g_runBenchmark = false;
+
+// Random pose and random points in front of the camera
+void generateScene(vpUniRand &rand, unsigned int nbPoints, vpHomogeneousMatrix &cMo, std::vector<vpPoint> &points)
+{
+  cMo.buildFrom(rand.uniform(-0.1, 0.1), rand.uniform(-0.1, 0.1), rand.uniform(0.5, 1.5),
+                rand.uniform(-M_PI, M_PI), rand.uniform(-M_PI / 2, M_PI / 2), rand.uniform(-M_PI, M_PI));
+  points.clear();
+  for (unsigned int i = 0; i < nbPoints; ++i) {
+    vpPoint pt(rand.uniform(-0.2, 0.2), rand.uniform(-0.2, 0.2), rand.uniform(-0.2, 0.2));
+    pt.project(cMo);
+    points.push_back(pt);
+  }
+}
+} // namespace
+
+TEST_CASE("Benchmark P3P pose estimation", "[benchmark]")
+{
+  if (g_runBenchmark) {
+    vpUniRand rand(7);
+    vpHomogeneousMatrix cMo_ref;
+    std::vector<vpPoint> points;
+    generateScene(rand, 4, cMo_ref, points);
+    std::vector<vpHomogeneousMatrix> cMo_solutions;
+    BENCHMARK("P3P")
+    {
+      return vpPose::computeP3P(points[0], points[1], points[2], cMo_solutions);
+    };
+    vpPose pose(points);
+    BENCHMARK("P3P disambiguated with a fourth point")
+    {
+      vpHomogeneousMatrix cMo;
+      return pose.computePose(vpPose::P3P, cMo);
+    };
+    BENCHMARK("Dementhon Lagrange VVS with four points")
+    {
+      vpHomogeneousMatrix cMo;
+      return pose.computePose(vpPose::DEMENTHON_LAGRANGE_VIRTUAL_VS, cMo);
+    };
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  Catch::Session session;
+  auto cli = session.cli()
+    | Catch::Clara::Opt(g_runBenchmark)["--benchmark"]("run benchmark?");
+
+  session.cli(cli);
+  session.applyCommandLine(argc, argv);
+
+  int numFailed = session.run();
+
+  return numFailed;
+}
+#else
+#include <iostream>
+
+int main() { return EXIT_SUCCESS; }
+#endif
@@ -0,0 +1,172 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Benchmark the sequential and parallel RANSAC pose estimation.
+ */
+
+/*!
+  \example perfPoseRansacParallel.cpp
+
+  Compare the execution times of the sequential and parallel RANSAC pose estimation.
+ */
+
+#include <visp3/core/vpConfig.h>
+
+#if defined(VISP_HAVE_CATCH2) && (defined(VISP_HAVE_LAPACK) || defined(VISP_HAVE_EIGEN3) || defined(VISP_HAVE_OPENCV))
+
+#if defined(VISP_BUILD_CATCH2)
+#include <catch_amalgamated.hpp>
+#else // Since v3.1.1
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <vector>
+
+#include <visp3/core/vpGaussRand.h>
+#include <visp3/core/vpHomogeneousMatrix.h>
+#include <visp3/core/vpPoint.h>
+#include <visp3/core/vpUniRand.h>
+#include <visp3/vision/vpPose.h>
+
+#ifdef ENABLE_VISP_NAMESPACE
+using namespace VISP_NAMESPACE_NAME;
+#endif
+
+namespace
+{
+bool g_runBenchmark = false;
+
+// Points spread in a box in front of the camera, the first nbOutliers ones having a random image position
+std::vector<vpPoint> generatePoints(const vpHomogeneousMatrix &cMo, unsigned int nbPoints, unsigned int nbOutliers,
+                                   double noise)
+{
+  vpUniRand rand(42);
+  vpGaussRand gauss(noise, 0.0, 4);
+  std::vector<vpPoint> points;
+  for (unsigned int i = 0; i < nbPoints; ++i) {
+    vpPoint pt(rand.uniform(-0.2, 0.2), rand.uniform(-0.2, 0.2), rand.uniform(-0.1, 0.1));
+    pt.project(cMo);
+    if (i < nbOutliers) {
+      pt.set_x(rand.uniform(-0.4, 0.4));
+      pt.set_y(rand.uniform(-0.4, 0.4));
+    }
+    else {
+      pt.set_x(pt.get_x() + gauss());
+      pt.set_y(pt.get_y() + gauss());
+    }
+    points.push_back(pt);
+  }
+  return points;
+}
+
+void setupPose(vpPose &pose, const std::vector<vpPoint> &points, unsigned int nbInlierToReachConsensus)
+{
+  pose.clearPoint();
+  pose.addPoints(points);
+  pose.setRansacNbInliersToReachConsensus(nbInlierToReachConsensus);
+  pose.setRansacThreshold(0.002);
+  pose.setRansacMaxTrials(300);
+}
+} // namespace
+
+TEST_CASE("Benchmark RANSAC pose estimation", "[benchmark]")
+{
+  if (g_runBenchmark) {
+    const vpHomogeneousMatrix cMo_ref(0.05, -0.02, 0.8, vpMath::rad(10), vpMath::rad(-20), vpMath::rad(30));
+    const unsigned int nbPoints = 300, nbOutliers = 120;
+    const std::vector<vpPoint> points = generatePoints(cMo_ref, nbPoints, nbOutliers, 1e-4);
+    const unsigned int unreachableConsensus = nbPoints;
+    vpPose pose;
+    setupPose(pose, points, unreachableConsensus);
+    BENCHMARK("Sequential RANSAC")
+    {
+      vpHomogeneousMatrix cMo;
+      pose.setUseParallelRansac(false);
+      pose.setUseRansacAdaptiveTermination(false);
+      return pose.computePose(vpPose::RANSAC, cMo);
+    };
+    BENCHMARK("Parallel RANSAC")
+    {
+      vpHomogeneousMatrix cMo;
+      pose.setUseParallelRansac(true);
+      pose.setUseRansacAdaptiveTermination(false);
+      return pose.computePose(vpPose::RANSAC, cMo);
+    };
+    BENCHMARK("Parallel RANSAC with adaptive termination")
+    {
+      vpHomogeneousMatrix cMo;
+      pose.setUseParallelRansac(true);
+      pose.setUseRansacAdaptiveTermination(true);
+      return pose.computePose(vpPose::RANSAC, cMo);
+    };
+
+    pose.setUseParallelRansac(false);
+    pose.setUseRansacAdaptiveTermination(false);
+    pose.setRansacMinimalSolver(vpPose::P3P);
+    BENCHMARK("Sequential RANSAC with P3P")
+    {
+      vpHomogeneousMatrix cMo;
+      pose.setUseRansacLocalOptimization(false);
+      return pose.computePose(vpPose::RANSAC, cMo);
+    };
+    BENCHMARK("Sequential RANSAC with P3P and local optimization")
+    {
+      vpHomogeneousMatrix cMo;
+      pose.setUseRansacLocalOptimization(true);
+      return pose.computePose(vpPose::RANSAC, cMo);
+    };
+    pose.setUseRansacAdaptiveTermination(true);
+    BENCHMARK("Sequential RANSAC with P3P, local optimization and adaptive termination")
+    {
+      vpHomogeneousMatrix cMo;
+      pose.setUseRansacLocalOptimization(true);
+      return pose.computePose(vpPose::RANSAC, cMo);
+    };
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  Catch::Session session;
+  auto cli = session.cli()
+    | Catch::Clara::Opt(g_runBenchmark)["--benchmark"]("run benchmark?");
+
+  session.cli(cli);
+  session.applyCommandLine(argc, argv);
+
+  int numFailed = session.run();
+
+  return numFailed;
+}
+#else
+#include <iostream>
+
+int main() { return EXIT_SUCCESS; }
+#endif
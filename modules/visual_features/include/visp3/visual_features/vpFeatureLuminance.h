@@ -70,6 +70,11 @@ public:
  * \brief Class that defines the image luminance visual feature
  *
  * For more details see \cite Collewet08c.
+ *
+ * Since the feature has one component per pixel, the interaction matrix \f$ {\bf L} \f$ returned by interaction() can
+ * be very large. When only the normal equations \f$ {\bf L}^\top {\bf L} \f$ and \f$ {\bf L}^\top {\bf e} \f$ are
+ * needed, for instance to compute a Gauss-Newton or Levenberg-Marquardt control law, computeNormalEquations() builds them
+ * directly from the image in a single pass, without storing \f$ {\bf L} \f$.
  */
 class VISP_EXPORT vpFeatureLuminance : public vpBasicFeature
 {
@@ -98,6 +103,9 @@ public:
 
   vpFeatureLuminance &buildFrom(vpImage<unsigned char> &I);
 
+  void computeNormalEquations(const vpImage<unsigned char> &I, const vpFeatureLuminance &s_star, vpMatrix &LTL,
+                              vpColVector &LTe);
+
   void display(const vpCameraParameters &cam, const vpImage<unsigned char> &I, const vpColor &color = vpColor::green,
                unsigned int thickness = 1) const VP_OVERRIDE;
   void display(const vpCameraParameters &cam, const vpImage<vpRGBa> &I, const vpColor &color = vpColor::green,
@@ -127,6 +135,9 @@ public:
 
   static const unsigned int DEFAULT_BORDER;
 
+protected:
+  void initPixelCoordinates();
+
 public:
   vpCameraParameters cam;
 };
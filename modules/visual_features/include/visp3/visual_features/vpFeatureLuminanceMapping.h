@@ -283,6 +283,7 @@ private:
  *
  * Computes the Discrete Cosine Transform (DCT) representation of the image.
  * Only the K first components are preserved and stored into a vector when calling map. These components correspond to the lowest frequencies of the input image.
+ * Only the top left block of the DCT that contains these components is computed, by restricting the separable DCT to the needed frequencies.
  */
 class VISP_EXPORT vpLuminanceDCT : public vpLuminanceMapping
 {
@@ -321,6 +322,37 @@ public:
      */
     void setValues(const vpColVector &s, unsigned int start, vpMatrix &m) const;
 
+    /**
+     * \brief Compute the size of the smallest top left block of the matrix that contains the first values of the
+     * zigzag indexing
+     *
+     * @param end The number of values (exclusive end index)
+     * @param rows The number of rows of the block
+     * @param cols The number of cols of the block
+     */
+    void getBlockSize(unsigned int end, unsigned int &rows, unsigned int &cols) const;
+
+    /**
+     * \brief Same as getValues(), but the values are read from the top left block of the matrix, which should at
+     * least have the size given by getBlockSize(end)
+     *
+     * @param block The top left block of the matrix
+     * @param start The first value. Use 0 to start with the matrix's top left value
+     * @param end The last value to store in the vector. (exclusive)
+     * @param s The vector in which to store the values
+     */
+    void getBlockValues(const vpMatrix &block, unsigned int start, unsigned int end, vpColVector &s) const;
+
+    /**
+     * \brief Same as setValues(), but the values are written in the top left block of the matrix, which should at
+     * least have the size given by getBlockSize(start + s.size())
+     *
+     * @param s The vector from which to set the values
+     * @param start the zigzag index at which to start filling values
+     * @param block The top left block of the matrix in which the values will be replaced
+     */
+    void setBlockValues(const vpColVector &s, unsigned int start, vpMatrix &block) const;
+
   private:
     std::vector<unsigned> m_rowIndex; // Contains the row index of the nth value of the zigzag indexing
     std::vector<unsigned> m_colIndex; // Contains the row index of the nth value of the zigzag indexing
@@ -360,14 +392,16 @@ public:
   void interaction(const vpImage<unsigned char> &I, const vpMatrix &LI, const vpColVector &s, vpMatrix &L) VP_OVERRIDE;
 
 private:
-  void computeDCTMatrix(vpMatrix &D, unsigned int n) const;
+  void computeDCTMatrix(vpMatrix &D, unsigned int n, unsigned int nbFrequencies) const;
   void computeDCTMatrices(unsigned int rows, unsigned int cols);
+  void computeLowFrequencyDCT(const vpMatrix &M, vpMatrix &dct);
 
 protected:
   unsigned int m_Ih, m_Iw; //! image dimensions (without borders)
   vpMatrix m_Imat; //! Image as a matrix
-  vpMatrix m_dct; //! DCT representation of the image
-  vpMatrix m_Dcols, m_Drows; //! the computed DCT matrices. The separable property of DCt is used so that a 1D DCT is computed on rows and another on columns of the result of the first dct;
+  vpMatrix m_dct; //! Low frequency block of the DCT representation of the image, that contains the kept components
+  vpMatrix m_Dcols, m_Drows; //! the computed DCT matrices, restricted to the low frequencies of the kept components. The separable property of DCt is used so that a 1D DCT is computed on rows and another on columns of the result of the first dct;
+  vpMatrix m_dctTmp; //! Buffer for the result of the first 1D DCT, reused across frames
   std::array<vpMatrix, 6> m_dIdrPlanes; //! Luminance interaction matrix, seen as six image planes
   vpLuminanceDCT::vpMatrixZigZagIndex m_zigzag; //! zigzag indexing helper
 };
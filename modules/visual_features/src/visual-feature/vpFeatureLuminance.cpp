@@ -49,10 +49,37 @@
 
 #include <visp3/visual_features/vpFeatureLuminance.h>
 
+#include <algorithm>
+#include <vector>
+
 BEGIN_VISP_NAMESPACE
 
 const unsigned int vpFeatureLuminance::DEFAULT_BORDER = 10;
 
+namespace
+{
+/*!
+  Compute the image gradient, expressed in the metric space, along a part of an image row.
+  This is the same derivative filter as vpImageFilter::derivativeFilterX() and vpImageFilter::derivativeFilterY(),
+  written on contiguous rows so that the compiler can vectorize it.
+*/
+void computeRowGradients(const vpImage<unsigned char> &I, unsigned int i, unsigned int jStart, unsigned int jEnd,
+                         double px, double py, double *Ix, double *Iy)
+{
+  const unsigned char *r = I[i];
+  const unsigned char *rm1 = I[i - 1], *rm2 = I[i - 2], *rm3 = I[i - 3];
+  const unsigned char *rp1 = I[i + 1], *rp2 = I[i + 2], *rp3 = I[i + 3];
+  const unsigned int n = jEnd - jStart;
+  for (unsigned int k = 0; k < n; ++k) {
+    const unsigned int j = jStart + k;
+    Ix[k] = px * (((2047.0 * static_cast<double>(r[j + 1] - r[j - 1])) + (913.0 * static_cast<double>(r[j + 2] - r[j - 2])) +
+                   (112.0 * static_cast<double>(r[j + 3] - r[j - 3]))) / 8418.0);
+    Iy[k] = py * (((2047.0 * static_cast<double>(rp1[j] - rm1[j])) + (913.0 * static_cast<double>(rp2[j] - rm2[j])) +
+                   (112.0 * static_cast<double>(rp3[j] - rm3[j]))) / 8418.0);
+  }
+}
+}
+
 /*!
   Initialize the memory space requested for vpFeatureLuminance visual feature.
 */
@@ -181,41 +208,25 @@ void vpFeatureLuminance::setCameraParameters(const vpCameraParameters &_cam) { c
 vpFeatureLuminance &vpFeatureLuminance::buildFrom(vpImage<unsigned char> &I)
 {
   unsigned int l = 0;
-  double Ix, Iy;
 
   double px = cam.get_px();
   double py = cam.get_py();
 
   if (firstTimeIn == 0) {
     firstTimeIn = 1;
-    l = 0;
-    for (unsigned int i = bord; i < nbr - bord; i++) {
-      for (unsigned int j = bord; j < nbc - bord; j++) {
-
-        double x = 0, y = 0;
-        vpPixelMeterConversion::convertPoint(cam, j, i, x, y);
-
-        pixInfo[l].x = x;
-        pixInfo[l].y = y;
-        pixInfo[l].Z = Z;
-
-        ++l;
-      }
-    }
+    initPixelCoordinates();
   }
 
-  l = 0;
+  const unsigned int w = nbc - 2 * bord;
+  std::vector<double> Ix(w), Iy(w);
 
   for (unsigned int i = bord; i < (nbr - bord); ++i) {
+    computeRowGradients(I, i, bord, nbc - bord, px, py, Ix.data(), Iy.data());
     for (unsigned int j = bord; j < (nbc - bord); ++j) {
-      Ix = px * vpImageFilter::derivativeFilterX(I, i, j);
-      Iy = py * vpImageFilter::derivativeFilterY(I, i, j);
-
-      // Calcul de Z
       pixInfo[l].I = I[i][j];
       s[l] = I[i][j];
-      pixInfo[l].Ix = Ix;
-      pixInfo[l].Iy = Iy;
+      pixInfo[l].Ix = Ix[j - bord];
+      pixInfo[l].Iy = Iy[j - bord];
 
       ++l;
     }
@@ -223,6 +234,132 @@ vpFeatureLuminance &vpFeatureLuminance::buildFrom(vpImage<unsigned char> &I)
   return *this;
 }
 
+/*!
+  Compute the normalized coordinates of the pixels used by the feature, and initialize their depth to \f$ Z \f$.
+*/
+void vpFeatureLuminance::initPixelCoordinates()
+{
+  unsigned int l = 0;
+  for (unsigned int i = bord; i < nbr - bord; i++) {
+    for (unsigned int j = bord; j < nbc - bord; j++) {
+
+      double x = 0, y = 0;
+      vpPixelMeterConversion::convertPoint(cam, j, i, x, y);
+
+      pixInfo[l].x = x;
+      pixInfo[l].y = y;
+      pixInfo[l].Z = Z;
+
+      ++l;
+    }
+  }
+}
+
+/*!
+  Update the feature from the image \e I and compute, in the same pass, the normal equations
+  \f$ {\bf L}^\top {\bf L} \f$ and \f$ {\bf L}^\top {\bf e} \f$ where \f$ {\bf L} \f$ is the interaction
+  matrix of the current feature and \f$ {\bf e} = {\bf I} - {\bf I}^* \f$ the error with respect to the desired feature.
+
+  This is equivalent to calling buildFrom(), interaction() and error(), and then computing the products, but the
+  \f$ dim\_s \times 6 \f$ interaction matrix is never stored: the products are accumulated row by row, in parallel
+  when OpenMP is available. A Gauss-Newton or Levenberg-Marquardt velocity can then be computed from the 6x6 system.
+
+  Only the feature values \f$ {\bf I} \f$ are updated: the image gradients are not stored, so that interaction()
+  should only be called after buildFrom().
+
+  \param I : Current image, with the size given to init().
+  \param s_star : Desired visual feature. It can be this feature, in which case the error is null and only
+  \f$ {\bf L}^\top {\bf L} \f$ is meaningful.
+  \param LTL : Resulting 6x6 matrix \f$ {\bf L}^\top {\bf L} \f$.
+  \param LTe : Resulting 6-dimensional vector \f$ {\bf L}^\top {\bf e} \f$.
+*/
+void vpFeatureLuminance::computeNormalEquations(const vpImage<unsigned char> &I, const vpFeatureLuminance &s_star,
+                                                vpMatrix &LTL, vpColVector &LTe)
+{
+  if ((I.getHeight() != nbr) || (I.getWidth() != nbc)) {
+    throw vpException(vpException::dimensionError, "Image size (%dx%d) differs from the feature size (%dx%d)",
+                      I.getHeight(), I.getWidth(), nbr, nbc);
+  }
+  if (s_star.dim_s != dim_s) {
+    throw vpException(vpException::dimensionError, "Current and desired features have different dimensions");
+  }
+
+  if (firstTimeIn == 0) {
+    firstTimeIn = 1;
+    initPixelCoordinates();
+  }
+
+  const double px = cam.get_px();
+  const double py = cam.get_py();
+  const int h = static_cast<int>(nbr - 2 * bord);
+  const unsigned int w = nbc - 2 * bord;
+  // 21 terms for the upper triangle of L^T L, followed by the 6 terms of L^T e
+  const unsigned int nbSums = 27;
+  // Per row sums, added afterwards in a fixed order so that the result does not depend on the number of threads
+  std::vector<double> rowSums(static_cast<size_t>(h) * nbSums);
+  const double *sd = s_star.s.data;
+  double *sc = s.data;
+
+#if defined(VISP_HAVE_OPENMP)
+#pragma omp parallel
+#endif
+  {
+    std::vector<double> Ix(w), Iy(w);
+#if defined(VISP_HAVE_OPENMP)
+#pragma omp for
+#endif
+    for (int r = 0; r < h; ++r) {
+      const unsigned int i = static_cast<unsigned int>(r) + bord;
+      computeRowGradients(I, i, bord, nbc - bord, px, py, Ix.data(), Iy.data());
+      const unsigned char *row = I[i] + bord;
+      const unsigned int l0 = static_cast<unsigned int>(r) * w;
+      double acc[27] = { 0.0 };
+      for (unsigned int k = 0; k < w; ++k) {
+        const unsigned int l = l0 + k;
+        const vpLuminance &p = pixInfo[l];
+        const double x = p.x, y = p.y, Zinv = 1 / p.Z;
+        const double Ixk = Ix[k], Iyk = Iy[k];
+        const double Lr[6] = { Ixk * Zinv,
+                               Iyk * Zinv,
+                               -(x * Ixk + y * Iyk) * Zinv,
+                               -Ixk * x * y - (1 + y * y) * Iyk,
+                               (1 + x * x) * Ixk + Iyk * x * y,
+                               Iyk * x - Ixk * y };
+        sc[l] = row[k];
+        const double e = sc[l] - sd[l];
+        unsigned int n = 0;
+        for (unsigned int a = 0; a < 6; ++a) {
+          for (unsigned int b = a; b < 6; ++b) {
+            acc[n++] += Lr[a] * Lr[b];
+          }
+        }
+        for (unsigned int a = 0; a < 6; ++a) {
+          acc[21 + a] += Lr[a] * e;
+        }
+      }
+      std::copy(acc, acc + nbSums, rowSums.begin() + static_cast<size_t>(r) * nbSums);
+    }
+  }
+
+  double sums[27] = { 0.0 };
+  for (int r = 0; r < h; ++r) {
+    const double *rs = &rowSums[static_cast<size_t>(r) * nbSums];
+    for (unsigned int n = 0; n < nbSums; ++n) {
+      sums[n] += rs[n];
+    }
+  }
+
+  LTL.resize(6, 6, false, false);
+  LTe.resize(6, false);
+  unsigned int n = 0;
+  for (unsigned int a = 0; a < 6; ++a) {
+    for (unsigned int b = a; b < 6; ++b) {
+      LTL[a][b] = LTL[b][a] = sums[n++];
+    }
+    LTe[a] = sums[21 + a];
+  }
+}
+
 /*!
   Compute and return the interaction matrix \f$ L_I \f$. The computation is
   made thanks to the values of the luminance features \f$ I \f$
@@ -421,6 +421,50 @@ void vpLuminanceDCT::vpMatrixZigZagIndex::setValues(const vpColVector &s, unsign
   }
 }
 
+void vpLuminanceDCT::vpMatrixZigZagIndex::getBlockSize(unsigned int end, unsigned int &rows, unsigned int &cols) const
+{
+  if (end > m_rowIndex.size()) {
+    throw vpException(vpException::dimensionError, "End index exceeds matrix size");
+  }
+  rows = 0;
+  cols = 0;
+  for (unsigned int index = 0; index < end; ++index) {
+    rows = std::max(rows, m_rowIndex[index] + 1);
+    cols = std::max(cols, m_colIndex[index] + 1);
+  }
+}
+
+void vpLuminanceDCT::vpMatrixZigZagIndex::getBlockValues(const vpMatrix &block, unsigned int start, unsigned int end, vpColVector &s) const
+{
+  if (end <= start) {
+    throw vpException(vpException::dimensionError, "End index should be > to the start index");
+  }
+  unsigned int rows, cols;
+  getBlockSize(end, rows, cols);
+  if (block.getRows() < rows || block.getCols() < cols) {
+    throw vpException(vpException::dimensionError, "Input block is too small");
+  }
+
+  s.resize(end - start, false);
+
+  for (unsigned index = start; index < end; ++index) {
+    s[index - start] = block[m_rowIndex[index]][m_colIndex[index]];
+  }
+}
+
+void vpLuminanceDCT::vpMatrixZigZagIndex::setBlockValues(const vpColVector &s, unsigned int start, vpMatrix &block) const
+{
+  unsigned int rows, cols;
+  getBlockSize(start + s.size(), rows, cols);
+  if (block.getRows() < rows || block.getCols() < cols) {
+    throw vpException(vpException::dimensionError, "Input block is too small");
+  }
+
+  for (unsigned index = start; index < start + s.size(); ++index) {
+    block[m_rowIndex[index]][m_colIndex[index]] = s[index - start];
+  }
+}
+
 // vpLuminanceDCT
 
 vpLuminanceDCT::vpLuminanceDCT(const vpLuminanceDCT &other) : vpLuminanceMapping(other.getProjectionSize())
@@ -430,25 +474,26 @@ vpLuminanceDCT::vpLuminanceDCT(const vpLuminanceDCT &other) : vpLuminanceMapping
 
 void vpLuminanceDCT::map(const vpImage<unsigned char> &I, vpColVector &s)
 {
-  m_Ih = I.getHeight() - 2 * m_border;
-  m_Iw = I.getWidth() - 2 * m_border;
-  if (m_Imat.getCols() != m_Ih || m_Imat.getRows() != m_Iw) {
+  const unsigned int Ih = I.getHeight() - 2 * m_border;
+  const unsigned int Iw = I.getWidth() - 2 * m_border;
+  if (Ih != m_Ih || Iw != m_Iw || m_Dcols.getCols() != Ih || m_Drows.getRows() != Iw) {
+    m_Ih = Ih;
+    m_Iw = Iw;
     computeDCTMatrices(m_Ih, m_Iw);
-    m_zigzag.init(m_Ih, m_Iw);
   }
   imageAsMatrix(I, m_Imat, m_border);
-  m_dct = m_Dcols * m_Imat * m_Drows;
-  m_zigzag.getValues(m_dct, 0, m_mappingSize, s);
+  computeLowFrequencyDCT(m_Imat, m_dct);
+  m_zigzag.getBlockValues(m_dct, 0, m_mappingSize, s);
 }
 
-void vpLuminanceDCT::computeDCTMatrix(vpMatrix &D, unsigned int n) const
+void vpLuminanceDCT::computeDCTMatrix(vpMatrix &D, unsigned int n, unsigned int nbFrequencies) const
 {
-  D.resize(n, n, false, false);
+  D.resize(nbFrequencies, n, false, false);
   for (unsigned i = 0; i < n; i++) {
     D[0][i] = 1.0 / sqrt(n);
   }
   double alpha = sqrt(2./(n));
-  for (unsigned int i = 1; i < n; i++) {
+  for (unsigned int i = 1; i < nbFrequencies; i++) {
     for (unsigned int j = 0; j < n; j++) {
       D[i][j] = alpha*cos((2 * j + 1) * i * M_PI / (2.0 * n));
     }
@@ -457,16 +502,40 @@ void vpLuminanceDCT::computeDCTMatrix(vpMatrix &D, unsigned int n) const
 
 void vpLuminanceDCT::computeDCTMatrices(unsigned int rows, unsigned int cols)
 {
-  computeDCTMatrix(m_Dcols, rows);
-  computeDCTMatrix(m_Drows, cols);
+  if (m_mappingSize > rows * cols) {
+    throw vpException(vpException::dimensionError, "The number of DCT components (%d) exceeds the image size (%dx%d)",
+                      m_mappingSize, rows, cols);
+  }
+  m_zigzag.init(rows, cols);
+  // The kept components only involve the lowest frequencies: only these rows of the 1D DCT matrices are needed
+  unsigned int nbRowFrequencies, nbColFrequencies;
+  m_zigzag.getBlockSize(m_mappingSize, nbRowFrequencies, nbColFrequencies);
+  computeDCTMatrix(m_Dcols, rows, nbRowFrequencies);
+  computeDCTMatrix(m_Drows, cols, nbColFrequencies);
   m_Drows = m_Drows.transpose();
 }
 
+void vpLuminanceDCT::computeLowFrequencyDCT(const vpMatrix &M, vpMatrix &dct)
+{
+  // dct = m_Dcols * M * m_Drows, in the order requiring the fewest operations
+  const unsigned int nbRowFrequencies = m_Dcols.getRows(), nbColFrequencies = m_Drows.getCols();
+  const double costColsFirst = static_cast<double>(nbRowFrequencies) * m_Iw * (m_Ih + nbColFrequencies);
+  const double costRowsFirst = static_cast<double>(nbColFrequencies) * m_Ih * (m_Iw + nbRowFrequencies);
+  if (costColsFirst <= costRowsFirst) {
+    vpMatrix::mult2Matrices(m_Dcols, M, m_dctTmp);
+    vpMatrix::mult2Matrices(m_dctTmp, m_Drows, dct);
+  }
+  else {
+    vpMatrix::mult2Matrices(M, m_Drows, m_dctTmp);
+    vpMatrix::mult2Matrices(m_Dcols, m_dctTmp, dct);
+  }
+}
+
 void vpLuminanceDCT::inverse(const vpColVector &s, vpImage<unsigned char> &I)
 {
   vpMatrix dctCut(m_dct.getRows(), m_dct.getCols(), 0.0);
-  m_zigzag.setValues(s, 0, dctCut);
-  const vpMatrix Ir = m_Dcols.t() * dctCut * m_Drows.t();
+  m_zigzag.setBlockValues(s, 0, dctCut);
+  const vpMatrix Ir = m_Dcols.t() * (dctCut * m_Drows.t());
   I.resize(Ir.getRows(), Ir.getCols());
   for (unsigned int i = 0; i < I.getRows(); ++i) {
     for (unsigned int j = 0; j < I.getCols(); ++j) {
@@ -477,18 +546,23 @@ void vpLuminanceDCT::inverse(const vpColVector &s, vpImage<unsigned char> &I)
 
 void vpLuminanceDCT::interaction(const vpImage<unsigned char> &, const vpMatrix &LI, const vpColVector &, vpMatrix &L)
 {
-  const vpMatrix LIT = LI.t();
   for (unsigned int dof = 0; dof < 6; ++dof) {
     m_dIdrPlanes[dof].resize(m_Ih, m_Iw, false, false);
-    memcpy(m_dIdrPlanes[dof].data, LIT[dof], m_Ih * m_Iw * sizeof(double));
+  }
+  // Split the columns of LI into six image planes, without transposing LI
+  for (unsigned int i = 0; i < m_Ih * m_Iw; ++i) {
+    const double *LIi = LI[i];
+    for (unsigned int dof = 0; dof < 6; ++dof) {
+      m_dIdrPlanes[dof].data[i] = LIi[dof];
+    }
   }
 
   L.resize(m_mappingSize, 6, false, false);
-  vpMatrix dTddof(m_Ih, m_Iw);
+  vpMatrix dTddof;
   vpColVector column;
   for (unsigned int dof = 0; dof < 6; ++dof) {
-    dTddof = m_Dcols * m_dIdrPlanes[dof] * m_Drows;
-    m_zigzag.getValues(dTddof, 0, m_mappingSize, column);
+    computeLowFrequencyDCT(m_dIdrPlanes[dof], dTddof);
+    m_zigzag.getBlockValues(dTddof, 0, m_mappingSize, column);
     for (unsigned int row = 0; row < L.getRows(); ++row) {
       L[row][dof] = column[row];
     }
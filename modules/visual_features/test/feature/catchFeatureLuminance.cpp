@@ -0,0 +1,180 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Test the luminance visual feature.
+ */
+
+/*!
+  \example catchFeatureLuminance.cpp
+
+  Test that the normal equations computed in a single pass by vpFeatureLuminance are the same as the ones
+  obtained from the full interaction matrix.
+ */
+
+#include <visp3/core/vpConfig.h>
+
+#if defined(VISP_HAVE_CATCH2)
+
+#if defined(VISP_BUILD_CATCH2)
+#include <catch_amalgamated.hpp>
+#else // Since v3.1.1
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <visp3/core/vpImageFilter.h>
+#include <visp3/visual_features/vpFeatureLuminance.h>
+
+#ifdef ENABLE_VISP_NAMESPACE
+using namespace VISP_NAMESPACE_NAME;
+#endif
+
+namespace
+{
+// Smooth textured image, shifted by (du, dv) pixels
+vpImage<unsigned char> generateImage(unsigned int h, unsigned int w, double du, double dv)
+{
+  vpImage<unsigned char> I(h, w);
+  for (unsigned int i = 0; i < h; ++i) {
+    for (unsigned int j = 0; j < w; ++j) {
+      const double u = j + du, v = i + dv;
+      const double val = 127.5 + 60.0 * sin(0.11 * u) * cos(0.07 * v) + 50.0 * sin(0.05 * (u + 2.0 * v));
+      I[i][j] = static_cast<unsigned char>(vpMath::round(val));
+    }
+  }
+  return I;
+}
+
+vpFeatureLuminance createFeature(unsigned int h, unsigned int w)
+{
+  vpFeatureLuminance s;
+  s.setCameraParameters(vpCameraParameters(600, 620, w / 2.0, h / 2.0));
+  s.init(h, w, 0.8);
+  return s;
+}
+}
+
+SCENARIO("Computing the luminance normal equations in a single pass", "[visual_features]")
+{
+  GIVEN("A desired and a current image")
+  {
+    const unsigned int h = 96, w = 128;
+    vpImage<unsigned char> Id = generateImage(h, w, 0.0, 0.0);
+    vpImage<unsigned char> I = generateImage(h, w, 2.5, -1.5);
+    vpFeatureLuminance sd = createFeature(h, w);
+    sd.buildFrom(Id);
+
+    WHEN("Building the feature")
+    {
+      vpFeatureLuminance s = createFeature(h, w);
+      s.buildFrom(I);
+      THEN("The interaction matrix uses the usual image derivatives")
+      {
+        vpMatrix L;
+        s.interaction(L);
+        const unsigned int bord = s.getBorder();
+        const unsigned int i = h / 2, j = w / 3;
+        const unsigned int l = (i - bord) * (w - 2 * bord) + (j - bord);
+        const double Ix = 600 * vpImageFilter::derivativeFilterX(I, i, j);
+        const double Iy = 620 * vpImageFilter::derivativeFilterY(I, i, j);
+        const double Zinv = 1.0 / 0.8;
+        REQUIRE(L[l][0] == Catch::Approx(Ix * Zinv).margin(1e-12));
+        REQUIRE(L[l][1] == Catch::Approx(Iy * Zinv).margin(1e-12));
+      }
+    }
+
+    WHEN("Computing the normal equations in a single pass")
+    {
+      vpFeatureLuminance sRef = createFeature(h, w);
+      sRef.buildFrom(I);
+      vpMatrix L;
+      sRef.interaction(L);
+      vpColVector e;
+      sRef.error(sd, e);
+      const vpMatrix LTLRef = L.AtA();
+      const vpColVector LTeRef = L.t() * e;
+
+      vpFeatureLuminance s = createFeature(h, w);
+      vpMatrix LTL;
+      vpColVector LTe;
+      s.computeNormalEquations(I, sd, LTL, LTe);
+
+      THEN("The feature values are updated")
+      {
+        vpColVector eFused;
+        s.error(sd, eFused);
+        REQUIRE(eFused == e);
+      }
+      THEN("The normal equations are the same as with the full interaction matrix")
+      {
+        REQUIRE(LTL.getRows() == 6);
+        REQUIRE(LTL.getCols() == 6);
+        REQUIRE(LTe.size() == 6);
+        for (unsigned int a = 0; a < 6; ++a) {
+          for (unsigned int b = 0; b < 6; ++b) {
+            REQUIRE(LTL[a][b] == Catch::Approx(LTLRef[a][b]).epsilon(1e-10).margin(1e-6));
+          }
+          REQUIRE(LTe[a] == Catch::Approx(LTeRef[a]).epsilon(1e-10).margin(1e-6));
+        }
+      }
+      THEN("Using the desired feature as reference gives a null error")
+      {
+        sd.computeNormalEquations(Id, sd, LTL, LTe);
+        REQUIRE(LTe.frobeniusNorm() == 0.0);
+      }
+    }
+
+    WHEN("The image size differs from the feature size")
+    {
+      vpFeatureLuminance s = createFeature(h, w);
+      vpImage<unsigned char> Iwrong(h + 1, w);
+      vpMatrix LTL;
+      vpColVector LTe;
+      THEN("An exception is thrown")
+      {
+        REQUIRE_THROWS(s.computeNormalEquations(Iwrong, sd, LTL, LTe));
+      }
+    }
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  Catch::Session session;
+  session.applyCommandLine(argc, argv);
+
+  int numFailed = session.run();
+
+  return numFailed;
+}
+#else
+#include <iostream>
+
+int main() { return EXIT_SUCCESS; }
+#endif
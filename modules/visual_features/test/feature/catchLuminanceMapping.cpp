@@ -444,6 +444,113 @@ SCENARIO("Using DCT features", "[visual_features]")
         }
       }
     }
+
+    GIVEN("A zigzag indexing of a large matrix")
+    {
+      vpUniRand rand(11);
+      vpMatrix m(12, 20);
+      for (unsigned int i = 0; i < m.size(); ++i) {
+        m.data[i] = rand.uniform(-1.0, 1.0);
+      }
+      vpLuminanceDCT::vpMatrixZigZagIndex zigzag;
+      zigzag.init(m.getRows(), m.getCols());
+      const unsigned int k = 10;
+      unsigned int rows, cols;
+      zigzag.getBlockSize(k, rows, cols);
+      THEN("The block containing the first components is the expected one")
+      {
+        REQUIRE(rows == 4);
+        REQUIRE(cols == 4);
+      }
+      THEN("Reading from the block is the same as reading from the full matrix")
+      {
+        const vpMatrix block(m, 0, 0, rows, cols);
+        vpColVector s, sBlock;
+        zigzag.getValues(m, 0, k, s);
+        zigzag.getBlockValues(block, 0, k, sBlock);
+        REQUIRE(s == sBlock);
+        vpMatrix blockWrite(rows, cols, 0.0);
+        zigzag.setBlockValues(s, 0, blockWrite);
+        zigzag.getBlockValues(blockWrite, 0, k, sBlock);
+        REQUIRE(s == sBlock);
+      }
+      THEN("Using a block that is too small throws")
+      {
+        vpMatrix small(rows - 1, cols);
+        vpColVector s(k);
+        REQUIRE_THROWS(zigzag.getBlockValues(small, 0, k, s));
+        REQUIRE_THROWS(zigzag.setBlockValues(s, 0, small));
+      }
+    }
+
+    GIVEN("Random images of different sizes")
+    {
+      const unsigned int border = 2;
+      const unsigned int k = 24;
+      vpLuminanceDCT dct(k);
+      dct.setBorder(border);
+      vpUniRand rand(5);
+      const std::vector<std::pair<unsigned int, unsigned int> > sizes = { {24, 40}, {40, 24}, {31, 17} };
+      for (const std::pair<unsigned int, unsigned int> &size : sizes) {
+        const unsigned int h = size.first, w = size.second;
+        vpImage<unsigned char> I(h + 2 * border, w + 2 * border);
+        for (unsigned int i = 0; i < I.getSize(); ++i) {
+          I.bitmap[i] = static_cast<unsigned char>(rand.uniform(0, 256));
+        }
+        WHEN("Computing DCT on a " + std::to_string(h) + "x" + std::to_string(w) + " image")
+        {
+          vpColVector s;
+          dct.map(I, s);
+          THEN("The low frequency components are the same as with the full DCT")
+          {
+            // Reference: dense DCT-II of the whole image
+            vpMatrix Dh(h, h), Dw(w, w);
+            for (unsigned int n = 0; n < 2; ++n) {
+              vpMatrix &D = n == 0 ? Dh : Dw;
+              const unsigned int N = D.getRows();
+              for (unsigned int i = 0; i < N; ++i) {
+                for (unsigned int j = 0; j < N; ++j) {
+                  D[i][j] = i == 0 ? 1.0 / sqrt(N) : sqrt(2.0 / N) * cos((2 * j + 1) * i * M_PI / (2.0 * N));
+                }
+              }
+            }
+            vpMatrix Imat(h, w);
+            for (unsigned int i = 0; i < h; ++i) {
+              for (unsigned int j = 0; j < w; ++j) {
+                Imat[i][j] = I[i + border][j + border];
+              }
+            }
+            const vpMatrix full = Dh * Imat * Dw.t();
+            vpLuminanceDCT::vpMatrixZigZagIndex zigzag;
+            zigzag.init(h, w);
+            vpColVector sRef;
+            zigzag.getValues(full, 0, k, sRef);
+            REQUIRE(s.size() == k);
+            for (unsigned int i = 0; i < k; ++i) {
+              REQUIRE(s[i] == Catch::Approx(sRef[i]).margin(1e-8));
+            }
+          }
+          THEN("Inverse mapping has the size of the cropped image")
+          {
+            vpImage<unsigned char> Ir;
+            dct.inverse(s, Ir);
+            REQUIRE(Ir.getRows() == h);
+            REQUIRE(Ir.getCols() == w);
+          }
+        }
+      }
+    }
+    GIVEN("An image that is smaller than the number of components")
+    {
+      vpImage<unsigned char> I(4, 4, 0);
+      vpLuminanceDCT dct(32);
+      dct.setBorder(0);
+      vpColVector s;
+      THEN("Mapping throws")
+      {
+        REQUIRE_THROWS(dct.map(I, s));
+      }
+    }
   }
 }
 #endif
@@ -0,0 +1,131 @@
+/*
+ * ViSP, open source Visual Servoing Platform software.
+ * Copyright (C) 2005 - 2026 by Inria. All rights reserved.
+ *
+ * This software is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * See the file LICENSE.txt at the root directory of this source
+ * distribution for additional information about the GNU GPL.
+ *
+ * For using ViSP with software that can not be combined with the GNU
+ * GPL, please contact Inria about acquiring a ViSP Professional
+ * Edition License.
+ *
+ * See https://visp.inria.fr for more information.
+ *
+ * This software was developed at:
+ * Inria Rennes - Bretagne Atlantique
+ * Campus Universitaire de Beaulieu
+ * 35042 Rennes Cedex
+ * France
+ *
+ * If you have questions regarding the use of this file, please contact
+ * Inria at visp@inria.fr
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * Description:
+ * Benchmark the luminance visual feature.
+ */
+
+/*!
+  \example perfFeatureLuminance.cpp
+
+  Compare the execution times of the luminance normal equations computed in a single pass by vpFeatureLuminance
+  and from the full interaction matrix.
+ */
+
+#include <visp3/core/vpConfig.h>
+
+#if defined(VISP_HAVE_CATCH2)
+
+#if defined(VISP_BUILD_CATCH2)
+#include <catch_amalgamated.hpp>
+#else // Since v3.1.1
+#include <catch2/catch_all.hpp>
+#endif
+
+#include <visp3/core/vpImageFilter.h>
+#include <visp3/visual_features/vpFeatureLuminance.h>
+
+#ifdef ENABLE_VISP_NAMESPACE
+using namespace VISP_NAMESPACE_NAME;
+#endif
+
+namespace
+{
+bool g_runBenchmark = false;
+
+// Smooth textured image, shifted by (du, dv) pixels
+vpImage<unsigned char> generateImage(unsigned int h, unsigned int w, double du, double dv)
+{
+  vpImage<unsigned char> I(h, w);
+  for (unsigned int i = 0; i < h; ++i) {
+    for (unsigned int j = 0; j < w; ++j) {
+      const double u = j + du, v = i + dv;
+      const double val = 127.5 + 60.0 * sin(0.11 * u) * cos(0.07 * v) + 50.0 * sin(0.05 * (u + 2.0 * v));
+      I[i][j] = static_cast<unsigned char>(vpMath::round(val));
+    }
+  }
+  return I;
+}
+
+vpFeatureLuminance createFeature(unsigned int h, unsigned int w)
+{
+  vpFeatureLuminance s;
+  s.setCameraParameters(vpCameraParameters(600, 620, w / 2.0, h / 2.0));
+  s.init(h, w, 0.8);
+  return s;
+}
+}
+
+TEST_CASE("Benchmark luminance normal equations", "[benchmark]")
+{
+  if (g_runBenchmark) {
+    const unsigned int h = 480, w = 640;
+    vpImage<unsigned char> Id = generateImage(h, w, 0.0, 0.0);
+    vpImage<unsigned char> I = generateImage(h, w, 2.5, -1.5);
+    vpFeatureLuminance sd = createFeature(h, w);
+    sd.buildFrom(Id);
+    vpFeatureLuminance s = createFeature(h, w);
+    vpMatrix L, LTL;
+    vpColVector e, LTe;
+
+    BENCHMARK("buildFrom + interaction + error + products")
+    {
+      s.buildFrom(I);
+      s.interaction(L);
+      s.error(sd, e);
+      LTL = L.AtA();
+      LTe = L.t() * e;
+      return LTe;
+    };
+    BENCHMARK("computeNormalEquations")
+    {
+      s.computeNormalEquations(I, sd, LTL, LTe);
+      return LTe;
+    };
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  Catch::Session session;
+  auto cli = session.cli()
+    | Catch::Clara::Opt(g_runBenchmark)["--benchmark"]("run benchmark?");
+
+  session.cli(cli);
+  session.applyCommandLine(argc, argv);
+
+  int numFailed = session.run();
+
+  return numFailed;
+}
+#else
+#include <iostream>
+
+int main() { return EXIT_SUCCESS; }
+#endif